@@ -8,7 +8,9 @@
 //! @brief Utility functions to create atomic models based on sound asset structure principles
 
 #include "Api.h"
+#include "PrimvarData.h"
 
+#include <pxr/base/vt/array.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
@@ -17,6 +19,8 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace usdex::core
 {
@@ -375,6 +379,70 @@ USDEX_API pxr::UsdPrim definePayload(
     std::optional<pxr::SdfPath> primPath = std::nullopt
 );
 
+//! A single reference or payload to define via `defineReferences` or `definePayloads`.
+//!
+//! The members match the arguments of the `sourceIdentifier` overloads of `defineReference` and `definePayload`.
+class ReferencePayloadData
+{
+public:
+
+    pxr::SdfPath path; //!< The absolute prim path at which to define the reference/payload
+    std::string sourceIdentifier; //!< The identifier of the external USD file to reference/payload
+    std::optional<pxr::SdfPath> primPath; //!< Absolute prim path in the external USD file. If not provided, uses the default prim's path
+};
+
+//! Define many references to external USD files at once.
+//!
+//! The result is equivalent to calling the `sourceIdentifier` overload of `defineReference` for each element of `references`, but is
+//! significantly faster when many prims reference a smaller number of source files (e.g. placing the assets of a library).
+//!
+//! Each distinct source identifier is resolved, opened, and anchored relative to the edit target once. All of the references are validated
+//! before any scene description is authored. If any reference is invalid, or the same path is requested more than once, a runtime error is
+//! posted for each failure and no references are defined.
+//!
+//! Valid references are authored directly to the `SdfLayer` of the current edit target within a single `SdfChangeBlock`.
+//!
+//! @param stage The stage on which to define the references
+//! @param references The path, source identifier, and optional source prim path of each reference
+//!
+//! @returns The newly created reference prims, in the same order as `references`, or an empty vector if the references could not be defined.
+USDEX_API std::vector<pxr::UsdPrim> defineReferences(pxr::UsdStagePtr stage, const std::vector<ReferencePayloadData>& references);
+
+//! Define many payloads to external USD files at once.
+//!
+//! The result is equivalent to calling the `sourceIdentifier` overload of `definePayload` for each element of `payloads`. See
+//! `defineReferences` for details.
+//!
+//! @param stage The stage on which to define the payloads
+//! @param payloads The path, source identifier, and optional source prim path of each payload
+//!
+//! @returns The newly created payload prims, in the same order as `payloads`, or an empty vector if the payloads could not be defined.
+USDEX_API std::vector<pxr::UsdPrim> definePayloads(pxr::UsdStagePtr stage, const std::vector<ReferencePayloadData>& payloads);
+
+//! Controls how the default prim of an asset is transferred between the layers of an asset (e.g. from the Asset Interface to the Payload).
+enum class AssetCopyPolicy
+{
+    eFull = 0, //!< Copy the entire spec tree of the default prim, including its properties and descendants.
+    eInterface, //!< Copy only the default prim's own metadata and composition arcs (including variant sets), skipping its properties and descendants.
+    eMove //!< Copy the entire spec tree of the default prim, then remove its properties and descendants from the source layer.
+};
+
+//! Copy the default prim spec from the root layer of one stage to the root layer of another
+//!
+//! The spec is authored at the default prim path of the target stage, which may differ in name from the source. Any existing opinions on the
+//! target spec are replaced, other than the properties and descendants that are skipped by `AssetCopyPolicy::eInterface`.
+//!
+//! The `AssetCopyPolicy::eInterface` policy avoids duplicating large inline content when only the interface of the prim is required (e.g. when it
+//! will be payloaded). The `AssetCopyPolicy::eMove` policy transfers the content rather than duplicating it, which is useful when the source
+//! opinions will be discarded afterwards. Array values are shared between the layers rather than reallocated, so the memory held by the moved
+//! specs is released once the source layer is edited.
+//!
+//! @param source The stage whose default prim will be copied
+//! @param target The stage whose default prim will be authored. This must have a default prim name, but the prim does not need to exist.
+//! @param copyPolicy The policy that determines which specs are copied (default: `AssetCopyPolicy::eFull`)
+//! @returns True if the spec was copied successfully, false otherwise
+USDEX_API bool copyDefaultPrimSpec(pxr::UsdStagePtr source, pxr::UsdStagePtr target, AssetCopyPolicy copyPolicy = AssetCopyPolicy::eFull);
+
 //! Create a relative layer within a `getPayloadToken()` subdirectory to hold the content of an asset
 //!
 //! This layer represents the root layer of the Payload that the Asset Interface targets.
@@ -387,11 +455,13 @@ USDEX_API pxr::UsdPrim definePayload(
 //! @param stage The stage's edit target identifier will dictate where the relative payload layer will be created
 //! @param format The file format extension (default: "usda")
 //! @param fileFormatArgs Additional file format-specific arguments to be supplied during stage creation.
+//! @param copyPolicy How the asset stage's default prim is copied to the payload layer. See `copyDefaultPrimSpec()` for details.
 //! @returns The newly created relative payload layer opened as a new stage. Returns an invalid stage on error.
 USDEX_API pxr::UsdStageRefPtr createAssetPayload(
     pxr::UsdStagePtr stage,
     const std::string& format = "usda",
-    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments(),
+    AssetCopyPolicy copyPolicy = AssetCopyPolicy::eFull
 );
 
 //! Create a Library Layer from which the Content Layers can reference prims
@@ -411,6 +481,87 @@ USDEX_API pxr::UsdStageRefPtr addAssetLibrary(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
 );
 
+//! Deduplicates identical meshes into an asset's geometry library, and defines instanceable references to them in the Content Layers
+//!
+//! Assemblies often contain many copies of the same part (e.g. fasteners in a CAD assembly). Authoring each copy in full with `definePolyMesh`
+//! causes the size of the asset to grow with the number of copies. Instead, each mesh defined via a `MeshLibrary` is hashed, and only the first
+//! occurrence of each unique mesh is authored into the Library Layer. Every occurrence (including the first) is defined as an instanceable
+//! reference to the library entry, so that the copies also share a single prototype once the asset is composed.
+//!
+//! Meshes are considered identical if their topology and primvars are equal, and their points are equal after snapping each component to a grid
+//! with a cell size of `tolerance`. A zero tolerance requires the points to be bitwise identical. The meshes are compared in their local space,
+//! so any transform should be authored on the instance prim rather than baked into the points.
+//!
+//! Each library entry is an `Xform` prim, named after the first instance, with a single `Mesh` child prim. The entries are defined below the
+//! default prim of the library stage, which is typically created via `addAssetLibrary(stage, getGeometryToken())`.
+//!
+//! @warning A separate instance of this class should be used per-thread, calling methods from multiple threads is not safe.
+class USDEX_API MeshLibrary
+{
+
+public:
+
+    //! Bind a mesh library to the Library Layer of an asset.
+    //!
+    //! Use `isValid()` to check whether the library was bound successfully.
+    //!
+    //! @param library The library stage, which must have a default prim
+    //! @param tolerance The grid cell size used to compare points. Zero requires the points to be bitwise identical.
+    explicit MeshLibrary(pxr::UsdStagePtr library, float tolerance = 0.0f);
+    ~MeshLibrary();
+
+    MeshLibrary(const MeshLibrary&) = delete;
+    MeshLibrary& operator=(const MeshLibrary&) = delete;
+
+    //! Whether the library stage is valid, has a default prim, and the tolerance is a finite non-negative value.
+    //!
+    //! @returns Whether meshes can be defined.
+    bool isValid() const;
+
+    //! Define an instance of a mesh, authoring the mesh into the library if no identical mesh has been defined previously.
+    //!
+    //! The mesh data is validated in the same way as `definePolyMesh` when it is first added to the library. The instance is defined via
+    //! `defineReference` and is marked as instanceable.
+    //!
+    //! @param stage The stage on which to define the instance (e.g. a Content Layer from `addAssetContent`)
+    //! @param path The absolute prim path at which to define the instance
+    //! @param faceVertexCounts The number of vertices in each face of the mesh
+    //! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+    //! @param points Vertex positions for the mesh described in local space
+    //! @param normals Values to be authored for the normals primvar
+    //! @param uvs Values to be authored for the uv primvar
+    //! @param displayColor Values to be authored for the display color primvar
+    //! @param displayOpacity Values to be authored for the display opacity primvar
+    //!
+    //! @returns The instanceable reference prim. Returns an invalid prim on error.
+    pxr::UsdPrim defineMesh(
+        pxr::UsdStagePtr stage,
+        const pxr::SdfPath& path,
+        const pxr::VtIntArray& faceVertexCounts,
+        const pxr::VtIntArray& faceVertexIndices,
+        const pxr::VtVec3fArray& points,
+        std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+        std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+        std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+        std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+    );
+
+    //! The number of unique meshes that have been authored into the library.
+    //!
+    //! @returns The number of library entries.
+    size_t getMeshCount() const;
+
+    //! The number of instances that have been defined successfully.
+    //!
+    //! @returns The number of instances.
+    size_t getInstanceCount() const;
+
+private:
+
+    class MeshLibraryImpl;
+    MeshLibraryImpl* m_impl;
+};
+
 //! Create a specific Content Layer and add it as a sublayer to the stage's edit target
 //!
 //! Any Prim data can be authored in the Content Layer, there are no specific restrictions or requirements.
@@ -442,10 +593,49 @@ USDEX_API pxr::UsdStageRefPtr addAssetContent(
 //! It (re)configures the stage with the source stage's metadata, payloads the defaultPrim from the source stage, and annotates the Asset
 //! Interface with USD model metadata including component kind, asset name, and extents hint.
 //!
+//! The source stage's default prim is only payloaded, so `AssetCopyPolicy::eInterface` can be used to avoid duplicating any inline content of
+//! the payload layer into the Asset Interface.
+//!
 //! @param stage The stage's edit target will become the Asset Interface
 //! @param source The stage that the Asset Interface will target as a Payload
+//! @param copyPolicy How the source stage's default prim is copied to the Asset Interface. See `copyDefaultPrimSpec()` for details.
 //! @returns True if the Asset Interface was added successfully, false otherwise
-USDEX_API bool addAssetInterface(pxr::UsdStagePtr stage, const pxr::UsdStagePtr source);
+USDEX_API bool addAssetInterface(pxr::UsdStagePtr stage, const pxr::UsdStagePtr source, AssetCopyPolicy copyPolicy = AssetCopyPolicy::eFull);
+
+//! Create an anonymous Content Layer, opened as a new stage, that can be authored independently of the rest of the asset
+//!
+//! The stage is configured with the metadata of the asset stage and a copy of its default prim, matching the Content Layers created by
+//! `addAssetContent()`, but it is not added to any sublayer stack. As the stage does not share any layers with the asset, several Content
+//! Layers (e.g. Geometry, Materials, and Physics) can be authored concurrently, one per thread, using the `define` functions. Once all of them
+//! are complete they can be assembled into the asset in a single step via `assembleAsset()`.
+//!
+//! @note As the layer is anonymous, relative references (e.g. to a Library Layer) cannot be authored until the content has been assembled.
+//!
+//! @param stage The asset stage, which provides the metadata and default prim of the Content Layer
+//! @param name The name of the Content Layer (e.g., "Geometry", "Materials", "Physics")
+//! @param createScope Whether to create a scope in the content stage (default: true)
+//! @returns The newly created anonymous Content Layer opened as a new stage. Returns an invalid stage on error.
+USDEX_API pxr::UsdStageRefPtr createAssetContentStage(pxr::UsdStagePtr stage, const std::string& name, bool createScope = true);
+
+//! Assemble an atomic asset from Content Layers that were authored independently via `createAssetContentStage()`
+//!
+//! This creates the asset payload via `createAssetPayload()`, saves each Content Layer alongside it as "<name>.<format>", sublayers them in
+//! the order given (strongest first), and adds the Asset Interface to the stage via `addAssetInterface()`. The Content Layers are written
+//! concurrently.
+//!
+//! The Payload and Content Layers are saved to disk. The asset stage itself is not saved.
+//!
+//! @param stage The asset stage, whose edit target will become the Asset Interface
+//! @param contents The name and stage of each Content Layer
+//! @param format The file format extension of the Payload and Content Layers (default: "usda")
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied during layer creation.
+//! @returns True if the asset was assembled successfully, false otherwise
+USDEX_API bool assembleAsset(
+    pxr::UsdStagePtr stage,
+    const std::vector<std::pair<std::string, pxr::UsdStagePtr>>& contents,
+    const std::string& format = "usda",
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+);
 
 //! Configure a prim and its descendants to establish a proper asset component hierarchy
 //!
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/core/BoundsAlgo.h
+//! @brief Utility functions to compute the world space transforms and bounds of authored assets.
+
+#include "Api.h"
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <vector>
+
+namespace usdex::core
+{
+
+//! @defgroup bounds World Bounds
+//!
+//! Utility functions to compute the world space transforms and bounds of the boundable prims of an asset.
+//!
+//! These functions are an alternative to a `UsdGeomBBoxCache` for summarizing an asset after it has been authored (e.g. to frame a thumbnail or
+//! to validate the scale of the asset). Rather than computing the extent of each prim from its geometry, the extents already authored by the
+//! `define` functions are reused, and the transforms and bounds of all prims are computed in parallel.
+//!
+//! See [UsdGeomBoundable](https://openusd.org/release/api/class_usd_geom_boundable.html) for details on the extent attribute.
+//!
+//! @{
+
+//! The world space transforms and bounds of the boundable prims below a prim, as computed by `computeWorldBounds`.
+class WorldBounds
+{
+public:
+
+    std::vector<pxr::UsdPrim> prims; //!< The boundable prims, in depth first traversal order
+    std::vector<pxr::TfToken> purposes; //!< The computed purpose of each prim
+    std::vector<pxr::GfMatrix4d> transforms; //!< The local to world transform of each prim
+    std::vector<pxr::GfRange3d> bounds; //!< The world space axis aligned bounds of each prim
+    pxr::GfRange3d range; //!< The union of the bounds of all prims
+};
+
+//! Compute the world space transforms and bounds of the boundable prims at and below a prim.
+//!
+//! The traversal matches that of a `UsdGeomBBoxCache`:
+//! - Instance proxies are included, so that the prototypes of native instances contribute once for each instance.
+//! - Invisible prims, and prims which are not imageable (e.g. materials and shaders), are skipped along with their descendants.
+//! - The descendants of a `UsdGeomPointInstancer` are skipped, as they are accounted for by the extent of the instancer.
+//! - Prims with a computed purpose which is not in `purposes` are skipped.
+//!
+//! The authored extent of each prim is used when available, otherwise the extent is computed via `UsdGeomBoundable::ComputeExtentFromPlugins`.
+//! The prims are discovered on the calling thread, then their local transforms and bounds are computed in parallel.
+//!
+//! @param prim The prim at which to begin the traversal
+//! @param time The time at which to compute the transforms and bounds
+//! @param purposes The purposes of the prims to include
+//!
+//! @returns The transforms and bounds of the boundable prims. If `prim` is invalid, a runtime error is posted and the result is empty.
+USDEX_API WorldBounds computeWorldBounds(
+    const pxr::UsdPrim& prim,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default(),
+    const pxr::TfTokenVector& purposes = { pxr::UsdGeomTokens->default_ }
+);
+
+//! Author the `extentsHint` of a prim from the bounds of its boundable descendants.
+//!
+//! The value matches that of `UsdGeomModelAPI::ComputeExtentsHint`, i.e. the bounds of each purpose of the descendants, in the local space of the
+//! prim and in the order of `UsdGeomImageable::GetOrderedPurposeTokens`. The bounds are computed in parallel via the same traversal as
+//! `computeWorldBounds`.
+//!
+//! Authoring the `extentsHint` on the default prim of an asset allows renderers to frame the asset without traversing its contents.
+//!
+//! @param prim The prim on which to author the `extentsHint` (typically the default prim of an asset)
+//! @param time The time at which to compute and author the `extentsHint`
+//!
+//! @returns Whether the `extentsHint` was authored successfully.
+USDEX_API bool setExtentsHint(pxr::UsdPrim prim, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
+
+//! @}
+
+} // namespace usdex::core
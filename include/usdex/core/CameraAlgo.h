@@ -16,6 +16,7 @@
 #include <pxr/usd/usdGeom/camera.h>
 
 #include <string>
+#include <vector>
 
 
 namespace usdex::core
@@ -65,6 +66,31 @@ USDEX_API pxr::UsdGeomCamera defineCamera(pxr::UsdPrim parent, const std::string
 //! @returns UsdGeomCamera schema wrapping the converted UsdPrim.
 USDEX_API pxr::UsdGeomCamera defineCamera(pxr::UsdPrim prim, const pxr::GfCamera& cameraData);
 
+//! Defines many 3d cameras on the stage at once, optionally animated over many times.
+//!
+//! This is equivalent to calling `defineCamera` for each path and then `UsdGeomCamera::SetFromCamera` at each time, but is considerably faster
+//! for large numbers of cameras or long animations. Every attribute authored by `SetFromCamera` is written as a dense time sample at every time,
+//! directly to the current edit target layer within a single `SdfChangeBlock`. The inverse parent to world transform of each camera is computed
+//! once per parent, and only once in total when the ancestors of the parent are not animated.
+//!
+//! The camera data is ordered by path and then by time, such that the camera for `paths[i]` at `times[j]` is `cameraData[i * times.size() + j]`.
+//!
+//! All of the locations are validated up front, before any scene description is authored. If any location is invalid, the same path is
+//! requested more than once, or the sizes of the arguments are mismatched, a runtime error is posted and no cameras are defined.
+//!
+//! @param stage The stage on which to define the cameras
+//! @param paths The absolute prim path at which to define each camera
+//! @param cameraData The camera data to set for each camera at each time, including the world space transform matrix
+//! @param times The times at which to author the camera data. The default time authors the default values, matching `defineCamera`.
+//!
+//! @returns UsdGeomCamera schemas wrapping the defined UsdPrims, in the same order as `paths`, or an empty vector on error.
+USDEX_API std::vector<pxr::UsdGeomCamera> defineCameras(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPathVector& paths,
+    const std::vector<pxr::GfCamera>& cameraData,
+    const std::vector<pxr::UsdTimeCode>& times = { pxr::UsdTimeCode::Default() }
+);
+
 //! @}
 
 } // namespace usdex::core
@@ -16,6 +16,7 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/basisCurves.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
@@ -251,6 +252,67 @@ USDEX_API pxr::UsdGeomBasisCurves defineCubicBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
 );
 
+//! Writes time sampled frames of curve data to an existing `UsdGeomBasisCurves` prim.
+//!
+//! This is intended for streaming simulated cables, hair, and grooms, where the topology of the curves is fixed and only the points & widths
+//! change per frame. The type, basis, wrap, and curve vertex counts of the prim are read and validated once, when the writer is bound, and the
+//! expected number of points and varying values are cached, so that each frame only validates the sizes of its arrays.
+//!
+//! The attributes are authored via the `UsdGeomBasisCurves` schema on the first frame, then all subsequent frames are written directly to the
+//! same edit target layer, each within a single `SdfChangeBlock`. The arrays are shared with the layer rather than copied. The extent is computed
+//! from the points & widths of each frame and authored at the same time code.
+//!
+//! Widths must be provided for every frame or for none, and their interpolation, element size, and indexing must not change between frames.
+//!
+//! Frames must be written at strictly increasing numeric time codes. Failure to write a frame will result in a `false` return value and a
+//! runtime error, but will not affect previously written frames.
+//!
+//! @note All time samples are held in memory by the edit target layer until it is saved. To bound memory for very long streams, bind a
+//! separate writer to each of several layers (e.g. one per range of frames, to be combined via value clips), and save & release each layer
+//! when it is complete.
+//!
+//! @warning A separate instance of this class should be used per-prim and per-thread, calling methods from multiple threads is not safe.
+class USDEX_API BasisCurvesWriter
+{
+
+public:
+
+    //! Bind a writer to an existing `UsdGeomBasisCurves` prim.
+    //!
+    //! The prim is typically defined via `defineLinearBasisCurves` or `defineCubicBasisCurves`, which author the topology and the default
+    //! (non-animated) values. Use `isValid()` to check whether the writer was bound successfully.
+    //!
+    //! @param curves The curves prim to write frames for.
+    explicit BasisCurvesWriter(pxr::UsdGeomBasisCurves curves);
+    ~BasisCurvesWriter();
+
+    BasisCurvesWriter(const BasisCurvesWriter&) = delete;
+    BasisCurvesWriter& operator=(const BasisCurvesWriter&) = delete;
+
+    //! Whether the writer is bound to a valid `UsdGeomBasisCurves` prim, with a valid topology, on a stage with a valid edit target.
+    //!
+    //! @returns Whether frames can be written.
+    bool isValid() const;
+
+    //! Write a frame of curve data at the given time.
+    //!
+    //! @param time The time code of the frame. It must be numeric and greater than the time of the previous frame.
+    //! @param points Vertex/CV positions for the curves described in local space. There must be one point for each curve vertex.
+    //! @param widths Values for the width specification for the curves.
+    //! @returns Whether the frame was written.
+    bool writeFrame(pxr::UsdTimeCode time, const pxr::VtVec3fArray& points, std::optional<const FloatPrimvarData> widths = std::nullopt);
+
+    //! The number of frames that have been written successfully.
+    //!
+    //! @returns The number of frames.
+    size_t getFrameCount() const;
+
+private:
+
+    class BasisCurvesWriterImpl;
+    BasisCurvesWriterImpl* m_impl;
+};
+
 //! @}
 
 } // namespace usdex::core
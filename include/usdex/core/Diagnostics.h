@@ -11,6 +11,11 @@
 
 #include <pxr/base/tf/diagnosticLite.h>
 #include <pxr/base/tf/diagnosticMgr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <map>
+#include <string>
+#include <vector>
 
 namespace usdex::core
 {
@@ -116,6 +121,176 @@ USDEX_API void setDiagnosticsOutputStream(DiagnosticsOutputStream value);
 //! @returns The current `DiagnosticsOutputStream` for the `Delegate`.
 USDEX_API DiagnosticsOutputStream getDiagnosticsOutputStream();
 
+//! Enable or disable buffered output for the `Delegate`.
+//!
+//! By default each diagnostic is written to the `DiagnosticsOutputStream` synchronously by the thread which emitted it. When authoring from many
+//! threads this serializes the threads on the output stream. In buffered mode the diagnostics are formatted by the emitting thread, then pushed
+//! into a lock-free queue which is written by a background thread. The relative order of diagnostics from any one thread is preserved.
+//!
+//! Buffered diagnostics are flushed by `flushDiagnostics()`, `deactivateDiagnosticsDelegate()`, when disabling buffered mode, and before any
+//! fatal diagnostic is printed. If the queue is full, diagnostics are written directly by the emitting thread.
+//!
+//! @param value Whether diagnostics should be buffered.
+//! @returns `void`
+USDEX_API void setDiagnosticsBuffered(bool value);
+
+//! Get whether buffered output is enabled for the `Delegate`.
+//!
+//! See `setDiagnosticsBuffered()` for more details.
+//!
+//! @returns Whether diagnostics are buffered.
+USDEX_API bool getDiagnosticsBuffered();
+
+//! Block until all buffered diagnostics have been written to their output stream.
+//!
+//! This has no effect unless buffered output is enabled. See `setDiagnosticsBuffered()` for more details.
+//!
+//! @returns `void`
+USDEX_API void flushDiagnostics();
+
+//! Set the maximum number of times that an identical diagnostic will be emitted by the `Delegate`.
+//!
+//! Diagnostics are identical if they have the same `TfDiagnosticType`, source function, and commentary. Once the limit has been reached, the next
+//! occurrence is emitted with a note that further repeats are suppressed, and later occurrences are not emitted at all. Setting the limit resets
+//! the occurrence counts.
+//!
+//! Fatal diagnostics are never suppressed. Only a fixed number of distinct diagnostics are counted, beyond which diagnostics are not suppressed.
+//!
+//! @param value The maximum number of times an identical diagnostic is emitted. Zero disables the limit (the default).
+//! @returns `void`
+USDEX_API void setDiagnosticsRepeatLimit(size_t value);
+
+//! Get the maximum number of times that an identical diagnostic will be emitted by the `Delegate`.
+//!
+//! See `setDiagnosticsRepeatLimit()` for more details.
+//!
+//! @returns The maximum number of times an identical diagnostic is emitted. Zero means the limit is disabled.
+USDEX_API size_t getDiagnosticsRepeatLimit();
+
+//! The number of diagnostics of one type issued by a source function, as reported by `getDiagnosticsCounts()`.
+class DiagnosticsFunctionCount
+{
+public:
+
+    std::string function; //!< The source function of the diagnostics, or an empty string if the call context was hidden
+    pxr::TfDiagnosticType type; //!< The type of the diagnostics
+    size_t count; //!< The number of diagnostics
+};
+
+//! A snapshot of the number of diagnostics received by the `Delegate`, as reported by `getDiagnosticsCounts()`.
+class DiagnosticsCounts
+{
+public:
+
+    std::map<pxr::TfDiagnosticType, size_t> byType; //!< The number of diagnostics of each type. Types which have not occurred are omitted.
+    std::vector<DiagnosticsFunctionCount> byFunction; //!< The number of diagnostics of each type by source function, sorted by function
+};
+
+//! Get the number of diagnostics received by the `Delegate`, by `TfDiagnosticType` and by source function.
+//!
+//! The `Delegate` counts every diagnostic it receives while active, including those which are filtered by the `DiagnosticsLevel`, muted by the
+//! `DiagnosticsOutputStream`, or suppressed by the repeat limit. This allows warning and error rates to be monitored without capturing the log.
+//!
+//! The counters are atomic, so diagnostics may be issued from many threads without contention. A fixed number of distinct source functions are
+//! counted individually, beyond which diagnostics are attributed to an empty function name.
+//!
+//! @returns A snapshot of the current counts.
+USDEX_API DiagnosticsCounts getDiagnosticsCounts();
+
+//! Reset the diagnostics counts of the `Delegate` to zero.
+//!
+//! See `getDiagnosticsCounts()` for more details.
+//!
+//! @returns `void`
+USDEX_API void resetDiagnosticsCounts();
+
+//! Get the diagnostics counts of the `Delegate` in the Prometheus / OpenMetrics text exposition format.
+//!
+//! Two counter families are reported, `usdex_diagnostics` with a `type` label and `usdex_diagnostics_by_function` with `type` and `function`
+//! labels. The `type` label is the snake case name of the `TfDiagnosticType` (e.g. `warning` or `runtime_error`). The text is terminated by
+//! `# EOF`, so it can be served directly from a metrics endpoint or written to a textfile collector.
+//!
+//! See `getDiagnosticsCounts()` for more details.
+//!
+//! @returns The metrics text.
+USDEX_API std::string getDiagnosticsMetrics();
+
+//! The reason that a prim could not be authored, as recorded by an `AuthoringErrorScope`.
+enum class AuthoringErrorCode
+{
+    eInvalidStage = 0, //!< The stage is not valid.
+    eInvalidLocation, //!< The location is not a valid or editable prim location (see `isEditablePrimLocation`).
+    eDuplicatePath, //!< The location was requested more than once within a single batch.
+    eInvalidArgument //!< One of the arguments (e.g. the topology or primvar data) is not valid.
+};
+
+//! A structured record of a prim which could not be authored.
+class AuthoringError
+{
+public:
+
+    std::string function; //!< The name of the function which failed (e.g. `usdex::core::defineXform`)
+    pxr::SdfPath path; //!< The requested location of the prim, or an empty path if the location could not be formed
+    AuthoringErrorCode code; //!< The reason for the failure
+    std::string message; //!< The diagnostic message, or an empty string if messages are not captured
+};
+
+//! Collects structured `AuthoringError` records from the `define` functions, for the lifetime of this object.
+//!
+//! By default a `define` function which fails posts a `TF_RUNTIME_ERROR` and returns an invalid object, so a client authoring many prims must
+//! install a `TfErrorMark` and parse the commentary of each error to discover which prims failed. While a scope is active, failures are instead
+//! appended to the scope as an `AuthoringError` with the function name, prim path, and error code, without posting a diagnostic. Unless
+//! messages are captured, the diagnostic message is not formatted at all.
+//!
+//! Scopes apply to the calling thread only and may be nested, in which case errors are recorded by the innermost scope.
+//!
+//! @note Failures which are not associated with a prim location (e.g. invalid arguments to functions which do not define prims) are still
+//!     posted as diagnostics.
+class USDEX_API AuthoringErrorScope
+{
+
+public:
+
+    //! Begin collecting authoring errors on the calling thread.
+    //!
+    //! @param captureMessages Whether the diagnostic message of each error should be formatted and stored in `AuthoringError::message`
+    //! @param postDiagnostics Whether each error should also be posted as a `TF_RUNTIME_ERROR`, as it would be without the scope
+    explicit AuthoringErrorScope(bool captureMessages = false, bool postDiagnostics = false);
+    ~AuthoringErrorScope();
+
+    AuthoringErrorScope(const AuthoringErrorScope&) = delete;
+    AuthoringErrorScope& operator=(const AuthoringErrorScope&) = delete;
+
+    //! Get the innermost `AuthoringErrorScope` of the calling thread.
+    //!
+    //! @returns The innermost active scope, or `nullptr` if no scope is active on the calling thread.
+    static AuthoringErrorScope* getCurrent();
+
+    //! Whether the diagnostic message of each error is stored in the records.
+    bool getCaptureMessages() const;
+
+    //! Whether each error is also posted as a `TF_RUNTIME_ERROR`.
+    bool getPostDiagnostics() const;
+
+    //! Append an error to this scope.
+    //!
+    //! The `define` functions call this automatically. Clients may also call it to report their own failures alongside them.
+    //!
+    //! @param error The error to record
+    void append(AuthoringError error);
+
+    //! Get the errors recorded by this scope, in the order they occurred.
+    const std::vector<AuthoringError>& getErrors() const;
+
+    //! Discard the errors recorded by this scope.
+    void clear();
+
+private:
+
+    class AuthoringErrorScopeImpl;
+    AuthoringErrorScopeImpl* m_impl;
+};
+
 //! }@
 
 } // namespace usdex::core
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/core/ExtentAlgo.h
+//! @brief Utility functions to compute and author extents for point based prims.
+
+#include "Api.h"
+#include "PrimvarData.h"
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/usdGeom/pointBased.h>
+
+namespace usdex::core
+{
+
+//! @defgroup extents Extents
+//!
+//! Utility functions to compute and author extents for `UsdGeomPointBased` prims.
+//!
+//! These functions compute bounds directly from in-memory point data, rather than reading attributes back from the stage via
+//! `UsdGeomBoundable::ComputeExtentFromPlugins`. They are used by the mesh, curves, and point cloud `define` functions, and can be used to
+//! author valid extents for animated geometry without a second pass through a `UsdGeomBBoxCache`.
+//!
+//! See [UsdGeomBoundable](https://openusd.org/release/api/class_usd_geom_boundable.html) for details on the extent attribute.
+//!
+//! @{
+
+//! Compute the extent of an array of points.
+//!
+//! Large arrays are reduced in parallel. If the array is empty, the result describes an empty range (i.e. the min is greater than the max).
+//!
+//! @param points The points to bound
+//!
+//! @returns An array of two values, the min and max of the bounds.
+USDEX_API pxr::VtVec3fArray computePointsExtent(const pxr::VtVec3fArray& points);
+
+//! Compute the extent of an array of points, padded by half of their widths.
+//!
+//! If the widths provide a value for each point (e.g. vertex interpolation) each point is padded by its own width. Otherwise all points are
+//! padded by the largest width, which is exact for constant widths and conservative for per-segment or per-curve widths.
+//!
+//! @param points The points to bound
+//! @param widths The widths of the points (e.g. of a `UsdGeomPoints` or `UsdGeomCurves` prim)
+//!
+//! @returns An array of two values, the min and max of the bounds.
+USDEX_API pxr::VtVec3fArray computePointsExtent(const pxr::VtVec3fArray& points, const FloatPrimvarData& widths);
+
+//! Author the extent of a `UsdGeomPointBased` prim for its default value and every authored time sample of its points.
+//!
+//! For `UsdGeomPoints` and `UsdGeomCurves` prims the widths primvar (or the native widths attribute) is also considered, and its time samples
+//! are included. The points and widths are read and the extents are computed in parallel, then all extents are authored to the current edit
+//! target in a single change block.
+//!
+//! Any existing extent opinions on the current edit target are replaced.
+//!
+//! @param pointBased The prim on which to author the extent
+//!
+//! @returns Whether the extents were authored successfully.
+USDEX_API bool setExtentTimeSamples(pxr::UsdGeomPointBased pointBased);
+
+//! @}
+
+} // namespace usdex::core
@@ -17,10 +17,13 @@
 #include <pxr/usd/usdGeom/cone.h>
 #include <pxr/usd/usdGeom/cube.h>
 #include <pxr/usd/usdGeom/cylinder.h>
+#include <pxr/usd/usdGeom/gprim.h>
 #include <pxr/usd/usdGeom/plane.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
 #include <pxr/usd/usdGeom/sphere.h>
 
 #include <optional>
+#include <vector>
 
 namespace usdex::core
 {
@@ -433,6 +436,80 @@ USDEX_API pxr::UsdGeomCapsule defineCapsule(
     const std::optional<float> displayOpacity = std::nullopt
 );
 
+//! The arguments required to define a single geometric primitive via `defineGprims` or `defineGprimInstancer`.
+//!
+//! The members match the arguments of the `define` function of each gprim, with the addition of the type of the gprim and the absolute prim path
+//! at which to define it. Members which do not apply to the type of the gprim are ignored.
+class GprimData
+{
+public:
+
+    //! The types of gprim which can be defined
+    // clang-format off
+    enum class Type
+    {
+        Plane,    //!< A `UsdGeomPlane`, see `definePlane`
+        Sphere,   //!< A `UsdGeomSphere`, see `defineSphere`
+        Cube,     //!< A `UsdGeomCube`, see `defineCube`
+        Cone,     //!< A `UsdGeomCone`, see `defineCone`
+        Cylinder, //!< A `UsdGeomCylinder`, see `defineCylinder`
+        Capsule,  //!< A `UsdGeomCapsule`, see `defineCapsule`
+    };
+    // clang-format on
+
+    Type type = Type::Sphere; //!< The type of the gprim
+    pxr::SdfPath path; //!< The absolute prim path at which to define the gprim
+    double radius = 1.0; //!< The radius of a sphere, cone, cylinder, or capsule
+    double height = 2.0; //!< The height of a cone, cylinder, or capsule
+    double size = 2.0; //!< The edge length of a cube
+    double width = 2.0; //!< The width of a plane
+    double length = 2.0; //!< The length of a plane
+    pxr::TfToken axis = pxr::UsdGeomTokens->z; //!< The axis of a plane, cone, cylinder, or capsule
+    std::optional<pxr::GfVec3f> displayColor; //!< Values to be authored for the display color
+    std::optional<float> displayOpacity; //!< Values to be authored for the display opacity
+};
+
+//! Defines many geometric primitives on the stage at once.
+//!
+//! The result is equivalent to calling the `define` function matching the type of each element of `gprims`, but is significantly faster for large
+//! numbers of gprims (e.g. when visualizing physics collision shapes). Use `setLocalTransforms` to position the gprims once they are defined.
+//!
+//! All of the gprims are validated up front, before any scene description is authored. If any location is invalid, or the same path is requested
+//! more than once, a runtime error is posted for each failure and no gprims are defined.
+//!
+//! The extent of each gprim is computed in closed form from its arguments, and the gprims are authored directly to the `SdfLayer` of the current
+//! edit target within a single `SdfChangeBlock`, so that change notification and stage recomposition occur once for the whole batch.
+//!
+//! @param stage The stage on which to define the gprims
+//! @param gprims The type, path, and parameters of each gprim
+//!
+//! @returns UsdGeomGprim schemas wrapping the defined UsdPrims, in the same order as `gprims`, or an empty vector if the gprims could not be defined.
+USDEX_API std::vector<pxr::UsdGeomGprim> defineGprims(pxr::UsdStagePtr stage, const std::vector<GprimData>& gprims);
+
+//! Defines a point instancer which instances geometric primitives, rather than defining each gprim as a separate prim.
+//!
+//! Gprims with identical parameters (ignoring their paths) share a single prototype, so this is preferable to `defineGprims` when many of the
+//! parameters repeat. The prototypes are defined in a `Prototypes` scope below the point instancer, and each element of `gprims` becomes an
+//! instance of its prototype at the matching element of `positions` and `orientations`.
+//!
+//! The extent of the point instancer is computed from the closed form extent of each prototype, and all specs are authored within a single
+//! `SdfChangeBlock`.
+//!
+//! @param stage The stage on which to define the point instancer
+//! @param path The absolute prim path at which to define the point instancer
+//! @param gprims The type and parameters of each instance. The paths are ignored.
+//! @param positions The position of each instance
+//! @param orientations The orientation of each instance. If empty, no orientations are authored.
+//!
+//! @returns UsdGeomPointInstancer schema wrapping the defined UsdPrim, or an invalid schema if the arguments are invalid.
+USDEX_API pxr::UsdGeomPointInstancer defineGprimInstancer(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const std::vector<GprimData>& gprims,
+    const pxr::VtVec3fArray& positions,
+    const std::vector<pxr::GfQuatf>& orientations = {}
+);
+
 //! @}
 
 } // namespace usdex::core
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/core/Instrumentation.h
+//! @brief Opt-in performance counters for OpenUSD Exchange authoring functions.
+
+#include "usdex/core/Api.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace usdex::core
+{
+
+//! @defgroup instrumentation Instrumentation
+//!
+//! Opt-in performance counters for OpenUSD Exchange authoring functions.
+//!
+//! The hot paths of this library (e.g. the `define` functions, `saveStage`, `exportLayer`, name validation, and `PrimvarData::index`) are
+//! instrumented with scoped timers, which record the number of calls, the cumulative and maximum latency, and the bytes of array data authored.
+//!
+//! Instrumentation is disabled by default. While disabled the cost of each instrumented call is a single relaxed atomic load. To enable it,
+//! either call `setInstrumentationEnabled(true)` or set the `USDEX_ENABLE_INSTRUMENTATION` environment variable (see @ref settings).
+//!
+//! The timers can be removed entirely at compile time by building the library with `USDEX_INSTRUMENTATION=0` defined.
+//!
+//! @note Nested calls are recorded by each instrumented function, so the latency of one function may include that of another.
+//!
+//! @{
+
+//! The aggregated measurements of a single instrumented function.
+class InstrumentationCounter
+{
+public:
+
+    std::string name; //!< The name of the instrumented function
+    uint64_t calls = 0; //!< The number of calls recorded
+    double totalSeconds = 0.0; //!< The cumulative wall time of all recorded calls, in seconds
+    double maxSeconds = 0.0; //!< The wall time of the slowest recorded call, in seconds
+    uint64_t bytes = 0; //!< The cumulative bytes of array data authored by all recorded calls
+};
+
+//! Test whether instrumentation is currently enabled.
+//!
+//! @returns Whether instrumented functions are recording measurements.
+USDEX_API bool isInstrumentationEnabled();
+
+//! Enable or disable instrumentation.
+//!
+//! This can be called at any time. Calls that are in progress when enabled will not be recorded.
+//!
+//! @param value Whether instrumented functions should record measurements.
+//! @returns `void`
+USDEX_API void setInstrumentationEnabled(bool value);
+
+//! Get the measurements of all instrumented functions that have recorded at least one call.
+//!
+//! @returns The counters sorted by name.
+USDEX_API std::vector<InstrumentationCounter> getInstrumentationCounters();
+
+//! Reset the measurements of all instrumented functions.
+//!
+//! @returns `void`
+USDEX_API void resetInstrumentationCounters();
+
+//! @}
+
+} // namespace usdex::core
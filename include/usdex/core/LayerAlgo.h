@@ -9,10 +9,16 @@
 
 #include "Api.h"
 
+#include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
 
+#include <functional>
+#include <future>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace usdex::core
 {
@@ -79,6 +85,44 @@ USDEX_API void setLayerAuthoringMetadata(pxr::SdfLayerHandle layer, const std::s
 //! @returns The provenance information for this layer, or an empty string if none exists
 USDEX_API std::string getLayerAuthoringMetadata(const pxr::SdfLayerHandle layer);
 
+//! Options which control how a USD layer is encoded when it is written.
+//!
+//! A `.usd` file may be USDA encoded (human-readable text) or USDC encoded (the binary Crate encoding). USDC is significantly faster to write
+//! and read, and produces smaller files, so it is the default for new `.usd` files. USDA is useful for debugging and for content which is
+//! reviewed or merged as text, but it scales poorly with large arrays.
+//!
+//! The USDC encoding always compresses integer, floating point, and index arrays and deduplicates repeated values (tokens, paths, and
+//! identical arrays) within each file. The Crate version of newly written files is selected process-wide via the
+//! `USD_WRITE_NEW_USDC_FILES_AS_VERSION` environment variable (which must be set before OpenUSD is first used), in order to produce files
+//! that older OpenUSD runtimes can read. None of these can be controlled per layer, so they are not exposed as options here.
+class LayerWriteOptions
+{
+public:
+
+    //! The encoding of `.usd` files, either "usda" or "usdc".
+    //!
+    //! If empty, new layers use the default encoding and existing layers retain their current encoding. Dedicated `.usda` and `.usdc` files
+    //! must not specify a conflicting encoding.
+    pxr::TfToken encoding;
+};
+
+//! Validate write options for a layer identifier and convert them to file format arguments.
+//!
+//! If the options are invalid for the identifier (e.g. an unknown encoding, or an encoding which conflicts with the file extension) and `reason`
+//! is non-null, an error message describing the validation error will be set.
+//!
+//! @param identifier The identifier of the layer to be written.
+//! @param writeOptions The options to convert.
+//! @param fileFormatArgs The file format arguments to which the options are added. Existing arguments are overridden by the options.
+//! @param reason The output message for failed validation.
+//! @returns True if the options are valid for the identifier, or false otherwise.
+USDEX_API bool getLayerWriteFileFormatArgs(
+    const std::string& identifier,
+    const LayerWriteOptions& writeOptions,
+    pxr::SdfLayer::FileFormatArguments* fileFormatArgs,
+    std::string* reason
+);
+
 //! Save the given `SdfLayer` with an optional comment.
 //!
 //! @note This does not impact sublayers or any stages that this layer may be contributing to. This is to
@@ -95,6 +139,23 @@ USDEX_API bool saveLayer(
     std::optional<std::string_view> comment = std::nullopt
 );
 
+//! Save the given `SdfLayer` with an optional comment, using the given write options.
+//!
+//! This is equivalent to `saveLayer`, except that a `.usd` layer can be re-encoded. If the requested encoding differs from the current encoding
+//! of the layer, the layer is exported to its own location with the new encoding and then reloaded.
+//!
+//! @param layer The layer to be saved.
+//! @param writeOptions The options which control how the layer is encoded. A warning is emitted if the options are invalid for the layer.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//! @param comment The comment will be authored in the layer as the `SdfLayer` comment.
+//! @returns A bool indicating if the save was successful.
+USDEX_API bool saveLayer(
+    pxr::SdfLayerHandle layer,
+    const LayerWriteOptions& writeOptions,
+    std::optional<std::string_view> authoringMetadata = std::nullopt,
+    std::optional<std::string_view> comment = std::nullopt
+);
+
 //! Export the given `SdfLayer` to an identifier with an optional comment.
 //!
 //! @note This does not impact sublayers or any stages that this layer may be contributing to. This is to
@@ -115,6 +176,215 @@ USDEX_API bool exportLayer(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
 );
 
+//! Export the given `SdfLayer` to an identifier with an optional comment, using the given write options.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! @param layer The layer to be exported.
+//! @param identifier The identifier to be used for the new layer.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//! @param comment The comment will be authored in the layer as the `SdfLayer` comment.
+//! @param writeOptions The options which control how the layer is encoded. A warning is emitted if the options are invalid for the identifier.
+//! @returns A bool indicating if the export was successful.
+USDEX_API bool exportLayer(
+    pxr::SdfLayerHandle layer,
+    const std::string& identifier,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment,
+    const LayerWriteOptions& writeOptions
+);
+
+//! Save the given `SdfLayer` with an optional comment, serializing it on a background thread.
+//!
+//! This is equivalent to `saveLayer`, except that the contents of the layer are copied on the calling thread and the copy is written to
+//! the identifier of the layer in the background. It is safe to continue editing the layer while the save is in flight, and those edits
+//! will not be reflected in the saved file.
+//!
+//! All async saves are written by a single background thread in the order they were requested, so successive saves of the same layer
+//! produce the most recently requested contents.
+//!
+//! @note Unlike `saveLayer`, the layer remains dirty after the save has completed, as it may have been edited in the meantime.
+//!
+//! @param layer The layer to be saved.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//! @param comment The comment will be authored in the layer as the `SdfLayer` comment.
+//! @returns A future which becomes ready once the save has completed, indicating if the save was successful.
+USDEX_API std::future<bool> saveLayerAsync(
+    pxr::SdfLayerHandle layer,
+    std::optional<std::string_view> authoringMetadata = std::nullopt,
+    std::optional<std::string_view> comment = std::nullopt
+);
+
+//! Export the given `SdfLayer` to an identifier with an optional comment, serializing it on a background thread.
+//!
+//! This is equivalent to `exportLayer`, except that the contents of the layer are copied on the calling thread and the copy is written to
+//! the identifier in the background. It is safe to continue editing the layer while the export is in flight, and those edits will not be
+//! reflected in the exported file. The comment is only authored in the exported file.
+//!
+//! Exports are written by the same background thread as `saveLayerAsync`, in the order they were requested.
+//!
+//! @param layer The layer to be exported.
+//! @param identifier The identifier to be used for the new layer.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//! @param comment The comment will be authored in the layer as the `SdfLayer` comment.
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied during layer export.
+//! @returns A future which becomes ready once the export has completed, indicating if the export was successful.
+USDEX_API std::future<bool> exportLayerAsync(
+    pxr::SdfLayerHandle layer,
+    const std::string& identifier,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment = std::nullopt,
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+);
+
+//! A callback which receives the serialized bytes of a layer, in order, as written by `exportLayerToCallback`.
+//!
+//! The bytes are only valid for the duration of the call, so they must be consumed (e.g. sent over the network) or copied.
+//!
+//! @returns Whether the export should continue. Returning false aborts the export.
+using LayerChunkCallback = std::function<bool(const char* data, size_t size)>;
+
+//! Export the given `SdfLayer` to a chunked output callback with an optional comment, rather than to an identifier.
+//!
+//! This applies the same authoring metadata and comment handling as `exportLayer`, but the serialized layer is passed to the `callback`
+//! in chunks of at most `chunkSize` bytes, so that it can be streamed directly to a network or object storage service.
+//!
+//! As there is no identifier to imply a file format, the `writeOptions` choose between the "usda" and "usdc" encodings. If no encoding is
+//! specified, layers which are already USDC encoded are exported as "usdc" and all other layers are exported as "usda".
+//!
+//! @note USDA layers are serialized entirely in memory. The Crate writer of OpenUSD can only write to an `ArWritableAsset`, so USDC layers are
+//!     serialized to a file in the temporary directory of the system, which is streamed to the callback and then removed.
+//!
+//! @param layer The layer to be exported.
+//! @param callback The callback which receives each chunk of the serialized layer.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//! @param comment The comment will be authored in the exported data as the `SdfLayer` comment.
+//! @param writeOptions The options which control how the layer is encoded. A warning is emitted if the options are invalid.
+//! @param chunkSize The maximum number of bytes passed to each call of the `callback`.
+//! @returns A bool indicating if the export was successful. The export fails if the `callback` returns false.
+USDEX_API bool exportLayerToCallback(
+    pxr::SdfLayerHandle layer,
+    const LayerChunkCallback& callback,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment = std::nullopt,
+    const LayerWriteOptions& writeOptions = LayerWriteOptions(),
+    size_t chunkSize = 1 << 20
+);
+
+//! Export the given `SdfLayer` to an in-memory buffer with an optional comment, rather than to an identifier.
+//!
+//! This is equivalent to `exportLayerToCallback`, except that the serialized layer is collected in a single buffer.
+//!
+//! @param layer The layer to be exported.
+//! @param buffer The buffer which is replaced with the serialized layer. It is cleared if the export fails.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//! @param comment The comment will be authored in the exported data as the `SdfLayer` comment.
+//! @param writeOptions The options which control how the layer is encoded. A warning is emitted if the options are invalid.
+//! @returns A bool indicating if the export was successful.
+USDEX_API bool exportLayerToBuffer(
+    pxr::SdfLayerHandle layer,
+    std::string* buffer,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment = std::nullopt,
+    const LayerWriteOptions& writeOptions = LayerWriteOptions()
+);
+
+//! Records the specs of an `SdfLayer` which have changed, so that only those specs need to be exported.
+//!
+//! Continuously exporting a large layer via `exportLayer` costs a full write for every edit, however small. This class listens to
+//! `SdfNotice::LayersDidChange` and records the paths of the specs which have been edited since construction (or since the last call to
+//! `clear` or `exportDelta`), so that a compact delta layer holding only those specs can be exported instead. The cost of each export is then
+//! proportional to the size of the edits rather than the size of the layer.
+//!
+//! A delta layer is not intended to be composed. Instead, the deltas should periodically be flattened back into the base layer, in the order
+//! they were exported, via `applyLayerDelta`:
+//!
+//!     usdex::core::exportLayer(layer, baseIdentifier, s_authoringMetadata);
+//!     usdex::core::LayerChangeTracker tracker(layer);
+//!     ...
+//!     tracker.exportDelta(deltaIdentifier, s_authoringMetadata);
+//!     ...
+//!     auto baseLayer = SdfLayer::FindOrOpen(baseIdentifier);
+//!     usdex::core::applyLayerDelta(baseLayer, SdfLayer::FindOrOpen(deltaIdentifier));
+//!     usdex::core::saveLayer(baseLayer);
+//!
+//! Edited prims contribute their own fields only, while edited properties, new prims, and prims with reordered children or edited variant sets
+//! contribute their entire spec. Removed specs are recorded in the metadata of the delta layer.
+//!
+//! @warning Edits are recorded on the thread which authors them. Authoring the layer from multiple threads while querying the tracker is not safe.
+class USDEX_API LayerChangeTracker
+{
+
+public:
+
+    //! Start recording the changes to a layer.
+    //!
+    //! @param layer The layer to track.
+    explicit LayerChangeTracker(pxr::SdfLayerHandle layer);
+    ~LayerChangeTracker();
+
+    LayerChangeTracker(const LayerChangeTracker&) = delete;
+    LayerChangeTracker& operator=(const LayerChangeTracker&) = delete;
+
+    //! Whether the tracked layer is valid.
+    bool isValid() const;
+
+    //! The tracked layer.
+    pxr::SdfLayerHandle getLayer() const;
+
+    //! Whether any changes have been recorded.
+    bool hasChanges() const;
+
+    //! The paths of the specs which have changed, in path order.
+    //!
+    //! Changes to relationship targets and attribute connections are recorded on their owning property, and changes to layer metadata are
+    //! recorded on the absolute root path.
+    pxr::SdfPathVector getChangedPaths() const;
+
+    //! Write the recorded changes into a delta layer.
+    //!
+    //! Any existing content of the delta layer is replaced. The recorded changes are not cleared.
+    //!
+    //! @param delta The layer in which to author the delta.
+    //! @returns Whether the delta was written.
+    bool writeDelta(pxr::SdfLayerHandle delta) const;
+
+    //! Export the recorded changes as a delta layer to an identifier, then clear the recorded changes.
+    //!
+    //! The delta layer is exported via `exportLayer`, so the same authoring metadata, comment, and file format arguments apply.
+    //! The recorded changes are only cleared if the export was successful.
+    //!
+    //! @param identifier The identifier to be used for the delta layer.
+    //! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+    //! @param comment The comment will be authored in the delta layer as the `SdfLayer` comment.
+    //! @param fileFormatArgs Additional file format-specific arguments to be supplied during layer export.
+    //! @returns A bool indicating if the export was successful.
+    bool exportDelta(
+        const std::string& identifier,
+        const std::string& authoringMetadata,
+        std::optional<std::string_view> comment = std::nullopt,
+        const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+    );
+
+    //! Discard all recorded changes.
+    void clear();
+
+private:
+
+    class LayerChangeTrackerImpl;
+    LayerChangeTrackerImpl* m_impl;
+};
+
+//! Flatten a delta layer written by `LayerChangeTracker` into a layer.
+//!
+//! The removed specs of the delta are removed from the layer, then each changed spec of the delta replaces the equivalent spec of the layer.
+//! All edits are made within a single `SdfChangeBlock`. Deltas must be applied in the order they were written.
+//!
+//! @param layer The layer to modify, typically the base layer which was exported before the changes were tracked.
+//! @param delta The delta layer to apply.
+//! @returns Whether the delta was applied. A runtime error is emitted if either layer is invalid or the delta was not written by a tracker.
+USDEX_API bool applyLayerDelta(pxr::SdfLayerHandle layer, const pxr::SdfLayerHandle delta);
+
 //! Get the USD file format encoding of the given `SdfLayer`.
 //!
 //! `SdfLayers` can be written in several formats, the most common of which is `.usd`. However, any `.usd` file could be either USDA encoded
@@ -130,6 +400,55 @@ USDEX_API bool exportLayer(
 //! @returns The USD file format encoding of the layer, or an empty token if the layer is not a valid USD layer.
 USDEX_API pxr::TfToken getUsdLayerEncoding(const pxr::SdfLayerHandle layer);
 
+//! The estimated size of attribute data, as reported by `computeLayerMemoryReport`.
+//!
+//! The role of each attribute is determined by its name, and the bytes of its values are counted in exactly one of the role categories, so the
+//! role categories sum to the `serializedBytes`. The `inMemoryBytes` differ from the `serializedBytes` when several values share the storage of a
+//! single `VtArray` (e.g. when the same array is authored to several attributes or time samples), as the storage is only held in memory once.
+class AttributeDataSize
+{
+public:
+
+    size_t pointsBytes = 0; //!< The bytes of `points` and `positions` values
+    size_t indicesBytes = 0; //!< The bytes of topology (e.g. `faceVertexIndices`), GeomSubset, instancer, and primvar `indices` values
+    size_t primvarsBytes = 0; //!< The bytes of primvar values, including `normals` and `widths`
+    size_t otherBytes = 0; //!< The bytes of all other attribute values
+    size_t timeSampleBytes = 0; //!< The bytes of the values above which are authored as time samples rather than default values
+    size_t serializedBytes = 0; //!< The estimated bytes written when serializing the values, before any compression by the file format
+    size_t inMemoryBytes = 0; //!< The estimated bytes held in memory by the values, counting shared array storage once
+    size_t detachedBytes = 0; //!< The bytes of `inMemoryBytes` held by arrays whose storage is used by a single value
+    size_t sharedBytes = 0; //!< The bytes of `inMemoryBytes` held by arrays whose storage is shared by several values
+};
+
+//! The estimated size of the attribute data authored in a single layer, as computed by `computeLayerMemoryReport`.
+class LayerMemoryReport
+{
+public:
+
+    std::string identifier; //!< The identifier of the layer
+    AttributeDataSize total; //!< The size of all attribute data in the layer
+    std::vector<pxr::SdfPath> prims; //!< The prims of the layer, in path order. Prims authored within variants are reported without the selection.
+    std::vector<AttributeDataSize> subtrees; //!< The size of the attribute data authored at and below each prim
+};
+
+//! Compute the estimated in-memory and serialized size of the attribute data authored in a layer, for each prim subtree.
+//!
+//! This is intended to identify which parts of an asset are responsible for its memory use (e.g. to choose the primvars which would benefit from
+//! indexing or quantization) and to enforce size budgets on converted assets.
+//!
+//! The default values and time samples of all attribute specs are measured, including those authored within variants. The size of an array is
+//! the size of its elements (plus the characters of any strings), and the size of any other value is the size of its type. Arrays which share
+//! storage are identified by their data, which is counted in memory by the first prim (in path order) to reference it.
+//!
+//! The specs are discovered on the calling thread, then their values are measured in parallel via the OpenUSD `Work` library.
+//!
+//! @note Measuring the values of a layer which was read from a file may load values which had not yet been accessed (e.g. by a USDC reader which
+//!     loads values on demand), so the memory held by the layer may grow while it is being measured.
+//!
+//! @param layer The layer to measure
+//! @returns The report. If the layer is invalid, a runtime error is posted and the report is empty.
+USDEX_API LayerMemoryReport computeLayerMemoryReport(const pxr::SdfLayerHandle layer);
+
 //! @}
 
 } // namespace usdex::core
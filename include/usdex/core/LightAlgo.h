@@ -20,6 +20,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace usdex::core
 {
@@ -194,6 +195,30 @@ USDEX_API pxr::UsdLuxRectLight defineRectLight(
     std::optional<std::string_view> texturePath = std::nullopt
 );
 
+//! Creates many untextured rectangular (rect) lights at once.
+//!
+//! The result is equivalent to calling `defineRectLight` for each path, but is significantly faster for large numbers of lights (e.g. the
+//! fixtures of a factory or warehouse). Use `setLocalTransforms` to position the lights once they are defined.
+//!
+//! All of the locations are validated up front, before any scene description is authored. If any location is invalid, or the same path is
+//! requested more than once, a runtime error is posted for each failure and no lights are defined. The lights are then authored directly to the
+//! `SdfLayer` of the current edit target within a single `SdfChangeBlock`.
+//!
+//! @param stage: The stage in which the rectangular lights should be authored
+//! @param paths: The path which each rectangular light prim should be written to
+//! @param widths: The width of each rectangular light, in the local X axis.
+//! @param heights: The height of each rectangular light, in the local Y axis.
+//! @param intensities: The intensity value of each rectangular light. If empty, each light has an intensity of 1.
+//!
+//! @returns The lights in the same order as `paths`, or an empty vector if the lights could not be defined.
+USDEX_API std::vector<pxr::UsdLuxRectLight> defineRectLights(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPathVector& paths,
+    const std::vector<float>& widths,
+    const std::vector<float>& heights,
+    const std::vector<float>& intensities = {}
+);
+
 //! @}
 
 } // namespace usdex::core
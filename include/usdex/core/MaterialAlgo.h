@@ -5,12 +5,19 @@
 #pragma once
 
 #include "usdex/core/Api.h"
+#include "usdex/core/PrimvarData.h"
 
 #include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/dictionary.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/sdf/assetPath.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdShade/material.h>
+#include <pxr/usd/usdShade/nodeGraph.h>
 #include <pxr/usd/usdShade/shader.h>
 
+#include <functional>
+#include <optional>
 #include <vector>
 
 //! @file usdex/core/MaterialAlgo.h
@@ -96,6 +103,27 @@ USDEX_API pxr::UsdShadeMaterial createMaterial(pxr::UsdPrim parent, const std::s
 //! @returns Whether the material was successfully bound to the target prim.
 USDEX_API bool bindMaterial(pxr::UsdPrim prim, const pxr::UsdShadeMaterial& material);
 
+//! Authors direct bindings to the given materials on many prims at once.
+//!
+//! Each unique material is validated once, and the `UsdShadeMaterialBindingAPI` and binding relationships are authored directly to the current
+//! edit target layer within a single `SdfChangeBlock`. Nothing is authored if any of the prims or materials are invalid.
+//!
+//! Optionally, bindings may be collapsed onto common ancestors: if every child of a parent prim would be bound to the same material, the parent
+//! is bound instead of its children, and is then considered for collapsing onto its own parent. Bindings are not collapsed onto a `UsdGeomGprim`,
+//! nor onto the parent of a prim that already has a direct binding of its own.
+//!
+//! @note The materials are bound with the default "all purpose" and "fallback strength", matching `bindMaterial()`.
+//!
+//! @param prims The prims that the materials will affect. They must all belong to the same stage.
+//! @param materials The materials to bind to the prims, in the same order. A single material may be supplied to bind it to every prim.
+//! @param collapseToAncestors Whether to bind common ancestors rather than each prim, when every child of the ancestor shares a material
+//! @returns Whether the materials were successfully bound to the prims.
+USDEX_API bool bindMaterials(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::UsdShadeMaterial>& materials,
+    bool collapseToAncestors = false
+);
+
 
 //! Binds materials to the geometry subsets of the given geometry prim.
 //!
@@ -367,6 +395,214 @@ USDEX_API bool addPreviewMaterialInterface(pxr::UsdShadeMaterial& material);
 //! @returns Whether or not the Material inputs were removed successfully
 USDEX_API bool removeMaterialInterface(pxr::UsdShadeMaterial& material, bool bakeValues = true);
 
+//! Adds a Material Interface to every preview material in a material library.
+//!
+//! This is equivalent to calling `addPreviewMaterialInterface()` for each `UsdShadeMaterial` at or below the root prim, but the shader networks
+//! of all materials are resolved before anything is authored, and the interface inputs, connections, and values are then authored directly to
+//! the current edit target layer within a single `SdfChangeBlock`.
+//!
+//! Materials which are not suitable for `addPreviewMaterialInterface()` (e.g. multi-context shader networks) emit the same diagnostics and are
+//! skipped, while the remaining materials are still processed.
+//!
+//! @param root The prim at or below which all materials will be processed (e.g. the `getMaterialsToken()` scope of an asset)
+//! @returns Whether the Material Interfaces of all materials were added successfully
+USDEX_API bool addPreviewMaterialInterfaces(pxr::UsdPrim root);
+
+//! Removes the Material Interface of every material in a material library.
+//!
+//! This is equivalent to calling `removeMaterialInterface()` for each `UsdShadeMaterial` at or below the root prim, but the consumers of all
+//! interface inputs are found in a single traversal before anything is authored, and the disconnections, baked values, and removals are then
+//! authored directly to the current edit target layer within a single `SdfChangeBlock`.
+//!
+//! @note As with `removeMaterialInterface()`, this *affects all render contexts*.
+//!
+//! @param root The prim at or below which all materials will be processed (e.g. the `getMaterialsToken()` scope of an asset)
+//! @param bakeValues Whether or not the current Material inputs values are set on the underlying Shader inputs
+//! @returns Whether the Material inputs of all materials were removed successfully
+USDEX_API bool removeMaterialInterfaces(pxr::UsdPrim root, bool bakeValues = true);
+
+//! The parameters of a preview material, as authored by `definePreviewMaterial()` and the `add*TextureToPreviewMaterial()` functions.
+//!
+//! This is used to define preview materials via a `MaterialRegistry`, which must know all of the parameters of a material (including its
+//! textures) before it is authored, in order to find an identical material which has already been defined.
+//!
+//! Textures with an empty asset path, and an unset emissive color, are not authored.
+class PreviewMaterialParams
+{
+public:
+
+    //! The diffuse color of the Material
+    pxr::GfVec3f color = pxr::GfVec3f(0.18f);
+
+    //! The Opacity Amount to set, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible
+    float opacity = 1.0f;
+
+    //! The Roughness Amount to set, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy
+    float roughness = 0.5f;
+
+    //! The Metallic Amount to set, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic
+    float metallic = 0.0f;
+
+    //! The emissive color. See `addEmissiveColorToPreviewMaterial()` for details.
+    std::optional<pxr::GfVec3f> emissiveColor;
+
+    //! The diffuse texture. See `addDiffuseTextureToPreviewMaterial()` for details.
+    pxr::SdfAssetPath diffuseTexture;
+
+    //! The normals texture. See `addNormalTextureToPreviewMaterial()` for details.
+    pxr::SdfAssetPath normalTexture;
+
+    //! The ORM (occlusion, roughness, metallic) texture. See `addOrmTextureToPreviewMaterial()` for details.
+    pxr::SdfAssetPath ormTexture;
+
+    //! The single channel roughness texture. See `addRoughnessTextureToPreviewMaterial()` for details.
+    pxr::SdfAssetPath roughnessTexture;
+
+    //! The single channel metallic texture. See `addMetallicTextureToPreviewMaterial()` for details.
+    pxr::SdfAssetPath metallicTexture;
+
+    //! The single channel opacity texture. See `addOpacityTextureToPreviewMaterial()` for details.
+    pxr::SdfAssetPath opacityTexture;
+
+    //! The emissive color texture. See `addEmissiveTextureToPreviewMaterial()` for details.
+    pxr::SdfAssetPath emissiveTexture;
+};
+
+//! Deduplicates identical materials as they are defined below a common parent prim.
+//!
+//! Converters often produce one material per source surface, and many of those materials share identical parameters. Defining each of them
+//! in full produces a separate shader network per surface. Instead, each material defined via a `MaterialRegistry` is described by a key,
+//! which holds all of its parameters (including the texture asset paths), and a new material is authored only if no material with an equal key
+//! has been defined by the registry previously. Otherwise the existing material is returned, and can be bound in place of a new one.
+//!
+//! The materials are defined as children of the parent prim supplied on construction. This is typically the `getMaterialsToken()` scope of an
+//! asset (e.g. the scope of the Content Layer returned by `addAssetContent(stage, getMaterialsToken())`). Each material is named after the first
+//! request with its key, made valid and unique amongst the existing children via `getValidChildName()`.
+//!
+//! @note The registry only considers materials that it has defined itself. Materials which are edited after they are defined are still
+//! considered equal to their original parameters.
+//!
+//! @warning A separate instance of this class should be used per-thread, calling methods from multiple threads is not safe.
+class USDEX_API MaterialRegistry
+{
+
+public:
+
+    //! A callable which defines a new material with the given name below the parent prim, returning an invalid material on error.
+    using DefineFn = std::function<pxr::UsdShadeMaterial(pxr::UsdPrim parent, const std::string& name)>;
+
+    //! Bind a material registry to the parent prim of its materials.
+    //!
+    //! Use `isValid()` to check whether the registry was bound successfully.
+    //!
+    //! @param parent The prim below which the materials will be defined (e.g. the `getMaterialsToken()` scope of an asset)
+    explicit MaterialRegistry(pxr::UsdPrim parent);
+    ~MaterialRegistry();
+
+    MaterialRegistry(const MaterialRegistry&) = delete;
+    MaterialRegistry& operator=(const MaterialRegistry&) = delete;
+
+    //! Whether the parent prim is valid.
+    //!
+    //! @returns Whether materials can be defined.
+    bool isValid() const;
+
+    //! Define a preview material, or return an identical preview material which was defined previously by this registry.
+    //!
+    //! On a miss, the material is authored via `definePreviewMaterial()`, followed by the `add*TextureToPreviewMaterial()` functions for each of
+    //! the non-empty textures in the `params`. If any of these fail, the partially authored material is removed and nothing is registered.
+    //!
+    //! @param name The name of the Material, if a new material must be defined
+    //! @param params The parameters of the Material
+    //! @returns The new or existing `UsdShadeMaterial`. Returns an invalid material on error.
+    pxr::UsdShadeMaterial definePreviewMaterial(const std::string& name, const PreviewMaterialParams& params);
+
+    //! Define a material via a callable, or return the material which was defined previously by this registry with an equal key.
+    //!
+    //! This is the extension point used to deduplicate other kinds of materials (e.g. `usdex::rtx::definePbrMaterial()`). The key must hold every
+    //! parameter which affects the authored material, as well as a value identifying the kind of material, so that materials of different kinds
+    //! with coincidentally equal parameters are not confused. All values in the key must be hashable.
+    //!
+    //! @param name The name of the Material, if a new material must be defined
+    //! @param key The parameters which identify the Material
+    //! @param define The callable which defines a new material. It is only invoked if no material with an equal key exists.
+    //! @returns The new or existing `UsdShadeMaterial`. Returns an invalid material on error.
+    pxr::UsdShadeMaterial defineMaterial(const std::string& name, const pxr::VtDictionary& key, const DefineFn& define);
+
+    //! The number of unique materials that have been defined by the registry.
+    //!
+    //! @returns The number of unique materials.
+    size_t getMaterialCount() const;
+
+    //! The number of requests that returned an existing material rather than defining a new one.
+    //!
+    //! @returns The number of deduplicated requests.
+    size_t getReuseCount() const;
+
+private:
+
+    class MaterialRegistryImpl;
+    MaterialRegistryImpl* m_impl;
+};
+
+//! Shares the texture reader shaders of preview materials on a stage, for the lifetime of this object.
+//!
+//! By default each of the `add*TextureToPreviewMaterial()` functions defines a `UsdUVTexture` shader and a `UsdPrimvarReader_float2` shader
+//! within the material itself. Exporters which apply the same textures to many materials therefore author (and renderers sample) many identical
+//! shaders.
+//!
+//! While a `SharedTextureScope` is active for a stage, these functions instead connect the material to a texture reader within a `UsdShadeNodeGraph`
+//! below the parent prim of the scope. A single reader is defined for each unique combination of texture slot, texture asset path, color space
+//! and fallback value, and all of the readers share a single primvar reader for the default UV set.
+//!
+//! Scopes apply to the calling thread only and may be nested, in which case the innermost scope for the stage is used. Readers are only shared
+//! amongst the materials authored while the same scope is active.
+//!
+//! Asset resolution on the calling thread is also cached while the scope is active (via `ArResolverScopedCache`), so each texture is resolved
+//! once regardless of the number of materials which use it. Textures should not be created, moved, or removed while the scope is active.
+//!
+//! @note Connections to the shared readers cross the boundary of the material, which is not strictly encapsulated by the UsdShade specification.
+//!     Renderers accept these connections, but the textures of such materials are not promoted by `addPreviewMaterialInterface()`, as doing so
+//!     would affect every material sharing the reader. Do not use a scope if the materials are intended to be referenced individually.
+class USDEX_API SharedTextureScope
+{
+
+public:
+
+    //! Enable shared texture readers below the given parent prim on the calling thread.
+    //!
+    //! The `UsdShadeNodeGraph` containing the shared readers is defined immediately. Use `isValid()` to check whether it was defined successfully.
+    //!
+    //! @param parent The prim below which the shared readers will be defined (e.g. the `getMaterialsToken()` scope of an asset)
+    explicit SharedTextureScope(pxr::UsdPrim parent);
+    ~SharedTextureScope();
+
+    SharedTextureScope(const SharedTextureScope&) = delete;
+    SharedTextureScope& operator=(const SharedTextureScope&) = delete;
+
+    //! Whether the node graph containing the shared readers is valid.
+    //!
+    //! @returns Whether textures will be shared.
+    bool isValid() const;
+
+    //! Get the node graph containing the shared readers.
+    //!
+    //! @returns The `UsdShadeNodeGraph`. Returns an invalid node graph if the scope is not valid.
+    pxr::UsdShadeNodeGraph getNodeGraph() const;
+
+    //! Whether a valid `SharedTextureScope` is active for the given stage on the calling thread.
+    //!
+    //! @param stage The stage to consider
+    //!
+    //! @returns Whether texture readers will be shared.
+    static bool isActive(pxr::UsdStagePtr stage);
+
+private:
+
+    class SharedTextureScopeImpl;
+    SharedTextureScopeImpl* m_impl;
+};
+
 //! Texture color space (encoding) types
 // clang-format off
 enum class ColorSpace
@@ -415,6 +651,41 @@ USDEX_API pxr::GfVec3f sRgbToLinear(const pxr::GfVec3f& color);
 //! @returns The color in sRGB color space
 USDEX_API pxr::GfVec3f linearToSrgb(const pxr::GfVec3f& color);
 
+//! Translate an array of sRGB color values to linear color space
+//!
+//! This is equivalent to calling `sRgbToLinear(const GfVec3f&)` for each color, and the results are identical, but large arrays are converted
+//! across multiple threads via the OpenUSD `Work` library. Components which are exactly 8-bit sRGB values (i.e. `k / 255` for an integer `k`),
+//! as is common for colors originating from images or scans, are looked up rather than computed.
+//!
+//! @param colors sRGB representations of colors to be translated to linear color space
+//! @returns The translated colors in linear color space
+USDEX_API pxr::VtVec3fArray sRgbToLinear(const pxr::VtVec3fArray& colors);
+
+//! Translate an array of linear color values to sRGB color space
+//!
+//! This is equivalent to calling `linearToSrgb(const GfVec3f&)` for each color, and the results are identical, but large arrays are converted
+//! across multiple threads via the OpenUSD `Work` library.
+//!
+//! @param colors linear representations of colors to be translated to sRGB color space
+//! @returns The colors in sRGB color space
+USDEX_API pxr::VtVec3fArray linearToSrgb(const pxr::VtVec3fArray& colors);
+
+//! Translate the values of color primvar data (e.g. display color) from sRGB to linear color space
+//!
+//! The values are translated as `sRgbToLinear(const VtVec3fArray&)` does. The interpolation, indices, and element size are preserved.
+//!
+//! @param colors sRGB primvar data to be translated to linear color space
+//! @returns The primvar data with values in linear color space
+USDEX_API Vec3fPrimvarData sRgbToLinear(const Vec3fPrimvarData& colors);
+
+//! Translate the values of color primvar data (e.g. display color) from linear to sRGB color space
+//!
+//! The values are translated as `linearToSrgb(const VtVec3fArray&)` does. The interpolation, indices, and element size are preserved.
+//!
+//! @param colors linear primvar data to be translated to sRGB color space
+//! @returns The primvar data with values in sRGB color space
+USDEX_API Vec3fPrimvarData linearToSrgb(const Vec3fPrimvarData& colors);
+
 //! @}
 
 } // namespace usdex::core
@@ -8,6 +8,7 @@
 //! @brief Utility functions to create polygonal `UsdGeomMesh` Prims.
 
 #include "Api.h"
+#include "NameAlgo.h"
 #include "PrimvarData.h"
 
 #include <pxr/base/gf/vec2f.h>
@@ -16,12 +17,16 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/subset.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdShade/material.h>
 #include <pxr/usd/usdShade/tokens.h>
 
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace usdex::core
 {
@@ -143,17 +148,266 @@ USDEX_API pxr::UsdGeomMesh definePolyMesh(
     std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
 );
 
+//! Options to merge nearly equal normals and uvs as they are authored by `definePolyMesh`.
+//!
+//! Normals and uvs which are computed or converted from tessellated geometry (e.g. CAD surfaces) often differ by a few ULPs between the corners
+//! that share a vertex, so exact indexing via `PrimvarData::index()` is unable to merge them. Quantized indexing snaps the values before they
+//! are compared, which results in much smaller indexed primvars and faster loading.
+//!
+//! If both the `tolerance` and the `precision` are zero, the values are indexed exactly.
+class PolyMeshIndexing
+{
+public:
+
+    //! The cell size used to snap each component of the normals and uvs before they are merged. See `PrimvarData::index(float)` for details.
+    float tolerance = 0.0f;
+
+    //! The number of significant bits retained from each component of the normals and uvs before they are merged. It is only used if the
+    //! `tolerance` is zero. See `PrimvarData::indexWithPrecision(int)` for details.
+    int precision = 0;
+};
+
+//! Defines a basic polygon mesh on the stage, merging nearly equal normals and uvs.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! The `normals` and `uvs` are indexed according to the `indexing` options before they are validated and authored. Primvars with an
+//! element size greater than one, or which are otherwise invalid, are authored as supplied. The remaining primvars are not indexed.
+//!
+//! @param stage The stage on which to define the mesh
+//! @param path The absolute prim path at which to define the mesh
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+//! @param points Vertex positions for the mesh described in local space
+//! @param indexing The options used to index the normals and uvs
+//! @param normals Values to be authored for the normals primvar
+//! @param uvs Values to be authored for the uv primvar
+//! @param displayColor Values to be authored for the display color primvar
+//! @param displayOpacity Values to be authored for the display opacity primvar
+//!
+//! @returns UsdGeomMesh schema wrapping the defined UsdPrim
+USDEX_API pxr::UsdGeomMesh definePolyMesh(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const pxr::VtIntArray& faceVertexCounts,
+    const pxr::VtIntArray& faceVertexIndices,
+    const pxr::VtVec3fArray& points,
+    const PolyMeshIndexing& indexing,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+);
+
+//! The topology and primvar data required to define a single mesh via `definePolyMeshes`.
+//!
+//! The members match the arguments of `definePolyMesh`, with the addition of the absolute prim path at which to define the mesh.
+class PolyMeshData
+{
+public:
+
+    pxr::SdfPath path; //!< The absolute prim path at which to define the mesh
+    pxr::VtIntArray faceVertexCounts; //!< The number of vertices in each face of the mesh
+    pxr::VtIntArray faceVertexIndices; //!< Indices of the positions from the `points` to use for each face vertex
+    pxr::VtVec3fArray points; //!< Vertex positions for the mesh described in local space
+    std::optional<Vec3fPrimvarData> normals; //!< Values to be authored for the normals primvar
+    std::optional<Vec2fPrimvarData> uvs; //!< Values to be authored for the uv primvar
+    std::optional<Vec3fPrimvarData> displayColor; //!< Values to be authored for the display color primvar
+    std::optional<FloatPrimvarData> displayOpacity; //!< Values to be authored for the display opacity primvar
+};
+
+//! Defines many basic polygon meshes on the stage at once.
+//!
+//! The result is equivalent to calling `definePolyMesh` for each element of `meshes`, but is significantly faster for large numbers of meshes.
+//!
+//! All of the meshes are validated up front (in parallel, via the OpenUSD `Work` library) before any scene description is authored.
+//! If any mesh fails validation, or the same path is requested more than once, a runtime error is posted for each failure and no meshes are defined.
+//!
+//! Valid meshes are authored directly to the `SdfLayer` of the current edit target within a single `SdfChangeBlock`, so that change notification
+//! and stage recomposition occur once for the whole batch, rather than once per attribute of every mesh.
+//!
+//! @param stage The stage on which to define the meshes
+//! @param meshes The path, topology, and optional primvars of each mesh
+//!
+//! @returns UsdGeomMesh schemas wrapping the defined UsdPrims, in the same order as `meshes`, or an empty vector if the meshes could not be defined.
+USDEX_API std::vector<pxr::UsdGeomMesh> definePolyMeshes(pxr::UsdStagePtr stage, const std::vector<PolyMeshData>& meshes);
+
+//! The concatenated topology and primvar data of many meshes, required to define them all under a common parent via `definePolyMeshBatch`.
+//!
+//! The data of every mesh is concatenated into shared arrays, and the range of each mesh within those arrays is described by offset arrays
+//! (i.e. a compressed sparse row layout). The offset arrays hold one more value than the number of meshes. The data of mesh `i` begins at
+//! offset `i` and ends before offset `i + 1`, so the first offset is 0 and the last offset is the size of the concatenated array.
+//!
+//! The `faceVertexIndices` of each mesh are local to that mesh, i.e. they index the points of that mesh rather than those of the entire batch.
+//!
+//! The optional primvars hold the values of every mesh, with the range of each mesh determined by the interpolation of the primvar:
+//! - `constant` primvars hold a single element per mesh.
+//! - `uniform` primvars are sliced by `faceOffsets`.
+//! - `vertex` and `varying` primvars are sliced by `pointOffsets`.
+//! - `faceVarying` primvars are sliced by the face vertex offsets, which are computed from the `faceVertexCounts`.
+//!
+//! If a primvar is indexed then the indices are sliced rather than the values, and the indices index the values of the entire batch. The values
+//! referenced by each mesh are compacted when the mesh is defined.
+class MeshBatch
+{
+public:
+
+    std::vector<std::string> names; //!< The preferred name of each mesh, which is made valid and unique below the parent prim
+    pxr::VtIntArray pointOffsets; //!< The offset of the first point of each mesh, followed by the total number of points
+    pxr::VtIntArray faceOffsets; //!< The offset of the first face of each mesh, followed by the total number of faces
+    pxr::VtIntArray faceVertexCounts; //!< The number of vertices in each face of every mesh
+    pxr::VtIntArray faceVertexIndices; //!< Indices of the positions from the points of each mesh to use for each face vertex
+    pxr::VtVec3fArray points; //!< Vertex positions for every mesh described in local space
+    std::optional<Vec3fPrimvarData> normals; //!< Values to be authored for the normals primvar of every mesh
+    std::optional<Vec2fPrimvarData> uvs; //!< Values to be authored for the uv primvar of every mesh
+    std::optional<Vec3fPrimvarData> displayColor; //!< Values to be authored for the display color primvar of every mesh
+};
+
+//! Defines every mesh of a `MeshBatch` as a child of a parent prim.
+//!
+//! The name of each mesh is made valid and unique via a `NameCache`, then the batch is sliced into the data of each mesh (in parallel, via the
+//! OpenUSD `Work` library) and the meshes are defined via `definePolyMeshes`. As such the validation, error handling, and authoring of the meshes
+//! matches that of `definePolyMeshes`, and all of the meshes are authored within a single `SdfChangeBlock`.
+//!
+//! This is intended for clients which author many small meshes (e.g. from Python), so that the arguments of each mesh do not need to be
+//! converted individually.
+//!
+//! If the offset arrays do not match the number of names, or do not describe ranges within the concatenated arrays, a runtime error is posted
+//! and no meshes are defined.
+//!
+//! @param parent The prim below which to define the meshes
+//! @param batch The names, topology, and optional primvars of the meshes
+//! @param nameCache The cache used to resolve the names of the meshes. If null, a temporary cache is used.
+//!
+//! @returns UsdGeomMesh schemas wrapping the defined UsdPrims, in the same order as `batch.names`, or an empty vector if the meshes could not be
+//! defined.
+USDEX_API std::vector<pxr::UsdGeomMesh> definePolyMeshBatch(pxr::UsdPrim parent, const MeshBatch& batch, NameCache* nameCache = nullptr);
+
+//! A mesh topology that has been validated once, so that it can be reused to define and update meshes without repeating the validation.
+//!
+//! The face vertex counts and indices are validated via `UsdGeomMesh::ValidateTopology` on construction, against the fewest points that the
+//! indices could refer to. Data derived from the topology (the offset of each face, the number of faces & face vertices, and the largest face
+//! vertex index) is computed at the same time and cached.
+//!
+//! Functions accepting a `MeshTopology` only need to check that enough points are provided, and that the primvars match the element counts,
+//! rather than validating the full topology on every call. This is intended for exporters that author the same topology many times, e.g. for
+//! deforming meshes with a new set of points at each time code, or for many copies of the same mesh.
+//!
+//! The arrays are shared with the topology rather than copied.
+class USDEX_API MeshTopology
+{
+
+public:
+
+    //! Validate the topology and compute its derived data.
+    //!
+    //! If the topology is invalid a runtime error will be posted. Use `isValid()` to check whether the topology can be used.
+    //!
+    //! @param faceVertexCounts The number of vertices in each face of the mesh
+    //! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+    MeshTopology(const pxr::VtIntArray& faceVertexCounts, const pxr::VtIntArray& faceVertexIndices);
+    ~MeshTopology();
+
+    MeshTopology(const MeshTopology&) = delete;
+    MeshTopology& operator=(const MeshTopology&) = delete;
+
+    //! Whether the topology was validated successfully.
+    //!
+    //! @returns Whether the topology is valid.
+    bool isValid() const;
+
+    //! The number of vertices in each face of the mesh.
+    const pxr::VtIntArray& getFaceVertexCounts() const;
+
+    //! The indices of the points to use for each face vertex.
+    const pxr::VtIntArray& getFaceVertexIndices() const;
+
+    //! The offset of the first face vertex of each face.
+    const std::vector<size_t>& getFaceOffsets() const;
+
+    //! The number of faces, which is the number of values required for uniform primvars.
+    size_t getFaceCount() const;
+
+    //! The number of face vertices (i.e. corners), which is the number of values required for faceVarying primvars.
+    size_t getFaceVertexCount() const;
+
+    //! The largest face vertex index. The mesh requires at least one more point than this value, or -1 if there are no face vertices.
+    int getMaxIndex() const;
+
+private:
+
+    class MeshTopologyImpl;
+    MeshTopologyImpl* m_impl;
+};
+
+//! Defines a basic polygon mesh on the stage using a previously validated topology.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! The topology is not validated again. Only the number of points and the primvars are validated against it.
+//!
+//! @param stage The stage on which to define the mesh
+//! @param path The absolute prim path at which to define the mesh
+//! @param topology The validated topology of the mesh
+//! @param points Vertex positions for the mesh described in local space
+//! @param normals Values to be authored for the normals primvar
+//! @param uvs Values to be authored for the uv primvar
+//! @param displayColor Values to be authored for the display color primvar
+//! @param displayOpacity Values to be authored for the display opacity primvar
+//!
+//! @returns UsdGeomMesh schema wrapping the defined UsdPrim
+USDEX_API pxr::UsdGeomMesh definePolyMesh(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const MeshTopology& topology,
+    const pxr::VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+);
+
+//! Author the points, extent, and optionally the normals of an existing mesh at a given time code.
+//!
+//! This is intended for deforming meshes, where the topology is constant but the points (and normals) change over time. The points and
+//! normals are validated against the topology, but the topology itself is not validated again. The extent is computed from the points and
+//! authored at the same time code.
+//!
+//! The topology is expected to match the topology that is authored on the mesh (e.g. via `definePolyMesh`), but this is not checked.
+//!
+//! @param mesh The mesh on which to author the points
+//! @param topology The validated topology of the mesh
+//! @param points Vertex positions for the mesh described in local space
+//! @param time The time code at which to author the values
+//! @param normals Values to be authored for the normals primvar
+//!
+//! @returns Whether the points were authored successfully.
+USDEX_API bool setPolyMeshPoints(
+    pxr::UsdGeomMesh mesh,
+    const MeshTopology& topology,
+    const pxr::VtVec3fArray& points,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default(),
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt
+);
+
 //! Computes mesh normals for a given mesh topology.
 //!
 //! This function computes normals for mesh geometry using vector-area approach for face normals
 //! and area-weighted averaging for vertex normals. The computation supports uniform, vertex, and
-//! faceVarying interpolations to match USD's primvar interpolation types. FaceVarying normals are a simplified
-//! approach that assigns the same face normal to all corners of each face.
+//! faceVarying interpolations to match USD's primvar interpolation types.
+//!
+//! FaceVarying normals are crease-aware. The corners sharing a vertex are smoothed together when the angle between their face normals is
+//! within the `smoothingAngle`, and are otherwise split along the crease. The default `smoothingAngle` of zero assigns the face normal to all
+//! corners of each face (i.e. faceted shading). The result is indexed as it is computed, with one value per smoothing group, so it does not need
+//! to be deduplicated with `PrimvarData::index()`. The `smoothingAngle` has no effect on uniform or vertex normals.
 //!
 //! Normal computation assumes right-handed mesh orientation. The winding order of the data should be reversed in advance if that is not the case.
 //!
 //! Degenerate faces (with zero area) and vertices with no contributing faces are assigned the fallback normal.
 //!
+//! The computation is multi-threaded using the OpenUSD `Work` library and respects the `WorkSetConcurrencyLimit` in effect.
+//! The results are identical regardless of the number of threads used.
+//!
 //! @note This function is designed primarily to resolve USD validation issues for meshes
 //! that lack normals data. For production-quality rendering with sharp edges or complex
 //! shading requirements, consider using specialized mesh processing libraries that provide
@@ -164,6 +418,7 @@ USDEX_API pxr::UsdGeomMesh definePolyMesh(
 //! @param points Vertex positions for the mesh described in local space
 //! @param interpolation The desired interpolation type for the computed normals
 //! @param fallback The fallback normal to use for degenerate faces and vertices with no contributing faces
+//! @param smoothingAngle The maximum angle, in degrees, between the faces of a vertex that share a faceVarying normal
 //!
 //! @returns Vec3fPrimvarData containing the computed normals, or an invalid one if computation fails.
 USDEX_API Vec3fPrimvarData computeMeshNormals(
@@ -171,7 +426,8 @@ USDEX_API Vec3fPrimvarData computeMeshNormals(
     const pxr::VtIntArray& faceVertexIndices,
     const pxr::VtVec3fArray& points,
     const pxr::TfToken& interpolation = pxr::UsdGeomTokens->uniform,
-    const pxr::GfVec3f& fallback = pxr::GfVec3f(0.0f, 0.0f, 1.0f)
+    const pxr::GfVec3f& fallback = pxr::GfVec3f(0.0f, 0.0f, 1.0f),
+    float smoothingAngle = 0.0f
 );
 
 //! Computes mesh normals and updates the mesh with the computed normals.
@@ -181,12 +437,33 @@ USDEX_API Vec3fPrimvarData computeMeshNormals(
 //! @param mesh Mesh prim
 //! @param interpolation The desired interpolation type for the computed normals
 //! @param fallback The fallback normal to use for degenerate faces and vertices with no contributing faces
+//! @param smoothingAngle The maximum angle, in degrees, between the faces of a vertex that share a faceVarying normal
 //!
 //! @returns Vec3fPrimvarData containing the computed normals, or an invalid one if computation fails.
 USDEX_API Vec3fPrimvarData computeMeshNormals(
     pxr::UsdGeomMesh mesh,
     const pxr::TfToken& interpolation = pxr::UsdGeomTokens->uniform,
-    const pxr::GfVec3f& fallback = pxr::GfVec3f(0.0f, 0.0f, 1.0f)
+    const pxr::GfVec3f& fallback = pxr::GfVec3f(0.0f, 0.0f, 1.0f),
+    float smoothingAngle = 0.0f
+);
+
+//! Computes mesh normals for a previously validated topology.
+//!
+//! This is an overloaded member function, provided for convenience. The topology is not validated again, and the cached face offsets are reused.
+//!
+//! @param topology The validated topology of the mesh
+//! @param points Vertex positions for the mesh described in local space
+//! @param interpolation The desired interpolation type for the computed normals
+//! @param fallback The fallback normal to use for degenerate faces and vertices with no contributing faces
+//! @param smoothingAngle The maximum angle, in degrees, between the faces of a vertex that share a faceVarying normal
+//!
+//! @returns Vec3fPrimvarData containing the computed normals, or an invalid one if computation fails.
+USDEX_API Vec3fPrimvarData computeMeshNormals(
+    const MeshTopology& topology,
+    const pxr::VtVec3fArray& points,
+    const pxr::TfToken& interpolation = pxr::UsdGeomTokens->uniform,
+    const pxr::GfVec3f& fallback = pxr::GfVec3f(0.0f, 0.0f, 1.0f),
+    float smoothingAngle = 0.0f
 );
 
 //! Fully partitions a geometry prim into multiple disjoint subsets.
@@ -274,4 +551,167 @@ USDEX_API std::vector<pxr::UsdGeomSubset> defineUnrestrictedSubsets(
     const pxr::TfToken& familyName = pxr::UsdShadeTokens->materialBind
 );
 
+//! Fully partitions a mesh into face subsets from an array of per-face ids.
+//!
+//! This is a convenience for source data that assigns an id (e.g. a material index) to each face, rather than providing explicit subsets.
+//! The face indices of all subsets are gathered in a single counting sort pass over the ids.
+//!
+//! A subset is defined for each id that is referenced by at least one face. Ids that are not referenced by any face are skipped, as subsets
+//! must not be empty. The subsets are returned in ascending id order.
+//!
+//! If materials are provided, the material of each id is bound to its subset using `usdex::core::bindMaterialSubsets`.
+//!
+//! familyName defaults to `UsdShadeTokens->materialBind`.
+//! See [UsdGeomSubset](https://openusd.org/release/api/class_usd_geom_subset.html#af278c1bd6603a66ffcb1a033f395a876) for details.
+//!
+//! @param mesh Mesh prim to add the subsets to
+//! @param faceIds The id of each face (size must equal the number of faces). Each id must be a valid index into names.
+//! @param names The name of the subset for each id
+//! @param materials Optional materials to bind for each id (size must be zero or equal names.size())
+//! @param familyName The family name of the subsets
+//! @returns The subsets created
+USDEX_API std::vector<pxr::UsdGeomSubset> definePartitionedSubsetsFromFaceIds(
+    pxr::UsdGeomMesh mesh,
+    const pxr::VtIntArray& faceIds,
+    const std::vector<pxr::TfToken>& names,
+    const std::vector<pxr::UsdShadeMaterial>& materials = {},
+    const pxr::TfToken& familyName = pxr::UsdShadeTokens->materialBind
+);
+
+//! Defines a large polygon mesh as many smaller meshes, each with at most `maxFacesPerChunk` faces, as siblings below a new `UsdGeomXform`.
+//!
+//! Very large meshes are slow to load and to upload to the GPU as a single prim, and may exceed per-mesh buffer limits of renderers. Splitting
+//! them into spatially coherent chunks reduces the cost of each prim without changing the appearance of the mesh.
+//!
+//! The faces are ordered along a Morton curve through their centroids, and each chunk holds a consecutive run of that order, so that nearby
+//! faces are grouped into the same chunk. Within each chunk the faces retain their original relative order.
+//!
+//! The points and primvars of the mesh are remapped to each chunk, such that each chunk only holds the points (and vertex values) referenced by
+//! its own faces. Indexed primvars are compacted to the values referenced by each chunk.
+//!
+//! If subsets are provided, they must fully partition the faces of the mesh, as expected by `definePartitionedSubsets`. The subsets are remapped
+//! to the faces of each chunk and defined on each chunk for which they are not empty. Use `usdex::core::bindMaterialSubsets` to bind materials
+//! to the subsets of each chunk.
+//!
+//! The mesh is validated, and the chunks are computed in parallel via the OpenUSD `Work` library, before any scene description is authored.
+//! The chunks are then defined via `definePolyMeshes`, so each chunk has its own extent, and are named "Chunk_0", "Chunk_1", etc.
+//!
+//! @param parent Prim below which to define the Xform holding the chunks
+//! @param name Name of the Xform holding the chunks
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+//! @param points Vertex positions for the mesh described in local space
+//! @param maxFacesPerChunk The maximum number of faces in each chunk
+//! @param normals Values to be authored for the normals primvar
+//! @param uvs Values to be authored for the uv primvar
+//! @param displayColor Values to be authored for the display color primvar
+//! @param displayOpacity Values to be authored for the display opacity primvar
+//! @param subsetNames The names of the face subsets (size must equal subsetIndices.size())
+//! @param subsetIndices The face indices of each subset, relative to the faces of the entire mesh
+//! @param subsetFamilyName The family name of the subsets
+//!
+//! @returns UsdGeomMesh schemas wrapping the defined chunks, or an empty vector if the mesh could not be defined.
+USDEX_API std::vector<pxr::UsdGeomMesh> definePolyMeshChunks(
+    pxr::UsdPrim parent,
+    const std::string& name,
+    const pxr::VtIntArray& faceVertexCounts,
+    const pxr::VtIntArray& faceVertexIndices,
+    const pxr::VtVec3fArray& points,
+    size_t maxFacesPerChunk,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt,
+    const std::vector<pxr::TfToken>& subsetNames = {},
+    const std::vector<pxr::VtIntArray>& subsetIndices = {},
+    const pxr::TfToken& subsetFamilyName = pxr::UsdShadeTokens->materialBind
+);
+
+//! Defines a polygon mesh on the stage, with its faces and points reordered for vertex cache efficiency and memory locality.
+//!
+//! Scanned, procedurally generated, and converted meshes often list their faces and points in an arbitrary order, which lowers the vertex cache
+//! hit rate of GPU renderers and the memory locality of downstream tools. The appearance of the mesh does not depend on this order.
+//!
+//! The faces are first ordered along a Morton curve through their centroids, as in `definePolyMeshChunks`. Each consecutive run of that order is
+//! then reordered to maximize the reuse of recently referenced points in a vertex cache of `cacheSize` entries, via Forsyth's linear-speed vertex
+//! cache optimization generalized to polygons. Finally the points are ordered by their first reference in the new face order. Points which are
+//! not referenced by any face follow those which are, in their original order.
+//!
+//! The primvars are remapped consistently with the faces and points, according to their interpolation. Indexed primvars retain their indices,
+//! and their values are compacted to those referenced, in the order of first reference. If subsets are provided, they must fully partition the
+//! faces of the mesh, as expected by `definePartitionedSubsets`. The subsets are remapped to the reordered faces and defined on the mesh.
+//!
+//! The mesh is validated, and the runs of faces are reordered in parallel via the OpenUSD `Work` library, before any scene description is
+//! authored. The order does not depend on the number of threads.
+//!
+//! @param stage The stage on which to define the mesh
+//! @param path The absolute prim path at which to define the mesh
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+//! @param points Vertex positions for the mesh described in local space
+//! @param normals Values to be authored for the normals primvar
+//! @param uvs Values to be authored for the uv primvar
+//! @param displayColor Values to be authored for the display color primvar
+//! @param displayOpacity Values to be authored for the display opacity primvar
+//! @param subsetNames The names of the face subsets (size must equal subsetIndices.size())
+//! @param subsetIndices The face indices of each subset, relative to the faces as supplied
+//! @param subsetFamilyName The family name of the subsets
+//! @param cacheSize The number of entries in the simulated vertex cache
+//!
+//! @returns UsdGeomMesh schema wrapping the defined UsdPrim, or an invalid schema if the mesh or its subsets could not be defined.
+USDEX_API pxr::UsdGeomMesh defineOptimizedPolyMesh(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const pxr::VtIntArray& faceVertexCounts,
+    const pxr::VtIntArray& faceVertexIndices,
+    const pxr::VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt,
+    const std::vector<pxr::TfToken>& subsetNames = {},
+    const std::vector<pxr::VtIntArray>& subsetIndices = {},
+    const pxr::TfToken& subsetFamilyName = pxr::UsdShadeTokens->materialBind,
+    size_t cacheSize = 32
+);
+
+//! Defines a polygon mesh on the stage with several levels of detail, authored as the variants of a "lod" variant set.
+//!
+//! Distant or small meshes do not need their full resolution, and switching to a coarser level of detail reduces the cost of loading and
+//! rendering them. The "LOD0" variant holds the mesh as supplied, and each further variant "LOD1", "LOD2", etc. holds a decimated copy of it,
+//! with at most `faceRatios[i]` of the triangles of the source mesh (after triangulating its faces). The "LOD0" variant is selected.
+//!
+//! The levels are decimated from the source mesh via quadric error metric edge collapses, and are always triangulated. Each level is decimated in
+//! parallel via the OpenUSD `Work` library, before any scene description is authored. Vertices on uv seams are never removed, so the uvs of each
+//! level are carried from the source mesh without distortion, and are authored with the lowest interpolation that represents them.
+//!
+//! The normals of each level are recomputed via `computeMeshNormals`, with the interpolation of the source normals (or vertex if they are
+//! varying). Constant normals are copied to each level. The `smoothingAngle` only affects faceVarying normals.
+//!
+//! Level variants are typically authored within the geometry Content Layer of an asset, i.e. a stage returned by
+//! `addAssetContent(stage, getGeometryToken())`, so that the asset interface is able to select the level of detail.
+//!
+//! @param stage The stage on which to define the mesh
+//! @param path The absolute prim path at which to define the mesh
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+//! @param points Vertex positions for the mesh described in local space
+//! @param faceRatios The fraction of the source triangles to retain in each decimated level, each of which must be between zero and one
+//! @param normals Values to be authored for the normals primvar of the source mesh
+//! @param uvs Values to be authored for the uv primvar of the source mesh
+//! @param smoothingAngle The maximum angle, in degrees, between the faces of a vertex that share a faceVarying normal in the decimated levels
+//!
+//! @returns UsdGeomMesh schema wrapping the defined UsdPrim, or an invalid schema if the mesh or any of its levels could not be defined.
+USDEX_API pxr::UsdGeomMesh definePolyMeshLods(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const pxr::VtIntArray& faceVertexCounts,
+    const pxr::VtIntArray& faceVertexIndices,
+    const pxr::VtVec3fArray& points,
+    const std::vector<float>& faceRatios,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec2fPrimvarData> uvs = std::nullopt,
+    float smoothingAngle = 30.0f
+);
+
 } // namespace usdex::core
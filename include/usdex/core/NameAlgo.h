@@ -173,6 +173,7 @@ USDEX_API pxr::TfTokenVector getValidChildNames(const pxr::UsdPrim& prim, const
 //!
 //! @warning This class does not automatically invalidate cached values based on changes to the prims from which values were cached.
 //! Additionally, a separate instance of this class should be used per-thread, calling methods from multiple threads is not safe.
+//! Use `ConcurrentNameCache` when names for the same parent must be generated from multiple threads.
 class USDEX_API NameCache
 {
 
@@ -277,6 +278,60 @@ public:
     //! @returns A vector of Valid and unique name tokens ordered to match the preferred names
     pxr::TfTokenVector getPropertyNames(const pxr::SdfPrimSpecHandle parent, const std::vector<std::string>& names);
 
+    //! Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+    //!
+    //! The name is reserved exactly as given, it is not made valid or unique.
+    //!
+    //! @param parent The parent path
+    //! @param name The name to reserve
+    //! @returns True if the name was reserved, false if it was already reserved or the parent is invalid
+    bool reservePrimName(const pxr::SdfPath& parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+    //!
+    //! The name is reserved exactly as given, it is not made valid or unique.
+    //!
+    //! @param parent The parent prim
+    //! @param name The name to reserve
+    //! @returns True if the name was reserved, false if it was already reserved or the parent is invalid
+    bool reservePrimName(const pxr::UsdPrim& parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+    //!
+    //! The name is reserved exactly as given, it is not made valid or unique.
+    //!
+    //! @param parent The parent prim spec
+    //! @param name The name to reserve
+    //! @returns True if the name was reserved, false if it was already reserved or the parent is invalid
+    bool reservePrimName(const pxr::SdfPrimSpecHandle parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+    //!
+    //! The name is reserved exactly as given, it is not made valid or unique.
+    //!
+    //! @param parent The parent path
+    //! @param name The name to reserve
+    //! @returns True if the name was reserved, false if it was already reserved or the parent is invalid
+    bool reservePropertyName(const pxr::SdfPath& parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+    //!
+    //! The name is reserved exactly as given, it is not made valid or unique.
+    //!
+    //! @param parent The parent prim
+    //! @param name The name to reserve
+    //! @returns True if the name was reserved, false if it was already reserved or the parent is invalid
+    bool reservePropertyName(const pxr::UsdPrim& parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+    //!
+    //! The name is reserved exactly as given, it is not made valid or unique.
+    //!
+    //! @param parent The parent prim spec
+    //! @param name The name to reserve
+    //! @returns True if the name was reserved, false if it was already reserved or the parent is invalid
+    bool reservePropertyName(const pxr::SdfPrimSpecHandle parent, const pxr::TfToken& name);
+
     //! Update the reserved child names for a prim to include existing children.
     //!
     //! @param parent The parent prim.
@@ -373,6 +428,129 @@ private:
     NameCacheImpl* m_impl;
 };
 
+//! A thread-safe variant of `NameCache` for authoring pipelines which generate names from multiple threads.
+//!
+//! The interface and behavior match `NameCache`, but all methods may be called concurrently. Cache entries are distributed across a fixed number
+//! of independently locked shards based on the parent path, so requests for different parents rarely contend, while requests for the same parent
+//! are serialized. This guarantees that two threads populating the same parent can never be given the same name.
+//!
+//! Use `reservePrimName` or `reservePropertyName` to atomically claim a specific name, e.g. when the name has been generated by other means.
+//!
+//! @warning This class does not automatically invalidate cached values based on changes to the prims from which values were cached.
+//! Reading from a `UsdStage` or `SdfLayer` while another thread is editing it is not safe, regardless of this class.
+class USDEX_API ConcurrentNameCache
+{
+
+public:
+
+    ConcurrentNameCache();
+    ~ConcurrentNameCache();
+
+    //! Make a name valid and unique for use as the name of a child of the given prim.
+    pxr::TfToken getPrimName(const pxr::SdfPath& parent, const std::string& name);
+
+    //! Make a name valid and unique for use as the name of a child of the given prim.
+    pxr::TfToken getPrimName(const pxr::UsdPrim& parent, const std::string& name);
+
+    //! Make a name valid and unique for use as the name of a child of the given prim.
+    pxr::TfToken getPrimName(const pxr::SdfPrimSpecHandle parent, const std::string& name);
+
+    //! Make a list of names valid and unique for use as the names of a children of the given prim.
+    pxr::TfTokenVector getPrimNames(const pxr::SdfPath& parent, const std::vector<std::string>& names);
+
+    //! Make a list of names valid and unique for use as the names of a children of the given prim.
+    pxr::TfTokenVector getPrimNames(const pxr::UsdPrim& parent, const std::vector<std::string>& names);
+
+    //! Make a list of names valid and unique for use as the names of a children of the given prim.
+    pxr::TfTokenVector getPrimNames(const pxr::SdfPrimSpecHandle parent, const std::vector<std::string>& names);
+
+    //! Make a name valid and unique for use as the name of a property on the given prim.
+    pxr::TfToken getPropertyName(const pxr::SdfPath& parent, const std::string& name);
+
+    //! Make a name valid and unique for use as the name of a property on the given prim.
+    pxr::TfToken getPropertyName(const pxr::UsdPrim& parent, const std::string& name);
+
+    //! Make a name valid and unique for use as the name of a property on the given prim.
+    pxr::TfToken getPropertyName(const pxr::SdfPrimSpecHandle parent, const std::string& name);
+
+    //! Make a list of names valid and unique for use as the names of properties on the given prim.
+    pxr::TfTokenVector getPropertyNames(const pxr::SdfPath& parent, const std::vector<std::string>& names);
+
+    //! Make a list of names valid and unique for use as the names of properties on the given prim.
+    pxr::TfTokenVector getPropertyNames(const pxr::UsdPrim& parent, const std::vector<std::string>& names);
+
+    //! Make a list of names valid and unique for use as the names of properties on the given prim.
+    pxr::TfTokenVector getPropertyNames(const pxr::SdfPrimSpecHandle parent, const std::vector<std::string>& names);
+
+    //! Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+    bool reservePrimName(const pxr::SdfPath& parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+    bool reservePrimName(const pxr::UsdPrim& parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+    bool reservePrimName(const pxr::SdfPrimSpecHandle parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+    bool reservePropertyName(const pxr::SdfPath& parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+    bool reservePropertyName(const pxr::UsdPrim& parent, const pxr::TfToken& name);
+
+    //! Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+    bool reservePropertyName(const pxr::SdfPrimSpecHandle parent, const pxr::TfToken& name);
+
+    //! Update the reserved child names for a prim to include existing children.
+    void updatePrimNames(const pxr::UsdPrim& parent);
+
+    //! Update the reserved child names for a prim to include existing children.
+    void updatePrimNames(const pxr::SdfPrimSpecHandle parent);
+
+    //! Update the reserved property names for a prim to include existing properties.
+    void updatePropertyNames(const pxr::UsdPrim& parent);
+
+    //! Update the reserved property names for a prim to include existing properties.
+    void updatePropertyNames(const pxr::SdfPrimSpecHandle parent);
+
+    //! Update the reserved child and property names for a prim to include existing children and properties.
+    void update(const pxr::UsdPrim& parent);
+
+    //! Update the reserved child and property names for a prim to include existing children and properties.
+    void update(const pxr::SdfPrimSpecHandle parent);
+
+    //! Clear the reserved child names for a prim.
+    void clearPrimNames(const pxr::SdfPath& parent);
+
+    //! Clear the reserved child names for a prim.
+    void clearPrimNames(const pxr::UsdPrim& parent);
+
+    //! Clear the reserved child names for a prim.
+    void clearPrimNames(const pxr::SdfPrimSpecHandle parent);
+
+    //! Clear the reserved property names for a prim.
+    void clearPropertyNames(const pxr::SdfPath& parent);
+
+    //! Clear the reserved property names for a prim.
+    void clearPropertyNames(const pxr::UsdPrim& parent);
+
+    //! Clear the reserved property names for a prim.
+    void clearPropertyNames(const pxr::SdfPrimSpecHandle parent);
+
+    //! Clear the reserved prim and property names for a prim.
+    void clear(const pxr::SdfPath& parent);
+
+    //! Clear the reserved prim and property names for a prim.
+    void clear(const pxr::UsdPrim& parent);
+
+    //! Clear the reserved prim and property names for a prim.
+    void clear(const pxr::SdfPrimSpecHandle parent);
+
+private:
+
+    class ConcurrentNameCacheImpl;
+    ConcurrentNameCacheImpl* m_impl;
+};
+
 //! A caching mechanism for valid and unique child prim names.
 //!
 //! For best performance, this object should be reused for multiple name requests.
@@ -476,6 +654,19 @@ USDEX_API bool blockDisplayName(pxr::UsdPrim prim);
 //! @returns The effective display name
 USDEX_API std::string computeEffectiveDisplayName(const pxr::UsdPrim& prim);
 
+//! Calculate the effective display names of many prims, e.g. to list the visible range of a large stage in a user interface.
+//!
+//! The result for each prim matches that of `computeEffectiveDisplayName`, unless `decodeNames` is true, in which case the fallback prim names
+//! which were transcoded by `getValidPrimName` are decoded to the original name (e.g. `tn__Bcker_ah0` is listed as `Bäcker`).
+//!
+//! Decoding reuses scratch buffers rather than allocating per name, and the decoded names are cached for the duration of the call, as many prims
+//! of a large stage typically share a name. Large batches of prims are processed in parallel.
+//!
+//! @param prims The prims to compute the display names for
+//! @param decodeNames Whether to decode transcoded prim names when there is no authored display name
+//! @returns The effective display name of each prim, or an empty string for any invalid prim
+USDEX_API std::vector<std::string> computeEffectiveDisplayNames(const std::vector<pxr::UsdPrim>& prims, bool decodeNames = false);
+
 //! @}
 
 } // namespace usdex::core
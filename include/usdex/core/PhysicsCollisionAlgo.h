@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/core/PhysicsCollisionAlgo.h
+//! @brief Utility functions to define precomputed physics colliders.
+
+#include "Api.h"
+
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
+#include <vector>
+
+namespace usdex::core
+{
+
+//! @defgroup physicscollisions Physics Collision Prims
+//!
+//! [PhysicsCollisionAPI](https://openusd.org/release/api/usd_physics_page_front.html#usdPhysics_collision_shapes) makes any gprim a collision
+//! object. When the collision object is a mesh, the
+//! [PhysicsMeshCollisionAPI](https://openusd.org/release/api/class_usd_physics_mesh_collision_a_p_i.html) specifies how the mesh is approximated
+//! (e.g. by its convex hull), but each simulator must compute (or "cook") that approximation when the asset is loaded. For assets with many
+//! meshes the cooking can dominate the load time of the simulation.
+//!
+//! The UsdPhysics schemas have no representation of cooked data, so this module precomputes the approximations instead, and defines them as
+//! collision prims of their own: implicit shapes (cubes & spheres) which require no cooking at all, or convex hull meshes with few enough
+//! vertices that they can be used by a simulator as they are. The approximations of many meshes are computed in parallel.
+//!
+//! The collision prims are best authored into the Physics Content Layer of an asset (see `addAssetContent()` and `getPhysicsToken()`), so that
+//! the physics opinions remain separate from the render geometry.
+//!
+//! @{
+
+//! The shape used to approximate a mesh for collisions.
+enum class CollisionApproximation
+{
+    eConvexHull = 0, //!< A convex hull of the mesh points, with a limited number of vertices.
+    eBoundingCube, //!< The bounding box of the mesh points in the local space of the mesh, as a `UsdGeomCube`.
+    eBoundingSphere //!< A sphere enclosing the mesh points, centered on their bounding box, as a `UsdGeomSphere`.
+};
+
+//! Define a precomputed collision prim approximating each of many meshes.
+//!
+//! The approximation of each mesh is computed from its points at the default time, in the local space of the mesh. The approximations of all
+//! meshes are computed in parallel before any scene description is authored.
+//!
+//! Each collision prim is defined as a sibling of its mesh, named after the mesh with a "Collision" suffix (made unique among the existing
+//! siblings), with the local transform of the mesh (combined with the placement of the implicit shape), a "guide" purpose so that it is not
+//! rendered, and the `UsdPhysicsCollisionAPI` applied. Convex hulls are defined as triangle meshes with the `UsdPhysicsMeshCollisionAPI` applied
+//! and a "convexHull" approximation. The meshes themselves are not modified, so a simulator uses the precomputed collision prims rather than
+//! cooking the meshes. For rigid bodies, the parent of each mesh should be the body (or a descendant of it), as is typical of converted assets.
+//!
+//! The collision prims are defined on `stage`, which may differ from the stage of the meshes (e.g. the Physics Content Layer of an asset, while
+//! the meshes are read from the composed asset). The stages must share the same namespace. Missing ancestors of the collision prims are
+//! authored as `over` specs, so that the stage only holds physics opinions.
+//!
+//! Every mesh is validated before any scene description is authored, and nothing is authored if any mesh is invalid, has degenerate points
+//! (e.g. a flat mesh cannot be approximated by a convex hull or a bounding cube), or is supplied more than once.
+//!
+//! @param stage The stage on which to define the collision prims
+//! @param meshes The meshes to approximate
+//! @param approximation The shape used to approximate each mesh (default: `CollisionApproximation::eConvexHull`)
+//! @param maxHullVertices The maximum number of vertices of each convex hull, which must be at least 4. The default matches the vertex limit
+//!     imposed by common simulators. When a mesh requires more vertices, its hull is built from the furthest points first, so that the limited
+//!     hull is a close approximation of the full hull.
+//! @returns The collision prims, in the same order as the meshes, or an empty vector on error.
+USDEX_API std::vector<pxr::UsdPrim> definePhysicsColliders(
+    pxr::UsdStagePtr stage,
+    const std::vector<pxr::UsdGeomMesh>& meshes,
+    CollisionApproximation approximation = CollisionApproximation::eConvexHull,
+    size_t maxHullVertices = 64
+);
+
+//! @}
+
+} // namespace usdex::core
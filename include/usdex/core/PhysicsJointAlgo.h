@@ -14,6 +14,7 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdPhysics/fixedJoint.h>
 #include <pxr/usd/usdPhysics/joint.h>
 #include <pxr/usd/usdPhysics/prismaticJoint.h>
@@ -22,6 +23,7 @@
 
 #include <math.h>
 #include <optional>
+#include <vector>
 
 namespace usdex::core
 {
@@ -389,6 +391,21 @@ USDEX_API pxr::UsdPhysicsSphericalJoint definePhysicsSphericalJoint(
 //! @returns `void`
 USDEX_API void alignPhysicsJoint(pxr::UsdPhysicsJoint joint, const JointFrame& frame, const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f));
 
+//! Aligns an existing joint with the specified position, rotation, and axis, computing the body transforms via a caller owned cache.
+//!
+//! This is equivalent to the overload above, but the local to world transforms of the bodies are retrieved from `xformCache`, so that aligning
+//! many joints between the same bodies (or bodies with common ancestors) computes each transform once.
+//!
+//! The transforms are computed at the time of the cache. The cache must be cleared if the transforms of the bodies (or their ancestors) are
+//! modified while it is in use.
+//!
+//! @param joint The joint to align
+//! @param frame The position and rotation of the joint in the specified coordinate system.
+//! @param axis The axis of the joint.
+//! @param xformCache The cache from which to retrieve the local to world transforms of the bodies.
+//! @returns `void`
+USDEX_API void alignPhysicsJoint(pxr::UsdPhysicsJoint joint, const JointFrame& frame, const pxr::GfVec3f& axis, pxr::UsdGeomXformCache& xformCache);
+
 //! Connects an existing joint to the specified body prims and realigns the joint frame accordingly.
 //!
 //! If the joint was previously targetting different bodies, they will be replaced with relationships to the new bodies.
@@ -420,6 +437,80 @@ USDEX_API void connectPhysicsJoint(
     const pxr::GfVec3f& axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f)
 );
 
+//! Connects an existing joint to the specified body prims and realigns the joint frame, computing the body transforms via a caller owned cache.
+//!
+//! This is equivalent to the overload above, but the local to world transforms of the bodies are retrieved from `xformCache`, so that connecting
+//! many joints between the same bodies (or bodies with common ancestors) computes each transform once.
+//!
+//! The transforms are computed at the time of the cache. The cache must be cleared if the transforms of the bodies (or their ancestors) are
+//! modified while it is in use.
+//!
+//! @param joint The joint to align
+//! @param body0 The first body of the joint
+//! @param body1 The second body of the joint
+//! @param frame The position and rotation of the joint in the specified coordinate system.
+//! @param axis The axis of the joint.
+//! @param xformCache The cache from which to retrieve the local to world transforms of the bodies.
+//! @returns `void`
+USDEX_API void connectPhysicsJoint(
+    pxr::UsdPhysicsJoint joint,
+    const pxr::UsdPrim& body0,
+    const pxr::UsdPrim& body1,
+    const JointFrame& frame,
+    const pxr::GfVec3f& axis,
+    pxr::UsdGeomXformCache& xformCache
+);
+
+//! The arguments required to define a single joint via `definePhysicsJoints`.
+//!
+//! The members match the arguments of the `definePhysics*Joint` functions, with the addition of the type of the joint and the absolute prim path
+//! at which to define it. Members which do not apply to the type of the joint are ignored.
+class PhysicsJointData
+{
+public:
+
+    //! The types of joint which can be defined
+    // clang-format off
+    enum class Type
+    {
+        Fixed,     //!< A `UsdPhysicsFixedJoint`, see `definePhysicsFixedJoint`
+        Revolute,  //!< A `UsdPhysicsRevoluteJoint`, see `definePhysicsRevoluteJoint`
+        Prismatic, //!< A `UsdPhysicsPrismaticJoint`, see `definePhysicsPrismaticJoint`
+        Spherical, //!< A `UsdPhysicsSphericalJoint`, see `definePhysicsSphericalJoint`
+    };
+    // clang-format on
+
+    Type type = Type::Fixed; //!< The type of the joint
+    pxr::SdfPath path; //!< The absolute prim path at which to define the joint
+    pxr::UsdPrim body0; //!< The first body of the joint
+    pxr::UsdPrim body1; //!< The second body of the joint
+    JointFrame frame = { JointFrame::Space::World, pxr::GfVec3d(0.0), pxr::GfQuatd::GetIdentity() }; //!< The position and rotation of the joint
+    pxr::GfVec3f axis = pxr::GfVec3f(1.0f, 0.0f, 0.0f); //!< The axis of a revolute, prismatic, or spherical joint
+    std::optional<float> lowerLimit; //!< The lower limit of a revolute (degrees) or prismatic (distance) joint
+    std::optional<float> upperLimit; //!< The upper limit of a revolute (degrees) or prismatic (distance) joint
+    std::optional<float> coneAngle0Limit; //!< The lower limit of the cone angle (degrees) of a spherical joint
+    std::optional<float> coneAngle1Limit; //!< The upper limit of the cone angle (degrees) of a spherical joint
+};
+
+//! Defines many physics joints on the stage at once.
+//!
+//! The result is equivalent to calling the `definePhysics*Joint` function matching the type of each element of `joints`, but is significantly
+//! faster for large numbers of joints (e.g. when importing articulated robots).
+//!
+//! All of the joints are validated up front, before any scene description is authored. If any joint fails validation, or the same path is
+//! requested more than once, a runtime error is posted for each failure and no joints are defined.
+//!
+//! The local to world transforms of the bodies are computed via a single `UsdGeomXformCache`, so that the transforms of bodies (and their
+//! ancestors) which are shared by several joints are computed once. The joints are then authored directly to the `SdfLayer` of the current edit
+//! target within a single `SdfChangeBlock`, so that change notification and stage recomposition occur once for the whole batch.
+//!
+//! @param stage The stage on which to define the joints
+//! @param joints The type, path, bodies, and alignment of each joint
+//!
+//! @returns UsdPhysicsJoint schemas wrapping the defined UsdPrims, in the same order as `joints`, or an empty vector if the joints could not be
+//! defined. Each schema can be converted to the schema matching the type of the joint (e.g. `UsdPhysicsRevoluteJoint`).
+USDEX_API std::vector<pxr::UsdPhysicsJoint> definePhysicsJoints(pxr::UsdStagePtr stage, const std::vector<PhysicsJointData>& joints);
+
 //! @}
 
 } // namespace usdex::core
@@ -8,6 +8,7 @@
 //! @brief Utility functions to create physics materials.
 
 #include "Api.h"
+#include "MaterialAlgo.h"
 
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
@@ -16,6 +17,8 @@
 #include <pxr/usd/usdShade/material.h>
 
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace usdex::core
 {
@@ -103,6 +106,32 @@ USDEX_API pxr::UsdShadeMaterial definePhysicsMaterial(
     const std::optional<float> density = std::nullopt
 );
 
+//! Creates a Physics Material via a `MaterialRegistry`, or returns an identical Physics Material which was defined previously.
+//!
+//! Importers often define one physics material per collider, many of which share identical parameters. The registry deduplicates them by the
+//! dynamic friction, static friction, restitution, and density, so that a single material is defined for each unique combination. Parameters
+//! which are not supplied are not authored, so they are only considered equal to other unsupplied parameters.
+//!
+//! On a miss, the material is authored via `definePhysicsMaterial()` below the parent prim of the registry. Physics materials are never confused
+//! with other kinds of materials defined by the same registry.
+//!
+//! @param registry The registry used to find or define the material
+//! @param name The name of the material, if a new material must be defined
+//! @param dynamicFriction The dynamic friction of the material
+//! @param staticFriction The static friction of the material
+//! @param restitution The restitution of the material
+//! @param density The density of the material
+//!
+//! @returns The new or existing `UsdShadeMaterial`. Returns an invalid material on error.
+USDEX_API pxr::UsdShadeMaterial definePhysicsMaterial(
+    MaterialRegistry& registry,
+    const std::string& name,
+    const float dynamicFriction,
+    const std::optional<float> staticFriction = std::nullopt,
+    const std::optional<float> restitution = std::nullopt,
+    const std::optional<float> density = std::nullopt
+);
+
 //! Adds physical material parameters to an existing Material.
 //!
 //! Used to apply `UsdPhysicsMaterialAPI` and related properties to an existing `UsdShadeMaterial` (e.g. a visual material).
@@ -142,6 +171,30 @@ USDEX_API bool addPhysicsToMaterial(
 //! @returns Whether the material was successfully bound to the target prim.
 USDEX_API bool bindPhysicsMaterial(pxr::UsdPrim prim, const pxr::UsdShadeMaterial& material);
 
+//! Binds physics materials to many rigid bodies or collision geometry prims at once.
+//!
+//! This is equivalent to calling `bindPhysicsMaterial()` for each prim, but each unique material is validated once, and the
+//! `UsdShadeMaterialBindingAPI` and "physics" purpose binding relationships are authored directly to the current edit target layer within a
+//! single `SdfChangeBlock`. All of the prims and materials are validated before anything is authored, so nothing is authored if any of them
+//! are invalid.
+//!
+//! Optionally, bindings may be collapsed onto common ancestors, as described by `bindMaterials()`, so that a large subtree of colliders sharing
+//! one physics material authors a single binding.
+//!
+//! @note The materials are bound with the "physics" purpose and the default "fallback strength", matching `bindPhysicsMaterial()`. If a prim
+//! appears more than once, its last material is bound.
+//!
+//! @param prims The prims that the materials will affect. They must all belong to the same stage.
+//! @param materials The materials to bind to the prims, in the same order. A single material may be supplied to bind it to every prim.
+//! @param collapseToAncestors Whether to bind common ancestors rather than each prim, when every child of the ancestor shares a material
+//!
+//! @returns Whether the materials were successfully bound to the prims.
+USDEX_API bool bindPhysicsMaterials(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::UsdShadeMaterial>& materials,
+    bool collapseToAncestors = false
+);
+
 //! @}
 
 } // namespace usdex::core
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -16,10 +16,13 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/points.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace usdex::core
 {
@@ -122,6 +125,238 @@ USDEX_API pxr::UsdGeomPoints definePointCloud(
     std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
 );
 
+//! Options to quantize the positions and primvars of a point cloud as they are authored by `definePointCloud`.
+//!
+//! Photogrammetry and Gaussian splat data is captured with far less precision than single precision floats provide. Quantizing the data to
+//! the precision of the capture allows the primvars to be indexed with few distinct values, which results in much smaller primvars (as the
+//! indices compress well in `usdc` files) and faster loading.
+//!
+//! The schema types of the points, widths, normals, and display primvars are single precision, so the quantized data is still authored with
+//! these types, rather than as half precision or integer types which renderers would not interpret as the schema attributes.
+class PointCloudQuantization
+{
+public:
+
+    //! The number of bits used to quantize each component of the positions, relative to the bounds of the points.
+    //!
+    //! The positions are snapped to a grid of `2^positionBits` cells across the bounds, and are authored relative to the center of the bounds.
+    //! The center is authored as a double precision `xformOp:translate:dequantize` op of the prim, so that points with large coordinates (e.g.
+    //! georeferenced scans) retain their precision. The op is appended to any existing xform ops of the prim, so it is composed with the existing
+    //! local transform. If this is not positive, the positions are authored as supplied.
+    int positionBits = 16;
+
+    //! The number of significant bits retained from each component of the widths, normals, display color, and display opacity before they are
+    //! merged. The default matches the precision of half floats. See `PrimvarData::indexWithPrecision(int)` for details. If this is not
+    //! positive, the primvars are authored as supplied.
+    int precision = 11;
+};
+
+//! Defines a `UsdGeomPoints` prim on the stage, quantizing its positions and primvars.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! The `points` and primvars are quantized according to the `quantization` options before they are validated and authored. Primvars with an
+//! element size greater than one, or which are otherwise invalid, are authored as supplied. Use `computePointCloudQuantizationReport` to
+//! measure the accuracy of the authored data.
+//!
+//! @param stage The stage on which to define the points.
+//! @param path The absolute prim path at which to define the points.
+//! @param points Vertex positions for the points described in local space.
+//! @param quantization The options used to quantize the points and primvars.
+//! @param ids Values for the id specification for the points.
+//! @param widths Values for the width specification for the points.
+//! @param normals Values for the normals primvar for the points. Only Vertex normals are considered valid.
+//! @param displayColor Values to be authored for the display color primvar.
+//! @param displayOpacity Values to be authored for the display opacity primvar.
+//! @returns `UsdGeomPoints` schema wrapping the defined `UsdPrim`
+USDEX_API pxr::UsdGeomPoints definePointCloud(
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPath& path,
+    const pxr::VtVec3fArray& points,
+    const PointCloudQuantization& quantization,
+    std::optional<const pxr::VtInt64Array> ids = std::nullopt,
+    std::optional<const FloatPrimvarData> widths = std::nullopt,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+);
+
+//! The round trip accuracy of the data authored for a point cloud, as computed by `computePointCloudQuantizationReport`.
+//!
+//! Each error is the largest absolute difference between a component of a source value and the corresponding authored value.
+class PointCloudQuantizationReport
+{
+public:
+
+    double maxPointError = 0.0; //!< The largest error of a position, including the dequantizing translation of the prim
+    double maxWidthError = 0.0; //!< The largest error of a width
+    double maxNormalError = 0.0; //!< The largest error of a normal
+    double maxDisplayColorError = 0.0; //!< The largest error of a display color
+    double maxDisplayOpacityError = 0.0; //!< The largest error of a display opacity
+};
+
+//! Computes the round trip accuracy of a point cloud, by reading back its authored values and comparing them with the source data.
+//!
+//! The dequantizing translation authored by a quantized `definePointCloud` is applied to the authored points, while any other xform ops of the
+//! prim are not, as the source points are described in its local space. The values are compared per point, so the interpolation and indexing
+//! of the authored primvars may differ from the source primvars. Errors are only computed for the supplied values, and are infinite if the
+//! authored values are missing or do not hold the same number of elements as the source values.
+//!
+//! @param pointCloud The points prim to read the authored values from.
+//! @param points The source positions of the points.
+//! @param widths The source widths of the points.
+//! @param normals The source normals of the points.
+//! @param displayColor The source display color of the points.
+//! @param displayOpacity The source display opacity of the points.
+//! @param time The time at which to read the authored values.
+//! @returns The largest error of each of the supplied values.
+USDEX_API PointCloudQuantizationReport computePointCloudQuantizationReport(
+    pxr::UsdGeomPoints pointCloud,
+    const pxr::VtVec3fArray& points,
+    std::optional<const FloatPrimvarData> widths = std::nullopt,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt,
+    pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+);
+
+//! Options controlling how `definePointCloudTiles` partitions a point cloud into tiles.
+class PointCloudTiling
+{
+public:
+
+    //! The edge length of the cubic cells of the tiling grid, in the local units of the points.
+    //!
+    //! If this is not positive, the size is chosen so that each tile would hold `targetPointsPerTile` points if the points were distributed
+    //! evenly throughout their bounds.
+    float tileSize = 0.0f;
+
+    //! The approximate number of points in each tile, when the `tileSize` is chosen automatically.
+    size_t targetPointsPerTile = 1 << 20;
+
+    //! Whether to author each tile to its own layer, targeted by a payload, so that viewers can load only the visible tiles.
+    bool usePayloads = false;
+
+    //! The file format extension of the tile layers, when `usePayloads` is true.
+    std::string payloadFormat = "usdc";
+
+    //! The options used to quantize the points and primvars of each tile, relative to the bounds of that tile, or none to author them as supplied.
+    std::optional<PointCloudQuantization> quantization;
+};
+
+//! Defines a point cloud as a grid of `UsdGeomPoints` tiles, so that very large point clouds (e.g. LiDAR scans) can be streamed.
+//!
+//! The points are partitioned into the cubic cells of a grid aligned with their bounds. The cell of each point is computed in parallel, and the
+//! points of each non-empty cell are gathered (in their original order) into a `UsdGeomPoints` prim with its own tight extent. The optional
+//! values are partitioned along with the points, so they must have a value for every point, or constant interpolation. The grid is limited to
+//! a fixed number of cells, so the `tileSize` may be increased for point clouds with very large bounds.
+//!
+//! The tiles are defined as children of a `UsdGeomXform` prim named `name` below `parent`, and are named `Tile_0`, `Tile_1`, etc.
+//!
+//! If `tiling.quantization` is set, the data of each tile is quantized relative to the bounds of that tile, as by the quantized overload of
+//! `definePointCloud`, so each tile has its own dequantizing translation.
+//!
+//! If `tiling.usePayloads` is true, each tile is defined as the default prim of its own layer, within a `getPayloadToken()` subdirectory of
+//! the edit target layer (which must not be anonymous). The tile layers are authored and saved in parallel. Each tile prim on the stage then
+//! targets its layer via a payload, and the bounds of the tile are authored as its `extentsHint`, so that viewers can choose which tiles to
+//! load without loading any of them.
+//!
+//! @param parent The prim below which to define the tiles.
+//! @param name The name of the `UsdGeomXform` prim which holds the tiles.
+//! @param points Vertex positions for the points described in local space.
+//! @param tiling The options controlling the size of the tiles and whether they are authored as payloads.
+//! @param ids Values for the id specification for the points.
+//! @param widths Values for the width specification for the points.
+//! @param normals Values for the normals primvar for the points. Only Vertex normals are considered valid.
+//! @param displayColor Values to be authored for the display color primvar.
+//! @param displayOpacity Values to be authored for the display opacity primvar.
+//! @returns The tile prims, in the order of their names, or an empty vector if the point cloud could not be defined.
+USDEX_API std::vector<pxr::UsdPrim> definePointCloudTiles(
+    pxr::UsdPrim parent,
+    const std::string& name,
+    const pxr::VtVec3fArray& points,
+    const PointCloudTiling& tiling = PointCloudTiling(),
+    std::optional<const pxr::VtInt64Array> ids = std::nullopt,
+    std::optional<const FloatPrimvarData> widths = std::nullopt,
+    std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+    std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+    std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+);
+
+//! Writes time sampled frames of point cloud data to an existing `UsdGeomPoints` prim.
+//!
+//! This is intended for streaming many frames of data (e.g. LiDAR sweeps or particle simulations) more efficiently than authoring each frame
+//! via `UsdAttribute::Set`. The attributes are authored via the `UsdGeomPoints` schema on the first frame, then all subsequent frames are
+//! written directly to the same edit target layer, each within a single `SdfChangeBlock`. The arrays are shared with the layer rather than copied.
+//!
+//! The invariants of the stream are established by the first frame and validated against each subsequent frame:
+//! - The same set of optional values (ids, widths, normals, display color, and display opacity) must be provided for every frame.
+//! - The interpolation, element size, and indexing of each primvar must not change between frames.
+//!
+//! The number of points may change between frames. The data of each frame is validated in the same way as `definePointCloud`, and the extent
+//! is computed from the points & widths of each frame and authored at the same time code.
+//!
+//! Frames must be written at strictly increasing numeric time codes. Failure to write a frame will result in a `false` return value and a
+//! runtime error, but will not affect previously written frames.
+//!
+//! @note All time samples are held in memory by the edit target layer until it is saved. To bound memory for very long streams, bind a
+//! separate writer to each of several layers (e.g. one per range of frames, to be combined via value clips), and save & release each layer
+//! when it is complete.
+//!
+//! @warning A separate instance of this class should be used per-prim and per-thread, calling methods from multiple threads is not safe.
+class USDEX_API PointCloudWriter
+{
+
+public:
+
+    //! Bind a writer to an existing `UsdGeomPoints` prim.
+    //!
+    //! The prim is typically defined via `definePointCloud`, which authors the default (non-animated) values. Use `isValid()` to check
+    //! whether the writer was bound successfully.
+    //!
+    //! @param pointCloud The points prim to write frames for.
+    explicit PointCloudWriter(pxr::UsdGeomPoints pointCloud);
+    ~PointCloudWriter();
+
+    PointCloudWriter(const PointCloudWriter&) = delete;
+    PointCloudWriter& operator=(const PointCloudWriter&) = delete;
+
+    //! Whether the writer is bound to a valid `UsdGeomPoints` prim on a stage with a valid edit target.
+    //!
+    //! @returns Whether frames can be written.
+    bool isValid() const;
+
+    //! Write a frame of point cloud data at the given time.
+    //!
+    //! @param time The time code of the frame. It must be numeric and greater than the time of the previous frame.
+    //! @param points Positions of the points.
+    //! @param ids Values for the id specification for the points.
+    //! @param widths Values for the width specification for the points.
+    //! @param normals Values for the normals primvar for the points. Only Vertex normals are considered valid.
+    //! @param displayColor Values to be authored for the display color primvar.
+    //! @param displayOpacity Values to be authored for the display opacity primvar.
+    //! @returns Whether the frame was written.
+    bool writeFrame(
+        pxr::UsdTimeCode time,
+        const pxr::VtVec3fArray& points,
+        std::optional<const pxr::VtInt64Array> ids = std::nullopt,
+        std::optional<const FloatPrimvarData> widths = std::nullopt,
+        std::optional<const Vec3fPrimvarData> normals = std::nullopt,
+        std::optional<const Vec3fPrimvarData> displayColor = std::nullopt,
+        std::optional<const FloatPrimvarData> displayOpacity = std::nullopt
+    );
+
+    //! The number of frames that have been written successfully.
+    //!
+    //! @returns The number of frames.
+    size_t getFrameCount() const;
+
+private:
+
+    class PointCloudWriterImpl;
+    PointCloudWriterImpl* m_impl;
+};
+
 //! @}
 
 } // namespace usdex::core
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -8,16 +8,193 @@
 //! @brief A class to manage and validate `UsdGeomPrimvar` data prior to authoring
 
 #include "Api.h"
+#include "ScratchArena.h"
 
 #include <pxr/base/gf/vec2f.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/type.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdGeom/primvar.h>
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <vector>
+
 namespace usdex::core
 {
 
+namespace detail
+{
+
+//! Records that `PrimvarData::isValid()` has succeeded, so that the same data is not validated again, e.g. when it is passed to several define
+//! functions.
+//!
+//! The flag is copied along with the `PrimvarData`, as the copy shares the same read-only arrays, and is cleared on the `PrimvarData` being moved
+//! from, as its arrays are left empty. It is atomic so that `isValid()` remains safe to call concurrently on a single `PrimvarData`.
+class ValidatedFlag
+{
+
+public:
+
+    ValidatedFlag() = default;
+
+    ValidatedFlag(const ValidatedFlag& other) : m_value(other.get())
+    {
+    }
+
+    ValidatedFlag(ValidatedFlag&& other) noexcept : m_value(other.get())
+    {
+        other.set(false);
+    }
+
+    ValidatedFlag& operator=(const ValidatedFlag& other)
+    {
+        set(other.get());
+        return *this;
+    }
+
+    ValidatedFlag& operator=(ValidatedFlag&& other) noexcept
+    {
+        set(other.get());
+        other.set(false);
+        return *this;
+    }
+
+    bool get() const
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    void set(bool value) const
+    {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+
+private:
+
+    mutable std::atomic<bool> m_value{ false };
+};
+
+//! Records the content hash of a `PrimvarData` once it has been computed by `PrimvarData::hash()`.
+//!
+//! Like the `ValidatedFlag`, the hash is copied along with the `PrimvarData` and cleared on the `PrimvarData` being moved from. A zero value
+//! indicates that the hash has not been computed, so a computed hash of zero is stored as one instead.
+class HashCache
+{
+
+public:
+
+    HashCache() = default;
+
+    HashCache(const HashCache& other) : m_value(other.get())
+    {
+    }
+
+    HashCache(HashCache&& other) noexcept : m_value(other.get())
+    {
+        other.clear();
+    }
+
+    HashCache& operator=(const HashCache& other)
+    {
+        m_value.store(other.get(), std::memory_order_relaxed);
+        return *this;
+    }
+
+    HashCache& operator=(HashCache&& other) noexcept
+    {
+        m_value.store(other.get(), std::memory_order_relaxed);
+        other.clear();
+        return *this;
+    }
+
+    //! The cached hash, or zero if it has not been computed.
+    size_t get() const
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    //! Cache a computed hash and return the value stored.
+    size_t set(size_t value) const
+    {
+        value = value ? value : 1;
+        m_value.store(value, std::memory_order_relaxed);
+        return value;
+    }
+
+    void clear() const
+    {
+        m_value.store(0, std::memory_order_relaxed);
+    }
+
+private:
+
+    mutable std::atomic<size_t> m_value{ 0 };
+};
+
+//! The indices of a `PrimvarData` once compacted by `PrimvarData::compactIndices()`, stored as the narrowest unsigned integer type able to address
+//! the values.
+//!
+//! The indices are widened to a `VtIntArray` on demand. `widened()` caches the result for the lifetime of the object, so that a reference can be
+//! returned by `PrimvarData::indices()`, and is safe to call concurrently. The cache is not carried by copies, which share the compact arrays.
+class USDEX_API CompactIndexArray
+{
+
+public:
+
+    CompactIndexArray() = default;
+
+    CompactIndexArray(const CompactIndexArray& other);
+
+    CompactIndexArray(CompactIndexArray&& other) noexcept;
+
+    CompactIndexArray& operator=(const CompactIndexArray& other);
+
+    CompactIndexArray& operator=(CompactIndexArray&& other) noexcept;
+
+    ~CompactIndexArray();
+
+    //! Compact indices which address `valueCount` values, replacing any existing compact indices.
+    //!
+    //! @returns False, leaving this array unchanged, if there are more than 65,536 values or any index is outside the range of the values.
+    bool assign(const pxr::VtArray<int>& indices, size_t valueCount);
+
+    void clear();
+
+    bool empty() const;
+
+    size_t size() const;
+
+    //! The number of bytes used to store each index (one or two), or zero if the array is empty.
+    size_t bytesPerIndex() const;
+
+    //! Widen the indices into a new `VtIntArray`, which is not cached.
+    pxr::VtArray<int> widen() const;
+
+    //! Widen the indices into a `VtIntArray` which is cached for the lifetime of this object.
+    const pxr::VtArray<int>& widened() const;
+
+    //! Whether both arrays share the same compact storage.
+    bool isIdentical(const CompactIndexArray& other) const;
+
+    bool operator==(const CompactIndexArray& other) const;
+
+    bool operator==(const pxr::VtArray<int>& other) const;
+
+private:
+
+    pxr::VtArray<uint8_t> m_uint8;
+    pxr::VtArray<uint16_t> m_uint16;
+    mutable std::atomic<pxr::VtArray<int>*> m_widened{ nullptr };
+};
+
+} // namespace detail
+
 //! @defgroup primvars Primvar Data Management
 //!
 //! Utilities to author and inspect [UsdGeomPrimvars](https://openusd.org/release/api/class_usd_geom_primvar.html)
@@ -70,6 +247,30 @@ public:
     //! @returns The read-only `PrimvarData`.
     PrimvarData(const pxr::TfToken& interpolation, const pxr::VtArray<T>& values, const pxr::VtArray<int>& indices, int elementSize = -1);
 
+    //! Construct non-indexed `PrimvarData`, taking ownership of the values array.
+    //!
+    //! This avoids the reference count increment of sharing the array, and ensures the `PrimvarData` holds the only reference to it, so no other
+    //! handle can cause it to detach (copy) later. It is otherwise equivalent to the constructor accepting a `const VtArray&`.
+    //!
+    //! @param interpolation The primvar interpolation. Must match `UsdGeomPrimvar::IsValidInterpolation()` to be considered valid.
+    //! @param values The values array, which is left empty.
+    //! @param elementSize Optional element size. This should be fairly uncommon.
+    //!
+    //! @returns The read-only `PrimvarData`.
+    PrimvarData(const pxr::TfToken& interpolation, pxr::VtArray<T>&& values, int elementSize = -1);
+
+    //! Construct indexed `PrimvarData`, taking ownership of the values and indices arrays.
+    //!
+    //! This is equivalent to the constructor accepting `const VtArray&` arguments, except that both arrays are moved rather than shared.
+    //!
+    //! @param interpolation The primvar interpolation. Must match `UsdGeomPrimvar::IsValidInterpolation()` to be considered valid.
+    //! @param values The values array, which is left empty.
+    //! @param indices The indices array, which is left empty.
+    //! @param elementSize Optional element size. This should be fairly uncommon.
+    //!
+    //! @returns The read-only `PrimvarData`.
+    PrimvarData(const pxr::TfToken& interpolation, pxr::VtArray<T>&& values, pxr::VtArray<int>&& indices, int elementSize = -1);
+
     //! Construct a `PrimvarData` from a `UsdGeomPrimvar` that has already been authored.
     //!
     //! The primvar may be indexed, non-indexed, with or without elements, or it may not even be validly authored scene description.
@@ -95,6 +296,55 @@ public:
     //!     Any failure to author may leave the primvar in an unknown state (e.g. it may have been partially authored).
     bool setPrimvar(pxr::UsdGeomPrimvar& primvar, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()) const;
 
+    //! Construct `PrimvarData` from many `UsdGeomPrimvars` that have already been authored.
+    //!
+    //! This is equivalent to calling `getPrimvarData(UsdGeomPrimvar&)` for each primvar, but the primvars are read concurrently.
+    //! The stage must not be edited until this function returns.
+    //!
+    //! @param primvars The previously authored `UsdGeomPrimvars`.
+    //! @param time The time at which the attribute values are read.
+    //!
+    //! @returns The read-only `PrimvarData` of each primvar, in the same order as `primvars`.
+    static std::vector<PrimvarData> getPrimvarData(
+        const std::vector<pxr::UsdGeomPrimvar>& primvars,
+        pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+    );
+
+    //! Construct `PrimvarData` from all of the authored `UsdGeomPrimvars` of a prim which hold values of this type.
+    //!
+    //! The primvars of the prim are gathered in a single pass over its authored properties, then read concurrently.
+    //! Primvars holding values of any other type are skipped. The stage must not be edited until this function returns.
+    //!
+    //! @param prim The prim from which to read the primvars.
+    //! @param names Optional primvar names, excluding the "primvars:" namespace, used to filter the primvars which are read.
+    //!     If empty, all authored primvars which hold values of this type are read.
+    //! @param time The time at which the attribute values are read.
+    //!
+    //! @returns The read-only `PrimvarData` of each primvar, keyed by the primvar name excluding the "primvars:" namespace.
+    static std::map<pxr::TfToken, PrimvarData> getPrimvarData(
+        const pxr::UsdPrim& prim,
+        const pxr::TfTokenVector& names = {},
+        pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+    );
+
+    //! Set data on many existing `UsdGeomPrimvars`.
+    //!
+    //! This is equivalent to calling `setPrimvar(UsdGeomPrimvar&)` for each primvar, but the values, indices, interpolation, and element size
+    //! of all primvars are written directly to the current edit target layer within a single `SdfChangeBlock`.
+    //!
+    //! All arguments are validated before any primvar is authored, so a failure leaves every primvar unchanged.
+    //!
+    //! @param primvars The previously authored `UsdGeomPrimvars`.
+    //! @param data The `PrimvarData` to author onto each primvar. It must be the same length as `primvars`.
+    //! @param time The time at which the attribute values are written.
+    //!
+    //! @returns Whether all of the `UsdGeomPrimvars` were authored from the data.
+    static bool setPrimvars(
+        const std::vector<pxr::UsdGeomPrimvar>& primvars,
+        const std::vector<PrimvarData>& data,
+        pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
+    );
+
     //! The geometric interpolation.
     //!
     //! It may be an invalid interpolation. Use `PrimvarData::isValid()` or `UsdGeomPrimvar::IsValidInterpolation()` to confirm.
@@ -120,11 +370,18 @@ public:
     //!
     //! This method throws a runtime error if the `PrimvarData` is not indexed. For exception-free access, check `hasIndices()` before calling this.
     //!
+    //! If the indices are compact (see `compactIndices()`) they are widened on the first call, and the widened array is cached.
+    //!
     //! @note It may contain an empty or invalid indices array. Use `PrimvarData::isValid()` to validate that the indices are not out-of-range.
     //!
     //! @returns The primvar indices.
     const pxr::VtArray<int>& indices() const;
 
+    //! Whether the indices are held in memory as 8 or 16 bit unsigned integers, following a successful call to `compactIndices()`.
+    //!
+    //! @returns True if the indices are compact.
+    bool hasCompactIndices() const;
+
     //! The element size.
     //!
     //! Any value less than 1 is considered "non authored" and indicates no element size. This should be the most common case, as element size is a
@@ -156,6 +413,9 @@ public:
     //!  - If it is indexed, and has elements, that the indices divide evenly by elementSize.
     //!  - If it is indexed, that the indices are all within the expected range of the values array.
     //!
+    //! The data can not be modified other than by `index()`, so a successful result is remembered (and carried by copies of this `PrimvarData`).
+    //! Subsequent calls return immediately, without iterating the indices again.
+    //!
     //! @returns Whether the data is valid or invalid.
     bool isValid() const;
 
@@ -168,6 +428,19 @@ public:
     //! @returns True if all the member data is equal and arrays are identical.
     bool isIdentical(const PrimvarData& other) const;
 
+    //! A hash of the content of this `PrimvarData`, suitable for using it as a key in hashed containers.
+    //!
+    //! The hash covers the interpolation, element size, values and indices. The arrays are hashed via `TfHash`, which dispatches to the
+    //! `TfHashAppend` overloads of `VtArray` and its element type. These hash floating point values such that `0.0` and `-0.0` hash equally, as
+    //! they compare equal, so equal `PrimvarData` objects always produce equal hashes.
+    //!
+    //! The hash is computed lazily on the first call. The data can not be modified other than by `index()`, so the result is remembered (and carried
+    //! by copies of this `PrimvarData`) until the data is re-indexed. Once both sides of a comparison have been hashed, the equality operator
+    //! rejects differing hashes without comparing the arrays.
+    //!
+    //! @returns The content hash.
+    size_t hash() const;
+
     //! Update the values and indices of this `PrimvarData` object to avoid duplicate values.
     //!
     //! Updates will not be made in the following conditions:
@@ -176,11 +449,112 @@ public:
     //!  - If there are no duplicate values.
     //!  - If the existing indices are invalid
     //!
+    //! Values are compared exactly (not only by hash), so distinct values are never merged, and the first occurrence of each value determines its
+    //! position in the resulting values array. Large arrays are deduplicated across multiple threads via the OpenUSD `Work` library, and the
+    //! result is identical regardless of the `WorkSetConcurrencyLimit` in effect.
+    //!
     //! @returns True if the values and/or indices were modified.
     bool index();
 
+    //! Update the values and indices of this `PrimvarData` object to merge values that are within a tolerance of one another.
+    //!
+    //! Each component of each value is snapped to a grid with a cell size of `tolerance`, and values which snap to the same cell are merged. The
+    //! first occurrence within each cell is kept verbatim (i.e. the values are not modified, only deduplicated). Note that values very close to a
+    //! cell boundary may still fall into neighboring cells, so this is a best effort reduction rather than a clustering algorithm.
+    //!
+    //! This is only supported for floating point value types (e.g. `float`, `GfVec2f`, `GfVec3f`). A zero tolerance is equivalent to `index()`.
+    //!
+    //! Updates will not be made in the same conditions as `index()`, nor if the tolerance is negative or the value type is not floating point.
+    //!
+    //! @param tolerance The cell size used to quantize each component prior to deduplication.
+    //!
+    //! @returns True if the values and/or indices were modified.
+    bool index(float tolerance);
+
+    //! Update the values and indices of this `PrimvarData` object to merge values that are equal to a number of significant bits.
+    //!
+    //! Each component of each value is rounded to `bits` significant bits, and values which round to the same components are merged. The first
+    //! occurrence is kept verbatim (i.e. the values are not modified, only deduplicated). Unlike `index(float)`, the precision is relative to the
+    //! magnitude of each component, which suits data of varying scale. For example, 16 bits merges unit normals that differ by less than
+    //! approximately 0.00002, which absorbs the rounding differences between normals computed for adjacent faces.
+    //!
+    //! This is only supported for floating point value types (e.g. `float`, `GfVec2f`, `GfVec3f`). A precision of at least the number of
+    //! significant bits of the value type (e.g. 24 for `float`) is equivalent to `index()`.
+    //!
+    //! Updates will not be made in the same conditions as `index()`, nor if the precision is less than one bit or the value type is not floating
+    //! point.
+    //!
+    //! @param bits The number of significant bits retained from each component prior to deduplication.
+    //!
+    //! @returns True if the values and/or indices were modified.
+    bool indexWithPrecision(int bits);
+
+    //! Store the indices of this `PrimvarData` in memory as 8 or 16 bit unsigned integers, to reduce the memory held prior to authoring.
+    //!
+    //! Indices are compacted to 8 bits when there are at most 256 values, and to 16 bits when there are at most 65,536 values, which is common for
+    //! colors, ids and other low cardinality data after `index()`. The content of the `PrimvarData` is unchanged, only its storage, so
+    //! `hash()` and the equality operator are unaffected. The compact indices are widened to a `VtIntArray` only when required:
+    //!  - `setPrimvar()` and `setPrimvars()` widen a temporary array while authoring.
+    //!  - `indices()` widens the array once and caches it, so that both representations are held in memory from then on.
+    //!
+    //! Updates will not be made if there are no indices, if the indices are already compact, if there are more than 65,536 values, or if the
+    //! existing indices are outside the range of the values. A subsequent `index()` restores `VtIntArray` indices.
+    //!
+    //! @returns True if the indices were compacted.
+    bool compactIndices();
+
+    //! Update the interpolation of this `PrimvarData` object to `constant` if every element holds the same value(s).
+    //!
+    //! Source data often provides a value per element which turns out to be uniform throughout (e.g. a single display color for every vertex).
+    //! Demoting the interpolation reproduces the data exactly, but authors a single element rather than an array of duplicates.
+    //!
+    //! This is applicable to any geometry (e.g. before calling `definePointCloud`), as it does not depend on the topology.
+    //!
+    //! The elements are compared exactly in a single linear scan (so `NaN` values are never considered equal). Updates will not be made if the
+    //! interpolation is already `constant`, if the data is invalid, or if any element differs.
+    //!
+    //! @returns True if the interpolation was demoted.
+    bool demoteToConstant();
+
+    //! Update the interpolation of this `PrimvarData` object to the cheapest interpolation which reproduces the data of a mesh exactly.
+    //!
+    //! The interpolations are considered from cheapest to most expensive, and the first which reproduces every element exactly is used:
+    //!  - `constant` if every element holds the same value(s).
+    //!  - For `faceVarying` data, `uniform` if all of the face vertices of each face hold the same value(s), and `vertex` if all of the face
+    //!     vertices which share a point hold the same value(s). Whichever of these has fewer elements is considered first.
+    //!
+    //! Each candidate is checked in a single linear scan over the elements. Indexed data remains indexed (with the indices of the first element
+    //! of each demoted element), unless it is demoted to `constant`. Points which are not referenced by any face take the value of the first
+    //! element, as their value does not contribute to the appearance of the mesh.
+    //!
+    //! Updates will not be made if the data is invalid, or if the number of elements does not match the topology for its interpolation.
+    //!
+    //! @param faceVertexCounts The number of vertices in each face of the mesh
+    //! @param faceVertexIndices Indices of the positions from the points to use for each face vertex
+    //! @param pointCount The number of points of the mesh
+    //!
+    //! @returns True if the interpolation was demoted.
+    bool demoteMeshInterpolation(const pxr::VtArray<int>& faceVertexCounts, const pxr::VtArray<int>& faceVertexIndices, size_t pointCount);
+
+    //! Update the interpolation of this `PrimvarData` object to the cheapest interpolation which reproduces the data of basis curves exactly.
+    //!
+    //! The interpolations are considered from cheapest to most expensive, and the first which reproduces every element exactly is used:
+    //!  - `constant` if every element holds the same value(s).
+    //!  - For `vertex` data, `uniform` if all of the vertices of each curve hold the same value(s).
+    //!
+    //! The number of `varying` elements of each curve depends on the basis and wrap of the curves, so `varying` data is only demoted to
+    //! `constant`. Otherwise this behaves the same as `demoteMeshInterpolation()`.
+    //!
+    //! @param curveVertexCounts The number of vertices in each curve
+    //!
+    //! @returns True if the interpolation was demoted.
+    bool demoteCurvesInterpolation(const pxr::VtArray<int>& curveVertexCounts);
+
     //! Check for equality between two `PrimvarData` objects.
     //!
+    //! Identical arrays are equal without being compared, and if the content hash of both objects has already been computed via `hash()`, differing
+    //! hashes are unequal without being compared.
+    //!
     //! @param other The other `PrimvarData`.
     //!
     //! @returns True if all the member data is equal (but not necessarily identical arrays).
@@ -195,10 +569,21 @@ public:
 
 private:
 
+    template <typename Key>
+    bool indexBy(const Key& key);
+
+    template <typename ElementAt>
+    bool demoteBy(const pxr::TfToken& interpolation, size_t count, const ElementAt& elementAt);
+
+    bool demoteCheck(size_t expectedSize);
+
     pxr::TfToken m_interpolation;
     int m_elementSize;
     pxr::VtArray<T> m_values;
     pxr::VtArray<int> m_indices;
+    detail::CompactIndexArray m_compactIndices;
+    detail::ValidatedFlag m_validated;
+    detail::HashCache m_hash;
 };
 
 //! An alias for `PrimvarData` that holds `VtFloatArray` values (e.g widths or scale factors).
@@ -220,8 +605,232 @@ using Vec2fPrimvarData = PrimvarData<pxr::GfVec2f>;
 //! An alias for `PrimvarData` that holds `VtVec3fArray` values (e.g normals, colors, or other vectors).
 using Vec3fPrimvarData = PrimvarData<pxr::GfVec3f>;
 
+//! A templated read-only view of `UsdGeomPrimvar` data held in memory owned by the caller, e.g. an interleaved (AoS) buffer of a simulation engine.
+//!
+//! Unlike `PrimvarData`, the values and indices are not held as `VtArray`. They are addressed in place, optionally with a byte stride between
+//! consecutive values, and are only copied into a `VtArray` when authored via `setPrimvar()` or converted via `toPrimvarData()`. Validation and
+//! indexing also operate directly on the viewed memory.
+//!
+//! @warning The view does not own the memory it addresses. The caller must ensure it remains valid, and is not modified, for the lifetime of
+//!     the view.
+template <typename T>
+class PrimvarView
+{
+
+public:
+
+    //! Construct a non-indexed `PrimvarView`.
+    //!
+    //! @param interpolation The primvar interpolation. Must match `UsdGeomPrimvar::IsValidInterpolation()` to be considered valid.
+    //! @param values Pointer to the first value.
+    //! @param count The number of values.
+    //! @param stride The number of bytes between the start of consecutive values. It must be at least `sizeof(T)` and a multiple of `alignof(T)`.
+    //! @param elementSize Optional element size. This should be fairly uncommon.
+    //!     See [GetElementSize](https://openusd.org/release/api/class_usd_geom_primvar.html#a711c3088ebca00ca75308485151c8590) for details.
+    //!
+    //! @returns The read-only `PrimvarView`.
+    PrimvarView(const pxr::TfToken& interpolation, const T* values, size_t count, size_t stride = sizeof(T), int elementSize = -1);
+
+    //! Construct an indexed `PrimvarView`.
+    //!
+    //! @param interpolation The primvar interpolation. Must match `UsdGeomPrimvar::IsValidInterpolation()` to be considered valid.
+    //! @param values Pointer to the first value.
+    //! @param count The number of values.
+    //! @param stride The number of bytes between the start of consecutive values. It must be at least `sizeof(T)` and a multiple of `alignof(T)`.
+    //! @param indices Pointer to the first index. The indices are always contiguous.
+    //! @param indexCount The number of indices.
+    //! @param elementSize Optional element size. This should be fairly uncommon.
+    //!     See [GetElementSize](https://openusd.org/release/api/class_usd_geom_primvar.html#a711c3088ebca00ca75308485151c8590) for details.
+    //!
+    //! @returns The read-only `PrimvarView`.
+    PrimvarView(
+        const pxr::TfToken& interpolation,
+        const T* values,
+        size_t count,
+        size_t stride,
+        const int* indices,
+        size_t indexCount,
+        int elementSize = -1
+    );
+
+    //! The geometric interpolation.
+    //!
+    //! @returns The geometric interpolation.
+    const pxr::TfToken& interpolation() const;
+
+    //! The number of values addressed by the view.
+    //!
+    //! @returns The number of values.
+    size_t size() const;
+
+    //! The number of bytes between the start of consecutive values.
+    //!
+    //! @returns The value stride in bytes.
+    size_t stride() const;
+
+    //! Read-only access to a value.
+    //!
+    //! @param i The position of the value, which must be less than `size()`.
+    //!
+    //! @returns The value at the given position.
+    const T& value(size_t i) const;
+
+    //! Whether this is an indexed or non-indexed `PrimvarView`
+    //!
+    //! @returns Whether this is an indexed or non-indexed `PrimvarView`.
+    bool hasIndices() const;
+
+    //! Read-only access to the indices, or `nullptr` if the view is not indexed.
+    //!
+    //! @returns Pointer to the first index.
+    const int* indices() const;
+
+    //! The number of indices, which is zero if the view is not indexed.
+    //!
+    //! @returns The number of indices.
+    size_t indexCount() const;
+
+    //! The element size. See `PrimvarData::elementSize()` for details.
+    //!
+    //! @returns The primvar element size.
+    int elementSize() const;
+
+    //! The effective size of the data, having accounted for values, indices, and element size. See `PrimvarData::effectiveSize()` for details.
+    //!
+    //! @returns The effective size of the data.
+    size_t effectiveSize() const;
+
+    //! Whether the data is valid or invalid.
+    //!
+    //! This performs the same checks as `PrimvarData::isValid()`, and additionally checks that the values are not null and that the stride is
+    //! suitable for addressing values of the type.
+    //!
+    //! @returns Whether the data is valid or invalid.
+    bool isValid() const;
+
+    //! Copy the viewed values into a new `VtArray`.
+    //!
+    //! Contiguous values of trivially copyable types are copied with a single `memcpy`, otherwise each value is copied in a single pass.
+    //!
+    //! @returns The copied values.
+    pxr::VtArray<T> copyValues() const;
+
+    //! Copy the viewed data into a new `PrimvarData`, e.g. to supply it to one of the `define` functions.
+    //!
+    //! @returns The `PrimvarData` holding copies of the values and indices.
+    PrimvarData<T> toPrimvarData() const;
+
+    //! Copy the viewed data into a new `PrimvarData` with duplicate values removed.
+    //!
+    //! This is equivalent to `toPrimvarData().index()`, except that the values are deduplicated in place, so that only the unique values are
+    //! copied. The same conditions apply, so the result is not indexed (or keeps the existing indexing) if there are no duplicate values.
+    //!
+    //! @returns The indexed `PrimvarData`.
+    PrimvarData<T> index() const;
+
+    //! Set data on an existing `UsdGeomPrimvar`, copying the viewed values and indices into the arrays which are authored.
+    //!
+    //! This is equivalent to `toPrimvarData().setPrimvar(primvar, time)`.
+    //!
+    //! @param primvar The previously authored `UsdGeomPrimvar`.
+    //! @param time The time at which the attribute values are written.
+    //!
+    //! @returns Whether the `UsdGeomPrimvar` was completely authored from the member data.
+    bool setPrimvar(pxr::UsdGeomPrimvar& primvar, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()) const;
+
+private:
+
+    pxr::TfToken m_interpolation;
+    int m_elementSize;
+    const unsigned char* m_values;
+    size_t m_count;
+    size_t m_stride;
+    const int* m_indices;
+    size_t m_indexCount;
+};
+
+//! An alias for `PrimvarView` that addresses `float` values (e.g widths or scale factors).
+using FloatPrimvarView = PrimvarView<float>;
+//! An alias for `PrimvarView` that addresses `GfVec2f` values (e.g texture coordinates).
+using Vec2fPrimvarView = PrimvarView<pxr::GfVec2f>;
+//! An alias for `PrimvarView` that addresses `GfVec3f` values (e.g points, normals, colors, or other vectors).
+using Vec3fPrimvarView = PrimvarView<pxr::GfVec3f>;
+
 //! @}
 
+namespace detail
+{
+
+//! Compute the first occurrence of each element in a sequence of `size` elements.
+//!
+//! This is the type-erased indexing engine used by `PrimvarData::index()`. It is implemented in the library so that large inputs can be
+//! sharded across threads via the OpenUSD `Work` library without requiring that dependency of every client of `PrimvarData`.
+//!
+//! @param size The number of elements.
+//! @param hash Returns the hash of the element at a given position. Elements which compare equal must hash equally.
+//! @param equal Returns whether the elements at the two given positions are equal.
+//! @param firstOccurrences An array of `size` elements which is filled with the position of the first element equal to each element.
+USDEX_API void computeFirstOccurrences(
+    size_t size,
+    const std::function<size_t(size_t)>& hash,
+    const std::function<bool(size_t, size_t)>& equal,
+    int* firstOccurrences
+);
+
+//! Invoke a function for each position in a sequence of `count` elements, distributing the positions across threads.
+//!
+//! This is the type-erased engine used to read many primvars concurrently. Each position is visited exactly once.
+//!
+//! @param count The number of elements.
+//! @param fn Called with each position. It must be safe to call concurrently for different positions.
+USDEX_API void forEachConcurrently(size_t count, const std::function<void(size_t)>& fn);
+
+//! Gather the authored `UsdGeomPrimvars` of a prim which hold values of a given type.
+//!
+//! @param prim The prim from which to gather the primvars.
+//! @param names Optional primvar names used to filter the primvars. If empty, all primvars of the value type are gathered.
+//! @param valueType The type of the values held by the primvars (e.g. `VtArray<float>`).
+//!
+//! @returns The matching primvars, in the order of the authored properties of the prim.
+USDEX_API std::vector<pxr::UsdGeomPrimvar> getAuthoredPrimvars(
+    const pxr::UsdPrim& prim,
+    const pxr::TfTokenVector& names,
+    const pxr::TfType& valueType
+);
+
+//! The type-erased members of a `PrimvarData`, to be authored by `setPrimvarValues`.
+struct PrimvarValues
+{
+    pxr::TfToken interpolation;
+    pxr::VtValue values;
+    pxr::VtValue indices;
+    int elementSize;
+};
+
+//! Author the values of many primvars directly to the current edit target layer within a single `SdfChangeBlock`.
+//!
+//! This is the type-erased engine used by `PrimvarData::setPrimvars()`.
+//!
+//! @param primvars The previously authored `UsdGeomPrimvars`.
+//! @param values The members to author onto each primvar. An empty `indices` value blocks the indices of the primvar.
+//! @param time The time at which the attribute values are written.
+//!
+//! @returns Whether all of the primvars were authored.
+USDEX_API bool setPrimvarValues(const std::vector<pxr::UsdGeomPrimvar>& primvars, const std::vector<PrimvarValues>& values, pxr::UsdTimeCode time);
+
+//! Check that all indices are within the range of a values array.
+//!
+//! This is the index validation used by `PrimvarData::isValid()`. The indices are reduced to their minimum and maximum using branchless
+//! comparisons, so that the loop vectorizes, and large arrays are reduced across multiple threads via the OpenUSD `Work` library.
+//!
+//! @param indices The indices to check.
+//! @param size The number of indices.
+//! @param valueCount The number of values addressed by the indices.
+//! @returns Whether every index is non-negative and less than `valueCount`.
+USDEX_API bool indicesInRange(const int* indices, size_t size, size_t valueCount);
+
+} // namespace detail
+
 } // namespace usdex::core
 
 #include "usdex/core/PrimvarData.inl"
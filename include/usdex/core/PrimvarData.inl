@@ -4,16 +4,247 @@
 
 #pragma once
 
+#include <pxr/base/gf/traits.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace usdex::core
 {
 
+namespace detail
+{
+
+//! Hashes and compares values exactly for `PrimvarData::index()`.
+//!
+//! Trivially copyable values are also considered equal when they are bitwise identical, so that e.g. matching `NaN` values are deduplicated.
+template <typename T>
+struct ExactIndexKey
+{
+    size_t hash(const T& value) const
+    {
+        return pxr::VtHashValue(value);
+    }
+
+    bool equal(const T& a, const T& b) const
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            return (a == b) || (std::memcmp(&a, &b, sizeof(T)) == 0);
+        }
+        else
+        {
+            return a == b;
+        }
+    }
+};
+
+//! Describes how to access the floating point components of a value type for quantized indexing.
+template <typename T, typename Enable = void>
+struct QuantizeTraits
+{
+    static constexpr bool supported = false;
+};
+
+template <typename T>
+struct QuantizeTraits<T, std::enable_if_t<std::is_floating_point_v<T>>>
+{
+    static constexpr bool supported = true;
+    static constexpr size_t dimension = 1;
+    static constexpr int digits = std::numeric_limits<T>::digits;
+
+    static double component(const T& value, size_t)
+    {
+        return static_cast<double>(value);
+    }
+};
+
+template <typename T>
+struct QuantizeTraits<T, std::enable_if_t<pxr::GfIsGfVec<T>::value && std::is_floating_point_v<typename T::ScalarType>>>
+{
+    static constexpr bool supported = true;
+    static constexpr size_t dimension = T::dimension;
+    static constexpr int digits = std::numeric_limits<typename T::ScalarType>::digits;
+
+    static double component(const T& value, size_t i)
+    {
+        return static_cast<double>(value[i]);
+    }
+};
+
+//! Hashes and compares values by snapping each component to a grid for `PrimvarData::index(float)`.
+template <typename T>
+struct QuantizedIndexKey
+{
+    using Traits = QuantizeTraits<T>;
+
+    explicit QuantizedIndexKey(float tolerance) : m_inverseTolerance(1.0 / static_cast<double>(tolerance))
+    {
+    }
+
+    //! The grid cell of a single component. Non-finite components, and those which would overflow the cell range, are instead identified by their
+    //! exact bits so that they are only merged with bitwise identical components.
+    std::pair<bool, int64_t> quantize(const T& value, size_t i) const
+    {
+        const double component = Traits::component(value, i);
+        const double cell = std::floor(component * m_inverseTolerance + 0.5);
+        if (!std::isfinite(cell) || std::abs(cell) > 9.0e18)
+        {
+            int64_t bits;
+            std::memcpy(&bits, &component, sizeof(bits));
+            return { false, bits };
+        }
+        return { true, static_cast<int64_t>(cell) };
+    }
+
+    size_t hash(const T& value) const
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < Traits::dimension; ++i)
+        {
+            const std::pair<bool, int64_t> cell = quantize(value, i);
+            result = pxr::TfHash::Combine(result, cell.first, cell.second);
+        }
+        return result;
+    }
+
+    bool equal(const T& a, const T& b) const
+    {
+        for (size_t i = 0; i < Traits::dimension; ++i)
+        {
+            if (quantize(a, i) != quantize(b, i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    double m_inverseTolerance;
+};
+
+//! Hashes and compares values by rounding each component to a number of significant bits for `PrimvarData::indexWithPrecision(int)`.
+template <typename T>
+struct PrecisionIndexKey
+{
+    using Traits = QuantizeTraits<T>;
+
+    explicit PrecisionIndexKey(int bits) : m_scale(std::ldexp(1.0, bits))
+    {
+    }
+
+    //! The rounded significand and the exponent of a single component. Non-finite components are instead identified by their exact bits, with an
+    //! exponent that no finite component can have, so that they are only merged with bitwise identical components.
+    std::pair<int64_t, int> quantize(const T& value, size_t i) const
+    {
+        const double component = Traits::component(value, i);
+        if (!std::isfinite(component))
+        {
+            int64_t bits;
+            std::memcpy(&bits, &component, sizeof(bits));
+            return { bits, std::numeric_limits<int>::max() };
+        }
+
+        int exponent = 0;
+        double significand = std::round(std::frexp(component, &exponent) * m_scale);
+
+        // Rounding may carry into the next exponent, which must be identified with the same value expressed at that exponent
+        if (std::abs(significand) == m_scale)
+        {
+            significand *= 0.5;
+            ++exponent;
+        }
+        return { static_cast<int64_t>(significand), exponent };
+    }
+
+    size_t hash(const T& value) const
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < Traits::dimension; ++i)
+        {
+            const std::pair<int64_t, int> rounded = quantize(value, i);
+            result = pxr::TfHash::Combine(result, rounded.first, rounded.second);
+        }
+        return result;
+    }
+
+    bool equal(const T& a, const T& b) const
+    {
+        for (size_t i = 0; i < Traits::dimension; ++i)
+        {
+            if (quantize(a, i) != quantize(b, i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    double m_scale;
+};
+
+//! Compute the first occurrence of each of `size` values into `firstOccurrences`, and return the number of unique values.
+//!
+//! Values sharing an existing index are equal without being compared.
+template <typename ValueAt, typename Key>
+size_t findFirstOccurrences(size_t size, const ValueAt& valueAt, const int* existingIndices, const Key& key, int* firstOccurrences)
+{
+    computeFirstOccurrences(
+        size,
+        [&](size_t i) { return key.hash(valueAt(i)); },
+        [&](size_t a, size_t b) { return (existingIndices && existingIndices[a] == existingIndices[b]) || key.equal(valueAt(a), valueAt(b)); },
+        firstOccurrences
+    );
+
+    size_t indexedSize = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (size_t(firstOccurrences[i]) == i)
+        {
+            ++indexedSize;
+        }
+    }
+    return indexedSize;
+}
+
+//! Gather the unique values and convert the first occurrences computed by `findFirstOccurrences` to `indices`.
+//!
+//! Each first occurrence precedes (or is) the current position, so its index has already been assigned by the time it is referenced.
+template <typename T, typename ValueAt>
+pxr::VtArray<T> compactFirstOccurrences(size_t size, const ValueAt& valueAt, size_t indexedSize, const int* firstOccurrences, int* indices)
+{
+    pxr::VtArray<T> indexedValues;
+    indexedValues.reserve(indexedSize);
+    for (size_t i = 0; i < size; ++i)
+    {
+        const size_t firstOccurrence = size_t(firstOccurrences[i]);
+        if (firstOccurrence == i)
+        {
+            indices[i] = static_cast<int>(indexedValues.size());
+            indexedValues.push_back(valueAt(i));
+        }
+        else
+        {
+            indices[i] = indices[firstOccurrence];
+        }
+    }
+    return indexedValues;
+}
+
+} // namespace detail
+
 template <typename T>
 PrimvarData<T>::PrimvarData(const pxr::TfToken& interpolation, const pxr::VtArray<T>& values, int elementSize)
     : m_interpolation(interpolation), m_elementSize(elementSize), m_values(values)
@@ -26,6 +257,18 @@ PrimvarData<T>::PrimvarData(const pxr::TfToken& interpolation, const pxr::VtArra
 {
 }
 
+template <typename T>
+PrimvarData<T>::PrimvarData(const pxr::TfToken& interpolation, pxr::VtArray<T>&& values, int elementSize)
+    : m_interpolation(interpolation), m_elementSize(elementSize), m_values(std::move(values))
+{
+}
+
+template <typename T>
+PrimvarData<T>::PrimvarData(const pxr::TfToken& interpolation, pxr::VtArray<T>&& values, pxr::VtArray<int>&& indices, int elementSize)
+    : m_interpolation(interpolation), m_elementSize(elementSize), m_values(std::move(values)), m_indices(std::move(indices))
+{
+}
+
 template <typename T>
 PrimvarData<T> PrimvarData<T>::getPrimvarData(const pxr::UsdGeomPrimvar& primvar, pxr::UsdTimeCode time)
 {
@@ -42,16 +285,43 @@ PrimvarData<T> PrimvarData<T>::getPrimvarData(const pxr::UsdGeomPrimvar& primvar
         return PrimvarData<T>(pxr::UsdGeomTokens->constant, {}, -1);
     }
 
-    if (primvar.IsIndexed())
+    // The indices attribute is resolved once, rather than once to check whether it is indexed and again to read the indices
+    pxr::VtIntArray indices;
+    const pxr::UsdAttribute indicesAttr = primvar.GetIndicesAttr();
+    if (indicesAttr && indicesAttr.Get(&indices, time))
     {
-        pxr::VtIntArray indices;
-        primvar.GetIndices(&indices, time);
-        return PrimvarData<T>(primvar.GetInterpolation(), values, indices, elementSize);
+        return PrimvarData<T>(primvar.GetInterpolation(), std::move(values), std::move(indices), elementSize);
     }
     else
     {
-        return PrimvarData<T>(primvar.GetInterpolation(), values, elementSize);
+        return PrimvarData<T>(primvar.GetInterpolation(), std::move(values), elementSize);
+    }
+}
+
+template <typename T>
+std::vector<PrimvarData<T>> PrimvarData<T>::getPrimvarData(const std::vector<pxr::UsdGeomPrimvar>& primvars, pxr::UsdTimeCode time)
+{
+    std::vector<PrimvarData<T>> result(primvars.size(), PrimvarData<T>(pxr::UsdGeomTokens->constant, pxr::VtArray<T>(), -1));
+    detail::forEachConcurrently(primvars.size(), [&](size_t i) { result[i] = PrimvarData<T>::getPrimvarData(primvars[i], time); });
+    return result;
+}
+
+template <typename T>
+std::map<pxr::TfToken, PrimvarData<T>> PrimvarData<T>::getPrimvarData(
+    const pxr::UsdPrim& prim,
+    const pxr::TfTokenVector& names,
+    pxr::UsdTimeCode time
+)
+{
+    const std::vector<pxr::UsdGeomPrimvar> primvars = detail::getAuthoredPrimvars(prim, names, pxr::TfType::Find<pxr::VtArray<T>>());
+    std::vector<PrimvarData<T>> data = PrimvarData<T>::getPrimvarData(primvars, time);
+
+    std::map<pxr::TfToken, PrimvarData<T>> result;
+    for (size_t i = 0; i < primvars.size(); ++i)
+    {
+        result.emplace(primvars[i].GetPrimvarName(), std::move(data[i]));
     }
+    return result;
 }
 
 template <typename T>
@@ -73,7 +343,15 @@ bool PrimvarData<T>::setPrimvar(pxr::UsdGeomPrimvar& primvar, pxr::UsdTimeCode t
     }
 
     // Author an explicit opinion about the indices to ensure weaker opinions are overriden
-    if (hasIndices())
+    if (!m_compactIndices.empty())
+    {
+        // Compact indices are widened for authoring only, rather than caching the widened array
+        if (!primvar.SetIndices(m_compactIndices.widen(), time))
+        {
+            return false;
+        }
+    }
+    else if (hasIndices())
     {
         if (!primvar.SetIndices(m_indices, time))
         {
@@ -98,6 +376,39 @@ bool PrimvarData<T>::setPrimvar(pxr::UsdGeomPrimvar& primvar, pxr::UsdTimeCode t
     return true;
 }
 
+template <typename T>
+bool PrimvarData<T>::setPrimvars(
+    const std::vector<pxr::UsdGeomPrimvar>& primvars,
+    const std::vector<PrimvarData<T>>& data,
+    pxr::UsdTimeCode time
+)
+{
+    // The arrays are shared with the type-erased values rather than copied
+    std::vector<detail::PrimvarValues> values;
+    values.reserve(data.size());
+    for (const PrimvarData<T>& item : data)
+    {
+        pxr::VtValue indices;
+        if (!item.m_compactIndices.empty())
+        {
+            indices = pxr::VtValue(item.m_compactIndices.widen());
+        }
+        else if (item.hasIndices())
+        {
+            indices = pxr::VtValue(item.m_indices);
+        }
+        values.push_back(
+            detail::PrimvarValues{
+                item.m_interpolation,
+                pxr::VtValue(item.m_values),
+                std::move(indices),
+                item.m_elementSize,
+            }
+        );
+    }
+    return detail::setPrimvarValues(primvars, values, time);
+}
+
 template <typename T>
 const pxr::TfToken& PrimvarData<T>::interpolation() const
 {
@@ -113,7 +424,7 @@ const pxr::VtArray<T>& PrimvarData<T>::values() const
 template <typename T>
 bool PrimvarData<T>::hasIndices() const
 {
-    return !m_indices.empty();
+    return !m_indices.empty() || !m_compactIndices.empty();
 }
 
 template <typename T>
@@ -124,9 +435,20 @@ const pxr::VtArray<int>& PrimvarData<T>::indices() const
         return m_indices;
     }
 
+    if (!m_compactIndices.empty())
+    {
+        return m_compactIndices.widened();
+    }
+
     throw std::runtime_error("It is invalid to call indices() on PrimvarData unless hasIndices() returns true");
 }
 
+template <typename T>
+bool PrimvarData<T>::hasCompactIndices() const
+{
+    return !m_compactIndices.empty();
+}
+
 template <typename T>
 int PrimvarData<T>::elementSize() const
 {
@@ -136,19 +458,18 @@ int PrimvarData<T>::elementSize() const
 template <typename T>
 size_t PrimvarData<T>::effectiveSize() const
 {
-    if (m_elementSize > 0)
-    {
-        return m_indices.empty() ? m_values.size() / m_elementSize : m_indices.size() / m_elementSize;
-    }
-    else
-    {
-        return m_indices.empty() ? m_values.size() : m_indices.size();
-    }
+    const size_t size = m_compactIndices.empty() ? (m_indices.empty() ? m_values.size() : m_indices.size()) : m_compactIndices.size();
+    return m_elementSize > 0 ? size / m_elementSize : size;
 }
 
 template <typename T>
 bool PrimvarData<T>::isValid() const
 {
+    if (m_validated.get())
+    {
+        return true;
+    }
+
     if (!pxr::UsdGeomPrimvar::IsValidInterpolation(m_interpolation))
     {
         return false;
@@ -159,7 +480,15 @@ bool PrimvarData<T>::isValid() const
         return false;
     }
 
-    if (m_indices.empty())
+    if (!m_compactIndices.empty())
+    {
+        // The indices were checked to be in range when they were compacted
+        if (m_elementSize > 0 && (m_compactIndices.size() % m_elementSize))
+        {
+            return false;
+        }
+    }
+    else if (m_indices.empty())
     {
         if (m_elementSize > 0 && (m_values.size() % m_elementSize))
         {
@@ -173,16 +502,13 @@ bool PrimvarData<T>::isValid() const
             return false;
         }
 
-        size_t maxIndex = m_values.size() - 1;
-        for (const int i : indices())
+        if (!detail::indicesInRange(m_indices.cdata(), m_indices.size(), m_values.size()))
         {
-            if (i < 0 || (size_t)i > maxIndex)
-            {
-                return false;
-            }
+            return false;
         }
     }
 
+    m_validated.set(true);
     return true;
 }
 
@@ -191,108 +517,673 @@ bool PrimvarData<T>::isIdentical(const PrimvarData& other) const
 {
     return (
         (m_interpolation == other.interpolation()) && (m_elementSize == other.elementSize()) && (this->hasIndices() == other.hasIndices()) &&
-        m_values.IsIdentical(other.values()) && m_indices.IsIdentical(other.indices())
+        m_values.IsIdentical(other.m_values) && m_indices.IsIdentical(other.m_indices) && m_compactIndices.isIdentical(other.m_compactIndices)
     );
 }
 
 template <typename T>
-bool PrimvarData<T>::index()
+size_t PrimvarData<T>::hash() const
 {
-    // Abort indexing if the element size is greater than one
-    // We do not fully understand the correct manner by which indexing should be described when element size is involved.
-    if (m_elementSize > 1)
+    if (const size_t cached = m_hash.get())
     {
-        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
-        pxr::Tf_PostErrorHelper(
-            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
-            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
-            "Unable to index PrimvarData due to element size greater than one"
-        );
-        return false;
+        return cached;
     }
 
-    // Compute the flattened values so that indexing can be performed on indexed or non-indexed data
-    pxr::VtArray<T> flattenedValues;
-    if (this->hasIndices())
+    // The hash is deterministic, so concurrent callers computing it at the same time store the same value
+    if (!m_compactIndices.empty())
     {
-        flattenedValues.reserve(m_indices.size());
-        for (const auto& index : m_indices)
-        {
-            if (size_t(index) < m_values.size())
-            {
-                flattenedValues.push_back(m_values[index]);
-            }
-            else
-            {
-                // Abort indexing if existing indices are outside the value range
-                // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
-                pxr::Tf_PostErrorHelper(
-                    pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
-                    pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
-                    "Unable to index PrimvarData due to existing indices outside the range of existing values"
-                );
-                return false;
-            }
-        }
+        // Compact indices are hashed as the equivalent VtIntArray, so that the hash does not depend on the representation
+        return m_hash.set(pxr::TfHash::Combine(m_interpolation, m_elementSize, m_values, m_compactIndices.widen()));
     }
-    else
+    return m_hash.set(pxr::TfHash::Combine(m_interpolation, m_elementSize, m_values, m_indices));
+}
+
+template <typename T>
+bool PrimvarData<T>::compactIndices()
+{
+    if (m_indices.empty())
+    {
+        return false;
+    }
+
+    if (!m_compactIndices.assign(m_indices, m_values.size()))
     {
-        flattenedValues = m_values;
+        return false;
     }
 
-    // Compute the indices and indexed values
-    pxr::VtArray<T> indexedValues;
-    pxr::VtIntArray indices;
-    indices.reserve(flattenedValues.size());
+    // The content is unchanged, so the validation and hash remain valid
+    m_indices = pxr::VtArray<int>();
+    return true;
+}
 
-    std::unordered_map<size_t, int> indexMap;
-    for (const auto& value : flattenedValues)
+template <typename T>
+bool PrimvarData<T>::demoteToConstant()
+{
+    if (m_interpolation == pxr::UsdGeomTokens->constant || !this->demoteCheck(this->effectiveSize()))
     {
-        auto insertIt = indexMap.insert(std::make_pair(pxr::VtHashValue(value), static_cast<int>(indexedValues.size())));
+        return false;
+    }
 
-        // If the insert succeeded it is a new value and should be added to the values array
-        if (insertIt.second)
-        {
-            indexedValues.push_back(value);
-        }
+    return this->demoteBy(pxr::UsdGeomTokens->constant, 1, [](size_t) { return size_t(0); });
+}
 
-        indices.push_back(insertIt.first->second);
+template <typename T>
+bool PrimvarData<T>::demoteMeshInterpolation(const pxr::VtArray<int>& faceVertexCounts, const pxr::VtArray<int>& faceVertexIndices, size_t pointCount)
+{
+    if (m_interpolation == pxr::UsdGeomTokens->constant)
+    {
+        return false;
     }
 
-    // Do not update the values and indices if their sizes have not changed.
-    // Otherwise we are simply shuffling the data rather than actually changing the indexing.
-    if (m_values.size() == indexedValues.size() && m_indices.size() == indices.size())
+    size_t expectedSize = this->effectiveSize();
+    if (m_interpolation == pxr::UsdGeomTokens->uniform)
+    {
+        expectedSize = faceVertexCounts.size();
+    }
+    else if (m_interpolation == pxr::UsdGeomTokens->vertex || m_interpolation == pxr::UsdGeomTokens->varying)
+    {
+        expectedSize = pointCount;
+    }
+    else if (m_interpolation == pxr::UsdGeomTokens->faceVarying)
+    {
+        expectedSize = faceVertexIndices.size();
+    }
+    if (!this->demoteCheck(expectedSize))
     {
         return false;
     }
 
-    // Do not update the values and indices if the indices and values are the same size and the data is currently not indexed.
-    // Otherwise we are authoring redundant indexing as there are no duplicate values.
-    if (indexedValues.size() == indices.size() && m_indices.empty())
+    if (this->demoteBy(pxr::UsdGeomTokens->constant, 1, [](size_t) { return size_t(0); }))
+    {
+        return true;
+    }
+
+    // Only faceVarying data can be demoted to another interpolation, as each vertex may belong to many faces
+    if (m_interpolation != pxr::UsdGeomTokens->faceVarying)
     {
         return false;
     }
 
-    // Update the values and indices
-    m_values = indexedValues;
-    m_indices = indices;
+    // The face of each face vertex is required to demote to uniform, which also confirms that the topology matches the data
+    std::vector<size_t> faces;
+    faces.reserve(faceVertexIndices.size());
+    for (size_t face = 0; face < faceVertexCounts.size(); ++face)
+    {
+        if (faceVertexCounts[face] < 0 || faces.size() + static_cast<size_t>(faceVertexCounts[face]) > faceVertexIndices.size())
+        {
+            break;
+        }
+        faces.insert(faces.end(), static_cast<size_t>(faceVertexCounts[face]), face);
+    }
+    const bool validIndices = std::all_of(
+        faceVertexIndices.cbegin(),
+        faceVertexIndices.cend(),
+        [pointCount](int index) { return index >= 0 && static_cast<size_t>(index) < pointCount; }
+    );
+    if (faces.size() != faceVertexIndices.size() || !validIndices)
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to demote the interpolation of PrimvarData due to invalid mesh topology"
+        );
+        return false;
+    }
 
-    return true;
+    auto toUniform = [&faces](size_t i) { return faces[i]; };
+    auto toVertex = [&faceVertexIndices](size_t i) { return static_cast<size_t>(faceVertexIndices[i]); };
+    if (faceVertexCounts.size() <= pointCount)
+    {
+        return this->demoteBy(pxr::UsdGeomTokens->uniform, faceVertexCounts.size(), toUniform) ||
+               this->demoteBy(pxr::UsdGeomTokens->vertex, pointCount, toVertex);
+    }
+    return this->demoteBy(pxr::UsdGeomTokens->vertex, pointCount, toVertex) ||
+           this->demoteBy(pxr::UsdGeomTokens->uniform, faceVertexCounts.size(), toUniform);
 }
 
 template <typename T>
-bool PrimvarData<T>::operator==(const PrimvarData<T>& other) const
+bool PrimvarData<T>::demoteCurvesInterpolation(const pxr::VtArray<int>& curveVertexCounts)
 {
-    return (
-        (m_interpolation == other.interpolation()) && (m_elementSize == other.elementSize()) && (this->hasIndices() == other.hasIndices()) &&
-        (m_values == other.values()) && (m_indices == other.indices())
-    );
-}
+    if (m_interpolation == pxr::UsdGeomTokens->constant)
+    {
+        return false;
+    }
 
-template <typename T>
-bool PrimvarData<T>::operator!=(const PrimvarData<T>& other) const
-{
-    return !(*this == other);
+    // The curve of each vertex is required to demote vertex data to uniform
+    std::vector<size_t> curves;
+    bool validCounts = true;
+    for (size_t curve = 0; curve < curveVertexCounts.size() && validCounts; ++curve)
+    {
+        validCounts = curveVertexCounts[curve] >= 0;
+        curves.insert(curves.end(), static_cast<size_t>(std::max(curveVertexCounts[curve], 0)), curve);
+    }
+
+    size_t expectedSize = this->effectiveSize();
+    if (m_interpolation == pxr::UsdGeomTokens->uniform)
+    {
+        expectedSize = curveVertexCounts.size();
+    }
+    else if (m_interpolation == pxr::UsdGeomTokens->vertex)
+    {
+        expectedSize = validCounts ? curves.size() : 0;
+    }
+    if (!this->demoteCheck(expectedSize))
+    {
+        return false;
+    }
+
+    if (this->demoteBy(pxr::UsdGeomTokens->constant, 1, [](size_t) { return size_t(0); }))
+    {
+        return true;
+    }
+
+    // The number of varying elements of each curve depends on its basis and wrap, so only vertex data can be demoted to uniform
+    if (m_interpolation != pxr::UsdGeomTokens->vertex)
+    {
+        return false;
+    }
+    return this->demoteBy(pxr::UsdGeomTokens->uniform, curveVertexCounts.size(), [&curves](size_t i) { return curves[i]; });
+}
+
+template <typename T>
+bool PrimvarData<T>::demoteCheck(size_t expectedSize)
+{
+    if (!this->isValid())
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to demote the interpolation of PrimvarData as the data is invalid"
+        );
+        return false;
+    }
+
+    const size_t size = this->effectiveSize();
+    if (size == 0 || size != expectedSize)
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to demote the interpolation of PrimvarData with %zu elements, as %zu elements are expected for %s interpolation",
+            size,
+            expectedSize,
+            m_interpolation.GetText()
+        );
+        return false;
+    }
+    return true;
+}
+
+template <typename T>
+template <typename ElementAt>
+bool PrimvarData<T>::demoteBy(const pxr::TfToken& interpolation, size_t count, const ElementAt& elementAt)
+{
+    // Compact indices are widened temporarily, as the demoted indices are held as a VtIntArray regardless
+    const pxr::VtArray<int> widenedIndices = m_compactIndices.widen();
+    const pxr::VtArray<int>& currentIndices = m_compactIndices.empty() ? m_indices : widenedIndices;
+    const bool hasIndices = this->hasIndices();
+
+    // Address the flattened values in place, so that indexed and non-indexed data are compared in the same manner
+    const T* values = m_values.cdata();
+    const int* indices = hasIndices ? currentIndices.cdata() : nullptr;
+    auto valueAt = [values, indices](size_t i) -> const T& { return indices ? values[indices[i]] : values[i]; };
+    const size_t stride = static_cast<size_t>(std::max(m_elementSize, 1));
+    const size_t size = this->effectiveSize();
+
+    // Every element must match the first element which demotes to the same element, which is found in a single pass
+    std::vector<size_t> firstElements(count, size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        size_t& first = firstElements[elementAt(i)];
+        if (first == size)
+        {
+            first = i;
+            continue;
+        }
+        for (size_t j = 0; j < stride; ++j)
+        {
+            if (!(valueAt(first * stride + j) == valueAt(i * stride + j)))
+            {
+                return false;
+            }
+        }
+    }
+
+    // Demoted elements without a matching element (e.g. unreferenced points) take the first element, as they are never displayed
+    const bool keepIndices = hasIndices && interpolation != pxr::UsdGeomTokens->constant;
+    pxr::VtArray<T> demotedValues(keepIndices ? 0 : count * stride);
+    pxr::VtArray<int> demotedIndices(keepIndices ? count * stride : 0);
+    for (size_t element = 0; element < count; ++element)
+    {
+        const size_t first = (firstElements[element] == size) ? 0 : firstElements[element];
+        for (size_t j = 0; j < stride; ++j)
+        {
+            if (keepIndices)
+            {
+                demotedIndices[element * stride + j] = indices[first * stride + j];
+            }
+            else
+            {
+                demotedValues[element * stride + j] = valueAt(first * stride + j);
+            }
+        }
+    }
+
+    // Update the interpolation, values, and indices. The new data is validated again on demand.
+    if (!keepIndices)
+    {
+        m_values = std::move(demotedValues);
+    }
+    m_indices = std::move(demotedIndices);
+    m_compactIndices.clear();
+    m_interpolation = interpolation;
+    m_validated.set(false);
+    m_hash.clear();
+
+    return true;
+}
+
+template <typename T>
+bool PrimvarData<T>::index()
+{
+    return this->indexBy(detail::ExactIndexKey<T>());
+}
+
+template <typename T>
+bool PrimvarData<T>::index(float tolerance)
+{
+    if constexpr (detail::QuantizeTraits<T>::supported)
+    {
+        if (tolerance < 0.0f)
+        {
+            // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+            pxr::Tf_PostErrorHelper(
+                pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+                pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+                "Unable to index PrimvarData due to a negative tolerance"
+            );
+            return false;
+        }
+
+        if (tolerance == 0.0f)
+        {
+            return this->index();
+        }
+
+        return this->indexBy(detail::QuantizedIndexKey<T>(tolerance));
+    }
+    else
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to index PrimvarData with a tolerance as the value type is not floating point"
+        );
+        return false;
+    }
+}
+
+template <typename T>
+bool PrimvarData<T>::indexWithPrecision(int bits)
+{
+    if constexpr (detail::QuantizeTraits<T>::supported)
+    {
+        if (bits < 1)
+        {
+            // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+            pxr::Tf_PostErrorHelper(
+                pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+                pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+                "Unable to index PrimvarData due to a precision of less than one bit"
+            );
+            return false;
+        }
+
+        // Every value is already representable with this precision, so rounding would not merge any distinct values
+        if (bits >= detail::QuantizeTraits<T>::digits)
+        {
+            return this->index();
+        }
+
+        return this->indexBy(detail::PrecisionIndexKey<T>(bits));
+    }
+    else
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to index PrimvarData with a precision as the value type is not floating point"
+        );
+        return false;
+    }
+}
+
+template <typename T>
+template <typename Key>
+bool PrimvarData<T>::indexBy(const Key& key)
+{
+    // Abort indexing if the element size is greater than one
+    // We do not fully understand the correct manner by which indexing should be described when element size is involved.
+    if (m_elementSize > 1)
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to index PrimvarData due to element size greater than one"
+        );
+        return false;
+    }
+
+    // Compact indices are widened temporarily, as the indices are re-numbered as a VtIntArray regardless
+    const pxr::VtArray<int> widenedIndices = m_compactIndices.widen();
+    const pxr::VtArray<int>& currentIndices = m_compactIndices.empty() ? m_indices : widenedIndices;
+
+    // Abort indexing if existing indices are outside the value range
+    const bool hasIndices = this->hasIndices();
+    if (!detail::indicesInRange(currentIndices.cdata(), currentIndices.size(), m_values.size()))
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to index PrimvarData due to existing indices outside the range of existing values"
+        );
+        return false;
+    }
+
+    // Address the flattened values in place, rather than copying them, so that indexing can be performed on indexed or non-indexed data
+    const T* values = m_values.cdata();
+    const int* existingIndices = hasIndices ? currentIndices.cdata() : nullptr;
+    const size_t size = hasIndices ? currentIndices.size() : m_values.size();
+    auto valueAt = [values, existingIndices](size_t i) -> const T& { return existingIndices ? values[existingIndices[i]] : values[i]; };
+
+    // The first occurrences are temporary, so the new indices are only allocated once it is known that the indexing will change
+    detail::ScratchArray<int> firstOccurrences(size);
+    const size_t indexedSize = detail::findFirstOccurrences(size, valueAt, existingIndices, key, firstOccurrences.data());
+
+    // Do not update the values and indices if their sizes have not changed.
+    // Otherwise we are simply shuffling the data rather than actually changing the indexing.
+    if (m_values.size() == indexedSize && currentIndices.size() == size)
+    {
+        return false;
+    }
+
+    // Do not update the values and indices if the indices and values are the same size and the data is currently not indexed.
+    // Otherwise we are authoring redundant indexing as there are no duplicate values.
+    if (indexedSize == size && !hasIndices)
+    {
+        return false;
+    }
+
+    pxr::VtIntArray indices(size);
+    pxr::VtArray<T> indexedValues = detail::compactFirstOccurrences<T>(size, valueAt, indexedSize, firstOccurrences.data(), indices.data());
+
+    // Update the values and indices. The new data is validated again on demand.
+    m_values = std::move(indexedValues);
+    m_indices = std::move(indices);
+    m_compactIndices.clear();
+    m_validated.set(false);
+    m_hash.clear();
+
+    return true;
+}
+
+template <typename T>
+bool PrimvarData<T>::operator==(const PrimvarData<T>& other) const
+{
+    if ((m_interpolation != other.m_interpolation) || (m_elementSize != other.m_elementSize))
+    {
+        return false;
+    }
+
+    if (m_values.IsIdentical(other.m_values) && m_indices.IsIdentical(other.m_indices) && m_compactIndices.isIdentical(other.m_compactIndices))
+    {
+        return true;
+    }
+
+    // Only previously computed hashes are compared, so that callers which never hash the data do not pay for it
+    const size_t hash = m_hash.get();
+    const size_t otherHash = other.m_hash.get();
+    if (hash && otherHash && hash != otherHash)
+    {
+        return false;
+    }
+
+    if ((this->hasIndices() != other.hasIndices()) || (m_values != other.m_values))
+    {
+        return false;
+    }
+
+    // The indices may be compared across representations, without widening either of them
+    if (m_compactIndices.empty() && other.m_compactIndices.empty())
+    {
+        return m_indices == other.m_indices;
+    }
+    else if (!m_compactIndices.empty() && !other.m_compactIndices.empty())
+    {
+        return m_compactIndices == other.m_compactIndices;
+    }
+    return m_compactIndices.empty() ? (other.m_compactIndices == m_indices) : (m_compactIndices == other.m_indices);
+}
+
+template <typename T>
+bool PrimvarData<T>::operator!=(const PrimvarData<T>& other) const
+{
+    return !(*this == other);
+}
+
+template <typename T>
+PrimvarView<T>::PrimvarView(const pxr::TfToken& interpolation, const T* values, size_t count, size_t stride, int elementSize)
+    : PrimvarView(interpolation, values, count, stride, nullptr, 0, elementSize)
+{
+}
+
+template <typename T>
+PrimvarView<T>::PrimvarView(
+    const pxr::TfToken& interpolation,
+    const T* values,
+    size_t count,
+    size_t stride,
+    const int* indices,
+    size_t indexCount,
+    int elementSize
+)
+    : m_interpolation(interpolation),
+      m_elementSize(elementSize),
+      m_values(reinterpret_cast<const unsigned char*>(values)),
+      m_count(count),
+      m_stride(stride),
+      m_indices(indexCount ? indices : nullptr),
+      m_indexCount(indices ? indexCount : 0)
+{
+}
+
+template <typename T>
+const pxr::TfToken& PrimvarView<T>::interpolation() const
+{
+    return m_interpolation;
+}
+
+template <typename T>
+size_t PrimvarView<T>::size() const
+{
+    return m_count;
+}
+
+template <typename T>
+size_t PrimvarView<T>::stride() const
+{
+    return m_stride;
+}
+
+template <typename T>
+const T& PrimvarView<T>::value(size_t i) const
+{
+    return *reinterpret_cast<const T*>(m_values + i * m_stride);
+}
+
+template <typename T>
+bool PrimvarView<T>::hasIndices() const
+{
+    return m_indices != nullptr;
+}
+
+template <typename T>
+const int* PrimvarView<T>::indices() const
+{
+    return m_indices;
+}
+
+template <typename T>
+size_t PrimvarView<T>::indexCount() const
+{
+    return m_indexCount;
+}
+
+template <typename T>
+int PrimvarView<T>::elementSize() const
+{
+    return m_elementSize;
+}
+
+template <typename T>
+size_t PrimvarView<T>::effectiveSize() const
+{
+    const size_t size = hasIndices() ? m_indexCount : m_count;
+    return m_elementSize > 0 ? size / m_elementSize : size;
+}
+
+template <typename T>
+bool PrimvarView<T>::isValid() const
+{
+    if (!pxr::UsdGeomPrimvar::IsValidInterpolation(m_interpolation))
+    {
+        return false;
+    }
+
+    if (m_values == nullptr || m_count == 0)
+    {
+        return false;
+    }
+
+    // Each value must be addressable as a T
+    if (m_stride < sizeof(T) || (m_stride % alignof(T)) || (reinterpret_cast<uintptr_t>(m_values) % alignof(T)))
+    {
+        return false;
+    }
+
+    if (!hasIndices())
+    {
+        return !(m_elementSize > 0 && (m_count % m_elementSize));
+    }
+
+    if (m_elementSize > 0 && (m_indexCount % m_elementSize))
+    {
+        return false;
+    }
+
+    return detail::indicesInRange(m_indices, m_indexCount, m_count);
+}
+
+template <typename T>
+pxr::VtArray<T> PrimvarView<T>::copyValues() const
+{
+    if (m_values == nullptr || m_count == 0)
+    {
+        return pxr::VtArray<T>();
+    }
+
+    pxr::VtArray<T> values(m_count);
+
+    T* data = values.data();
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        if (m_stride == sizeof(T))
+        {
+            std::memcpy(data, m_values, m_count * sizeof(T));
+            return values;
+        }
+    }
+
+    for (size_t i = 0; i < m_count; ++i)
+    {
+        data[i] = value(i);
+    }
+    return values;
+}
+
+template <typename T>
+PrimvarData<T> PrimvarView<T>::toPrimvarData() const
+{
+    if (hasIndices())
+    {
+        return PrimvarData<T>(m_interpolation, copyValues(), pxr::VtIntArray(m_indices, m_indices + m_indexCount), m_elementSize);
+    }
+    return PrimvarData<T>(m_interpolation, copyValues(), m_elementSize);
+}
+
+template <typename T>
+PrimvarData<T> PrimvarView<T>::index() const
+{
+    // Abort indexing if the element size is greater than one, matching PrimvarData::index()
+    if (m_elementSize > 1)
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to index PrimvarView due to element size greater than one"
+        );
+        return toPrimvarData();
+    }
+
+    // Abort indexing if existing indices are outside the value range
+    if (!detail::indicesInRange(m_indices, m_indexCount, m_count))
+    {
+        // this is a TF_RUNTIME_ERROR, but we have expanded the code manually to inject the class namespaces
+        pxr::Tf_PostErrorHelper(
+            pxr::TfCallContext(__ARCH_FILE__, __ARCH_FUNCTION__, __LINE__, __ARCH_PRETTY_FUNCTION__),
+            pxr::TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE,
+            "Unable to index PrimvarView due to existing indices outside the range of existing values"
+        );
+        return toPrimvarData();
+    }
+
+    if (m_values == nullptr)
+    {
+        return toPrimvarData();
+    }
+
+    // Address the flattened values in place, so that only the unique values are copied
+    const int* existingIndices = m_indices;
+    const size_t size = hasIndices() ? m_indexCount : m_count;
+    auto valueAt = [this, existingIndices](size_t i) -> const T& { return existingIndices ? value(existingIndices[i]) : value(i); };
+
+    detail::ScratchArray<int> firstOccurrences(size);
+    const size_t indexedSize = detail::findFirstOccurrences(size, valueAt, existingIndices, detail::ExactIndexKey<T>(), firstOccurrences.data());
+
+    // Keep the existing data if indexing would only shuffle it, or if there are no duplicate values, matching PrimvarData::index()
+    if ((m_count == indexedSize && m_indexCount == size) || (indexedSize == size && !hasIndices()))
+    {
+        return toPrimvarData();
+    }
+
+    pxr::VtIntArray indices(size);
+    pxr::VtArray<T> indexedValues = detail::compactFirstOccurrences<T>(size, valueAt, indexedSize, firstOccurrences.data(), indices.data());
+    return PrimvarData<T>(m_interpolation, std::move(indexedValues), std::move(indices), m_elementSize);
+}
+
+template <typename T>
+bool PrimvarView<T>::setPrimvar(pxr::UsdGeomPrimvar& primvar, pxr::UsdTimeCode time) const
+{
+    // The copies are only referenced by the PrimvarData, so they are shared with the layer rather than copied again
+    return toPrimvarData().setPrimvar(primvar, time);
 }
 
 } // namespace usdex::core
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file usdex/core/ScratchArena.h
+//! @brief A thread local arena for the temporary buffers of the geometry algorithms.
+
+#include "Api.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace usdex::core
+{
+
+//! @defgroup scratch Scratch Memory
+//!
+//! A thread local arena for the temporary buffers of the geometry algorithms.
+//!
+//! The geometry algorithms of this library (e.g. `computeMeshNormals`, `PrimvarData::index()`, and the validation of the `define` functions)
+//! require intermediate storage, such as face offsets, vertex adjacencies, and hash tables, which is discarded once the result is computed.
+//! This storage is allocated from an arena which is local to the calling thread, rather than from the general heap. Only the arrays which are
+//! returned to the caller (or authored to a layer) are allocated from the general heap.
+//!
+//! By default the arena frees its memory as soon as each computation completes. Converters which process many small meshes should wrap each
+//! batch of conversions in a `ScratchArenaScope`, so that the arena retains its memory between computations and each computation reuses it.
+//!
+//! @{
+
+//! Retains the memory of the scratch arena of the calling thread, for the lifetime of this object.
+//!
+//! While any scope is active, the memory of the arena is kept when a computation completes, and is reused by the next computation on the same
+//! thread. When the arena has grown in several blocks they are coalesced into a single block, so that subsequent computations of a similar size
+//! are served by a single block. The memory is freed when the outermost scope ends.
+//!
+//! Scopes apply to the calling thread only and may be nested. Computations which are distributed across worker threads (e.g. for very large
+//! meshes) allocate the storage of each worker from the arena of that worker thread.
+class USDEX_API ScratchArenaScope
+{
+
+public:
+
+    //! Retain the memory of the scratch arena of the calling thread.
+    ScratchArenaScope();
+    ~ScratchArenaScope();
+
+    ScratchArenaScope(const ScratchArenaScope&) = delete;
+    ScratchArenaScope& operator=(const ScratchArenaScope&) = delete;
+
+    //! Whether a `ScratchArenaScope` is active on the calling thread.
+    //!
+    //! @returns Whether the memory of the arena is retained between computations.
+    static bool isActive();
+
+    //! The number of bytes currently held by the scratch arena of the calling thread.
+    //!
+    //! @returns The capacity of the arena, including memory which is retained but not in use.
+    static size_t getCapacity();
+};
+
+//! @}
+
+namespace detail
+{
+
+//! Allocate uninitialized memory from the scratch arena of the calling thread.
+//!
+//! This is the type-erased engine used by `ScratchArray`.
+//!
+//! @param bytes The number of bytes to allocate.
+//! @param alignment The alignment of the allocation, which must be a power of two no greater than `alignof(std::max_align_t)`.
+//! @param handle Set to the handle of the allocation, to be passed to `releaseScratch` on the same thread.
+//! @returns The allocated memory.
+USDEX_API void* allocateScratch(size_t bytes, size_t alignment, size_t* handle);
+
+//! Release an allocation made by `allocateScratch`.
+//!
+//! Allocations may be released in any order, but the memory of an allocation is only reused once all later allocations are also released.
+//!
+//! @param handle The handle of the allocation.
+USDEX_API void releaseScratch(size_t handle);
+
+//! A fixed size array of trivial values, allocated from the scratch arena of the calling thread.
+//!
+//! The array must be destroyed on the thread which created it, but its values may be accessed from any thread (e.g. by `Work` tasks).
+template <typename T>
+class ScratchArray
+{
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "ScratchArray values must be trivial");
+
+public:
+
+    //! Allocate an array of uninitialized values.
+    explicit ScratchArray(size_t size) : m_size(size), m_owned(true)
+    {
+        m_data = static_cast<T*>(allocateScratch(size * sizeof(T), alignof(T), &m_handle));
+    }
+
+    //! Allocate an array with every element set to `value`.
+    ScratchArray(size_t size, const T& value) : ScratchArray(size)
+    {
+        std::fill_n(m_data, m_size, value);
+    }
+
+    ScratchArray(ScratchArray&& other) noexcept : m_data(other.m_data), m_size(other.m_size), m_handle(other.m_handle), m_owned(other.m_owned)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_owned = false;
+    }
+
+    ~ScratchArray()
+    {
+        if (m_owned)
+        {
+            releaseScratch(m_handle);
+        }
+    }
+
+    ScratchArray(const ScratchArray&) = delete;
+    ScratchArray& operator=(const ScratchArray&) = delete;
+    ScratchArray& operator=(ScratchArray&&) = delete;
+
+    T* data()
+    {
+        return m_data;
+    }
+
+    const T* data() const
+    {
+        return m_data;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    T& operator[](size_t i)
+    {
+        return m_data[i];
+    }
+
+    const T& operator[](size_t i) const
+    {
+        return m_data[i];
+    }
+
+    T* begin()
+    {
+        return m_data;
+    }
+
+    T* end()
+    {
+        return m_data + m_size;
+    }
+
+    const T* begin() const
+    {
+        return m_data;
+    }
+
+    const T* end() const
+    {
+        return m_data + m_size;
+    }
+
+private:
+
+    T* m_data;
+    size_t m_size;
+    size_t m_handle;
+    bool m_owned;
+};
+
+} // namespace detail
+
+} // namespace usdex::core
@@ -33,6 +33,19 @@ namespace usdex::core
 //! See [Valid and Unique Names](../docs/authoring-usd.html#valid-and-unique-names) for details.
 USDEX_API extern pxr::TfEnvSetting<bool> USDEX_ENABLE_TRANSCODING;
 
+//! Set the `USDEX_VALID_NAME_CACHE_SIZE` environment variable to memoize the results of `getValidPrimName(s)` and `getValidPropertyName(s)`.
+//! Defaults `0` (memoization is disabled).
+//!
+//! When positive, up to this many of the most recently used names are retained, separately for prims and properties. Repeated requests for
+//! the same original name then skip transcoding and return the existing `TfToken`. The memo is process-wide and thread-safe.
+USDEX_API extern pxr::TfEnvSetting<int> USDEX_VALID_NAME_CACHE_SIZE;
+
+//! Set the `USDEX_ENABLE_INSTRUMENTATION` environment variable to enable/disable the recording of performance counters by the instrumented
+//! functions of this library. Defaults `false` (instrumentation is disabled).
+//!
+//! This only sets the initial state, it can be changed at runtime using `setInstrumentationEnabled`. See @ref instrumentation for details.
+USDEX_API extern pxr::TfEnvSetting<bool> USDEX_ENABLE_INSTRUMENTATION;
+
 //! }@
 
 } // namespace usdex::core
@@ -8,12 +8,18 @@
 //! @brief Utility functions to provide consistant authoring of `UsdStages`
 
 #include "Api.h"
+#include "LayerAlgo.h"
 
 #include <pxr/base/tf/token.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/stageCache.h>
 
+#include <cstdint>
+#include <future>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace usdex::core
 {
@@ -55,6 +61,29 @@ USDEX_API pxr::UsdStageRefPtr createStage(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
 );
 
+//! Create and configure a `UsdStage` so that the defining metadata is explicitly authored, using the given write options.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! @param identifier The identifier to be used for the root layer of this stage.
+//! @param defaultPrimName Name of the default root prim.
+//! @param upAxis The up axis for all the geometry contained in the stage.
+//! @param linearUnits The meters per unit for all linear measurements in the stage, eg. `UsdGeomLinearUnits::meters`
+//! @param massUnits The kilograms per unit for all mass measurements in the stage, eg. `UsdPhysicsMassUnits::kilograms`
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+//! @param writeOptions The options which control how the root layer is encoded. See `LayerWriteOptions` for details.
+//! @returns The newly created stage or a null pointer.
+USDEX_API pxr::UsdStageRefPtr createStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const pxr::TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const LayerWriteOptions& writeOptions
+);
+
 //! Create and configure a `UsdStage` so that the defining metadata is explicitly authored.
 //!
 //! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
@@ -76,6 +105,61 @@ USDEX_API pxr::UsdStageRefPtr createStage(
     const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
 );
 
+//! Create and configure a `UsdStage` so that the defining metadata is explicitly authored, without writing the root layer.
+//!
+//! This is equivalent to `createStage`, except that the root layer is created in memory via `SdfLayer::New` and configured in place, rather
+//! than being exported to the identifier and read back. The root layer is only written when the stage is saved (e.g. via `saveStage`). This
+//! avoids a file write, read, and parse per stage, which is significant when creating many small stages on network storage.
+//!
+//! The arguments are validated and the metadata is authored on a temporary in-memory stage first, so a failure leaves no layer registered
+//! with the identifier. If a layer with the identifier is already open, its content is replaced, matching `createStage`.
+//!
+//! @note Until the stage is saved, no file exists at the identifier, so other processes (and `SdfLayer::FindOrOpen` after the stage is
+//! released) can not open it.
+//!
+//! @param identifier The identifier to be used for the root layer of this stage.
+//! @param defaultPrimName Name of the default root prim.
+//! @param upAxis The up axis for all the geometry contained in the stage.
+//! @param linearUnits The meters per unit for all linear measurements in the stage, eg. `UsdGeomLinearUnits::meters`
+//! @param massUnits The kilograms per unit for all mass measurements in the stage, eg. `UsdPhysicsMassUnits::kilograms`
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+//! @param fileFormatArgs Additional file format-specific arguments to be supplied during Stage creation.
+//! @returns The newly created stage or a null pointer.
+USDEX_API pxr::UsdStageRefPtr createUnsavedStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const pxr::TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs = pxr::SdfLayer::FileFormatArguments()
+);
+
+//! Create and configure a `UsdStage` so that the defining metadata is explicitly authored, without writing the root layer, using the given
+//! write options.
+//!
+//! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+//!
+//! @param identifier The identifier to be used for the root layer of this stage.
+//! @param defaultPrimName Name of the default root prim.
+//! @param upAxis The up axis for all the geometry contained in the stage.
+//! @param linearUnits The meters per unit for all linear measurements in the stage, eg. `UsdGeomLinearUnits::meters`
+//! @param massUnits The kilograms per unit for all mass measurements in the stage, eg. `UsdPhysicsMassUnits::kilograms`
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+//! @param writeOptions The options which control how the root layer is encoded when it is saved. See `LayerWriteOptions` for details.
+//! @returns The newly created stage or a null pointer.
+USDEX_API pxr::UsdStageRefPtr createUnsavedStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const pxr::TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const LayerWriteOptions& writeOptions
+);
+
 //! Configure a stage so that the defining metadata is explicitly authored.
 //!
 //! The default prim will be used as the target of a Reference or Payload to this layer when no explicit prim path is specified.
@@ -145,6 +229,70 @@ USDEX_API void saveStage(
     std::optional<std::string_view> comment = std::nullopt
 );
 
+//! The outcome of saving a single layer via `saveStageWithReport`
+class LayerSaveReport
+{
+public:
+
+    std::string identifier; //!< The identifier of the layer
+    bool saved = false; //!< Whether the layer was saved successfully
+    int64_t bytesWritten = 0; //!< The size of the saved layer in bytes, or zero if it could not be determined
+    double seconds = 0.0; //!< The wall time spent saving the layer, in seconds
+};
+
+//! Save the given `UsdStage` with metadata applied to all dirty layers, saving independent layers concurrently.
+//!
+//! This is equivalent to `saveStage`, except that dirty layers are serialized concurrently using the OpenUSD `Work` library, and a report
+//! describing each saved layer is returned. This is beneficial for stages composed of many layers (e.g. those produced via `createAssetPayload`,
+//! `addAssetLibrary`, and `addAssetContent`), particularly when saving to network storage.
+//!
+//! Like `UsdStage::Save`, anonymous layers and session layers are not saved.
+//!
+//! @param stage The stage to be saved.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
+//! @param comment The comment will be authored in all dirty layers as the `Sdf.Layer` comment.
+//! @returns A report for each layer that was saved, in the order the layers are used by the stage.
+USDEX_API std::vector<LayerSaveReport> saveStageWithReport(
+    pxr::UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata = std::nullopt,
+    std::optional<std::string_view> comment = std::nullopt
+);
+
+//! Save all dirty layers of the given `UsdStage` with metadata applied, serializing them on a background thread.
+//!
+//! This is equivalent to `saveStageWithReport`, except that the contents of each dirty layer are copied on the calling thread and the
+//! copies are written in the background. It is safe to continue editing the stage while the save is in flight, and those edits will not
+//! be reflected in the saved files.
+//!
+//! All async saves are written by a single background thread in the order they were requested (see `saveLayerAsync`), while the layers
+//! of a single stage are still serialized concurrently.
+//!
+//! @note Unlike `saveStage`, the layers remain dirty after the save has completed, as they may have been edited in the meantime.
+//!
+//! @param stage The stage to be saved.
+//! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+//!    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
+//! @param comment The comment will be authored in all dirty layers as the `Sdf.Layer` comment.
+//! @returns A future which becomes ready once the save has completed, indicating if all layers were saved successfully.
+USDEX_API std::future<bool> saveStageAsync(
+    pxr::UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata = std::nullopt,
+    std::optional<std::string_view> comment = std::nullopt
+);
+
+//! Compute the estimated in-memory and serialized size of the attribute data authored in each layer used by a `UsdStage`.
+//!
+//! This is equivalent to calling `computeLayerMemoryReport` for each layer used by the stage, including session, sublayer, reference, payload,
+//! and value clip layers, with the layers measured concurrently. See `computeLayerMemoryReport` for details.
+//!
+//! Arrays which share storage are identified within each layer, so storage shared between layers is counted once per layer.
+//!
+//! @param stage The stage to measure.
+//! @returns A report for each layer used by the stage, sorted by identifier. If the stage is invalid, a runtime error is posted and the result
+//!     is empty.
+USDEX_API std::vector<LayerMemoryReport> computeStageMemoryReport(pxr::UsdStagePtr stage);
+
 //! @}
 
 //! @defgroup stage_hierarchy UsdStage Hierarchy
@@ -190,6 +338,263 @@ USDEX_API bool isEditablePrimLocation(const pxr::UsdPrim& prim, const std::strin
 //! @returns True if the location is valid, or false otherwise.
 USDEX_API bool isEditablePrimLocation(const pxr::UsdPrim& prim, std::string* reason);
 
+//! Memoizes the ancestor checks of `isEditablePrimLocation` for a stage, for the lifetime of this object.
+//!
+//! Validating a location requires walking its ancestors to ensure none of them are instances or instance proxies. When many prims are defined
+//! below the same parent, the same walk is repeated for every child. While this scope is active for a stage, the verdict for each parent path is
+//! computed once and reused, so only the checks of the proposed location itself are performed per child.
+//!
+//! Cached verdicts are discarded whenever a `UsdNotice::ObjectsChanged` notice from the stage resyncs the parent path or any of its ancestors,
+//! so the results are identical whether or not the scope is active.
+//!
+//! Scopes apply to the calling thread only and may be nested. A `BulkAuthoringScope` also activates this scope for its stage.
+class USDEX_API EditablePrimLocationScope
+{
+
+public:
+
+    //! Enable the memoization of ancestor checks for the given stage on the calling thread.
+    //!
+    //! @param stage The stage on which prims will be defined
+    explicit EditablePrimLocationScope(pxr::UsdStagePtr stage);
+    ~EditablePrimLocationScope();
+
+    EditablePrimLocationScope(const EditablePrimLocationScope&) = delete;
+    EditablePrimLocationScope& operator=(const EditablePrimLocationScope&) = delete;
+
+    //! Whether an `EditablePrimLocationScope` is active for the given stage on the calling thread.
+    //!
+    //! @param stage The stage to consider
+    //!
+    //! @returns Whether ancestor checks are memoized.
+    static bool isActive(pxr::UsdStagePtr stage);
+
+private:
+
+    friend bool isEditablePrimLocation(const pxr::UsdStagePtr stage, const pxr::SdfPath& path, std::string* reason);
+
+    class EditablePrimLocationScopeImpl;
+    EditablePrimLocationScopeImpl* m_impl;
+};
+
+//! @}
+
+//! @defgroup bulk_authoring Bulk Authoring
+//!
+//! An opt-in authoring mode for write-only exporters that define many prims.
+//!
+//! By default the `define` functions author through `UsdPrim` and `UsdAttribute`, so every prim and every attribute results in a
+//! `UsdNotice::ObjectsChanged` notice and a recomposition check on the stage.
+//!
+//! While a `BulkAuthoringScope` is active for a stage, the gprim, basis curves, point cloud, light, and camera `define` functions instead write
+//! `SdfPrimSpec` and `SdfAttributeSpec` data directly to the current edit target layer of the stage. All specs for a single prim are written
+//! within one `SdfChangeBlock`, so the stage receives a single notice per `define` call and recomposes once, before the new prim is returned.
+//! The authored layer data is identical whether or not the scope is active.
+//!
+//! The `usdex::rtx` PBR and glass material `define` functions also support this mode, by copying the specs of a prototype material into place.
+//!
+//! @{
+
+//! Enables the Sdf level authoring mode of the `define` functions for a stage, for the lifetime of this object.
+//!
+//! Scopes apply to the calling thread only and may be nested. The define functions still validate their arguments and the prim location, and
+//! still return the composed prim, so the scope can be introduced around existing export code without other changes.
+//!
+//! Asset resolution on the calling thread is also cached while the scope is active (via `ArResolverScopedCache`), so that the textures shared by
+//! many materials and the layers referenced by many prims are each resolved once, which avoids repeated round trips to a remote resolver.
+//! Assets should not be created, moved, or removed while the scope is active, as the cached results would not reflect the change.
+//!
+//! @note Opinions are always written to the current edit target layer. If that layer is weaker than other opinions in the layer stack, any
+//!     computed values (e.g. extents) are based on the arguments rather than the composed values.
+class USDEX_API BulkAuthoringScope
+{
+
+public:
+
+    //! Enable the Sdf level authoring mode for the given stage on the calling thread.
+    //!
+    //! @param stage The stage on which prims will be defined
+    explicit BulkAuthoringScope(pxr::UsdStagePtr stage);
+    ~BulkAuthoringScope();
+
+    BulkAuthoringScope(const BulkAuthoringScope&) = delete;
+    BulkAuthoringScope& operator=(const BulkAuthoringScope&) = delete;
+
+    //! Whether a `BulkAuthoringScope` is active for the given stage on the calling thread.
+    //!
+    //! @param stage The stage to consider
+    //!
+    //! @returns Whether the Sdf level authoring mode is enabled.
+    static bool isActive(pxr::UsdStagePtr stage);
+
+private:
+
+    class BulkAuthoringScopeImpl;
+    BulkAuthoringScopeImpl* m_impl;
+};
+
+//! @}
+
+//! @defgroup unchanged_values Skipping Unchanged Values
+//!
+//! An opt-in authoring mode for live connectors that re-run the same authoring functions on existing prims.
+//!
+//! By default the authoring functions set every value they are given, even when the current edit target layer already holds an identical
+//! opinion. Re-running e.g. `definePolyMesh` on an unchanged mesh therefore resolves and re-authors every attribute spec, which may dirty the
+//! layer, send `UsdNotice::ObjectsChanged` notices, and force downstream consumers (e.g. Hydra) to resync the prim.
+//!
+//! While a `SkipUnchangedValuesScope` is active for a stage, the following functions compare each value with the opinion already authored on the
+//! current edit target layer, at the same time, and skip the write when they match:
+//!  - `definePolyMesh` and the gprim `define` functions (e.g. `defineCube`), including their primvars.
+//!  - `setLocalTransform`, in all of its forms.
+//!  - `definePreviewMaterial`.
+//!
+//! Array values are compared via `VtArray` equality, which returns immediately when both arrays share the same buffer (e.g. when the same
+//! arrays are authored again) and otherwise compares their contents. Values of differing types are never considered to match, even if
+//! `UsdAttribute::Set` would convert them. The authored layer data is identical whether or not the scope is active.
+//!
+//! @{
+
+//! Skips authoring values which are already authored on the current edit target layer of a stage, for the lifetime of this object.
+//!
+//! Scopes apply to the calling thread only and may be nested. Each comparison reads the existing opinion from the layer, so the scope should
+//! only be used when values are expected to be re-authored unchanged. It has no effect on a `BulkAuthoringScope`, whose writes are already
+//! batched into a single change per prim.
+class USDEX_API SkipUnchangedValuesScope
+{
+
+public:
+
+    //! Skip authoring unchanged values for the given stage on the calling thread.
+    //!
+    //! @param stage The stage on which values will be authored
+    explicit SkipUnchangedValuesScope(pxr::UsdStagePtr stage);
+    ~SkipUnchangedValuesScope();
+
+    SkipUnchangedValuesScope(const SkipUnchangedValuesScope&) = delete;
+    SkipUnchangedValuesScope& operator=(const SkipUnchangedValuesScope&) = delete;
+
+    //! Whether a `SkipUnchangedValuesScope` is active for the given stage on the calling thread.
+    //!
+    //! @param stage The stage to consider
+    //!
+    //! @returns Whether unchanged values are skipped.
+    static bool isActive(pxr::UsdStagePtr stage);
+
+private:
+
+    class SkipUnchangedValuesScopeImpl;
+    SkipUnchangedValuesScopeImpl* m_impl;
+};
+
+//! @}
+
+//! @defgroup stage_pool Stage Pooling
+//!
+//! Reusable, pre-configured stages for services which convert many small assets.
+//!
+//! Each call to `createStage` creates a new root layer and session layer, registers them with the layer registry, authors the stage metrics
+//! and default prim, and populates a new `UsdStage`. For long running converter services which process thousands of small assets, this setup
+//! is repeated for every asset even though it is identical each time.
+//!
+//! A `StagePool` instead holds a set of in-memory stages, configured once with the same metadata which `configureStage` authors, in a
+//! `UsdStageCache`. Each stage is reset to that configuration when it is released back to the pool, and the root layer of a stage is written
+//! to its final identifier via `StagePool::save`, so no layer is registered with that identifier:
+//!
+//!     usdex::core::StagePool pool("World", UsdGeomTokens->z, UsdGeomLinearUnits::meters, UsdPhysicsMassUnits::kilograms, s_authoringMetadata);
+//!     for (const Asset& asset : assets)
+//!     {
+//!         UsdStageRefPtr stage = pool.acquire();
+//!         convert(asset, stage);
+//!         pool.save(stage, asset.identifier);
+//!         pool.release(stage);
+//!     }
+//!
+//! @{
+
+//! A pool of reusable in-memory stages, which are configured with the same stage metrics, default prim, and authoring metadata.
+//!
+//! The pool is thread safe, so converters running on several threads may share a single pool, but each acquired stage must only be authored
+//! by one thread at a time.
+//!
+//! All stages created by the pool (both idle and acquired) are held by the `UsdStageCache` returned by `getCache()`, so they remain valid until
+//! they are released to a full pool or the pool is destroyed.
+class USDEX_API StagePool
+{
+
+public:
+
+    //! Create a pool of stages configured with the given metadata.
+    //!
+    //! The arguments are validated as in `configureStage`. If they are invalid, a warning is emitted and the pool is invalid.
+    //!
+    //! @param defaultPrimName Name of the default root prim.
+    //! @param upAxis The up axis for all the geometry contained in the stages.
+    //! @param linearUnits The meters per unit for all linear measurements in the stages, eg. `UsdGeomLinearUnits::meters`
+    //! @param massUnits The kilograms per unit for all mass measurements in the stages, eg. `UsdPhysicsMassUnits::kilograms`
+    //! @param authoringMetadata The provenance information from the host application. See @ref layers for details.
+    //! @param capacity The maximum number of idle stages retained by the pool. Stages released while the pool is full are discarded.
+    StagePool(
+        const std::string& defaultPrimName,
+        const pxr::TfToken& upAxis,
+        const double linearUnits,
+        const double massUnits,
+        const std::string& authoringMetadata,
+        size_t capacity = 8
+    );
+    ~StagePool();
+
+    StagePool(const StagePool&) = delete;
+    StagePool& operator=(const StagePool&) = delete;
+
+    //! Whether the pool was configured with valid arguments.
+    bool isValid() const;
+
+    //! Acquire a configured stage from the pool, creating a new stage if no idle stage is available.
+    //!
+    //! The root layer of the stage is anonymous and holds only the configured metadata and default prim, and the session layer is empty.
+    //!
+    //! @returns The stage, or a null pointer if the pool is invalid.
+    pxr::UsdStageRefPtr acquire();
+
+    //! Release a stage back to the pool, so that it can be acquired again.
+    //!
+    //! The content of the root layer is replaced with the configured metadata and default prim, the session layer is cleared, and the edit
+    //! target, load rules, population mask, and muted layers of the stage are reset. The stage must not be used after it has been released.
+    //!
+    //! @param stage The stage to release, which must have been acquired from this pool.
+    //! @returns Whether the stage was released. A runtime error is posted if the stage was not acquired from this pool or was already released.
+    bool release(pxr::UsdStagePtr stage);
+
+    //! Export the root layer of an acquired stage to its final identifier, with authoring metadata and an optional comment.
+    //!
+    //! This is equivalent to calling `exportLayer` on the root layer of the stage with the authoring metadata of the pool. Opinions authored on
+    //! the session layer, or on any other layers used by the stage, are not exported.
+    //!
+    //! @param stage The stage to save, which must have been acquired from this pool.
+    //! @param identifier The identifier to which the root layer is exported.
+    //! @param comment The comment will be authored in the exported layer as the `SdfLayer` comment.
+    //! @param writeOptions The options which control how the layer is encoded. A warning is emitted if the options are invalid for the identifier.
+    //! @returns A bool indicating if the export was successful.
+    bool save(
+        pxr::UsdStagePtr stage,
+        const std::string& identifier,
+        std::optional<std::string_view> comment = std::nullopt,
+        const LayerWriteOptions& writeOptions = LayerWriteOptions()
+    ) const;
+
+    //! The number of idle stages retained by the pool.
+    size_t getIdleCount() const;
+
+    //! The cache holding every stage created by the pool, which have not since been discarded.
+    const pxr::UsdStageCache& getCache() const;
+
+private:
+
+    class StagePoolImpl;
+    StagePoolImpl* m_impl;
+};
+
 //! @}
 
 } // namespace usdex::core
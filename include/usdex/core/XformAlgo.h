@@ -16,9 +16,11 @@
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/xform.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 
 #include <optional>
 #include <string>
+#include <vector>
 
 
 namespace usdex::core
@@ -51,6 +53,9 @@ namespace usdex::core
 //! - If the given format (or the value it holds) cannot be mapped to the existing `UsdGeomXformOps`, then new operations will be authored that can.
 //! - If no `UsdGeomXformOps` exist, then new ones matching the format will be authored.
 //!
+//! When the existing `UsdGeomXformOps` already match the format exactly, only their values are set. The xformOpOrder and any other properties
+//! are left untouched, so repeatedly setting the transform of a prim (e.g. while streaming interactive edits) has a constant cost.
+//!
 //! When a value is set at a given time, all existing time samples will be maintained, even in cases where the operations were changed.
 //!
 //! @{
@@ -178,6 +183,74 @@ USDEX_API bool setLocalTransform(
     pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
 );
 
+//! Set the local transforms of many prims from 4x4 matrices at many times.
+//!
+//! This is equivalent to calling `setLocalTransform` for each prim at each time, but is considerably faster for animation.
+//! The xformOps of each prim are resolved and authored once, using the first time, then the values for all remaining times are written
+//! directly to the current edit target layer within a single `SdfChangeBlock`.
+//!
+//! The matrices are ordered by prim and then by time, such that the matrix for `prims[i]` at `times[j]` is `matrices[i * times.size() + j]`.
+//!
+//! @param prims The prims to set local transforms on.
+//! @param matrices The matrix values to set.
+//! @param times Times at which to write the values.
+//! @returns True if the local transforms were set. Returns false without authoring if the arguments are mismatched or any prim is not xformable.
+USDEX_API bool setLocalTransforms(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::GfMatrix4d>& matrices,
+    const std::vector<pxr::UsdTimeCode>& times
+);
+
+//! Set the local transform of a prim from 4x4 matrices at many times.
+//!
+//! This is equivalent to calling `setLocalTransform` at each time, but the xformOps are resolved and authored only once.
+//!
+//! @param prim The prim to set local transforms on.
+//! @param matrices The matrix value to set at each time.
+//! @param times Times at which to write the values.
+//! @returns True if the local transforms were set.
+USDEX_API bool setLocalTransforms(pxr::UsdPrim prim, const std::vector<pxr::GfMatrix4d>& matrices, const std::vector<pxr::UsdTimeCode>& times);
+
+//! Set the local transforms of many prims from common transform components using quaternions for orientation at many times.
+//!
+//! This is equivalent to calling `setLocalTransform` for each prim at each time, but is considerably faster for animation.
+//! The xformOps of each prim are resolved and authored once, using the first time, then the values for all remaining times are written
+//! directly to the current edit target layer within a single `SdfChangeBlock`.
+//!
+//! The components are ordered by prim and then by time, such that the values for `prims[i]` at `times[j]` are at index `i * times.size() + j`.
+//!
+//! @param prims The prims to set local transforms on.
+//! @param translations The translation values to set.
+//! @param orientations The orientation values to set as quaternions.
+//! @param scales The scale values to set.
+//! @param times Times at which to write the values.
+//! @returns True if the local transforms were set. Returns false without authoring if the arguments are mismatched or any prim is not xformable.
+USDEX_API bool setLocalTransforms(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::GfVec3d>& translations,
+    const std::vector<pxr::GfQuatf>& orientations,
+    const std::vector<pxr::GfVec3f>& scales,
+    const std::vector<pxr::UsdTimeCode>& times
+);
+
+//! Set the local transform of a prim from common transform components using quaternions for orientation at many times.
+//!
+//! This is equivalent to calling `setLocalTransform` at each time, but the xformOps are resolved and authored only once.
+//!
+//! @param prim The prim to set local transforms on.
+//! @param translations The translation value to set at each time.
+//! @param orientations The orientation value to set at each time as a quaternion.
+//! @param scales The scale value to set at each time.
+//! @param times Times at which to write the values.
+//! @returns True if the local transforms were set.
+USDEX_API bool setLocalTransforms(
+    pxr::UsdPrim prim,
+    const std::vector<pxr::GfVec3d>& translations,
+    const std::vector<pxr::GfQuatf>& orientations,
+    const std::vector<pxr::GfVec3f>& scales,
+    const std::vector<pxr::UsdTimeCode>& times
+);
+
 //! Get the local transform of a prim at a given time.
 //!
 //! @param prim The prim to get local transform from.
@@ -185,6 +258,16 @@ USDEX_API bool setLocalTransform(
 //! @returns Transform value as a transform.
 USDEX_API pxr::GfTransform getLocalTransform(const pxr::UsdPrim& prim, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
 
+//! Get the local transform of a prim at the time of a cache.
+//!
+//! The local transformation is retrieved from `xformCache`, at the time of the cache, so that the `UsdGeomXformOps` of a prim are resolved once
+//! when its transform is queried repeatedly (e.g. at successive times via `UsdGeomXformCache::SetTime`).
+//!
+//! @param prim The prim to get local transform from.
+//! @param xformCache The cache from which to retrieve the local transformation.
+//! @returns Transform value as a transform.
+USDEX_API pxr::GfTransform getLocalTransform(const pxr::UsdPrim& prim, pxr::UsdGeomXformCache& xformCache);
+
 //! Get the local transform of an xformable at a given time.
 //!
 //! @param xformable The xformable to get local transform from.
@@ -199,6 +282,16 @@ USDEX_API pxr::GfTransform getLocalTransform(const pxr::UsdGeomXformable& xforma
 //! @returns Transform value as a 4x4 matrix.
 USDEX_API pxr::GfMatrix4d getLocalTransformMatrix(const pxr::UsdPrim& prim, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
 
+//! Get the local transform of a prim at the time of a cache in the form of a 4x4 matrix.
+//!
+//! The local transformation is retrieved from `xformCache`, at the time of the cache, so that the `UsdGeomXformOps` of a prim are resolved once
+//! when its transform is queried repeatedly (e.g. at successive times via `UsdGeomXformCache::SetTime`).
+//!
+//! @param prim The prim to get local transform from.
+//! @param xformCache The cache from which to retrieve the local transformation.
+//! @returns Transform value as a 4x4 matrix.
+USDEX_API pxr::GfMatrix4d getLocalTransformMatrix(const pxr::UsdPrim& prim, pxr::UsdGeomXformCache& xformCache);
+
 //! Get the local transform of an xformable at a given time in the form of a 4x4 matrix.
 //!
 //! @param xformable The xformable to get local transform from.
@@ -226,6 +319,29 @@ USDEX_API void getLocalTransformComponents(
     pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
 );
 
+//! Get the local transform of a prim at the time of a cache in the form of common transform components.
+//!
+//! Values authored on `UsdGeomXformCommonAPI` compatible ops are read directly. Otherwise the components are extracted from the local
+//! transformation, which is retrieved from `xformCache`.
+//!
+//! @param prim The prim to get local transform from.
+//! @param translation Translation result.
+//! @param pivot Pivot position result.
+//! @param rotation Rotation result in degrees.
+//! @param rotationOrder Rotation order the rotation result.
+//! @param scale Scale result.
+//! @param xformCache The cache from which to retrieve the local transformation.
+//! @returns `void`
+USDEX_API void getLocalTransformComponents(
+    const pxr::UsdPrim& prim,
+    pxr::GfVec3d& translation,
+    pxr::GfVec3d& pivot,
+    pxr::GfVec3f& rotation,
+    RotationOrder& rotationOrder,
+    pxr::GfVec3f& scale,
+    pxr::UsdGeomXformCache& xformCache
+);
+
 //! Get the local transform of an xformable at a given time in the form of common transform components.
 //!
 //! @param xformable The xformable to get local transform from.
@@ -264,6 +380,27 @@ USDEX_API void getLocalTransformComponentsQuat(
     pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
 );
 
+//! Get the local transform of a prim at the time of a cache in the form of common transform components with quaternion orientation.
+//!
+//! Values authored on the xformOps are read directly. If no orientation can be read, it is extracted from the local transformation, which is
+//! retrieved from `xformCache`.
+//!
+//! @param prim The prim to get local transform from.
+//! @param translation Translation result.
+//! @param pivot Pivot position result.
+//! @param orientation Orientation result as a quaternion.
+//! @param scale Scale result.
+//! @param xformCache The cache from which to retrieve the local transformation.
+//! @returns `void`
+USDEX_API void getLocalTransformComponentsQuat(
+    const pxr::UsdPrim& prim,
+    pxr::GfVec3d& translation,
+    pxr::GfVec3d& pivot,
+    pxr::GfQuatf& orientation,
+    pxr::GfVec3f& scale,
+    pxr::UsdGeomXformCache& xformCache
+);
+
 //! Get the local transform of an xformable at a given time in the form of common transform components with quaternion orientation.
 //!
 //! @param xformable The xformable to get local transform from.
@@ -282,6 +419,48 @@ USDEX_API void getLocalTransformComponentsQuat(
     pxr::UsdTimeCode time = pxr::UsdTimeCode::Default()
 );
 
+//! Decompose many 4x4 matrices into common transform components.
+//!
+//! This is equivalent to the decomposition performed by `getLocalTransformComponents` when the xformOps of a prim can not be mapped to common
+//! transform components, but is considerably faster for large arrays. Matrices composed of only a scale, a rotation, and a translation (i.e.
+//! without shear, perspective, or a reflection) are factored in closed form, while any other matrix is factored via `GfTransform`. Large arrays
+//! are decomposed across multiple threads.
+//!
+//! The rotations are always decomposed using the `RotationOrder::eXyz` rotation order, and the pivots are always zero.
+//!
+//! @param matrices The matrices to decompose.
+//! @param translations Translation results, resized to match the matrices.
+//! @param pivots Pivot position results, resized to match the matrices.
+//! @param rotations Rotation results in degrees, resized to match the matrices.
+//! @param scales Scale results, resized to match the matrices.
+//! @returns `void`
+USDEX_API void computeTransformComponents(
+    const std::vector<pxr::GfMatrix4d>& matrices,
+    std::vector<pxr::GfVec3d>& translations,
+    std::vector<pxr::GfVec3d>& pivots,
+    std::vector<pxr::GfVec3f>& rotations,
+    std::vector<pxr::GfVec3f>& scales
+);
+
+//! Decompose many 4x4 matrices into common transform components with quaternion orientation.
+//!
+//! This is equivalent to the decomposition performed by `getLocalTransformComponentsQuat`, but is considerably faster for large arrays. See
+//! `computeTransformComponents` for details.
+//!
+//! @param matrices The matrices to decompose.
+//! @param translations Translation results, resized to match the matrices.
+//! @param pivots Pivot position results, resized to match the matrices.
+//! @param orientations Orientation results as quaternions, resized to match the matrices.
+//! @param scales Scale results, resized to match the matrices.
+//! @returns `void`
+USDEX_API void computeTransformComponentsQuat(
+    const std::vector<pxr::GfMatrix4d>& matrices,
+    std::vector<pxr::GfVec3d>& translations,
+    std::vector<pxr::GfVec3d>& pivots,
+    std::vector<pxr::GfQuatf>& orientations,
+    std::vector<pxr::GfVec3f>& scales
+);
+
 //! @}
 
 //! @defgroup xform Xform Prims
@@ -39,9 +39,24 @@
 #define USDEX_BOOST_PYTHON_NAMESPACE boost::python
 #endif // PXR_USE_INTERNAL_BOOST_PYTHON
 
+#include <atomic>
+#include <string>
+#include <string_view>
+
 namespace pyboost11
 {
 
+// Import the OpenUSD python module which registers the boost.python conversions of a type, given the python name of the type.
+// e.g. `pxr.UsdGeom` for `pxr.UsdGeom.Mesh`. Names outside of the `pxr` package (e.g. `str`) are ignored.
+inline void importModule(std::string_view pyName)
+{
+    if (pyName.rfind("pxr.", 0) != 0)
+    {
+        return;
+    }
+    pybind11::module_::import(std::string(pyName.substr(0, pyName.rfind('.'))).c_str());
+}
+
 // Pybind11 cast by using boost.python.
 template <typename T> struct caster
 {
@@ -109,6 +124,7 @@ public:
         {
             return false;
         }
+        ensureModule();
         pyboost11::caster<type> ext(src);
         if (!ext.check())
         {
@@ -119,13 +135,29 @@ public:
     }
     static handle cast(type * src, return_value_policy /* policy */, handle /* parent */)
     {
+        ensureModule();
         return pyboost11::caster<type>::to_python(src);
     }
     static handle cast(type src, return_value_policy /* policy */, handle /* parent */)
     {
+        ensureModule();
         return pyboost11::caster<type>::to_python(src);
     }
 
+    // The OpenUSD python modules are not imported eagerly, so the module which defines the type is imported the first time the type is converted.
+    // This allows clients to call functions returning (e.g.) a `UsdGeom.Mesh`, or accepting a `Vt.IntArray` as a python list, without having
+    // imported the module themselves.
+    // The GIL is held during conversion, but an import may release it, so an atomic flag is used rather than a function local static.
+    static void ensureModule()
+    {
+        static std::atomic<bool> s_imported(false);
+        if (!s_imported.load(std::memory_order_acquire))
+        {
+            pyboost11::importModule(type_caster<type>::name.text);
+            s_imported.store(true, std::memory_order_release);
+        }
+    }
+
 };
 
 #define PYBOOST11_TYPE_CASTER(type, py_name) \
@@ -19,8 +19,10 @@
 #endif
 
 #include <pxr/base/gf/camera.h>
+#include <pxr/base/gf/range3d.h>
 #include <pxr/base/gf/transform.h>
 #include <pxr/base/tf/diagnosticBase.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/usd/sdf/assetPath.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
@@ -36,8 +38,11 @@
 #include <pxr/usd/usdGeom/cube.h>
 #include <pxr/usd/usdGeom/cylinder.h>
 #include <pxr/usd/usdGeom/cylinder_1.h>
+#include <pxr/usd/usdGeom/gprim.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/plane.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/pointBased.h>
 #include <pxr/usd/usdGeom/points.h>
 #include <pxr/usd/usdGeom/primvar.h>
 #include <pxr/usd/usdGeom/scope.h>
@@ -58,10 +63,142 @@
 #include <pxr/usd/usdShade/material.h>
 #include <pxr/usd/usdShade/shader.h>
 
+#include <cstring>
+
 
 namespace pybind11::detail
 {
 
+//! Describes the scalar layout of a numeric `VtArray` element, so that the array can be loaded from a buffer protocol object (e.g. a NumPy array)
+template <typename T>
+struct vtarray_buffer_traits
+{
+    static constexpr bool supported = false;
+};
+
+template <>
+struct vtarray_buffer_traits<float>
+{
+    static constexpr bool supported = true;
+    using scalar = float;
+    static constexpr ssize_t components = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<int>
+{
+    static constexpr bool supported = true;
+    using scalar = int;
+    static constexpr ssize_t components = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<int64_t>
+{
+    static constexpr bool supported = true;
+    using scalar = int64_t;
+    static constexpr ssize_t components = 1;
+};
+
+template <>
+struct vtarray_buffer_traits<pxr::GfVec2f>
+{
+    static constexpr bool supported = true;
+    using scalar = float;
+    static constexpr ssize_t components = 2;
+};
+
+template <>
+struct vtarray_buffer_traits<pxr::GfVec3f>
+{
+    static constexpr bool supported = true;
+    using scalar = float;
+    static constexpr ssize_t components = 3;
+};
+
+//! A caster for numeric `VtArray` types, which also accepts C-contiguous buffer protocol objects (e.g. NumPy arrays) of the matching scalar type.
+//!
+//! OpenUSD bound `Vt.Array` objects are consumed without copying, as with any other OpenUSD type. Buffers are validated for scalar type & shape
+//! (e.g. a `(N, 3)` array of `float32` for a `VtVec3fArray`) and copied into a new `VtArray` with a single `memcpy`, avoiding any per-element
+//! Python iteration. The buffer is copied rather than referenced, so that subsequent modification of the buffer can not affect authored data.
+template <typename type>
+struct pyboost11_vtarray_type_caster : public pyboost11_type_caster<type>
+{
+    using element = typename type::value_type;
+    using traits = vtarray_buffer_traits<element>;
+
+    bool load(handle src, bool convert)
+    {
+        if (!src)
+        {
+            return false;
+        }
+        this->ensureModule();
+
+        // OpenUSD bound arrays are consumed without copying. Other objects (e.g. python lists) defer to the OpenUSD from-python conversions,
+        // unless they provide a buffer that can be copied directly.
+        USDEX_BOOST_PYTHON_NAMESPACE::object obj(USDEX_BOOST_PYTHON_NAMESPACE::handle<>(USDEX_BOOST_PYTHON_NAMESPACE::borrowed(src.ptr())));
+        if (USDEX_BOOST_PYTHON_NAMESPACE::extract<type&>(obj).check() || !PyObject_CheckBuffer(src.ptr()) || !loadBuffer(src))
+        {
+            return pyboost11_type_caster<type>::load(src, convert);
+        }
+        return true;
+    }
+
+private:
+
+    bool loadBuffer(handle src)
+    {
+        buffer_info info;
+        try
+        {
+            info = reinterpret_borrow<buffer>(src).request();
+        }
+        catch (const error_already_set&)
+        {
+            return false;
+        }
+
+        // The scalar type must match exactly, as implicit numeric conversion would require a per-element copy
+        if (!compare_buffer_info<typename traits::scalar>::compare(info))
+        {
+            return false;
+        }
+
+        // The shape must be (N) for scalar elements and (N, components) for vector elements
+        const bool isVector = traits::components > 1;
+        if (info.ndim != (isVector ? 2 : 1) || (isVector && info.shape[1] != traits::components))
+        {
+            return false;
+        }
+
+        // Only C-contiguous buffers can be copied with a single memcpy
+        const ssize_t size = info.shape[0];
+        if (size > 1 && info.strides[0] != static_cast<ssize_t>(sizeof(element)))
+        {
+            return false;
+        }
+        if (isVector && info.strides[info.ndim - 1] != info.itemsize)
+        {
+            return false;
+        }
+
+        this->value = type(static_cast<size_t>(size));
+        if (size > 0)
+        {
+            std::memcpy(static_cast<void*>(this->value.data()), info.ptr, static_cast<size_t>(size) * sizeof(element));
+        }
+        return true;
+    }
+};
+
+#define PYBOOST11_VTARRAY_TYPE_CASTER(type, py_name)                                                                                                 \
+    template <>                                                                                                                                      \
+    struct type_caster<type> : public pyboost11_vtarray_type_caster<type>                                                                            \
+    {                                                                                                                                                \
+        static constexpr auto name = py_name;                                                                                                        \
+    }
+
 //! @defgroup pybind Python Interoperability for pybind11
 //!
 //! Provides pybind11 interoperability for OpenUSD's bound python objects.
@@ -72,6 +209,8 @@ namespace pybind11::detail
 //! We often need to pass the python objects in and out of c++ between a mix of bound functions.
 //! These casters enable pybind11 to consume & to produce OpenUSD bound objects.
 //!
+//! The numeric `VtArray` casters additionally consume C-contiguous buffer protocol objects (e.g. NumPy arrays) of the matching scalar type.
+//!
 //! @note We bind the minimal set of OpenUSD types required by the OpenUSD Exchange SDK public C++ API. Not all types are supported, though more
 //! will be added as needed by the public entry points.
 //!
@@ -93,6 +232,8 @@ PYBOOST11_TYPE_CASTER(pxr::GfVec3i, _("pxr.Gf.Vec3i"));
 PYBOOST11_TYPE_CASTER(pxr::GfMatrix4d, _("pxr.Gf.Matrix4d"));
 //! pybind11 interoperability for `GfTransform`
 PYBOOST11_TYPE_CASTER(pxr::GfTransform, _("pxr.Gf.Transform"));
+//! pybind11 interoperability for `GfRange3d`
+PYBOOST11_TYPE_CASTER(pxr::GfRange3d, _("pxr.Gf.Range3d"));
 //! pybind11 interoperability for `TfDiagnosticType`
 PYBOOST11_TYPE_CASTER(pxr::TfDiagnosticType, _("pxr.Tf.DiagnosticType"));
 //! pybind11 interoperability for `SdfAssetPath`
@@ -121,6 +262,8 @@ PYBOOST11_TYPE_CASTER(pxr::UsdGeomBasisCurves, _("pxr.UsdGeom.BasisCurves"));
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomCamera, _("pxr.UsdGeom.Camera"));
 //! pybind11 interoperability for `UsdGeomMesh`
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomMesh, _("pxr.UsdGeom.Mesh"));
+//! pybind11 interoperability for `UsdGeomPointBased`
+PYBOOST11_TYPE_CASTER(pxr::UsdGeomPointBased, _("pxr.UsdGeom.PointBased"));
 //! pybind11 interoperability for `UsdGeomPoints`
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomPoints, _("pxr.UsdGeom.Points"));
 //! pybind11 interoperability for `UsdGeomPrimvar`
@@ -157,19 +300,19 @@ PYBOOST11_TYPE_CASTER(pxr::UsdStagePtr, _("pxr.Usd.Stage"));
 //! pybind11 interoperability for `UsdTimeCode`
 PYBOOST11_TYPE_CASTER(pxr::UsdTimeCode, _("pxr.Usd.TimeCode"));
 //! pybind11 interoperability for `VtFloatArray`
-PYBOOST11_TYPE_CASTER(pxr::VtFloatArray, _("pxr.Vt.FloatArray"));
+PYBOOST11_VTARRAY_TYPE_CASTER(pxr::VtFloatArray, _("pxr.Vt.FloatArray"));
 //! pybind11 interoperability for `VtIntArray`
-PYBOOST11_TYPE_CASTER(pxr::VtIntArray, _("pxr.Vt.IntArray"));
+PYBOOST11_VTARRAY_TYPE_CASTER(pxr::VtIntArray, _("pxr.Vt.IntArray"));
 //! pybind11 interoperability for `VtInt64Array`
-PYBOOST11_TYPE_CASTER(pxr::VtInt64Array, _("pxr.Vt.Int64Array"));
+PYBOOST11_VTARRAY_TYPE_CASTER(pxr::VtInt64Array, _("pxr.Vt.Int64Array"));
 //! pybind11 interoperability for `VtStringArray`
 PYBOOST11_TYPE_CASTER(pxr::VtStringArray, _("pxr.Vt.StringArray"));
 //! pybind11 interoperability for `VtTokenArray`
 PYBOOST11_TYPE_CASTER(pxr::VtTokenArray, _("pxr.Vt.TokenArray"));
 //! pybind11 interoperability for `VtVec3fArray`
-PYBOOST11_TYPE_CASTER(pxr::VtVec3fArray, _("pxr.Vt.Vec3fArray"));
+PYBOOST11_VTARRAY_TYPE_CASTER(pxr::VtVec3fArray, _("pxr.Vt.Vec3fArray"));
 //! pybind11 interoperability for `VtVec2fArray`
-PYBOOST11_TYPE_CASTER(pxr::VtVec2fArray, _("pxr.Vt.Vec2fArray"));
+PYBOOST11_VTARRAY_TYPE_CASTER(pxr::VtVec2fArray, _("pxr.Vt.Vec2fArray"));
 //! pybind11 interoperability for `UsdShadeInput`
 PYBOOST11_TYPE_CASTER(pxr::UsdShadeInput, _("pxr.UsdShade.Input"));
 //! pybind11 interoperability for `UsdShadeMaterial`
@@ -204,6 +347,10 @@ PYBOOST11_TYPE_CASTER(pxr::UsdGeomCylinder_1, _("pxr.UsdGeom.Cylinder_1"));
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomCapsule, _("pxr.UsdGeom.Capsule"));
 //! pybind11 interoperability for `UsdGeomCapsule_1`
 PYBOOST11_TYPE_CASTER(pxr::UsdGeomCapsule_1, _("pxr.UsdGeom.Capsule_1"));
+//! pybind11 interoperability for `UsdGeomGprim`
+PYBOOST11_TYPE_CASTER(pxr::UsdGeomGprim, _("pxr.UsdGeom.Gprim"));
+//! pybind11 interoperability for `UsdGeomPointInstancer`
+PYBOOST11_TYPE_CASTER(pxr::UsdGeomPointInstancer, _("pxr.UsdGeom.PointInstancer"));
 //! @}
 
 } // namespace pybind11::detail
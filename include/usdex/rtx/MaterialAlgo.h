@@ -106,6 +106,10 @@ USDEX_RTX_API pxr::UsdShadeShader computeEffectiveMdlSurfaceShader(const pxr::Us
 //! @note The use of MDL shaders inside this Material interface is considered an implementation detail of the RTX Renderer.
 //! Once the RTX Renderer supports OpenPBR or MaterialX shaders we may change the implementation to author those shaders instead of MDL.
 //!
+//! @note While a `usdex::core::BulkAuthoringScope` is active for the stage, the specs of a prototype Material (authored once per process) are
+//! copied to the edit target layer via `SdfCopySpec`, and only the supplied values are authored. The resulting specs are identical. Prims which
+//! already have a spec on the edit target layer are always defined via the `UsdShade` API.
+//!
 //! @param stage The stage on which to define the Material
 //! @param path The absolute prim path at which to define the Material
 //! @param color The diffuse color of the Material
@@ -270,6 +274,169 @@ USDEX_RTX_API bool addEmissiveTextureToPbrMaterial(
     const float intensity = 1000.0f
 );
 
+//! The parameters of a PBR material, as authored by `definePbrMaterial()` and the `add*TextureToPbrMaterial()` functions.
+//!
+//! This is used to define PBR materials via a `usdex::core::MaterialRegistry`, which must know all of the parameters of a material (including
+//! its textures) before it is authored, in order to find an identical material which has already been defined.
+//!
+//! Textures with an empty asset path, and an unset emissive color, are not authored.
+class PbrMaterialParams
+{
+public:
+
+    //! The diffuse color of the Material
+    pxr::GfVec3f color = pxr::GfVec3f(0.18f);
+
+    //! The Opacity Amount to set, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible
+    float opacity = 1.0f;
+
+    //! The Roughness Amount to set, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy
+    float roughness = 0.5f;
+
+    //! The Metallic Amount to set, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic
+    float metallic = 0.0f;
+
+    //! The emissive color. See `addEmissiveColorToPbrMaterial()` for details.
+    std::optional<pxr::GfVec3f> emissiveColor;
+
+    //! The intensity of the emissive color or emissive texture
+    float emissiveIntensity = 1000.0f;
+
+    //! The diffuse texture. See `addDiffuseTextureToPbrMaterial()` for details.
+    pxr::SdfAssetPath diffuseTexture;
+
+    //! The normal texture. See `addNormalTextureToPbrMaterial()` for details.
+    pxr::SdfAssetPath normalTexture;
+
+    //! The ORM (occlusion, roughness, metallic) texture. See `addOrmTextureToPbrMaterial()` for details.
+    pxr::SdfAssetPath ormTexture;
+
+    //! The roughness texture. See `addRoughnessTextureToPbrMaterial()` for details.
+    pxr::SdfAssetPath roughnessTexture;
+
+    //! The metallic texture. See `addMetallicTextureToPbrMaterial()` for details.
+    pxr::SdfAssetPath metallicTexture;
+
+    //! The opacity texture. See `addOpacityTextureToPbrMaterial()` for details.
+    pxr::SdfAssetPath opacityTexture;
+
+    //! The emissive texture. See `addEmissiveTextureToPbrMaterial()` for details.
+    pxr::SdfAssetPath emissiveTexture;
+};
+
+//! Defines a fully textured PBR `UsdShadeMaterial` in a single call.
+//!
+//! The material is defined via `definePbrMaterial()`, and the emissive color and textures are then authored as by `addEmissiveColorToPbrMaterial()`
+//! and the `add*TextureToPbrMaterial()` functions, but the shaders of the new material are resolved & verified once, rather than once per
+//! texture. The emissive color is validated before the material is defined.
+//!
+//! The parameters can be supplied as a `PbrMaterialParams`, or collected via the chainable setters:
+//!
+//! @code{.cpp}
+//! usdex::rtx::PbrMaterialBuilder builder;
+//! builder.setColor(pxr::GfVec3f(1.0f)).setDiffuseTexture(diffusePath).setNormalTexture(normalPath).setOrmTexture(ormPath);
+//! pxr::UsdShadeMaterial material = builder.define(materialsScope, "Metal");
+//! @endcode
+//!
+//! The same builder can define any number of materials.
+class USDEX_RTX_API PbrMaterialBuilder
+{
+
+public:
+
+    //! Create a builder for an untextured PBR material with the default parameters of `PbrMaterialParams`.
+    PbrMaterialBuilder();
+
+    //! Create a builder from a complete set of parameters.
+    //!
+    //! @param params The parameters of the Material
+    explicit PbrMaterialBuilder(const PbrMaterialParams& params);
+
+    ~PbrMaterialBuilder();
+
+    PbrMaterialBuilder(const PbrMaterialBuilder&) = delete;
+    PbrMaterialBuilder& operator=(const PbrMaterialBuilder&) = delete;
+
+    //! Set the diffuse color of the Material.
+    PbrMaterialBuilder& setColor(const pxr::GfVec3f& color);
+
+    //! Set the Opacity Amount, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible.
+    PbrMaterialBuilder& setOpacity(float opacity);
+
+    //! Set the Roughness Amount, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy.
+    PbrMaterialBuilder& setRoughness(float roughness);
+
+    //! Set the Metallic Amount, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic.
+    PbrMaterialBuilder& setMetallic(float metallic);
+
+    //! Set the emissive color and its intensity. See `addEmissiveColorToPbrMaterial()` for details.
+    //!
+    //! The intensity is shared with the emissive texture. The last intensity supplied is used.
+    PbrMaterialBuilder& setEmissiveColor(const pxr::GfVec3f& color, float intensity = 1000.0f);
+
+    //! Set the diffuse texture. See `addDiffuseTextureToPbrMaterial()` for details.
+    PbrMaterialBuilder& setDiffuseTexture(const pxr::SdfAssetPath& texturePath);
+
+    //! Set the normal texture. See `addNormalTextureToPbrMaterial()` for details.
+    PbrMaterialBuilder& setNormalTexture(const pxr::SdfAssetPath& texturePath);
+
+    //! Set the ORM (occlusion, roughness, metallic) texture. See `addOrmTextureToPbrMaterial()` for details.
+    PbrMaterialBuilder& setOrmTexture(const pxr::SdfAssetPath& texturePath);
+
+    //! Set the roughness texture. See `addRoughnessTextureToPbrMaterial()` for details.
+    PbrMaterialBuilder& setRoughnessTexture(const pxr::SdfAssetPath& texturePath);
+
+    //! Set the metallic texture. See `addMetallicTextureToPbrMaterial()` for details.
+    PbrMaterialBuilder& setMetallicTexture(const pxr::SdfAssetPath& texturePath);
+
+    //! Set the opacity texture. See `addOpacityTextureToPbrMaterial()` for details.
+    PbrMaterialBuilder& setOpacityTexture(const pxr::SdfAssetPath& texturePath);
+
+    //! Set the emissive texture and its intensity. See `addEmissiveTextureToPbrMaterial()` for details.
+    //!
+    //! The intensity is shared with the emissive color. The last intensity supplied is used.
+    PbrMaterialBuilder& setEmissiveTexture(const pxr::SdfAssetPath& texturePath, float intensity = 1000.0f);
+
+    //! The parameters collected so far.
+    const PbrMaterialParams& getParams() const;
+
+    //! Define a PBR Material with the collected parameters.
+    //!
+    //! @param stage The stage on which to define the Material
+    //! @param path The absolute prim path at which to define the Material
+    //! @returns The newly defined UsdShadeMaterial. Returns an Invalid prim on error
+    pxr::UsdShadeMaterial define(pxr::UsdStagePtr stage, const pxr::SdfPath& path) const;
+
+    //! Define a PBR Material with the collected parameters.
+    //!
+    //! This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+    //!
+    //! @param parent Prim below which to define the Material
+    //! @param name Name of the Material
+    //! @returns The newly defined UsdShadeMaterial. Returns an Invalid prim on error
+    pxr::UsdShadeMaterial define(pxr::UsdPrim parent, const std::string& name) const;
+
+private:
+
+    class PbrMaterialBuilderImpl;
+    PbrMaterialBuilderImpl* m_impl;
+};
+
+//! Defines a PBR `UsdShadeMaterial` via a `usdex::core::MaterialRegistry`, or returns an identical PBR material which was defined previously.
+//!
+//! On a miss, the material is authored via a `PbrMaterialBuilder` below the parent prim of the registry. If this fails, nothing is registered.
+//! PBR materials are never confused with preview materials defined by the same registry.
+//!
+//! @param registry The registry used to find or define the Material
+//! @param name The name of the Material, if a new material must be defined
+//! @param params The parameters of the Material
+//! @returns The new or existing `UsdShadeMaterial`. Returns an Invalid prim on error
+USDEX_RTX_API pxr::UsdShadeMaterial definePbrMaterial(
+    usdex::core::MaterialRegistry& registry,
+    const std::string& name,
+    const PbrMaterialParams& params
+);
+
 //! Defines a Glass `UsdShadeMaterial` interface that drives both an RTX render context and the universal render context.
 //!
 //! The resulting Material prim will have "Interface" `UsdShadeInputs` which drive both render contexts. See @ref rtx_materials for details.
@@ -277,6 +444,10 @@ USDEX_RTX_API bool addEmissiveTextureToPbrMaterial(
 //! @note The use of MDL shaders inside this Material interface is considered an implementation detail of the RTX Renderer.
 //! Once the RTX Renderer supports OpenPBR or MaterialX shaders we may change the implementation to author those shaders instead of MDL.
 //!
+//! @note While a `usdex::core::BulkAuthoringScope` is active for the stage, the specs of a prototype Material (authored once per process) are
+//! copied to the edit target layer via `SdfCopySpec`, and only the supplied values are authored. The resulting specs are identical. Prims which
+//! already have a spec on the edit target layer are always defined via the `UsdShade` API.
+//!
 //! @param stage The stage on which to define the Material
 //! @param path The absolute prim path at which to define the Material
 //! @param color The color of the Material
@@ -71,7 +71,7 @@ group "core"
         dependson { "core_library" }
         usdex_build.use_cxxopts()
         usdex_build.use_doctest()
-        usdex_build.use_usd({"arch", "gf", "sdf", "tf", "usd", "usdGeom", "usdPhysics", "usdUtils", "vt"})
+        usdex_build.use_usd({"arch", "gf", "sdf", "tf", "usd", "usdGeom", "usdPhysics", "usdUtils", "vt", "work"})
         usdex_build.use_usdex_core()
         -- Select correct TBB/oneTBB library based on USD version
         local _useOneTbb = USD_VERSION >= "25.08"
@@ -84,10 +84,23 @@ group "core"
         filter { "system:linux", "configurations:debug" }
             links { "tbb_debug" } -- required by use of TfErrorMarks
         filter {}
+        -- The transcoding internals are compiled into the tests, as the library does not export them
+        includedirs { "source/core/library" }
         usdex_build.executable{
             name = "test_"..namespace,
             headers = { "source/core/tests/doctest/*.h" },
-            sources = { "source/core/tests/doctest/*.cpp" },
+            sources = { "source/core/tests/doctest/*.cpp", "source/core/library/Transcoding.cpp" },
+        }
+
+    project "core_benchmark_executable"
+        dependson { "core_library" }
+        usdex_build.use_cxxopts()
+        usdex_build.use_usd({"arch", "gf", "sdf", "tf", "usd", "usdGeom", "vt", "work"})
+        usdex_build.use_usdex_core()
+        usdex_build.executable{
+            name = "benchmark_"..namespace,
+            headers = { "source/core/tests/benchmark/*.h" },
+            sources = { "source/core/tests/benchmark/*.cpp" },
         }
 
 group "rtx"
@@ -5,14 +5,28 @@
 #include "usdex/core/AssetStructure.h"
 
 #include "usdex/core/LayerAlgo.h"
+#include "usdex/core/MeshAlgo.h"
 #include "usdex/core/NameAlgo.h"
 #include "usdex/core/StageAlgo.h"
+#include "usdex/core/XformAlgo.h"
+
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+#include "PrimSpecWriter.h"
+#include "ResolverCache.h"
 
 #include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/payload.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/reference.h>
+#include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/sdf/spec.h>
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/payloads.h>
@@ -25,7 +39,14 @@
 #include <pxr/usd/usdGeom/scope.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
+#include <cmath>
+#include <cstring>
 #include <filesystem>
+#include <optional>
+#include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace pxr;
 
@@ -38,6 +59,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     (Geometry)
     (Library)
     (Materials)
+    (Mesh)
     (Physics)
     (Textures)
     (Payload)
@@ -65,6 +87,14 @@ bool hasDescendantModelPrims(const UsdPrim& prim)
     return false;
 }
 
+// The state of a prim visited by configureAssemblyHierarchy, which is resolved once all of its descendants have been visited
+struct HierarchyFrame
+{
+    bool process; // Whether the prim is within the default traversal, and so may have its kind changed
+    bool hasAuthoredKind;
+    bool hasDescendantModels; // Whether any descendant has an authored model kind, prior to any changes
+};
+
 //! Compute the relative identifier from an anchor identifier to a source identifier
 //!
 //! This function computes a relative path from the anchor identifier to the source identifier.
@@ -145,7 +175,7 @@ UsdPrim createReferencePayloadPrim(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define reference/payload due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define reference/payload due to an invalid location: %s", reason.c_str());
         return UsdPrim();
     }
 
@@ -253,7 +283,12 @@ bool getReferencePayloadPrimPath(UsdPrim parent, UsdPrim source, std::optional<s
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, primName, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define reference/payload due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, primName),
+            eInvalidLocation,
+            "Unable to define reference/payload due to an invalid location: %s",
+            reason.c_str()
+        );
         return false;
     }
 
@@ -277,33 +312,23 @@ bool shouldAnchorSourceIdentifierToStage(const std::string& sourceIdentifier)
     return !std::filesystem::path(sourceIdentifier).is_absolute();
 }
 
-//! Resolve a `sourceIdentifier` (with optional `primPath`) into a `UsdPrim` by opening the source layer with
-//! `UsdStage::LoadNone`.
+//! Resolve a `sourceIdentifier` and open the source layer with `UsdStage::LoadNone`.
 //!
-//! Internal-vs-external detection, relative-path computation, and self-reference protection are deferred to the
-//! `UsdPrim`-based `defineReference`/`definePayload` overloads. When the source identifier already maps to a layer
-//! that is in memory (e.g., the caller's own stage), `SdfLayer::FindOrOpen` returns the cached layer, so the open
-//! is essentially free.
+//! When the source identifier already maps to a layer that is in memory (e.g., the caller's own stage), `SdfLayer::FindOrOpen` returns the
+//! cached layer, so the open is essentially free.
 //!
-//! @param stage Stage used to anchor filesystem-relative `sourceIdentifier` strings (via the root layer identifier).
+//! @param stage Stage used to anchor filesystem-relative `sourceIdentifier` strings (via the edit target layer identifier).
 //! @param sourceIdentifier The identifier of the source USD file
-//! @param primPath Optional prim path within the source. If not provided, the source's default prim is used.
-//! @param outOpenedStage Set to the opened source stage. The caller must keep this alive for the lifetime of the returned prim.
+//! @param outOpenedStage Set to the opened source stage.
 //! @param reason The reason for the failure
 //!
-//! @returns The resolved source prim, or an invalid prim on error (with a `TF_RUNTIME_ERROR` emitted).
-UsdPrim resolveSourcePrim(
-    UsdStagePtr stage,
-    const std::string& sourceIdentifier,
-    std::optional<SdfPath> primPath,
-    UsdStageRefPtr& outOpenedStage,
-    std::string& reason
-)
+//! @returns The resolved path of the source, or an empty path on error.
+ArResolvedPath resolveSourceStage(UsdStagePtr stage, const std::string& sourceIdentifier, UsdStageRefPtr& outOpenedStage, std::string& reason)
 {
     if (!stage)
     {
         reason = "Unable to define reference/payload due to an invalid stage";
-        return UsdPrim();
+        return ArResolvedPath();
     }
 
     // Resolve the source identifier; this also validates that the asset exists.
@@ -319,7 +344,7 @@ UsdPrim resolveSourcePrim(
                 "Unable to define reference/payload with a relative sourceIdentifier \"%s\" because the stage's current edit target layer is anonymous",
                 sourceIdentifier.c_str()
             );
-            return UsdPrim();
+            return ArResolvedPath();
         }
 
         ArResolvedPath anchorResolved = resolver.Resolve(stageLayer->GetIdentifier());
@@ -329,7 +354,7 @@ UsdPrim resolveSourcePrim(
                 "Unable to define reference/payload because the stage's current edit target layer identifier could not be resolved: %s",
                 stageLayer->GetIdentifier().c_str()
             );
-            return UsdPrim();
+            return ArResolvedPath();
         }
 
         const std::string identifier = resolver.CreateIdentifier(sourceIdentifier, anchorResolved);
@@ -343,21 +368,34 @@ UsdPrim resolveSourcePrim(
     if (!resolvedPath)
     {
         reason = TfStringPrintf("Unable to define reference/payload due to an invalid sourceIdentifier: %s", sourceIdentifier.c_str());
-        return UsdPrim();
+        return ArResolvedPath();
     }
 
     outOpenedStage = UsdStage::Open(resolvedPath, UsdStage::LoadNone);
     if (!outOpenedStage)
     {
         reason = TfStringPrintf("Unable to open the source identifier: %s", resolvedPath.GetPathString().c_str());
-        return UsdPrim();
+        return ArResolvedPath();
     }
 
+    return resolvedPath;
+}
+
+//! Get the source prim for a reference/payload from an opened source stage
+//!
+//! @param openedStage The opened source stage
+//! @param primPath Optional prim path within the source. If not provided, the source's default prim is used.
+//! @param resolvedPath The resolved path of the source, used to report errors
+//! @param reason The reason for the failure
+//!
+//! @returns The source prim, or an invalid prim on error.
+UsdPrim getSourcePrim(UsdStagePtr openedStage, const std::optional<SdfPath>& primPath, const ArResolvedPath& resolvedPath, std::string& reason)
+{
     // Look up the source prim at the requested path, or use the default prim.
     UsdPrim sourcePrim;
     if (primPath.has_value())
     {
-        sourcePrim = outOpenedStage->GetPrimAtPath(primPath.value());
+        sourcePrim = openedStage->GetPrimAtPath(primPath.value());
         if (!sourcePrim)
         {
             reason = TfStringPrintf(
@@ -370,7 +408,7 @@ UsdPrim resolveSourcePrim(
     }
     else
     {
-        sourcePrim = outOpenedStage->GetDefaultPrim();
+        sourcePrim = openedStage->GetDefaultPrim();
         if (!sourcePrim)
         {
             reason = TfStringPrintf("Unable to get the default prim from the source identifier: %s", resolvedPath.GetPathString().c_str());
@@ -380,15 +418,259 @@ UsdPrim resolveSourcePrim(
     return sourcePrim;
 }
 
+//! Resolve a `sourceIdentifier` (with optional `primPath`) into a `UsdPrim` by opening the source layer with
+//! `UsdStage::LoadNone`.
+//!
+//! Internal-vs-external detection, relative-path computation, and self-reference protection are deferred to the
+//! `UsdPrim`-based `defineReference`/`definePayload` overloads. When the source identifier already maps to a layer
+//! that is in memory (e.g., the caller's own stage), `SdfLayer::FindOrOpen` returns the cached layer, so the open
+//! is essentially free.
+//!
+//! @param stage Stage used to anchor filesystem-relative `sourceIdentifier` strings (via the root layer identifier).
+//! @param sourceIdentifier The identifier of the source USD file
+//! @param primPath Optional prim path within the source. If not provided, the source's default prim is used.
+//! @param outOpenedStage Set to the opened source stage. The caller must keep this alive for the lifetime of the returned prim.
+//! @param reason The reason for the failure
+//!
+//! @returns The resolved source prim, or an invalid prim on error (with a `TF_RUNTIME_ERROR` emitted).
+UsdPrim resolveSourcePrim(
+    UsdStagePtr stage,
+    const std::string& sourceIdentifier,
+    std::optional<SdfPath> primPath,
+    UsdStageRefPtr& outOpenedStage,
+    std::string& reason
+)
+{
+    const ArResolvedPath resolvedPath = ::resolveSourceStage(stage, sourceIdentifier, outOpenedStage, reason);
+    if (!resolvedPath)
+    {
+        return UsdPrim();
+    }
+    return ::getSourcePrim(outOpenedStage, primPath, resolvedPath, reason);
+}
+
+// The children of the default prim that are part of its interface. Variant sets are composition arcs, so their contents are always copied.
+bool isInterfaceChildren(const TfToken& childrenField)
+{
+    return childrenField == SdfChildrenKeys->VariantSetChildren;
+}
+
+// The fields of the default prim that are part of its interface. All metadata (including the composition arcs) is copied, while the ordering of
+// the children that are skipped is not.
+bool isInterfaceField(const TfToken& field)
+{
+    return field != SdfFieldKeys->PrimOrder && field != SdfFieldKeys->PropertyOrder;
+}
+
+// Remove the properties and descendants of a prim spec, leaving its metadata and variant sets in place
+void removeContents(const SdfPrimSpecHandle& primSpec)
+{
+    SdfChangeBlock changeBlock;
+    for (const SdfPrimSpecHandle& child : primSpec->GetNameChildren().values())
+    {
+        primSpec->RemoveNameChild(child);
+    }
+    for (const SdfPropertySpecHandle& property : primSpec->GetProperties().values())
+    {
+        primSpec->RemoveProperty(property);
+    }
+}
+
+// The resolved state of a distinct source identifier, shared by all of the references/payloads to it within a batch
+struct ResolvedSource
+{
+    UsdStageRefPtr stage;
+    ArResolvedPath resolvedPath;
+    bool isInternal = false;
+    std::string relativeIdentifier;
+    std::string reason;
+};
+
+// Add a reference/payload to the back of the prepended items of a prim spec, matching UsdReferences::AddReference and UsdPayloads::AddPayload
+template <typename Arc>
+void addArc(const SdfPrimSpecHandle& primSpec, const Arc& arc)
+{
+    auto listEditor = [&primSpec]()
+    {
+        if constexpr (std::is_same_v<Arc, SdfReference>)
+        {
+            return primSpec->GetReferenceList();
+        }
+        else
+        {
+            return primSpec->GetPayloadList();
+        }
+    }();
+
+    if (listEditor.ContainsItemEdit(arc, true))
+    {
+        return;
+    }
+
+    if (listEditor.IsExplicit())
+    {
+        listEditor.GetExplicitItems().push_back(arc);
+    }
+    else
+    {
+        listEditor.GetPrependedItems().push_back(arc);
+    }
+}
+
+// Common implementation for defineReferences and definePayloads
+template <typename Arc>
+std::vector<UsdPrim> defineArcs(UsdStagePtr stage, const std::vector<usdex::core::ReferencePayloadData>& arcs, const char* arcName)
+{
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to define %ss due to an invalid stage", arcName);
+        return {};
+    }
+
+    if (arcs.empty())
+    {
+        return {};
+    }
+
+    // Opening each source to validate its arcs resolves the same layers (e.g. the sublayers shared by the sources) many times
+    usdex::core::detail::ResolverCacheScope resolverCache;
+
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    if (!layer)
+    {
+        TF_RUNTIME_ERROR("Unable to define %ss due to an invalid edit target", arcName);
+        return {};
+    }
+
+    if (layer->IsAnonymous())
+    {
+        TF_RUNTIME_ERROR("Unable to define %ss due to an anonymous referencing stage", arcName);
+        return {};
+    }
+
+    ArResolver& resolver = ArGetResolver();
+    ArResolvedPath stageResolvedPath = resolver.Resolve(layer->GetIdentifier());
+    if (!stageResolvedPath)
+    {
+        TF_RUNTIME_ERROR("Unable to define %ss due to an invalid stage layer identifier: %s", arcName, layer->GetIdentifier().c_str());
+        return {};
+    }
+    const std::string stageNormPath = ArchNormPath(stageResolvedPath.GetPathString());
+
+    // Resolve each distinct source identifier once, then look up the source prim of every arc
+    std::unordered_map<std::string, ::ResolvedSource> sources;
+    std::vector<const ::ResolvedSource*> arcSources(arcs.size(), nullptr);
+    std::vector<UsdPrim> sourcePrims(arcs.size());
+    SdfPathVector arcPaths(arcs.size());
+    std::vector<std::string> errors(arcs.size());
+    for (size_t i = 0; i < arcs.size(); ++i)
+    {
+        const usdex::core::ReferencePayloadData& arc = arcs[i];
+        arcPaths[i] = arc.path;
+
+        auto [it, inserted] = sources.try_emplace(arc.sourceIdentifier);
+        ::ResolvedSource& source = it->second;
+        if (inserted)
+        {
+            source.resolvedPath = ::resolveSourceStage(stage, arc.sourceIdentifier, source.stage, source.reason);
+            if (source.resolvedPath)
+            {
+                // Normalize paths with ArchNormPath so comparisons on Windows ignore drive-letter case differences.
+                source.isInternal = ArchNormPath(source.resolvedPath.GetPathString()) == stageNormPath;
+                if (!source.isInternal)
+                {
+                    source.relativeIdentifier = ::getRelativeIdentifier(source.resolvedPath.GetPathString(), stageResolvedPath.GetPathString());
+                }
+            }
+        }
+
+        if (!source.resolvedPath)
+        {
+            errors[i] = source.reason;
+            continue;
+        }
+
+        sourcePrims[i] = ::getSourcePrim(source.stage, arc.primPath, source.resolvedPath, errors[i]);
+        if (!sourcePrims[i])
+        {
+            continue;
+        }
+
+        if (source.isInternal && arc.path == sourcePrims[i].GetPath())
+        {
+            errors[i] = TfStringPrintf("Unable to define %s pointing to itself: \"%s\"", arcName, arc.path.GetAsString().c_str());
+            continue;
+        }
+
+        arcSources[i] = &source;
+    }
+
+    // Early out if any of the arcs are invalid, or are requested more than once. The location errors take precedence over those of the sources.
+    std::unordered_set<SdfPath, SdfPath::Hash> paths;
+    if (!usdex::core::detail::validateBatchLocations(TF_CALL_CONTEXT, stage, arcPaths, arcName, &paths, &errors))
+    {
+        return {};
+    }
+
+    // Author all of the arcs directly in the edit target layer, so that change processing occurs once for the entire batch
+    {
+        SdfChangeBlock changeBlock;
+
+        usdex::core::detail::defineUndefinedAncestors(stage, paths);
+
+        for (size_t i = 0; i < arcs.size(); ++i)
+        {
+            SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(layer, editTarget.MapToSpecPath(arcs[i].path));
+            if (!primSpec)
+            {
+                TF_RUNTIME_ERROR("Unable to define %s at \"%s\"", arcName, arcs[i].path.GetAsString().c_str());
+                continue;
+            }
+
+            // Set the specifier and type name from the source
+            const UsdPrim& sourcePrim = sourcePrims[i];
+            primSpec->SetSpecifier(sourcePrim.GetSpecifier());
+            primSpec->SetTypeName(sourcePrim.GetTypeName().GetString());
+
+            // Add the arc with relative path. Internal arcs are mapped to the namespace of the edit target, matching UsdReferences.
+            const ::ResolvedSource& source = *arcSources[i];
+            if (source.isInternal)
+            {
+                ::addArc(primSpec, Arc(std::string(), editTarget.MapToSpecPath(sourcePrim.GetPath()).StripAllVariantSelections()));
+            }
+            else if (sourcePrim.GetPath() == source.stage->GetDefaultPrim().GetPath())
+            {
+                ::addArc(primSpec, Arc(source.relativeIdentifier));
+            }
+            else
+            {
+                ::addArc(primSpec, Arc(source.relativeIdentifier, sourcePrim.GetPath()));
+            }
+        }
+    }
+
+    // The change block has closed, so the stage has recomposed the new prims
+    std::vector<UsdPrim> result;
+    result.reserve(arcs.size());
+    for (const usdex::core::ReferencePayloadData& arc : arcs)
+    {
+        result.push_back(stage->GetPrimAtPath(arc.path));
+    }
+    return result;
+}
+
 } // namespace
 
 UsdGeomScope usdex::core::defineScope(UsdStagePtr stage, const SdfPath& path)
 {
+    USDEX_INSTRUMENT_SCOPE("defineScope");
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomScope due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomScope due to an invalid location: %s", reason.c_str());
         return UsdGeomScope();
     }
 
@@ -414,7 +696,12 @@ UsdGeomScope usdex::core::defineScope(UsdPrim parent, const std::string& name)
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomScope due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomScope due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomScope();
     }
 
@@ -475,10 +762,132 @@ const TfToken& usdex::core::getTexturesToken()
     return _tokens->Textures;
 }
 
+bool usdex::core::copyDefaultPrimSpec(UsdStagePtr source, UsdStagePtr target, AssetCopyPolicy copyPolicy)
+{
+    USDEX_INSTRUMENT_SCOPE("copyDefaultPrimSpec");
+
+    if (!source)
+    {
+        TF_WARN("Unable to copy default prim spec due to an invalid source stage");
+        return false;
+    }
+
+    if (!target)
+    {
+        TF_WARN("Unable to copy default prim spec due to an invalid target stage");
+        return false;
+    }
+
+    const SdfLayerHandle sourceLayer = source->GetRootLayer();
+    const SdfLayerHandle targetLayer = target->GetRootLayer();
+    const TfToken& srcName = sourceLayer->GetDefaultPrim();
+    const TfToken& dstName = targetLayer->GetDefaultPrim();
+    const SdfPath srcRootPath = srcName.IsEmpty() ? SdfPath() : SdfPath::AbsoluteRootPath().AppendChild(srcName);
+    const SdfPath dstRootPath = dstName.IsEmpty() ? SdfPath() : SdfPath::AbsoluteRootPath().AppendChild(dstName);
+
+    SdfPrimSpecHandle srcSpec = srcRootPath.IsEmpty() ? SdfPrimSpecHandle() : sourceLayer->GetPrimAtPath(srcRootPath);
+    if (!srcSpec)
+    {
+        TF_WARN("Unable to copy default prim spec due to an invalid source default prim");
+        return false;
+    }
+
+    if (dstRootPath.IsEmpty())
+    {
+        TF_WARN("Unable to copy default prim spec due to an invalid target default prim");
+        return false;
+    }
+
+    // Copying a spec onto itself is a no-op, and must not remove the contents of the source
+    if (sourceLayer == targetLayer && srcRootPath == dstRootPath)
+    {
+        return true;
+    }
+
+    if (copyPolicy != AssetCopyPolicy::eInterface)
+    {
+        if (!SdfCopySpec(sourceLayer, srcRootPath, targetLayer, dstRootPath))
+        {
+            return false;
+        }
+
+        if (copyPolicy == AssetCopyPolicy::eMove)
+        {
+            ::removeContents(srcSpec);
+        }
+        return true;
+    }
+
+    // Filter the fields and children of the default prim itself. Everything within the variant sets is copied as normal.
+    auto shouldCopyValue = [&srcRootPath, &dstRootPath](
+                               SdfSpecType specType,
+                               const TfToken& field,
+                               const SdfLayerHandle& srcLayer,
+                               const SdfPath& srcPath,
+                               bool fieldInSrc,
+                               const SdfLayerHandle& dstLayer,
+                               const SdfPath& dstPath,
+                               bool fieldInDst,
+                               std::optional<VtValue>* valueToCopy
+                           )
+    {
+        if (srcPath == srcRootPath && !::isInterfaceField(field))
+        {
+            return false;
+        }
+        return SdfShouldCopyValue(
+            srcRootPath,
+            dstRootPath,
+            specType,
+            field,
+            srcLayer,
+            srcPath,
+            fieldInSrc,
+            dstLayer,
+            dstPath,
+            fieldInDst,
+            valueToCopy
+        );
+    };
+    auto shouldCopyChildren = [&srcRootPath, &dstRootPath](
+                                  const TfToken& childrenField,
+                                  const SdfLayerHandle& srcLayer,
+                                  const SdfPath& srcPath,
+                                  bool fieldInSrc,
+                                  const SdfLayerHandle& dstLayer,
+                                  const SdfPath& dstPath,
+                                  bool fieldInDst,
+                                  std::optional<VtValue>* srcChildren,
+                                  std::optional<VtValue>* dstChildren
+                              )
+    {
+        if (srcPath == srcRootPath && !::isInterfaceChildren(childrenField))
+        {
+            return false;
+        }
+        return SdfShouldCopyChildren(
+            srcRootPath,
+            dstRootPath,
+            childrenField,
+            srcLayer,
+            srcPath,
+            fieldInSrc,
+            dstLayer,
+            dstPath,
+            fieldInDst,
+            srcChildren,
+            dstChildren
+        );
+    };
+
+    return SdfCopySpec(sourceLayer, srcRootPath, targetLayer, dstRootPath, shouldCopyValue, shouldCopyChildren);
+}
+
 UsdStageRefPtr usdex::core::createAssetPayload(
     pxr::UsdStagePtr stage,
     const std::string& format,
-    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs
+    const pxr::SdfLayer::FileFormatArguments& fileFormatArgs,
+    AssetCopyPolicy copyPolicy
 )
 {
     if (!stage)
@@ -517,12 +926,7 @@ UsdStageRefPtr usdex::core::createAssetPayload(
     }
 
     // Copy the asset stage's default prim to the asset payload stage
-    bool success = SdfCopySpec(
-        stage->GetRootLayer(),
-        stage->GetDefaultPrim().GetPath(),
-        payloadStage->GetRootLayer(),
-        payloadStage->GetDefaultPrim().GetPath()
-    );
+    bool success = usdex::core::copyDefaultPrimSpec(stage, payloadStage, copyPolicy);
     if (!success)
     {
         TF_WARN("Unable to copy the asset stage's default prim to the asset payload stage");
@@ -582,6 +986,241 @@ UsdStageRefPtr usdex::core::addAssetLibrary(
     return libraryStage;
 }
 
+class usdex::core::MeshLibrary::MeshLibraryImpl
+{
+
+public:
+
+    MeshLibraryImpl(UsdStagePtr library, float tolerance) : m_library(library), m_tolerance(tolerance), m_instanceCount(0)
+    {
+        if (tolerance > 0.0f)
+        {
+            m_pointsKey.emplace(tolerance);
+        }
+    }
+
+    bool isValid() const
+    {
+        return m_library && m_library->GetDefaultPrim() && std::isfinite(m_tolerance) && m_tolerance >= 0.0f;
+    }
+
+    UsdPrim defineMesh(
+        UsdStagePtr stage,
+        const SdfPath& path,
+        const VtIntArray& faceVertexCounts,
+        const VtIntArray& faceVertexIndices,
+        const VtVec3fArray& points,
+        const std::optional<const usdex::core::Vec3fPrimvarData>& normals,
+        const std::optional<const usdex::core::Vec2fPrimvarData>& uvs,
+        const std::optional<const usdex::core::Vec3fPrimvarData>& displayColor,
+        const std::optional<const usdex::core::FloatPrimvarData>& displayOpacity
+    )
+    {
+        if (!isValid())
+        {
+            TF_RUNTIME_ERROR("Unable to define mesh instance at \"%s\" due to an invalid MeshLibrary", path.GetAsString().c_str());
+            return UsdPrim();
+        }
+
+        // Check the instance location before authoring anything to the library
+        std::string reason;
+        if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+        {
+            USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define mesh instance due to an invalid location: %s", reason.c_str());
+            return UsdPrim();
+        }
+
+        // Find an identical mesh in the library
+        Entry candidate{ SdfPath(), faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity };
+        const size_t hash = computeHash(candidate);
+        UsdPrim source;
+        const auto range = m_entries.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (isEqual(it->second, candidate))
+            {
+                source = m_library->GetPrimAtPath(it->second.path);
+                break;
+            }
+        }
+
+        // Otherwise author the mesh into the library, named after this instance
+        if (!source)
+        {
+            const UsdPrim root = m_library->GetDefaultPrim();
+            const SdfPath entryPath = root.GetPath().AppendChild(usdex::core::getValidChildName(root, path.GetName()));
+
+            // The mesh is defined (and validated) first, so that nothing is authored to the library if the mesh data is invalid
+            UsdGeomMesh mesh = usdex::core::definePolyMesh(
+                m_library,
+                entryPath.AppendChild(_tokens->Mesh),
+                faceVertexCounts,
+                faceVertexIndices,
+                points,
+                normals,
+                uvs,
+                displayColor,
+                displayOpacity
+            );
+            if (!mesh)
+            {
+                return UsdPrim();
+            }
+
+            UsdGeomXform xform = usdex::core::defineXform(m_library->GetPrimAtPath(entryPath));
+            if (!xform)
+            {
+                return UsdPrim();
+            }
+
+            source = xform.GetPrim();
+            candidate.path = entryPath;
+            m_entries.emplace(hash, std::move(candidate));
+        }
+
+        UsdPrim prim = usdex::core::defineReference(stage, path, source);
+        if (!prim)
+        {
+            return UsdPrim();
+        }
+
+        prim.SetInstanceable(true);
+        ++m_instanceCount;
+        return prim;
+    }
+
+    size_t getMeshCount() const
+    {
+        return m_entries.size();
+    }
+
+    size_t getInstanceCount() const
+    {
+        return m_instanceCount;
+    }
+
+private:
+
+    struct Entry
+    {
+        SdfPath path;
+        VtIntArray faceVertexCounts;
+        VtIntArray faceVertexIndices;
+        VtVec3fArray points;
+        std::optional<const usdex::core::Vec3fPrimvarData> normals;
+        std::optional<const usdex::core::Vec2fPrimvarData> uvs;
+        std::optional<const usdex::core::Vec3fPrimvarData> displayColor;
+        std::optional<const usdex::core::FloatPrimvarData> displayOpacity;
+    };
+
+    template <typename T>
+    static size_t hashPrimvar(const std::optional<const usdex::core::PrimvarData<T>>& primvar)
+    {
+        if (!primvar.has_value())
+        {
+            return 0;
+        }
+        return TfHash::Combine(primvar->interpolation(), primvar->elementSize(), primvar->values(), primvar->indices());
+    }
+
+    size_t computeHash(const Entry& entry) const
+    {
+        size_t result = TfHash::Combine(entry.faceVertexCounts, entry.faceVertexIndices, entry.points.size());
+        for (const GfVec3f& point : entry.points)
+        {
+            result = TfHash::Combine(result, m_pointsKey.has_value() ? m_pointsKey->hash(point) : TfHash()(point));
+        }
+        return TfHash::Combine(
+            result,
+            hashPrimvar(entry.normals),
+            hashPrimvar(entry.uvs),
+            hashPrimvar(entry.displayColor),
+            hashPrimvar(entry.displayOpacity)
+        );
+    }
+
+    bool isEqual(const Entry& a, const Entry& b) const
+    {
+        if (a.faceVertexCounts != b.faceVertexCounts || a.faceVertexIndices != b.faceVertexIndices || a.points.size() != b.points.size())
+        {
+            return false;
+        }
+
+        if (a.normals != b.normals || a.uvs != b.uvs || a.displayColor != b.displayColor || a.displayOpacity != b.displayOpacity)
+        {
+            return false;
+        }
+
+        if (!m_pointsKey.has_value())
+        {
+            return std::memcmp(a.points.cdata(), b.points.cdata(), a.points.size() * sizeof(GfVec3f)) == 0;
+        }
+
+        for (size_t i = 0; i < a.points.size(); ++i)
+        {
+            if (!m_pointsKey->equal(a.points[i], b.points[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    UsdStagePtr m_library;
+    float m_tolerance;
+    std::optional<usdex::core::detail::QuantizedIndexKey<GfVec3f>> m_pointsKey;
+    std::unordered_multimap<size_t, Entry> m_entries;
+    size_t m_instanceCount;
+};
+
+usdex::core::MeshLibrary::MeshLibrary(UsdStagePtr library, float tolerance) : m_impl(new MeshLibraryImpl(library, tolerance))
+{
+    if (!m_impl->isValid())
+    {
+        TF_RUNTIME_ERROR("Unable to create MeshLibrary due to an invalid library stage or tolerance");
+    }
+}
+
+usdex::core::MeshLibrary::~MeshLibrary()
+{
+    delete m_impl;
+}
+
+bool usdex::core::MeshLibrary::isValid() const
+{
+    return m_impl->isValid();
+}
+
+UsdPrim usdex::core::MeshLibrary::defineMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    USDEX_INSTRUMENT_SCOPE("MeshLibrary::defineMesh");
+    USDEX_INSTRUMENT_ARRAY(faceVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(faceVertexIndices);
+    USDEX_INSTRUMENT_ARRAY(points);
+
+    return m_impl->defineMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity);
+}
+
+size_t usdex::core::MeshLibrary::getMeshCount() const
+{
+    return m_impl->getMeshCount();
+}
+
+size_t usdex::core::MeshLibrary::getInstanceCount() const
+{
+    return m_impl->getInstanceCount();
+}
+
 UsdStageRefPtr usdex::core::addAssetContent(
     UsdStagePtr stage,
     const std::string& name,
@@ -661,7 +1300,7 @@ UsdStageRefPtr usdex::core::addAssetContent(
     return contentStage;
 }
 
-bool usdex::core::addAssetInterface(UsdStagePtr stage, const UsdStagePtr source)
+bool usdex::core::addAssetInterface(UsdStagePtr stage, const UsdStagePtr source, AssetCopyPolicy copyPolicy)
 {
     if (!stage)
     {
@@ -694,7 +1333,7 @@ bool usdex::core::addAssetInterface(UsdStagePtr stage, const UsdStagePtr source)
         UsdGeomGetStageMetersPerUnit(source),
         usdex::core::getLayerAuthoringMetadata(source->GetRootLayer())
     );
-    bool success = SdfCopySpec(source->GetRootLayer(), source->GetDefaultPrim().GetPath(), stage->GetRootLayer(), stage->GetDefaultPrim().GetPath());
+    bool success = usdex::core::copyDefaultPrimSpec(source, stage, copyPolicy);
     if (!success)
     {
         TF_WARN("Unable to copy the source stage's default prim to the stage");
@@ -739,14 +1378,151 @@ bool usdex::core::addAssetInterface(UsdStagePtr stage, const UsdStagePtr source)
     return true;
 }
 
+UsdStageRefPtr usdex::core::createAssetContentStage(UsdStagePtr stage, const std::string& name, bool createScope)
+{
+    if (!stage)
+    {
+        TF_WARN("Unable to create asset content stage due to an invalid asset stage");
+        return nullptr;
+    }
+
+    UsdPrim defaultPrim = stage->GetDefaultPrim();
+    if (!defaultPrim)
+    {
+        TF_WARN("Unable to create asset content stage due to an invalid default prim");
+        return nullptr;
+    }
+
+    UsdStageRefPtr contentStage = UsdStage::CreateInMemory();
+    bool success = usdex::core::configureStage(
+        contentStage,
+        defaultPrim.GetName(),
+        UsdGeomGetStageUpAxis(stage),
+        UsdGeomGetStageMetersPerUnit(stage),
+        usdex::core::getLayerAuthoringMetadata(stage->GetRootLayer())
+    );
+    if (!success)
+    {
+        TF_WARN("Unable to configure the asset content stage");
+        return nullptr;
+    }
+
+    success = SdfCopySpec(stage->GetRootLayer(), defaultPrim.GetPath(), contentStage->GetRootLayer(), contentStage->GetDefaultPrim().GetPath());
+    if (!success)
+    {
+        TF_WARN("Unable to copy the asset stage's default prim to the asset content stage");
+        return nullptr;
+    }
+
+    if (createScope)
+    {
+        UsdGeomScope scope = usdex::core::defineScope(contentStage->GetDefaultPrim(), name);
+        if (!scope)
+        {
+            TF_WARN("Unable to create a scope in the asset content stage");
+            return nullptr;
+        }
+    }
+
+    return contentStage;
+}
+
+bool usdex::core::assembleAsset(
+    UsdStagePtr stage,
+    const std::vector<std::pair<std::string, UsdStagePtr>>& contents,
+    const std::string& format,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    USDEX_INSTRUMENT_SCOPE("assembleAsset");
+
+    // Validate all of the content before authoring anything to disk
+    std::set<std::string> names;
+    for (const auto& [name, contentStage] : contents)
+    {
+        if (!contentStage)
+        {
+            TF_WARN("Unable to assemble asset due to an invalid content stage for \"%s\"", name.c_str());
+            return false;
+        }
+
+        if (!names.insert(name).second)
+        {
+            TF_WARN("Unable to assemble asset due to a duplicate content name \"%s\"", name.c_str());
+            return false;
+        }
+    }
+
+    UsdStageRefPtr payloadStage = usdex::core::createAssetPayload(stage, format, fileFormatArgs);
+    if (!payloadStage)
+    {
+        return false;
+    }
+
+    // Each Content Layer is independent, so they are transferred and saved concurrently
+    ArResolver& resolver = ArGetResolver();
+    const std::string payloadPath = resolver.Resolve(payloadStage->GetRootLayer()->GetIdentifier());
+    std::vector<std::string> relativeIdentifiers(contents.size());
+    std::vector<SdfLayerRefPtr> layers(contents.size());
+    WorkParallelForN(
+        contents.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                relativeIdentifiers[i] = TfStringPrintf("./%s.%s", contents[i].first.c_str(), format.c_str());
+                SdfLayerRefPtr layer = SdfLayer::CreateNew(resolver.CreateIdentifier(relativeIdentifiers[i], payloadPath), fileFormatArgs);
+                if (!layer)
+                {
+                    continue;
+                }
+
+                layer->TransferContent(contents[i].second->GetRootLayer());
+                if (layer->Save())
+                {
+                    layers[i] = layer;
+                }
+            }
+        },
+        1
+    );
+
+    SdfSubLayerProxy subLayerPaths = payloadStage->GetRootLayer()->GetSubLayerPaths();
+    for (size_t i = 0; i < contents.size(); ++i)
+    {
+        if (!layers[i])
+        {
+            TF_WARN("Unable to save the asset content layer \"%s\"", relativeIdentifiers[i].c_str());
+            return false;
+        }
+        subLayerPaths.push_back(relativeIdentifiers[i]);
+    }
+
+    for (const usdex::core::LayerSaveReport& report : usdex::core::saveStageWithReport(payloadStage))
+    {
+        if (!report.saved)
+        {
+            TF_WARN("Unable to save the asset payload layer \"%s\"", report.identifier.c_str());
+            return false;
+        }
+    }
+
+    return usdex::core::addAssetInterface(stage, payloadStage);
+}
+
 bool usdex::core::configureComponentHierarchy(pxr::UsdPrim prim)
 {
+    USDEX_INSTRUMENT_SCOPE("configureComponentHierarchy");
+
     if (!prim)
     {
         TF_RUNTIME_ERROR("Unable to configure component hierarchy due to invalid prim");
         return false;
     }
 
+    // Batch all kind changes so the stage is only notified once
+    SdfChangeBlock changeBlock;
+
     // Set the root prim kind to component
     UsdModelAPI rootModel = UsdModelAPI(prim);
     if (!rootModel.SetKind(KindTokens->component))
@@ -800,12 +1576,17 @@ bool usdex::core::configureComponentHierarchy(pxr::UsdPrim prim)
 
 bool usdex::core::configureAssemblyHierarchy(pxr::UsdPrim prim)
 {
+    USDEX_INSTRUMENT_SCOPE("configureAssemblyHierarchy");
+
     if (!prim)
     {
         TF_RUNTIME_ERROR("Unable to configure assembly hierarchy due to invalid prim");
         return false;
     }
 
+    // Batch all kind changes so the stage is only notified once
+    SdfChangeBlock changeBlock;
+
     // Set the root prim kind to assembly
     UsdModelAPI rootModel = UsdModelAPI(prim);
     if (!rootModel.SetKind(KindTokens->assembly))
@@ -814,20 +1595,65 @@ bool usdex::core::configureAssemblyHierarchy(pxr::UsdPrim prim)
         return false;
     }
 
-    // Process all descendants
+    // Process all descendants in a single traversal. Prims without an authored kind become groups if any of their descendants (including those
+    // outside of the default traversal) were authored as models, which is only known once their subtree has been visited.
     bool overallSuccess = true;
-    UsdPrimRange range(prim);
+    std::vector<::HierarchyFrame> frames;
+    UsdPrimRange range = UsdPrimRange::PreAndPostVisit(prim, UsdPrimAllPrimsPredicate);
     for (auto iter = range.begin(); iter != range.end(); ++iter)
     {
         UsdPrim descendant = *iter;
-        if (descendant == prim)
+        if (iter.IsPostVisit())
+        {
+            const ::HierarchyFrame frame = frames.back();
+            frames.pop_back();
+            if (frames.empty())
+            {
+                continue;
+            }
+
+            frames.back().hasDescendantModels |= frame.hasDescendantModels;
+            if (frame.process && !frame.hasAuthoredKind && frame.hasDescendantModels)
+            {
+                bool success = UsdModelAPI(descendant).SetKind(KindTokens->group);
+                if (!success)
+                {
+                    TF_RUNTIME_ERROR("Unable to set the kind of \"%s\" to group", descendant.GetPath().GetAsString().c_str());
+                    overallSuccess &= false;
+                }
+            }
+            continue;
+        }
+
+        if (frames.empty())
         {
+            frames.push_back({ true, true, false });
             continue;
         }
 
+        ::HierarchyFrame& parent = frames.back();
         UsdModelAPI model = UsdModelAPI(descendant);
         TfToken currentKind;
         bool hasAuthoredKind = model.GetKind(&currentKind);
+        bool isModel = hasAuthoredKind &&
+                       (currentKind == KindTokens->assembly || currentKind == KindTokens->group || currentKind == KindTokens->component);
+
+        // Prims outside of the default traversal are only visited to determine whether their ancestors contain models. Once that is settled
+        // nothing below them can change the result.
+        if (!parent.process || !UsdPrimDefaultPredicate(descendant))
+        {
+            parent.hasDescendantModels |= isModel;
+            const bool settled = parent.hasDescendantModels;
+            frames.push_back({ false, hasAuthoredKind, false });
+            if (settled)
+            {
+                iter.PruneChildren();
+            }
+            continue;
+        }
+
+        parent.hasDescendantModels |= isModel;
+        frames.push_back({ true, hasAuthoredKind, false });
 
         // Stop iterating down this branch if we encounter a component
         if (currentKind == KindTokens->component)
@@ -842,6 +1668,8 @@ bool usdex::core::configureAssemblyHierarchy(pxr::UsdPrim prim)
         {
             if (currentKind == KindTokens->subcomponent)
             {
+                // The models below the subcomponent must be determined before its component hierarchy is configured
+                frames.back().hasDescendantModels = ::hasDescendantModelPrims(descendant);
                 bool success = usdex::core::configureComponentHierarchy(descendant);
                 if (!success)
                 {
@@ -863,15 +1691,6 @@ bool usdex::core::configureAssemblyHierarchy(pxr::UsdPrim prim)
                 overallSuccess &= false;
             }
         }
-        else if (!hasAuthoredKind && ::hasDescendantModelPrims(descendant))
-        {
-            bool success = model.SetKind(KindTokens->group);
-            if (!success)
-            {
-                TF_RUNTIME_ERROR("Unable to set the kind of \"%s\" to group", descendant.GetPath().GetAsString().c_str());
-                overallSuccess &= false;
-            }
-        }
     }
 
     return overallSuccess;
@@ -879,6 +1698,8 @@ bool usdex::core::configureAssemblyHierarchy(pxr::UsdPrim prim)
 
 UsdPrim usdex::core::defineReference(UsdStagePtr stage, const SdfPath& path, const UsdPrim& source)
 {
+    USDEX_INSTRUMENT_SCOPE("defineReference");
+
     // Create the common prim structure and get the relative identifier
     std::string relativeIdentifier;
     bool isInternal = false;
@@ -937,15 +1758,29 @@ UsdPrim usdex::core::defineReference(UsdPrim parent, const std::string& name, co
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define reference due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define reference due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPrim();
     }
     const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
     return usdex::core::defineReference(parent.GetStage(), path, sourceIdentifier, primPath);
 }
 
+std::vector<UsdPrim> usdex::core::defineReferences(UsdStagePtr stage, const std::vector<ReferencePayloadData>& references)
+{
+    USDEX_INSTRUMENT_SCOPE("defineReferences");
+
+    return ::defineArcs<SdfReference>(stage, references, "reference");
+}
+
 UsdPrim usdex::core::definePayload(UsdStagePtr stage, const SdfPath& path, const UsdPrim& source)
 {
+    USDEX_INSTRUMENT_SCOPE("definePayload");
+
     // Create the common prim structure and get the relative identifier
     std::string relativeIdentifier;
     bool isInternal = false;
@@ -1004,9 +1839,21 @@ UsdPrim usdex::core::definePayload(UsdPrim parent, const std::string& name, cons
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define payload due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define payload due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPrim();
     }
     const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
     return usdex::core::definePayload(parent.GetStage(), path, sourceIdentifier, primPath);
 }
+
+std::vector<UsdPrim> usdex::core::definePayloads(UsdStagePtr stage, const std::vector<ReferencePayloadData>& payloads)
+{
+    USDEX_INSTRUMENT_SCOPE("definePayloads");
+
+    return ::defineArcs<SdfPayload>(stage, payloads, "payload");
+}
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/Diagnostics.h"
+
+#include <pxr/base/tf/callContext.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/prim.h>
+
+#include <string>
+
+namespace usdex::core::detail
+{
+
+//! Whether the message of an authoring error must be formatted on the calling thread.
+//!
+//! Messages are required unless an `AuthoringErrorScope` is active which neither captures messages nor posts diagnostics.
+bool isAuthoringErrorMessageRequired();
+
+//! Report a prim which could not be authored.
+//!
+//! If an `AuthoringErrorScope` is active on the calling thread the error is recorded by it, otherwise a `TF_RUNTIME_ERROR` is posted.
+//!
+//! @param context The call context of the function which failed
+//! @param path The requested location of the prim
+//! @param code The reason for the failure
+//! @param message The diagnostic message. This may be empty when `isAuthoringErrorMessageRequired()` is false.
+void postAuthoringError(const pxr::TfCallContext& context, const pxr::SdfPath& path, AuthoringErrorCode code, std::string message);
+
+//! Get the path of a child prim for reporting, or an empty path if the parent is invalid or the name is not a valid identifier.
+pxr::SdfPath getChildPathForError(const pxr::UsdPrim& parent, const std::string& name);
+
+} // namespace usdex::core::detail
+
+//! Report a prim which could not be authored, formatting the message only if it is required.
+//!
+//! This is the structured equivalent of `TF_RUNTIME_ERROR` for the `define` functions. The `code` is the name of an `AuthoringErrorCode`
+//! enumerator (e.g. `eInvalidLocation`). See `usdex::core::AuthoringErrorScope` for details.
+#define USDEX_AUTHORING_ERROR(path, code, ...)                                                                                                       \
+    usdex::core::detail::postAuthoringError(                                                                                                         \
+        TF_CALL_CONTEXT,                                                                                                                             \
+        path,                                                                                                                                        \
+        usdex::core::AuthoringErrorCode::code,                                                                                                       \
+        usdex::core::detail::isAuthoringErrorMessageRequired() ? pxr::TfStringPrintf(__VA_ARGS__) : std::string()                                    \
+    )
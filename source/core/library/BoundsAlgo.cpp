@@ -0,0 +1,275 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "usdex/core/BoundsAlgo.h"
+
+#include "Instrumentation.h"
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/typed.h>
+#include <pxr/usd/usdGeom/boundable.h>
+#include <pxr/usd/usdGeom/imageable.h>
+#include <pxr/usd/usdGeom/modelAPI.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+#include <pxr/usd/usdGeom/xformable.h>
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+using namespace usdex::core;
+using namespace pxr;
+
+namespace
+{
+
+// Traversals smaller than this are processed on the calling thread, as the overhead of sharding outweighs the benefit.
+static constexpr size_t s_parallelBoundsThreshold = 1 << 8;
+
+static constexpr size_t s_boundsGrainSize = 1 << 6;
+
+static constexpr size_t s_noParent = std::numeric_limits<size_t>::max();
+
+template <typename Fn>
+void forEachIndex(size_t size, const Fn& fn)
+{
+    if (size < s_parallelBoundsThreshold || !WorkHasConcurrency())
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            fn(i);
+        }
+        return;
+    }
+
+    WorkParallelForN(
+        size,
+        [&fn](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                fn(i);
+            }
+        },
+        s_boundsGrainSize
+    );
+}
+
+// A prim visited by the traversal, along with the index of its parent (which is always visited before it)
+struct BoundsNode
+{
+    UsdPrim prim;
+    size_t parent;
+    TfToken purpose;
+    bool included;
+};
+
+// Discover the prims which may contribute to the bounds, pruning the same subtrees as a UsdGeomBBoxCache
+std::vector<BoundsNode> collectBoundsNodes(const UsdPrim& root, UsdTimeCode time, const TfTokenVector& purposes)
+{
+    std::vector<BoundsNode> nodes;
+    std::vector<UsdGeomImageable::PurposeInfo> purposeInfos;
+    std::unordered_map<SdfPath, size_t, SdfPath::Hash> indices;
+
+    // The visibility and purpose of the root are inherited from its ancestors
+    UsdGeomImageable rootImageable(root);
+    if (rootImageable && rootImageable.ComputeVisibility(time) == UsdGeomTokens->invisible)
+    {
+        return nodes;
+    }
+
+    UsdPrimRange range(root, UsdTraverseInstanceProxies(UsdPrimDefaultPredicate));
+    for (auto it = range.begin(); it != range.end(); ++it)
+    {
+        const UsdPrim& prim = *it;
+        const bool isImageable = prim.IsA<UsdGeomImageable>();
+
+        // Typed prims which are not imageable (e.g. materials and shaders) can not contain geometry, while untyped prims are traversed
+        if (!isImageable && prim.IsA<UsdTyped>())
+        {
+            it.PruneChildren();
+            continue;
+        }
+
+        const size_t parent = (prim == root) ? s_noParent : indices.at(prim.GetParent().GetPath());
+        UsdGeomImageable::PurposeInfo purposeInfo = (parent == s_noParent) ? UsdGeomImageable::PurposeInfo() : purposeInfos[parent];
+        if (isImageable)
+        {
+            UsdGeomImageable imageable(prim);
+            if (prim != root)
+            {
+                TfToken visibility;
+                if (imageable.GetVisibilityAttr().Get(&visibility, time) && visibility == UsdGeomTokens->invisible)
+                {
+                    it.PruneChildren();
+                    continue;
+                }
+            }
+            purposeInfo = (prim == root) ? imageable.ComputePurposeInfo() : imageable.ComputePurposeInfo(purposeInfo);
+        }
+
+        // Descendants inherit an excluded purpose if it is inheritable, so none of them can contribute
+        const bool hasIncludedPurpose = std::find(purposes.begin(), purposes.end(), purposeInfo.purpose) != purposes.end();
+        if (!hasIncludedPurpose && purposeInfo.isInheritable)
+        {
+            it.PruneChildren();
+            continue;
+        }
+
+        indices.emplace(prim.GetPath(), nodes.size());
+        nodes.push_back(BoundsNode{ prim, parent, purposeInfo.purpose, hasIncludedPurpose && prim.IsA<UsdGeomBoundable>() });
+        purposeInfos.push_back(purposeInfo);
+
+        // The prototypes of a point instancer are accounted for by the extent of the instancer
+        if (prim.IsA<UsdGeomPointInstancer>())
+        {
+            it.PruneChildren();
+        }
+    }
+
+    return nodes;
+}
+
+// Compute the transforms and bounds of the boundable prims at and below a prim.
+// If "localSpace" is true the results are relative to the local space of the prim, otherwise they are relative to world space.
+WorldBounds computeBounds(const UsdPrim& root, UsdTimeCode time, const TfTokenVector& purposes, bool localSpace)
+{
+    WorldBounds result;
+
+    const std::vector<BoundsNode> nodes = ::collectBoundsNodes(root, time, purposes);
+    if (nodes.empty())
+    {
+        return result;
+    }
+
+    // Reading the xformOps is the expensive part of computing a transform, so the local transforms are computed in parallel
+    std::vector<GfMatrix4d> localTransforms(nodes.size(), GfMatrix4d(1.0));
+    std::vector<char> resetsXformStack(nodes.size(), 0);
+    ::forEachIndex(
+        nodes.size(),
+        [&](size_t i)
+        {
+            if (UsdGeomXformable xformable = UsdGeomXformable(nodes[i].prim))
+            {
+                bool resets = false;
+                xformable.GetLocalTransformation(&localTransforms[i], &resets, time);
+                resetsXformStack[i] = resets;
+            }
+        }
+    );
+
+    // The traversal visits parents before their children, so the transforms can be concatenated in a single pass
+    GfMatrix4d rootToWorld = localTransforms[0];
+    if (!resetsXformStack[0])
+    {
+        rootToWorld *= UsdGeomXformCache(time).GetParentToWorldTransform(root);
+    }
+    const GfMatrix4d worldToSpace = localSpace ? rootToWorld.GetInverse() : GfMatrix4d(1.0);
+    std::vector<GfMatrix4d> transforms(nodes.size());
+    transforms[0] = localSpace ? GfMatrix4d(1.0) : rootToWorld;
+    for (size_t i = 1; i < nodes.size(); ++i)
+    {
+        transforms[i] = localTransforms[i] * (resetsXformStack[i] ? worldToSpace : transforms[nodes[i].parent]);
+    }
+
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (nodes[i].included)
+        {
+            result.prims.push_back(nodes[i].prim);
+            result.purposes.push_back(nodes[i].purpose);
+            result.transforms.push_back(transforms[i]);
+        }
+    }
+
+    // Reuse the authored extents where possible, falling back to the schema plugins (as UsdGeomBBoxCache does)
+    result.bounds.resize(result.prims.size());
+    ::forEachIndex(
+        result.prims.size(),
+        [&](size_t i)
+        {
+            UsdGeomBoundable boundable(result.prims[i]);
+            VtVec3fArray extent;
+            if (!boundable.GetExtentAttr().Get(&extent, time) || extent.size() != 2)
+            {
+                if (!UsdGeomBoundable::ComputeExtentFromPlugins(boundable, time, &extent) || extent.size() != 2)
+                {
+                    return;
+                }
+            }
+
+            const GfRange3d localRange(GfVec3d(extent[0]), GfVec3d(extent[1]));
+            if (!localRange.IsEmpty())
+            {
+                result.bounds[i] = GfBBox3d(localRange, result.transforms[i]).ComputeAlignedRange();
+            }
+        }
+    );
+
+    for (const GfRange3d& bounds : result.bounds)
+    {
+        result.range.UnionWith(bounds);
+    }
+
+    return result;
+}
+
+} // namespace
+
+WorldBounds usdex::core::computeWorldBounds(const UsdPrim& prim, UsdTimeCode time, const TfTokenVector& purposes)
+{
+    USDEX_INSTRUMENT_SCOPE("computeWorldBounds");
+
+    if (!prim)
+    {
+        TF_RUNTIME_ERROR("Unable to compute world bounds for an invalid prim");
+        return WorldBounds();
+    }
+
+    return ::computeBounds(prim, time, purposes, /* localSpace */ false);
+}
+
+bool usdex::core::setExtentsHint(UsdPrim prim, UsdTimeCode time)
+{
+    USDEX_INSTRUMENT_SCOPE("setExtentsHint");
+
+    if (!prim)
+    {
+        TF_RUNTIME_ERROR("Unable to set the extentsHint of an invalid prim");
+        return false;
+    }
+
+    const TfTokenVector& orderedPurposes = UsdGeomImageable::GetOrderedPurposeTokens();
+    const WorldBounds bounds = ::computeBounds(prim, time, orderedPurposes, /* localSpace */ true);
+
+    std::vector<GfRange3d> ranges(orderedPurposes.size());
+    for (size_t i = 0; i < bounds.prims.size(); ++i)
+    {
+        const size_t index = std::find(orderedPurposes.begin(), orderedPurposes.end(), bounds.purposes[i]) - orderedPurposes.begin();
+        ranges[index].UnionWith(bounds.bounds[i]);
+    }
+
+    // Trailing empty purposes are omitted, but a single empty range is authored if all purposes are empty (matching ComputeExtentsHint)
+    size_t numRanges = 1;
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+        if (!ranges[i].IsEmpty())
+        {
+            numRanges = i + 1;
+        }
+    }
+
+    VtVec3fArray extentsHint(numRanges * 2);
+    for (size_t i = 0; i < numRanges; ++i)
+    {
+        extentsHint[i * 2] = GfVec3f(ranges[i].GetMin());
+        extentsHint[i * 2 + 1] = GfVec3f(ranges[i].GetMax());
+    }
+
+    return UsdGeomModelAPI(prim).SetExtentsHint(extentsHint, time);
+}
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -6,24 +6,103 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+#include "PrimSpecWriter.h"
+
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/usd/usd/attributeQuery.h>
+#include <pxr/usd/usd/resolveTarget.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+#include <pxr/usd/usdGeom/xformOp.h>
 #include <pxr/usd/usdGeom/xformable.h>
 
+#include <unordered_map>
+#include <unordered_set>
+
 
 using namespace pxr;
 
-UsdGeomCamera usdex::core::defineCamera(UsdStagePtr stage, const SdfPath& path, const GfCamera& cameraData)
+namespace
 {
-    // Early out if the proposed prim location is invalid
-    std::string reason;
-    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+
+// Author the time varying camera attributes at a time, matching UsdGeomCamera::SetFromCamera.
+// The xformOpOrder is uniform, so it must be authored separately.
+void setCameraSpecs(
+    usdex::core::detail::PrimSpecWriter& writer,
+    const GfCamera& cameraData,
+    const GfMatrix4d& parentToWorldInverse,
+    UsdTimeCode time
+)
+{
+    static const TfToken s_transformOpName = UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeTransform);
+    const std::vector<GfVec4f>& clippingPlanes = cameraData.GetClippingPlanes();
+    const GfRange1f& clippingRange = cameraData.GetClippingRange();
+
+    writer.setAttribute(
+        s_transformOpName,
+        SdfValueTypeNames->Matrix4d,
+        SdfVariabilityVarying,
+        VtValue(cameraData.GetTransform() * parentToWorldInverse),
+        time
+    );
+    writer.setAttribute(
+        UsdGeomTokens->projection,
+        VtValue(cameraData.GetProjection() == GfCamera::Orthographic ? UsdGeomTokens->orthographic : UsdGeomTokens->perspective),
+        time
+    );
+    writer.setAttribute(UsdGeomTokens->horizontalAperture, VtValue(cameraData.GetHorizontalAperture()), time);
+    writer.setAttribute(UsdGeomTokens->verticalAperture, VtValue(cameraData.GetVerticalAperture()), time);
+    writer.setAttribute(UsdGeomTokens->horizontalApertureOffset, VtValue(cameraData.GetHorizontalApertureOffset()), time);
+    writer.setAttribute(UsdGeomTokens->verticalApertureOffset, VtValue(cameraData.GetVerticalApertureOffset()), time);
+    writer.setAttribute(UsdGeomTokens->focalLength, VtValue(cameraData.GetFocalLength()), time);
+    writer.setAttribute(UsdGeomTokens->clippingRange, VtValue(GfVec2f(clippingRange.GetMin(), clippingRange.GetMax())), time);
+    writer.setAttribute(UsdGeomTokens->clippingPlanes, VtValue(VtVec4fArray(clippingPlanes.begin(), clippingPlanes.end())), time);
+    writer.setAttribute(UsdGeomTokens->fStop, VtValue(cameraData.GetFStop()), time);
+    writer.setAttribute(UsdGeomTokens->focusDistance, VtValue(cameraData.GetFocusDistance()), time);
+}
+
+// Whether the local to world transform of a prim may differ between times
+bool worldTransformMightBeTimeVarying(const UsdPrim& prim)
+{
+    for (UsdPrim ancestor = prim; ancestor && !ancestor.IsPseudoRoot(); ancestor = ancestor.GetParent())
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCamera due to an invalid location: %s", reason.c_str());
-        return UsdGeomCamera();
+        UsdGeomXformable xformable(ancestor);
+        if (!xformable)
+        {
+            continue;
+        }
+        if (xformable.TransformMightBeTimeVarying())
+        {
+            return true;
+        }
+        if (xformable.GetResetXformStack())
+        {
+            break;
+        }
     }
+    return false;
+}
 
-    // Early out if we know that we cannot successfully set the camera attributes
+// The nearest existing ancestor of a prim which is about to be defined, whose transform the prim will inherit.
+// Undefined ancestors will be authored as typeless prims, which do not contribute to the transform, so this may be used before they are authored.
+UsdPrim getTransformParent(UsdStagePtr stage, const SdfPath& path)
+{
+    SdfPath parentPath = path.GetParentPath();
+    UsdPrim parent = stage->GetPrimAtPath(parentPath);
+    while (!parent && parentPath != SdfPath::AbsoluteRootPath())
+    {
+        parentPath = parentPath.GetParentPath();
+        parent = stage->GetPrimAtPath(parentPath);
+    }
+    return parent;
+}
+
+// Guard against stronger xformOp opinions on existing prims, which would prevent the matrix xformOp from taking effect
+bool makeMatrixXform(UsdStagePtr stage, const SdfPath& path)
+{
     // UsdGeomCamera::SetFromCamera() will silently fail if it is unable to successfully call UsdGeomXformable::MakeMatrixXform()
     // In order to catch this case we attempt that change ourselves prior to defining the camera
     if (auto xformable = UsdGeomXformable::Get(stage, path))
@@ -36,9 +115,71 @@ UsdGeomCamera usdex::core::defineCamera(UsdStagePtr stage, const SdfPath& path,
                 path.GetAsString().c_str(),
                 "Xform op opinions in the composed layer stack are stronger than that of the current edit target"
             );
-            return UsdGeomCamera();
+            return false;
         }
     }
+    return true;
+}
+
+// Check for stronger xformOp opinions on an existing prim, without authoring the matrix xformOp as makeMatrixXform does.
+// This allows every camera of a batch to be validated before any of them are authored.
+bool isMatrixXformEditable(UsdStagePtr stage, const SdfPath& path)
+{
+    auto xformable = UsdGeomXformable::Get(stage, path);
+    if (!xformable)
+    {
+        return true;
+    }
+
+    const UsdResolveTarget resolveTarget = xformable.GetPrim().MakeResolveTargetStrongerThanEditTarget(stage->GetEditTarget());
+    if (resolveTarget.IsNull() || !UsdAttributeQuery(xformable.GetXformOpOrderAttr(), resolveTarget).HasAuthoredValue())
+    {
+        return true;
+    }
+
+    TF_RUNTIME_ERROR(
+        "Unable to define UsdGeomCamera at \"%s\" due to non-editable attributes: %s",
+        path.GetAsString().c_str(),
+        "Xform op opinions in the composed layer stack are stronger than that of the current edit target"
+    );
+    return false;
+}
+
+} // namespace
+
+UsdGeomCamera usdex::core::defineCamera(UsdStagePtr stage, const SdfPath& path, const GfCamera& cameraData)
+{
+    USDEX_INSTRUMENT_SCOPE("defineCamera");
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomCamera due to an invalid location: %s", reason.c_str());
+        return UsdGeomCamera();
+    }
+
+    // Early out if we know that we cannot successfully set the camera attributes
+    if (!::makeMatrixXform(stage, path))
+    {
+        return UsdGeomCamera();
+    }
+
+    // Author the specs directly to the edit target layer, matching UsdGeomCamera::SetFromCamera
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        // The ancestors are authored within the same change block as the camera, so they cannot be composed before its transform is computed
+        const GfMatrix4d parentToWorld = UsdGeomXformCache().GetLocalToWorldTransform(::getTransformParent(stage, path));
+        return usdex::core::detail::defineWithSpecs<UsdGeomCamera>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->xformOpOrder, VtValue(VtTokenArray{ UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeTransform) }));
+                ::setCameraSpecs(writer, cameraData, parentToWorld.GetInverse(), UsdTimeCode::Default());
+            }
+        );
+    }
 
     UsdGeomCamera camera = UsdGeomCamera::Define(stage, path);
     if (!camera)
@@ -63,7 +204,12 @@ UsdGeomCamera usdex::core::defineCamera(UsdPrim parent, const std::string& name,
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCamera due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomCamera due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomCamera();
     }
 
@@ -98,3 +244,122 @@ UsdGeomCamera usdex::core::defineCamera(UsdPrim prim, const GfCamera& cameraData
     const SdfPath& path = prim.GetPath();
     return usdex::core::defineCamera(stage, path, cameraData);
 }
+
+std::vector<UsdGeomCamera> usdex::core::defineCameras(
+    UsdStagePtr stage,
+    const SdfPathVector& paths,
+    const std::vector<GfCamera>& cameraData,
+    const std::vector<UsdTimeCode>& times
+)
+{
+    USDEX_INSTRUMENT_SCOPE("defineCameras");
+
+    // Early out if the stage is invalid
+    if (!stage)
+    {
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidStage, "Unable to define UsdGeomCameras due to an invalid stage");
+        return {};
+    }
+
+    if (paths.empty())
+    {
+        return {};
+    }
+
+    if (times.empty() || cameraData.size() != paths.size() * times.size())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdGeomCameras due to mismatched sizes: %zu paths at %zu times requires %zu cameras, but %zu were provided",
+            paths.size(),
+            times.size(),
+            paths.size() * times.size(),
+            cameraData.size()
+        );
+        return {};
+    }
+
+    std::unordered_set<SdfPath, SdfPath::Hash> uniquePaths;
+    if (!usdex::core::detail::validateBatchLocations(TF_CALL_CONTEXT, stage, paths, "UsdGeomCamera", &uniquePaths))
+    {
+        return {};
+    }
+
+    // Every camera is validated before any are authored, so the batch either succeeds or leaves the stage unchanged
+    bool editable = true;
+    for (const SdfPath& path : paths)
+    {
+        editable &= ::isMatrixXformEditable(stage, path);
+    }
+    if (!editable)
+    {
+        return {};
+    }
+
+    // The GfCamera transforms are in world space, so the inverse parent to world transform of each camera is needed at each time.
+    // These are computed once per parent, and only once in total for parents which are not animated.
+    std::vector<UsdGeomXformCache> xformCaches;
+    xformCaches.reserve(times.size());
+    for (const UsdTimeCode& time : times)
+    {
+        xformCaches.emplace_back(time);
+    }
+    std::unordered_map<SdfPath, std::vector<GfMatrix4d>, SdfPath::Hash> parentToWorldInverses;
+    for (const SdfPath& path : paths)
+    {
+        const SdfPath parentPath = path.GetParentPath();
+        if (parentToWorldInverses.count(parentPath))
+        {
+            continue;
+        }
+
+        const UsdPrim parent = ::getTransformParent(stage, path);
+        std::vector<GfMatrix4d>& inverses = parentToWorldInverses[parentPath];
+        const size_t numTimes = ::worldTransformMightBeTimeVarying(parent) ? times.size() : 1;
+        inverses.reserve(numTimes);
+        for (size_t j = 0; j < numTimes; ++j)
+        {
+            inverses.push_back(xformCaches[j].GetLocalToWorldTransform(parent).GetInverse());
+        }
+    }
+
+    // Author all of the cameras directly in the edit target layer, so that change processing occurs once for the entire batch
+    static const TfToken s_cameraTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomCamera>();
+    static const VtTokenArray s_xformOpOrder{ UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeTransform) };
+    {
+        SdfChangeBlock changeBlock;
+
+        usdex::core::detail::defineUndefinedAncestors(stage, uniquePaths);
+
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            usdex::core::detail::PrimSpecWriter writer(stage, paths[i], s_cameraTypeName);
+            if (!writer.isValid())
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomCamera at \"%s\"", paths[i].GetAsString().c_str());
+                continue;
+            }
+
+            writer.setAttribute(UsdGeomTokens->xformOpOrder, VtValue(s_xformOpOrder));
+            const std::vector<GfMatrix4d>& inverses = parentToWorldInverses.at(paths[i].GetParentPath());
+            for (size_t j = 0; j < times.size(); ++j)
+            {
+                ::setCameraSpecs(writer, cameraData[i * times.size() + j], inverses[inverses.size() == 1 ? 0 : j], times[j]);
+            }
+        }
+    }
+
+    // The change block has closed, so the stage has recomposed the new prims
+    std::vector<UsdGeomCamera> result;
+    result.reserve(paths.size());
+    for (const SdfPath& path : paths)
+    {
+        UsdGeomCamera camera(stage->GetPrimAtPath(path));
+        if (!camera)
+        {
+            TF_RUNTIME_ERROR("Unable to define UsdGeomCamera at \"%s\"", path.GetAsString().c_str());
+        }
+        result.push_back(camera);
+    }
+
+    return result;
+}
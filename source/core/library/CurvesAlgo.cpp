@@ -4,13 +4,29 @@
 
 #include "usdex/core/CurvesAlgo.h"
 
+#include "usdex/core/ExtentAlgo.h"
 #include "usdex/core/StageAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Debug.h"
+#include "Instrumentation.h"
+#include "PrimSpecWriter.h"
+
+#include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/layerOffset.h>
+#include <pxr/usd/usd/editTarget.h>
 #include <pxr/usd/usdGeom/basisCurves.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
+#include <algorithm>
+#include <functional>
 #include <numeric>
+#include <vector>
 
 using namespace usdex::core;
 using namespace pxr;
@@ -18,6 +34,12 @@ using namespace pxr;
 namespace
 {
 
+TF_DEFINE_PRIVATE_TOKENS(
+    _tokens,
+    (displayColor)
+    (displayOpacity)
+);
+
 // Validate the topology attributes for a basis curves prim.
 bool validateTopology(
     const pxr::VtIntArray& curveVertexCounts,
@@ -206,17 +228,11 @@ const TfTokenVector& allValidInterpolations(const TfToken& basis, const TfToken&
 }
 
 // Compute the required varying primvar size based on the curve topology
-size_t varyingPrimvarSize(
-    const VtIntArray& curveVertexCounts,
-    const VtVec3fArray& points,
-    const TfToken& type,
-    const TfToken& basis,
-    const TfToken& wrap
-)
+size_t varyingPrimvarSize(const VtIntArray& curveVertexCounts, size_t numPoints, const TfToken& type, const TfToken& basis, const TfToken& wrap)
 {
     if (type == UsdGeomTokens->linear)
     {
-        return points.size();
+        return numPoints;
     }
     else if (wrap == UsdGeomTokens->periodic)
     {
@@ -264,16 +280,15 @@ size_t varyingPrimvarSize(
     }
 }
 
-// Validate the interpolation given the topology information
+// Validate the interpolation given the topology information.
+// The varying primvar size is computed once by the caller, as it requires iterating all curves.
 template <typename T>
 bool validatePrimvarInterpolation(
     const PrimvarData<T>& primvar,
     const TfTokenVector& interpolations,
     const VtIntArray& curveVertexCounts,
-    const VtVec3fArray& points,
-    const TfToken& type,
-    const TfToken& basis,
-    const TfToken& wrap
+    size_t numPoints,
+    size_t varyingSize
 )
 {
     if (std::find(interpolations.begin(), interpolations.end(), primvar.interpolation()) == interpolations.end())
@@ -296,13 +311,13 @@ bool validatePrimvarInterpolation(
     }
 
     // Varying interpolation requires a complex computation using curveVertexCounts, type, basis, and wrap
-    if (primvar.interpolation() == UsdGeomTokens->varying && size == ::varyingPrimvarSize(curveVertexCounts, points, type, basis, wrap))
+    if (primvar.interpolation() == UsdGeomTokens->varying && size == varyingSize)
     {
         return true;
     }
 
     // Vertex interpolation requires a value for every point
-    if (primvar.interpolation() == UsdGeomTokens->vertex && size == points.size())
+    if (primvar.interpolation() == UsdGeomTokens->vertex && size == numPoints)
     {
         return true;
     }
@@ -320,14 +335,12 @@ bool validatePrimvar(
     const PrimvarData<T>& primvar,
     const TfTokenVector& interpolations,
     const VtIntArray& curveVertexCounts,
-    const VtVec3fArray& points,
-    const TfToken& type,
-    const TfToken& basis,
-    const TfToken& wrap,
+    size_t numPoints,
+    size_t varyingSize,
     std::string* reason
 )
 {
-    if (!::validatePrimvarInterpolation<T>(primvar, interpolations, curveVertexCounts, points, type, basis, wrap))
+    if (!::validatePrimvarInterpolation<T>(primvar, interpolations, curveVertexCounts, numPoints, varyingSize))
     {
         if (reason != nullptr)
         {
@@ -383,65 +396,131 @@ UsdGeomBasisCurves defineBasisCurves(
         return UsdGeomBasisCurves();
     }
 
+    // The primvars are independent of one another, so they are validated concurrently. Each validation records its own result, and any failure
+    // is reported in a fixed order, so that the diagnostics do not depend on scheduling.
+    struct PrimvarValidation
+    {
+        const char* description;
+        std::function<bool(std::string*)> validate;
+        bool valid = true;
+        std::string reason;
+    };
+    std::vector<PrimvarValidation> validations;
+    validations.reserve(4);
+
+    // The varying size requires iterating all curves, so it is only computed when a varying primvar was specified
+    auto isVarying = [](const auto& primvar) { return primvar.has_value() && primvar->interpolation() == UsdGeomTokens->varying; };
+    size_t varyingSize = 0;
+    if (isVarying(widths) || isVarying(normals) || isVarying(displayColor) || isVarying(displayOpacity))
+    {
+        varyingSize = ::varyingPrimvarSize(curveVertexCounts, points.size(), type, basis, wrap);
+    }
+
     const TfTokenVector& validInterpolations = ::allValidInterpolations(basis, wrap, /* normals */ false);
+    const TfTokenVector& validNormalsInterpolations = ::allValidInterpolations(basis, wrap, /* normals */ true);
+    const size_t numPoints = points.size();
 
     if (widths.has_value())
     {
-        if (!::validatePrimvar(widths.value(), validInterpolations, curveVertexCounts, points, type, basis, wrap, &reason))
-        {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomBasisCurves at \"%s\" due to invalid widths: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomBasisCurves();
-        }
+        validations.push_back(
+            { "widths",
+              [&](std::string* message)
+              { return ::validatePrimvar(widths.value(), validInterpolations, curveVertexCounts, numPoints, varyingSize, message); } }
+        );
     }
 
-    // Early out if normals were specified but not valid
     if (normals.has_value())
     {
-        bool validNormals = ::validatePrimvar(
-            normals.value(),
-            ::allValidInterpolations(basis, wrap, /* normals */ true),
-            curveVertexCounts,
-            points,
-            type,
-            basis,
-            wrap,
-            &reason
+        validations.push_back(
+            { "normals",
+              [&](std::string* message)
+              { return ::validatePrimvar(normals.value(), validNormalsInterpolations, curveVertexCounts, numPoints, varyingSize, message); } }
         );
-        if (!validNormals)
-        {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomBasisCurves at \"%s\" due to invalid normals: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomBasisCurves();
-        }
     }
 
-    // Early out if displayColor was specified but not valid
     if (displayColor.has_value())
     {
-        if (!::validatePrimvar(displayColor.value(), validInterpolations, curveVertexCounts, points, type, basis, wrap, &reason))
-        {
-            TF_RUNTIME_ERROR(
-                "Unable to define UsdGeomBasisCurves at \"%s\" due to invalid display color: %s",
-                path.GetAsString().c_str(),
-                reason.c_str()
-            );
-            return UsdGeomBasisCurves();
-        }
+        validations.push_back(
+            { "display color",
+              [&](std::string* message)
+              { return ::validatePrimvar(displayColor.value(), validInterpolations, curveVertexCounts, numPoints, varyingSize, message); } }
+        );
     }
 
-    // Early out if displayOpacity was specified but not valid
     if (displayOpacity.has_value())
     {
-        if (!::validatePrimvar(displayOpacity.value(), validInterpolations, curveVertexCounts, points, type, basis, wrap, &reason))
+        validations.push_back(
+            { "display opacity",
+              [&](std::string* message)
+              { return ::validatePrimvar(displayOpacity.value(), validInterpolations, curveVertexCounts, numPoints, varyingSize, message); } }
+        );
+    }
+
+    WorkParallelForN(
+        validations.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                validations[i].valid = validations[i].validate(&validations[i].reason);
+            }
+        },
+        1
+    );
+
+    // Early out if any primvar was specified but not valid
+    for (const PrimvarValidation& validation : validations)
+    {
+        if (!validation.valid)
         {
             TF_RUNTIME_ERROR(
-                "Unable to define UsdGeomBasisCurves at \"%s\" due to invalid display opacity: %s",
+                "Unable to define UsdGeomBasisCurves at \"%s\" due to invalid %s: %s",
                 path.GetAsString().c_str(),
-                reason.c_str()
+                validation.description,
+                validation.reason.c_str()
             );
             return UsdGeomBasisCurves();
         }
     }
 
+    // Author the specs directly to the edit target layer
+    if (BulkAuthoringScope::isActive(stage))
+    {
+        return detail::defineWithSpecs<UsdGeomBasisCurves>(
+            stage,
+            path,
+            [&](detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->type, VtValue(type));
+                writer.setAttribute(UsdGeomTokens->curveVertexCounts, VtValue(curveVertexCounts));
+                writer.setAttribute(UsdGeomTokens->points, VtValue(points));
+                if (type == UsdGeomTokens->cubic)
+                {
+                    writer.setAttribute(UsdGeomTokens->basis, VtValue(basis));
+                }
+                writer.setAttribute(UsdGeomTokens->wrap, VtValue(wrap));
+                if (widths.has_value())
+                {
+                    writer.setPrimvar(UsdGeomTokens->widths, SdfValueTypeNames->FloatArray, widths.value());
+                }
+                if (normals.has_value() && writer.setPrimvar(UsdGeomTokens->normals, SdfValueTypeNames->Normal3fArray, normals.value()))
+                {
+                    writer.setAttribute(UsdGeomTokens->orientation, VtValue(UsdGeomTokens->rightHanded));
+                }
+                if (displayColor.has_value())
+                {
+                    writer.setPrimvar(_tokens->displayColor, SdfValueTypeNames->Color3fArray, displayColor.value());
+                }
+                if (displayOpacity.has_value())
+                {
+                    writer.setPrimvar(_tokens->displayOpacity, SdfValueTypeNames->FloatArray, displayOpacity.value());
+                }
+                const VtVec3fArray extent = widths.has_value() ? computePointsExtent(points, widths.value()) : computePointsExtent(points);
+                writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+            }
+        );
+    }
+
     UsdGeomBasisCurves curves = UsdGeomBasisCurves::Define(stage, path);
     if (!curves)
     {
@@ -451,8 +530,12 @@ UsdGeomBasisCurves defineBasisCurves(
 
     // Author opinions on BasisCurves topology attributes
     curves.CreateTypeAttr().Set(type);
-    curves.CreateCurveVertexCountsAttr().Set(curveVertexCounts);
-    curves.CreatePointsAttr().Set(points);
+    UsdAttribute curveVertexCountsAttr = curves.CreateCurveVertexCountsAttr();
+    UsdAttribute pointsAttr = curves.CreatePointsAttr();
+    curveVertexCountsAttr.Set(curveVertexCounts);
+    pointsAttr.Set(points);
+    detail::verifySharedArray(curveVertexCountsAttr, curveVertexCounts);
+    detail::verifySharedArray(pointsAttr, points);
     if (type == UsdGeomTokens->cubic)
     {
         curves.CreateBasisAttr().Set(basis);
@@ -475,6 +558,7 @@ UsdGeomBasisCurves defineBasisCurves(
         {
             TF_WARN("Failed to set widths primvar for UsdGeomBasisCurves at \"%s\"", path.GetAsString().c_str());
         }
+        detail::verifySharedPrimvar(primvar, widths.value());
     }
 
     // Optionally author normals
@@ -490,6 +574,8 @@ UsdGeomBasisCurves defineBasisCurves(
         }
         else
         {
+            detail::verifySharedPrimvar(primvar, normals.value());
+
             // unclear if this affects curve rendering, but it is a property of UsdGeomPointBased, so we might as well set it explicitly.
             curves.CreateOrientationAttr().Set(UsdGeomTokens->rightHanded);
         }
@@ -503,6 +589,7 @@ UsdGeomBasisCurves defineBasisCurves(
         {
             TF_WARN("Failed to set display color primvar for UsdGeomBasisCurves at \"%s\"", path.GetAsString().c_str());
         }
+        detail::verifySharedPrimvar(primvar, displayColor.value());
     }
 
     // Optionally author display opacity
@@ -513,15 +600,11 @@ UsdGeomBasisCurves defineBasisCurves(
         {
             TF_WARN("Failed to set display opacity primvar for UsdGeomBasisCurves at \"%s\"", path.GetAsString().c_str());
         }
+        detail::verifySharedPrimvar(primvar, displayOpacity.value());
     }
 
-    // Compute an extent for the schema so there is a guarantee that the extent will be correct and authored in all cases.
-    VtArray<GfVec3f> extent;
-    if (!UsdGeomBoundable::ComputeExtentFromPlugins(curves, UsdTimeCode::Default(), &extent))
-    {
-        // fallback to basic extents
-        UsdGeomPointBased::ComputeExtent(points, &extent);
-    }
+    // Compute an extent from the points and widths so there is a guarantee that the extent will be correct and authored in all cases.
+    const VtVec3fArray extent = widths.has_value() ? computePointsExtent(points, widths.value()) : computePointsExtent(points);
     curves.CreateExtentAttr().Set(extent);
 
     return curves;
@@ -541,11 +624,19 @@ UsdGeomBasisCurves usdex::core::defineLinearBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineLinearBasisCurves");
+    USDEX_INSTRUMENT_ARRAY(curveVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(widths);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomBasisCurves due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomBasisCurves due to an invalid location: %s", reason.c_str());
         return UsdGeomBasisCurves();
     }
 
@@ -568,7 +659,12 @@ UsdGeomBasisCurves usdex::core::defineLinearBasisCurves(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomBasisCurves due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomBasisCurves due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomBasisCurves();
     }
 
@@ -626,11 +722,19 @@ UsdGeomBasisCurves usdex::core::defineCubicBasisCurves(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineCubicBasisCurves");
+    USDEX_INSTRUMENT_ARRAY(curveVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(widths);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomBasisCurves due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomBasisCurves due to an invalid location: %s", reason.c_str());
         return UsdGeomBasisCurves();
     }
 
@@ -666,7 +770,12 @@ UsdGeomBasisCurves usdex::core::defineCubicBasisCurves(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomBasisCurves due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomBasisCurves due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomBasisCurves();
     }
 
@@ -735,3 +844,296 @@ UsdGeomBasisCurves usdex::core::defineCubicBasisCurves(
         displayOpacity
     );
 }
+
+namespace
+{
+
+// The invariants of the widths stream, established by the first frame written by a BasisCurvesWriter
+struct WidthsStream
+{
+    bool enabled = false;
+    TfToken interpolation;
+    int elementSize = -1;
+    bool indexed = false;
+    SdfPath valuesPath;
+    SdfPath indicesPath;
+};
+
+} // namespace
+
+class usdex::core::BasisCurvesWriter::BasisCurvesWriterImpl
+{
+
+public:
+
+    explicit BasisCurvesWriterImpl(UsdGeomBasisCurves curves)
+        : m_curves(curves), m_topologyValid(false), m_numPoints(0), m_varyingSize(0), m_frameCount(0), m_lastTime(0.0)
+    {
+        if (!m_curves)
+        {
+            return;
+        }
+
+        // The topology is fixed for the lifetime of the writer, so it is validated once here rather than for every frame
+        TfToken type;
+        m_curves.GetCurveVertexCountsAttr().Get(&m_curveVertexCounts);
+        m_curves.GetTypeAttr().Get(&type);
+        m_curves.GetBasisAttr().Get(&m_basis);
+        m_curves.GetWrapAttr().Get(&m_wrap);
+        if (type == UsdGeomTokens->linear)
+        {
+            // The basis is ignored by linear curves, so it must not affect the validation of the topology or primvars
+            m_basis = TfToken();
+        }
+
+        std::string reason;
+        if (m_curveVertexCounts.empty())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write frames to UsdGeomBasisCurves at \"%s\" due to invalid topology: No curveVertexCounts are authored",
+                m_curves.GetPath().GetAsString().c_str()
+            );
+            return;
+        }
+
+        // Each curve is validated before the number of points is compared, so negative counts are rejected before they affect the total
+        const size_t numPoints = std::accumulate(
+            std::cbegin(m_curveVertexCounts),
+            std::cend(m_curveVertexCounts),
+            size_t(0),
+            [](size_t total, int vertexCount)
+            {
+                return total + static_cast<size_t>(std::max(vertexCount, 0));
+            }
+        );
+        if (!::validateTopology(m_curveVertexCounts, numPoints, type, m_basis, m_wrap, &reason))
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write frames to UsdGeomBasisCurves at \"%s\" due to invalid topology: %s",
+                m_curves.GetPath().GetAsString().c_str(),
+                reason.c_str()
+            );
+            return;
+        }
+
+        m_numPoints = numPoints;
+        m_varyingSize = ::varyingPrimvarSize(m_curveVertexCounts, m_numPoints, type, m_basis, m_wrap);
+        m_topologyValid = true;
+    }
+
+    bool isValid() const
+    {
+        if (!m_curves || !m_topologyValid)
+        {
+            return false;
+        }
+
+        // Once the first frame is written, the writer is bound to its layer
+        if (m_frameCount > 0)
+        {
+            return static_cast<bool>(m_layer);
+        }
+
+        return static_cast<bool>(m_curves.GetPrim().GetStage()->GetEditTarget().GetLayer());
+    }
+
+    bool writeFrame(UsdTimeCode time, const VtVec3fArray& points, const std::optional<const FloatPrimvarData>& widths)
+    {
+        if (!isValid())
+        {
+            TF_RUNTIME_ERROR("Unable to write UsdGeomBasisCurves frame due to an invalid prim, topology, or edit target");
+            return false;
+        }
+
+        const SdfPath& path = m_curves.GetPath();
+        if (time.IsDefault() || (m_frameCount > 0 && time.GetValue() <= m_lastTime))
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomBasisCurves frame at \"%s\" for time %s: Frames must be written at increasing numeric time codes",
+                path.GetAsString().c_str(),
+                TfStringify(time).c_str()
+            );
+            return false;
+        }
+
+        const double t = time.GetValue();
+        if (points.size() != m_numPoints)
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomBasisCurves frame at \"%s\" for time %f due to invalid points: Expected %zu values but found %zu",
+                path.GetAsString().c_str(),
+                t,
+                m_numPoints,
+                points.size()
+            );
+            return false;
+        }
+
+        if (!validateWidths(path, t, widths))
+        {
+            return false;
+        }
+
+        const VtVec3fArray extent = widths.has_value() ? computePointsExtent(points, widths.value()) : computePointsExtent(points);
+        if (m_frameCount == 0)
+        {
+            establish(time, points, widths, extent);
+        }
+        else
+        {
+            // Write directly to the layer, avoiding the per value overhead of UsdAttribute::Set
+            const double layerTime = m_stageToLayerOffset * t;
+            SdfChangeBlock changeBlock;
+            m_layer->SetTimeSample(m_pointsPath, layerTime, points);
+            m_layer->SetTimeSample(m_extentPath, layerTime, extent);
+            if (m_widths.enabled)
+            {
+                m_layer->SetTimeSample(m_widths.valuesPath, layerTime, widths->values());
+                if (m_widths.indexed)
+                {
+                    m_layer->SetTimeSample(m_widths.indicesPath, layerTime, widths->indices());
+                }
+            }
+        }
+
+        m_lastTime = t;
+        ++m_frameCount;
+        return true;
+    }
+
+    size_t getFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+private:
+
+    // Validate the widths of a frame against the cached topology sizes, and against the invariants of the stream once it is established
+    bool validateWidths(const SdfPath& path, double time, const std::optional<const FloatPrimvarData>& widths) const
+    {
+        if (m_frameCount > 0 && m_widths.enabled != widths.has_value())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomBasisCurves frame at \"%s\" for time %f due to invalid widths: Values must be provided for all frames or "
+                "none",
+                path.GetAsString().c_str(),
+                time
+            );
+            return false;
+        }
+
+        if (!widths.has_value())
+        {
+            return true;
+        }
+
+        std::string reason;
+        const TfTokenVector& interpolations = ::allValidInterpolations(m_basis, m_wrap, /* normals */ false);
+        if (!::validatePrimvar(widths.value(), interpolations, m_curveVertexCounts, m_numPoints, m_varyingSize, &reason))
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomBasisCurves frame at \"%s\" for time %f due to invalid widths: %s",
+                path.GetAsString().c_str(),
+                time,
+                reason.c_str()
+            );
+            return false;
+        }
+
+        const bool changed = m_frameCount > 0 && (m_widths.interpolation != widths->interpolation() ||
+                                                  m_widths.elementSize != widths->elementSize() || m_widths.indexed != widths->hasIndices());
+        if (changed)
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomBasisCurves frame at \"%s\" for time %f due to invalid widths: Interpolation, element size, and indexing "
+                "must not change",
+                path.GetAsString().c_str(),
+                time
+            );
+            return false;
+        }
+
+        return true;
+    }
+
+    // Author the first frame via the schema, so that all attribute specs & metadata exist, then record the spec paths of each stream
+    void establish(UsdTimeCode time, const VtVec3fArray& points, const std::optional<const FloatPrimvarData>& widths, const VtVec3fArray& extent)
+    {
+        const UsdEditTarget& editTarget = m_curves.GetPrim().GetStage()->GetEditTarget();
+        m_layer = editTarget.GetLayer();
+        m_stageToLayerOffset = editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+
+        UsdAttribute pointsAttr = m_curves.CreatePointsAttr();
+        pointsAttr.Set(points, time);
+        m_pointsPath = editTarget.MapToSpecPath(pointsAttr.GetPath());
+
+        UsdAttribute extentAttr = m_curves.CreateExtentAttr();
+        extentAttr.Set(extent, time);
+        m_extentPath = editTarget.MapToSpecPath(extentAttr.GetPath());
+
+        if (widths.has_value())
+        {
+            UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(m_curves.GetPrim()).CreatePrimvar(UsdGeomTokens->widths, SdfValueTypeNames->FloatArray);
+            if (!widths->setPrimvar(primvar, time))
+            {
+                TF_WARN("Failed to set widths primvar for UsdGeomBasisCurves at \"%s\"", m_curves.GetPath().GetAsString().c_str());
+            }
+            m_widths.enabled = true;
+            m_widths.interpolation = widths->interpolation();
+            m_widths.elementSize = widths->elementSize();
+            m_widths.indexed = widths->hasIndices();
+            m_widths.valuesPath = editTarget.MapToSpecPath(primvar.GetAttr().GetPath());
+            if (m_widths.indexed)
+            {
+                m_widths.indicesPath = editTarget.MapToSpecPath(primvar.GetIndicesAttr().GetPath());
+            }
+        }
+    }
+
+    UsdGeomBasisCurves m_curves;
+    VtIntArray m_curveVertexCounts;
+    TfToken m_basis;
+    TfToken m_wrap;
+    bool m_topologyValid;
+    size_t m_numPoints;
+    size_t m_varyingSize;
+    SdfLayerHandle m_layer;
+    SdfLayerOffset m_stageToLayerOffset;
+    SdfPath m_pointsPath;
+    SdfPath m_extentPath;
+    WidthsStream m_widths;
+    size_t m_frameCount;
+    double m_lastTime;
+};
+
+usdex::core::BasisCurvesWriter::BasisCurvesWriter(UsdGeomBasisCurves curves) : m_impl(new BasisCurvesWriterImpl(curves))
+{
+    if (!curves)
+    {
+        TF_RUNTIME_ERROR("Unable to write frames to an invalid UsdGeomBasisCurves");
+    }
+}
+
+usdex::core::BasisCurvesWriter::~BasisCurvesWriter()
+{
+    delete m_impl;
+}
+
+bool usdex::core::BasisCurvesWriter::isValid() const
+{
+    return m_impl->isValid();
+}
+
+bool usdex::core::BasisCurvesWriter::writeFrame(UsdTimeCode time, const VtVec3fArray& points, std::optional<const FloatPrimvarData> widths)
+{
+    USDEX_INSTRUMENT_SCOPE("BasisCurvesWriter::writeFrame");
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(widths);
+
+    return m_impl->writeFrame(time, points, widths);
+}
+
+size_t usdex::core::BasisCurvesWriter::getFrameCount() const
+{
+    return m_impl->getFrameCount();
+}
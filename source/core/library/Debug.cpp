@@ -1,12 +1,102 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
 #include "Debug.h"
 
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/gf/vec3d.h>
 #include <pxr/base/tf/registryManager.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/stage.h>
 
 TF_REGISTRY_FUNCTION(TfDebug)
 {
     TF_DEBUG_ENVIRONMENT_SYMBOL(USDEX_TRANSCODING_ERROR, "Boot string encoding failed.\n");
+    TF_DEBUG_ENVIRONMENT_SYMBOL(USDEX_VERIFY_SHARED_ARRAYS, "Verify that authored arrays share their buffers with the input arrays.\n");
+}
+
+namespace
+{
+
+// If the expected value holds a VtArray<T>, set whether the authored value holds the same buffer and return true
+template <typename T>
+bool isSharedArrayOf(const VtValue& authored, const VtValue& expected, bool* shared)
+{
+    if (!expected.IsHolding<VtArray<T>>())
+    {
+        return false;
+    }
+    *shared = authored.IsHolding<VtArray<T>>() && authored.UncheckedGet<VtArray<T>>().IsIdentical(expected.UncheckedGet<VtArray<T>>());
+    return true;
+}
+
+// Whether two values hold arrays that share a buffer. Values which do not hold one of the array types are considered to be shared, as they are
+// either not arrays or not authored by this library.
+template <typename... Ts>
+bool isSharedArray(const VtValue& authored, const VtValue& expected)
+{
+    bool shared = true;
+    (::isSharedArrayOf<Ts>(authored, expected, &shared) || ...);
+    return shared;
+}
+
+bool isSharedArray(const VtValue& authored, const VtValue& expected)
+{
+    return isSharedArray<int, int64_t, float, double, GfVec2f, GfVec3f, GfVec3d, GfQuath, GfQuatf, TfToken, std::string>(authored, expected);
+}
+
+void reportCopiedArray(const SdfPath& path, const VtValue& expected)
+{
+    TF_CODING_ERROR(
+        "The %s array authored to <%s> is a copy of the input array rather than sharing its buffer",
+        expected.GetTypeName().c_str(),
+        path.GetAsString().c_str()
+    );
+}
+
+} // namespace
+
+void usdex::core::detail::verifyAuthoredArray(const UsdAttribute& attribute, const VtValue& expected, UsdTimeCode time)
+{
+    if (!attribute || !expected.IsArrayValued())
+    {
+        return;
+    }
+
+    // Read the opinion of the edit target directly, as stronger opinions of other layers would mask the authored value
+    const UsdEditTarget& editTarget = attribute.GetStage()->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    const SdfPath specPath = editTarget.MapToSpecPath(attribute.GetPath());
+    VtValue authored;
+    if (time.IsDefault())
+    {
+        layer->HasField(specPath, SdfFieldKeys->Default, &authored);
+    }
+    else
+    {
+        const SdfLayerOffset stageToLayerOffset = editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+        layer->QueryTimeSample(specPath, stageToLayerOffset * time.GetValue(), &authored);
+    }
+
+    // Failures to author are reported by the caller, so only values which were authored are verified
+    if (!authored.IsEmpty() && !::isSharedArray(authored, expected))
+    {
+        ::reportCopiedArray(attribute.GetPath(), expected);
+    }
+}
+
+void usdex::core::detail::verifySharedDefaultValue(const SdfAttributeSpecHandle& spec, const VtValue& expected)
+{
+    if (!TfDebug::IsEnabled(USDEX_VERIFY_SHARED_ARRAYS) || !spec || !expected.IsArrayValued())
+    {
+        return;
+    }
+
+    if (!::isSharedArray(spec->GetDefaultValue(), expected))
+    {
+        ::reportCopiedArray(spec->GetPath(), expected);
+    }
 }
@@ -1,11 +1,77 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
 #pragma once
 
+#include "usdex/core/PrimvarData.h"
+#include "usdex/core/StageAlgo.h"
+
 #include <pxr/base/tf/debug.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usdGeom/primvar.h>
 
 using namespace pxr;
 
-TF_DEBUG_CODES(USDEX_TRANSCODING_ERROR);
+TF_DEBUG_CODES(USDEX_TRANSCODING_ERROR, USDEX_VERIFY_SHARED_ARRAYS);
+
+namespace usdex::core::detail
+{
+
+//! Emit a coding error if the value authored for an attribute on the current edit target does not share its array buffer with `expected`.
+//!
+//! This is the implementation of the `USDEX_VERIFY_SHARED_ARRAYS` debug mode. Values which do not hold arrays are not verified.
+//!
+//! @param attribute The attribute that was authored
+//! @param expected The value which was supplied to author the attribute
+//! @param time The time at which the attribute was authored
+void verifyAuthoredArray(const UsdAttribute& attribute, const VtValue& expected, UsdTimeCode time);
+
+//! Emit a coding error if the default value of an attribute spec does not share its array buffer with `expected`.
+//!
+//! This is a no-op unless the `USDEX_VERIFY_SHARED_ARRAYS` debug symbol is enabled.
+//!
+//! @param spec The attribute spec that was authored
+//! @param expected The value which was supplied to author the spec
+void verifySharedDefaultValue(const SdfAttributeSpecHandle& spec, const VtValue& expected);
+
+//! Emit a coding error if an array authored via `UsdAttribute::Set` was copied (e.g. detached) rather than shared with the layer.
+//!
+//! This is a no-op unless the `USDEX_VERIFY_SHARED_ARRAYS` debug symbol is enabled. It is also a no-op while a `SkipUnchangedValuesScope` is active,
+//! as an equal array which was previously authored is retained rather than re-authored.
+//!
+//! @param attribute The attribute that was authored
+//! @param expected The array which was supplied to author the attribute
+//! @param time The time at which the attribute was authored
+template <typename T>
+void verifySharedArray(const UsdAttribute& attribute, const VtArray<T>& expected, UsdTimeCode time = UsdTimeCode::Default())
+{
+    if (TfDebug::IsEnabled(USDEX_VERIFY_SHARED_ARRAYS) && !SkipUnchangedValuesScope::isActive(attribute.GetStage()))
+    {
+        verifyAuthoredArray(attribute, VtValue(expected), time);
+    }
+}
+
+//! Emit a coding error if the values or indices authored via `PrimvarData::setPrimvar` were copied rather than shared with the layer.
+//!
+//! This is a no-op unless the `USDEX_VERIFY_SHARED_ARRAYS` debug symbol is enabled, or while a `SkipUnchangedValuesScope` is active.
+//!
+//! @param primvar The primvar that was authored
+//! @param data The primvar data which was supplied to author the primvar
+//! @param time The time at which the primvar was authored
+template <typename T>
+void verifySharedPrimvar(const UsdGeomPrimvar& primvar, const PrimvarData<T>& data, UsdTimeCode time = UsdTimeCode::Default())
+{
+    if (TfDebug::IsEnabled(USDEX_VERIFY_SHARED_ARRAYS) && !SkipUnchangedValuesScope::isActive(primvar.GetAttr().GetStage()))
+    {
+        verifyAuthoredArray(primvar.GetAttr(), VtValue(data.values()), time);
+        if (data.hasIndices())
+        {
+            verifyAuthoredArray(primvar.GetIndicesAttr(), VtValue(data.indices()), time);
+        }
+    }
+}
+
+} // namespace usdex::core::detail
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2024-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -6,24 +6,384 @@
 
 #include "usdex/core/Settings.h"
 
+#include "AuthoringErrors.h"
+
 #include <pxr/base/arch/debugger.h>
+#include <pxr/base/arch/function.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/stackTrace.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 using namespace pxr;
 
 namespace
 {
 
+// The number of formatted diagnostics which may be pending in buffered mode before producers fall back to writing directly
+static constexpr size_t s_bufferCapacity = 1 << 12;
+
+// The number of distinct diagnostics which are counted for the repeat limit. Diagnostics beyond this are never suppressed.
+static constexpr size_t s_repeatTableSize = 1 << 12;
+static constexpr size_t s_repeatTableProbes = 1 << 5;
+
+// The number of distinct source functions which are counted individually
+static constexpr size_t s_functionTableSize = 1 << 10;
+static constexpr size_t s_functionTableProbes = 1 << 5;
+
+// The number of TfDiagnosticType values, which are contiguous from TF_DIAGNOSTIC_INVALID_TYPE
+static constexpr size_t s_diagnosticTypeCount = static_cast<size_t>(TF_APPLICATION_EXIT_TYPE) + 1;
+
+// A bounded, lock-free, multi-producer single-consumer queue of formatted diagnostics.
+// Each slot carries a sequence number which tells producers and the consumer whether it is free or published (see Vyukov's bounded queue).
+class DiagnosticsBuffer
+{
+public:
+
+    DiagnosticsBuffer() : m_slots(std::make_unique<Slot[]>(s_bufferCapacity)), m_enqueuePos(0), m_dequeuePos(0)
+    {
+        for (size_t i = 0; i < s_bufferCapacity; ++i)
+        {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Called from any thread. Returns false if the buffer is full.
+    bool push(FILE* stream, std::string&& message)
+    {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_slots[pos & (s_bufferCapacity - 1)];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == pos)
+            {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    slot.stream = stream;
+                    slot.message = std::move(message);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (sequence < pos)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Must only be called from a single consumer thread at a time. Returns false if the next message has not been published.
+    bool pop(FILE** stream, std::string* message)
+    {
+        Slot& slot = m_slots[m_dequeuePos & (s_bufferCapacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+        {
+            return false;
+        }
+
+        *stream = slot.stream;
+        message->swap(slot.message);
+        slot.message.clear();
+        slot.sequence.store(m_dequeuePos + s_bufferCapacity, std::memory_order_release);
+        ++m_dequeuePos;
+        return true;
+    }
+
+    size_t enqueued() const
+    {
+        return m_enqueuePos.load(std::memory_order_acquire);
+    }
+
+    size_t dequeued() const
+    {
+        return m_dequeuePos;
+    }
+
+private:
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        FILE* stream = nullptr;
+        std::string message;
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    alignas(64) std::atomic<size_t> m_enqueuePos;
+    alignas(64) size_t m_dequeuePos;
+};
+
+// A fixed size table counting the occurrences of identical diagnostics, used to enforce the repeat limit without locking
+class DiagnosticsRepeatTable
+{
+public:
+
+    DiagnosticsRepeatTable() : m_entries(std::make_unique<Entry[]>(s_repeatTableSize))
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        for (size_t i = 0; i < s_repeatTableSize; ++i)
+        {
+            m_entries[i].key.store(0, std::memory_order_relaxed);
+            m_entries[i].count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Returns the number of times the diagnostic has been issued, including this time, or 0 if the table is full
+    size_t increment(size_t key)
+    {
+        // zero marks an empty entry
+        key = (key == 0) ? 1 : key;
+        for (size_t probe = 0; probe < s_repeatTableProbes; ++probe)
+        {
+            Entry& entry = m_entries[(key + probe) & (s_repeatTableSize - 1)];
+            size_t current = entry.key.load(std::memory_order_acquire);
+            if (current == 0 && entry.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+            {
+                current = key;
+            }
+            if (current == key)
+            {
+                return entry.count.fetch_add(1, std::memory_order_relaxed) + 1;
+            }
+        }
+        return 0;
+    }
+
+private:
+
+    struct Entry
+    {
+        std::atomic<size_t> key;
+        std::atomic<size_t> count;
+    };
+
+    std::unique_ptr<Entry[]> m_entries;
+};
+
+// A fixed size table counting diagnostics by type and source function without locking.
+// The function names are allocated once per entry and retained for the lifetime of the table, so that snapshots can read them concurrently.
+class DiagnosticsFunctionTable
+{
+public:
+
+    DiagnosticsFunctionTable() : m_entries(std::make_unique<Entry[]>(s_functionTableSize)), m_overflow{}
+    {
+        for (size_t i = 0; i < s_functionTableSize; ++i)
+        {
+            m_entries[i].key.store(0, std::memory_order_relaxed);
+            m_entries[i].count.store(0, std::memory_order_relaxed);
+            m_entries[i].type = TF_DIAGNOSTIC_INVALID_TYPE;
+            m_entries[i].function.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~DiagnosticsFunctionTable()
+    {
+        for (size_t i = 0; i < s_functionTableSize; ++i)
+        {
+            delete m_entries[i].function.load(std::memory_order_relaxed);
+        }
+    }
+
+    void increment(TfDiagnosticType type, const std::string& function)
+    {
+        // zero marks an empty entry
+        size_t key = TfHash::Combine(type, function);
+        key = (key == 0) ? 1 : key;
+        for (size_t probe = 0; probe < s_functionTableProbes; ++probe)
+        {
+            Entry& entry = m_entries[(key + probe) & (s_functionTableSize - 1)];
+            size_t current = entry.key.load(std::memory_order_acquire);
+            if (current == 0 && entry.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+            {
+                entry.type = type;
+                entry.function.store(new std::string(function), std::memory_order_release);
+                entry.count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            if (current != key)
+            {
+                continue;
+            }
+
+            // The entry may have been claimed but not yet published by another thread
+            const std::string* name = entry.function.load(std::memory_order_acquire);
+            while (name == nullptr)
+            {
+                std::this_thread::yield();
+                name = entry.function.load(std::memory_order_acquire);
+            }
+            if (entry.type == type && *name == function)
+            {
+                entry.count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        m_overflow[static_cast<size_t>(type) % s_diagnosticTypeCount].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void reset()
+    {
+        for (size_t i = 0; i < s_functionTableSize; ++i)
+        {
+            m_entries[i].count.store(0, std::memory_order_relaxed);
+        }
+        for (std::atomic<size_t>& overflow : m_overflow)
+        {
+            overflow.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::vector<usdex::core::DiagnosticsFunctionCount> snapshot() const
+    {
+        std::vector<usdex::core::DiagnosticsFunctionCount> result;
+        for (size_t i = 0; i < s_functionTableSize; ++i)
+        {
+            const Entry& entry = m_entries[i];
+            const std::string* name = entry.function.load(std::memory_order_acquire);
+            const size_t count = entry.count.load(std::memory_order_relaxed);
+            if (name != nullptr && count > 0)
+            {
+                result.push_back(usdex::core::DiagnosticsFunctionCount{ *name, entry.type, count });
+            }
+        }
+        for (size_t i = 0; i < s_diagnosticTypeCount; ++i)
+        {
+            if (const size_t count = m_overflow[i].load(std::memory_order_relaxed))
+            {
+                result.push_back(usdex::core::DiagnosticsFunctionCount{ std::string(), static_cast<TfDiagnosticType>(i), count });
+            }
+        }
+
+        std::sort(
+            result.begin(),
+            result.end(),
+            [](const usdex::core::DiagnosticsFunctionCount& a, const usdex::core::DiagnosticsFunctionCount& b)
+            {
+                return (a.function != b.function) ? a.function < b.function : a.type < b.type;
+            }
+        );
+
+        // Overflowed diagnostics may share a function and type with a counted entry
+        std::vector<usdex::core::DiagnosticsFunctionCount> merged;
+        for (usdex::core::DiagnosticsFunctionCount& item : result)
+        {
+            if (!merged.empty() && merged.back().function == item.function && merged.back().type == item.type)
+            {
+                merged.back().count += item.count;
+            }
+            else
+            {
+                merged.push_back(std::move(item));
+            }
+        }
+        return merged;
+    }
+
+private:
+
+    struct Entry
+    {
+        std::atomic<size_t> key;
+        std::atomic<size_t> count;
+        TfDiagnosticType type;
+        std::atomic<const std::string*> function;
+    };
+
+    std::unique_ptr<Entry[]> m_entries;
+    std::array<std::atomic<size_t>, s_diagnosticTypeCount> m_overflow;
+};
+
+// The snake case name of a TfDiagnosticType, for use as a metrics label
+const char* getDiagnosticTypeLabel(TfDiagnosticType type)
+{
+    switch (type)
+    {
+        case TF_DIAGNOSTIC_CODING_ERROR_TYPE:
+            return "coding_error";
+        case TF_DIAGNOSTIC_FATAL_CODING_ERROR_TYPE:
+            return "fatal_coding_error";
+        case TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE:
+            return "runtime_error";
+        case TF_DIAGNOSTIC_FATAL_ERROR_TYPE:
+            return "fatal_error";
+        case TF_DIAGNOSTIC_NONFATAL_ERROR_TYPE:
+            return "nonfatal_error";
+        case TF_DIAGNOSTIC_WARNING_TYPE:
+            return "warning";
+        case TF_DIAGNOSTIC_STATUS_TYPE:
+            return "status";
+        case TF_APPLICATION_EXIT_TYPE:
+            return "application_exit";
+        default:
+            return "invalid";
+    }
+}
+
+// Escape a metrics label value, as required by the OpenMetrics text format
+std::string escapeLabelValue(const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                result += "\\\\";
+                break;
+            case '"':
+                result += "\\\"";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            default:
+                result += c;
+        }
+    }
+    return result;
+}
+
 class DiagnosticsDelegate final : TfDiagnosticMgr::Delegate
 {
 public:
 
     DiagnosticsDelegate()
-        : m_active(false), m_level(usdex::core::DiagnosticsLevel::eWarning), m_outputStream(usdex::core::DiagnosticsOutputStream::eStderr)
+        : m_active(false),
+          m_level(usdex::core::DiagnosticsLevel::eWarning),
+          m_outputStream(usdex::core::DiagnosticsOutputStream::eStderr),
+          m_buffered(false),
+          m_repeatLimit(0),
+          m_running(false),
+          m_drained(0),
+          m_typeCounts{}
     {
     }
 
-    ~DiagnosticsDelegate() = default;
+    ~DiagnosticsDelegate()
+    {
+        setBuffered(false);
+    }
 
     static DiagnosticsDelegate* acquire()
     {
@@ -33,50 +393,132 @@ public:
 
     bool isActive()
     {
-        return m_active;
+        return m_active.load(std::memory_order_acquire);
     }
 
     void activate()
     {
-        if (!m_active)
+        std::lock_guard<std::mutex> lock(m_activeMutex);
+        if (!m_active.load(std::memory_order_relaxed))
         {
             TfDiagnosticMgr::GetInstance().AddDelegate(this);
-            m_active = true;
+            m_active.store(true, std::memory_order_release);
         }
     }
 
     void deactivate()
     {
-        if (m_active)
         {
-            TfDiagnosticMgr::GetInstance().RemoveDelegate(this);
-            m_active = false;
+            std::lock_guard<std::mutex> lock(m_activeMutex);
+            if (m_active.load(std::memory_order_relaxed))
+            {
+                TfDiagnosticMgr::GetInstance().RemoveDelegate(this);
+                m_active.store(false, std::memory_order_release);
+            }
         }
+        flush();
     }
 
+    // The level and output stream are read by every thread which emits a diagnostic, so they may be changed at any time
     void setLevel(usdex::core::DiagnosticsLevel value)
     {
-        m_level = value;
+        m_level.store(value, std::memory_order_relaxed);
     }
 
     usdex::core::DiagnosticsLevel getLevel()
     {
-        return m_level;
+        return m_level.load(std::memory_order_relaxed);
     }
 
     void setOutputStream(usdex::core::DiagnosticsOutputStream value)
     {
-        m_outputStream = value;
+        m_outputStream.store(value, std::memory_order_relaxed);
     }
 
     usdex::core::DiagnosticsOutputStream getOutputStream()
     {
-        return m_outputStream;
+        return m_outputStream.load(std::memory_order_relaxed);
+    }
+
+    void setBuffered(bool value)
+    {
+        std::lock_guard<std::mutex> lock(m_workerMutex);
+        m_buffered.store(value, std::memory_order_release);
+        if (value && !m_worker.joinable())
+        {
+            m_running.store(true, std::memory_order_release);
+            m_worker = std::thread(&DiagnosticsDelegate::drainLoop, this);
+        }
+        else if (!value && m_worker.joinable())
+        {
+            m_running.store(false, std::memory_order_release);
+            m_wake.notify_one();
+            m_worker.join();
+            // Producers which observed buffered mode just before it was disabled may have published after the worker exited
+            drain();
+        }
+    }
+
+    bool getBuffered()
+    {
+        return m_buffered.load(std::memory_order_acquire);
+    }
+
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock(m_workerMutex);
+        if (!m_worker.joinable())
+        {
+            drain();
+            return;
+        }
+
+        const size_t target = m_buffer.enqueued();
+        while (m_drained.load(std::memory_order_acquire) < target)
+        {
+            m_wake.notify_one();
+            std::this_thread::yield();
+        }
+    }
+
+    void setRepeatLimit(size_t value)
+    {
+        m_repeatLimit.store(value, std::memory_order_relaxed);
+        m_repeats.clear();
+    }
+
+    size_t getRepeatLimit()
+    {
+        return m_repeatLimit.load(std::memory_order_relaxed);
+    }
+
+    usdex::core::DiagnosticsCounts getCounts()
+    {
+        usdex::core::DiagnosticsCounts result;
+        for (size_t i = 0; i < s_diagnosticTypeCount; ++i)
+        {
+            if (const size_t count = m_typeCounts[i].load(std::memory_order_relaxed))
+            {
+                result.byType[static_cast<TfDiagnosticType>(i)] = count;
+            }
+        }
+        result.byFunction = m_functionCounts.snapshot();
+        return result;
+    }
+
+    void resetCounts()
+    {
+        for (std::atomic<size_t>& count : m_typeCounts)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+        m_functionCounts.reset();
     }
 
     void IssueError(const TfError& err) override
     {
-        if (m_level < usdex::core::DiagnosticsLevel::eError)
+        countDiagnostic(err, TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE);
+        if (getLevel() < usdex::core::DiagnosticsLevel::eError)
         {
             return;
         }
@@ -87,8 +529,10 @@ public:
     void IssueFatalError(const TfCallContext& context, const std::string& msg) override
     {
         // This is invoked when TF_FATAL_CODING_ERROR or TF_FATAL_ERROR are emitted.
-        // We simply print the message to the configured output stream. Afterwards
-        // TfDiagnosticMgr will log the crash and terminate the process.
+        // We flush any buffered diagnostics, then print the message directly to the configured output stream.
+        // Afterwards TfDiagnosticMgr will log the crash and terminate the process.
+        count(TF_DIAGNOSTIC_FATAL_ERROR_TYPE, context.IsHidden() ? std::string() : std::string(context.GetPrettyFunction()));
+        flush();
         if (context.IsHidden())
         {
             print(TfStringPrintf("[Fatal] %s\n", msg.c_str()));
@@ -97,11 +541,14 @@ public:
         {
             print(TfStringPrintf("[Fatal] [%s] %s\n", context.GetPrettyFunction(), msg.c_str()));
         }
+        fflush(stdout);
+        fflush(stderr);
     }
 
     void IssueStatus(const TfStatus& status) override
     {
-        if (m_level < usdex::core::DiagnosticsLevel::eStatus)
+        countDiagnostic(status, TF_DIAGNOSTIC_STATUS_TYPE);
+        if (getLevel() < usdex::core::DiagnosticsLevel::eStatus)
         {
             return;
         }
@@ -111,7 +558,8 @@ public:
 
     void IssueWarning(const TfWarning& warning) override
     {
-        if (m_level < usdex::core::DiagnosticsLevel::eWarning)
+        countDiagnostic(warning, TF_DIAGNOSTIC_WARNING_TYPE);
+        if (getLevel() < usdex::core::DiagnosticsLevel::eWarning)
         {
             return;
         }
@@ -146,31 +594,138 @@ private:
         }
     }
 
+    // Every diagnostic is counted, regardless of the level, output stream, or repeat limit
+    void count(TfDiagnosticType type, const std::string& function)
+    {
+        m_typeCounts[static_cast<size_t>(type) % s_diagnosticTypeCount].fetch_add(1, std::memory_order_relaxed);
+        m_functionCounts.increment(type, function);
+    }
+
+    // Diagnostics posted with a custom TfEnum code (e.g. TF_ERROR(MyErrorCode, ...)) are counted by the category they were issued as
+    void countDiagnostic(const TfDiagnosticBase& diagnostic, TfDiagnosticType category)
+    {
+        const TfEnum& code = diagnostic.GetDiagnosticCode();
+        const TfDiagnosticType type = code.IsA<TfDiagnosticType>() ? static_cast<TfDiagnosticType>(code.GetValueAsInt()) : category;
+        const bool hidden = diagnostic.GetContext().IsHidden() || diagnostic.GetSourceFileName().empty();
+        count(type, hidden ? std::string() : diagnostic.GetSourceFunction());
+    }
+
     void printDiagnostic(const TfDiagnosticBase& diagnostic)
     {
-        if (m_outputStream == usdex::core::DiagnosticsOutputStream::eNone || diagnostic.GetQuiet())
+        const usdex::core::DiagnosticsOutputStream outputStream = getOutputStream();
+        if (outputStream == usdex::core::DiagnosticsOutputStream::eNone || diagnostic.GetQuiet())
         {
             return;
         }
 
-        FILE* ostream = (m_outputStream == usdex::core::DiagnosticsOutputStream::eStderr) ? stderr : stdout;
-        fprintf(ostream, "%s", formatDiagnostic(diagnostic).c_str());
+        FILE* ostream = (outputStream == usdex::core::DiagnosticsOutputStream::eStderr) ? stderr : stdout;
+
+        const size_t repeatLimit = m_repeatLimit.load(std::memory_order_relaxed);
+        if (repeatLimit == 0)
+        {
+            emit(ostream, formatDiagnostic(diagnostic));
+            return;
+        }
+
+        const size_t key = TfHash::Combine(diagnostic.GetDiagnosticCode(), diagnostic.GetSourceFunction(), diagnostic.GetCommentary());
+        const size_t count = m_repeats.increment(key);
+        if (count == 0 || count <= repeatLimit)
+        {
+            emit(ostream, formatDiagnostic(diagnostic));
+        }
+        else if (count == repeatLimit + 1)
+        {
+            std::string message = formatDiagnostic(diagnostic);
+            message.insert(message.size() - 1, " (further repeats of this diagnostic are suppressed)");
+            emit(ostream, std::move(message));
+        }
     }
 
     void print(const std::string& message)
     {
-        if (m_outputStream == usdex::core::DiagnosticsOutputStream::eNone)
+        const usdex::core::DiagnosticsOutputStream outputStream = getOutputStream();
+        if (outputStream == usdex::core::DiagnosticsOutputStream::eNone)
         {
             return;
         }
 
-        FILE* ostream = (m_outputStream == usdex::core::DiagnosticsOutputStream::eStderr) ? stderr : stdout;
+        FILE* ostream = (outputStream == usdex::core::DiagnosticsOutputStream::eStderr) ? stderr : stdout;
+        fprintf(ostream, "%s", message.c_str());
+    }
+
+    void emit(FILE* ostream, std::string&& message)
+    {
+        // In buffered mode the message is written by the worker thread, unless the buffer is full, in which case it is written directly.
+        // The buffer is flushed before writing directly, so that the earlier messages of this thread are written first.
+        if (m_buffered.load(std::memory_order_acquire))
+        {
+            if (m_buffer.push(ostream, std::move(message)))
+            {
+                m_wake.notify_one();
+                return;
+            }
+
+            flush();
+        }
+
         fprintf(ostream, "%s", message.c_str());
     }
 
-    bool m_active;
-    usdex::core::DiagnosticsLevel m_level;
-    usdex::core::DiagnosticsOutputStream m_outputStream;
+    // Write all published messages. Must only be called by the worker thread, or while holding m_workerMutex when the worker is not running.
+    void drain()
+    {
+        FILE* ostream = nullptr;
+        std::string message;
+        bool written = false;
+        while (m_buffer.pop(&ostream, &message))
+        {
+            fprintf(ostream, "%s", message.c_str());
+            written = true;
+        }
+
+        if (written)
+        {
+            fflush(stdout);
+            fflush(stderr);
+        }
+        m_drained.store(m_buffer.dequeued(), std::memory_order_release);
+    }
+
+    void drainLoop()
+    {
+        while (true)
+        {
+            drain();
+            if (!m_running.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            // Producers notify without holding the mutex, so a wakeup may be missed. The timeout bounds the latency in that case.
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wake.wait_for(lock, std::chrono::milliseconds(10));
+        }
+    }
+
+    std::mutex m_activeMutex;
+    std::atomic<bool> m_active;
+    std::atomic<usdex::core::DiagnosticsLevel> m_level;
+    std::atomic<usdex::core::DiagnosticsOutputStream> m_outputStream;
+
+    std::atomic<bool> m_buffered;
+    std::atomic<size_t> m_repeatLimit;
+    DiagnosticsBuffer m_buffer;
+    DiagnosticsRepeatTable m_repeats;
+
+    std::mutex m_workerMutex;
+    std::thread m_worker;
+    std::atomic<bool> m_running;
+    std::atomic<size_t> m_drained;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+
+    std::array<std::atomic<size_t>, s_diagnosticTypeCount> m_typeCounts;
+    DiagnosticsFunctionTable m_functionCounts;
 };
 
 } // namespace
@@ -231,3 +786,180 @@ usdex::core::DiagnosticsOutputStream usdex::core::getDiagnosticsOutputStream()
 {
     return ::DiagnosticsDelegate::acquire()->getOutputStream();
 }
+
+void usdex::core::setDiagnosticsBuffered(bool value)
+{
+    ::DiagnosticsDelegate::acquire()->setBuffered(value);
+}
+
+bool usdex::core::getDiagnosticsBuffered()
+{
+    return ::DiagnosticsDelegate::acquire()->getBuffered();
+}
+
+void usdex::core::flushDiagnostics()
+{
+    ::DiagnosticsDelegate::acquire()->flush();
+}
+
+void usdex::core::setDiagnosticsRepeatLimit(size_t value)
+{
+    ::DiagnosticsDelegate::acquire()->setRepeatLimit(value);
+}
+
+size_t usdex::core::getDiagnosticsRepeatLimit()
+{
+    return ::DiagnosticsDelegate::acquire()->getRepeatLimit();
+}
+
+usdex::core::DiagnosticsCounts usdex::core::getDiagnosticsCounts()
+{
+    return ::DiagnosticsDelegate::acquire()->getCounts();
+}
+
+void usdex::core::resetDiagnosticsCounts()
+{
+    ::DiagnosticsDelegate::acquire()->resetCounts();
+}
+
+std::string usdex::core::getDiagnosticsMetrics()
+{
+    const DiagnosticsCounts counts = getDiagnosticsCounts();
+
+    std::string result;
+    result += "# TYPE usdex_diagnostics counter\n";
+    result += "# HELP usdex_diagnostics The number of diagnostics issued, by type.\n";
+    for (const auto& [type, count] : counts.byType)
+    {
+        result += TfStringPrintf("usdex_diagnostics_total{type=\"%s\"} %zu\n", ::getDiagnosticTypeLabel(type), count);
+    }
+
+    result += "# TYPE usdex_diagnostics_by_function counter\n";
+    result += "# HELP usdex_diagnostics_by_function The number of diagnostics issued, by type and source function.\n";
+    for (const DiagnosticsFunctionCount& item : counts.byFunction)
+    {
+        result += TfStringPrintf(
+            "usdex_diagnostics_by_function_total{type=\"%s\",function=\"%s\"} %zu\n",
+            ::getDiagnosticTypeLabel(item.type),
+            ::escapeLabelValue(item.function).c_str(),
+            item.count
+        );
+    }
+
+    result += "# EOF\n";
+    return result;
+}
+
+class usdex::core::AuthoringErrorScope::AuthoringErrorScopeImpl
+{
+
+public:
+
+    AuthoringErrorScopeImpl(AuthoringErrorScope* owner, bool captureMessages, bool postDiagnostics)
+        : m_owner(owner), m_captureMessages(captureMessages), m_postDiagnostics(postDiagnostics), m_parent(s_current)
+    {
+        s_current = this;
+    }
+
+    ~AuthoringErrorScopeImpl()
+    {
+        s_current = m_parent;
+    }
+
+    static AuthoringErrorScope* getCurrent()
+    {
+        return s_current ? s_current->m_owner : nullptr;
+    }
+
+    AuthoringErrorScope* m_owner;
+    bool m_captureMessages;
+    bool m_postDiagnostics;
+    std::vector<AuthoringError> m_errors;
+
+private:
+
+    AuthoringErrorScopeImpl* m_parent;
+
+    // The innermost scope of the calling thread, which links to the enclosing scopes
+    static thread_local AuthoringErrorScopeImpl* s_current;
+};
+
+thread_local usdex::core::AuthoringErrorScope::AuthoringErrorScopeImpl* usdex::core::AuthoringErrorScope::AuthoringErrorScopeImpl::s_current =
+    nullptr;
+
+usdex::core::AuthoringErrorScope::AuthoringErrorScope(bool captureMessages, bool postDiagnostics)
+    : m_impl(new AuthoringErrorScopeImpl(this, captureMessages, postDiagnostics))
+{
+}
+
+usdex::core::AuthoringErrorScope::~AuthoringErrorScope()
+{
+    delete m_impl;
+}
+
+usdex::core::AuthoringErrorScope* usdex::core::AuthoringErrorScope::getCurrent()
+{
+    return AuthoringErrorScopeImpl::getCurrent();
+}
+
+bool usdex::core::AuthoringErrorScope::getCaptureMessages() const
+{
+    return m_impl->m_captureMessages;
+}
+
+bool usdex::core::AuthoringErrorScope::getPostDiagnostics() const
+{
+    return m_impl->m_postDiagnostics;
+}
+
+void usdex::core::AuthoringErrorScope::append(AuthoringError error)
+{
+    m_impl->m_errors.push_back(std::move(error));
+}
+
+const std::vector<usdex::core::AuthoringError>& usdex::core::AuthoringErrorScope::getErrors() const
+{
+    return m_impl->m_errors;
+}
+
+void usdex::core::AuthoringErrorScope::clear()
+{
+    m_impl->m_errors.clear();
+}
+
+bool usdex::core::detail::isAuthoringErrorMessageRequired()
+{
+    const AuthoringErrorScope* scope = AuthoringErrorScope::getCurrent();
+    return !scope || scope->getCaptureMessages() || scope->getPostDiagnostics();
+}
+
+void usdex::core::detail::postAuthoringError(const TfCallContext& context, const SdfPath& path, AuthoringErrorCode code, std::string message)
+{
+    AuthoringErrorScope* scope = AuthoringErrorScope::getCurrent();
+    if (!scope || scope->getPostDiagnostics())
+    {
+        Tf_PostErrorHelper(context, TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "%s", message.c_str());
+    }
+
+    if (scope)
+    {
+        AuthoringError error;
+        error.function = ArGetPrettierFunctionName(context.GetFunction(), context.GetPrettyFunction());
+        error.path = path;
+        error.code = code;
+        if (scope->getCaptureMessages())
+        {
+            error.message = std::move(message);
+        }
+        scope->append(std::move(error));
+    }
+}
+
+SdfPath usdex::core::detail::getChildPathForError(const UsdPrim& parent, const std::string& name)
+{
+    if (!parent || !SdfPath::IsValidIdentifier(name))
+    {
+        return SdfPath();
+    }
+    return parent.GetPath().AppendChild(TfToken(name));
+}
@@ -0,0 +1,321 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "usdex/core/ExtentAlgo.h"
+
+#include "Instrumentation.h"
+
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/layerOffset.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/curves.h>
+#include <pxr/usd/usdGeom/points.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+using namespace usdex::core;
+using namespace pxr;
+
+namespace
+{
+
+// Arrays smaller than this are reduced on the calling thread, as the overhead of sharding outweighs the benefit.
+static constexpr size_t s_parallelExtentThreshold = 1 << 16;
+
+static constexpr size_t s_extentGrainSize = 1 << 14;
+
+struct Bounds
+{
+    float min[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+    float max[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+    void unionWith(const Bounds& other)
+    {
+        for (size_t i = 0; i < 3; ++i)
+        {
+            min[i] = std::min(min[i], other.min[i]);
+            max[i] = std::max(max[i], other.max[i]);
+        }
+    }
+};
+
+// Reduce a range of points, each padded by a radius. The components are accumulated in independent scalars using branchless comparisons,
+// so that the compiler is able to vectorize the loop.
+template <typename RadiusFn>
+Bounds reducePoints(const GfVec3f* points, size_t begin, size_t end, const RadiusFn& radius)
+{
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float minZ = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    float maxZ = std::numeric_limits<float>::lowest();
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float* point = points[i].data();
+        const float r = radius(i);
+        minX = (point[0] - r) < minX ? (point[0] - r) : minX;
+        minY = (point[1] - r) < minY ? (point[1] - r) : minY;
+        minZ = (point[2] - r) < minZ ? (point[2] - r) : minZ;
+        maxX = (point[0] + r) > maxX ? (point[0] + r) : maxX;
+        maxY = (point[1] + r) > maxY ? (point[1] + r) : maxY;
+        maxZ = (point[2] + r) > maxZ ? (point[2] + r) : maxZ;
+    }
+
+    Bounds bounds;
+    bounds.min[0] = minX;
+    bounds.min[1] = minY;
+    bounds.min[2] = minZ;
+    bounds.max[0] = maxX;
+    bounds.max[1] = maxY;
+    bounds.max[2] = maxZ;
+    return bounds;
+}
+
+template <typename RadiusFn>
+Bounds computeBounds(const VtVec3fArray& points, const RadiusFn& radius)
+{
+    const GfVec3f* data = points.cdata();
+    const size_t size = points.size();
+    if (size < s_parallelExtentThreshold || !WorkHasConcurrency())
+    {
+        return reducePoints(data, 0, size, radius);
+    }
+
+    // Each chunk is reduced independently and the partial bounds are combined on the calling thread
+    const size_t numChunks = (size + s_extentGrainSize - 1) / s_extentGrainSize;
+    std::vector<Bounds> chunks(numChunks);
+    WorkParallelForN(
+        numChunks,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t chunk = begin; chunk < end; ++chunk)
+            {
+                chunks[chunk] = reducePoints(data, chunk * s_extentGrainSize, std::min(size, (chunk + 1) * s_extentGrainSize), radius);
+            }
+        },
+        1
+    );
+
+    Bounds bounds;
+    for (const Bounds& chunk : chunks)
+    {
+        bounds.unionWith(chunk);
+    }
+    return bounds;
+}
+
+VtVec3fArray toExtent(const Bounds& bounds, float padding)
+{
+    VtVec3fArray extent(2);
+    extent[0] = GfVec3f(bounds.min[0], bounds.min[1], bounds.min[2]);
+    extent[1] = GfVec3f(bounds.max[0], bounds.max[1], bounds.max[2]);
+
+    // An empty range must remain empty
+    if (padding > 0.0f && extent[0][0] <= extent[1][0])
+    {
+        extent[0] -= GfVec3f(padding);
+        extent[1] += GfVec3f(padding);
+    }
+    return extent;
+}
+
+// The widths of a prim may be authored as a primvar (as the define functions do) or as the native schema attribute
+class WidthsSource
+{
+public:
+    explicit WidthsSource(const UsdPrim& prim)
+    {
+        if (!prim.IsA<UsdGeomPoints>() && !prim.IsA<UsdGeomCurves>())
+        {
+            return;
+        }
+
+        UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(prim).GetPrimvar(UsdGeomTokens->widths);
+        if (primvar && primvar.HasAuthoredValue())
+        {
+            m_primvar = primvar;
+            return;
+        }
+
+        if (UsdGeomPoints points = UsdGeomPoints(prim))
+        {
+            m_attr = points.GetWidthsAttr();
+            m_interpolation = points.GetWidthsInterpolation();
+        }
+        else if (UsdGeomCurves curves = UsdGeomCurves(prim))
+        {
+            m_attr = curves.GetWidthsAttr();
+            m_interpolation = curves.GetWidthsInterpolation();
+        }
+        if (!m_attr.HasAuthoredValue())
+        {
+            m_attr = UsdAttribute();
+        }
+    }
+
+    void appendTimeSamples(std::vector<double>* times) const
+    {
+        std::vector<double> samples;
+        if (m_primvar)
+        {
+            m_primvar.GetTimeSamples(&samples);
+        }
+        else if (m_attr)
+        {
+            m_attr.GetTimeSamples(&samples);
+        }
+        times->insert(times->end(), samples.begin(), samples.end());
+    }
+
+    std::optional<FloatPrimvarData> get(UsdTimeCode time) const
+    {
+        if (m_primvar)
+        {
+            return FloatPrimvarData::getPrimvarData(m_primvar, time);
+        }
+
+        VtFloatArray values;
+        if (m_attr && m_attr.Get(&values, time))
+        {
+            return FloatPrimvarData(m_interpolation, values);
+        }
+
+        return std::nullopt;
+    }
+
+private:
+    UsdGeomPrimvar m_primvar;
+    UsdAttribute m_attr;
+    TfToken m_interpolation;
+};
+
+} // namespace
+
+VtVec3fArray usdex::core::computePointsExtent(const VtVec3fArray& points)
+{
+    return ::toExtent(::computeBounds(points, [](size_t) { return 0.0f; }), 0.0f);
+}
+
+VtVec3fArray usdex::core::computePointsExtent(const VtVec3fArray& points, const FloatPrimvarData& widths)
+{
+    const VtFloatArray& values = widths.values();
+    const VtIntArray& indices = widths.indices();
+    if (widths.elementSize() <= 1)
+    {
+        // Pad each point by its own width
+        if (!widths.hasIndices() && values.size() == points.size())
+        {
+            const float* valuesData = values.cdata();
+            return ::toExtent(::computeBounds(points, [valuesData](size_t i) { return valuesData[i] * 0.5f; }), 0.0f);
+        }
+        else if (widths.hasIndices() && indices.size() == points.size() && widths.isValid())
+        {
+            const float* valuesData = values.cdata();
+            const int* indicesData = indices.cdata();
+            return ::toExtent(::computeBounds(points, [valuesData, indicesData](size_t i) { return valuesData[indicesData[i]] * 0.5f; }), 0.0f);
+        }
+    }
+
+    // Pad all points by the largest width
+    const float maxWidth = values.empty() ? 0.0f : *std::max_element(values.cbegin(), values.cend());
+    return ::toExtent(::computeBounds(points, [](size_t) { return 0.0f; }), maxWidth * 0.5f);
+}
+
+bool usdex::core::setExtentTimeSamples(UsdGeomPointBased pointBased)
+{
+    USDEX_INSTRUMENT_SCOPE("setExtentTimeSamples");
+
+    if (!pointBased)
+    {
+        TF_RUNTIME_ERROR("Unable to set extent time samples on an invalid UsdGeomPointBased");
+        return false;
+    }
+
+    const UsdPrim prim = pointBased.GetPrim();
+    const UsdAttribute pointsAttr = pointBased.GetPointsAttr();
+    if (!pointsAttr.HasAuthoredValue())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to set extent time samples on \"%s\" due to invalid points: No value authored",
+            prim.GetPath().GetAsString().c_str()
+        );
+        return false;
+    }
+
+    const SdfLayerHandle layer = prim.GetStage()->GetEditTarget().GetLayer();
+    if (!layer)
+    {
+        TF_RUNTIME_ERROR("Unable to set extent time samples on \"%s\" due to an invalid edit target", prim.GetPath().GetAsString().c_str());
+        return false;
+    }
+
+    // Gather the union of the point and width time samples
+    const ::WidthsSource widthsSource(prim);
+    std::vector<double> times;
+    pointsAttr.GetTimeSamples(&times);
+    widthsSource.appendTimeSamples(&times);
+    std::sort(times.begin(), times.end());
+    times.erase(std::unique(times.begin(), times.end()), times.end());
+
+    // The first entry accounts for the default value
+    std::vector<UsdTimeCode> timeCodes;
+    timeCodes.reserve(times.size() + 1);
+    timeCodes.push_back(UsdTimeCode::Default());
+    timeCodes.insert(timeCodes.end(), times.begin(), times.end());
+
+    std::vector<VtVec3fArray> extents(timeCodes.size());
+    std::vector<char> hasExtent(timeCodes.size(), 0);
+    WorkParallelForN(
+        timeCodes.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                VtVec3fArray points;
+                if (!pointsAttr.Get(&points, timeCodes[i]))
+                {
+                    continue;
+                }
+
+                const std::optional<FloatPrimvarData> widths = widthsSource.get(timeCodes[i]);
+                extents[i] = widths.has_value() ? computePointsExtent(points, widths.value()) : computePointsExtent(points);
+                hasExtent[i] = 1;
+            }
+        },
+        1
+    );
+
+    // Replace any existing opinions and write the extents directly to the layer, avoiding the per value overhead of UsdAttribute::Set
+    UsdAttribute extentAttr = pointBased.CreateExtentAttr();
+    extentAttr.Clear();
+    const UsdEditTarget& editTarget = prim.GetStage()->GetEditTarget();
+    const SdfPath specPath = editTarget.MapToSpecPath(extentAttr.GetPath());
+    const SdfLayerOffset stageToLayerOffset = editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+    {
+        SdfChangeBlock changeBlock;
+        if (hasExtent[0])
+        {
+            layer->SetField(specPath, SdfFieldKeys->Default, VtValue(extents[0]));
+        }
+        for (size_t i = 1; i < timeCodes.size(); ++i)
+        {
+            if (hasExtent[i])
+            {
+                layer->SetTimeSample(specPath, stageToLayerOffset * timeCodes[i].GetValue(), extents[i]);
+            }
+        }
+    }
+
+    return true;
+}
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -6,22 +6,183 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+#include "PrimSpecWriter.h"
+#include "UnchangedValues.h"
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/gf/range3d.h>
 #include <pxr/base/gf/vec3f.h>
-#include <pxr/usd/usdGeom/boundable.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/usdGeom/capsule.h>
 #include <pxr/usd/usdGeom/cone.h>
 #include <pxr/usd/usdGeom/cube.h>
 #include <pxr/usd/usdGeom/cylinder.h>
 #include <pxr/usd/usdGeom/plane.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
+#include <pxr/usd/usdGeom/scope.h>
 #include <pxr/usd/usdGeom/sphere.h>
 
 #include <algorithm>
 #include <limits>
+#include <map>
 #include <optional>
+#include <tuple>
+#include <unordered_set>
 
 using namespace pxr;
 
+namespace
+{
+
+void setDisplayPrimvarSpecs(
+    usdex::core::detail::PrimSpecWriter& writer,
+    const std::optional<GfVec3f>& displayColor,
+    const std::optional<float>& displayOpacity
+)
+{
+    if (displayColor.has_value())
+    {
+        writer.setAttribute(UsdGeomTokens->primvarsDisplayColor, VtValue(VtArray<GfVec3f>{ displayColor.value() }));
+    }
+
+    if (displayOpacity.has_value())
+    {
+        writer.setAttribute(UsdGeomTokens->primvarsDisplayOpacity, VtValue(VtArray<float>{ displayOpacity.value() }));
+    }
+}
+
+const TfToken& getGprimTypeName(usdex::core::GprimData::Type type)
+{
+    static const TfToken s_planeTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomPlane>();
+    static const TfToken s_sphereTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomSphere>();
+    static const TfToken s_cubeTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomCube>();
+    static const TfToken s_coneTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomCone>();
+    static const TfToken s_cylinderTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomCylinder>();
+    static const TfToken s_capsuleTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomCapsule>();
+    switch (type)
+    {
+        case usdex::core::GprimData::Type::Plane:
+            return s_planeTypeName;
+        case usdex::core::GprimData::Type::Cube:
+            return s_cubeTypeName;
+        case usdex::core::GprimData::Type::Cone:
+            return s_coneTypeName;
+        case usdex::core::GprimData::Type::Cylinder:
+            return s_cylinderTypeName;
+        case usdex::core::GprimData::Type::Capsule:
+            return s_capsuleTypeName;
+        case usdex::core::GprimData::Type::Sphere:
+        default:
+            return s_sphereTypeName;
+    }
+}
+
+VtVec3fArray computeGprimExtent(const usdex::core::GprimData& gprim)
+{
+    VtVec3fArray extent;
+    switch (gprim.type)
+    {
+        case usdex::core::GprimData::Type::Plane:
+            UsdGeomPlane::ComputeExtent(gprim.width, gprim.length, gprim.axis, &extent);
+            break;
+        case usdex::core::GprimData::Type::Sphere:
+            UsdGeomSphere::ComputeExtent(gprim.radius, &extent);
+            break;
+        case usdex::core::GprimData::Type::Cube:
+            UsdGeomCube::ComputeExtent(gprim.size, &extent);
+            break;
+        case usdex::core::GprimData::Type::Cone:
+            UsdGeomCone::ComputeExtent(gprim.height, gprim.radius, gprim.axis, &extent);
+            break;
+        case usdex::core::GprimData::Type::Cylinder:
+            UsdGeomCylinder::ComputeExtent(gprim.height, gprim.radius, gprim.axis, &extent);
+            break;
+        case usdex::core::GprimData::Type::Capsule:
+            UsdGeomCapsule::ComputeExtent(gprim.height, gprim.radius, gprim.axis, &extent);
+            break;
+    }
+    return extent;
+}
+
+// Author the same specs as the BulkAuthoringScope mode of the define function matching the type of the gprim
+void setGprimSpecs(usdex::core::detail::PrimSpecWriter& writer, const usdex::core::GprimData& gprim, const VtVec3fArray& extent)
+{
+    switch (gprim.type)
+    {
+        case usdex::core::GprimData::Type::Plane:
+            writer.setAttribute(UsdGeomTokens->axis, VtValue(gprim.axis));
+            writer.setAttribute(UsdGeomTokens->width, VtValue(gprim.width));
+            writer.setAttribute(UsdGeomTokens->length, VtValue(gprim.length));
+            break;
+        case usdex::core::GprimData::Type::Sphere:
+            writer.setAttribute(UsdGeomTokens->radius, VtValue(gprim.radius));
+            break;
+        case usdex::core::GprimData::Type::Cube:
+            writer.setAttribute(UsdGeomTokens->size, VtValue(gprim.size));
+            break;
+        case usdex::core::GprimData::Type::Cone:
+        case usdex::core::GprimData::Type::Cylinder:
+        case usdex::core::GprimData::Type::Capsule:
+            writer.setAttribute(UsdGeomTokens->axis, VtValue(gprim.axis));
+            writer.setAttribute(UsdGeomTokens->radius, VtValue(gprim.radius));
+            writer.setAttribute(UsdGeomTokens->height, VtValue(gprim.height));
+            break;
+    }
+    ::setDisplayPrimvarSpecs(writer, gprim.displayColor, gprim.displayOpacity);
+    writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+}
+
+// The parameters which distinguish the prototypes of a gprim instancer. Members which do not apply to the type of the gprim are zeroed, so that
+// they do not prevent otherwise identical gprims from sharing a prototype.
+using GprimKey = std::tuple<int, double, double, TfToken, bool, float, float, float, bool, float>;
+
+GprimKey getGprimKey(const usdex::core::GprimData& gprim)
+{
+    double first = 0.0;
+    double second = 0.0;
+    TfToken axis;
+    switch (gprim.type)
+    {
+        case usdex::core::GprimData::Type::Plane:
+            first = gprim.width;
+            second = gprim.length;
+            axis = gprim.axis;
+            break;
+        case usdex::core::GprimData::Type::Sphere:
+            first = gprim.radius;
+            break;
+        case usdex::core::GprimData::Type::Cube:
+            first = gprim.size;
+            break;
+        case usdex::core::GprimData::Type::Cone:
+        case usdex::core::GprimData::Type::Cylinder:
+        case usdex::core::GprimData::Type::Capsule:
+            first = gprim.radius;
+            second = gprim.height;
+            axis = gprim.axis;
+            break;
+    }
+
+    const GfVec3f displayColor = gprim.displayColor.value_or(GfVec3f(0.0f));
+    return GprimKey(
+        static_cast<int>(gprim.type),
+        first,
+        second,
+        axis,
+        gprim.displayColor.has_value(),
+        displayColor[0],
+        displayColor[1],
+        displayColor[2],
+        gprim.displayOpacity.has_value(),
+        gprim.displayOpacity.value_or(0.0f)
+    );
+}
+
+} // namespace
 
 UsdGeomPlane usdex::core::definePlane(
     UsdStagePtr stage,
@@ -33,14 +194,37 @@ UsdGeomPlane usdex::core::definePlane(
     const std::optional<float> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePlane");
+
     // Early out if the proposed prim location is invalid
     std::string _reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &_reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomPlane due to an invalid location: %s", _reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomPlane due to an invalid location: %s", _reason.c_str());
         return UsdGeomPlane();
     }
 
+    // Compute the extent in closed form from the arguments
+    VtVec3fArray extent;
+    UsdGeomPlane::ComputeExtent(width, length, axis, &extent);
+
+    // Author the specs directly to the edit target layer
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        return usdex::core::detail::defineWithSpecs<UsdGeomPlane>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->axis, VtValue(axis));
+                writer.setAttribute(UsdGeomTokens->width, VtValue(width));
+                writer.setAttribute(UsdGeomTokens->length, VtValue(length));
+                ::setDisplayPrimvarSpecs(writer, displayColor, displayOpacity);
+                writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+            }
+        );
+    }
+
     UsdGeomPlane plane = UsdGeomPlane::Define(stage, path);
     if (!plane)
     {
@@ -53,24 +237,22 @@ UsdGeomPlane usdex::core::definePlane(
     prim.SetSpecifier(SdfSpecifierDef);
     prim.SetTypeName(prim.GetTypeName());
 
-    plane.GetAxisAttr().Set(axis);
-    plane.GetWidthAttr().Set(width);
-    plane.GetLengthAttr().Set(length);
+    detail::setAttributeValue(plane.GetAxisAttr(), axis);
+    detail::setAttributeValue(plane.GetWidthAttr(), width);
+    detail::setAttributeValue(plane.GetLengthAttr(), length);
 
     if (displayColor.has_value())
     {
-        plane.GetDisplayColorAttr().Set(VtArray<GfVec3f>{ displayColor.value() });
+        detail::setAttributeValue(plane.GetDisplayColorAttr(), VtArray<GfVec3f>{ displayColor.value() });
     }
 
     if (displayOpacity.has_value())
     {
-        plane.GetDisplayOpacityAttr().Set(VtArray<float>{ displayOpacity.value() });
+        detail::setAttributeValue(plane.GetDisplayOpacityAttr(), VtArray<float>{ displayOpacity.value() });
     }
 
     // Set extent.
-    pxr::VtArray<pxr::GfVec3f> extent;
-    pxr::UsdGeomBoundable::ComputeExtentFromPlugins(plane, pxr::UsdTimeCode::Default(), &extent);
-    plane.GetExtentAttr().Set(extent);
+    detail::setAttributeValue(plane.GetExtentAttr(), extent);
 
     return plane;
 }
@@ -89,7 +271,12 @@ UsdGeomPlane usdex::core::definePlane(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomPlane due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomPlane due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomPlane();
     }
 
@@ -141,7 +328,7 @@ UsdGeomPlane usdex::core::definePlane(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomPlane due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(prim.GetPath(), eInvalidLocation, "Unable to define UsdGeomPlane due to an invalid location: %s", reason.c_str());
         return UsdGeomPlane();
     }
 
@@ -158,14 +345,35 @@ UsdGeomSphere usdex::core::defineSphere(
     const std::optional<float> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineSphere");
+
     // Early out if the proposed prim location is invalid
     std::string _reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &_reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomSphere due to an invalid location: %s", _reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomSphere due to an invalid location: %s", _reason.c_str());
         return UsdGeomSphere();
     }
 
+    // Compute the extent in closed form from the arguments
+    VtVec3fArray extent;
+    UsdGeomSphere::ComputeExtent(radius, &extent);
+
+    // Author the specs directly to the edit target layer
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        return usdex::core::detail::defineWithSpecs<UsdGeomSphere>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->radius, VtValue(radius));
+                ::setDisplayPrimvarSpecs(writer, displayColor, displayOpacity);
+                writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+            }
+        );
+    }
+
     UsdGeomSphere sphere = UsdGeomSphere::Define(stage, path);
     if (!sphere)
     {
@@ -178,22 +386,20 @@ UsdGeomSphere usdex::core::defineSphere(
     prim.SetSpecifier(SdfSpecifierDef);
     prim.SetTypeName(prim.GetTypeName());
 
-    sphere.GetRadiusAttr().Set(radius);
+    detail::setAttributeValue(sphere.GetRadiusAttr(), radius);
 
     if (displayColor.has_value())
     {
-        sphere.GetDisplayColorAttr().Set(VtArray<GfVec3f>{ displayColor.value() });
+        detail::setAttributeValue(sphere.GetDisplayColorAttr(), VtArray<GfVec3f>{ displayColor.value() });
     }
 
     if (displayOpacity.has_value())
     {
-        sphere.GetDisplayOpacityAttr().Set(VtArray<float>{ displayOpacity.value() });
+        detail::setAttributeValue(sphere.GetDisplayOpacityAttr(), VtArray<float>{ displayOpacity.value() });
     }
 
     // Set extent.
-    pxr::VtArray<pxr::GfVec3f> extent;
-    pxr::UsdGeomBoundable::ComputeExtentFromPlugins(sphere, pxr::UsdTimeCode::Default(), &extent);
-    sphere.GetExtentAttr().Set(extent);
+    detail::setAttributeValue(sphere.GetExtentAttr(), extent);
 
     return sphere;
 }
@@ -210,7 +416,12 @@ UsdGeomSphere usdex::core::defineSphere(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomSphere due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomSphere due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomSphere();
     }
 
@@ -260,7 +471,7 @@ UsdGeomSphere usdex::core::defineSphere(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomSphere due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(prim.GetPath(), eInvalidLocation, "Unable to define UsdGeomSphere due to an invalid location: %s", reason.c_str());
         return UsdGeomSphere();
     }
 
@@ -277,14 +488,35 @@ UsdGeomCube usdex::core::defineCube(
     const std::optional<float> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineCube");
+
     // Early out if the proposed prim location is invalid
     std::string _reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &_reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCube due to an invalid location: %s", _reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomCube due to an invalid location: %s", _reason.c_str());
         return UsdGeomCube();
     }
 
+    // Compute the extent in closed form from the arguments
+    VtVec3fArray extent;
+    UsdGeomCube::ComputeExtent(size, &extent);
+
+    // Author the specs directly to the edit target layer
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        return usdex::core::detail::defineWithSpecs<UsdGeomCube>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->size, VtValue(size));
+                ::setDisplayPrimvarSpecs(writer, displayColor, displayOpacity);
+                writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+            }
+        );
+    }
+
     UsdGeomCube cube = UsdGeomCube::Define(stage, path);
     if (!cube)
     {
@@ -297,22 +529,20 @@ UsdGeomCube usdex::core::defineCube(
     prim.SetSpecifier(SdfSpecifierDef);
     prim.SetTypeName(prim.GetTypeName());
 
-    cube.GetSizeAttr().Set(size);
+    detail::setAttributeValue(cube.GetSizeAttr(), size);
 
     if (displayColor.has_value())
     {
-        cube.GetDisplayColorAttr().Set(VtArray<GfVec3f>{ displayColor.value() });
+        detail::setAttributeValue(cube.GetDisplayColorAttr(), VtArray<GfVec3f>{ displayColor.value() });
     }
 
     if (displayOpacity.has_value())
     {
-        cube.GetDisplayOpacityAttr().Set(VtArray<float>{ displayOpacity.value() });
+        detail::setAttributeValue(cube.GetDisplayOpacityAttr(), VtArray<float>{ displayOpacity.value() });
     }
 
     // Set extent.
-    pxr::VtArray<pxr::GfVec3f> extent;
-    pxr::UsdGeomBoundable::ComputeExtentFromPlugins(cube, pxr::UsdTimeCode::Default(), &extent);
-    cube.GetExtentAttr().Set(extent);
+    detail::setAttributeValue(cube.GetExtentAttr(), extent);
 
     return cube;
 }
@@ -329,7 +559,12 @@ UsdGeomCube usdex::core::defineCube(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCube due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomCube due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomCube();
     }
 
@@ -379,7 +614,7 @@ UsdGeomCube usdex::core::defineCube(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCube due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(prim.GetPath(), eInvalidLocation, "Unable to define UsdGeomCube due to an invalid location: %s", reason.c_str());
         return UsdGeomCube();
     }
 
@@ -398,14 +633,37 @@ UsdGeomCone usdex::core::defineCone(
     const std::optional<float> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineCone");
+
     // Early out if the proposed prim location is invalid
     std::string _reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &_reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCone due to an invalid location: %s", _reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomCone due to an invalid location: %s", _reason.c_str());
         return UsdGeomCone();
     }
 
+    // Compute the extent in closed form from the arguments
+    VtVec3fArray extent;
+    UsdGeomCone::ComputeExtent(height, radius, axis, &extent);
+
+    // Author the specs directly to the edit target layer
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        return usdex::core::detail::defineWithSpecs<UsdGeomCone>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->axis, VtValue(axis));
+                writer.setAttribute(UsdGeomTokens->radius, VtValue(radius));
+                writer.setAttribute(UsdGeomTokens->height, VtValue(height));
+                ::setDisplayPrimvarSpecs(writer, displayColor, displayOpacity);
+                writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+            }
+        );
+    }
+
     UsdGeomCone cone = UsdGeomCone::Define(stage, path);
     if (!cone)
     {
@@ -418,24 +676,22 @@ UsdGeomCone usdex::core::defineCone(
     prim.SetSpecifier(SdfSpecifierDef);
     prim.SetTypeName(prim.GetTypeName());
 
-    cone.GetAxisAttr().Set(axis);
-    cone.GetRadiusAttr().Set(radius);
-    cone.GetHeightAttr().Set(height);
+    detail::setAttributeValue(cone.GetAxisAttr(), axis);
+    detail::setAttributeValue(cone.GetRadiusAttr(), radius);
+    detail::setAttributeValue(cone.GetHeightAttr(), height);
 
     if (displayColor.has_value())
     {
-        cone.GetDisplayColorAttr().Set(VtArray<GfVec3f>{ displayColor.value() });
+        detail::setAttributeValue(cone.GetDisplayColorAttr(), VtArray<GfVec3f>{ displayColor.value() });
     }
 
     if (displayOpacity.has_value())
     {
-        cone.GetDisplayOpacityAttr().Set(VtArray<float>{ displayOpacity.value() });
+        detail::setAttributeValue(cone.GetDisplayOpacityAttr(), VtArray<float>{ displayOpacity.value() });
     }
 
     // Set extent.
-    pxr::VtArray<pxr::GfVec3f> extent;
-    pxr::UsdGeomBoundable::ComputeExtentFromPlugins(cone, pxr::UsdTimeCode::Default(), &extent);
-    cone.GetExtentAttr().Set(extent);
+    detail::setAttributeValue(cone.GetExtentAttr(), extent);
 
     return cone;
 }
@@ -454,7 +710,12 @@ UsdGeomCone usdex::core::defineCone(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCone due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomCone due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomCone();
     }
 
@@ -506,7 +767,7 @@ UsdGeomCone usdex::core::defineCone(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCone due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(prim.GetPath(), eInvalidLocation, "Unable to define UsdGeomCone due to an invalid location: %s", reason.c_str());
         return UsdGeomCone();
     }
 
@@ -525,14 +786,37 @@ UsdGeomCylinder usdex::core::defineCylinder(
     const std::optional<float> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineCylinder");
+
     // Early out if the proposed prim location is invalid
     std::string _reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &_reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCylinder due to an invalid location: %s", _reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomCylinder due to an invalid location: %s", _reason.c_str());
         return UsdGeomCylinder();
     }
 
+    // Compute the extent in closed form from the arguments
+    VtVec3fArray extent;
+    UsdGeomCylinder::ComputeExtent(height, radius, axis, &extent);
+
+    // Author the specs directly to the edit target layer
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        return usdex::core::detail::defineWithSpecs<UsdGeomCylinder>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->axis, VtValue(axis));
+                writer.setAttribute(UsdGeomTokens->radius, VtValue(radius));
+                writer.setAttribute(UsdGeomTokens->height, VtValue(height));
+                ::setDisplayPrimvarSpecs(writer, displayColor, displayOpacity);
+                writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+            }
+        );
+    }
+
     UsdGeomCylinder cylinder = UsdGeomCylinder::Define(stage, path);
     if (!cylinder)
     {
@@ -545,24 +829,22 @@ UsdGeomCylinder usdex::core::defineCylinder(
     prim.SetSpecifier(SdfSpecifierDef);
     prim.SetTypeName(prim.GetTypeName());
 
-    cylinder.GetAxisAttr().Set(axis);
-    cylinder.GetRadiusAttr().Set(radius);
-    cylinder.GetHeightAttr().Set(height);
+    detail::setAttributeValue(cylinder.GetAxisAttr(), axis);
+    detail::setAttributeValue(cylinder.GetRadiusAttr(), radius);
+    detail::setAttributeValue(cylinder.GetHeightAttr(), height);
 
     if (displayColor.has_value())
     {
-        cylinder.GetDisplayColorAttr().Set(VtArray<GfVec3f>{ displayColor.value() });
+        detail::setAttributeValue(cylinder.GetDisplayColorAttr(), VtArray<GfVec3f>{ displayColor.value() });
     }
 
     if (displayOpacity.has_value())
     {
-        cylinder.GetDisplayOpacityAttr().Set(VtArray<float>{ displayOpacity.value() });
+        detail::setAttributeValue(cylinder.GetDisplayOpacityAttr(), VtArray<float>{ displayOpacity.value() });
     }
 
     // Set extent.
-    pxr::VtArray<pxr::GfVec3f> extent;
-    pxr::UsdGeomBoundable::ComputeExtentFromPlugins(cylinder, pxr::UsdTimeCode::Default(), &extent);
-    cylinder.GetExtentAttr().Set(extent);
+    detail::setAttributeValue(cylinder.GetExtentAttr(), extent);
 
     return cylinder;
 }
@@ -581,7 +863,12 @@ UsdGeomCylinder usdex::core::defineCylinder(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCylinder due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomCylinder due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomCylinder();
     }
 
@@ -633,7 +920,7 @@ UsdGeomCylinder usdex::core::defineCylinder(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCylinder due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(prim.GetPath(), eInvalidLocation, "Unable to define UsdGeomCylinder due to an invalid location: %s", reason.c_str());
         return UsdGeomCylinder();
     }
 
@@ -652,14 +939,37 @@ UsdGeomCapsule usdex::core::defineCapsule(
     const std::optional<float> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineCapsule");
+
     // Early out if the proposed prim location is invalid
     std::string _reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &_reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCapsule due to an invalid location: %s", _reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomCapsule due to an invalid location: %s", _reason.c_str());
         return UsdGeomCapsule();
     }
 
+    // Compute the extent in closed form from the arguments
+    VtVec3fArray extent;
+    UsdGeomCapsule::ComputeExtent(height, radius, axis, &extent);
+
+    // Author the specs directly to the edit target layer
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        return usdex::core::detail::defineWithSpecs<UsdGeomCapsule>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->axis, VtValue(axis));
+                writer.setAttribute(UsdGeomTokens->radius, VtValue(radius));
+                writer.setAttribute(UsdGeomTokens->height, VtValue(height));
+                ::setDisplayPrimvarSpecs(writer, displayColor, displayOpacity);
+                writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+            }
+        );
+    }
+
     UsdGeomCapsule capsule = UsdGeomCapsule::Define(stage, path);
     if (!capsule)
     {
@@ -672,24 +982,22 @@ UsdGeomCapsule usdex::core::defineCapsule(
     prim.SetSpecifier(SdfSpecifierDef);
     prim.SetTypeName(prim.GetTypeName());
 
-    capsule.GetAxisAttr().Set(axis);
-    capsule.GetRadiusAttr().Set(radius);
-    capsule.GetHeightAttr().Set(height);
+    detail::setAttributeValue(capsule.GetAxisAttr(), axis);
+    detail::setAttributeValue(capsule.GetRadiusAttr(), radius);
+    detail::setAttributeValue(capsule.GetHeightAttr(), height);
 
     if (displayColor.has_value())
     {
-        capsule.GetDisplayColorAttr().Set(VtArray<GfVec3f>{ displayColor.value() });
+        detail::setAttributeValue(capsule.GetDisplayColorAttr(), VtArray<GfVec3f>{ displayColor.value() });
     }
 
     if (displayOpacity.has_value())
     {
-        capsule.GetDisplayOpacityAttr().Set(VtArray<float>{ displayOpacity.value() });
+        detail::setAttributeValue(capsule.GetDisplayOpacityAttr(), VtArray<float>{ displayOpacity.value() });
     }
 
     // Set extent.
-    pxr::VtArray<pxr::GfVec3f> extent;
-    pxr::UsdGeomBoundable::ComputeExtentFromPlugins(capsule, pxr::UsdTimeCode::Default(), &extent);
-    capsule.GetExtentAttr().Set(extent);
+    detail::setAttributeValue(capsule.GetExtentAttr(), extent);
 
     return capsule;
 }
@@ -708,7 +1016,12 @@ UsdGeomCapsule usdex::core::defineCapsule(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCapsule due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomCapsule due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomCapsule();
     }
 
@@ -760,7 +1073,7 @@ UsdGeomCapsule usdex::core::defineCapsule(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomCapsule due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(prim.GetPath(), eInvalidLocation, "Unable to define UsdGeomCapsule due to an invalid location: %s", reason.c_str());
         return UsdGeomCapsule();
     }
 
@@ -768,3 +1081,204 @@ UsdGeomCapsule usdex::core::defineCapsule(
     const SdfPath path = prim.GetPath();
     return usdex::core::defineCapsule(stage, path, radius, height, axis, displayColor, displayOpacity);
 }
+
+std::vector<UsdGeomGprim> usdex::core::defineGprims(UsdStagePtr stage, const std::vector<GprimData>& gprims)
+{
+    USDEX_INSTRUMENT_SCOPE("defineGprims");
+
+    // Early out if the stage is invalid
+    if (!stage)
+    {
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidStage, "Unable to define UsdGeomGprims due to an invalid stage");
+        return {};
+    }
+
+    if (gprims.empty())
+    {
+        return {};
+    }
+
+    // Validate every location before authoring any scene description
+    SdfPathVector gprimPaths;
+    gprimPaths.reserve(gprims.size());
+    for (const GprimData& gprim : gprims)
+    {
+        gprimPaths.push_back(gprim.path);
+    }
+    std::unordered_set<SdfPath, SdfPath::Hash> paths;
+    if (!usdex::core::detail::validateBatchLocations(TF_CALL_CONTEXT, stage, gprimPaths, "UsdGeomGprim", &paths))
+    {
+        return {};
+    }
+
+    // Author all of the gprims directly in the edit target layer, so that change processing occurs once for the entire batch
+    {
+        SdfChangeBlock changeBlock;
+
+        usdex::core::detail::defineUndefinedAncestors(stage, paths);
+
+        for (const GprimData& gprim : gprims)
+        {
+            usdex::core::detail::PrimSpecWriter writer(stage, gprim.path, ::getGprimTypeName(gprim.type));
+            if (!writer.isValid())
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomGprim at \"%s\"", gprim.path.GetAsString().c_str());
+                continue;
+            }
+            ::setGprimSpecs(writer, gprim, ::computeGprimExtent(gprim));
+        }
+    }
+
+    // The change block has closed, so the stage has recomposed the new prims
+    std::vector<UsdGeomGprim> result;
+    result.reserve(gprims.size());
+    for (const GprimData& gprim : gprims)
+    {
+        UsdGeomGprim schema(stage->GetPrimAtPath(gprim.path));
+        if (!schema)
+        {
+            TF_RUNTIME_ERROR("Unable to define UsdGeomGprim at \"%s\"", gprim.path.GetAsString().c_str());
+        }
+        result.push_back(schema);
+    }
+
+    return result;
+}
+
+UsdGeomPointInstancer usdex::core::defineGprimInstancer(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const std::vector<GprimData>& gprims,
+    const VtVec3fArray& positions,
+    const std::vector<GfQuatf>& orientations
+)
+{
+    USDEX_INSTRUMENT_SCOPE("defineGprimInstancer");
+    USDEX_INSTRUMENT_ARRAY(positions);
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomPointInstancer due to an invalid location: %s", reason.c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    if (gprims.empty())
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomPointInstancer at \"%s\" without any gprims", path.GetAsString().c_str());
+        return UsdGeomPointInstancer();
+    }
+
+    if (positions.size() != gprims.size())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdGeomPointInstancer at \"%s\" due to mismatched sizes: %zu gprims and %zu positions",
+            path.GetAsString().c_str(),
+            gprims.size(),
+            positions.size()
+        );
+        return UsdGeomPointInstancer();
+    }
+
+    if (!orientations.empty() && orientations.size() != gprims.size())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdGeomPointInstancer at \"%s\" due to mismatched sizes: %zu gprims and %zu orientations",
+            path.GetAsString().c_str(),
+            gprims.size(),
+            orientations.size()
+        );
+        return UsdGeomPointInstancer();
+    }
+
+    // Share a prototype between all gprims with identical parameters
+    std::map<GprimKey, int> prototypeIndices;
+    std::vector<size_t> prototypeGprims;
+    VtIntArray protoIndices(gprims.size());
+    for (size_t i = 0; i < gprims.size(); ++i)
+    {
+        auto it = prototypeIndices.emplace(::getGprimKey(gprims[i]), static_cast<int>(prototypeGprims.size()));
+        if (it.second)
+        {
+            prototypeGprims.push_back(i);
+        }
+        protoIndices[i] = it.first->second;
+    }
+
+    std::vector<VtVec3fArray> prototypeExtents(prototypeGprims.size());
+    for (size_t i = 0; i < prototypeGprims.size(); ++i)
+    {
+        prototypeExtents[i] = ::computeGprimExtent(gprims[prototypeGprims[i]]);
+    }
+
+    // The extent of the instancer is the union of the extent of every prototype placed at each instance
+    GfRange3d range;
+    VtQuathArray quaternions(orientations.size());
+    for (size_t i = 0; i < gprims.size(); ++i)
+    {
+        const VtVec3fArray& extent = prototypeExtents[protoIndices[i]];
+        GfMatrix4d transform(1.0);
+        if (!orientations.empty())
+        {
+            quaternions[i] = GfQuath(orientations[i]);
+            transform.SetRotate(GfQuatd(orientations[i]));
+        }
+        transform.SetTranslateOnly(GfVec3d(positions[i]));
+        range.UnionWith(GfBBox3d(GfRange3d(GfVec3d(extent[0]), GfVec3d(extent[1])), transform).ComputeAlignedRange());
+    }
+
+    static const TfToken s_prototypesName("Prototypes");
+    const SdfPath prototypesPath = path.AppendChild(s_prototypesName);
+    SdfPathVector prototypePaths(prototypeGprims.size());
+    for (size_t i = 0; i < prototypeGprims.size(); ++i)
+    {
+        const GprimData& gprim = gprims[prototypeGprims[i]];
+        prototypePaths[i] = prototypesPath.AppendChild(TfToken(TfStringPrintf("%s_%zu", ::getGprimTypeName(gprim.type).GetText(), i)));
+    }
+
+    // Author the instancer and its prototypes directly in the edit target layer, so that change processing occurs once
+    {
+        SdfChangeBlock changeBlock;
+
+        std::vector<usdex::core::detail::AuthoredAncestor> ancestors;
+        usdex::core::detail::defineUndefinedAncestors(stage, { path }, &ancestors);
+
+        {
+            usdex::core::detail::PrimSpecWriter writer(stage, path, UsdSchemaRegistry::GetSchemaTypeName<UsdGeomPointInstancer>());
+            if (!writer.isValid())
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomPointInstancer at \"%s\"", path.GetAsString().c_str());
+                usdex::core::detail::revertAuthoredAncestors(stage, ancestors);
+                return UsdGeomPointInstancer();
+            }
+            writer.setRelationshipTargets(UsdGeomTokens->prototypes, prototypePaths);
+            writer.setAttribute(UsdGeomTokens->protoIndices, VtValue(protoIndices));
+            writer.setAttribute(UsdGeomTokens->positions, VtValue(positions));
+            if (!orientations.empty())
+            {
+                writer.setAttribute(UsdGeomTokens->orientations, VtValue(quaternions));
+            }
+            writer.setAttribute(UsdGeomTokens->extent, VtValue(VtVec3fArray{ GfVec3f(range.GetMin()), GfVec3f(range.GetMax()) }));
+        }
+
+        {
+            usdex::core::detail::PrimSpecWriter writer(stage, prototypesPath, UsdSchemaRegistry::GetSchemaTypeName<UsdGeomScope>());
+        }
+
+        for (size_t i = 0; i < prototypeGprims.size(); ++i)
+        {
+            const GprimData& gprim = gprims[prototypeGprims[i]];
+            usdex::core::detail::PrimSpecWriter writer(stage, prototypePaths[i], ::getGprimTypeName(gprim.type));
+            if (!writer.isValid())
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomGprim at \"%s\"", prototypePaths[i].GetAsString().c_str());
+                continue;
+            }
+            ::setGprimSpecs(writer, gprim, prototypeExtents[i]);
+        }
+    }
+
+    // The change block has closed, so the stage has recomposed the new prims
+    return UsdGeomPointInstancer(stage->GetPrimAtPath(path));
+}
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "usdex/core/Instrumentation.h"
+
+#include "usdex/core/Settings.h"
+
+#include "Instrumentation.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+using namespace pxr;
+
+namespace
+{
+
+struct InstrumentationRegistry
+{
+    std::mutex mutex;
+    std::vector<usdex::core::detail::InstrumentationSite*> sites;
+};
+
+InstrumentationRegistry& getRegistry()
+{
+    // Intentionally leaked as sites may be recorded during static destruction
+    static InstrumentationRegistry* s_registry = new InstrumentationRegistry();
+    return *s_registry;
+}
+
+} // namespace
+
+std::atomic<bool> usdex::core::detail::g_instrumentationEnabled(TfGetEnvSetting(usdex::core::USDEX_ENABLE_INSTRUMENTATION));
+
+usdex::core::detail::InstrumentationSite::InstrumentationSite(const char* name)
+    : name(name), calls(0), nanoseconds(0), maxNanoseconds(0), bytes(0)
+{
+    InstrumentationRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.sites.push_back(this);
+}
+
+void usdex::core::detail::InstrumentationSite::record(uint64_t value, uint64_t numBytes)
+{
+    calls.fetch_add(1, std::memory_order_relaxed);
+    nanoseconds.fetch_add(value, std::memory_order_relaxed);
+    bytes.fetch_add(numBytes, std::memory_order_relaxed);
+
+    uint64_t current = maxNanoseconds.load(std::memory_order_relaxed);
+    while (value > current && !maxNanoseconds.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void usdex::core::detail::InstrumentationSite::reset()
+{
+    calls.store(0, std::memory_order_relaxed);
+    nanoseconds.store(0, std::memory_order_relaxed);
+    maxNanoseconds.store(0, std::memory_order_relaxed);
+    bytes.store(0, std::memory_order_relaxed);
+}
+
+bool usdex::core::isInstrumentationEnabled()
+{
+    return detail::g_instrumentationEnabled.load(std::memory_order_relaxed);
+}
+
+void usdex::core::setInstrumentationEnabled(bool value)
+{
+    detail::g_instrumentationEnabled.store(value, std::memory_order_relaxed);
+}
+
+std::vector<usdex::core::InstrumentationCounter> usdex::core::getInstrumentationCounters()
+{
+    // Aggregate by name, in case several sites share a name
+    std::map<std::string, InstrumentationCounter> counters;
+    {
+        InstrumentationRegistry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (const detail::InstrumentationSite* site : registry.sites)
+        {
+            const uint64_t calls = site->calls.load(std::memory_order_relaxed);
+            if (calls == 0)
+            {
+                continue;
+            }
+
+            InstrumentationCounter& counter = counters[site->name];
+            counter.name = site->name;
+            counter.calls += calls;
+            counter.totalSeconds += static_cast<double>(site->nanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+            counter.maxSeconds = std::max(counter.maxSeconds, static_cast<double>(site->maxNanoseconds.load(std::memory_order_relaxed)) * 1e-9);
+            counter.bytes += site->bytes.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::vector<InstrumentationCounter> result;
+    result.reserve(counters.size());
+    for (auto& entry : counters)
+    {
+        result.push_back(std::move(entry.second));
+    }
+    return result;
+}
+
+void usdex::core::resetInstrumentationCounters()
+{
+    InstrumentationRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (detail::InstrumentationSite* site : registry.sites)
+    {
+        site->reset();
+    }
+}
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+// Define USDEX_INSTRUMENTATION=0 to compile out all instrumentation
+#ifndef USDEX_INSTRUMENTATION
+#define USDEX_INSTRUMENTATION 1
+#endif
+
+namespace usdex::core::detail
+{
+
+//! Whether instrumented functions should record measurements.
+extern std::atomic<bool> g_instrumentationEnabled;
+
+//! The measurements of a single instrumented location.
+//!
+//! Sites are expected to be function local statics. Each site registers itself on construction and is never destroyed.
+class InstrumentationSite
+{
+public:
+
+    explicit InstrumentationSite(const char* name);
+
+    void record(uint64_t value, uint64_t numBytes);
+
+    void reset();
+
+    const char* name;
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> nanoseconds;
+    std::atomic<uint64_t> maxNanoseconds;
+    std::atomic<uint64_t> bytes;
+};
+
+//! Records the latency of the enclosing scope, and any bytes added, to an `InstrumentationSite`.
+class ScopedInstrumentation
+{
+public:
+
+    explicit ScopedInstrumentation(InstrumentationSite& site)
+        : m_site(g_instrumentationEnabled.load(std::memory_order_relaxed) ? &site : nullptr), m_bytes(0)
+    {
+        if (m_site)
+        {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedInstrumentation()
+    {
+        if (m_site)
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - m_start;
+            m_site->record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()), m_bytes);
+        }
+    }
+
+    ScopedInstrumentation(const ScopedInstrumentation&) = delete;
+    ScopedInstrumentation& operator=(const ScopedInstrumentation&) = delete;
+
+    //! Add the bytes of an array (e.g. `VtArray` or `std::vector`) to the measurement
+    template <typename ArrayType>
+    void addArray(const ArrayType& array)
+    {
+        if (m_site)
+        {
+            m_bytes += static_cast<uint64_t>(array.size() * sizeof(typename ArrayType::value_type));
+        }
+    }
+
+    //! Add the bytes of an optional array to the measurement
+    template <typename ArrayType>
+    void addArray(const std::optional<ArrayType>& array)
+    {
+        if (m_site && array.has_value())
+        {
+            addArray(array.value());
+        }
+    }
+
+    //! Add the bytes of an optional `PrimvarData` to the measurement
+    template <typename OptionalPrimvarType>
+    void addPrimvar(const OptionalPrimvarType& primvar)
+    {
+        if (m_site && primvar.has_value())
+        {
+            addArray(primvar->values());
+            if (primvar->hasIndices())
+            {
+                addArray(primvar->indices());
+            }
+        }
+    }
+
+private:
+
+    InstrumentationSite* m_site;
+    uint64_t m_bytes;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace usdex::core::detail
+
+#if USDEX_INSTRUMENTATION
+
+//! Record the latency of the enclosing scope under the given name
+#define USDEX_INSTRUMENT_SCOPE(name)                                                                                                                  \
+    static usdex::core::detail::InstrumentationSite _usdexInstrumentationSite(name);                                                                 \
+    usdex::core::detail::ScopedInstrumentation _usdexInstrumentationScope(_usdexInstrumentationSite)
+
+//! Add the bytes of an array to the measurement of the enclosing instrumented scope
+#define USDEX_INSTRUMENT_ARRAY(array) _usdexInstrumentationScope.addArray(array)
+
+//! Add the bytes of an optional `PrimvarData` to the measurement of the enclosing instrumented scope
+#define USDEX_INSTRUMENT_PRIMVAR(primvar) _usdexInstrumentationScope.addPrimvar(primvar)
+
+#else
+
+#define USDEX_INSTRUMENT_SCOPE(name)
+#define USDEX_INSTRUMENT_ARRAY(array)
+#define USDEX_INSTRUMENT_PRIMVAR(primvar)
+
+#endif
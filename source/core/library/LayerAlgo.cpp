@@ -1,10 +1,30 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
 #include "usdex/core/LayerAlgo.h"
 
+#include "Instrumentation.h"
+#include "LayerSnapshot.h"
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/fileUtils.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/vt/dictionary.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/changeList.h>
+#include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/namespaceEdit.h>
+#include <pxr/usd/sdf/notice.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/tokens.h>
 
 #if PXR_VERSION < 2511
 #include <pxr/usd/usd/usdFileFormat.h>
@@ -16,12 +36,422 @@
 #include <pxr/usd/sdf/usdcFileFormat.h>
 #endif
 
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 using namespace pxr;
 
 namespace
 {
 
 static constexpr const char* g_authoringKey = "creator";
+static constexpr const char* g_deltaKey = "usdex:delta";
+static constexpr const char* g_removedKey = "removed";
+static constexpr const char* g_replacedKey = "replaced";
+static constexpr const char* g_updatedKey = "updated";
+
+// Changes within variants are recorded on the prim which owns the variant set, and changes to target, connection, and mapper specs are
+// recorded on their owning property
+SdfPath getTrackedPath(const SdfPath& path)
+{
+    SdfPath result = path;
+    while (result.ContainsPrimVariantSelection())
+    {
+        result = result.GetParentPath();
+    }
+    while (!result.IsAbsoluteRootOrPrimPath() && !result.IsPrimPropertyPath())
+    {
+        result = result.GetParentPath();
+    }
+    return result;
+}
+
+// Whether a change affects more than the fields of the spec itself, in which case the entire spec must be copied
+bool isDeepChange(const SdfPath& path, const SdfPath& trackedPath, const SdfChangeList::Entry& entry)
+{
+    return path != trackedPath || trackedPath.IsPropertyPath() || entry.flags.didAddInertPrim || entry.flags.didAddNonInertPrim ||
+           entry.flags.didRename || entry.flags.didReorderChildren || entry.flags.didReorderProperties || entry.flags.didChangePrimVariantSets;
+}
+
+// The position of a spec amongst its siblings, so that it can be restored after the spec is replaced
+std::optional<int> getSiblingIndex(const SdfLayerHandle& layer, const SdfPath& path)
+{
+    const TfToken& key = path.IsPropertyPath() ? SdfChildrenKeys->PropertyChildren : SdfChildrenKeys->PrimChildren;
+    const TfTokenVector names = layer->GetFieldAs<TfTokenVector>(path.GetParentPath(), key);
+    const auto it = std::find(names.begin(), names.end(), path.GetNameToken());
+    if (it == names.end())
+    {
+        return std::nullopt;
+    }
+    return static_cast<int>(it - names.begin());
+}
+
+bool removeSpec(const SdfLayerHandle& layer, const SdfPath& path)
+{
+    SdfBatchNamespaceEdit edits;
+    edits.Add(SdfNamespaceEdit::Remove(path));
+    return layer->Apply(edits);
+}
+
+// Replace the spec at path in the target layer (including all of its descendants) with the spec from the source layer
+bool replaceSpec(const SdfLayerHandle& source, const SdfLayerHandle& target, const SdfPath& path)
+{
+    std::optional<int> index;
+    if (target->HasSpec(path))
+    {
+        index = ::getSiblingIndex(target, path);
+        if (!::removeSpec(target, path))
+        {
+            return false;
+        }
+    }
+
+    const SdfPath parentPath = path.GetParentPath();
+    if (!parentPath.IsAbsoluteRootPath() && !SdfJustCreatePrimInLayer(target, parentPath))
+    {
+        return false;
+    }
+
+    if (!SdfCopySpec(source, path, target, path))
+    {
+        return false;
+    }
+
+    if (index.has_value())
+    {
+        SdfBatchNamespaceEdit edits;
+        edits.Add(SdfNamespaceEdit::Reorder(path, index.value()));
+        return target->Apply(edits);
+    }
+
+    return true;
+}
+
+// Replace the fields of the spec at path in the target layer with those from the source layer, without affecting any descendant specs
+bool copyFields(const SdfLayerHandle& source, const SdfLayerHandle& target, const SdfPath& path)
+{
+    if (!path.IsAbsoluteRootPath() && !SdfJustCreatePrimInLayer(target, path))
+    {
+        return false;
+    }
+
+    const SdfSchema& schema = SdfSchema::GetInstance();
+    for (const TfToken& field : target->ListFields(path))
+    {
+        if (!schema.HoldsChildren(field) && !source->HasField(path, field))
+        {
+            target->EraseField(path, field);
+        }
+    }
+    for (const TfToken& field : source->ListFields(path))
+    {
+        if (!schema.HoldsChildren(field))
+        {
+            target->SetField(path, field, source->GetField(path, field));
+        }
+    }
+
+    return true;
+}
+
+void setDeltaMetadata(SdfLayerHandle layer, const VtStringArray& removed, const VtStringArray& replaced, const VtStringArray& updated)
+{
+    VtDictionary changes;
+    changes[g_removedKey] = removed;
+    changes[g_replacedKey] = replaced;
+    changes[g_updatedKey] = updated;
+
+    VtDictionary data = layer->GetCustomLayerData();
+    data[g_deltaKey] = changes;
+    layer->SetCustomLayerData(data);
+}
+
+void eraseDeltaMetadata(SdfLayerHandle layer)
+{
+    VtDictionary data = layer->GetCustomLayerData();
+    if (data.erase(g_deltaKey) > 0)
+    {
+        layer->SetCustomLayerData(data);
+    }
+}
+
+struct UsdFormatIds
+{
+    TfToken usd;
+    TfToken usda;
+    TfToken usdc;
+    TfToken formatArg;
+};
+
+const UsdFormatIds& getUsdFormatIds()
+{
+#if PXR_VERSION < 2511
+    static const UsdFormatIds s_ids{
+        UsdUsdFileFormatTokens->Id,
+        UsdUsdaFileFormatTokens->Id,
+        UsdUsdcFileFormatTokens->Id,
+        UsdUsdFileFormatTokens->FormatArg,
+    };
+#else
+    static const UsdFormatIds s_ids{
+        SdfUsdFileFormatTokens->Id,
+        SdfUsdaFileFormatTokens->Id,
+        SdfUsdcFileFormatTokens->Id,
+        SdfUsdFileFormatTokens->FormatArg,
+    };
+#endif
+    return s_ids;
+}
+
+// Validate that an encoding can be written by a file format, returning whether the "format" argument must be supplied
+bool validateEncoding(
+    const TfToken& encoding,
+    const SdfFileFormatConstPtr& fileFormat,
+    const std::string& identifier,
+    bool* requiresArg,
+    std::string* reason
+)
+{
+    const UsdFormatIds& ids = ::getUsdFormatIds();
+    *requiresArg = false;
+    if (encoding.IsEmpty())
+    {
+        return true;
+    }
+
+    if (encoding != ids.usda && encoding != ids.usdc)
+    {
+        if (reason != nullptr)
+        {
+            *reason = TfStringPrintf("\"%s\" is not a valid USD encoding. Expected \"usda\" or \"usdc\".", encoding.GetText());
+        }
+        return false;
+    }
+
+    if (fileFormat && fileFormat->GetFormatId() == ids.usd)
+    {
+        *requiresArg = true;
+        return true;
+    }
+
+    if (fileFormat && fileFormat->GetFormatId() == encoding)
+    {
+        return true;
+    }
+
+    if (reason != nullptr)
+    {
+        *reason = TfStringPrintf("The \"%s\" encoding can not be written to \"%s\".", encoding.GetText(), identifier.c_str());
+    }
+    return false;
+}
+
+// The storage of a single attribute value, as measured by `computeLayerMemoryReport`
+struct ValueStorage
+{
+    const void* data = nullptr; // the array storage, which identifies values sharing storage, or null for scalar values
+    size_t bytes = 0;
+    bool timeSample = false;
+    VtValue value; // holds the array storage until the report is complete, so its address can not be reused by another value
+};
+
+template <typename T>
+bool measureArray(const VtValue& value, ValueStorage* storage)
+{
+    if (!value.IsHolding<VtArray<T>>())
+    {
+        return false;
+    }
+
+    const VtArray<T>& array = value.UncheckedGet<VtArray<T>>();
+    storage->data = array.empty() ? nullptr : array.cdata();
+    storage->bytes = array.size() * sizeof(T);
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        for (const std::string& element : array)
+        {
+            storage->bytes += element.size();
+        }
+    }
+    return true;
+}
+
+// Arrays of types other than these are measured as empty, as the size of their elements is unknown
+template <typename... Ts>
+ValueStorage measureValue(const VtValue& value)
+{
+    ValueStorage storage;
+    if (value.IsArrayValued())
+    {
+        (void)(::measureArray<Ts>(value, &storage) || ...);
+    }
+    else if (!value.IsEmpty())
+    {
+        storage.bytes = value.GetType().GetSizeof();
+        if (value.IsHolding<std::string>())
+        {
+            storage.bytes += value.UncheckedGet<std::string>().size();
+        }
+    }
+    return storage;
+}
+
+ValueStorage measureAttributeValue(const VtValue& value)
+{
+    return ::measureValue<
+        bool,
+        unsigned char,
+        int,
+        unsigned int,
+        int64_t,
+        uint64_t,
+        GfHalf,
+        float,
+        double,
+        GfVec2i,
+        GfVec3i,
+        GfVec4i,
+        GfVec2h,
+        GfVec3h,
+        GfVec4h,
+        GfVec2f,
+        GfVec3f,
+        GfVec4f,
+        GfVec2d,
+        GfVec3d,
+        GfVec4d,
+        GfQuath,
+        GfQuatf,
+        GfQuatd,
+        GfMatrix2d,
+        GfMatrix3d,
+        GfMatrix4d,
+        TfToken,
+        std::string,
+        SdfAssetPath>(value);
+}
+
+enum class AttributeRole
+{
+    ePoints,
+    eIndices,
+    ePrimvars,
+    eOther,
+};
+
+AttributeRole getAttributeRole(const TfToken& name)
+{
+    static const std::string s_primvarsPrefix = "primvars:";
+    static const std::string s_indicesSuffix = ":indices";
+
+    const std::string& text = name.GetString();
+    if (name == UsdGeomTokens->points || name == UsdGeomTokens->positions)
+    {
+        return AttributeRole::ePoints;
+    }
+    if (name == UsdGeomTokens->faceVertexIndices || name == UsdGeomTokens->faceVertexCounts || name == UsdGeomTokens->curveVertexCounts ||
+        name == UsdGeomTokens->protoIndices || name == UsdGeomTokens->indices || TfStringEndsWith(text, s_indicesSuffix))
+    {
+        return AttributeRole::eIndices;
+    }
+    if (name == UsdGeomTokens->normals || name == UsdGeomTokens->widths || TfStringStartsWith(text, s_primvarsPrefix))
+    {
+        return AttributeRole::ePrimvars;
+    }
+    return AttributeRole::eOther;
+}
+
+void addValueSize(const ValueStorage& storage, AttributeRole role, bool inMemory, bool shared, usdex::core::AttributeDataSize* size)
+{
+    switch (role)
+    {
+        case AttributeRole::ePoints:
+            size->pointsBytes += storage.bytes;
+            break;
+        case AttributeRole::eIndices:
+            size->indicesBytes += storage.bytes;
+            break;
+        case AttributeRole::ePrimvars:
+            size->primvarsBytes += storage.bytes;
+            break;
+        case AttributeRole::eOther:
+            size->otherBytes += storage.bytes;
+            break;
+    }
+    if (storage.timeSample)
+    {
+        size->timeSampleBytes += storage.bytes;
+    }
+    size->serializedBytes += storage.bytes;
+    if (inMemory)
+    {
+        size->inMemoryBytes += storage.bytes;
+        (shared ? size->sharedBytes : size->detachedBytes) += storage.bytes;
+    }
+}
+
+void addDataSize(const usdex::core::AttributeDataSize& source, usdex::core::AttributeDataSize* target)
+{
+    target->pointsBytes += source.pointsBytes;
+    target->indicesBytes += source.indicesBytes;
+    target->primvarsBytes += source.primvarsBytes;
+    target->otherBytes += source.otherBytes;
+    target->timeSampleBytes += source.timeSampleBytes;
+    target->serializedBytes += source.serializedBytes;
+    target->inMemoryBytes += source.inMemoryBytes;
+    target->detachedBytes += source.detachedBytes;
+    target->sharedBytes += source.sharedBytes;
+}
+
+// Pass serialized data to a callback in chunks of at most `chunkSize` bytes
+bool writeChunks(const char* data, size_t size, const usdex::core::LayerChunkCallback& callback, size_t chunkSize)
+{
+    for (size_t offset = 0; offset < size; offset += chunkSize)
+    {
+        if (!callback(data + offset, std::min(chunkSize, size - offset)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Serialize a layer with a USD encoding, passing the bytes to a callback in chunks
+bool writeLayerChunks(const SdfLayerHandle& layer, const TfToken& encoding, const usdex::core::LayerChunkCallback& callback, size_t chunkSize)
+{
+    const UsdFormatIds& ids = ::getUsdFormatIds();
+    if (encoding == ids.usda)
+    {
+        std::string text;
+        return SdfFileFormat::FindById(ids.usda)->WriteToString(*layer, &text) && ::writeChunks(text.data(), text.size(), callback, chunkSize);
+    }
+
+    // The Crate writer can only write to an ArWritableAsset, so the layer is serialized to a temporary file which is streamed to the callback
+    const std::string path = ArchMakeTmpFileName("usdex", "." + encoding.GetString());
+    bool success = layer->Export(path);
+    if (success)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        std::vector<char> chunk(chunkSize);
+        success = stream.is_open();
+        while (success && stream)
+        {
+            stream.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            const size_t count = static_cast<size_t>(stream.gcount());
+            success = count == 0 || callback(chunk.data(), count);
+        }
+        success = success && !stream.bad();
+    }
+    TfDeleteFile(path);
+    return success;
+}
 
 } // namespace
 
@@ -51,6 +481,8 @@ std::string usdex::core::getLayerAuthoringMetadata(const pxr::SdfLayerHandle lay
 
 bool usdex::core::saveLayer(pxr::SdfLayerHandle layer, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
 {
+    USDEX_INSTRUMENT_SCOPE("saveLayer");
+
     if (authoringMetadata.has_value())
     {
         setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
@@ -72,6 +504,81 @@ bool usdex::core::saveLayer(pxr::SdfLayerHandle layer, std::optional<std::string
     return success;
 }
 
+bool usdex::core::getLayerWriteFileFormatArgs(
+    const std::string& identifier,
+    const LayerWriteOptions& writeOptions,
+    SdfLayer::FileFormatArguments* fileFormatArgs,
+    std::string* reason
+)
+{
+    std::string path;
+    SdfLayer::FileFormatArguments identifierArgs;
+    SdfLayer::SplitIdentifier(identifier, &path, &identifierArgs);
+
+    bool requiresArg;
+    if (!::validateEncoding(writeOptions.encoding, SdfFileFormat::FindByExtension(path), identifier, &requiresArg, reason))
+    {
+        return false;
+    }
+
+    if (requiresArg && fileFormatArgs != nullptr)
+    {
+        (*fileFormatArgs)[::getUsdFormatIds().formatArg] = writeOptions.encoding.GetString();
+    }
+    return true;
+}
+
+bool usdex::core::saveLayer(
+    SdfLayerHandle layer,
+    const LayerWriteOptions& writeOptions,
+    std::optional<std::string_view> authoringMetadata,
+    std::optional<std::string_view> comment
+)
+{
+    USDEX_INSTRUMENT_SCOPE("saveLayer");
+
+    bool requiresArg;
+    std::string reason;
+    if (!::validateEncoding(writeOptions.encoding, layer->GetFileFormat(), layer->GetIdentifier(), &requiresArg, &reason))
+    {
+        TF_WARN("Unable to save \"%s\" due to invalid write options: %s", layer->GetIdentifier().c_str(), reason.c_str());
+        return false;
+    }
+
+    // SdfLayer::Save preserves the current encoding, so it can be used directly unless a .usd layer must be re-encoded
+    if (!requiresArg || layer->IsAnonymous() || getUsdLayerEncoding(layer) == writeOptions.encoding)
+    {
+        return saveLayer(layer, authoringMetadata, comment);
+    }
+
+    if (authoringMetadata.has_value())
+    {
+        setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
+    }
+
+    if (comment.has_value())
+    {
+        TF_STATUS(
+            "Saving \"%s\" as %s with comment \"%s\"",
+            layer->GetIdentifier().c_str(),
+            writeOptions.encoding.GetText(),
+            comment.value().data()
+        );
+        layer->SetComment(comment.value().data());
+    }
+    else
+    {
+        TF_STATUS("Saving \"%s\" as %s", layer->GetIdentifier().c_str(), writeOptions.encoding.GetText());
+    }
+
+    // Export in place with the new encoding, then reload so that the layer reflects the new encoding and is no longer dirty
+    std::string path;
+    SdfLayer::FileFormatArguments fileFormatArgs;
+    SdfLayer::SplitIdentifier(layer->GetIdentifier(), &path, &fileFormatArgs);
+    fileFormatArgs[::getUsdFormatIds().formatArg] = writeOptions.encoding.GetString();
+    return layer->Export(layer->GetRealPath(), "", fileFormatArgs) && layer->Reload(/* force */ true);
+}
+
 bool usdex::core::exportLayer(
     SdfLayerHandle layer,
     const std::string& identifier,
@@ -80,6 +587,8 @@ bool usdex::core::exportLayer(
     const SdfLayer::FileFormatArguments& fileFormatArgs
 )
 {
+    USDEX_INSTRUMENT_SCOPE("exportLayer");
+
     // Early out on an unsupported identifier
     if (identifier.empty() || !UsdStage::IsSupportedFile(identifier))
     {
@@ -115,6 +624,458 @@ bool usdex::core::exportLayer(
     return success;
 }
 
+bool usdex::core::exportLayer(
+    SdfLayerHandle layer,
+    const std::string& identifier,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment,
+    const LayerWriteOptions& writeOptions
+)
+{
+    SdfLayer::FileFormatArguments fileFormatArgs;
+    std::string reason;
+    if (!getLayerWriteFileFormatArgs(identifier, writeOptions, &fileFormatArgs, &reason))
+    {
+        TF_WARN("Unable to export SdfLayer to \"%s\" due to invalid write options: %s", identifier.c_str(), reason.c_str());
+        return false;
+    }
+
+    return exportLayer(layer, identifier, authoringMetadata, comment, fileFormatArgs);
+}
+
+std::future<bool> usdex::core::saveLayerAsync(
+    SdfLayerHandle layer,
+    std::optional<std::string_view> authoringMetadata,
+    std::optional<std::string_view> comment
+)
+{
+    USDEX_INSTRUMENT_SCOPE("saveLayerAsync");
+
+    if (authoringMetadata.has_value())
+    {
+        setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
+    }
+
+    if (comment.has_value())
+    {
+        TF_STATUS("Saving \"%s\" with comment \"%s\"", layer->GetIdentifier().c_str(), comment.value().data());
+        layer->SetComment(comment.value().data());
+    }
+    else
+    {
+        TF_STATUS("Saving \"%s\"", layer->GetIdentifier().c_str());
+    }
+
+    // The snapshot is taken on the calling thread, so the layer may be edited as soon as this function returns
+    auto snapshot = std::make_shared<detail::LayerSnapshot>(layer);
+    return detail::runSaveTask([snapshot]() { return snapshot->write(); });
+}
+
+std::future<bool> usdex::core::exportLayerAsync(
+    SdfLayerHandle layer,
+    const std::string& identifier,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    USDEX_INSTRUMENT_SCOPE("exportLayerAsync");
+
+    // Early out on an unsupported identifier
+    if (identifier.empty() || !UsdStage::IsSupportedFile(identifier))
+    {
+        TF_WARN("Unable to export SdfLayer to \"%s\" due to an invalid identifier", identifier.c_str());
+        std::promise<bool> failure;
+        failure.set_value(false);
+        return failure.get_future();
+    }
+
+    // Ensure that layer authoring metadata exists.
+    if (!hasLayerAuthoringMetadata(layer))
+    {
+        setLayerAuthoringMetadata(layer, authoringMetadata);
+    }
+
+    // The comment is authored on the snapshot, so there is no need to restore the comment of the source layer
+    auto snapshot = std::make_shared<detail::LayerSnapshot>(layer, identifier, fileFormatArgs);
+    if (comment.has_value())
+    {
+        TF_STATUS("Exporting \"%s\" with comment \"%s\"", identifier.c_str(), comment.value().data());
+        snapshot->setComment(comment.value().data());
+    }
+    else
+    {
+        TF_STATUS("Exporting \"%s\"", identifier.c_str());
+    }
+
+    return detail::runSaveTask([snapshot]() { return snapshot->write(); });
+}
+
+bool usdex::core::exportLayerToCallback(
+    SdfLayerHandle layer,
+    const LayerChunkCallback& callback,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment,
+    const LayerWriteOptions& writeOptions,
+    size_t chunkSize
+)
+{
+    USDEX_INSTRUMENT_SCOPE("exportLayerToCallback");
+
+    if (!layer)
+    {
+        TF_RUNTIME_ERROR("Unable to export an invalid SdfLayer");
+        return false;
+    }
+
+    // Without an identifier the options are validated as though for a .usd layer, which can be written with either encoding
+    const UsdFormatIds& ids = ::getUsdFormatIds();
+    bool requiresArg;
+    std::string reason;
+    if (!::validateEncoding(writeOptions.encoding, SdfFileFormat::FindById(ids.usd), layer->GetIdentifier(), &requiresArg, &reason))
+    {
+        TF_WARN("Unable to export \"%s\" due to invalid write options: %s", layer->GetIdentifier().c_str(), reason.c_str());
+        return false;
+    }
+    TfToken encoding = writeOptions.encoding;
+    if (encoding.IsEmpty())
+    {
+        encoding = getUsdLayerEncoding(layer) == ids.usdc ? ids.usdc : ids.usda;
+    }
+
+    // Ensure that layer authoring metadata exists.
+    if (!hasLayerAuthoringMetadata(layer))
+    {
+        setLayerAuthoringMetadata(layer, authoringMetadata);
+    }
+
+    chunkSize = std::max(chunkSize, size_t(1));
+    bool success;
+    if (comment.has_value())
+    {
+        TF_STATUS("Exporting \"%s\" as %s with comment \"%s\"", layer->GetIdentifier().c_str(), encoding.GetText(), comment.value().data());
+
+        // Capture the existing comment in the layer so that it can be restored after export, as in `exportLayer`
+        const std::string existingComment = layer->GetComment();
+        layer->SetComment(comment.value().data());
+        success = ::writeLayerChunks(layer, encoding, callback, chunkSize);
+        layer->SetComment(existingComment);
+    }
+    else
+    {
+        TF_STATUS("Exporting \"%s\" as %s", layer->GetIdentifier().c_str(), encoding.GetText());
+        success = ::writeLayerChunks(layer, encoding, callback, chunkSize);
+    }
+
+    return success;
+}
+
+bool usdex::core::exportLayerToBuffer(
+    SdfLayerHandle layer,
+    std::string* buffer,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment,
+    const LayerWriteOptions& writeOptions
+)
+{
+    USDEX_INSTRUMENT_SCOPE("exportLayerToBuffer");
+
+    buffer->clear();
+    auto append = [buffer](const char* data, size_t size)
+    {
+        buffer->append(data, size);
+        return true;
+    };
+    if (!exportLayerToCallback(layer, append, authoringMetadata, comment, writeOptions))
+    {
+        buffer->clear();
+        return false;
+    }
+    return true;
+}
+
+class usdex::core::LayerChangeTracker::LayerChangeTrackerImpl : public TfWeakBase
+{
+
+public:
+
+    explicit LayerChangeTrackerImpl(SdfLayerHandle layer) : m_layer(layer), m_replaced(false)
+    {
+        m_noticeKey = TfNotice::Register(TfCreateWeakPtr(this), &LayerChangeTrackerImpl::onLayersChanged);
+    }
+
+    ~LayerChangeTrackerImpl()
+    {
+        TfNotice::Revoke(m_noticeKey);
+    }
+
+    bool isValid() const
+    {
+        return static_cast<bool>(m_layer);
+    }
+
+    SdfLayerHandle getLayer() const
+    {
+        return m_layer;
+    }
+
+    bool hasChanges() const
+    {
+        return m_replaced || !m_changes.empty();
+    }
+
+    SdfPathVector getChangedPaths() const
+    {
+        if (m_replaced)
+        {
+            return { SdfPath::AbsoluteRootPath() };
+        }
+
+        SdfPathVector result;
+        result.reserve(m_changes.size());
+        for (const auto& [path, deep] : m_changes)
+        {
+            result.push_back(path);
+        }
+        return result;
+    }
+
+    bool writeDelta(SdfLayerHandle delta) const
+    {
+        if (!isValid())
+        {
+            TF_RUNTIME_ERROR("Unable to write delta due to an invalid tracked SdfLayer");
+            return false;
+        }
+        if (!delta || delta == m_layer)
+        {
+            TF_RUNTIME_ERROR("Unable to write delta due to an invalid delta SdfLayer");
+            return false;
+        }
+
+        SdfChangeBlock changeBlock;
+        delta->Clear();
+
+        VtStringArray removed, replaced, updated;
+        if (m_replaced)
+        {
+            delta->TransferContent(m_layer);
+            replaced.push_back(SdfPath::AbsoluteRootPath().GetString());
+            ::setDeltaMetadata(delta, removed, replaced, updated);
+            return true;
+        }
+
+        // The changes are in path order, so the descendants of a removed or replaced spec immediately follow it and can be skipped
+        bool success = true;
+        SdfPath covered;
+        for (const auto& [path, deep] : m_changes)
+        {
+            if (!covered.IsEmpty() && path.HasPrefix(covered))
+            {
+                continue;
+            }
+
+            if (!m_layer->HasSpec(path))
+            {
+                removed.push_back(path.GetString());
+                covered = path;
+            }
+            else if (deep)
+            {
+                success &= ::replaceSpec(m_layer, delta, path);
+                replaced.push_back(path.GetString());
+                covered = path;
+            }
+            else
+            {
+                success &= ::copyFields(m_layer, delta, path);
+                updated.push_back(path.GetString());
+            }
+        }
+
+        ::setDeltaMetadata(delta, removed, replaced, updated);
+        return success;
+    }
+
+    void clear()
+    {
+        m_changes.clear();
+        m_replaced = false;
+    }
+
+private:
+
+    void onLayersChanged(const SdfNotice::LayersDidChange& notice)
+    {
+        for (const auto& [layer, changeList] : notice.GetChangeListVec())
+        {
+            if (layer != m_layer)
+            {
+                continue;
+            }
+
+            for (const auto& [path, entry] : changeList.GetEntryList())
+            {
+                const SdfPath trackedPath = ::getTrackedPath(path);
+                const bool deep = ::isDeepChange(path, trackedPath, entry);
+
+                // Replacing the content of the layer, or reordering its root prims, requires the entire layer to be written
+                if (entry.flags.didReplaceContent || entry.flags.didReloadContent || (trackedPath.IsAbsoluteRootPath() && deep))
+                {
+                    m_replaced = true;
+                    continue;
+                }
+
+                // Changes to the identifier or resolved path do not affect the content of the layer
+                if (trackedPath.IsAbsoluteRootPath() && entry.infoChanged.empty())
+                {
+                    continue;
+                }
+
+                bool& value = m_changes[trackedPath];
+                value = value || deep;
+
+                // A renamed spec no longer exists at its old path
+                if (!entry.oldPath.IsEmpty())
+                {
+                    m_changes.emplace(::getTrackedPath(entry.oldPath), false);
+                }
+            }
+        }
+    }
+
+    SdfLayerHandle m_layer;
+    TfNotice::Key m_noticeKey;
+    std::map<SdfPath, bool> m_changes;
+    bool m_replaced;
+};
+
+usdex::core::LayerChangeTracker::LayerChangeTracker(SdfLayerHandle layer) : m_impl(new LayerChangeTrackerImpl(layer))
+{
+    if (!layer)
+    {
+        TF_RUNTIME_ERROR("Unable to track changes to an invalid SdfLayer");
+    }
+}
+
+usdex::core::LayerChangeTracker::~LayerChangeTracker()
+{
+    delete m_impl;
+}
+
+bool usdex::core::LayerChangeTracker::isValid() const
+{
+    return m_impl->isValid();
+}
+
+SdfLayerHandle usdex::core::LayerChangeTracker::getLayer() const
+{
+    return m_impl->getLayer();
+}
+
+bool usdex::core::LayerChangeTracker::hasChanges() const
+{
+    return m_impl->hasChanges();
+}
+
+SdfPathVector usdex::core::LayerChangeTracker::getChangedPaths() const
+{
+    return m_impl->getChangedPaths();
+}
+
+bool usdex::core::LayerChangeTracker::writeDelta(SdfLayerHandle delta) const
+{
+    USDEX_INSTRUMENT_SCOPE("LayerChangeTracker::writeDelta");
+
+    return m_impl->writeDelta(delta);
+}
+
+bool usdex::core::LayerChangeTracker::exportDelta(
+    const std::string& identifier,
+    const std::string& authoringMetadata,
+    std::optional<std::string_view> comment,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    USDEX_INSTRUMENT_SCOPE("LayerChangeTracker::exportDelta");
+
+    SdfLayerRefPtr delta = SdfLayer::CreateAnonymous("delta");
+    if (!m_impl->writeDelta(delta) || !exportLayer(delta, identifier, authoringMetadata, comment, fileFormatArgs))
+    {
+        return false;
+    }
+
+    m_impl->clear();
+    return true;
+}
+
+void usdex::core::LayerChangeTracker::clear()
+{
+    m_impl->clear();
+}
+
+bool usdex::core::applyLayerDelta(SdfLayerHandle layer, const SdfLayerHandle delta)
+{
+    USDEX_INSTRUMENT_SCOPE("applyLayerDelta");
+
+    if (!layer)
+    {
+        TF_RUNTIME_ERROR("Unable to apply delta due to an invalid SdfLayer");
+        return false;
+    }
+    if (!delta)
+    {
+        TF_RUNTIME_ERROR("Unable to apply delta to \"%s\" due to an invalid delta SdfLayer", layer->GetIdentifier().c_str());
+        return false;
+    }
+
+    const VtDictionary data = delta->GetCustomLayerData();
+    const auto it = data.find(g_deltaKey);
+    if (it == data.end() || !it->second.IsHolding<VtDictionary>())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to apply delta \"%s\" to \"%s\" due to missing delta metadata",
+            delta->GetIdentifier().c_str(),
+            layer->GetIdentifier().c_str()
+        );
+        return false;
+    }
+    const VtDictionary& changes = it->second.UncheckedGet<VtDictionary>();
+    const VtStringArray removed = VtDictionaryGet<VtStringArray>(changes, g_removedKey, VtDefault = VtStringArray());
+    const VtStringArray replaced = VtDictionaryGet<VtStringArray>(changes, g_replacedKey, VtDefault = VtStringArray());
+    const VtStringArray updated = VtDictionaryGet<VtStringArray>(changes, g_updatedKey, VtDefault = VtStringArray());
+
+    bool success = true;
+    {
+        SdfChangeBlock changeBlock;
+        if (replaced.size() == 1 && SdfPath(replaced[0]).IsAbsoluteRootPath())
+        {
+            layer->TransferContent(delta);
+        }
+        else
+        {
+            for (const std::string& path : removed)
+            {
+                if (layer->HasSpec(SdfPath(path)))
+                {
+                    success &= ::removeSpec(layer, SdfPath(path));
+                }
+            }
+            for (const std::string& path : replaced)
+            {
+                success &= ::replaceSpec(delta, layer, SdfPath(path));
+            }
+            for (const std::string& path : updated)
+            {
+                success &= ::copyFields(delta, layer, SdfPath(path));
+            }
+        }
+        ::eraseDeltaMetadata(layer);
+    }
+
+    return success;
+}
+
 TfToken usdex::core::getUsdLayerEncoding(const SdfLayerHandle layer)
 {
     SdfFileFormatConstPtr fileFormat = layer->GetFileFormat();
@@ -162,3 +1123,122 @@ TfToken usdex::core::getUsdLayerEncoding(const SdfLayerHandle layer)
     static TfToken empty;
     return empty;
 }
+
+usdex::core::LayerMemoryReport usdex::core::computeLayerMemoryReport(const SdfLayerHandle layer)
+{
+    USDEX_INSTRUMENT_SCOPE("computeLayerMemoryReport");
+
+    LayerMemoryReport report;
+    if (!layer)
+    {
+        TF_RUNTIME_ERROR("Unable to compute the memory report of an invalid layer");
+        return report;
+    }
+    report.identifier = layer->GetIdentifier();
+
+    // Discover the prims and attributes. Specs within variants are reported on the prims they would contribute to.
+    std::set<SdfPath> primSet;
+    std::vector<SdfPath> attributes;
+    layer->Traverse(
+        SdfPath::AbsoluteRootPath(),
+        [&](const SdfPath& path)
+        {
+            if (path.IsPrimPath())
+            {
+                primSet.insert(path.StripAllVariantSelections());
+            }
+            else if (path.IsPrimPropertyPath() && layer->GetSpecType(path) == SdfSpecTypeAttribute)
+            {
+                attributes.push_back(path);
+            }
+        }
+    );
+    std::sort(attributes.begin(), attributes.end());
+
+    // Measure the default value and time samples of each attribute
+    std::vector<std::vector<ValueStorage>> storages(attributes.size());
+    WorkParallelForN(
+        attributes.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const SdfPath& path = attributes[i];
+                VtValue value;
+                if (layer->HasField(path, SdfFieldKeys->Default, &value))
+                {
+                    ValueStorage storage = ::measureAttributeValue(value);
+                    storage.value = std::move(value);
+                    storages[i].push_back(std::move(storage));
+                }
+                for (double time : layer->ListTimeSamplesForPath(path))
+                {
+                    value = VtValue();
+                    if (layer->QueryTimeSample(path, time, &value))
+                    {
+                        ValueStorage storage = ::measureAttributeValue(value);
+                        storage.timeSample = true;
+                        storage.value = std::move(value);
+                        storages[i].push_back(std::move(storage));
+                    }
+                }
+            }
+        }
+    );
+
+    // Values sharing storage are identified by their data, which is held in memory by the first value to reference it. Each measured value is
+    // retained by its storage, as the layer may construct a new value on each query (e.g. usdc), whose address could otherwise be reused.
+    std::unordered_map<const void*, size_t> references;
+    for (const std::vector<ValueStorage>& values : storages)
+    {
+        for (const ValueStorage& storage : values)
+        {
+            if (storage.data != nullptr)
+            {
+                ++references[storage.data];
+            }
+        }
+    }
+
+    std::map<SdfPath, AttributeDataSize> primSizes;
+    for (const SdfPath& prim : primSet)
+    {
+        primSizes[prim];
+    }
+    std::unordered_set<const void*> counted;
+    for (size_t i = 0; i < attributes.size(); ++i)
+    {
+        const AttributeRole role = ::getAttributeRole(attributes[i].GetNameToken());
+        AttributeDataSize& primSize = primSizes[attributes[i].GetPrimPath().StripAllVariantSelections()];
+        for (const ValueStorage& storage : storages[i])
+        {
+            const bool inMemory = storage.data == nullptr || counted.insert(storage.data).second;
+            const bool shared = storage.data != nullptr && references[storage.data] > 1;
+            ::addValueSize(storage, role, inMemory, shared, &primSize);
+        }
+    }
+
+    // Accumulate the subtrees from the deepest prims up, inserting any ancestors without specs (e.g. the owners of variant prims)
+    for (auto it = primSizes.rbegin(); it != primSizes.rend(); ++it)
+    {
+        const SdfPath parent = it->first.GetParentPath();
+        if (!parent.IsAbsoluteRootPath())
+        {
+            ::addDataSize(it->second, &primSizes[parent]);
+        }
+        else
+        {
+            ::addDataSize(it->second, &report.total);
+        }
+    }
+
+    report.prims.reserve(primSizes.size());
+    report.subtrees.reserve(primSizes.size());
+    for (const auto& [path, size] : primSizes)
+    {
+        report.prims.push_back(path);
+        report.subtrees.push_back(size);
+    }
+
+    return report;
+}
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "LayerSnapshot.h"
+
+#include "usdex/core/LayerAlgo.h"
+
+#if PXR_VERSION < 2511
+#include <pxr/usd/usd/usdFileFormat.h>
+#else
+#include <pxr/usd/sdf/usdFileFormat.h>
+#endif
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace pxr;
+
+namespace
+{
+
+// A single background thread which runs save tasks in the order they were submitted
+class SaveExecutor
+{
+
+public:
+
+    static SaveExecutor& instance()
+    {
+        static SaveExecutor s_executor;
+        return s_executor;
+    }
+
+    std::future<bool> submit(std::function<bool()> task)
+    {
+        std::packaged_task<bool()> packagedTask(std::move(task));
+        std::future<bool> future = packagedTask.get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // The thread is started lazily, so that processes which never save asynchronously do not pay for it
+            if (!m_thread.joinable())
+            {
+                m_thread = std::thread(&SaveExecutor::run, this);
+            }
+            m_tasks.push_back(std::move(packagedTask));
+        }
+        m_condition.notify_one();
+        return future;
+    }
+
+    ~SaveExecutor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_one();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+private:
+
+    SaveExecutor() = default;
+
+    void run()
+    {
+        while (true)
+        {
+            std::packaged_task<bool()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+
+                // Pending tasks are completed before stopping, so that no requested save is silently dropped
+                if (m_tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<std::packaged_task<bool()>> m_tasks;
+    std::thread m_thread;
+    bool m_stop = false;
+};
+
+// The encoding of a .usd file is determined by the data of the layer being written rather than its extension. The snapshot of a .usd layer
+// may hold data of a different encoding, so the encoding of the original layer must be supplied explicitly.
+void preserveUsdEncoding(const SdfLayerHandle& layer, const SdfFileFormatConstPtr& targetFormat, SdfLayer::FileFormatArguments& fileFormatArgs)
+{
+#if PXR_VERSION < 2511
+    const TfToken& formatArg = UsdUsdFileFormatTokens->FormatArg;
+    const SdfFileFormatConstPtr usdFormat = SdfFileFormat::FindById(UsdUsdFileFormatTokens->Id);
+#else
+    const TfToken& formatArg = SdfUsdFileFormatTokens->FormatArg;
+    const SdfFileFormatConstPtr usdFormat = SdfFileFormat::FindById(SdfUsdFileFormatTokens->Id);
+#endif
+    if (layer->GetFileFormat() != usdFormat || targetFormat != usdFormat || fileFormatArgs.find(formatArg) != fileFormatArgs.end())
+    {
+        return;
+    }
+
+    const TfToken encoding = usdex::core::getUsdLayerEncoding(layer);
+    if (!encoding.IsEmpty())
+    {
+        fileFormatArgs[formatArg] = encoding.GetString();
+    }
+}
+
+} // namespace
+
+usdex::core::detail::LayerSnapshot::LayerSnapshot(const SdfLayerHandle& layer)
+{
+    // Write to the asset path of the identifier, supplying the file format arguments explicitly
+    SdfLayer::SplitIdentifier(layer->GetIdentifier(), &m_identifier, &m_fileFormatArgs);
+    for (const auto& [key, value] : layer->GetFileFormatArguments())
+    {
+        m_fileFormatArgs[key] = value;
+    }
+
+    ::preserveUsdEncoding(layer, layer->GetFileFormat(), m_fileFormatArgs);
+
+    m_contents = SdfLayer::CreateAnonymous(layer->GetDisplayName(), layer->GetFileFormat(), layer->GetFileFormatArguments());
+    m_contents->TransferContent(layer);
+}
+
+usdex::core::detail::LayerSnapshot::LayerSnapshot(
+    const SdfLayerHandle& layer,
+    const std::string& identifier,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+    : m_identifier(identifier), m_fileFormatArgs(fileFormatArgs)
+{
+    ::preserveUsdEncoding(layer, SdfFileFormat::FindByExtension(identifier), m_fileFormatArgs);
+
+    m_contents = SdfLayer::CreateAnonymous(layer->GetDisplayName(), layer->GetFileFormat(), layer->GetFileFormatArguments());
+    m_contents->TransferContent(layer);
+}
+
+const std::string& usdex::core::detail::LayerSnapshot::identifier() const
+{
+    return m_identifier;
+}
+
+void usdex::core::detail::LayerSnapshot::setComment(const std::string& comment)
+{
+    m_contents->SetComment(comment);
+}
+
+bool usdex::core::detail::LayerSnapshot::write() const
+{
+    return m_contents->Export(m_identifier, "", m_fileFormatArgs);
+}
+
+std::future<bool> usdex::core::detail::runSaveTask(std::function<bool()> task)
+{
+    return ::SaveExecutor::instance().submit(std::move(task));
+}
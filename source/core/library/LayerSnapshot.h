@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <pxr/usd/sdf/layer.h>
+
+#include <functional>
+#include <future>
+#include <string>
+
+namespace usdex::core::detail
+{
+
+//! A copy of the contents of a layer, which can be serialized from any thread while the original layer continues to be edited.
+//!
+//! This is the implementation of the async save functions. The copy is taken on the calling thread, so it reflects the layer at the time it
+//! was requested, and the original layer is never accessed by the background thread.
+class LayerSnapshot
+{
+
+public:
+
+    //! Copy the contents of a layer, to be written back to the location of the layer.
+    //!
+    //! The file format arguments of the layer (and the underlying encoding of `.usd` layers) are preserved, matching `SdfLayer::Save`.
+    //!
+    //! @param layer The layer to copy
+    explicit LayerSnapshot(const pxr::SdfLayerHandle& layer);
+
+    //! Copy the contents of a layer, to be written to a new location.
+    //!
+    //! @param layer The layer to copy
+    //! @param identifier The identifier to which the copy will be written
+    //! @param fileFormatArgs Additional file format-specific arguments to be supplied when writing the copy
+    LayerSnapshot(const pxr::SdfLayerHandle& layer, const std::string& identifier, const pxr::SdfLayer::FileFormatArguments& fileFormatArgs);
+
+    //! The identifier to which the copy will be written.
+    const std::string& identifier() const;
+
+    //! Set the comment of the copy, without affecting the original layer.
+    void setComment(const std::string& comment);
+
+    //! Serialize the copy to its identifier.
+    //!
+    //! @returns Whether the copy was written successfully.
+    bool write() const;
+
+private:
+
+    pxr::SdfLayerRefPtr m_contents;
+    std::string m_identifier;
+    pxr::SdfLayer::FileFormatArguments m_fileFormatArgs;
+};
+
+//! Run a save task on the background save thread.
+//!
+//! Tasks run one at a time, in the order they were submitted, so that successive saves of the same layer are written in order. Any tasks
+//! which are still pending when the process exits are completed before the thread is joined.
+//!
+//! @param task The task to run. Its result is returned via the future.
+//! @returns A future which becomes ready once the task has completed.
+std::future<bool> runSaveTask(std::function<bool()> task);
+
+} // namespace usdex::core::detail
@@ -6,10 +6,18 @@
 #include "usdex/core/Core.h"
 #include "usdex/core/StageAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+#include "PrimSpecWriter.h"
+
 #include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/usdGeom/boundable.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
+#include <type_traits>
+#include <unordered_set>
+
 using namespace pxr;
 
 namespace
@@ -78,6 +86,36 @@ TfToken compatName(const TfToken& originalAttrName)
     return TfToken(attrName);
 }
 
+// Compute the extent of a rect light in closed form, matching the extent computed by the UsdLux boundable plugin
+VtVec3fArray computeRectLightExtent(float width, float height)
+{
+    const GfVec3f halfSize(width * 0.5f, height * 0.5f, 0.0f);
+    return VtVec3fArray{ -halfSize, halfSize };
+}
+
+// Author the specs of a rect light, matching the attributes authored by defineRectLight
+void setRectLightSpecs(
+    usdex::core::detail::PrimSpecWriter& writer,
+    float width,
+    float height,
+    float intensity,
+    const std::optional<std::string_view>& texturePath
+)
+{
+    writer.setAttribute(UsdLuxTokens->inputsIntensity, VtValue(intensity));
+    writer.setAttribute(UsdLuxTokens->inputsExposure, VtValue(0.0f));
+    writer.setAttribute(UsdLuxTokens->inputsWidth, VtValue(width));
+    writer.setAttribute(UsdLuxTokens->inputsHeight, VtValue(height));
+    if constexpr (std::is_base_of_v<UsdGeomBoundable, UsdLuxRectLight>)
+    {
+        writer.setAttribute(UsdGeomTokens->extent, VtValue(::computeRectLightExtent(width, height)));
+    }
+    if (texturePath.has_value())
+    {
+        writer.setAttribute(UsdLuxTokens->inputsTextureFile, VtValue(SdfAssetPath(texturePath.value().data())));
+    }
+}
+
 } // namespace
 
 bool usdex::core::isLight(const UsdPrim& prim)
@@ -115,11 +153,13 @@ UsdLuxDomeLight usdex::core::defineDomeLight(
     const TfToken& textureFormat
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineDomeLight");
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdLuxDomeLight due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdLuxDomeLight due to an invalid location: %s", reason.c_str());
         return UsdLuxDomeLight();
     }
 
@@ -132,6 +172,25 @@ UsdLuxDomeLight usdex::core::defineDomeLight(
         return UsdLuxDomeLight();
     }
 
+    // Author the specs directly to the edit target layer
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        return usdex::core::detail::defineWithSpecs<UsdLuxDomeLight>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdLuxTokens->inputsIntensity, VtValue(intensity));
+                writer.setAttribute(UsdLuxTokens->inputsExposure, VtValue(0.0f));
+                if (texturePath.has_value())
+                {
+                    writer.setAttribute(UsdLuxTokens->inputsTextureFile, VtValue(SdfAssetPath(texturePath.value().data())));
+                    writer.setAttribute(UsdLuxTokens->inputsTextureFormat, VtValue(textureFormat));
+                }
+            }
+        );
+    }
+
     auto light = UsdLuxDomeLight::Define(stage, path);
 
     if (!light)
@@ -172,7 +231,12 @@ UsdLuxDomeLight usdex::core::defineDomeLight(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdLuxDomeLight due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdLuxDomeLight due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdLuxDomeLight();
     }
 
@@ -217,14 +281,26 @@ UsdLuxRectLight usdex::core::defineRectLight(
     std::optional<std::string_view> texturePath
 )
 {
+    USDEX_INSTRUMENT_SCOPE("defineRectLight");
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdLuxRectLight due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdLuxRectLight due to an invalid location: %s", reason.c_str());
         return UsdLuxRectLight();
     }
 
+    // Author the specs directly to the edit target layer
+    if (usdex::core::BulkAuthoringScope::isActive(stage))
+    {
+        return usdex::core::detail::defineWithSpecs<UsdLuxRectLight>(
+            stage,
+            path,
+            [&](usdex::core::detail::PrimSpecWriter& writer) { ::setRectLightSpecs(writer, width, height, intensity, texturePath); }
+        );
+    }
+
     auto light = UsdLuxRectLight::Define(stage, path);
 
     if (!light)
@@ -248,9 +324,7 @@ UsdLuxRectLight usdex::core::defineRectLight(
     light.CreateHeightAttr().Set(height);
     if (auto boundable = UsdGeomBoundable(prim))
     {
-        VtVec3fArray extent;
-        UsdGeomBoundable::ComputeExtentFromPlugins(boundable, UsdTimeCode::Default(), &extent);
-        boundable.CreateExtentAttr().Set(extent);
+        boundable.CreateExtentAttr().Set(::computeRectLightExtent(width, height));
     }
 
     if (texturePath.has_value())
@@ -274,7 +348,12 @@ UsdLuxRectLight usdex::core::defineRectLight(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdLuxRectLight due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdLuxRectLight due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdLuxRectLight();
     }
 
@@ -309,3 +388,78 @@ UsdLuxRectLight usdex::core::defineRectLight(UsdPrim prim, float width, float he
     const SdfPath& path = prim.GetPath();
     return usdex::core::defineRectLight(stage, path, width, height, intensity, texturePath);
 }
+
+std::vector<UsdLuxRectLight> usdex::core::defineRectLights(
+    UsdStagePtr stage,
+    const SdfPathVector& paths,
+    const std::vector<float>& widths,
+    const std::vector<float>& heights,
+    const std::vector<float>& intensities
+)
+{
+    USDEX_INSTRUMENT_SCOPE("defineRectLights");
+
+    // Early out if the stage is invalid
+    if (!stage)
+    {
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidStage, "Unable to define UsdLuxRectLights due to an invalid stage");
+        return {};
+    }
+
+    if (paths.empty())
+    {
+        return {};
+    }
+
+    if (widths.size() != paths.size() || heights.size() != paths.size() || (!intensities.empty() && intensities.size() != paths.size()))
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdLuxRectLights due to mismatched sizes: %zu paths, %zu widths, %zu heights, and %zu intensities",
+            paths.size(),
+            widths.size(),
+            heights.size(),
+            intensities.size()
+        );
+        return {};
+    }
+
+    std::unordered_set<SdfPath, SdfPath::Hash> uniquePaths;
+    if (!usdex::core::detail::validateBatchLocations(TF_CALL_CONTEXT, stage, paths, "UsdLuxRectLight", &uniquePaths))
+    {
+        return {};
+    }
+
+    // Author all of the lights directly in the edit target layer, so that change processing occurs once for the entire batch
+    static const TfToken s_rectLightTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdLuxRectLight>();
+    {
+        SdfChangeBlock changeBlock;
+
+        usdex::core::detail::defineUndefinedAncestors(stage, uniquePaths);
+
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            usdex::core::detail::PrimSpecWriter writer(stage, paths[i], s_rectLightTypeName);
+            if (!writer.isValid())
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdLuxRectLight at \"%s\"", paths[i].GetAsString().c_str());
+                continue;
+            }
+            ::setRectLightSpecs(writer, widths[i], heights[i], intensities.empty() ? 1.0f : intensities[i], std::nullopt);
+        }
+    }
+
+    // The change block has closed, so the stage has recomposed the new prims
+    std::vector<UsdLuxRectLight> result;
+    result.reserve(paths.size());
+    for (const SdfPath& path : paths)
+    {
+        UsdLuxRectLight light(stage->GetPrimAtPath(path));
+        if (!light)
+        {
+            TF_RUNTIME_ERROR("Unable to define UsdLuxRectLight at \"%s\"", path.GetAsString().c_str());
+        }
+        result.push_back(light);
+    }
+
+    return result;
+}
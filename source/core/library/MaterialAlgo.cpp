@@ -7,16 +7,45 @@
 #include "usdex/core/NameAlgo.h"
 #include "usdex/core/StageAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+#include "MaterialBinding.h"
+#include "PrimSpecWriter.h"
+#include "ResolverCache.h"
+#include "UnchangedValues.h"
+
+#include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
 #include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/listOp.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/relationshipSpec.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usd/tokens.h>
+#include <pxr/usd/usdGeom/gprim.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 #include <pxr/usd/usdShade/nodeGraph.h>
 #include <pxr/usd/usdShade/tokens.h>
+#include <pxr/usd/usdShade/utils.h>
 #include <pxr/usd/usdUtils/pipeline.h>
 
+#include <algorithm>
+#include <array>
+#include <map>
+#include <optional>
+#include <queue>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 using namespace pxr;
 
@@ -41,6 +70,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((uvTexMetallicName, "MetallicTexture"))
     ((uvTexOpacityName, "OpacityTexture"))
     ((uvTexEmissiveName, "EmissiveTexture"))
+    ((sharedTexturesName, "SharedTextures"))
     // UsdPreviewSurface I/O
     ((color, "diffuseColor"))
     ((emissiveColor, "emissiveColor"))
@@ -75,18 +105,16 @@ bool isShaderType(const UsdShadeShader& shader, const TfToken& shaderId)
     return shader && shader.GetShaderId(&test) && test == shaderId;
 }
 
-// Find or create the appropriate TextureReader
-UsdShadeShader acquireTextureReader(
-    UsdShadeMaterial& material,
-    const TfToken& shaderName,
+// Define a texture reader at the given path, sampling the default UV set
+UsdShadeShader defineTextureReader(
+    const UsdStagePtr& stage,
+    const SdfPath& shaderPath,
     const SdfAssetPath& texture,
     usdex::core::ColorSpace colorSpace,
     const GfVec4f& fallback
 )
 {
-    // Create the texture shader
-    SdfPath shaderPath = material.GetPath().AppendChild(shaderName);
-    UsdShadeShader texShader = UsdShadeShader::Define(material.GetPrim().GetStage(), shaderPath);
+    UsdShadeShader texShader = UsdShadeShader::Define(stage, shaderPath);
     texShader.SetShaderId(_tokens->uvTexId);
     texShader.CreateInput(_tokens->fallback, SdfValueTypeNames->Float4).Set(fallback);
     texShader.CreateInput(_tokens->file, SdfValueTypeNames->Asset).Set(texture);
@@ -102,15 +130,171 @@ UsdShadeShader acquireTextureReader(
     return texShader;
 }
 
-// Check if the file extension for the texture asset matches a set of known 8 bit texture formats
+// The texture readers shared by the materials of a stage while a SharedTextureScope is active
+class SharedTextureReaders
+{
+
+public:
+
+    SharedTextureReaders(UsdPrim parent) : m_parent(s_current)
+    {
+        s_current = this;
+
+        if (!parent)
+        {
+            return;
+        }
+
+        // Reuse the node graph of a previous scope, but never replace another kind of prim
+        SdfPath path = parent.GetPath().AppendChild(_tokens->sharedTexturesName);
+        UsdPrim existing = parent.GetStage()->GetPrimAtPath(path);
+        if (existing && existing.GetTypeName() != UsdSchemaRegistry::GetSchemaTypeName<UsdShadeNodeGraph>())
+        {
+            path = parent.GetPath().AppendChild(usdex::core::getValidChildName(parent, _tokens->sharedTexturesName.GetString()));
+        }
+        m_nodeGraph = UsdShadeNodeGraph::Define(parent.GetStage(), path);
+    }
+
+    ~SharedTextureReaders()
+    {
+        s_current = m_parent;
+    }
+
+    bool isValid() const
+    {
+        return static_cast<bool>(m_nodeGraph);
+    }
+
+    const UsdShadeNodeGraph& getNodeGraph() const
+    {
+        return m_nodeGraph;
+    }
+
+    // The innermost valid scope of the calling thread for the given stage, or nullptr if there is none
+    static SharedTextureReaders* find(const UsdStagePtr& stage)
+    {
+        for (SharedTextureReaders* scope = s_current; scope != nullptr; scope = scope->m_parent)
+        {
+            if (scope->isValid() && scope->m_nodeGraph.GetPrim().GetStage() == stage)
+            {
+                return scope;
+            }
+        }
+        return nullptr;
+    }
+
+    UsdShadeShader acquire(const TfToken& shaderName, const SdfAssetPath& texture, usdex::core::ColorSpace colorSpace, const GfVec4f& fallback)
+    {
+        const UsdStagePtr stage = m_nodeGraph.GetPrim().GetStage();
+
+        // The slot is part of the key, as each add*Texture function authors its own outputs, scale and bias on the reader
+        Key key{ shaderName, texture.GetAssetPath(), colorSpace, fallback };
+        auto it = m_readers.find(key);
+        if (it != m_readers.end())
+        {
+            UsdShadeShader texShader = UsdShadeShader::Get(stage, it->second);
+            if (texShader)
+            {
+                return texShader;
+            }
+
+            // The reader has been removed since it was defined, so it must be defined again
+            m_readers.erase(it);
+        }
+
+        SdfPath path = m_nodeGraph.GetPath().AppendChild(usdex::core::getValidChildName(m_nodeGraph.GetPrim(), shaderName.GetString()));
+        UsdShadeShader texShader = ::defineTextureReader(stage, path, texture, colorSpace, fallback);
+        if (texShader)
+        {
+            m_readers.emplace(key, path);
+        }
+        return texShader;
+    }
+
+private:
+
+    struct Key
+    {
+        TfToken shaderName;
+        std::string assetPath;
+        usdex::core::ColorSpace colorSpace;
+        GfVec4f fallback;
+
+        bool operator==(const Key& other) const
+        {
+            return shaderName == other.shaderName && assetPath == other.assetPath && colorSpace == other.colorSpace && fallback == other.fallback;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            return TfHash::Combine(key.shaderName, key.assetPath, static_cast<int>(key.colorSpace), key.fallback);
+        }
+    };
+
+    SharedTextureReaders* m_parent;
+    UsdShadeNodeGraph m_nodeGraph;
+    std::unordered_map<Key, SdfPath, KeyHash> m_readers;
+
+    // The innermost scope of the calling thread, which links to the enclosing scopes
+    static thread_local SharedTextureReaders* s_current;
+};
+
+thread_local SharedTextureReaders* SharedTextureReaders::s_current = nullptr;
+
+// Find or create the appropriate TextureReader
+UsdShadeShader acquireTextureReader(
+    UsdShadeMaterial& material,
+    const TfToken& shaderName,
+    const SdfAssetPath& texture,
+    usdex::core::ColorSpace colorSpace,
+    const GfVec4f& fallback
+)
+{
+    const UsdStagePtr stage = material.GetPrim().GetStage();
+    if (SharedTextureReaders* shared = SharedTextureReaders::find(stage))
+    {
+        return shared->acquire(shaderName, texture, colorSpace, fallback);
+    }
+
+    // Create the texture shader
+    return ::defineTextureReader(stage, material.GetPath().AppendChild(shaderName), texture, colorSpace, fallback);
+}
+
+// Get the extension of the resolved texture asset
 // Note, the UsdShadInput provided is expected to be for an SdfAssetPath for the shader's texture file input
-bool isEightBitTextureFormat(const UsdShadeInput& textureAssetPathInput)
+std::string getResolvedExtension(const UsdShadeInput& textureAssetPathInput)
 {
     SdfAssetPath resolvedTexturePath;
     textureAssetPathInput.Get(&resolvedTexturePath);
+    return ArGetResolver().GetExtension(resolvedTexturePath.GetResolvedPath());
+}
 
+// Check if the file extension for the texture asset matches a set of known 8 bit texture formats
+// Note, the UsdShadInput provided is expected to be for the shader's texture file input, which holds the authored `texturePath`
+bool isEightBitTextureFormat(const UsdShadeInput& textureAssetPathInput, const SdfAssetPath& texturePath)
+{
     static const std::vector<std::string> s_eightBitFormats = { "bmp", "tga", "jpg", "jpeg", "png", "tif" };
-    std::string ext = ArGetResolver().GetExtension(resolvedTexturePath.GetResolvedPath());
+
+    std::string ext;
+    if (!usdex::core::detail::ResolverCacheScope::isActive())
+    {
+        ext = ::getResolvedExtension(textureAssetPathInput);
+    }
+    else
+    {
+        // Resolving the texture may require a round trip to a remote resolver, so each texture is resolved once per bulk authoring scope
+        const UsdStagePtr stage = textureAssetPathInput.GetPrim().GetStage();
+        const SdfLayerHandle layer = stage->GetEditTarget().GetLayer();
+        const ArResolverContext context = stage->GetPathResolverContext();
+        if (!usdex::core::detail::findResolvedExtension(layer, context, texturePath.GetAssetPath(), &ext))
+        {
+            ext = ::getResolvedExtension(textureAssetPathInput);
+            usdex::core::detail::storeResolvedExtension(layer, context, texturePath.GetAssetPath(), ext);
+        }
+    }
     return std::find(s_eightBitFormats.begin(), s_eightBitFormats.end(), ext) != s_eightBitFormats.end();
 }
 
@@ -141,6 +325,68 @@ float fromLinear(float value)
     }
 }
 
+// Arrays smaller than this are converted on the calling thread, as the overhead of scheduling tasks outweighs the benefit
+static constexpr size_t s_parallelColorThreshold = 1 << 14;
+
+static constexpr size_t s_colorGrainSize = 1 << 12;
+
+// The linear values of every 8-bit sRGB value (i.e. k / 255), which is the most common source of sRGB color arrays (e.g. images and scans)
+const std::array<float, 256>& getEightBitLinearTable()
+{
+    static const std::array<float, 256> s_table = []()
+    {
+        std::array<float, 256> table;
+        for (size_t k = 0; k < table.size(); ++k)
+        {
+            table[k] = toLinear(static_cast<float>(k) / 255.0f);
+        }
+        return table;
+    }();
+    return s_table;
+}
+
+// Values which are exactly an 8-bit sRGB value are looked up rather than computed, so the result is identical to toLinear
+float toLinear(float value, const std::array<float, 256>& table)
+{
+    const float scaled = value * 255.0f;
+    if (scaled >= 0.0f && scaled <= 255.0f)
+    {
+        const int k = static_cast<int>(scaled + 0.5f);
+        if (static_cast<float>(k) / 255.0f == value)
+        {
+            return table[k];
+        }
+    }
+    return toLinear(value);
+}
+
+// Convert each component of an array of colors, across multiple threads for large arrays
+template <typename ConvertFn>
+VtVec3fArray convertColors(const VtVec3fArray& colors, const ConvertFn& convert)
+{
+    const size_t size = colors.size();
+    VtVec3fArray result(size);
+    const GfVec3f* src = colors.cdata();
+    GfVec3f* dst = result.data();
+    auto convertRange = [src, dst, &convert](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            dst[i] = GfVec3f(convert(src[i][0]), convert(src[i][1]), convert(src[i][2]));
+        }
+    };
+
+    if (size < s_parallelColorThreshold || !WorkHasConcurrency())
+    {
+        convertRange(0, size);
+    }
+    else
+    {
+        WorkParallelForN(size, convertRange, s_colorGrainSize);
+    }
+    return result;
+}
+
 bool isSupportedPrimvarType(const UsdShadeInput& shaderInput)
 {
     static const std::vector<SdfValueTypeName> supportedTypes = {
@@ -215,6 +461,222 @@ void setTextureWrapMode(UsdShadeShader& shader, const std::string& wrapMode)
     }
 }
 
+// A map from the path of each prim to be bound to the index of its material
+using MaterialBindings = std::unordered_map<SdfPath, size_t, SdfPath::Hash>;
+
+bool hasDirectBinding(const UsdPrim& prim, const TfToken& relName)
+{
+    const UsdRelationship rel = prim.GetRelationship(relName);
+    return rel && rel.HasAuthoredTargets();
+}
+
+// Replace the bindings of all children of a parent with a single binding on the parent, wherever the resolved materials are unaffected
+void collapseMaterialBindings(const UsdStagePtr& stage, const TfToken& relName, MaterialBindings& bindings)
+{
+    // Parents are visited deepest first, so that each collapsed parent can in turn be collapsed onto its own parent
+    std::priority_queue<std::pair<size_t, SdfPath>> parents;
+    std::unordered_set<SdfPath, SdfPath::Hash> visited;
+    auto enqueueParent = [&parents, &visited](const SdfPath& path)
+    {
+        const SdfPath parent = path.GetParentPath();
+        if (parent != SdfPath::AbsoluteRootPath() && visited.insert(parent).second)
+        {
+            parents.emplace(parent.GetPathElementCount(), parent);
+        }
+    };
+    for (const auto& binding : bindings)
+    {
+        enqueueParent(binding.first);
+    }
+
+    std::vector<SdfPath> children;
+    while (!parents.empty())
+    {
+        const SdfPath parentPath = parents.top().second;
+        parents.pop();
+
+        // Binding a gprim would change its own appearance, not only that of its children
+        const UsdPrim parent = stage->GetPrimAtPath(parentPath);
+        if (!parent || parent.IsInstanceProxy() || parent.IsA<UsdGeomGprim>())
+        {
+            continue;
+        }
+
+        // Every child must be bound to the same material, and must not have a binding of its own that would override the parent binding
+        std::optional<size_t> material;
+        children.clear();
+        for (const UsdPrim& child : parent.GetChildren())
+        {
+            const auto it = bindings.find(child.GetPath());
+            if (it == bindings.end() || (material.has_value() && material.value() != it->second) || ::hasDirectBinding(child, relName))
+            {
+                material.reset();
+                break;
+            }
+            material = it->second;
+            children.push_back(child.GetPath());
+        }
+        if (!material.has_value())
+        {
+            continue;
+        }
+
+        // The parent may also have been requested, in which case the materials must match
+        const auto it = bindings.find(parentPath);
+        if (it != bindings.end() && it->second != material.value())
+        {
+            continue;
+        }
+
+        for (const SdfPath& child : children)
+        {
+            bindings.erase(child);
+        }
+        bindings[parentPath] = material.value();
+        enqueueParent(parentPath);
+    }
+}
+
+// Add an applied API schema to the prim spec, matching UsdPrim::AddAppliedSchema
+void addAppliedSchema(const SdfLayerHandle& layer, const SdfPath& path, const TfToken& schemaName)
+{
+    SdfTokenListOp listOp = layer->GetFieldAs<SdfTokenListOp>(path, UsdTokens->apiSchemas);
+    TfTokenVector items = listOp.IsExplicit() ? listOp.GetExplicitItems() : listOp.GetPrependedItems();
+    if (std::find(items.begin(), items.end(), schemaName) != items.end())
+    {
+        return;
+    }
+
+    items.push_back(schemaName);
+    if (listOp.IsExplicit())
+    {
+        listOp.SetExplicitItems(items);
+    }
+    else
+    {
+        TfTokenVector deleted = listOp.GetDeletedItems();
+        deleted.erase(std::remove(deleted.begin(), deleted.end(), schemaName), deleted.end());
+        listOp.SetDeletedItems(deleted);
+        listOp.SetPrependedItems(items);
+    }
+    layer->SetField(path, UsdTokens->apiSchemas, listOp);
+}
+
+// Validate a preview material and find the shader inputs to be promoted to its Material Interface, along with the name of each interface input
+bool collectPreviewMaterialInterface(const UsdShadeMaterial& material, TfTokenVector& inputNames, std::vector<UsdShadeInput>& inputsToPromote)
+{
+    if (!material)
+    {
+        TF_RUNTIME_ERROR("UsdShadeMaterial <%s> is not valid.", material.GetPath().GetAsString().c_str());
+        return false;
+    }
+
+    UsdShadeShader previewSurface = usdex::core::computeEffectivePreviewSurfaceShader(material);
+    if (!previewSurface)
+    {
+        TF_RUNTIME_ERROR(
+            "UsdShadeMaterial <%s> does not have a valid surface shader for the universal render context.",
+            material.GetPath().GetAsString().c_str()
+        );
+        return false;
+    }
+
+    // Ensure this is the only surface shader. The implementation of this function is ill-suited for multi render context shader networks, as one
+    // of the primary goals of Material Interfaces are to be a common interface across all render contexts. This function will instead produce
+    // inputs that are uniquely named based on the UsdPreviewSurface specification, and may not map one-to-one with other contexts.
+    UsdShadeAttributeVector effectiveSurfaceOutputs;
+    for (const UsdShadeOutput& output : material.GetSurfaceOutputs())
+    {
+        for (const auto& outputAttr : output.GetValueProducingAttributes())
+        {
+            effectiveSurfaceOutputs.push_back(outputAttr);
+        }
+    }
+    if (effectiveSurfaceOutputs.size() > 1 || effectiveSurfaceOutputs.empty())
+    {
+        TF_RUNTIME_ERROR(
+            "UsdShadeMaterial <%s> has %zu effective surface outputs. This function is not suitable for multi-context shader networks.",
+            material.GetPath().GetAsString().c_str(),
+            size_t(effectiveSurfaceOutputs.size()) // explicit cast as the type changed from uint32_t to size_t in usd 24.08
+        );
+        return false;
+    }
+
+    for (UsdShadeInput input : previewSurface.GetInputs(/* onlyAuthored */ true))
+    {
+        for (auto inputAttr : input.GetValueProducingAttributes())
+        {
+            // Direct value producing inputs with authored values should be promoted
+            if (UsdShadeUtils::GetType(inputAttr.GetName()) == UsdShadeAttributeType::Input && inputAttr.HasAuthoredValue())
+            {
+                TfToken baseName = UsdShadeUtils::GetBaseNameAndType(inputAttr.GetName()).first;
+                UsdShadeShader inputShader = UsdShadeShader(inputAttr.GetPrim());
+                inputsToPromote.push_back(inputShader.GetInput(baseName));
+                inputNames.push_back(baseName);
+            }
+            else if (UsdShadeUtils::GetType(inputAttr.GetName()) == UsdShadeAttributeType::Output)
+            {
+                // We can't generally determine which inputs on a shader are relevant to the given output. It may be be all inputs
+                // or may be some specific subset. We can make an exception for UsdUvTexture shaders, as we know the `file` input
+                // is the primary user-facing input.
+                // FUTURE: Consider a parameter to control this. Maybe we should cross the shader boundary for all shaders, or for
+                // some user specified subset.
+                // Texture readers outside of the material are shared (see SharedTextureScope), so promoting their inputs would affect other
+                // materials.
+                UsdShadeShader inputShader = UsdShadeShader(inputAttr.GetPrim());
+                if (isShaderType(inputShader, _tokens->uvTexId) && inputShader.GetPath().HasPrefix(material.GetPath()))
+                {
+                    inputsToPromote.push_back(inputShader.GetInput(_tokens->file));
+                    inputNames.push_back(inputShader.GetPrim().GetName());
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+// Whether any layer other than the given layer contributes connections to the attribute
+bool hasComposedConnections(const UsdAttribute& attr, const SdfLayerHandle& layer)
+{
+    for (const SdfPropertySpecHandle& spec : attr.GetPropertyStack())
+    {
+        if (spec->GetLayer() != layer && spec->HasField(SdfFieldKeys->ConnectionPaths))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Author the emissive color and textures of the params onto a material defined by definePreviewMaterial
+bool addPreviewMaterialParams(UsdShadeMaterial& material, const usdex::core::PreviewMaterialParams& params)
+{
+    if (params.emissiveColor.has_value() && !usdex::core::addEmissiveColorToPreviewMaterial(material, params.emissiveColor.value()))
+    {
+        return false;
+    }
+
+    using AddTextureFn = bool (*)(UsdShadeMaterial&, const SdfAssetPath&);
+    const std::pair<const SdfAssetPath&, AddTextureFn> textures[] = {
+        { params.diffuseTexture, &usdex::core::addDiffuseTextureToPreviewMaterial },
+        { params.normalTexture, &usdex::core::addNormalTextureToPreviewMaterial },
+        { params.ormTexture, &usdex::core::addOrmTextureToPreviewMaterial },
+        { params.roughnessTexture, &usdex::core::addRoughnessTextureToPreviewMaterial },
+        { params.metallicTexture, &usdex::core::addMetallicTextureToPreviewMaterial },
+        { params.opacityTexture, &usdex::core::addOpacityTextureToPreviewMaterial },
+        { params.emissiveTexture, &usdex::core::addEmissiveTextureToPreviewMaterial },
+    };
+    for (const auto& [texturePath, addTexture] : textures)
+    {
+        if (!texturePath.GetAssetPath().empty() && !addTexture(material, texturePath))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace
 
 UsdShadeMaterial usdex::core::createMaterial(UsdPrim parent, const std::string& name)
@@ -268,16 +730,141 @@ bool usdex::core::bindMaterial(UsdPrim prim, const UsdShadeMaterial& material)
     return materialBinding.Bind(material);
 }
 
-bool usdex::core::bindMaterialSubsets(const std::vector<UsdGeomSubset>& subsets, const std::vector<UsdShadeMaterial>& materials)
+bool usdex::core::detail::bindMaterials(
+    const std::vector<UsdPrim>& prims,
+    const std::vector<UsdShadeMaterial>& materials,
+    const TfToken& purpose,
+    bool collapseToAncestors,
+    std::string* reason
+)
 {
-    if (subsets.empty() || materials.empty())
+    if (prims.empty() || materials.empty())
     {
-        TF_WARN("Unable to bind materials to subsets: The subsets or materials are empty.");
+        *reason = "The prims or materials are empty.";
         return false;
     }
-    if (subsets.size() != materials.size())
+    if (materials.size() != 1 && materials.size() != prims.size())
     {
-        TF_WARN("Unable to bind materials to subsets: The number of subsets does not equal the number of materials.");
+        *reason = TfStringPrintf("The number of materials (%zu) does not equal the number of prims (%zu).", materials.size(), prims.size());
+        return false;
+    }
+
+    // Validate every prim, all of which must be editable on the same stage
+    std::string locationReason;
+    const UsdStagePtr stage = prims[0].GetStage();
+    for (const UsdPrim& prim : prims)
+    {
+        if (!usdex::core::isEditablePrimLocation(prim, &locationReason))
+        {
+            *reason = TfStringPrintf("The prim is in an invalid location: %s", locationReason.c_str());
+            return false;
+        }
+        if (prim.GetStage() != stage)
+        {
+            *reason = TfStringPrintf("The prim <%s> does not belong to the same stage as the other prims.", prim.GetPath().GetText());
+            return false;
+        }
+    }
+
+    // The binding relationship of the purpose, matching UsdShadeMaterialBindingAPI::GetDirectBindingRel
+    const TfToken relName = purpose.IsEmpty() ? UsdShadeTokens->materialBinding
+                                              : TfToken(SdfPath::JoinIdentifier(UsdShadeTokens->materialBinding, purpose));
+
+    // Validate each unique material once, and map it to the path that each binding will target
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    std::unordered_map<SdfPath, size_t, SdfPath::Hash> materialIndices;
+    std::vector<SdfPath> targets;
+    std::vector<size_t> materialSlots(materials.size());
+    for (size_t i = 0; i < materials.size(); ++i)
+    {
+        const UsdPrim matPrim = materials[i].GetPrim();
+        const auto [it, inserted] = materialIndices.emplace(matPrim.GetPath(), targets.size());
+        if (inserted)
+        {
+            if (!matPrim)
+            {
+                *reason = TfStringPrintf("The material <%s> is not valid.", matPrim.GetPath().GetText());
+                return false;
+            }
+            targets.push_back(editTarget.MapToSpecPath(matPrim.GetPath()).StripAllVariantSelections());
+        }
+        materialSlots[i] = it->second;
+    }
+
+    MaterialBindings bindings;
+    bindings.reserve(prims.size());
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        bindings[prims[i].GetPath()] = materialSlots[materials.size() == 1 ? 0 : i];
+    }
+
+    if (collapseToAncestors)
+    {
+        ::collapseMaterialBindings(stage, relName, bindings);
+    }
+
+    // The specs are authored in path order, so that the resulting layer does not depend on the order of the hash map
+    std::vector<std::pair<SdfPath, size_t>> sortedBindings(bindings.begin(), bindings.end());
+    std::sort(sortedBindings.begin(), sortedBindings.end());
+
+    // Relationships which are already stronger than descendants are weakened to the default strength, matching UsdShadeMaterialBindingAPI::Bind
+    std::vector<bool> weaken(sortedBindings.size());
+    for (size_t i = 0; i < sortedBindings.size(); ++i)
+    {
+        const UsdRelationship rel = stage->GetPrimAtPath(sortedBindings[i].first).GetRelationship(relName);
+        weaken[i] = rel && UsdShadeMaterialBindingAPI::GetMaterialBindingStrength(rel) == UsdShadeTokens->strongerThanDescendants;
+    }
+
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    const TfToken& schemaName = UsdSchemaRegistry::GetSchemaTypeName<UsdShadeMaterialBindingAPI>();
+    SdfChangeBlock changeBlock;
+    for (size_t i = 0; i < sortedBindings.size(); ++i)
+    {
+        const SdfPath path = editTarget.MapToSpecPath(sortedBindings[i].first);
+        if (!SdfJustCreatePrimInLayer(layer, path))
+        {
+            *reason = TfStringPrintf("Failed to author a prim spec at <%s>", path.GetAsString().c_str());
+            return false;
+        }
+        ::addAppliedSchema(layer, path, schemaName);
+
+        const SdfPath relPath = path.AppendProperty(relName);
+        if (!layer->GetRelationshipAtPath(relPath))
+        {
+            SdfRelationshipSpec::New(layer->GetPrimAtPath(path), relName, /* custom */ false);
+        }
+        layer->SetField(relPath, SdfFieldKeys->TargetPaths, SdfPathListOp::CreateExplicit({ targets[sortedBindings[i].second] }));
+        if (weaken[i])
+        {
+            layer->SetField(relPath, UsdShadeTokens->bindMaterialAs, UsdShadeTokens->weakerThanDescendants);
+        }
+    }
+    return true;
+}
+
+bool usdex::core::bindMaterials(const std::vector<UsdPrim>& prims, const std::vector<UsdShadeMaterial>& materials, bool collapseToAncestors)
+{
+    USDEX_INSTRUMENT_SCOPE("bindMaterials");
+
+    std::string reason;
+    if (!usdex::core::detail::bindMaterials(prims, materials, UsdShadeTokens->allPurpose, collapseToAncestors, &reason))
+    {
+        TF_WARN("Unable to bind materials: %s", reason.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool usdex::core::bindMaterialSubsets(const std::vector<UsdGeomSubset>& subsets, const std::vector<UsdShadeMaterial>& materials)
+{
+    if (subsets.empty() || materials.empty())
+    {
+        TF_WARN("Unable to bind materials to subsets: The subsets or materials are empty.");
+        return false;
+    }
+    if (subsets.size() != materials.size())
+    {
+        TF_WARN("Unable to bind materials to subsets: The number of subsets does not equal the number of materials.");
         return false;
     }
 
@@ -345,11 +932,13 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
     const float metallic
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePreviewMaterial");
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
         return UsdShadeMaterial();
     }
 
@@ -422,10 +1011,10 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
     material.CreateDisplacementOutput().ConnectToSource(shader.CreateOutput(UsdShadeTokens->displacement, SdfValueTypeNames->Token));
 
     // Create default shader inputs to produce a physically based rendering result with the supplied values
-    shader.CreateInput(_tokens->color, SdfValueTypeNames->Color3f).Set(color);
-    shader.CreateInput(_tokens->opacity, SdfValueTypeNames->Float).Set(opacity);
-    shader.CreateInput(_tokens->roughness, SdfValueTypeNames->Float).Set(roughness);
-    shader.CreateInput(_tokens->metallic, SdfValueTypeNames->Float).Set(metallic);
+    detail::setAttributeValue(shader.CreateInput(_tokens->color, SdfValueTypeNames->Color3f).GetAttr(), color);
+    detail::setAttributeValue(shader.CreateInput(_tokens->opacity, SdfValueTypeNames->Float).GetAttr(), opacity);
+    detail::setAttributeValue(shader.CreateInput(_tokens->roughness, SdfValueTypeNames->Float).GetAttr(), roughness);
+    detail::setAttributeValue(shader.CreateInput(_tokens->metallic, SdfValueTypeNames->Float).GetAttr(), metallic);
 
     return material;
 }
@@ -443,7 +1032,12 @@ UsdShadeMaterial usdex::core::definePreviewMaterial(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdShadeMaterial due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdShadeMaterial();
     }
 
@@ -592,7 +1186,7 @@ bool usdex::core::addNormalTextureToPreviewMaterial(UsdShadeMaterial& material,
     UsdShadeOutput texShaderOutput = textureReader.CreateOutput(_tokens->rgb, SdfValueTypeNames->Float3);
     surface.CreateInput(_tokens->normal, SdfValueTypeNames->Normal3f).ConnectToSource(texShaderOutput);
 
-    if (isEightBitTextureFormat(textureReader.GetInput(_tokens->file)))
+    if (isEightBitTextureFormat(textureReader.GetInput(_tokens->file), texturePath))
     {
         // set the scale and bias to adjust normals into tangent space
         textureReader.CreateInput(_tokens->scale, SdfValueTypeNames->Float4).Set(GfVec4f(2, 2, 2, 1));
@@ -1027,72 +1621,11 @@ bool usdex::core::connectPrimvarShader(pxr::UsdShadeInput& shaderInput, const st
 
 bool usdex::core::addPreviewMaterialInterface(pxr::UsdShadeMaterial& material)
 {
-    if (!material)
-    {
-        TF_RUNTIME_ERROR("UsdShadeMaterial <%s> is not valid.", material.GetPath().GetAsString().c_str());
-        return false;
-    }
-
-    UsdShadeShader previewSurface = computeEffectivePreviewSurfaceShader(material);
-    if (!previewSurface)
-    {
-        TF_RUNTIME_ERROR(
-            "UsdShadeMaterial <%s> does not have a valid surface shader for the universal render context.",
-            material.GetPath().GetAsString().c_str()
-        );
-        return false;
-    }
-
-    // Ensure this is the only surface shader. The implementation of this function is ill-suited for multi render context shader networks, as one
-    // of the primary goals of Material Interfaces are to be a common interface across all render contexts. This function will instead produce
-    // inputs that are uniquely named based on the UsdPreviewSurface specification, and may not map one-to-one with other contexts.
-    UsdShadeAttributeVector effectiveSurfaceOutputs;
-    for (const UsdShadeOutput& output : material.GetSurfaceOutputs())
-    {
-        for (const auto& outputAttr : output.GetValueProducingAttributes())
-        {
-            effectiveSurfaceOutputs.push_back(outputAttr);
-        }
-    }
-    if (effectiveSurfaceOutputs.size() > 1 || effectiveSurfaceOutputs.empty())
-    {
-        TF_RUNTIME_ERROR(
-            "UsdShadeMaterial <%s> has %zu effective surface outputs. This function is not suitable for multi-context shader networks.",
-            material.GetPath().GetAsString().c_str(),
-            size_t(effectiveSurfaceOutputs.size()) // explicit cast as the type changed from uint32_t to size_t in usd 24.08
-        );
-        return false;
-    }
-
     std::vector<TfToken> inputNames;
     std::vector<UsdShadeInput> inputsToPromote;
-    for (UsdShadeInput input : previewSurface.GetInputs(/* onlyAuthored */ true))
+    if (!::collectPreviewMaterialInterface(material, inputNames, inputsToPromote))
     {
-        for (auto inputAttr : input.GetValueProducingAttributes())
-        {
-            // Direct value producing inputs with authored values should be promoted
-            if (UsdShadeUtils::GetType(inputAttr.GetName()) == UsdShadeAttributeType::Input && inputAttr.HasAuthoredValue())
-            {
-                TfToken baseName = UsdShadeUtils::GetBaseNameAndType(inputAttr.GetName()).first;
-                UsdShadeShader inputShader = UsdShadeShader(inputAttr.GetPrim());
-                inputsToPromote.push_back(inputShader.GetInput(baseName));
-                inputNames.push_back(baseName);
-            }
-            else if (UsdShadeUtils::GetType(inputAttr.GetName()) == UsdShadeAttributeType::Output)
-            {
-                // We can't generally determine which inputs on a shader are relevant to the given output. It may be be all inputs
-                // or may be some specific subset. We can make an exception for UsdUvTexture shaders, as we know the `file` input
-                // is the primary user-facing input.
-                // FUTURE: Consider a parameter to control this. Maybe we should cross the shader boundary for all shaders, or for
-                // some user specified subset.
-                UsdShadeShader inputShader = UsdShadeShader(inputAttr.GetPrim());
-                if (isShaderType(inputShader, _tokens->uvTexId))
-                {
-                    inputsToPromote.push_back(inputShader.GetInput(_tokens->file));
-                    inputNames.push_back(inputShader.GetPrim().GetName());
-                }
-            }
-        }
+        return false;
     }
 
     for (size_t i = 0; i < inputsToPromote.size(); ++i)
@@ -1198,6 +1731,451 @@ bool usdex::core::removeMaterialInterface(UsdShadeMaterial& material, bool bakeV
     return overallStatus;
 }
 
+bool usdex::core::addPreviewMaterialInterfaces(UsdPrim root)
+{
+    USDEX_INSTRUMENT_SCOPE("addPreviewMaterialInterfaces");
+
+    if (!root)
+    {
+        TF_RUNTIME_ERROR("Unable to add Material Interfaces due to an invalid root prim");
+        return false;
+    }
+
+    struct Promotion
+    {
+        SdfPath source;
+        SdfPath destination;
+        SdfValueTypeName typeName;
+        VtValue value;
+    };
+
+    // The shader networks of every material are resolved before anything is authored, so that no query recomposes partially edited materials
+    bool result = true;
+    std::vector<Promotion> promotions;
+    for (const UsdPrim& prim : UsdPrimRange(root))
+    {
+        if (!prim.IsA<UsdShadeMaterial>())
+        {
+            continue;
+        }
+
+        TfTokenVector inputNames;
+        std::vector<UsdShadeInput> inputsToPromote;
+        if (!::collectPreviewMaterialInterface(UsdShadeMaterial(prim), inputNames, inputsToPromote))
+        {
+            result = false;
+            continue;
+        }
+
+        for (size_t i = 0; i < inputsToPromote.size(); ++i)
+        {
+            Promotion& promotion = promotions.emplace_back();
+            promotion.source = prim.GetPath().AppendProperty(UsdShadeUtils::GetFullName(inputNames[i], UsdShadeAttributeType::Input));
+            promotion.destination = inputsToPromote[i].GetAttr().GetPath();
+            promotion.typeName = inputsToPromote[i].GetTypeName();
+            inputsToPromote[i].Get(&promotion.value);
+        }
+    }
+
+    const UsdEditTarget& editTarget = root.GetStage()->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    SdfChangeBlock changeBlock;
+    for (const Promotion& promotion : promotions)
+    {
+        const SdfPath sourcePath = editTarget.MapToSpecPath(promotion.source);
+        SdfAttributeSpecHandle source = usdex::core::detail::getOrCreateAttributeSpec(layer, sourcePath, promotion.typeName);
+        SdfAttributeSpecHandle destination =
+            usdex::core::detail::getOrCreateAttributeSpec(layer, editTarget.MapToSpecPath(promotion.destination), promotion.typeName);
+        if (!source || !destination)
+        {
+            TF_WARN("Failed to connect <%s> to <%s>", promotion.source.GetAsString().c_str(), promotion.destination.GetAsString().c_str());
+            result = false;
+            continue;
+        }
+
+        // transfer the current value from destination to source
+        if (!promotion.value.IsEmpty() && !source->SetDefaultValue(promotion.value))
+        {
+            TF_WARN(
+                "Failed to transfer value from <%s> to <%s>",
+                promotion.destination.GetAsString().c_str(),
+                promotion.source.GetAsString().c_str()
+            );
+        }
+
+        // connect the destination, then remove its authored value, so the connection provides the only opinion
+        destination->SetField(SdfFieldKeys->ConnectionPaths, SdfPathListOp::CreateExplicit({ sourcePath.StripAllVariantSelections() }));
+        destination->ClearDefaultValue();
+        destination->ClearField(SdfFieldKeys->TimeSamples);
+    }
+
+    return result;
+}
+
+bool usdex::core::removeMaterialInterfaces(UsdPrim root, bool bakeValues)
+{
+    USDEX_INSTRUMENT_SCOPE("removeMaterialInterfaces");
+
+    if (!root)
+    {
+        TF_RUNTIME_ERROR("Unable to remove Material Interfaces due to an invalid root prim");
+        return false;
+    }
+
+    const UsdEditTarget& editTarget = root.GetStage()->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+
+    struct Consumer
+    {
+        SdfPath path;
+        SdfValueTypeName typeName;
+        bool composedConnections;
+    };
+
+    struct InterfaceInput
+    {
+        SdfValueTypeName typeName;
+        VtValue value;
+        std::vector<Consumer> consumers;
+    };
+
+    // The consumers of every interface input are found in a single traversal, before anything is authored. Prims are visited before their
+    // children, so the inputs of each material are known before its shaders are visited.
+    std::map<SdfPath, InterfaceInput> inputs;
+    for (const UsdPrim& prim : UsdPrimRange(root))
+    {
+        if (prim.IsA<UsdShadeMaterial>())
+        {
+            for (const UsdShadeInput& input : UsdShadeMaterial(prim).GetInterfaceInputs())
+            {
+                InterfaceInput& entry = inputs[input.GetAttr().GetPath()];
+                entry.typeName = input.GetTypeName();
+                if (bakeValues)
+                {
+                    input.Get(&entry.value);
+                }
+            }
+        }
+
+        if (inputs.empty() || !(prim.IsA<UsdShadeShader>() || prim.IsA<UsdShadeNodeGraph>()))
+        {
+            continue;
+        }
+
+        for (const UsdAttribute& attr : prim.GetAuthoredAttributes())
+        {
+            SdfPathVector sources;
+            if (UsdShadeUtils::GetType(attr.GetName()) != UsdShadeAttributeType::Input || !attr.GetConnections(&sources))
+            {
+                continue;
+            }
+
+            for (const SdfPath& source : sources)
+            {
+                // Only the material itself and its immediate children are consumers, matching UsdShadeNodeGraph::ComputeInterfaceInputConsumersMap
+                auto it = inputs.find(source);
+                if (it == inputs.end() || (source.GetPrimPath() != prim.GetPath() && source.GetPrimPath() != prim.GetPath().GetParentPath()))
+                {
+                    continue;
+                }
+                it->second.consumers.push_back(Consumer{ attr.GetPath(), attr.GetTypeName(), ::hasComposedConnections(attr, layer) });
+            }
+        }
+    }
+
+    bool overallStatus = true;
+    SdfChangeBlock changeBlock;
+    for (const auto& [path, input] : inputs)
+    {
+        bool status = true;
+        const SdfPath inputPath = editTarget.MapToSpecPath(path);
+        for (const Consumer& consumer : input.consumers)
+        {
+            // first clear the source connection. in the simple case of a single layer / non-composed connection this will be sufficient.
+            const SdfPath destinationPath = editTarget.MapToSpecPath(consumer.path);
+            SdfAttributeSpecHandle destination = layer->GetAttributeAtPath(destinationPath);
+            if (destination)
+            {
+                destination->ClearField(SdfFieldKeys->ConnectionPaths);
+            }
+
+            // if the connection comes via composition, we need to explicitly disconnect it
+            if (consumer.composedConnections)
+            {
+                destination = usdex::core::detail::getOrCreateAttributeSpec(layer, destinationPath, consumer.typeName);
+                if (!destination)
+                {
+                    status = false;
+                    overallStatus = false;
+                    TF_WARN("Failed to disconnect <%s> from <%s>", consumer.path.GetAsString().c_str(), path.GetAsString().c_str());
+                    continue;
+                }
+                SdfPathListOp listOp;
+                listOp.SetDeletedItems({ inputPath.StripAllVariantSelections() });
+                destination->SetField(SdfFieldKeys->ConnectionPaths, listOp);
+            }
+
+            if (bakeValues && !input.value.IsEmpty())
+            {
+                destination = destination ? destination : usdex::core::detail::getOrCreateAttributeSpec(layer, destinationPath, consumer.typeName);
+                if (!destination || !destination->SetDefaultValue(input.value))
+                {
+                    TF_WARN("Failed to transfer value from <%s> to <%s>", path.GetAsString().c_str(), consumer.path.GetAsString().c_str());
+                }
+            }
+        }
+        if (!status)
+        {
+            // we shouldn't remove the input if there are still connected destinations
+            continue;
+        }
+
+        // finally, remove the input from the material
+        if (SdfAttributeSpecHandle spec = layer->GetAttributeAtPath(inputPath))
+        {
+            layer->GetPrimAtPath(inputPath.GetPrimPath())->RemoveProperty(spec);
+        }
+        else if (SdfAttributeSpecHandle blocked = usdex::core::detail::getOrCreateAttributeSpec(layer, inputPath, input.typeName))
+        {
+            // if the input comes from composition, the best we can do is block it
+            blocked->SetDefaultValue(VtValue(SdfValueBlock()));
+        }
+    }
+
+    return overallStatus;
+}
+
+class usdex::core::MaterialRegistry::MaterialRegistryImpl
+{
+
+public:
+
+    explicit MaterialRegistryImpl(UsdPrim parent) : m_parent(parent), m_reuseCount(0)
+    {
+    }
+
+    bool isValid() const
+    {
+        return m_parent.IsValid();
+    }
+
+    UsdShadeMaterial defineMaterial(const std::string& name, const VtDictionary& key, const DefineFn& define)
+    {
+        if (!isValid())
+        {
+            TF_RUNTIME_ERROR("Unable to define material \"%s\" due to an invalid MaterialRegistry", name.c_str());
+            return UsdShadeMaterial();
+        }
+
+        // Find a material with an equal key
+        const size_t hash = computeHash(key);
+        const auto range = m_entries.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second.key != key)
+            {
+                continue;
+            }
+
+            UsdShadeMaterial material(m_parent.GetStage()->GetPrimAtPath(it->second.path));
+            if (material)
+            {
+                ++m_reuseCount;
+                return material;
+            }
+
+            // The material has been removed since it was defined, so it must be defined again
+            m_entries.erase(it);
+            break;
+        }
+
+        if (!define)
+        {
+            TF_CODING_ERROR("Unable to define material \"%s\" due to an invalid define function", name.c_str());
+            return UsdShadeMaterial();
+        }
+
+        // Otherwise define a new material, ensuring that it does not replace an existing child of the parent
+        UsdShadeMaterial material = define(m_parent, usdex::core::getValidChildName(m_parent, name).GetString());
+        if (!material)
+        {
+            return UsdShadeMaterial();
+        }
+
+        m_entries.emplace(hash, Entry{ key, material.GetPath() });
+        return material;
+    }
+
+    size_t getMaterialCount() const
+    {
+        return m_entries.size();
+    }
+
+    size_t getReuseCount() const
+    {
+        return m_reuseCount;
+    }
+
+private:
+
+    struct Entry
+    {
+        VtDictionary key;
+        SdfPath path;
+    };
+
+    static size_t computeHash(const VtDictionary& key)
+    {
+        // VtDictionary is ordered, so equal keys produce equal hashes
+        size_t result = key.size();
+        for (const auto& [name, value] : key)
+        {
+            result = TfHash::Combine(result, name, value);
+        }
+        return result;
+    }
+
+    UsdPrim m_parent;
+    std::unordered_multimap<size_t, Entry> m_entries;
+    size_t m_reuseCount;
+};
+
+usdex::core::MaterialRegistry::MaterialRegistry(UsdPrim parent) : m_impl(new MaterialRegistryImpl(parent))
+{
+    if (!m_impl->isValid())
+    {
+        TF_RUNTIME_ERROR("Unable to create MaterialRegistry due to an invalid parent prim");
+    }
+}
+
+usdex::core::MaterialRegistry::~MaterialRegistry()
+{
+    delete m_impl;
+}
+
+bool usdex::core::MaterialRegistry::isValid() const
+{
+    return m_impl->isValid();
+}
+
+UsdShadeMaterial usdex::core::MaterialRegistry::definePreviewMaterial(const std::string& name, const PreviewMaterialParams& params)
+{
+    USDEX_INSTRUMENT_SCOPE("MaterialRegistry::definePreviewMaterial");
+
+    VtDictionary key{
+        { "type", VtValue(_tokens->upsId) },
+        { "color", VtValue(params.color) },
+        { "opacity", VtValue(params.opacity) },
+        { "roughness", VtValue(params.roughness) },
+        { "metallic", VtValue(params.metallic) },
+        { "diffuseTexture", VtValue(params.diffuseTexture) },
+        { "normalTexture", VtValue(params.normalTexture) },
+        { "ormTexture", VtValue(params.ormTexture) },
+        { "roughnessTexture", VtValue(params.roughnessTexture) },
+        { "metallicTexture", VtValue(params.metallicTexture) },
+        { "opacityTexture", VtValue(params.opacityTexture) },
+        { "emissiveTexture", VtValue(params.emissiveTexture) },
+    };
+    if (params.emissiveColor.has_value())
+    {
+        key["emissiveColor"] = VtValue(params.emissiveColor.value());
+    }
+
+    return m_impl->defineMaterial(
+        name,
+        key,
+        [&params](UsdPrim parent, const std::string& childName)
+        {
+            UsdShadeMaterial material = usdex::core::definePreviewMaterial(
+                parent,
+                childName,
+                params.color,
+                params.opacity,
+                params.roughness,
+                params.metallic
+            );
+            if (material && !::addPreviewMaterialParams(material, params))
+            {
+                // Remove the partially authored material, so that a later request with valid textures is not confused with it
+                parent.GetStage()->RemovePrim(material.GetPath());
+                return UsdShadeMaterial();
+            }
+            return material;
+        }
+    );
+}
+
+UsdShadeMaterial usdex::core::MaterialRegistry::defineMaterial(const std::string& name, const VtDictionary& key, const DefineFn& define)
+{
+    USDEX_INSTRUMENT_SCOPE("MaterialRegistry::defineMaterial");
+
+    return m_impl->defineMaterial(name, key, define);
+}
+
+size_t usdex::core::MaterialRegistry::getMaterialCount() const
+{
+    return m_impl->getMaterialCount();
+}
+
+size_t usdex::core::MaterialRegistry::getReuseCount() const
+{
+    return m_impl->getReuseCount();
+}
+
+class usdex::core::SharedTextureScope::SharedTextureScopeImpl
+{
+
+public:
+
+    SharedTextureScopeImpl(UsdPrim parent) : m_readers(parent)
+    {
+    }
+
+    bool isValid() const
+    {
+        return m_readers.isValid();
+    }
+
+    UsdShadeNodeGraph getNodeGraph() const
+    {
+        return m_readers.getNodeGraph();
+    }
+
+private:
+
+    // The textures of the shared readers are resolved once for the lifetime of the scope
+    usdex::core::detail::ResolverCacheScope m_resolverCache;
+    ::SharedTextureReaders m_readers;
+};
+
+usdex::core::SharedTextureScope::SharedTextureScope(UsdPrim parent) : m_impl(new SharedTextureScopeImpl(parent))
+{
+    if (!m_impl->isValid())
+    {
+        TF_RUNTIME_ERROR("Unable to create SharedTextureScope due to an invalid parent prim");
+    }
+}
+
+usdex::core::SharedTextureScope::~SharedTextureScope()
+{
+    delete m_impl;
+}
+
+bool usdex::core::SharedTextureScope::isValid() const
+{
+    return m_impl->isValid();
+}
+
+UsdShadeNodeGraph usdex::core::SharedTextureScope::getNodeGraph() const
+{
+    return m_impl->getNodeGraph();
+}
+
+bool usdex::core::SharedTextureScope::isActive(UsdStagePtr stage)
+{
+    return stage && ::SharedTextureReaders::find(stage) != nullptr;
+}
+
 const pxr::TfToken& usdex::core::getColorSpaceToken(ColorSpace value)
 {
     switch (value)
@@ -1231,3 +2209,42 @@ GfVec3f usdex::core::linearToSrgb(const GfVec3f& color)
 {
     return GfVec3f(fromLinear(color[0]), fromLinear(color[1]), fromLinear(color[2]));
 }
+
+VtVec3fArray usdex::core::sRgbToLinear(const VtVec3fArray& colors)
+{
+    USDEX_INSTRUMENT_SCOPE("sRgbToLinear");
+    USDEX_INSTRUMENT_ARRAY(colors);
+
+    const std::array<float, 256>& table = ::getEightBitLinearTable();
+    return ::convertColors(colors, [&table](float value) { return ::toLinear(value, table); });
+}
+
+VtVec3fArray usdex::core::linearToSrgb(const VtVec3fArray& colors)
+{
+    USDEX_INSTRUMENT_SCOPE("linearToSrgb");
+    USDEX_INSTRUMENT_ARRAY(colors);
+
+    return ::convertColors(colors, [](float value) { return ::fromLinear(value); });
+}
+
+usdex::core::Vec3fPrimvarData usdex::core::sRgbToLinear(const Vec3fPrimvarData& colors)
+{
+    // Only the values are converted, so the indices are shared rather than copied
+    VtVec3fArray values = usdex::core::sRgbToLinear(colors.values());
+    if (colors.hasIndices())
+    {
+        return Vec3fPrimvarData(colors.interpolation(), std::move(values), VtIntArray(colors.indices()), colors.elementSize());
+    }
+    return Vec3fPrimvarData(colors.interpolation(), std::move(values), colors.elementSize());
+}
+
+usdex::core::Vec3fPrimvarData usdex::core::linearToSrgb(const Vec3fPrimvarData& colors)
+{
+    // Only the values are converted, so the indices are shared rather than copied
+    VtVec3fArray values = usdex::core::linearToSrgb(colors.values());
+    if (colors.hasIndices())
+    {
+        return Vec3fPrimvarData(colors.interpolation(), std::move(values), VtIntArray(colors.indices()), colors.elementSize());
+    }
+    return Vec3fPrimvarData(colors.interpolation(), std::move(values), colors.elementSize());
+}
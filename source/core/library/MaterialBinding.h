@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usdShade/material.h>
+
+#include <string>
+#include <vector>
+
+namespace usdex::core::detail
+{
+
+//! Author direct bindings of a single purpose to the given materials on many prims at once.
+//!
+//! This is the implementation of `bindMaterials()` and `bindPhysicsMaterials()`. All of the prims and materials are validated before anything is
+//! authored, and the `UsdShadeMaterialBindingAPI` and binding relationships are then authored directly to the current edit target layer within a
+//! single `SdfChangeBlock`.
+//!
+//! @param prims The prims that the materials will affect. They must all belong to the same stage.
+//! @param materials The materials to bind to the prims, in the same order. A single material may be supplied to bind it to every prim.
+//! @param purpose The material purpose of the bindings (e.g. `UsdShadeTokens->allPurpose`)
+//! @param collapseToAncestors Whether to bind common ancestors rather than each prim, when every child of the ancestor shares a material
+//! @param reason The reason the bindings could not be authored, for the caller to report
+//! @returns Whether the materials were successfully bound to the prims.
+bool bindMaterials(
+    const std::vector<pxr::UsdPrim>& prims,
+    const std::vector<pxr::UsdShadeMaterial>& materials,
+    const pxr::TfToken& purpose,
+    bool collapseToAncestors,
+    std::string* reason
+);
+
+} // namespace usdex::core::detail
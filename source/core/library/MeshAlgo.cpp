@@ -4,8 +4,32 @@
 
 #include "usdex/core/MeshAlgo.h"
 
+#include "usdex/core/ExtentAlgo.h"
+#include "usdex/core/MaterialAlgo.h"
+#include "usdex/core/ScratchArena.h"
 #include "usdex/core/StageAlgo.h"
-
+#include "usdex/core/XformAlgo.h"
+
+#include "AuthoringErrors.h"
+#include "Debug.h"
+#include "Instrumentation.h"
+#include "MeshDecimation.h"
+#include "PrimSpecWriter.h"
+#include "UnchangedValues.h"
+
+#include <pxr/base/gf/math.h>
+#include <pxr/base/gf/range3f.h>
+#include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/sort.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/subset.h>
@@ -13,7 +37,14 @@
 #include <pxr/usd/usdShade/tokens.h>
 #include <pxr/usd/usdUtils/pipeline.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
 #include <numeric>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 
 using namespace usdex::core;
@@ -22,14 +53,20 @@ using namespace pxr;
 namespace
 {
 
-// Validate the interpolation given the topology information
+TF_DEFINE_PRIVATE_TOKENS(
+    _tokens,
+    (displayColor)
+    (displayOpacity)
+);
+
+// Validate the interpolation given the number of faces, face vertices, and points of the mesh
 template <typename T>
 bool validatePrimvarInterpolation(
     const PrimvarData<T>& primvar,
     const TfTokenVector& interpolations,
-    const VtArray<int>& faceVertexCounts,
-    const VtArray<int>& faceVertexIndices,
-    const VtArray<GfVec3f>& points
+    size_t numFaces,
+    size_t numFaceVertices,
+    size_t numPoints
 )
 {
     if (std::find(interpolations.begin(), interpolations.end(), primvar.interpolation()) == interpolations.end())
@@ -46,19 +83,19 @@ bool validatePrimvarInterpolation(
     }
 
     // Uniform interpolation requires a value for every face on the mesh
-    if (primvar.interpolation() == UsdGeomTokens->uniform && size == faceVertexCounts.size())
+    if (primvar.interpolation() == UsdGeomTokens->uniform && size == numFaces)
     {
         return true;
     }
 
     // Vertex interpolation requires a value for every point in the mesh
-    if (primvar.interpolation() == UsdGeomTokens->vertex && size == points.size())
+    if (primvar.interpolation() == UsdGeomTokens->vertex && size == numPoints)
     {
         return true;
     }
 
     // Face varying interpolation requires a value for every face vertex in the mesh
-    if (primvar.interpolation() == UsdGeomTokens->faceVarying && size == faceVertexIndices.size())
+    if (primvar.interpolation() == UsdGeomTokens->faceVarying && size == numFaceVertices)
     {
         return true;
     }
@@ -74,13 +111,13 @@ template <typename T>
 bool validatePrimvar(
     const PrimvarData<T>& primvar,
     const TfTokenVector& interpolations,
-    const VtArray<int>& faceVertexCounts,
-    const VtArray<int>& faceVertexIndices,
-    const VtArray<GfVec3f>& points,
+    size_t numFaces,
+    size_t numFaceVertices,
+    size_t numPoints,
     std::string* reason
 )
 {
-    if (!::validatePrimvarInterpolation<T>(primvar, interpolations, faceVertexCounts, faceVertexIndices, points))
+    if (!::validatePrimvarInterpolation<T>(primvar, interpolations, numFaces, numFaceVertices, numPoints))
     {
         if (reason != nullptr)
         {
@@ -106,132 +143,251 @@ bool validatePrimvar(
     return true;
 }
 
+// Meshes with fewer faces (or vertices) than this are computed in a single task as the scheduling overhead would outweigh any gains
+static constexpr size_t s_normalsGrainSize = 4096;
+
+// Compute the offset of the first face vertex index of each face using a prefix sum over the face vertex counts
+void fillFaceOffsets(const VtIntArray& faceVertexCounts, size_t* faceOffsets)
+{
+    size_t offset = 0;
+    for (size_t faceIndex = 0; faceIndex < faceVertexCounts.size(); ++faceIndex)
+    {
+        faceOffsets[faceIndex] = offset;
+        offset += faceVertexCounts[faceIndex];
+    }
+}
+
+std::vector<size_t> computeFaceOffsets(const VtIntArray& faceVertexCounts)
+{
+    std::vector<size_t> faceOffsets(faceVertexCounts.size());
+    ::fillFaceOffsets(faceVertexCounts, faceOffsets.data());
+    return faceOffsets;
+}
+
+// Accumulate the vector area of a face.
+// Triangles and quads are unrolled, but the summation order matches the general polygon loop so that results are bitwise identical.
+GfVec3d computeVectorArea(const int* indices, const int vertexCount, const GfVec3f* points)
+{
+    GfVec3d vectorArea(0.0, 0.0, 0.0);
+
+    // Get the first vertex
+    const GfVec3d v0(points[indices[0]]);
+
+    if (vertexCount == 3)
+    {
+        vectorArea += GfCross(GfVec3d(points[indices[1]]) - v0, GfVec3d(points[indices[2]]) - v0);
+        return vectorArea;
+    }
+
+    if (vertexCount == 4)
+    {
+        const GfVec3d edge1 = GfVec3d(points[indices[1]]) - v0;
+        const GfVec3d edge2 = GfVec3d(points[indices[2]]) - v0;
+        const GfVec3d edge3 = GfVec3d(points[indices[3]]) - v0;
+        vectorArea += GfCross(edge1, edge2);
+        vectorArea += GfCross(edge2, edge3);
+        return vectorArea;
+    }
+
+    // Sum cross products of consecutive edges
+    for (int i = 1; i < vertexCount - 1; ++i)
+    {
+        // Cross product of (v1-v0) and (v2-v0)
+        const GfVec3d edge1 = GfVec3d(points[indices[i]]) - v0;
+        const GfVec3d edge2 = GfVec3d(points[indices[i + 1]]) - v0;
+        vectorArea += GfCross(edge1, edge2);
+    }
+
+    return vectorArea;
+}
+
 // Compute face normals using vector-area approach
-std::vector<pxr::GfVec3f> computeFaceNormals(
+// Faces are processed in parallel and written directly into the supplied storage, which must hold one normal per face. The storage is either
+// the returned array (for uniform normals) or a scratch buffer (when the face normals only contribute to other interpolations).
+void computeFaceNormals(
     const VtIntArray& faceVertexCounts,
     const VtIntArray& faceVertexIndices,
+    const size_t* faceOffsets,
     const VtVec3fArray& points,
     const pxr::GfVec3f& defaultNormal,
+    GfVec3f* faceNormalsData,
     std::string* reason
 )
 {
+    const size_t numFaces = faceVertexCounts.size();
 
-    std::vector<pxr::GfVec3f> faceNormals;
-    faceNormals.reserve(faceVertexCounts.size());
+    // Acquire raw pointers once so that no copy-on-write checks occur in the parallel loop
+    const int* countsData = faceVertexCounts.cdata();
+    const int* indicesData = faceVertexIndices.cdata();
+    const GfVec3f* pointsData = points.cdata();
 
-    GfVec3d vectorArea;
-    bool hasDegenerateFaces = false;
-    size_t vertexIndex = 0;
-    for (size_t faceIndex = 0; faceIndex < faceVertexCounts.size(); ++faceIndex)
-    {
-        const int vertexCount = faceVertexCounts[faceIndex];
-        if (vertexCount < 3)
+    std::atomic<bool> hasDegenerateFaces(false);
+    WorkParallelForN(
+        numFaces,
+        [&](size_t begin, size_t end)
         {
-            hasDegenerateFaces = true;
-            // Fallback to a default normal if the face has less than 3 vertices
-            faceNormals.push_back(defaultNormal);
-            vertexIndex += vertexCount;
-            continue;
-        }
+            bool localDegenerate = false;
+            for (size_t faceIndex = begin; faceIndex < end; ++faceIndex)
+            {
+                const int vertexCount = countsData[faceIndex];
+                if (vertexCount < 3)
+                {
+                    // Fallback to a default normal if the face has less than 3 vertices
+                    localDegenerate = true;
+                    faceNormalsData[faceIndex] = defaultNormal;
+                    continue;
+                }
 
-        vectorArea = GfVec3d(0.0, 0.0, 0.0);
+                const GfVec3d vectorArea = computeVectorArea(indicesData + faceOffsets[faceIndex], vertexCount, pointsData);
 
-        // Get the first vertex
-        const GfVec3f& v0 = points[faceVertexIndices[vertexIndex]];
+                // Normalize the vector area to get the face normal
+                const double length = vectorArea.GetLength();
+                if (length > 1e-14)
+                {
+                    faceNormalsData[faceIndex] = GfVec3f(vectorArea / length);
+                }
+                else
+                {
+                    // Fallback to a default normal if the face is degenerate
+                    localDegenerate = true;
+                    faceNormalsData[faceIndex] = defaultNormal;
+                }
+            }
 
-        // Sum cross products of consecutive edges
-        for (int i = 1; i < vertexCount - 1; ++i)
-        {
-            const GfVec3f& v1 = points[faceVertexIndices[vertexIndex + i]];
-            const GfVec3f& v2 = points[faceVertexIndices[vertexIndex + i + 1]];
+            if (localDegenerate)
+            {
+                hasDegenerateFaces.store(true, std::memory_order_relaxed);
+            }
+        },
+        s_normalsGrainSize
+    );
 
-            // Cross product of (v1-v0) and (v2-v0)
-            const GfVec3d edge1 = GfVec3d(v1) - GfVec3d(v0);
-            const GfVec3d edge2 = GfVec3d(v2) - GfVec3d(v0);
-            const GfVec3d cross = GfCross(edge1, edge2);
-            vectorArea += cross;
-        }
+    if (hasDegenerateFaces.load() && reason != nullptr)
+    {
+        *reason = TfStringPrintf("Some faces are degenerate and have been assigned fallback normals");
+    }
+}
 
-        // Normalize the vector area to get the face normal
-        const double length = vectorArea.GetLength();
-        if (length > 1e-14)
-        {
-            faceNormals.push_back(GfVec3f(vectorArea / length));
-        }
-        else
+// A vertex to face corner adjacency in compressed sparse row form.
+// The corners of each vertex are stored in face order, so that gathering over a vertex visits its faces in the same order as a serial scatter.
+// The adjacency is discarded once the normals have been computed, so it is allocated from the scratch arena.
+struct VertexAdjacency
+{
+    detail::ScratchArray<size_t> offsets; // the first entry in corners and faces for each vertex, plus a final entry for the total
+    detail::ScratchArray<size_t> corners; // the face vertex index of each entry
+    detail::ScratchArray<int> faces; // the face of each entry
+};
+
+VertexAdjacency buildVertexAdjacency(
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const size_t* faceOffsets,
+    size_t numPoints
+)
+{
+    const size_t numFaces = faceVertexCounts.size();
+    const int* countsData = faceVertexCounts.cdata();
+    const int* indicesData = faceVertexIndices.cdata();
+
+    // Count the corners referencing each vertex
+    detail::ScratchArray<size_t> offsets(numPoints + 1, 0);
+    for (const int vertexIdx : faceVertexIndices)
+    {
+        if (vertexIdx >= 0 && static_cast<size_t>(vertexIdx) < numPoints)
         {
-            hasDegenerateFaces = true;
-            // Fallback to a default normal if the face is degenerate
-            faceNormals.push_back(defaultNormal);
+            ++offsets[vertexIdx + 1];
         }
-
-        vertexIndex += vertexCount;
     }
-
-    if (hasDegenerateFaces && reason != nullptr)
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // Fill the adjacency in face order
+    const size_t numEntries = offsets[numPoints];
+    VertexAdjacency adjacency{ std::move(offsets), detail::ScratchArray<size_t>(numEntries), detail::ScratchArray<int>(numEntries) };
+    detail::ScratchArray<size_t> cursor(numPoints);
+    std::copy_n(adjacency.offsets.data(), numPoints, cursor.data());
+    for (size_t faceIndex = 0; faceIndex < numFaces; ++faceIndex)
     {
-        *reason = TfStringPrintf("Some faces are degenerate and have been assigned fallback normals");
+        const size_t faceOffset = faceOffsets[faceIndex];
+        for (int i = 0; i < countsData[faceIndex]; ++i)
+        {
+            const int vertexIdx = indicesData[faceOffset + i];
+            if (vertexIdx >= 0 && static_cast<size_t>(vertexIdx) < numPoints)
+            {
+                const size_t entry = cursor[vertexIdx]++;
+                adjacency.corners[entry] = faceOffset + i;
+                adjacency.faces[entry] = static_cast<int>(faceIndex);
+            }
+        }
     }
 
-    return faceNormals;
+    return adjacency;
 }
 
 // Compute vertex normals by averaging face normals
-std::vector<pxr::GfVec3f> computeVertexNormals(
+// The vertex adjacency allows each vertex to gather its contributing faces without atomics or locks.
+VtVec3fArray computeVertexNormals(
     const VtIntArray& faceVertexCounts,
     const VtIntArray& faceVertexIndices,
+    const size_t* faceOffsets,
     const VtVec3fArray& points,
     const pxr::GfVec3f& defaultNormal,
     std::string* reason
 )
 {
-    // First compute face normals
-    auto faceNormals = computeFaceNormals(faceVertexCounts, faceVertexIndices, points, defaultNormal, reason);
-    if (faceNormals.empty())
+    if (faceVertexCounts.empty())
     {
-        return {};
+        return VtVec3fArray();
     }
 
-    // Initialize vertex normals to zero
-    std::vector<pxr::GfVec3f> vertexNormals(points.size(), GfVec3f(0.0f, 0.0f, 0.0f));
+    // First compute face normals
+    detail::ScratchArray<GfVec3f> faceNormals(faceVertexCounts.size());
+    computeFaceNormals(faceVertexCounts, faceVertexIndices, faceOffsets, points, defaultNormal, faceNormals.data(), reason);
 
-    // Sum face normals for each vertex
-    size_t vertexIndex = 0;
-    for (size_t faceIndex = 0; faceIndex < faceVertexCounts.size(); ++faceIndex)
-    {
-        const int vertexCount = faceVertexCounts[faceIndex];
-        const GfVec3f& faceNormal = faceNormals[faceIndex];
+    const size_t numPoints = points.size();
+    const VertexAdjacency adjacency = buildVertexAdjacency(faceVertexCounts, faceVertexIndices, faceOffsets, numPoints);
+
+    // Sum and normalize the face normals for each vertex
+    VtVec3fArray vertexNormals(numPoints);
+    GfVec3f* vertexNormalsData = vertexNormals.data();
+    const GfVec3f* faceNormalsData = faceNormals.data();
 
-        for (int i = 0; i < vertexCount; ++i)
+    std::atomic<bool> hasVerticesWithoutFaces(false);
+    WorkParallelForN(
+        numPoints,
+        [&](size_t begin, size_t end)
         {
-            int vertexIdx = faceVertexIndices[vertexIndex + i];
-            if (vertexIdx >= 0 && vertexIdx < static_cast<int>(points.size()))
+            bool localWithoutFaces = false;
+            for (size_t vertexIdx = begin; vertexIdx < end; ++vertexIdx)
             {
-                vertexNormals[vertexIdx] += faceNormal;
-            }
-        }
+                GfVec3f normal(0.0f, 0.0f, 0.0f);
+                for (size_t i = adjacency.offsets[vertexIdx]; i < adjacency.offsets[vertexIdx + 1]; ++i)
+                {
+                    normal += faceNormalsData[adjacency.faces[i]];
+                }
 
-        vertexIndex += vertexCount;
-    }
+                const float length = normal.GetLength();
+                if (length > 1e-6f)
+                {
+                    normal /= length;
+                }
+                else
+                {
+                    // Fallback to a default normal if the vertex has no contributing faces
+                    localWithoutFaces = true;
+                    normal = defaultNormal;
+                }
+                vertexNormalsData[vertexIdx] = normal;
+            }
 
-    // Normalize vertex normals
-    bool hasVerticesWithoutFaces = false;
-    for (GfVec3f& normal : vertexNormals)
-    {
-        float length = normal.GetLength();
-        if (length > 1e-6f)
-        {
-            normal /= length;
-        }
-        else
-        {
-            // Fallback to a default normal if the vertex has no contributing faces
-            hasVerticesWithoutFaces = true;
-            normal = defaultNormal;
-        }
-    }
+            if (localWithoutFaces)
+            {
+                hasVerticesWithoutFaces.store(true, std::memory_order_relaxed);
+            }
+        },
+        s_normalsGrainSize
+    );
 
-    if (hasVerticesWithoutFaces)
+    if (hasVerticesWithoutFaces.load() && reason != nullptr)
     {
         *reason = TfStringPrintf("Some vertices have no contributing faces and have been assigned fallback normals");
     }
@@ -239,49 +395,147 @@ std::vector<pxr::GfVec3f> computeVertexNormals(
     return vertexNormals;
 }
 
-// Compute face-varying normals (corner normals)
-// This is a simplified implementation that uses the face normal for each corner
-std::vector<pxr::GfVec3f> computeFaceVaryingNormals(
+// Compute indexed face-varying normals (corner normals)
+// Without smoothing each face contributes a single value which is shared by all of its corners.
+// With smoothing the corners of each vertex are split into smoothing groups, in face order, by comparing their face normal with the first face
+// of each group. Each group is assigned a single value, so the result is indexed directly and no deduplication of the values is required.
+Vec3fPrimvarData computeFaceVaryingNormals(
     const VtIntArray& faceVertexCounts,
     const VtIntArray& faceVertexIndices,
+    const size_t* faceOffsets,
     const VtVec3fArray& points,
     const pxr::GfVec3f& defaultNormal,
+    float smoothingAngle,
     std::string* reason
 )
 {
-    auto faceNormals = computeFaceNormals(faceVertexCounts, faceVertexIndices, points, defaultNormal, reason);
-    if (faceNormals.empty())
+    if (faceVertexCounts.empty())
     {
-        return {};
+        return Vec3fPrimvarData(UsdGeomTokens->constant, VtVec3fArray());
     }
 
-    // Create face-varying normals by repeating face normals for each corner
-    std::vector<pxr::GfVec3f> cornerNormals;
-    cornerNormals.reserve(faceVertexIndices.size());
+    VtIntArray cornerIndices(faceVertexIndices.size());
+    int* cornerIndicesData = cornerIndices.data();
+    const int* countsData = faceVertexCounts.cdata();
 
-    size_t vertexIndex = 0;
-    for (size_t faceIndex = 0; faceIndex < faceVertexCounts.size(); ++faceIndex)
+    if (!(smoothingAngle > 0.0f))
     {
-        const int vertexCount = faceVertexCounts[faceIndex];
-        const GfVec3f& faceNormal = faceNormals[faceIndex];
+        // The face normals are the values of the result
+        VtVec3fArray faceNormals(faceVertexCounts.size());
+        computeFaceNormals(faceVertexCounts, faceVertexIndices, faceOffsets, points, defaultNormal, faceNormals.data(), reason);
+
+        // Assign the face normal to all corners of each face
+        WorkParallelForN(
+            faceVertexCounts.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t faceIndex = begin; faceIndex < end; ++faceIndex)
+                {
+                    std::fill_n(cornerIndicesData + faceOffsets[faceIndex], countsData[faceIndex], static_cast<int>(faceIndex));
+                }
+            },
+            s_normalsGrainSize
+        );
+        return Vec3fPrimvarData(UsdGeomTokens->faceVarying, std::move(faceNormals), std::move(cornerIndices));
+    }
 
-        // Assign the same face normal to all corners of this face
-        for (int i = 0; i < vertexCount; ++i)
+    // The face normals only contribute to the smoothing groups
+    detail::ScratchArray<GfVec3f> faceNormals(faceVertexCounts.size());
+    computeFaceNormals(faceVertexCounts, faceVertexIndices, faceOffsets, points, defaultNormal, faceNormals.data(), reason);
+
+    const size_t numPoints = points.size();
+    const VertexAdjacency adjacency = buildVertexAdjacency(faceVertexCounts, faceVertexIndices, faceOffsets, numPoints);
+    const GfVec3f* faceNormalsData = faceNormals.data();
+    const float cosThreshold = static_cast<float>(std::cos(GfDegreesToRadians(std::min(smoothingAngle, 180.0f))));
+
+    // Assign each corner a smoothing group local to its vertex. The local group is temporarily stored as the corner index.
+    detail::ScratchArray<size_t> groupOffsets(numPoints + 1, 0);
+    WorkParallelForN(
+        numPoints,
+        [&](size_t begin, size_t end)
         {
-            cornerNormals.push_back(faceNormal);
-        }
+            std::vector<int> groupFaces;
+            for (size_t vertexIdx = begin; vertexIdx < end; ++vertexIdx)
+            {
+                groupFaces.clear();
+                for (size_t i = adjacency.offsets[vertexIdx]; i < adjacency.offsets[vertexIdx + 1]; ++i)
+                {
+                    const GfVec3f& faceNormal = faceNormalsData[adjacency.faces[i]];
+                    size_t group = 0;
+                    while (group < groupFaces.size() && GfDot(faceNormal, faceNormalsData[groupFaces[group]]) < cosThreshold)
+                    {
+                        ++group;
+                    }
+                    if (group == groupFaces.size())
+                    {
+                        groupFaces.push_back(adjacency.faces[i]);
+                    }
+                    cornerIndicesData[adjacency.corners[i]] = static_cast<int>(group);
+                }
+                groupOffsets[vertexIdx + 1] = groupFaces.size();
+            }
+        },
+        s_normalsGrainSize
+    );
+    std::partial_sum(groupOffsets.begin(), groupOffsets.end(), groupOffsets.begin());
+
+    // Sum and normalize the face normals of each group, then offset the corner indices to the group values
+    VtVec3fArray cornerNormals(groupOffsets[numPoints], GfVec3f(0.0f, 0.0f, 0.0f));
+    GfVec3f* cornerNormalsData = cornerNormals.data();
+
+    std::atomic<bool> hasCancellingGroups(false);
+    WorkParallelForN(
+        numPoints,
+        [&](size_t begin, size_t end)
+        {
+            bool localCancelling = false;
+            for (size_t vertexIdx = begin; vertexIdx < end; ++vertexIdx)
+            {
+                const size_t groupOffset = groupOffsets[vertexIdx];
+                for (size_t i = adjacency.offsets[vertexIdx]; i < adjacency.offsets[vertexIdx + 1]; ++i)
+                {
+                    int& cornerIndex = cornerIndicesData[adjacency.corners[i]];
+                    cornerIndex += static_cast<int>(groupOffset);
+                    cornerNormalsData[cornerIndex] += faceNormalsData[adjacency.faces[i]];
+                }
+
+                for (size_t group = groupOffset; group < groupOffsets[vertexIdx + 1]; ++group)
+                {
+                    GfVec3f& normal = cornerNormalsData[group];
+                    const float length = normal.GetLength();
+                    if (length > 1e-6f)
+                    {
+                        normal /= length;
+                    }
+                    else
+                    {
+                        // Fallback to a default normal if the faces of the group cancel each other out
+                        localCancelling = true;
+                        normal = defaultNormal;
+                    }
+                }
+            }
+
+            if (localCancelling)
+            {
+                hasCancellingGroups.store(true, std::memory_order_relaxed);
+            }
+        },
+        s_normalsGrainSize
+    );
 
-        vertexIndex += vertexCount;
+    if (hasCancellingGroups.load() && reason != nullptr)
+    {
+        *reason = TfStringPrintf("Some smoothing groups have opposing faces and have been assigned fallback normals");
     }
 
-    return cornerNormals;
+    return Vec3fPrimvarData(UsdGeomTokens->faceVarying, std::move(cornerNormals), std::move(cornerIndices));
 }
 
-// Create an indexed Vec3fPrimvarData from a vector of values
-Vec3fPrimvarData getIndexedPrimvar(const std::vector<pxr::GfVec3f>& values, const pxr::TfToken& interpolation)
+// Create an indexed Vec3fPrimvarData from an array of values, taking ownership of the values
+Vec3fPrimvarData getIndexedPrimvar(VtVec3fArray&& values, const pxr::TfToken& interpolation)
 {
-    const VtVec3fArray valuesArray(values.begin(), values.end());
-    Vec3fPrimvarData primvarData(interpolation, valuesArray);
+    Vec3fPrimvarData primvarData(interpolation, std::move(values));
     primvarData.index();
     return primvarData;
 }
@@ -292,150 +546,614 @@ Vec3fPrimvarData getInvalidPrimvar()
     return Vec3fPrimvarData(UsdGeomTokens->constant, VtVec3fArray());
 }
 
-// Remove the subsets from the stage
-void removeSubsetsFromStage(UsdPrim prim, const TfToken& familyName, const std::vector<UsdGeomSubset>& subsets)
+// Validate the primvars of a mesh prior to definition, given the number of faces, face vertices, and points of the mesh.
+// If the data is invalid and error is non-null, a complete error message describing the validation failure will be set.
+bool validatePolyMeshPrimvars(
+    const SdfPath& path,
+    size_t numFaces,
+    size_t numFaceVertices,
+    size_t numPoints,
+    const Vec3fPrimvarData* normals,
+    const Vec2fPrimvarData* uvs,
+    const Vec3fPrimvarData* displayColor,
+    const FloatPrimvarData* displayOpacity,
+    std::string* error
+)
 {
-    // Remove the 'subsetFamily:<familyName>:familyType' property
-    const std::string propName = TfStringPrintf("subsetFamily:%s:familyType", familyName.GetText());
-    if (UsdProperty prop = prim.GetProperty(TfToken(propName)))
+    std::string reason;
+
+    // Normals must be valid if specified
+    if (normals != nullptr)
     {
-        prim.RemoveProperty(prop.GetName());
+        static const TfTokenVector validInterpolations = { UsdGeomTokens->uniform, UsdGeomTokens->vertex, UsdGeomTokens->faceVarying };
+        if (!::validatePrimvar(*normals, validInterpolations, numFaces, numFaceVertices, numPoints, &reason))
+        {
+            if (error != nullptr)
+            {
+                *error = TfStringPrintf(
+                    "Unable to define UsdGeomMesh at \"%s\" due to invalid normals: %s",
+                    path.GetAsString().c_str(),
+                    reason.c_str()
+                );
+            }
+            return false;
+        }
     }
 
-    for (const auto& subset : subsets)
+    // Uvs must be valid if specified
+    if (uvs != nullptr)
     {
-        if (subset.GetPrim().IsValid())
+        static const TfTokenVector validInterpolations = { UsdGeomTokens->vertex, UsdGeomTokens->faceVarying };
+        if (!::validatePrimvar(*uvs, validInterpolations, numFaces, numFaceVertices, numPoints, &reason))
         {
-            subset.GetPrim().GetStage()->RemovePrim(subset.GetPrim().GetPath());
+            if (error != nullptr)
+            {
+                *error = TfStringPrintf("Unable to define UsdGeomMesh at \"%s\" due to invalid uvs: %s", path.GetAsString().c_str(), reason.c_str());
+            }
+            return false;
         }
     }
-}
 
-// Define a subset of the geometry prim.
-UsdGeomSubset defineGeomSubset(
-    UsdStagePtr stage,
-    UsdGeomImageable geom,
-    const SdfPath& path,
-    const VtIntArray& faceIndices,
-    const TfToken& elementType,
-    const TfToken& familyName,
-    const TfToken& familyType,
-    std::string& reason
-)
-{
-    UsdGeomSubset subset = UsdGeomSubset::Define(stage, path);
-    if (!subset)
+    // All interpolations are valid by default
+    static const TfTokenVector s_allValidInterpolations = { UsdGeomTokens->constant,
+                                                            UsdGeomTokens->uniform,
+                                                            UsdGeomTokens->varying,
+                                                            UsdGeomTokens->vertex,
+                                                            UsdGeomTokens->faceVarying };
+
+    // Display color must be valid if specified
+    if (displayColor != nullptr)
     {
-        reason = TfStringPrintf("Unable to define subsets due to invalid subset");
-        return UsdGeomSubset();
+        if (!::validatePrimvar(*displayColor, s_allValidInterpolations, numFaces, numFaceVertices, numPoints, &reason))
+        {
+            if (error != nullptr)
+            {
+                *error = TfStringPrintf(
+                    "Unable to define UsdGeomMesh at \"%s\" due to invalid display color: %s",
+                    path.GetAsString().c_str(),
+                    reason.c_str()
+                );
+            }
+            return false;
+        }
     }
 
-    subset.GetIndicesAttr().Set(faceIndices);
-    subset.GetElementTypeAttr().Set(elementType);
-
-    // Allows empty familyName values.
-    // In this case, specifying "subset.SetFamilyType()" will result in an error, so it is skipped.
-    subset.GetFamilyNameAttr().Set(familyName);
-    if (!familyName.IsEmpty())
+    // Display opacity must be valid if specified
+    if (displayOpacity != nullptr)
     {
-        subset.SetFamilyType(geom, familyName, familyType);
+        if (!::validatePrimvar(*displayOpacity, s_allValidInterpolations, numFaces, numFaceVertices, numPoints, &reason))
+        {
+            if (error != nullptr)
+            {
+                *error = TfStringPrintf(
+                    "Unable to define UsdGeomMesh at \"%s\" due to invalid display opacity: %s",
+                    path.GetAsString().c_str(),
+                    reason.c_str()
+                );
+            }
+            return false;
+        }
     }
 
-    return subset;
+    return true;
 }
 
-// Define multiple subsets of a mesh
-std::vector<UsdGeomSubset> defineGeomSubsets(
-    UsdGeomMesh mesh,
-    const std::vector<TfToken>& names,
-    const std::vector<pxr::VtIntArray>& indices,
-    const TfToken& elementType,
-    const TfToken& familyName,
-    const TfToken& familyType,
-    std::string& reason
-)
+// Validate that the points are sufficient for a previously validated topology.
+// If the points are invalid and reason is non-null, an error message describing the validation error will be set.
+bool validateTopologyPoints(const MeshTopology& topology, const VtVec3fArray& points, std::string* reason)
 {
-    std::vector<UsdGeomSubset> subsets;
-
-    // Early out if the prim is invalid
-    if (!mesh)
-    {
-        reason = TfStringPrintf("Subsets cannot be defined due to an invalid prim");
-        return subsets;
-    }
-
-    // Early out if the family name is invalid.
-    if (!familyName.IsEmpty() && !SdfPath::IsValidNamespacedIdentifier(familyName.GetString()))
+    if (points.empty())
     {
-        reason = TfStringPrintf("Unable to define subsets due to invalid family name: \"%s\" is not a valid USD identifier", familyName.GetText());
-        return subsets;
+        if (reason != nullptr)
+        {
+            *reason = "Empty array";
+        }
+        return false;
     }
 
-    // Early out if the element type is invalid
-    else if (elementType != UsdGeomTokens->face && elementType != UsdGeomTokens->edge && elementType != UsdGeomTokens->point)
+    // Every face vertex index must refer to one of the points
+    const size_t minPoints = static_cast<size_t>(topology.getMaxIndex() + 1);
+    if (points.size() < minPoints)
     {
-        reason = TfStringPrintf("Unable to define subsets due to invalid element type for Mesh subsets: %s", elementType.GetText());
-        return subsets;
+        if (reason != nullptr)
+        {
+            *reason = TfStringPrintf("Expected at least %zu points but found %zu", minPoints, points.size());
+        }
+        return false;
     }
 
-    // Early out if the names or indices are empty
-    if (names.empty() || indices.empty())
-    {
-        reason = TfStringPrintf("Unable to define subsets due to invalid names or indices");
-        return subsets;
-    }
+    return true;
+}
 
-    // Early out if the names are invalid
-    std::vector<TfToken> validNames;
-    for (const auto& name : names)
+// Validate the points, topology, and primvars of a mesh prior to definition.
+// If the data is invalid and error is non-null, a complete error message describing the validation failure will be set.
+bool validatePolyMesh(
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    const Vec3fPrimvarData* normals,
+    const Vec2fPrimvarData* uvs,
+    const Vec3fPrimvarData* displayColor,
+    const FloatPrimvarData* displayOpacity,
+    std::string* error
+)
+{
+    // The points must not be empty
+    if (points.empty())
     {
-        if (name.IsEmpty())
-        {
-            reason = TfStringPrintf("There is an empty subset name");
-            return subsets;
-        }
-        if (!SdfPath::IsValidIdentifier(name.GetString()))
+        if (error != nullptr)
         {
-            reason = TfStringPrintf("Unable to define subsets due to invalid subset name: \"%s\" is not a valid USD identifier", name.GetText());
-            return subsets;
+            *error = TfStringPrintf("Unable to define UsdGeomMesh at \"%s\" due to invalid points: Empty array", path.GetAsString().c_str());
         }
+        return false;
+    }
 
-        // If the name is already in the validNames, return an error.
-        if (std::find(validNames.begin(), validNames.end(), name) != validNames.end())
+    // The topology must be valid
+    std::string reason;
+    if (!UsdGeomMesh::ValidateTopology(faceVertexIndices, faceVertexCounts, points.size(), &reason))
+    {
+        if (error != nullptr)
         {
-            reason = TfStringPrintf("Unable to define subsets due to duplicate subset name: '%s'", name.GetText());
-            return subsets;
+            *error = TfStringPrintf("Unable to define UsdGeomMesh at \"%s\" due to invalid topology: %s", path.GetAsString().c_str(), reason.c_str());
         }
-        validNames.push_back(name);
+        return false;
     }
 
-    // Early out if the names are invalid
-    if (names.size() != indices.size())
+    return ::validatePolyMeshPrimvars(
+        path,
+        faceVertexCounts.size(),
+        faceVertexIndices.size(),
+        points.size(),
+        normals,
+        uvs,
+        displayColor,
+        displayOpacity,
+        error
+    );
+}
+
+// Validate the points and primvars of a mesh with a previously validated topology prior to definition.
+// If the data is invalid and error is non-null, a complete error message describing the validation failure will be set.
+bool validatePolyMesh(
+    const SdfPath& path,
+    const MeshTopology& topology,
+    const VtVec3fArray& points,
+    const Vec3fPrimvarData* normals,
+    const Vec2fPrimvarData* uvs,
+    const Vec3fPrimvarData* displayColor,
+    const FloatPrimvarData* displayOpacity,
+    std::string* error
+)
+{
+    if (!topology.isValid())
     {
-        reason = TfStringPrintf("Length of names must equal length of indices. names %zu, indices %zu", names.size(), indices.size());
-        return subsets;
+        if (error != nullptr)
+        {
+            *error = TfStringPrintf(
+                "Unable to define UsdGeomMesh at \"%s\" due to invalid topology: The MeshTopology is not valid",
+                path.GetAsString().c_str()
+            );
+        }
+        return false;
     }
 
-    // Early out if the indices are empty
-    for (const auto& index : indices)
+    std::string reason;
+    if (!::validateTopologyPoints(topology, points, &reason))
     {
-        if (index.empty())
+        if (error != nullptr)
         {
-            reason = TfStringPrintf("Unable to define subsets due to empty subset indices");
-            return subsets;
+            *error = TfStringPrintf("Unable to define UsdGeomMesh at \"%s\" due to invalid points: %s", path.GetAsString().c_str(), reason.c_str());
         }
+        return false;
     }
 
-    // Early out if the proposed prim location is invalid
-    UsdStageWeakPtr stage = mesh.GetPrim().GetStage();
-    const SdfPath path = mesh.GetPath();
-    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    return ::validatePolyMeshPrimvars(
+        path,
+        topology.getFaceCount(),
+        topology.getFaceVertexCount(),
+        points.size(),
+        normals,
+        uvs,
+        displayColor,
+        displayOpacity,
+        error
+    );
+}
+
+// Meshes are validated in parallel in batches of this size, as validating a single small mesh is cheaper than scheduling a task
+static constexpr size_t s_meshValidationGrainSize = 64;
+
+// Author a default value for an attribute spec, creating the spec if it does not already exist.
+// This mirrors UsdPrim::CreateAttribute followed by UsdAttribute::Set, without requiring a composed prim.
+SdfAttributeSpecHandle setAttributeSpec(
+    const SdfPrimSpecHandle& primSpec,
+    const TfToken& name,
+    const SdfValueTypeName& typeName,
+    SdfVariability variability,
+    const VtValue& value
+)
+{
+    SdfAttributeSpecHandle attr = usdex::core::detail::getOrCreateAttributeSpec(primSpec, name, typeName, variability);
+    if (attr)
     {
-        reason = TfStringPrintf("Unable to define subsets due to invalid prim location: %s", reason.c_str());
-        return subsets;
+        attr->SetDefaultValue(value);
     }
+    return attr;
+}
 
-    // When subsets already exist within the given prim
+// Author PrimvarData on a prim spec.
+// This mirrors PrimvarData::setPrimvar at the default time, without requiring a composed UsdGeomPrimvar.
+template <typename T>
+bool setPrimvarSpec(const SdfPrimSpecHandle& primSpec, const TfToken& name, const SdfValueTypeName& typeName, const PrimvarData<T>& primvar)
+{
+    const TfToken attrName(SdfPath::JoinIdentifier("primvars", name.GetString()));
+    SdfAttributeSpecHandle attr = ::setAttributeSpec(primSpec, attrName, typeName, SdfVariabilityVarying, VtValue(primvar.values()));
+    if (!attr)
+    {
+        return false;
+    }
+
+    attr->SetInfo(UsdGeomTokens->interpolation, VtValue(primvar.interpolation()));
+
+    // Author an explicit opinion about the indices to ensure weaker opinions are overriden
+    const TfToken indicesName(SdfPath::JoinIdentifier(attrName.GetString(), "indices"));
+    const VtValue indices = primvar.hasIndices() ? VtValue(primvar.indices()) : VtValue(SdfValueBlock());
+    if (!::setAttributeSpec(primSpec, indicesName, SdfValueTypeNames->IntArray, SdfVariabilityVarying, indices))
+    {
+        return false;
+    }
+
+    if (primvar.elementSize() > 0)
+    {
+        attr->SetInfo(UsdGeomTokens->elementSize, VtValue(primvar.elementSize()));
+    }
+    else if (attr->HasInfo(UsdGeomTokens->elementSize))
+    {
+        // if the elementSize was previously authored, we need to reset it as there is no way to block element size
+        attr->SetInfo(UsdGeomTokens->elementSize, VtValue(1));
+    }
+
+    return true;
+}
+
+// Pack an undirected edge into a single key, so that (a, b) and (b, a) are equivalent
+uint64_t getEdgeKey(int a, int b)
+{
+    const uint64_t lo = static_cast<uint32_t>(std::min(a, b));
+    const uint64_t hi = static_cast<uint32_t>(std::max(a, b));
+    return (lo << 32) | hi;
+}
+
+// Validate the subset indices in memory, following the rules of UsdGeomSubset::ValidateFamily at the default time.
+// Assigned elements are tracked in a bitset over the element indices, so overlap and coverage are checked in a single pass over the indices.
+bool validateSubsetIndices(
+    const UsdGeomMesh& mesh,
+    const std::vector<SdfPath>& subsetPaths,
+    const std::vector<VtIntArray>& indices,
+    const TfToken& elementType,
+    const TfToken& familyType,
+    std::string& reason
+)
+{
+    // Edges are identified by their position in the set of unique mesh edges
+    std::unordered_map<uint64_t, size_t> edgeIds;
+    size_t elementCount = 0;
+    if (elementType == UsdGeomTokens->face)
+    {
+        VtIntArray faceVertexCounts;
+        mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+        elementCount = faceVertexCounts.size();
+    }
+    else if (elementType == UsdGeomTokens->point)
+    {
+        VtVec3fArray points;
+        mesh.GetPointsAttr().Get(&points);
+        elementCount = points.size();
+    }
+    else
+    {
+        VtIntArray faceVertexCounts;
+        VtIntArray faceVertexIndices;
+        mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+        mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices);
+        size_t offset = 0;
+        for (const int count : faceVertexCounts)
+        {
+            if (count <= 0 || offset + count > faceVertexIndices.size())
+            {
+                break;
+            }
+            for (int i = 0; i < count; ++i)
+            {
+                const uint64_t key = ::getEdgeKey(faceVertexIndices[offset + i], faceVertexIndices[offset + (i + 1) % count]);
+                edgeIds.emplace(key, edgeIds.size());
+            }
+            offset += count;
+        }
+        elementCount = edgeIds.size();
+    }
+
+    const bool checkOverlap = familyType != UsdGeomTokens->unrestricted;
+    std::vector<bool> assigned(elementCount, false);
+    size_t assignedCount = 0;
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        const VtIntArray& subsetIndices = indices[i];
+        const char* subsetPath = subsetPaths[i].GetText();
+
+        if (elementType == UsdGeomTokens->edge)
+        {
+            if (subsetIndices.size() % 2 != 0)
+            {
+                reason = TfStringPrintf("Found an odd number of edge indices in GeomSubset at path <%s> at time DEFAULT.", subsetPath);
+                return false;
+            }
+
+            for (size_t j = 0; j < subsetIndices.size(); j += 2)
+            {
+                const int a = std::min(subsetIndices[j], subsetIndices[j + 1]);
+                const int b = std::max(subsetIndices[j], subsetIndices[j + 1]);
+                if (a < 0)
+                {
+                    reason = "Found one or more indices that are less than 0 at time DEFAULT.";
+                    return false;
+                }
+
+                const auto it = edgeIds.find(::getEdgeKey(a, b));
+                if (it == edgeIds.end())
+                {
+                    reason = TfStringPrintf(
+                        "Found edge (%d, %d) in GeomSubset at path <%s> that is not an edge of the mesh at time DEFAULT.",
+                        a,
+                        b,
+                        subsetPath
+                    );
+                    return false;
+                }
+
+                if (checkOverlap)
+                {
+                    if (assigned[it->second])
+                    {
+                        reason = TfStringPrintf("Found duplicate edge (%d, %d) in GeomSubset at path <%s> at time DEFAULT.", a, b, subsetPath);
+                        return false;
+                    }
+                    assigned[it->second] = true;
+                    ++assignedCount;
+                }
+            }
+            continue;
+        }
+
+        for (const int index : subsetIndices)
+        {
+            if (index < 0)
+            {
+                reason = "Found one or more indices that are less than 0 at time DEFAULT.";
+                return false;
+            }
+            if (static_cast<size_t>(index) >= elementCount)
+            {
+                reason = TfStringPrintf("Found one or more indices that are greater than the element count %zu at time DEFAULT.", elementCount);
+                return false;
+            }
+
+            if (checkOverlap)
+            {
+                if (assigned[index])
+                {
+                    reason = TfStringPrintf("Found duplicate index %d in GeomSubset at path <%s> at time DEFAULT.", index, subsetPath);
+                    return false;
+                }
+                assigned[index] = true;
+                ++assignedCount;
+            }
+        }
+    }
+
+    if (familyType == UsdGeomTokens->partition && assignedCount != elementCount)
+    {
+        reason = TfStringPrintf("Number of unique indices at time DEFAULT does not match the element count %zu.", elementCount);
+        return false;
+    }
+
+    return true;
+}
+
+// Author the subsets directly in the edit target layer, so that change processing occurs once for the entire family
+std::vector<UsdGeomSubset> authorGeomSubsets(
+    UsdGeomMesh mesh,
+    const std::vector<SdfPath>& subsetPaths,
+    const std::vector<VtIntArray>& indices,
+    const TfToken& elementType,
+    const TfToken& familyName,
+    const TfToken& familyType,
+    std::string& reason
+)
+{
+    static const TfToken s_subsetTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomSubset>();
+
+    UsdStageWeakPtr stage = mesh.GetPrim().GetStage();
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    {
+        SdfChangeBlock changeBlock;
+
+        // The highest spec which does not yet exist on the layer, of the mesh or its ancestors, is removed if any subset can not be created
+        const SdfPath meshSpecPath = editTarget.MapToSpecPath(mesh.GetPath());
+        SdfPath createdRootPath;
+        for (const SdfPath& prefix : meshSpecPath.GetPrefixes())
+        {
+            if (!layer->GetPrimAtPath(prefix))
+            {
+                createdRootPath = prefix;
+                break;
+            }
+        }
+
+        // Create every subset prim spec before authoring any opinions, so that a failure leaves the layer unchanged
+        std::vector<SdfPrimSpecHandle> primSpecs;
+        std::vector<SdfPrimSpecHandle> createdSpecs;
+        primSpecs.reserve(subsetPaths.size());
+        for (const SdfPath& subsetPath : subsetPaths)
+        {
+            const SdfPath specPath = editTarget.MapToSpecPath(subsetPath);
+            const bool existed = bool(layer->GetPrimAtPath(specPath));
+            SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(layer, specPath);
+            if (!primSpec)
+            {
+                if (SdfPrimSpecHandle createdRoot = createdRootPath.IsEmpty() ? SdfPrimSpecHandle() : layer->GetPrimAtPath(createdRootPath))
+                {
+                    createdRoot->GetRealNameParent()->RemoveNameChild(createdRoot);
+                }
+                else
+                {
+                    for (auto it = createdSpecs.rbegin(); it != createdSpecs.rend(); ++it)
+                    {
+                        (*it)->GetRealNameParent()->RemoveNameChild(*it);
+                    }
+                }
+                reason = TfStringPrintf("Unable to define subsets due to invalid subset location \"%s\"", subsetPath.GetAsString().c_str());
+                return {};
+            }
+            primSpecs.push_back(primSpec);
+            if (!existed)
+            {
+                createdSpecs.push_back(primSpec);
+            }
+        }
+
+        // Allows empty familyName values, in which case no family type is authored
+        if (!familyName.IsEmpty())
+        {
+            if (SdfPrimSpecHandle meshSpec = SdfCreatePrimInLayer(layer, meshSpecPath))
+            {
+                const TfToken familyTypeName(TfStringPrintf("subsetFamily:%s:familyType", familyName.GetText()));
+                ::setAttributeSpec(meshSpec, familyTypeName, SdfValueTypeNames->Token, SdfVariabilityUniform, VtValue(familyType));
+            }
+        }
+
+        for (size_t i = 0; i < primSpecs.size(); ++i)
+        {
+            const SdfPrimSpecHandle& primSpec = primSpecs[i];
+            primSpec->SetSpecifier(SdfSpecifierDef);
+            primSpec->SetTypeName(s_subsetTypeName);
+            ::setAttributeSpec(primSpec, UsdGeomTokens->indices, SdfValueTypeNames->IntArray, SdfVariabilityVarying, VtValue(indices[i]));
+            ::setAttributeSpec(primSpec, UsdGeomTokens->elementType, SdfValueTypeNames->Token, SdfVariabilityUniform, VtValue(elementType));
+            ::setAttributeSpec(primSpec, UsdGeomTokens->familyName, SdfValueTypeNames->Token, SdfVariabilityUniform, VtValue(familyName));
+        }
+    }
+
+    // The stage has recomposed once the change block has closed, so the schemas can now be constructed
+    std::vector<UsdGeomSubset> subsets;
+    subsets.reserve(subsetPaths.size());
+    for (const SdfPath& subsetPath : subsetPaths)
+    {
+        UsdGeomSubset subset(stage->GetPrimAtPath(subsetPath));
+        if (!subset)
+        {
+            reason = TfStringPrintf("Unable to define subsets due to invalid subset");
+            return {};
+        }
+        subsets.push_back(subset);
+    }
+
+    return subsets;
+}
+
+// Define multiple subsets of a mesh
+std::vector<UsdGeomSubset> defineGeomSubsets(
+    UsdGeomMesh mesh,
+    const std::vector<TfToken>& names,
+    const std::vector<pxr::VtIntArray>& indices,
+    const TfToken& elementType,
+    const TfToken& familyName,
+    const TfToken& familyType,
+    std::string& reason
+)
+{
+    std::vector<UsdGeomSubset> subsets;
+
+    // Early out if the prim is invalid
+    if (!mesh)
+    {
+        reason = TfStringPrintf("Subsets cannot be defined due to an invalid prim");
+        return subsets;
+    }
+
+    // Early out if the family name is invalid.
+    if (!familyName.IsEmpty() && !SdfPath::IsValidNamespacedIdentifier(familyName.GetString()))
+    {
+        reason = TfStringPrintf("Unable to define subsets due to invalid family name: \"%s\" is not a valid USD identifier", familyName.GetText());
+        return subsets;
+    }
+
+    // Early out if the element type is invalid
+    else if (elementType != UsdGeomTokens->face && elementType != UsdGeomTokens->edge && elementType != UsdGeomTokens->point)
+    {
+        reason = TfStringPrintf("Unable to define subsets due to invalid element type for Mesh subsets: %s", elementType.GetText());
+        return subsets;
+    }
+
+    // Early out if the names or indices are empty
+    if (names.empty() || indices.empty())
+    {
+        reason = TfStringPrintf("Unable to define subsets due to invalid names or indices");
+        return subsets;
+    }
+
+    // Early out if the names are invalid
+    std::unordered_set<TfToken, TfToken::HashFunctor> validNames;
+    validNames.reserve(names.size());
+    for (const auto& name : names)
+    {
+        if (name.IsEmpty())
+        {
+            reason = TfStringPrintf("There is an empty subset name");
+            return subsets;
+        }
+        if (!SdfPath::IsValidIdentifier(name.GetString()))
+        {
+            reason = TfStringPrintf("Unable to define subsets due to invalid subset name: \"%s\" is not a valid USD identifier", name.GetText());
+            return subsets;
+        }
+
+        // If the name is already in the validNames, return an error.
+        if (!validNames.insert(name).second)
+        {
+            reason = TfStringPrintf("Unable to define subsets due to duplicate subset name: '%s'", name.GetText());
+            return subsets;
+        }
+    }
+
+    // Early out if the names are invalid
+    if (names.size() != indices.size())
+    {
+        reason = TfStringPrintf("Length of names must equal length of indices. names %zu, indices %zu", names.size(), indices.size());
+        return subsets;
+    }
+
+    // Early out if the indices are empty
+    for (const auto& index : indices)
+    {
+        if (index.empty())
+        {
+            reason = TfStringPrintf("Unable to define subsets due to empty subset indices");
+            return subsets;
+        }
+    }
+
+    // Early out if the proposed prim location is invalid
+    UsdStageWeakPtr stage = mesh.GetPrim().GetStage();
+    const SdfPath path = mesh.GetPath();
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        reason = TfStringPrintf("Unable to define subsets due to invalid prim location: %s", reason.c_str());
+        return subsets;
+    }
+
+    // When subsets already exist within the given prim
     // if the same family name exists, return an error.
     const std::vector<UsdGeomSubset> existingSubsets = UsdGeomSubset::GetAllGeomSubsets(mesh);
     if (!existingSubsets.empty())
@@ -456,43 +1174,1146 @@ std::vector<UsdGeomSubset> defineGeomSubsets(
         }
     }
 
-    for (size_t i = 0; i < names.size(); ++i)
+    std::vector<SdfPath> subsetPaths;
+    subsetPaths.reserve(names.size());
+    for (const TfToken& name : names)
+    {
+        subsetPaths.push_back(path.AppendChild(name));
+    }
+
+    // Validate the entire family before anything is authored. Without a family name no family type is authored, so the family is
+    // unrestricted, as it would be for UsdGeomSubset::ValidateFamily.
+    const TfToken& validationFamilyType = familyName.IsEmpty() ? UsdGeomTokens->unrestricted : familyType;
+    if (!::validateSubsetIndices(mesh, subsetPaths, indices, elementType, validationFamilyType, reason))
+    {
+        return subsets;
+    }
+
+    return ::authorGeomSubsets(mesh, subsetPaths, indices, elementType, familyName, familyType, reason);
+}
+
+// Gather the face indices of each id with a counting sort, skipping ids that are not referenced by any face
+bool bucketFaceIds(
+    UsdGeomMesh mesh,
+    const VtIntArray& faceIds,
+    const std::vector<TfToken>& names,
+    const std::vector<UsdShadeMaterial>& materials,
+    std::vector<TfToken>* subsetNames,
+    std::vector<VtIntArray>* subsetIndices,
+    std::vector<UsdShadeMaterial>* subsetMaterials,
+    std::string& reason
+)
+{
+    if (!mesh)
+    {
+        reason = TfStringPrintf("Subsets cannot be defined due to an invalid prim");
+        return false;
+    }
+
+    if (names.empty())
+    {
+        reason = TfStringPrintf("Unable to define subsets due to invalid names or indices");
+        return false;
+    }
+
+    if (!materials.empty() && materials.size() != names.size())
+    {
+        reason = TfStringPrintf("Length of materials must equal length of names. names %zu, materials %zu", names.size(), materials.size());
+        return false;
+    }
+
+    VtIntArray faceVertexCounts;
+    mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+    if (faceIds.size() != faceVertexCounts.size())
+    {
+        reason = TfStringPrintf(
+            "Unable to define subsets due to invalid face ids: Expected %zu values but found %zu",
+            faceVertexCounts.size(),
+            faceIds.size()
+        );
+        return false;
+    }
+
+    // Count the faces of each id
+    const int numIds = static_cast<int>(names.size());
+    std::vector<size_t> counts(names.size(), 0);
+    for (size_t face = 0; face < faceIds.size(); ++face)
+    {
+        const int id = faceIds[face];
+        if (id < 0 || id >= numIds)
+        {
+            reason = TfStringPrintf("Unable to define subsets due to invalid face id %d at face %zu: Expected a value in [0, %d)", id, face, numIds);
+            return false;
+        }
+        ++counts[id];
+    }
+
+    // Allocate the indices of each referenced id, mapping each id to its subset
+    std::vector<int> subsetOfId(names.size(), -1);
+    for (size_t id = 0; id < names.size(); ++id)
+    {
+        if (counts[id] == 0)
+        {
+            continue;
+        }
+
+        subsetOfId[id] = static_cast<int>(subsetNames->size());
+        subsetNames->push_back(names[id]);
+        subsetIndices->push_back(VtIntArray(counts[id]));
+        if (!materials.empty())
+        {
+            subsetMaterials->push_back(materials[id]);
+        }
+    }
+
+    // Scatter the faces into their subsets. Faces are visited in ascending order, so the indices of each subset are sorted.
+    std::vector<int*> cursors(subsetIndices->size());
+    for (size_t i = 0; i < subsetIndices->size(); ++i)
+    {
+        cursors[i] = (*subsetIndices)[i].data();
+    }
+    for (size_t face = 0; face < faceIds.size(); ++face)
+    {
+        *(cursors[subsetOfId[faceIds[face]]]++) = static_cast<int>(face);
+    }
+
+    return true;
+}
+
+// Author the attributes and primvars of a mesh which has already been validated
+UsdGeomMesh authorPolyMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const std::optional<const Vec2fPrimvarData>& uvs,
+    const std::optional<const Vec3fPrimvarData>& displayColor,
+    const std::optional<const FloatPrimvarData>& displayOpacity
+)
+{
+    // Define the Mesh and check that this was successful
+    UsdGeomMesh mesh = UsdGeomMesh::Define(stage, path);
+    if (!mesh)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+        return UsdGeomMesh();
+    }
+
+    // Explicitly author the specifier and type name
+    UsdPrim prim = mesh.GetPrim();
+    prim.SetSpecifier(SdfSpecifierDef);
+    prim.SetTypeName(prim.GetTypeName());
+
+    // Author opinions on Mesh attributes
+    detail::setAttributeValue(mesh.CreateOrientationAttr(), UsdGeomTokens->rightHanded);
+    detail::setAttributeValue(mesh.CreateSubdivisionSchemeAttr(), UsdGeomTokens->none);
+
+    // Create and set required topology attributes
+    UsdAttribute faceVertexCountsAttr = mesh.CreateFaceVertexCountsAttr();
+    UsdAttribute faceVertexIndicesAttr = mesh.CreateFaceVertexIndicesAttr();
+    UsdAttribute pointsAttr = mesh.CreatePointsAttr();
+    detail::setAttributeValue(faceVertexCountsAttr, faceVertexCounts);
+    detail::setAttributeValue(faceVertexIndicesAttr, faceVertexIndices);
+    detail::setAttributeValue(pointsAttr, points);
+    detail::verifySharedArray(faceVertexCountsAttr, faceVertexCounts);
+    detail::verifySharedArray(faceVertexIndicesAttr, faceVertexIndices);
+    detail::verifySharedArray(pointsAttr, points);
+
+    // Compute an extent from the points so there is a guarantee that the extent will be correct and authored in all cases.
+    detail::setAttributeValue(mesh.CreateExtentAttr(), computePointsExtent(points));
+
+    // Optionally author normals
+    if (normals.has_value())
+    {
+        // Define the normals primvar
+        const TfToken& name = UsdGeomTokens->normals;
+        const SdfValueTypeName& typeName = SdfValueTypeNames->Normal3fArray;
+        UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(name, typeName);
+        if (!detail::setPrimvarData(primvar, normals.value()))
+        {
+            TF_WARN("Failed to set normals primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+        }
+        detail::verifySharedPrimvar(primvar, normals.value());
+    }
+
+    // Optionally author the primary UV set
+    if (uvs.has_value())
+    {
+        const TfToken& name = UsdUtilsGetPrimaryUVSetName();
+        const SdfValueTypeName& typeName = SdfValueTypeNames->TexCoord2fArray;
+        UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(name, typeName);
+        if (!detail::setPrimvarData(primvar, uvs.value()))
+        {
+            TF_WARN("Failed to set uvs primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+        }
+        detail::verifySharedPrimvar(primvar, uvs.value());
+    }
+
+    // Optionally author display color
+    if (displayColor.has_value())
+    {
+        UsdGeomPrimvar primvar = mesh.CreateDisplayColorPrimvar();
+        if (!detail::setPrimvarData(primvar, displayColor.value()))
+        {
+            TF_WARN("Failed to set display color primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+        }
+        detail::verifySharedPrimvar(primvar, displayColor.value());
+    }
+
+    // Optionally author display opacity
+    if (displayOpacity.has_value())
+    {
+        UsdGeomPrimvar primvar = mesh.CreateDisplayOpacityPrimvar();
+        if (!detail::setPrimvarData(primvar, displayOpacity.value()))
+        {
+            TF_WARN("Failed to set display opacity primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+        }
+        detail::verifySharedPrimvar(primvar, displayOpacity.value());
+    }
+
+    return mesh;
+}
+
+// Warn if normals cannot be computed for the interpolation
+bool validateNormalsInterpolation(const TfToken& interpolation)
+{
+    if (interpolation != UsdGeomTokens->uniform && interpolation != UsdGeomTokens->vertex && interpolation != UsdGeomTokens->faceVarying)
+    {
+        TF_WARN(
+            "Unable to compute normals due to unsupported interpolation '%s'. Only 'uniform', 'vertex', and 'faceVarying' are supported.",
+            interpolation.GetText()
+        );
+        return false;
+    }
+    return true;
+}
+
+// Compute normals for points and topology which have already been validated
+Vec3fPrimvarData computeValidatedMeshNormals(
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const size_t* faceOffsets,
+    const VtVec3fArray& points,
+    const TfToken& interpolation,
+    const GfVec3f& fallback,
+    float smoothingAngle
+)
+{
+    std::string reason;
+
+    // Normalize the fallback vector to ensure it's a valid normal
+    GfVec3f defaultNormal = fallback.GetNormalized();
+
+    if (interpolation == UsdGeomTokens->uniform)
+    {
+        if (faceVertexCounts.empty())
+        {
+            return getInvalidPrimvar();
+        }
+        VtVec3fArray faceNormals(faceVertexCounts.size());
+        computeFaceNormals(faceVertexCounts, faceVertexIndices, faceOffsets, points, defaultNormal, faceNormals.data(), &reason);
+        if (!reason.empty())
+        {
+            TF_WARN("%s", reason.c_str());
+        }
+        return getIndexedPrimvar(std::move(faceNormals), UsdGeomTokens->uniform);
+    }
+    else if (interpolation == UsdGeomTokens->vertex)
+    {
+        auto vertexNormals = computeVertexNormals(faceVertexCounts, faceVertexIndices, faceOffsets, points, defaultNormal, &reason);
+        if (!reason.empty())
+        {
+            TF_WARN("%s", reason.c_str());
+        }
+        if (vertexNormals.empty())
+        {
+            return getInvalidPrimvar();
+        }
+        return getIndexedPrimvar(std::move(vertexNormals), UsdGeomTokens->vertex);
+    }
+    else if (interpolation == UsdGeomTokens->faceVarying)
+    {
+        // The corner normals are indexed as they are computed
+        Vec3fPrimvarData cornerNormals =
+            computeFaceVaryingNormals(faceVertexCounts, faceVertexIndices, faceOffsets, points, defaultNormal, smoothingAngle, &reason);
+        if (!reason.empty())
+        {
+            TF_WARN("%s", reason.c_str());
+        }
+        return cornerNormals;
+    }
+
+    return getInvalidPrimvar();
+}
+
+// Index a copy of the primvar according to the indexing options. Primvars which cannot be indexed are returned as supplied, so that they are
+// reported by the usual validation rather than by the indexing.
+template <typename T>
+std::optional<const PrimvarData<T>> indexPrimvar(const std::optional<const PrimvarData<T>>& primvar, const PolyMeshIndexing& indexing)
+{
+    if (!primvar.has_value() || primvar->elementSize() > 1 || !primvar->isValid())
+    {
+        return primvar;
+    }
+
+    PrimvarData<T> result = primvar.value();
+    // Invalid options are forwarded, so that they are reported by the indexing functions
+    if (indexing.tolerance != 0.0f)
+    {
+        result.index(indexing.tolerance);
+    }
+    else if (indexing.precision != 0)
+    {
+        result.indexWithPrecision(indexing.precision);
+    }
+    else
+    {
+        result.index();
+    }
+    return std::optional<const PrimvarData<T>>(std::move(result));
+}
+
+// The ranges of each mesh of a MeshBatch within its concatenated arrays
+struct MeshBatchRanges
+{
+    std::vector<size_t> points;
+    std::vector<size_t> faces;
+    std::vector<size_t> faceVertices;
+};
+
+// Read the offsets of a MeshBatch, returning false if they do not describe consecutive ranges of an array of the given size
+bool getBatchOffsets(const VtIntArray& offsets, size_t meshCount, size_t size, std::vector<size_t>& result)
+{
+    if (offsets.size() != meshCount + 1 || offsets[0] != 0 || static_cast<size_t>(offsets[meshCount]) != size)
+    {
+        return false;
+    }
+
+    result.resize(offsets.size());
+    for (size_t i = 0; i < offsets.size(); ++i)
+    {
+        if (i > 0 && offsets[i] < offsets[i - 1])
+        {
+            return false;
+        }
+        result[i] = static_cast<size_t>(offsets[i]);
+    }
+    return true;
+}
+
+// The element ranges of each mesh for a primvar of the given interpolation, or null if the interpolation is not valid
+const std::vector<size_t>* getBatchPrimvarRanges(
+    const MeshBatchRanges& ranges,
+    const std::vector<size_t>& constantRanges,
+    const TfToken& interpolation
+)
+{
+    if (interpolation == UsdGeomTokens->constant)
+    {
+        return &constantRanges;
+    }
+    else if (interpolation == UsdGeomTokens->uniform)
+    {
+        return &ranges.faces;
+    }
+    else if (interpolation == UsdGeomTokens->vertex || interpolation == UsdGeomTokens->varying)
+    {
+        return &ranges.points;
+    }
+    else if (interpolation == UsdGeomTokens->faceVarying)
+    {
+        return &ranges.faceVertices;
+    }
+    return nullptr;
+}
+
+// Check that a primvar of a MeshBatch is valid and holds the elements of every mesh
+template <typename T>
+bool isValidBatchPrimvar(const std::optional<PrimvarData<T>>& primvar, const MeshBatchRanges& ranges, const std::vector<size_t>& constantRanges)
+{
+    if (!primvar.has_value())
+    {
+        return true;
+    }
+
+    const std::vector<size_t>* elementRanges = ::getBatchPrimvarRanges(ranges, constantRanges, primvar->interpolation());
+    if (!elementRanges || !primvar->isValid())
+    {
+        return false;
+    }
+    const size_t stride = static_cast<size_t>(std::max(primvar->elementSize(), 1));
+    return elementRanges->back() * stride == (primvar->hasIndices() ? primvar->indices().size() : primvar->values().size());
+}
+
+template <typename T>
+VtArray<T> sliceBatchArray(const VtArray<T>& array, size_t begin, size_t end)
+{
+    return VtArray<T>(array.cbegin() + begin, array.cbegin() + end);
+}
+
+// Slice the elements of a single mesh from a primvar of a MeshBatch, compacting the values referenced by the indices of an indexed primvar
+template <typename T>
+std::optional<PrimvarData<T>> sliceBatchPrimvar(
+    const std::optional<PrimvarData<T>>& primvar,
+    const MeshBatchRanges& ranges,
+    const std::vector<size_t>& constantRanges,
+    size_t mesh
+)
+{
+    if (!primvar.has_value())
+    {
+        return std::nullopt;
+    }
+
+    const std::vector<size_t>& elementRanges = *::getBatchPrimvarRanges(ranges, constantRanges, primvar->interpolation());
+    const size_t stride = static_cast<size_t>(std::max(primvar->elementSize(), 1));
+    const size_t begin = elementRanges[mesh] * stride;
+    const size_t end = elementRanges[mesh + 1] * stride;
+    if (!primvar->hasIndices())
+    {
+        return PrimvarData<T>(primvar->interpolation(), ::sliceBatchArray(primvar->values(), begin, end), primvar->elementSize());
+    }
+
+    const VtIntArray& indices = primvar->indices();
+    const VtArray<T>& values = primvar->values();
+    VtArray<T> meshValues;
+    VtIntArray meshIndices(end - begin);
+    std::unordered_map<int, int> remap;
+    for (size_t i = begin; i < end; ++i)
+    {
+        auto insertIt = remap.emplace(indices[i], static_cast<int>(meshValues.size()));
+        if (insertIt.second)
+        {
+            meshValues.push_back(values[indices[i]]);
+        }
+        meshIndices[i - begin] = insertIt.first->second;
+    }
+    return PrimvarData<T>(primvar->interpolation(), std::move(meshValues), std::move(meshIndices), primvar->elementSize());
+}
+
+// Large meshes are split into chunks in parallel in batches of this many faces
+static constexpr size_t s_meshChunkGrainSize = 1 << 14;
+
+// The faces, points, and face vertices of a mesh which are held by a single chunk of that mesh, in the order of the chunk
+struct MeshChunk
+{
+    std::vector<size_t> faces;
+    std::vector<size_t> points;
+    std::vector<size_t> faceVertices;
+};
+
+// Spread the lower 10 bits of a value such that there are two zero bits between each bit, to interleave three values into a Morton code
+uint32_t expandMortonBits(uint32_t value)
+{
+    value &= 0x3ff;
+    value = (value | (value << 16)) & 0x030000ff;
+    value = (value | (value << 8)) & 0x0300f00f;
+    value = (value | (value << 4)) & 0x030c30c3;
+    value = (value | (value << 2)) & 0x09249249;
+    return value;
+}
+
+// Order the faces of a mesh along a Morton curve through their centroids, so that consecutive faces are spatially coherent.
+// Faces with the same Morton code retain their original relative order, so the result is deterministic.
+std::vector<size_t> computeMortonFaceOrder(
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const std::vector<size_t>& faceOffsets,
+    const VtVec3fArray& points
+)
+{
+    GfRange3f range;
+    for (const GfVec3f& point : points)
+    {
+        range.UnionWith(point);
+    }
+
+    // Each axis of the bounds is quantized to 10 bits, degenerate (or non-finite) axes do not contribute to the code
+    const GfVec3f size = range.GetSize();
+    GfVec3f scale(0.0f);
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        if (std::isfinite(size[axis]) && size[axis] > 0.0f)
+        {
+            scale[axis] = 1023.0f / size[axis];
+        }
+    }
+
+    const size_t faceCount = faceVertexCounts.size();
+    std::vector<uint64_t> keys(faceCount);
+    WorkParallelForN(
+        faceCount,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t face = begin; face < end; ++face)
+            {
+                GfVec3f centroid(0.0f);
+                const int vertexCount = faceVertexCounts[face];
+                for (int i = 0; i < vertexCount; ++i)
+                {
+                    centroid += points[faceVertexIndices[faceOffsets[face] + i]];
+                }
+                if (vertexCount > 0)
+                {
+                    centroid /= static_cast<float>(vertexCount);
+                }
+
+                uint32_t code = 0;
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    const float cell = (centroid[axis] - range.GetMin()[axis]) * scale[axis];
+                    code |= ::expandMortonBits((cell > 0.0f) ? static_cast<uint32_t>(std::min(cell, 1023.0f)) : 0) << axis;
+                }
+                keys[face] = (static_cast<uint64_t>(code) << 32) | static_cast<uint64_t>(face);
+            }
+        },
+        s_meshChunkGrainSize
+    );
+    WorkParallelSort(&keys);
+
+    std::vector<size_t> order(faceCount);
+    for (size_t i = 0; i < faceCount; ++i)
+    {
+        order[i] = static_cast<size_t>(keys[i] & 0xffffffff);
+    }
+    return order;
+}
+
+// Collect the faces, points, and face vertices of a chunk from a run of faces, retaining the original relative order of each
+MeshChunk buildMeshChunk(
+    const size_t* faces,
+    size_t count,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const std::vector<size_t>& faceOffsets
+)
+{
+    MeshChunk chunk;
+    chunk.faces.assign(faces, faces + count);
+    std::sort(chunk.faces.begin(), chunk.faces.end());
+    for (const size_t face : chunk.faces)
+    {
+        for (int i = 0; i < faceVertexCounts[face]; ++i)
+        {
+            chunk.faceVertices.push_back(faceOffsets[face] + i);
+            chunk.points.push_back(static_cast<size_t>(faceVertexIndices[faceOffsets[face] + i]));
+        }
+    }
+    std::sort(chunk.points.begin(), chunk.points.end());
+    chunk.points.erase(std::unique(chunk.points.begin(), chunk.points.end()), chunk.points.end());
+    return chunk;
+}
+
+// Gather the elements of a single chunk from a primvar of the entire mesh, compacting the values referenced by the indices of an indexed primvar
+template <typename T>
+std::optional<PrimvarData<T>> gatherChunkPrimvar(const std::optional<const PrimvarData<T>>& primvar, const MeshChunk& chunk)
+{
+    if (!primvar.has_value())
+    {
+        return std::nullopt;
+    }
+
+    const TfToken& interpolation = primvar->interpolation();
+    if (interpolation == UsdGeomTokens->constant)
+    {
+        return PrimvarData<T>(primvar.value());
+    }
+
+    const std::vector<size_t>& elements = (interpolation == UsdGeomTokens->uniform)       ? chunk.faces
+                                          : (interpolation == UsdGeomTokens->faceVarying) ? chunk.faceVertices
+                                                                                          : chunk.points;
+    const size_t stride = static_cast<size_t>(std::max(primvar->elementSize(), 1));
+    if (!primvar->hasIndices())
+    {
+        const VtArray<T>& values = primvar->values();
+        VtArray<T> chunkValues(elements.size() * stride);
+        for (size_t i = 0; i < elements.size(); ++i)
+        {
+            std::copy_n(values.cdata() + elements[i] * stride, stride, chunkValues.data() + i * stride);
+        }
+        return PrimvarData<T>(interpolation, std::move(chunkValues), primvar->elementSize());
+    }
+
+    const VtIntArray& indices = primvar->indices();
+    const VtArray<T>& values = primvar->values();
+    VtArray<T> chunkValues;
+    VtIntArray chunkIndices(elements.size() * stride);
+    std::unordered_map<int, int> remap;
+    for (size_t i = 0; i < elements.size(); ++i)
+    {
+        for (size_t j = 0; j < stride; ++j)
+        {
+            const int index = indices[elements[i] * stride + j];
+            auto insertIt = remap.emplace(index, static_cast<int>(chunkValues.size()));
+            if (insertIt.second)
+            {
+                chunkValues.push_back(values[index]);
+            }
+            chunkIndices[i * stride + j] = insertIt.first->second;
+        }
+    }
+    return PrimvarData<T>(interpolation, std::move(chunkValues), std::move(chunkIndices), primvar->elementSize());
+}
+
+// Verify that subsets fully partition the faces of a mesh, as expected by `definePartitionedSubsets`
+bool validateSubsetPartition(
+    size_t faceCount,
+    const std::vector<TfToken>& subsetNames,
+    const std::vector<VtIntArray>& subsetIndices,
+    std::string* reason
+)
+{
+    if (subsetNames.size() != subsetIndices.size())
+    {
+        *reason = TfStringPrintf("mismatched subset names (%zu) and indices (%zu)", subsetNames.size(), subsetIndices.size());
+        return false;
+    }
+    if (subsetIndices.empty())
+    {
+        return true;
+    }
+
+    std::vector<char> assigned(faceCount, 0);
+    size_t assignedCount = 0;
+    for (const VtIntArray& indices : subsetIndices)
+    {
+        for (const int face : indices)
+        {
+            if (face < 0 || static_cast<size_t>(face) >= faceCount || assigned[face])
+            {
+                assignedCount = faceCount + 1;
+                break;
+            }
+            assigned[face] = 1;
+            ++assignedCount;
+        }
+    }
+    if (assignedCount != faceCount)
+    {
+        *reason = TfStringPrintf("subsets which do not partition the %zu faces", faceCount);
+        return false;
+    }
+    return true;
+}
+
+// The faces of a mesh are ordered for the vertex cache in parallel, in runs of this many consecutive faces along the Morton curve
+static constexpr size_t s_vertexCacheGrainSize = 1 << 14;
+
+// The scoring of Forsyth's "Linear-Speed Vertex Cache Optimisation", generalized from triangles to polygons
+static constexpr float s_cacheDecayPower = 1.5f;
+static constexpr float s_lastFaceScore = 0.75f;
+static constexpr float s_valenceBoostScale = 2.0f;
+static constexpr float s_valenceBoostPower = 0.5f;
+
+// The score of a vertex, which favors vertices that are recently used (i.e. likely to be in the cache) and those with few remaining faces
+float computeVertexCacheScore(int cachePosition, size_t lastFaceSize, size_t cacheSize, uint32_t remainingFaces)
+{
+    if (remainingFaces == 0)
+    {
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0)
+    {
+        const size_t position = static_cast<size_t>(cachePosition);
+        if (position < lastFaceSize)
+        {
+            // The vertices of the last face are scored equally, as they are all equally likely to be in the cache after the face
+            score = s_lastFaceScore;
+        }
+        else
+        {
+            const float scale = 1.0f / static_cast<float>(cacheSize - lastFaceSize);
+            score = std::pow(1.0f - static_cast<float>(position - lastFaceSize) * scale, s_cacheDecayPower);
+        }
+    }
+    return score + s_valenceBoostScale * std::pow(static_cast<float>(remainingFaces), -s_valenceBoostPower);
+}
+
+// Order a run of faces to maximize the reuse of recently referenced points in a vertex cache of `cacheSize` entries.
+// Ties are broken by the position of the faces within the run, so the result is deterministic.
+void orderRunForVertexCache(
+    const size_t* faces,
+    size_t count,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const std::vector<size_t>& faceOffsets,
+    size_t cacheSize,
+    size_t* result
+)
+{
+    // Number the points of the run, and collect the local vertices of each face
+    std::vector<size_t> runPoints;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t offset = faceOffsets[faces[i]];
+        for (int j = 0; j < faceVertexCounts[faces[i]]; ++j)
+        {
+            runPoints.push_back(static_cast<size_t>(faceVertexIndices[offset + j]));
+        }
+    }
+    std::vector<uint32_t> localVertices(runPoints.size());
+    std::vector<size_t> localOffsets(count + 1, 0);
+    for (size_t i = 0, vertex = 0; i < count; ++i)
+    {
+        localOffsets[i + 1] = localOffsets[i] + static_cast<size_t>(faceVertexCounts[faces[i]]);
+        for (; vertex < localOffsets[i + 1]; ++vertex)
+        {
+            localVertices[vertex] = static_cast<uint32_t>(runPoints[vertex]);
+        }
+    }
+    std::sort(runPoints.begin(), runPoints.end());
+    runPoints.erase(std::unique(runPoints.begin(), runPoints.end()), runPoints.end());
+    for (uint32_t& vertex : localVertices)
+    {
+        vertex = static_cast<uint32_t>(std::lower_bound(runPoints.begin(), runPoints.end(), static_cast<size_t>(vertex)) - runPoints.begin());
+    }
+
+    // The remaining faces of each vertex, which are removed as the faces are emitted
+    const size_t vertexCount = runPoints.size();
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (const uint32_t vertex : localVertices)
+    {
+        ++remaining[vertex];
+    }
+    std::vector<size_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + remaining[vertex];
+    }
+    std::vector<uint32_t> adjacency(localVertices.size());
+    {
+        std::vector<size_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (size_t vertex = localOffsets[i]; vertex < localOffsets[i + 1]; ++vertex)
+            {
+                adjacency[fill[localVertices[vertex]]++] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+
+    std::vector<int> cachePositions(vertexCount, -1);
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        vertexScores[vertex] = ::computeVertexCacheScore(-1, 0, cacheSize, remaining[vertex]);
+    }
+    auto computeFaceScore = [&](size_t face)
+    {
+        float score = 0.0f;
+        for (size_t vertex = localOffsets[face]; vertex < localOffsets[face + 1]; ++vertex)
+        {
+            score += vertexScores[localVertices[vertex]];
+        }
+        return score;
+    };
+
+    std::vector<char> emitted(count, 0);
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> nextCache;
+    size_t nextUnemitted = 0;
+    size_t best = count;
+    for (size_t emittedCount = 0; emittedCount < count; ++emittedCount)
+    {
+        // When no face shares a vertex with the cache, restart from the next face along the Morton curve
+        if (best == count)
+        {
+            while (emitted[nextUnemitted])
+            {
+                ++nextUnemitted;
+            }
+            best = nextUnemitted;
+        }
+        const size_t face = best;
+        emitted[face] = 1;
+        result[emittedCount] = faces[face];
+
+        const uint32_t* faceBegin = localVertices.data() + localOffsets[face];
+        const uint32_t* faceEnd = localVertices.data() + localOffsets[face + 1];
+        for (const uint32_t* vertex = faceBegin; vertex != faceEnd; ++vertex)
+        {
+            uint32_t* begin = adjacency.data() + adjacencyOffsets[*vertex];
+            uint32_t* end = begin + remaining[*vertex];
+            std::swap(*std::find(begin, end, static_cast<uint32_t>(face)), *(end - 1));
+            --remaining[*vertex];
+        }
+
+        // The vertices of the face move to the front of the cache, and the least recently used vertices are evicted
+        nextCache.clear();
+        for (const uint32_t* vertex = faceBegin; vertex != faceEnd; ++vertex)
+        {
+            if (std::find(nextCache.begin(), nextCache.end(), *vertex) == nextCache.end())
+            {
+                nextCache.push_back(*vertex);
+            }
+        }
+        const size_t lastFaceSize = nextCache.size();
+        for (const uint32_t vertex : cache)
+        {
+            if (std::find(faceBegin, faceEnd, vertex) == faceEnd)
+            {
+                nextCache.push_back(vertex);
+            }
+        }
+        for (size_t i = 0; i < nextCache.size(); ++i)
+        {
+            const int position = (i < cacheSize) ? static_cast<int>(i) : -1;
+            cachePositions[nextCache[i]] = position;
+            vertexScores[nextCache[i]] = ::computeVertexCacheScore(position, std::min(lastFaceSize, cacheSize), cacheSize, remaining[nextCache[i]]);
+        }
+
+        // Only the faces of the updated vertices change their score, so the next face is the best of those
+        best = count;
+        float bestScore = -std::numeric_limits<float>::max();
+        for (const uint32_t vertex : nextCache)
+        {
+            const uint32_t* begin = adjacency.data() + adjacencyOffsets[vertex];
+            for (const uint32_t* other = begin; other != begin + remaining[vertex]; ++other)
+            {
+                const float score = computeFaceScore(*other);
+                if (score > bestScore || (score == bestScore && *other < best))
+                {
+                    best = *other;
+                    bestScore = score;
+                }
+            }
+        }
+
+        if (nextCache.size() > cacheSize)
+        {
+            nextCache.resize(cacheSize);
+        }
+        std::swap(cache, nextCache);
+    }
+}
+
+// Order the faces of a mesh for the vertex cache and its points by their first reference, as a single chunk holding the entire mesh.
+// Points which are not referenced by any face follow those which are, in their original order.
+MeshChunk computeVertexCacheOrder(
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const std::vector<size_t>& faceOffsets,
+    const VtVec3fArray& points,
+    size_t cacheSize
+)
+{
+    // Each run of the Morton curve is spatially coherent, so the runs are ordered independently without losing much reuse between them
+    const std::vector<size_t> mortonOrder = ::computeMortonFaceOrder(faceVertexCounts, faceVertexIndices, faceOffsets, points);
+    const size_t faceCount = faceVertexCounts.size();
+    MeshChunk result;
+    result.faces.resize(faceCount);
+    WorkParallelForN(
+        (faceCount + s_vertexCacheGrainSize - 1) / s_vertexCacheGrainSize,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t run = begin; run < end; ++run)
+            {
+                const size_t first = run * s_vertexCacheGrainSize;
+                const size_t count = std::min(s_vertexCacheGrainSize, faceCount - first);
+                ::orderRunForVertexCache(
+                    mortonOrder.data() + first,
+                    count,
+                    faceVertexCounts,
+                    faceVertexIndices,
+                    faceOffsets,
+                    cacheSize,
+                    result.faces.data() + first
+                );
+            }
+        },
+        1
+    );
+
+    std::vector<char> referenced(points.size(), 0);
+    result.points.reserve(points.size());
+    result.faceVertices.reserve(faceVertexIndices.size());
+    for (const size_t face : result.faces)
+    {
+        for (int i = 0; i < faceVertexCounts[face]; ++i)
+        {
+            const size_t faceVertex = faceOffsets[face] + static_cast<size_t>(i);
+            const size_t point = static_cast<size_t>(faceVertexIndices[faceVertex]);
+            result.faceVertices.push_back(faceVertex);
+            if (!referenced[point])
+            {
+                referenced[point] = 1;
+                result.points.push_back(point);
+            }
+        }
+    }
+    for (size_t point = 0; point < points.size(); ++point)
+    {
+        if (!referenced[point])
+        {
+            result.points.push_back(point);
+        }
+    }
+    return result;
+}
+
+// The name of the variant set holding the levels of detail authored by definePolyMeshLods
+static constexpr const char* s_lodVariantSetName = "lod";
+
+// Compute the normals of a decimated level of detail, matching the interpolation of the source normals
+std::optional<Vec3fPrimvarData> computeLodNormals(
+    const std::optional<const Vec3fPrimvarData>& normals,
+    const usdex::core::detail::DecimatedMesh& level,
+    float smoothingAngle
+)
+{
+    if (!normals.has_value())
+    {
+        return std::nullopt;
+    }
+
+    const TfToken& interpolation = normals->interpolation();
+    if (interpolation == UsdGeomTokens->constant)
+    {
+        return normals.value();
+    }
+    return usdex::core::computeMeshNormals(
+        level.faceVertexCounts,
+        level.faceVertexIndices,
+        level.points,
+        (interpolation == UsdGeomTokens->varying) ? UsdGeomTokens->vertex : interpolation,
+        GfVec3f(0.0f, 0.0f, 1.0f),
+        smoothingAngle
+    );
+}
+
+} // namespace
+
+class usdex::core::MeshTopology::MeshTopologyImpl
+{
+
+public:
+
+    MeshTopologyImpl(const VtIntArray& faceVertexCounts, const VtIntArray& faceVertexIndices)
+        : faceVertexCounts(faceVertexCounts), faceVertexIndices(faceVertexIndices), maxIndex(-1), valid(false)
+    {
+        if (!faceVertexIndices.empty())
+        {
+            maxIndex = *std::max_element(faceVertexIndices.cbegin(), faceVertexIndices.cend());
+        }
+
+        // Validate against the fewest points that the indices could refer to, so that any larger array of points is also valid
+        std::string reason;
+        const size_t minPoints = maxIndex < 0 ? 0 : static_cast<size_t>(maxIndex) + 1;
+        if (!UsdGeomMesh::ValidateTopology(faceVertexIndices, faceVertexCounts, minPoints, &reason))
+        {
+            TF_RUNTIME_ERROR("Unable to create MeshTopology due to invalid topology: %s", reason.c_str());
+            return;
+        }
+
+        faceOffsets = ::computeFaceOffsets(faceVertexCounts);
+        valid = true;
+    }
+
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    std::vector<size_t> faceOffsets;
+    int maxIndex;
+    bool valid;
+};
+
+usdex::core::MeshTopology::MeshTopology(const VtIntArray& faceVertexCounts, const VtIntArray& faceVertexIndices)
+{
+    USDEX_INSTRUMENT_SCOPE("MeshTopology");
+    USDEX_INSTRUMENT_ARRAY(faceVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(faceVertexIndices);
+
+    m_impl = new MeshTopologyImpl(faceVertexCounts, faceVertexIndices);
+}
+
+usdex::core::MeshTopology::~MeshTopology()
+{
+    delete m_impl;
+}
+
+bool usdex::core::MeshTopology::isValid() const
+{
+    return m_impl->valid;
+}
+
+const VtIntArray& usdex::core::MeshTopology::getFaceVertexCounts() const
+{
+    return m_impl->faceVertexCounts;
+}
+
+const VtIntArray& usdex::core::MeshTopology::getFaceVertexIndices() const
+{
+    return m_impl->faceVertexIndices;
+}
+
+const std::vector<size_t>& usdex::core::MeshTopology::getFaceOffsets() const
+{
+    return m_impl->faceOffsets;
+}
+
+size_t usdex::core::MeshTopology::getFaceCount() const
+{
+    return m_impl->faceVertexCounts.size();
+}
+
+size_t usdex::core::MeshTopology::getFaceVertexCount() const
+{
+    return m_impl->faceVertexIndices.size();
+}
+
+int usdex::core::MeshTopology::getMaxIndex() const
+{
+    return m_impl->maxIndex;
+}
+
+UsdGeomMesh usdex::core::definePolyMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    USDEX_INSTRUMENT_SCOPE("definePolyMesh");
+    USDEX_INSTRUMENT_ARRAY(faceVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(faceVertexIndices);
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(uvs);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomMesh due to an invalid location: %s", reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    // Early out if the points, topology, or primvars are not valid
+    if (!::validatePolyMesh(
+            path,
+            faceVertexCounts,
+            faceVertexIndices,
+            points,
+            normals.has_value() ? &normals.value() : nullptr,
+            uvs.has_value() ? &uvs.value() : nullptr,
+            displayColor.has_value() ? &displayColor.value() : nullptr,
+            displayOpacity.has_value() ? &displayOpacity.value() : nullptr,
+            &reason
+        ))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    return ::authorPolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity);
+}
+
+UsdGeomMesh usdex::core::definePolyMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    const PolyMeshIndexing& indexing,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    return usdex::core::definePolyMesh(
+        stage,
+        path,
+        faceVertexCounts,
+        faceVertexIndices,
+        points,
+        ::indexPrimvar(normals, indexing),
+        ::indexPrimvar(uvs, indexing),
+        displayColor,
+        displayOpacity
+    );
+}
+
+UsdGeomMesh usdex::core::definePolyMesh(
+    UsdPrim parent,
+    const std::string& name,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        const VtIntArray subsetIndices(indices[i]);
-        const SdfPath subsetPath = path.AppendChild(names[i]);
-        UsdGeomSubset subset = ::defineGeomSubset(stage, mesh, subsetPath, subsetIndices, elementType, familyName, familyType, reason);
-        if (!subset.GetPrim().IsValid())
-        {
-            break;
-        }
-        subsets.push_back(subset);
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomMesh due to an invalid location: %s",
+            reason.c_str()
+        );
+        return UsdGeomMesh();
     }
 
-    // If there are any interrupted subsets,
-    // the reason will already contain an error string.
-    if (subsets.size() != names.size())
+    // Call overloaded function
+    UsdStageWeakPtr stage = parent.GetStage();
+    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
+    return usdex::core::definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity);
+}
+
+UsdGeomMesh usdex::core::definePolyMesh(
+    UsdPrim prim,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    // Early out if the prim is invalid
+    if (!prim)
     {
-        removeSubsetsFromStage(mesh.GetPrim(), familyName, subsets);
-        return {};
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid prim");
+        return UsdGeomMesh();
     }
 
-    // Validate the entire family after the new subsets are created.
-    if (!UsdGeomSubset::ValidateFamily(mesh, elementType, familyName, &reason))
+    // Warn if original prim is not Scope or Xform
+    TfToken originalType = prim.GetTypeName();
+    if (originalType != UsdGeomTokens->Scope && originalType != UsdGeomTokens->Xform && !originalType.IsEmpty())
     {
-        removeSubsetsFromStage(mesh.GetPrim(), familyName, subsets);
-        return {};
+        TF_WARN(
+            "Redefining prim at \"%s\" from type \"%s\" to \"Mesh\". Expected original type to be \"\" or \"Scope\" or \"Xform\".",
+            prim.GetPath().GetAsString().c_str(),
+            originalType.GetText()
+        );
     }
 
-    return subsets;
+    // Call the stage/path version
+    UsdStageWeakPtr stage = prim.GetStage();
+    const SdfPath& path = prim.GetPath();
+    return usdex::core::definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity);
 }
 
-} // namespace
-
 UsdGeomMesh usdex::core::definePolyMesh(
     UsdStagePtr stage,
     const SdfPath& path,
-    const VtIntArray& faceVertexCounts,
-    const VtIntArray& faceVertexIndices,
+    const MeshTopology& topology,
     const VtVec3fArray& points,
     std::optional<const Vec3fPrimvarData> normals,
     std::optional<const Vec2fPrimvarData> uvs,
@@ -500,211 +2321,385 @@ UsdGeomMesh usdex::core::definePolyMesh(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePolyMesh");
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(uvs);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomMesh due to an invalid location: %s", reason.c_str());
         return UsdGeomMesh();
     }
 
-    // Early out if the points are empty
-    if (points.empty())
+    // Early out if the points or primvars are not valid. The topology itself was validated when it was created.
+    if (!::validatePolyMesh(
+            path,
+            topology,
+            points,
+            normals.has_value() ? &normals.value() : nullptr,
+            uvs.has_value() ? &uvs.value() : nullptr,
+            displayColor.has_value() ? &displayColor.value() : nullptr,
+            displayOpacity.has_value() ? &displayOpacity.value() : nullptr,
+            &reason
+        ))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid points: Empty array", path.GetAsString().c_str());
+        TF_RUNTIME_ERROR("%s", reason.c_str());
         return UsdGeomMesh();
     }
 
-    // Early out if the topology is not valid
-    if (!UsdGeomMesh::ValidateTopology(faceVertexIndices, faceVertexCounts, points.size(), &reason))
+    return ::authorPolyMesh(
+        stage,
+        path,
+        topology.getFaceVertexCounts(),
+        topology.getFaceVertexIndices(),
+        points,
+        normals,
+        uvs,
+        displayColor,
+        displayOpacity
+    );
+}
+
+bool usdex::core::setPolyMeshPoints(
+    UsdGeomMesh mesh,
+    const MeshTopology& topology,
+    const VtVec3fArray& points,
+    UsdTimeCode time,
+    std::optional<const Vec3fPrimvarData> normals
+)
+{
+    USDEX_INSTRUMENT_SCOPE("setPolyMeshPoints");
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+
+    if (!mesh)
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid topology: %s", path.GetAsString().c_str(), reason.c_str());
-        return UsdGeomMesh();
+        TF_RUNTIME_ERROR("Unable to set points on an invalid UsdGeomMesh");
+        return false;
+    }
+
+    const std::string path = mesh.GetPath().GetAsString();
+    if (!topology.isValid())
+    {
+        TF_RUNTIME_ERROR("Unable to set points on UsdGeomMesh at \"%s\" due to invalid topology: The MeshTopology is not valid", path.c_str());
+        return false;
+    }
+
+    // Only the points and normals need to be validated, as the topology was validated when it was created
+    std::string reason;
+    if (!::validateTopologyPoints(topology, points, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to set points on UsdGeomMesh at \"%s\" due to invalid points: %s", path.c_str(), reason.c_str());
+        return false;
     }
 
-    // Early out if normals were specified but not valid
     if (normals.has_value())
     {
         static const TfTokenVector validInterpolations = { UsdGeomTokens->uniform, UsdGeomTokens->vertex, UsdGeomTokens->faceVarying };
-        if (!validatePrimvar(normals.value(), validInterpolations, faceVertexCounts, faceVertexIndices, points, &reason))
+        if (!::validatePrimvar(normals.value(), validInterpolations, topology.getFaceCount(), topology.getFaceVertexCount(), points.size(), &reason))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid normals: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomMesh();
+            TF_RUNTIME_ERROR("Unable to set points on UsdGeomMesh at \"%s\" due to invalid normals: %s", path.c_str(), reason.c_str());
+            return false;
         }
     }
 
-    // Early out if uvs were specified but not valid
-    if (uvs.has_value())
+    detail::setAttributeValue(mesh.CreatePointsAttr(), points, time);
+    detail::setAttributeValue(mesh.CreateExtentAttr(), computePointsExtent(points), time);
+
+    if (normals.has_value())
     {
-        static const TfTokenVector validInterpolations = { UsdGeomTokens->vertex, UsdGeomTokens->faceVarying };
-        if (!validatePrimvar(uvs.value(), validInterpolations, faceVertexCounts, faceVertexIndices, points, &reason))
+        UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(UsdGeomTokens->normals, SdfValueTypeNames->Normal3fArray);
+        if (!detail::setPrimvarData(primvar, normals.value(), time))
         {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid uvs: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomMesh();
+            TF_WARN("Failed to set normals primvar for UsdGeomMesh at \"%s\"", path.c_str());
         }
     }
 
-    // All interpolations are valid by default
-    static const TfTokenVector s_allValidInterpolations = { UsdGeomTokens->constant,
-                                                            UsdGeomTokens->uniform,
-                                                            UsdGeomTokens->varying,
-                                                            UsdGeomTokens->vertex,
-                                                            UsdGeomTokens->faceVarying };
+    return true;
+}
 
-    // Early out if displayColor was specified but not valid
-    if (displayColor.has_value())
+std::vector<UsdGeomMesh> usdex::core::definePolyMeshes(UsdStagePtr stage, const std::vector<PolyMeshData>& meshes)
+{
+    USDEX_INSTRUMENT_SCOPE("definePolyMeshes");
+    for (const PolyMeshData& mesh : meshes)
     {
-        if (!::validatePrimvar(displayColor.value(), s_allValidInterpolations, faceVertexCounts, faceVertexIndices, points, &reason))
-        {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid display color: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomMesh();
-        }
+        USDEX_INSTRUMENT_ARRAY(mesh.faceVertexCounts);
+        USDEX_INSTRUMENT_ARRAY(mesh.faceVertexIndices);
+        USDEX_INSTRUMENT_ARRAY(mesh.points);
+        USDEX_INSTRUMENT_PRIMVAR(mesh.normals);
+        USDEX_INSTRUMENT_PRIMVAR(mesh.uvs);
+        USDEX_INSTRUMENT_PRIMVAR(mesh.displayColor);
+        USDEX_INSTRUMENT_PRIMVAR(mesh.displayOpacity);
     }
 
-    // Early out if displayOpacity was specified but not valid
-    if (displayOpacity.has_value())
+    // Early out if the stage is invalid
+    if (!stage)
     {
-        if (!::validatePrimvar(displayOpacity.value(), s_allValidInterpolations, faceVertexCounts, faceVertexIndices, points, &reason))
-        {
-            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\" due to invalid display opacity: %s", path.GetAsString().c_str(), reason.c_str());
-            return UsdGeomMesh();
-        }
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidStage, "Unable to define UsdGeomMeshes due to an invalid stage");
+        return {};
     }
 
-    // Define the Mesh and check that this was successful
-    UsdGeomMesh mesh = UsdGeomMesh::Define(stage, path);
-    if (!mesh)
+    if (meshes.empty())
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
-        return UsdGeomMesh();
+        return {};
     }
 
-    // Explicitly author the specifier and type name
-    UsdPrim prim = mesh.GetPrim();
-    prim.SetSpecifier(SdfSpecifierDef);
-    prim.SetTypeName(prim.GetTypeName());
-
-    // Author opinions on Mesh attributes
-    mesh.CreateOrientationAttr().Set(UsdGeomTokens->rightHanded);
-    mesh.CreateSubdivisionSchemeAttr().Set(UsdGeomTokens->none);
-
-    // Create and set required topology attributes
-    mesh.CreateFaceVertexCountsAttr().Set(faceVertexCounts);
-    mesh.CreateFaceVertexIndicesAttr().Set(faceVertexIndices);
-    mesh.CreatePointsAttr().Set(points);
-
-    // Compute an extent from the points so there is a guarantee that the extent will be correct and authored in all cases.
-    VtArray<GfVec3f> extent;
-    UsdGeomPointBased::ComputeExtent(points, &extent);
-    mesh.CreateExtentAttr().Set(extent);
+    // Validate every mesh and compute its extent before authoring any scene description.
+    // The mesh data is independent of the stage, so it is safe to validate in parallel.
+    SdfPathVector meshPaths(meshes.size());
+    std::vector<std::string> errors(meshes.size());
+    std::vector<VtVec3fArray> extents(meshes.size());
+    WorkParallelForN(
+        meshes.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const PolyMeshData& mesh = meshes[i];
+                meshPaths[i] = mesh.path;
+                if (::validatePolyMesh(
+                        mesh.path,
+                        mesh.faceVertexCounts,
+                        mesh.faceVertexIndices,
+                        mesh.points,
+                        mesh.normals.has_value() ? &mesh.normals.value() : nullptr,
+                        mesh.uvs.has_value() ? &mesh.uvs.value() : nullptr,
+                        mesh.displayColor.has_value() ? &mesh.displayColor.value() : nullptr,
+                        mesh.displayOpacity.has_value() ? &mesh.displayOpacity.value() : nullptr,
+                        &errors[i]
+                    ))
+                {
+                    extents[i] = computePointsExtent(mesh.points);
+                }
+            }
+        },
+        s_meshValidationGrainSize
+    );
 
-    // Optionally author normals
-    if (normals.has_value())
+    // Early out if any of the meshes are invalid, or are requested more than once
+    std::unordered_set<SdfPath, SdfPath::Hash> paths;
+    if (!usdex::core::detail::validateBatchLocations(TF_CALL_CONTEXT, stage, meshPaths, "UsdGeomMesh", &paths, &errors))
     {
-        // Define the normals primvar
-        const TfToken& name = UsdGeomTokens->normals;
-        const SdfValueTypeName& typeName = SdfValueTypeNames->Normal3fArray;
-        UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(name, typeName);
-        if (!normals.value().setPrimvar(primvar))
-        {
-            TF_WARN("Failed to set normals primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
-        }
+        return {};
     }
 
-    // Optionally author the primary UV set
-    if (uvs.has_value())
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    if (!layer)
     {
-        const TfToken& name = UsdUtilsGetPrimaryUVSetName();
-        const SdfValueTypeName& typeName = SdfValueTypeNames->TexCoord2fArray;
-        UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(name, typeName);
-        if (!uvs.value().setPrimvar(primvar))
-        {
-            TF_WARN("Failed to set uvs primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
-        }
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMeshes due to an invalid edit target");
+        return {};
     }
 
-    // Optionally author display color
-    if (displayColor.has_value())
+    // Author all of the meshes directly in the edit target layer, so that change processing occurs once for the entire batch
+    static const TfToken s_meshTypeName = UsdSchemaRegistry::GetSchemaTypeName<UsdGeomMesh>();
     {
-        UsdGeomPrimvar primvar = mesh.CreateDisplayColorPrimvar();
-        if (!displayColor.value().setPrimvar(primvar))
+        SdfChangeBlock changeBlock;
+
+        usdex::core::detail::defineUndefinedAncestors(stage, paths);
+
+        for (size_t i = 0; i < meshes.size(); ++i)
         {
-            TF_WARN("Failed to set display color primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+            const PolyMeshData& mesh = meshes[i];
+            const std::string& path = mesh.path.GetAsString();
+
+            SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(layer, editTarget.MapToSpecPath(mesh.path));
+            if (!primSpec)
+            {
+                TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", path.c_str());
+                continue;
+            }
+
+            // Explicitly author the specifier and type name
+            primSpec->SetSpecifier(SdfSpecifierDef);
+            primSpec->SetTypeName(s_meshTypeName);
+
+            // Author opinions on Mesh attributes
+            ::setAttributeSpec(
+                primSpec,
+                UsdGeomTokens->orientation,
+                SdfValueTypeNames->Token,
+                SdfVariabilityUniform,
+                VtValue(UsdGeomTokens->rightHanded)
+            );
+            ::setAttributeSpec(
+                primSpec,
+                UsdGeomTokens->subdivisionScheme,
+                SdfValueTypeNames->Token,
+                SdfVariabilityUniform,
+                VtValue(UsdGeomTokens->none)
+            );
+
+            // Author required topology attributes and the precomputed extent
+            ::setAttributeSpec(
+                primSpec,
+                UsdGeomTokens->faceVertexCounts,
+                SdfValueTypeNames->IntArray,
+                SdfVariabilityVarying,
+                VtValue(mesh.faceVertexCounts)
+            );
+            ::setAttributeSpec(
+                primSpec,
+                UsdGeomTokens->faceVertexIndices,
+                SdfValueTypeNames->IntArray,
+                SdfVariabilityVarying,
+                VtValue(mesh.faceVertexIndices)
+            );
+            ::setAttributeSpec(primSpec, UsdGeomTokens->points, SdfValueTypeNames->Point3fArray, SdfVariabilityVarying, VtValue(mesh.points));
+            ::setAttributeSpec(primSpec, UsdGeomTokens->extent, SdfValueTypeNames->Float3Array, SdfVariabilityVarying, VtValue(extents[i]));
+
+            // Optionally author normals
+            if (mesh.normals.has_value() &&
+                !::setPrimvarSpec(primSpec, UsdGeomTokens->normals, SdfValueTypeNames->Normal3fArray, mesh.normals.value()))
+            {
+                TF_WARN("Failed to set normals primvar for UsdGeomMesh at \"%s\"", path.c_str());
+            }
+
+            // Optionally author the primary UV set
+            if (mesh.uvs.has_value() &&
+                !::setPrimvarSpec(primSpec, UsdUtilsGetPrimaryUVSetName(), SdfValueTypeNames->TexCoord2fArray, mesh.uvs.value()))
+            {
+                TF_WARN("Failed to set uvs primvar for UsdGeomMesh at \"%s\"", path.c_str());
+            }
+
+            // Optionally author display color
+            if (mesh.displayColor.has_value() &&
+                !::setPrimvarSpec(primSpec, _tokens->displayColor, SdfValueTypeNames->Color3fArray, mesh.displayColor.value()))
+            {
+                TF_WARN("Failed to set display color primvar for UsdGeomMesh at \"%s\"", path.c_str());
+            }
+
+            // Optionally author display opacity
+            if (mesh.displayOpacity.has_value() &&
+                !::setPrimvarSpec(primSpec, _tokens->displayOpacity, SdfValueTypeNames->FloatArray, mesh.displayOpacity.value()))
+            {
+                TF_WARN("Failed to set display opacity primvar for UsdGeomMesh at \"%s\"", path.c_str());
+            }
         }
     }
 
-    // Optionally author display opacity
-    if (displayOpacity.has_value())
+    // The stage has recomposed once the change block has closed, so the schemas can now be constructed
+    std::vector<UsdGeomMesh> result;
+    result.reserve(meshes.size());
+    for (const PolyMeshData& mesh : meshes)
     {
-        UsdGeomPrimvar primvar = mesh.CreateDisplayOpacityPrimvar();
-        if (!displayOpacity.value().setPrimvar(primvar))
+        UsdGeomMesh geomMesh(stage->GetPrimAtPath(mesh.path));
+        if (!geomMesh)
         {
-            TF_WARN("Failed to set display opacity primvar for UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+            TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", mesh.path.GetAsString().c_str());
         }
+        result.push_back(geomMesh);
     }
 
-    return mesh;
+    return result;
 }
 
-UsdGeomMesh usdex::core::definePolyMesh(
-    UsdPrim parent,
-    const std::string& name,
-    const VtIntArray& faceVertexCounts,
-    const VtIntArray& faceVertexIndices,
-    const VtVec3fArray& points,
-    std::optional<const Vec3fPrimvarData> normals,
-    std::optional<const Vec2fPrimvarData> uvs,
-    std::optional<const Vec3fPrimvarData> displayColor,
-    std::optional<const FloatPrimvarData> displayOpacity
-)
+std::vector<UsdGeomMesh> usdex::core::definePolyMeshBatch(UsdPrim parent, const MeshBatch& batch, NameCache* nameCache)
 {
-    // Early out if the proposed prim location is invalid
-    std::string reason;
-    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    USDEX_INSTRUMENT_SCOPE("definePolyMeshBatch");
+    USDEX_INSTRUMENT_ARRAY(batch.faceVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(batch.faceVertexIndices);
+    USDEX_INSTRUMENT_ARRAY(batch.points);
+    USDEX_INSTRUMENT_PRIMVAR(batch.normals);
+    USDEX_INSTRUMENT_PRIMVAR(batch.uvs);
+    USDEX_INSTRUMENT_PRIMVAR(batch.displayColor);
+
+    if (!parent)
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid location: %s", reason.c_str());
-        return UsdGeomMesh();
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidLocation, "Unable to define UsdGeomMeshes due to an invalid parent prim");
+        return {};
     }
 
-    // Call overloaded function
-    UsdStageWeakPtr stage = parent.GetStage();
-    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
-    return usdex::core::definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity);
-}
+    const size_t meshCount = batch.names.size();
+    if (meshCount == 0)
+    {
+        return {};
+    }
 
-UsdGeomMesh usdex::core::definePolyMesh(
-    UsdPrim prim,
-    const VtIntArray& faceVertexCounts,
-    const VtIntArray& faceVertexIndices,
-    const VtVec3fArray& points,
-    std::optional<const Vec3fPrimvarData> normals,
-    std::optional<const Vec2fPrimvarData> uvs,
-    std::optional<const Vec3fPrimvarData> displayColor,
-    std::optional<const FloatPrimvarData> displayOpacity
-)
-{
-    // Early out if the prim is invalid
-    if (!prim)
+    // The offsets must describe consecutive ranges of the concatenated arrays, with one range per mesh
+    MeshBatchRanges ranges;
+    if (!::getBatchOffsets(batch.pointOffsets, meshCount, batch.points.size(), ranges.points) ||
+        !::getBatchOffsets(batch.faceOffsets, meshCount, batch.faceVertexCounts.size(), ranges.faces))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh due to an invalid prim");
-        return UsdGeomMesh();
+        USDEX_AUTHORING_ERROR(
+            parent.GetPath(),
+            eInvalidArgument,
+            "Unable to define UsdGeomMeshes below \"%s\" due to invalid offsets, which must hold %zu consecutive ranges of the concatenated arrays",
+            parent.GetPath().GetAsString().c_str(),
+            meshCount
+        );
+        return {};
     }
 
-    // Warn if original prim is not Scope or Xform
-    TfToken originalType = prim.GetTypeName();
-    if (originalType != UsdGeomTokens->Scope && originalType != UsdGeomTokens->Xform && !originalType.IsEmpty())
+    // The face vertex offsets are implied by the face vertex counts
+    ranges.faceVertices.resize(meshCount + 1, 0);
+    size_t faceVertexCount = 0;
+    for (size_t i = 0; i < meshCount; ++i)
     {
-        TF_WARN(
-            "Redefining prim at \"%s\" from type \"%s\" to \"Mesh\". Expected original type to be \"\" or \"Scope\" or \"Xform\".",
-            prim.GetPath().GetAsString().c_str(),
-            originalType.GetText()
+        for (size_t face = ranges.faces[i]; face < ranges.faces[i + 1]; ++face)
+        {
+            faceVertexCount += static_cast<size_t>(std::max(batch.faceVertexCounts[face], 0));
+        }
+        ranges.faceVertices[i + 1] = faceVertexCount;
+    }
+    if (faceVertexCount != batch.faceVertexIndices.size())
+    {
+        USDEX_AUTHORING_ERROR(
+            parent.GetPath(),
+            eInvalidArgument,
+            "Unable to define UsdGeomMeshes below \"%s\" due to mismatched faceVertexCounts (%zu face vertices) and faceVertexIndices (%zu)",
+            parent.GetPath().GetAsString().c_str(),
+            faceVertexCount,
+            batch.faceVertexIndices.size()
+        );
+        return {};
+    }
+
+    std::vector<size_t> constantRanges(meshCount + 1);
+    std::iota(constantRanges.begin(), constantRanges.end(), 0);
+    if (!::isValidBatchPrimvar(batch.normals, ranges, constantRanges) || !::isValidBatchPrimvar(batch.uvs, ranges, constantRanges) ||
+        !::isValidBatchPrimvar(batch.displayColor, ranges, constantRanges))
+    {
+        USDEX_AUTHORING_ERROR(
+            parent.GetPath(),
+            eInvalidArgument,
+            "Unable to define UsdGeomMeshes below \"%s\" due to primvars which do not hold the elements of every mesh",
+            parent.GetPath().GetAsString().c_str()
         );
+        return {};
     }
 
-    // Call the stage/path version
-    UsdStageWeakPtr stage = prim.GetStage();
-    const SdfPath& path = prim.GetPath();
-    return usdex::core::definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity);
+    NameCache localNameCache;
+    NameCache& cache = nameCache ? *nameCache : localNameCache;
+    const TfTokenVector names = cache.getPrimNames(parent, batch.names);
+
+    // Slicing copies the data of each mesh into arrays of its own, which is independent per mesh
+    std::vector<PolyMeshData> meshes(meshCount);
+    WorkParallelForN(
+        meshCount,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                PolyMeshData& mesh = meshes[i];
+                mesh.path = parent.GetPath().AppendChild(names[i]);
+                mesh.faceVertexCounts = ::sliceBatchArray(batch.faceVertexCounts, ranges.faces[i], ranges.faces[i + 1]);
+                mesh.faceVertexIndices = ::sliceBatchArray(batch.faceVertexIndices, ranges.faceVertices[i], ranges.faceVertices[i + 1]);
+                mesh.points = ::sliceBatchArray(batch.points, ranges.points[i], ranges.points[i + 1]);
+                mesh.normals = ::sliceBatchPrimvar(batch.normals, ranges, constantRanges, i);
+                mesh.uvs = ::sliceBatchPrimvar(batch.uvs, ranges, constantRanges, i);
+                mesh.displayColor = ::sliceBatchPrimvar(batch.displayColor, ranges, constantRanges, i);
+            }
+        },
+        s_meshValidationGrainSize
+    );
+
+    return usdex::core::definePolyMeshes(parent.GetStage(), meshes);
 }
 
 Vec3fPrimvarData usdex::core::computeMeshNormals(
@@ -712,16 +2707,13 @@ Vec3fPrimvarData usdex::core::computeMeshNormals(
     const VtIntArray& faceVertexIndices,
     const VtVec3fArray& points,
     const TfToken& interpolation,
-    const GfVec3f& fallback
+    const GfVec3f& fallback,
+    float smoothingAngle
 )
 {
     // Validate interpolation
-    if (interpolation != UsdGeomTokens->uniform && interpolation != UsdGeomTokens->vertex && interpolation != UsdGeomTokens->faceVarying)
+    if (!::validateNormalsInterpolation(interpolation))
     {
-        TF_WARN(
-            "Unable to compute normals due to unsupported interpolation '%s'. Only 'uniform', 'vertex', and 'faceVarying' are supported.",
-            interpolation.GetText()
-        );
         return getInvalidPrimvar();
     }
 
@@ -740,53 +2732,53 @@ Vec3fPrimvarData usdex::core::computeMeshNormals(
         return getInvalidPrimvar();
     }
 
-    // Normalize the fallback vector to ensure it's a valid normal
-    GfVec3f defaultNormal = fallback.GetNormalized();
+    // Compute the per-face offsets once so that faces can be processed independently
+    detail::ScratchArray<size_t> faceOffsets(faceVertexCounts.size());
+    ::fillFaceOffsets(faceVertexCounts, faceOffsets.data());
+    return ::computeValidatedMeshNormals(faceVertexCounts, faceVertexIndices, faceOffsets.data(), points, interpolation, fallback, smoothingAngle);
+}
 
-    if (interpolation == UsdGeomTokens->uniform)
+Vec3fPrimvarData usdex::core::computeMeshNormals(
+    const MeshTopology& topology,
+    const VtVec3fArray& points,
+    const TfToken& interpolation,
+    const GfVec3f& fallback,
+    float smoothingAngle
+)
+{
+    // Validate interpolation
+    if (!::validateNormalsInterpolation(interpolation))
     {
-        auto faceNormals = computeFaceNormals(faceVertexCounts, faceVertexIndices, points, defaultNormal, &reason);
-        if (!reason.empty())
-        {
-            TF_WARN("%s", reason.c_str());
-        }
-        if (faceNormals.empty())
-        {
-            return getInvalidPrimvar();
-        }
-        return getIndexedPrimvar(faceNormals, UsdGeomTokens->uniform);
+        return getInvalidPrimvar();
     }
-    else if (interpolation == UsdGeomTokens->vertex)
+
+    // Early out if the topology is not valid
+    if (!topology.isValid())
     {
-        auto vertexNormals = computeVertexNormals(faceVertexCounts, faceVertexIndices, points, defaultNormal, &reason);
-        if (!reason.empty())
-        {
-            TF_WARN("%s", reason.c_str());
-        }
-        if (vertexNormals.empty())
-        {
-            return getInvalidPrimvar();
-        }
-        return getIndexedPrimvar(vertexNormals, UsdGeomTokens->vertex);
+        TF_RUNTIME_ERROR("Unable to compute normals due to invalid topology: The MeshTopology is not valid");
+        return getInvalidPrimvar();
     }
-    else if (interpolation == UsdGeomTokens->faceVarying)
+
+    // The topology has already been validated, so only the number of points needs to be checked
+    std::string reason;
+    if (!::validateTopologyPoints(topology, points, &reason))
     {
-        auto cornerNormals = computeFaceVaryingNormals(faceVertexCounts, faceVertexIndices, points, defaultNormal, &reason);
-        if (!reason.empty())
-        {
-            TF_WARN("%s", reason.c_str());
-        }
-        if (cornerNormals.empty())
-        {
-            return getInvalidPrimvar();
-        }
-        return getIndexedPrimvar(cornerNormals, UsdGeomTokens->faceVarying);
+        TF_RUNTIME_ERROR("Unable to compute normals due to invalid points: %s", reason.c_str());
+        return getInvalidPrimvar();
     }
 
-    return getInvalidPrimvar();
+    return ::computeValidatedMeshNormals(
+        topology.getFaceVertexCounts(),
+        topology.getFaceVertexIndices(),
+        topology.getFaceOffsets().data(),
+        points,
+        interpolation,
+        fallback,
+        smoothingAngle
+    );
 }
 
-Vec3fPrimvarData usdex::core::computeMeshNormals(UsdGeomMesh mesh, const TfToken& interpolation, const GfVec3f& fallback)
+Vec3fPrimvarData usdex::core::computeMeshNormals(UsdGeomMesh mesh, const TfToken& interpolation, const GfVec3f& fallback, float smoothingAngle)
 {
     // Early out if the mesh is invalid
     if (!mesh)
@@ -802,7 +2794,7 @@ Vec3fPrimvarData usdex::core::computeMeshNormals(UsdGeomMesh mesh, const TfToken
     mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices);
     mesh.GetPointsAttr().Get(&points);
 
-    Vec3fPrimvarData normals = computeMeshNormals(faceVertexCounts, faceVertexIndices, points, interpolation, fallback);
+    Vec3fPrimvarData normals = computeMeshNormals(faceVertexCounts, faceVertexIndices, points, interpolation, fallback, smoothingAngle);
 
     // Define the normals primvar
     UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh.GetPrim()).CreatePrimvar(UsdGeomTokens->normals, SdfValueTypeNames->Normal3fArray);
@@ -867,3 +2859,502 @@ std::vector<UsdGeomSubset> usdex::core::defineUnrestrictedSubsets(
     }
     return subsets;
 }
+
+std::vector<UsdGeomSubset> usdex::core::definePartitionedSubsetsFromFaceIds(
+    UsdGeomMesh mesh,
+    const VtIntArray& faceIds,
+    const std::vector<TfToken>& names,
+    const std::vector<UsdShadeMaterial>& materials,
+    const TfToken& familyName
+)
+{
+    std::string reason;
+    std::vector<TfToken> subsetNames;
+    std::vector<VtIntArray> subsetIndices;
+    std::vector<UsdShadeMaterial> subsetMaterials;
+    if (!::bucketFaceIds(mesh, faceIds, names, materials, &subsetNames, &subsetIndices, &subsetMaterials, reason))
+    {
+        TF_RUNTIME_ERROR("Failed to define partitioned subsets \"%s\": %s", mesh.GetPath().GetAsString().c_str(), reason.c_str());
+        return std::vector<UsdGeomSubset>();
+    }
+
+    std::vector<UsdGeomSubset> subsets =
+        ::defineGeomSubsets(mesh, subsetNames, subsetIndices, UsdGeomTokens->face, familyName, UsdGeomTokens->partition, reason);
+    if (subsets.empty())
+    {
+        TF_RUNTIME_ERROR("Failed to define partitioned subsets \"%s\": %s", mesh.GetPath().GetAsString().c_str(), reason.c_str());
+        return std::vector<UsdGeomSubset>();
+    }
+
+    if (!subsetMaterials.empty() && !usdex::core::bindMaterialSubsets(subsets, subsetMaterials))
+    {
+        TF_WARN("Failed to bind materials to partitioned subsets \"%s\"", mesh.GetPath().GetAsString().c_str());
+    }
+
+    return subsets;
+}
+
+std::vector<UsdGeomMesh> usdex::core::definePolyMeshChunks(
+    UsdPrim parent,
+    const std::string& name,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    size_t maxFacesPerChunk,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity,
+    const std::vector<TfToken>& subsetNames,
+    const std::vector<VtIntArray>& subsetIndices,
+    const TfToken& subsetFamilyName
+)
+{
+    USDEX_INSTRUMENT_SCOPE("definePolyMeshChunks");
+    USDEX_INSTRUMENT_ARRAY(faceVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(faceVertexIndices);
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(uvs);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    {
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomMesh chunks due to an invalid location: %s",
+            reason.c_str()
+        );
+        return {};
+    }
+
+    // Early out if the points, topology, or primvars are not valid, as the chunks are sliced from them without further checks
+    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
+    if (!::validatePolyMesh(
+            path,
+            faceVertexCounts,
+            faceVertexIndices,
+            points,
+            normals.has_value() ? &normals.value() : nullptr,
+            uvs.has_value() ? &uvs.value() : nullptr,
+            displayColor.has_value() ? &displayColor.value() : nullptr,
+            displayOpacity.has_value() ? &displayOpacity.value() : nullptr,
+            &reason
+        ))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return {};
+    }
+
+    if (maxFacesPerChunk == 0)
+    {
+        USDEX_AUTHORING_ERROR(
+            path,
+            eInvalidArgument,
+            "Unable to define UsdGeomMesh chunks at \"%s\" with zero faces per chunk",
+            path.GetAsString().c_str()
+        );
+        return {};
+    }
+
+    // The subsets must partition the faces, so that the subsets of each chunk also partition the faces of that chunk
+    const size_t faceCount = faceVertexCounts.size();
+    if (!::validateSubsetPartition(faceCount, subsetNames, subsetIndices, &reason))
+    {
+        USDEX_AUTHORING_ERROR(
+            path,
+            eInvalidArgument,
+            "Unable to define UsdGeomMesh chunks at \"%s\" due to %s",
+            path.GetAsString().c_str(),
+            reason.c_str()
+        );
+        return {};
+    }
+
+    // Each chunk holds a consecutive run of faces along the Morton curve, and is sliced from the mesh independently of the other chunks
+    const std::vector<size_t> faceOffsets = ::computeFaceOffsets(faceVertexCounts);
+    const std::vector<size_t> order = ::computeMortonFaceOrder(faceVertexCounts, faceVertexIndices, faceOffsets, points);
+    const size_t chunkCount = (faceCount + maxFacesPerChunk - 1) / maxFacesPerChunk;
+    std::vector<PolyMeshData> meshes(chunkCount);
+    std::vector<uint32_t> faceChunks(faceCount);
+    std::vector<int> chunkFaces(faceCount);
+    WorkParallelForN(
+        chunkCount,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const size_t first = i * maxFacesPerChunk;
+                const size_t count = std::min(maxFacesPerChunk, faceCount - first);
+                const MeshChunk chunk = ::buildMeshChunk(order.data() + first, count, faceVertexCounts, faceVertexIndices, faceOffsets);
+
+                PolyMeshData& mesh = meshes[i];
+                mesh.path = path.AppendChild(TfToken(TfStringPrintf("Chunk_%zu", i)));
+                mesh.faceVertexCounts.resize(chunk.faces.size());
+                for (size_t face = 0; face < chunk.faces.size(); ++face)
+                {
+                    mesh.faceVertexCounts[face] = faceVertexCounts[chunk.faces[face]];
+                    faceChunks[chunk.faces[face]] = static_cast<uint32_t>(i);
+                    chunkFaces[chunk.faces[face]] = static_cast<int>(face);
+                }
+                mesh.faceVertexIndices.resize(chunk.faceVertices.size());
+                for (size_t vertex = 0; vertex < chunk.faceVertices.size(); ++vertex)
+                {
+                    const size_t point = static_cast<size_t>(faceVertexIndices[chunk.faceVertices[vertex]]);
+                    const auto pointIt = std::lower_bound(chunk.points.begin(), chunk.points.end(), point);
+                    mesh.faceVertexIndices[vertex] = static_cast<int>(pointIt - chunk.points.begin());
+                }
+                mesh.points.resize(chunk.points.size());
+                for (size_t point = 0; point < chunk.points.size(); ++point)
+                {
+                    mesh.points[point] = points[chunk.points[point]];
+                }
+                mesh.normals = ::gatherChunkPrimvar(normals, chunk);
+                mesh.uvs = ::gatherChunkPrimvar(uvs, chunk);
+                mesh.displayColor = ::gatherChunkPrimvar(displayColor, chunk);
+                mesh.displayOpacity = ::gatherChunkPrimvar(displayOpacity, chunk);
+            }
+        },
+        std::max<size_t>(1, s_meshChunkGrainSize / maxFacesPerChunk)
+    );
+
+    UsdGeomXform xform = usdex::core::defineXform(parent, name);
+    if (!xform)
+    {
+        return {};
+    }
+
+    std::vector<UsdGeomMesh> result = usdex::core::definePolyMeshes(parent.GetStage(), meshes);
+    if (result.empty() || subsetIndices.empty())
+    {
+        return result;
+    }
+
+    // Remap the faces of each subset to the faces of each chunk, skipping subsets which would be empty in a chunk
+    std::vector<std::vector<VtIntArray>> chunkSubsetIndices(chunkCount, std::vector<VtIntArray>(subsetIndices.size()));
+    for (size_t subset = 0; subset < subsetIndices.size(); ++subset)
+    {
+        for (const int face : subsetIndices[subset])
+        {
+            chunkSubsetIndices[faceChunks[face]][subset].push_back(chunkFaces[face]);
+        }
+    }
+    for (size_t i = 0; i < chunkCount; ++i)
+    {
+        std::vector<TfToken> names;
+        std::vector<VtIntArray> indices;
+        for (size_t subset = 0; subset < subsetIndices.size(); ++subset)
+        {
+            if (!chunkSubsetIndices[i][subset].empty())
+            {
+                names.push_back(subsetNames[subset]);
+                indices.push_back(std::move(chunkSubsetIndices[i][subset]));
+            }
+        }
+        if (usdex::core::definePartitionedSubsets(result[i], names, indices, UsdGeomTokens->face, subsetFamilyName).empty())
+        {
+            return {};
+        }
+    }
+
+    return result;
+}
+
+UsdGeomMesh usdex::core::defineOptimizedPolyMesh(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity,
+    const std::vector<TfToken>& subsetNames,
+    const std::vector<VtIntArray>& subsetIndices,
+    const TfToken& subsetFamilyName,
+    size_t cacheSize
+)
+{
+    USDEX_INSTRUMENT_SCOPE("defineOptimizedPolyMesh");
+    USDEX_INSTRUMENT_ARRAY(faceVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(faceVertexIndices);
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(uvs);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomMesh due to an invalid location: %s", reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    // Early out if the points, topology, or primvars are not valid, as they are reordered without further checks
+    if (!::validatePolyMesh(
+            path,
+            faceVertexCounts,
+            faceVertexIndices,
+            points,
+            normals.has_value() ? &normals.value() : nullptr,
+            uvs.has_value() ? &uvs.value() : nullptr,
+            displayColor.has_value() ? &displayColor.value() : nullptr,
+            displayOpacity.has_value() ? &displayOpacity.value() : nullptr,
+            &reason
+        ))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    if (cacheSize == 0)
+    {
+        USDEX_AUTHORING_ERROR(
+            path,
+            eInvalidArgument,
+            "Unable to define UsdGeomMesh at \"%s\" with a vertex cache size of zero",
+            path.GetAsString().c_str()
+        );
+        return UsdGeomMesh();
+    }
+
+    const size_t faceCount = faceVertexCounts.size();
+    if (!::validateSubsetPartition(faceCount, subsetNames, subsetIndices, &reason))
+    {
+        USDEX_AUTHORING_ERROR(path, eInvalidArgument, "Unable to define UsdGeomMesh at \"%s\" due to %s", path.GetAsString().c_str(), reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    // The reordered mesh is gathered from the original mesh as a single chunk, so the primvars are remapped in the same way as the chunks
+    const std::vector<size_t> faceOffsets = ::computeFaceOffsets(faceVertexCounts);
+    const MeshChunk order = ::computeVertexCacheOrder(faceVertexCounts, faceVertexIndices, faceOffsets, points, cacheSize);
+    std::vector<int> pointRemap(points.size());
+    for (size_t point = 0; point < order.points.size(); ++point)
+    {
+        pointRemap[order.points[point]] = static_cast<int>(point);
+    }
+
+    VtIntArray meshFaceVertexCounts(faceCount);
+    VtIntArray meshFaceVertexIndices(faceVertexIndices.size());
+    VtVec3fArray meshPoints(points.size());
+    WorkParallelForN(
+        faceCount,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t face = begin; face < end; ++face)
+            {
+                meshFaceVertexCounts[face] = faceVertexCounts[order.faces[face]];
+            }
+        },
+        s_meshChunkGrainSize
+    );
+    WorkParallelForN(
+        order.faceVertices.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t vertex = begin; vertex < end; ++vertex)
+            {
+                meshFaceVertexIndices[vertex] = pointRemap[faceVertexIndices[order.faceVertices[vertex]]];
+            }
+        },
+        s_meshChunkGrainSize
+    );
+    WorkParallelForN(
+        points.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t point = begin; point < end; ++point)
+            {
+                meshPoints[point] = points[order.points[point]];
+            }
+        },
+        s_meshChunkGrainSize
+    );
+
+    UsdGeomMesh mesh = usdex::core::definePolyMesh(
+        stage,
+        path,
+        meshFaceVertexCounts,
+        meshFaceVertexIndices,
+        meshPoints,
+        ::gatherChunkPrimvar(normals, order),
+        ::gatherChunkPrimvar(uvs, order),
+        ::gatherChunkPrimvar(displayColor, order),
+        ::gatherChunkPrimvar(displayOpacity, order)
+    );
+    if (!mesh || subsetIndices.empty())
+    {
+        return mesh;
+    }
+
+    // Remap the faces of each subset to the reordered faces, in ascending order
+    std::vector<int> faceRemap(faceCount);
+    for (size_t face = 0; face < faceCount; ++face)
+    {
+        faceRemap[order.faces[face]] = static_cast<int>(face);
+    }
+    std::vector<VtIntArray> meshSubsetIndices(subsetIndices.size());
+    for (size_t subset = 0; subset < subsetIndices.size(); ++subset)
+    {
+        VtIntArray& indices = meshSubsetIndices[subset];
+        indices.resize(subsetIndices[subset].size());
+        std::transform(subsetIndices[subset].cbegin(), subsetIndices[subset].cend(), indices.begin(), [&](int face) { return faceRemap[face]; });
+        std::sort(indices.begin(), indices.end());
+    }
+    if (usdex::core::definePartitionedSubsets(mesh, subsetNames, meshSubsetIndices, UsdGeomTokens->face, subsetFamilyName).empty())
+    {
+        return UsdGeomMesh();
+    }
+
+    return mesh;
+}
+
+UsdGeomMesh usdex::core::definePolyMeshLods(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    const std::vector<float>& faceRatios,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec2fPrimvarData> uvs,
+    float smoothingAngle
+)
+{
+    USDEX_INSTRUMENT_SCOPE("definePolyMeshLods");
+    USDEX_INSTRUMENT_ARRAY(faceVertexCounts);
+    USDEX_INSTRUMENT_ARRAY(faceVertexIndices);
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(uvs);
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomMesh LODs due to an invalid location: %s", reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    // Early out if the points, topology, or primvars are not valid, as the levels are decimated from them without further checks
+    if (!::validatePolyMesh(
+            path,
+            faceVertexCounts,
+            faceVertexIndices,
+            points,
+            normals.has_value() ? &normals.value() : nullptr,
+            uvs.has_value() ? &uvs.value() : nullptr,
+            nullptr,
+            nullptr,
+            &reason
+        ))
+    {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return UsdGeomMesh();
+    }
+
+    for (const float ratio : faceRatios)
+    {
+        if (!(ratio > 0.0f && ratio < 1.0f))
+        {
+            USDEX_AUTHORING_ERROR(
+                path,
+                eInvalidArgument,
+                "Unable to define UsdGeomMesh LODs at \"%s\" with a face ratio of %f, as face ratios must be between zero and one",
+                path.GetAsString().c_str(),
+                ratio
+            );
+            return UsdGeomMesh();
+        }
+    }
+
+    // The first level is the source mesh, and each further level is decimated from it independently of the other levels
+    size_t triangleCount = 0;
+    for (const int count : faceVertexCounts)
+    {
+        triangleCount += static_cast<size_t>(std::max(count - 2, 0));
+    }
+    std::vector<PolyMeshData> levels(faceRatios.size() + 1);
+    levels[0].faceVertexCounts = faceVertexCounts;
+    levels[0].faceVertexIndices = faceVertexIndices;
+    levels[0].points = points;
+    levels[0].normals = normals;
+    levels[0].uvs = uvs;
+    WorkParallelForN(
+        faceRatios.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const double targetFaceCount = std::ceil(static_cast<double>(faceRatios[i]) * static_cast<double>(triangleCount));
+                detail::DecimatedMesh level = detail::decimateMesh(
+                    faceVertexCounts,
+                    faceVertexIndices,
+                    points,
+                    uvs.has_value() ? &uvs.value() : nullptr,
+                    std::max<size_t>(1, static_cast<size_t>(targetFaceCount))
+                );
+
+                PolyMeshData& mesh = levels[i + 1];
+                mesh.normals = ::computeLodNormals(normals, level, smoothingAngle);
+                if (uvs.has_value())
+                {
+                    mesh.uvs = Vec2fPrimvarData(UsdGeomTokens->faceVarying, std::move(level.uvs));
+                    mesh.uvs->demoteMeshInterpolation(level.faceVertexCounts, level.faceVertexIndices, level.points.size());
+                    mesh.uvs->index();
+                }
+                mesh.faceVertexCounts = std::move(level.faceVertexCounts);
+                mesh.faceVertexIndices = std::move(level.faceVertexIndices);
+                mesh.points = std::move(level.points);
+            }
+        },
+        1
+    );
+
+    UsdGeomMesh mesh = UsdGeomMesh::Define(stage, path);
+    if (!mesh)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomMesh at \"%s\"", path.GetAsString().c_str());
+        return UsdGeomMesh();
+    }
+
+    // Each level is authored within its own variant
+    UsdVariantSet variantSet = mesh.GetPrim().GetVariantSets().AddVariantSet(s_lodVariantSetName);
+    for (size_t i = 0; i < levels.size(); ++i)
+    {
+        const std::string variantName = TfStringPrintf("LOD%zu", i);
+        if (!variantSet.AddVariant(variantName) || !variantSet.SetVariantSelection(variantName))
+        {
+            TF_RUNTIME_ERROR("Unable to add the \"%s\" variant to UsdGeomMesh at \"%s\"", variantName.c_str(), path.GetAsString().c_str());
+            return UsdGeomMesh();
+        }
+
+        UsdEditContext context(variantSet.GetVariantEditContext());
+        const PolyMeshData& data = levels[i];
+        const UsdGeomMesh level = ::authorPolyMesh(
+            stage,
+            path,
+            data.faceVertexCounts,
+            data.faceVertexIndices,
+            data.points,
+            data.normals,
+            data.uvs,
+            std::nullopt,
+            std::nullopt
+        );
+        if (!level)
+        {
+            return UsdGeomMesh();
+        }
+    }
+
+    variantSet.SetVariantSelection("LOD0");
+    return mesh;
+}
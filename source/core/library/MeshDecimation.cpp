@@ -0,0 +1,604 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "MeshDecimation.h"
+
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/sort.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+using namespace pxr;
+
+namespace
+{
+
+// Vertices, triangles, and edges are processed in parallel in batches of this size
+static constexpr size_t s_decimationGrainSize = 1 << 12;
+
+// Open boundaries are constrained by a plane perpendicular to their triangle, weighted relative to the area weighted planes of the triangles
+static constexpr double s_boundaryWeight = 100.0;
+
+// A symmetric 4x4 matrix describing the sum of the weighted squared distances from a point to a set of planes
+struct Quadric
+{
+    double a2 = 0.0;
+    double ab = 0.0;
+    double ac = 0.0;
+    double ad = 0.0;
+    double b2 = 0.0;
+    double bc = 0.0;
+    double bd = 0.0;
+    double c2 = 0.0;
+    double cd = 0.0;
+    double d2 = 0.0;
+
+    static Quadric fromPlane(const GfVec3d& normal, double d, double weight)
+    {
+        Quadric q;
+        q.a2 = normal[0] * normal[0] * weight;
+        q.ab = normal[0] * normal[1] * weight;
+        q.ac = normal[0] * normal[2] * weight;
+        q.ad = normal[0] * d * weight;
+        q.b2 = normal[1] * normal[1] * weight;
+        q.bc = normal[1] * normal[2] * weight;
+        q.bd = normal[1] * d * weight;
+        q.c2 = normal[2] * normal[2] * weight;
+        q.cd = normal[2] * d * weight;
+        q.d2 = d * d * weight;
+        return q;
+    }
+
+    Quadric& operator+=(const Quadric& other)
+    {
+        a2 += other.a2;
+        ab += other.ab;
+        ac += other.ac;
+        ad += other.ad;
+        b2 += other.b2;
+        bc += other.bc;
+        bd += other.bd;
+        c2 += other.c2;
+        cd += other.cd;
+        d2 += other.d2;
+        return *this;
+    }
+
+    double evaluate(const GfVec3d& p) const
+    {
+        const double x = p[0];
+        const double y = p[1];
+        const double z = p[2];
+        return a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x + b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y + c2 * z * z +
+               2.0 * cd * z + d2;
+    }
+};
+
+// A candidate edge collapse, which removes one vertex and moves the kept vertex to its own position or to the midpoint of the edge.
+// The stamps record the state of both vertices when the cost was computed, so that outdated candidates can be skipped.
+struct Collapse
+{
+    double cost;
+    uint32_t keep;
+    uint32_t remove;
+    uint32_t keepStamp;
+    uint32_t removeStamp;
+    bool midpoint;
+
+    // Ties are broken by vertex index so that the order of the collapses is deterministic
+    bool operator>(const Collapse& other) const
+    {
+        if (cost != other.cost)
+        {
+            return cost > other.cost;
+        }
+        if (keep != other.keep)
+        {
+            return keep > other.keep;
+        }
+        if (remove != other.remove)
+        {
+            return remove > other.remove;
+        }
+        return midpoint > other.midpoint;
+    }
+};
+
+using CollapseQueue = std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>>;
+
+class Decimator
+{
+public:
+
+    Decimator(const VtIntArray& faceVertexCounts, const VtIntArray& faceVertexIndices, const VtVec3fArray& points, const Vec2fPrimvarData* uvs)
+        : m_hasUvs(uvs != nullptr)
+    {
+        m_positions.resize(points.size());
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            m_positions[i] = GfVec3d(points[i]);
+        }
+
+        // Polygons are triangulated as fans, and the uv of each triangle corner is read from the source interpolation
+        const TfToken interpolation = m_hasUvs ? uvs->interpolation() : TfToken();
+        auto uvAt = [uvs](size_t i) -> const GfVec2f& { return uvs->hasIndices() ? uvs->values()[uvs->indices()[i]] : uvs->values()[i]; };
+        auto cornerUv = [&](size_t face, size_t faceVertex) -> GfVec2f
+        {
+            if (interpolation == UsdGeomTokens->faceVarying)
+            {
+                return uvAt(faceVertex);
+            }
+            else if (interpolation == UsdGeomTokens->vertex || interpolation == UsdGeomTokens->varying)
+            {
+                return uvAt(static_cast<size_t>(faceVertexIndices[faceVertex]));
+            }
+            else if (interpolation == UsdGeomTokens->uniform)
+            {
+                return uvAt(face);
+            }
+            return uvAt(0);
+        };
+
+        size_t offset = 0;
+        for (size_t face = 0; face < faceVertexCounts.size(); ++face)
+        {
+            const size_t count = static_cast<size_t>(faceVertexCounts[face]);
+            for (size_t i = 1; i + 1 < count; ++i)
+            {
+                const std::array<size_t, 3> corners = { offset, offset + i, offset + i + 1 };
+                std::array<uint32_t, 3> triangle;
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    triangle[c] = static_cast<uint32_t>(faceVertexIndices[corners[c]]);
+                    if (m_hasUvs)
+                    {
+                        m_cornerUvs.push_back(cornerUv(face, corners[c]));
+                    }
+                }
+                m_triangles.push_back(triangle);
+            }
+            offset += count;
+        }
+        m_deadTriangles.assign(m_triangles.size(), 0);
+        m_liveTriangles = m_triangles.size();
+
+        m_vertexTriangles.resize(m_positions.size());
+        for (size_t t = 0; t < m_triangles.size(); ++t)
+        {
+            for (const uint32_t v : m_triangles[t])
+            {
+                m_vertexTriangles[v].push_back(static_cast<uint32_t>(t));
+            }
+        }
+
+        this->computeQuadrics();
+        this->computeSeams();
+        m_removed.assign(m_positions.size(), 0);
+        m_stamps.assign(m_positions.size(), 0);
+    }
+
+    void decimate(size_t targetFaceCount)
+    {
+        if (m_liveTriangles <= targetFaceCount)
+        {
+            return;
+        }
+
+        // The initial cost of every edge is independent of the others
+        std::vector<Collapse> candidates(m_edges.size());
+        WorkParallelForN(
+            m_edges.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    candidates[i] = this->evaluate(m_edges[i].first, m_edges[i].second);
+                }
+            },
+            s_decimationGrainSize
+        );
+        candidates.erase(
+            std::remove_if(candidates.begin(), candidates.end(), [](const Collapse& c) { return c.cost == std::numeric_limits<double>::infinity(); }),
+            candidates.end()
+        );
+        CollapseQueue queue(std::greater<Collapse>(), std::move(candidates));
+
+        while (m_liveTriangles > targetFaceCount && !queue.empty())
+        {
+            const Collapse collapse = queue.top();
+            queue.pop();
+            if (this->apply(collapse))
+            {
+                this->enqueueNeighbors(collapse.keep, queue);
+            }
+        }
+    }
+
+    usdex::core::detail::DecimatedMesh getResult() const
+    {
+        usdex::core::detail::DecimatedMesh result;
+
+        // The points referenced by the remaining triangles retain their original relative order
+        std::vector<int> remap(m_positions.size(), -1);
+        for (size_t t = 0; t < m_triangles.size(); ++t)
+        {
+            if (!m_deadTriangles[t])
+            {
+                for (const uint32_t v : m_triangles[t])
+                {
+                    remap[v] = 0;
+                }
+            }
+        }
+        for (size_t v = 0; v < m_positions.size(); ++v)
+        {
+            if (remap[v] == 0)
+            {
+                remap[v] = static_cast<int>(result.points.size());
+                result.points.push_back(GfVec3f(m_positions[v]));
+            }
+        }
+
+        result.faceVertexCounts.assign(m_liveTriangles, 3);
+        result.faceVertexIndices.reserve(m_liveTriangles * 3);
+        if (m_hasUvs)
+        {
+            result.uvs.reserve(m_liveTriangles * 3);
+        }
+        for (size_t t = 0; t < m_triangles.size(); ++t)
+        {
+            if (!m_deadTriangles[t])
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    result.faceVertexIndices.push_back(remap[m_triangles[t][c]]);
+                    if (m_hasUvs)
+                    {
+                        result.uvs.push_back(m_cornerUvs[t * 3 + c]);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+
+    GfVec3d computeNormal(size_t t, uint32_t moved, const GfVec3d& position) const
+    {
+        std::array<GfVec3d, 3> p;
+        for (size_t c = 0; c < 3; ++c)
+        {
+            p[c] = (m_triangles[t][c] == moved) ? position : m_positions[m_triangles[t][c]];
+        }
+        return GfCross(p[1] - p[0], p[2] - p[0]);
+    }
+
+    bool contains(size_t t, uint32_t v) const
+    {
+        return m_triangles[t][0] == v || m_triangles[t][1] == v || m_triangles[t][2] == v;
+    }
+
+    size_t corner(size_t t, uint32_t v) const
+    {
+        return (m_triangles[t][0] == v) ? 0 : ((m_triangles[t][1] == v) ? 1 : 2);
+    }
+
+    void computeQuadrics()
+    {
+        // Each triangle contributes its plane, weighted by its area, to each of its vertices
+        std::vector<Quadric> triangleQuadrics(m_triangles.size());
+        WorkParallelForN(
+            m_triangles.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t t = begin; t < end; ++t)
+                {
+                    GfVec3d normal = this->computeNormal(t, std::numeric_limits<uint32_t>::max(), GfVec3d());
+                    const double length = normal.Normalize();
+                    if (length > 0.0)
+                    {
+                        triangleQuadrics[t] = Quadric::fromPlane(normal, -GfDot(normal, m_positions[m_triangles[t][0]]), length * 0.5);
+                    }
+                }
+            },
+            s_decimationGrainSize
+        );
+
+        m_quadrics.resize(m_positions.size());
+        WorkParallelForN(
+            m_positions.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t v = begin; v < end; ++v)
+                {
+                    for (const uint32_t t : m_vertexTriangles[v])
+                    {
+                        m_quadrics[v] += triangleQuadrics[t];
+                    }
+                }
+            },
+            s_decimationGrainSize
+        );
+
+        // Sorting the edges of every triangle groups the triangles of each edge, so that open boundaries (with a single triangle) can be found
+        std::vector<std::pair<uint64_t, uint32_t>> edgeTriangles;
+        edgeTriangles.reserve(m_triangles.size() * 3);
+        for (size_t t = 0; t < m_triangles.size(); ++t)
+        {
+            for (size_t c = 0; c < 3; ++c)
+            {
+                const uint32_t a = m_triangles[t][c];
+                const uint32_t b = m_triangles[t][(c + 1) % 3];
+                if (a != b)
+                {
+                    const uint64_t key = (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint64_t>(std::max(a, b));
+                    edgeTriangles.emplace_back(key, static_cast<uint32_t>(t));
+                }
+            }
+        }
+        WorkParallelSort(&edgeTriangles);
+
+        for (size_t begin = 0; begin < edgeTriangles.size();)
+        {
+            size_t end = begin + 1;
+            while (end < edgeTriangles.size() && edgeTriangles[end].first == edgeTriangles[begin].first)
+            {
+                ++end;
+            }
+
+            const uint32_t a = static_cast<uint32_t>(edgeTriangles[begin].first >> 32);
+            const uint32_t b = static_cast<uint32_t>(edgeTriangles[begin].first & 0xffffffff);
+            m_edges.emplace_back(a, b);
+            if (end - begin == 1)
+            {
+                const GfVec3d edge = m_positions[b] - m_positions[a];
+                GfVec3d normal = GfCross(edge, this->computeNormal(edgeTriangles[begin].second, std::numeric_limits<uint32_t>::max(), GfVec3d()));
+                if (normal.Normalize() > 0.0)
+                {
+                    const Quadric constraint = Quadric::fromPlane(normal, -GfDot(normal, m_positions[a]), edge.GetLengthSq() * s_boundaryWeight);
+                    m_quadrics[a] += constraint;
+                    m_quadrics[b] += constraint;
+                }
+            }
+            begin = end;
+        }
+    }
+
+    void computeSeams()
+    {
+        // A vertex is on a seam if its corners have differing uvs, in which case it can not be removed without distorting the uvs
+        m_seams.assign(m_positions.size(), 0);
+        if (!m_hasUvs)
+        {
+            return;
+        }
+
+        WorkParallelForN(
+            m_positions.size(),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t v = begin; v < end; ++v)
+                {
+                    const std::vector<uint32_t>& triangles = m_vertexTriangles[v];
+                    for (size_t i = 1; i < triangles.size(); ++i)
+                    {
+                        const GfVec2f& first = m_cornerUvs[triangles[0] * 3 + this->corner(triangles[0], static_cast<uint32_t>(v))];
+                        if (m_cornerUvs[triangles[i] * 3 + this->corner(triangles[i], static_cast<uint32_t>(v))] != first)
+                        {
+                            m_seams[v] = 1;
+                            break;
+                        }
+                    }
+                }
+            },
+            s_decimationGrainSize
+        );
+    }
+
+    // Find the cheapest collapse of an edge, or a collapse with an infinite cost if neither vertex can be removed
+    Collapse evaluate(uint32_t a, uint32_t b) const
+    {
+        Quadric quadric = m_quadrics[a];
+        quadric += m_quadrics[b];
+
+        Collapse best = { std::numeric_limits<double>::infinity(), a, b, m_stamps[a], m_stamps[b], false };
+        auto consider = [&](uint32_t keep, uint32_t remove, bool midpoint)
+        {
+            const GfVec3d position = midpoint ? (m_positions[keep] + m_positions[remove]) * 0.5 : m_positions[keep];
+            const Collapse candidate = { std::max(quadric.evaluate(position), 0.0), keep, remove, m_stamps[keep], m_stamps[remove], midpoint };
+            if (best > candidate)
+            {
+                best = candidate;
+            }
+        };
+        if (!m_seams[a])
+        {
+            consider(b, a, false);
+        }
+        if (!m_seams[b])
+        {
+            consider(a, b, false);
+        }
+        if (!m_seams[a] && !m_seams[b])
+        {
+            consider(std::min(a, b), std::max(a, b), true);
+        }
+        return best;
+    }
+
+    bool apply(const Collapse& collapse)
+    {
+        const uint32_t keep = collapse.keep;
+        const uint32_t remove = collapse.remove;
+        if (m_removed[keep] || m_removed[remove] || m_stamps[keep] != collapse.keepStamp || m_stamps[remove] != collapse.removeStamp)
+        {
+            return false;
+        }
+
+        const GfVec3d position = collapse.midpoint ? (m_positions[keep] + m_positions[remove]) * 0.5 : m_positions[keep];
+
+        // The collapse must not flip any of the remaining triangles whose vertices move
+        size_t shared = m_triangles.size();
+        for (const uint32_t t : m_vertexTriangles[remove])
+        {
+            if (m_deadTriangles[t])
+            {
+                continue;
+            }
+            if (this->contains(t, keep))
+            {
+                shared = std::min<size_t>(shared, t);
+            }
+            else if (this->flips(t, remove, position))
+            {
+                return false;
+            }
+        }
+        if (shared == m_triangles.size())
+        {
+            return false;
+        }
+        if (collapse.midpoint)
+        {
+            for (const uint32_t t : m_vertexTriangles[keep])
+            {
+                if (!m_deadTriangles[t] && !this->contains(t, remove) && this->flips(t, keep, position))
+                {
+                    return false;
+                }
+            }
+        }
+
+        // The removed vertex is not on a seam, so the uvs of its corners are replaced by those of the kept vertex within the same chart
+        GfVec2f uv(0.0f);
+        if (m_hasUvs)
+        {
+            uv = m_cornerUvs[shared * 3 + this->corner(shared, keep)];
+            if (collapse.midpoint)
+            {
+                uv = (uv + m_cornerUvs[shared * 3 + this->corner(shared, remove)]) * 0.5f;
+                for (const uint32_t t : m_vertexTriangles[keep])
+                {
+                    if (!m_deadTriangles[t])
+                    {
+                        m_cornerUvs[t * 3 + this->corner(t, keep)] = uv;
+                    }
+                }
+            }
+        }
+
+        std::vector<uint32_t> triangles;
+        triangles.reserve(m_vertexTriangles[keep].size() + m_vertexTriangles[remove].size());
+        for (const uint32_t t : m_vertexTriangles[remove])
+        {
+            if (m_deadTriangles[t])
+            {
+                continue;
+            }
+            if (this->contains(t, keep))
+            {
+                m_deadTriangles[t] = 1;
+                --m_liveTriangles;
+                continue;
+            }
+            const size_t c = this->corner(t, remove);
+            m_triangles[t][c] = keep;
+            if (m_hasUvs)
+            {
+                m_cornerUvs[t * 3 + c] = uv;
+            }
+            triangles.push_back(t);
+        }
+        for (const uint32_t t : m_vertexTriangles[keep])
+        {
+            if (!m_deadTriangles[t])
+            {
+                triangles.push_back(t);
+            }
+        }
+        std::sort(triangles.begin(), triangles.end());
+        m_vertexTriangles[keep] = std::move(triangles);
+        m_vertexTriangles[remove] = std::vector<uint32_t>();
+
+        m_positions[keep] = position;
+        m_quadrics[keep] += m_quadrics[remove];
+        m_removed[remove] = 1;
+        ++m_stamps[keep];
+        return true;
+    }
+
+    bool flips(size_t t, uint32_t moved, const GfVec3d& position) const
+    {
+        const GfVec3d before = this->computeNormal(t, std::numeric_limits<uint32_t>::max(), GfVec3d());
+        if (before == GfVec3d(0.0))
+        {
+            return false;
+        }
+        return GfDot(before, this->computeNormal(t, moved, position)) <= 0.0;
+    }
+
+    // The collapse costs of the edges of a vertex change whenever that vertex moves or its quadric grows
+    void enqueueNeighbors(uint32_t v, CollapseQueue& queue) const
+    {
+        std::vector<uint32_t> neighbors;
+        for (const uint32_t t : m_vertexTriangles[v])
+        {
+            for (const uint32_t n : m_triangles[t])
+            {
+                if (n != v)
+                {
+                    neighbors.push_back(n);
+                }
+            }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        for (const uint32_t n : neighbors)
+        {
+            const Collapse collapse = this->evaluate(std::min(v, n), std::max(v, n));
+            if (collapse.cost != std::numeric_limits<double>::infinity())
+            {
+                queue.push(collapse);
+            }
+        }
+    }
+
+    bool m_hasUvs;
+    size_t m_liveTriangles = 0;
+    std::vector<GfVec3d> m_positions;
+    std::vector<std::array<uint32_t, 3>> m_triangles;
+    std::vector<char> m_deadTriangles;
+    std::vector<GfVec2f> m_cornerUvs;
+    std::vector<std::vector<uint32_t>> m_vertexTriangles;
+    std::vector<Quadric> m_quadrics;
+    std::vector<std::pair<uint32_t, uint32_t>> m_edges;
+    std::vector<char> m_seams;
+    std::vector<char> m_removed;
+    std::vector<uint32_t> m_stamps;
+};
+
+} // namespace
+
+usdex::core::detail::DecimatedMesh usdex::core::detail::decimateMesh(
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    const VtVec3fArray& points,
+    const Vec2fPrimvarData* uvs,
+    size_t targetFaceCount
+)
+{
+    ::Decimator decimator(faceVertexCounts, faceVertexIndices, points, uvs);
+    decimator.decimate(targetFaceCount);
+    return decimator.getResult();
+}
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/PrimvarData.h"
+
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+
+namespace usdex::core::detail
+{
+
+//! The triangulated topology, points, and uvs of a mesh produced by `decimateMesh`.
+struct DecimatedMesh
+{
+    pxr::VtIntArray faceVertexCounts; //!< The number of vertices in each face, which is always 3
+    pxr::VtIntArray faceVertexIndices; //!< Indices of the positions from the `points` to use for each face vertex
+    pxr::VtVec3fArray points; //!< The points referenced by the faces, in their original relative order
+    pxr::VtVec2fArray uvs; //!< The faceVarying uvs of each face vertex, or empty if the source mesh has no uvs
+};
+
+//! Reduce the number of faces of a mesh via quadric error metric edge collapses.
+//!
+//! The faces are triangulated, then edges are collapsed in order of increasing error (as described by Garland & Heckbert) until no more than
+//! `targetFaceCount` triangles remain, or no edge can be collapsed without flipping a triangle. Open boundaries are weighted to preserve the
+//! silhouette of the mesh, and vertices on uv seams are never removed, so the uvs are carried to the decimated triangles without distortion.
+//!
+//! The quadrics and initial collapse costs are computed in parallel via the OpenUSD `Work` library. The collapses themselves are sequential,
+//! and ties are broken by vertex index, so the result is deterministic.
+//!
+//! The topology, points, and uvs must have been validated (e.g. as by `definePolyMesh`) prior to calling this function.
+//!
+//! @param faceVertexCounts The number of vertices in each face of the mesh
+//! @param faceVertexIndices Indices of the positions from the `points` to use for each face vertex
+//! @param points Vertex positions for the mesh described in local space
+//! @param uvs Optional uvs of the mesh, of any interpolation
+//! @param targetFaceCount The maximum number of triangles to retain
+//!
+//! @returns The decimated mesh.
+DecimatedMesh decimateMesh(
+    const pxr::VtIntArray& faceVertexCounts,
+    const pxr::VtIntArray& faceVertexIndices,
+    const pxr::VtVec3fArray& points,
+    const Vec2fPrimvarData* uvs,
+    size_t targetFaceCount
+);
+
+} // namespace usdex::core::detail
@@ -4,14 +4,27 @@
 
 #include "usdex/core/NameAlgo.h"
 
+#include "usdex/core/Settings.h"
+
+#include "Instrumentation.h"
 #include "TfUtils.h"
+#include "Transcoding.h"
 
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
 #include <pxr/usd/sdf/childrenView.h>
 #include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/sdf/spec.h>
 
+#include <algorithm>
+#include <array>
 #include <functional>
+#include <list>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace pxr;
 
@@ -23,7 +36,7 @@ TF_DEFINE_PRIVATE_TOKENS(_tokens, (error));
 struct ValidNameCache
 {
     //! Names that can not be allocated
-    TfTokenVector usedNames;
+    std::unordered_set<TfToken, TfToken::HashFunctor> usedNames;
 
     // The start index to be used for making a given name unique
     std::unordered_map<std::string, size_t> startIndices;
@@ -34,7 +47,7 @@ void reserveNames(ValidNameCache& cache, const TfTokenVector& names)
     cache.usedNames.reserve(cache.usedNames.size() + names.size());
     for (const TfToken& name : names)
     {
-        cache.usedNames.push_back(name);
+        cache.usedNames.insert(name);
     }
 }
 
@@ -78,6 +91,41 @@ void reserveChildPropertyNames(ValidNameCache& cache, const SdfPrimSpecHandle pa
     reserveNames(cache, names);
 }
 
+// Batches smaller than this are transcoded on the calling thread, as the overhead of sharding outweighs the benefit.
+static constexpr size_t s_parallelNamesThreshold = 1 << 10;
+
+static constexpr size_t s_namesGrainSize = 1 << 8;
+
+// The maximum number of decoded names cached by each range of prims processed by computeEffectiveDisplayNames
+static constexpr size_t s_decodedNameCacheSize = 1 << 10;
+
+// Make each name valid. The names are independent of one another, so large batches are transcoded in parallel.
+TfTokenVector transcodeNames(const std::vector<std::string>& names, const std::function<const std::string(const std::string&)>& getValidNameFunc)
+{
+    TfTokenVector result(names.size());
+    if (names.size() < s_parallelNamesThreshold || !WorkHasConcurrency())
+    {
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            result[i] = TfToken(getValidNameFunc(names[i]));
+        }
+        return result;
+    }
+
+    WorkParallelForN(
+        names.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                result[i] = TfToken(getValidNameFunc(names[i]));
+            }
+        },
+        s_namesGrainSize
+    );
+    return result;
+}
+
 TfTokenVector getValidNames(
     const std::vector<std::string>& names,
     std::function<const std::string(const std::string&)> getValidNameFunc,
@@ -90,34 +138,48 @@ TfTokenVector getValidNames(
         return TfTokenVector{};
     }
 
+    // Transcoding is the expensive part of the process, and does not depend on the order of the names, so it is performed up front.
+    // Only the uniqueness resolution below must be sequential, which ensures the result is identical regardless of the concurrency.
+    const TfTokenVector validNames = ::transcodeNames(names, getValidNameFunc);
+
     // Construct an appropriately sized vector to hold resulting names
     TfTokenVector result;
     result.reserve(names.size());
 
-    // When requesting large amounts of child paths for the same base name cache the index so that names are not considered multiple times
-    std::unordered_map<std::string, size_t> startIndices;
+    // Count the occurrences of each supplied name so that the names which are yet to be processed can be queried without a linear scan
+    std::unordered_map<std::string, size_t> remainingNames;
+    remainingNames.reserve(names.size());
+    for (const std::string& name : names)
+    {
+        ++remainingNames[name];
+    }
+
+    cache.usedNames.reserve(cache.usedNames.size() + names.size());
 
     for (size_t nameIndex = 0; nameIndex < names.size(); ++nameIndex)
     {
         // Keep the original name
         const std::string& originalName = names[nameIndex];
 
-        // Make the name valid before checking uniqueness
-        const std::string validName = getValidNameFunc(originalName);
+        // The current name is no longer considered to be remaining
+        --remainingNames[originalName];
+
+        // The name was made valid before checking uniqueness
+        const TfToken& validName = validNames[nameIndex];
 
         // Check if the valid name is already used. Increment a numeric suffix on the original name until an available one is found
-        std::string name = validName;
+        TfToken nameToken = validName;
         while (true)
         {
-            const TfToken& nameToken = TfToken(name);
-            if (std::find(cache.usedNames.begin(), cache.usedNames.end(), nameToken) == cache.usedNames.end())
+            if (cache.usedNames.find(nameToken) == cache.usedNames.end())
             {
                 // Avoid allocating suffixed names that exist in the list of supplied names
                 // This increases the number of cases where the requested name is returned unchanged
-                if (name == validName || std::find(names.begin() + nameIndex + 1, names.end(), name) == names.end())
+                const auto remainingIt = remainingNames.find(nameToken.GetString());
+                if (nameToken == validName || remainingIt == remainingNames.end() || remainingIt->second == 0)
                 {
                     result.push_back(nameToken);
-                    cache.usedNames.push_back(nameToken);
+                    cache.usedNames.insert(std::move(nameToken));
                     break;
                 }
             }
@@ -126,22 +188,159 @@ TfTokenVector getValidNames(
             size_t& index = cache.startIndices[originalName];
 
             index++;
-            name = getValidNameFunc(TfStringPrintf("%s_%zu", originalName.c_str(), index));
+            nameToken = TfToken(getValidNameFunc(TfStringPrintf("%s_%zu", originalName.c_str(), index)));
         }
     }
 
     return result;
 }
 
+//! A bounded, thread-safe, least recently used memo of valid names keyed by their original name.
+//!
+//! Entries are sharded by the hash of the original name, so that concurrent lookups rarely contend on the same mutex.
+//! Valid names are computed outside of the lock, so the memo never serializes transcoding or the token registry.
+class ValidNameMemo
+{
+public:
+    explicit ValidNameMemo(size_t capacity) : m_shardCapacity(std::max<size_t>(1, capacity / s_numShards))
+    {
+    }
+
+    template <typename Func>
+    TfToken get(const std::string& name, const Func& func)
+    {
+        Shard& shard = m_shards[std::hash<std::string>()(name) % s_numShards];
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.entries.find(name);
+            if (it != shard.entries.end())
+            {
+                // Move the entry to the front of the list, marking it most recently used
+                shard.order.splice(shard.order.begin(), shard.order, it->second);
+                return it->second->second;
+            }
+        }
+
+        TfToken result = func(name);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.entries.find(name) == shard.entries.end())
+        {
+            shard.order.emplace_front(name, result);
+            shard.entries.emplace(name, shard.order.begin());
+            if (shard.order.size() > m_shardCapacity)
+            {
+                shard.entries.erase(shard.order.back().first);
+                shard.order.pop_back();
+            }
+        }
+        return result;
+    }
+
+private:
+    static constexpr size_t s_numShards = 16;
+
+    using Entries = std::list<std::pair<std::string, TfToken>>;
+
+    struct Shard
+    {
+        std::mutex mutex;
+        Entries order;
+        std::unordered_map<std::string, Entries::iterator> entries;
+    };
+
+    size_t m_shardCapacity;
+    std::array<Shard, s_numShards> m_shards;
+};
+
+// The memos are process-wide and only exist when the USDEX_VALID_NAME_CACHE_SIZE setting is positive.
+// Like USDEX_ENABLE_TRANSCODING the setting is read once, so cached names always match the active transcoding behavior.
+ValidNameMemo* createValidNameMemo()
+{
+    const int size = TfGetEnvSetting(usdex::core::USDEX_VALID_NAME_CACHE_SIZE);
+    return (size > 0) ? new ValidNameMemo(static_cast<size_t>(size)) : nullptr;
+}
+
+ValidNameMemo* getValidPrimNameMemo()
+{
+    static ValidNameMemo* s_memo = createValidNameMemo();
+    return s_memo;
+}
+
+ValidNameMemo* getValidPropertyNameMemo()
+{
+    static ValidNameMemo* s_memo = createValidNameMemo();
+    return s_memo;
+}
+
+TfToken computeValidPrimName(const std::string& name)
+{
+    return TfToken(usdex::core::detail::makeValidIdentifier(name));
+}
+
+TfToken computeValidPropertyName(const std::string& name)
+{
+    // Most names are already valid, in which case no namespaces need to be transcoded
+    bool valid = true;
+    size_t start = 0;
+    while (valid)
+    {
+        const size_t end = std::min(name.find(':', start), name.size());
+        valid = usdex::core::detail::isASCIIIdentifier(std::string_view(name).substr(start, end - start));
+        if (end == name.size())
+        {
+            break;
+        }
+        start = end + 1;
+    }
+    if (valid)
+    {
+        return TfToken(name);
+    }
+
+    // Split the name based on the ":" delimiter
+    std::vector<std::string> tokens = TfStringSplit(name, ":");
+
+    // Add an empty token if the original name produced no tokens.
+    // This is most likely to occur if the incoming name was empty.
+    if (tokens.empty())
+    {
+        tokens.push_back("");
+    }
+
+    // Make each token a valid identifier using bootstring encoding, reusing a single buffer for each namespace
+    std::string result;
+    std::string validToken;
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        usdex::core::detail::makeValidIdentifier(tokens[i], validToken);
+        if (i > 0)
+        {
+            result.push_back(':');
+        }
+        result.append(validToken);
+    }
+
+    return TfToken(result);
+}
+
 } // namespace
 
 TfToken usdex::core::getValidPrimName(const std::string& name)
 {
-    return TfToken(usdex::core::detail::makeValidIdentifier(name));
+    USDEX_INSTRUMENT_SCOPE("getValidPrimName");
+
+    if (ValidNameMemo* memo = getValidPrimNameMemo())
+    {
+        return memo->get(name, computeValidPrimName);
+    }
+    return computeValidPrimName(name);
 }
 
 TfTokenVector usdex::core::getValidPrimNames(const std::vector<std::string>& names, const TfTokenVector& reservedNames)
 {
+    USDEX_INSTRUMENT_SCOPE("getValidPrimNames");
+
     ValidNameCache cache;
     reserveNames(cache, reservedNames);
     return getValidNames(names, usdex::core::getValidPrimName, cache);
@@ -149,6 +348,8 @@ TfTokenVector usdex::core::getValidPrimNames(const std::vector<std::string>& nam
 
 TfToken usdex::core::getValidChildName(const pxr::UsdPrim& prim, const std::string& name)
 {
+    USDEX_INSTRUMENT_SCOPE("getValidChildName");
+
     NameCache cache;
     cache.updatePrimNames(prim);
     TfToken result = cache.getPrimName(prim, name);
@@ -165,6 +366,8 @@ TfToken usdex::core::getValidChildName(const pxr::UsdPrim& prim, const std::stri
 
 TfTokenVector usdex::core::getValidChildNames(const UsdPrim& prim, const std::vector<std::string>& names)
 {
+    USDEX_INSTRUMENT_SCOPE("getValidChildNames");
+
     ValidNameCache cache;
     reserveChildNames(cache, prim);
     return getValidNames(names, usdex::core::getValidPrimName, cache);
@@ -235,6 +438,42 @@ public:
         return uncheckedGetPropertyNames(parent, names);
     }
 
+    template <class T>
+    bool reservePrimName(const T& parent, const TfToken& name)
+    {
+        std::string reason;
+        if (!isValidParent(parent, true, &reason))
+        {
+            TF_RUNTIME_ERROR("Unable to reserve prim name: %s", reason.c_str());
+            return false;
+        }
+
+        auto insertIt = m_primNameCache.insert(std::make_pair(getCacheKey(parent), ::ValidNameCache()));
+        if (insertIt.second)
+        {
+            reserveChildNames(insertIt.first->second, parent);
+        }
+        return insertIt.first->second.usedNames.insert(name).second;
+    }
+
+    template <class T>
+    bool reservePropertyName(const T& parent, const TfToken& name)
+    {
+        std::string reason;
+        if (!isValidParent(parent, false, &reason))
+        {
+            TF_RUNTIME_ERROR("Unable to reserve property name: %s", reason.c_str());
+            return false;
+        }
+
+        auto insertIt = m_propertyNameCache.insert(std::make_pair(getCacheKey(parent), ::ValidNameCache()));
+        if (insertIt.second)
+        {
+            reserveChildPropertyNames(insertIt.first->second, parent);
+        }
+        return insertIt.first->second.usedNames.insert(name).second;
+    }
+
     template <class T>
     void updatePrimNames(const T& parent)
     {
@@ -554,6 +793,36 @@ TfTokenVector usdex::core::NameCache::getPropertyNames(const SdfPrimSpecHandle p
     return m_impl->getPropertyNames(parent, names);
 }
 
+bool usdex::core::NameCache::reservePrimName(const SdfPath& parent, const TfToken& name)
+{
+    return m_impl->reservePrimName(parent, name);
+}
+
+bool usdex::core::NameCache::reservePrimName(const UsdPrim& parent, const TfToken& name)
+{
+    return m_impl->reservePrimName(parent, name);
+}
+
+bool usdex::core::NameCache::reservePrimName(const SdfPrimSpecHandle parent, const TfToken& name)
+{
+    return m_impl->reservePrimName(parent, name);
+}
+
+bool usdex::core::NameCache::reservePropertyName(const SdfPath& parent, const TfToken& name)
+{
+    return m_impl->reservePropertyName(parent, name);
+}
+
+bool usdex::core::NameCache::reservePropertyName(const UsdPrim& parent, const TfToken& name)
+{
+    return m_impl->reservePropertyName(parent, name);
+}
+
+bool usdex::core::NameCache::reservePropertyName(const SdfPrimSpecHandle parent, const TfToken& name)
+{
+    return m_impl->reservePropertyName(parent, name);
+}
+
 void usdex::core::NameCache::updatePrimNames(const UsdPrim& parent)
 {
     return m_impl->updatePrimNames(parent);
@@ -629,6 +898,263 @@ void usdex::core::NameCache::clear(const SdfPrimSpecHandle parent)
     return m_impl->clear(parent);
 }
 
+class usdex::core::ConcurrentNameCache::ConcurrentNameCacheImpl
+{
+public:
+
+    ConcurrentNameCacheImpl()
+    {
+    }
+
+    ~ConcurrentNameCacheImpl()
+    {
+    }
+
+    // Each shard is a NameCache guarded by its own mutex, so that requests for parents in different shards do not contend
+    struct Shard
+    {
+        std::mutex mutex;
+        NameCache cache;
+    };
+
+    // Lock the shard which owns the parent and return its cache. The cache must only be used while the lock is held.
+    template <class T>
+    NameCache& getCache(const T& parent, std::unique_lock<std::mutex>& lock)
+    {
+        Shard& shard = m_shards[SdfPath::Hash()(getShardKey(parent)) % s_numShards];
+        lock = std::unique_lock<std::mutex>(shard.mutex);
+        return shard.cache;
+    }
+
+private:
+
+    // Invalid parents are all assigned to the same shard, where the NameCache will report the appropriate error
+    static SdfPath getShardKey(const SdfPath& parent)
+    {
+        return parent;
+    }
+
+    static SdfPath getShardKey(const UsdPrim& parent)
+    {
+        return parent.IsValid() ? parent.GetPath() : SdfPath();
+    }
+
+    static SdfPath getShardKey(const SdfPrimSpecHandle parent)
+    {
+        return (parent && !parent->IsDormant()) ? parent->GetPath() : SdfPath();
+    }
+
+    static constexpr size_t s_numShards = 64;
+    std::array<Shard, s_numShards> m_shards;
+};
+
+usdex::core::ConcurrentNameCache::ConcurrentNameCache() : m_impl(new ConcurrentNameCacheImpl)
+{
+}
+
+usdex::core::ConcurrentNameCache::~ConcurrentNameCache()
+{
+    delete m_impl;
+}
+
+TfToken usdex::core::ConcurrentNameCache::getPrimName(const SdfPath& parent, const std::string& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPrimName(parent, name);
+}
+
+TfToken usdex::core::ConcurrentNameCache::getPrimName(const UsdPrim& parent, const std::string& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPrimName(parent, name);
+}
+
+TfToken usdex::core::ConcurrentNameCache::getPrimName(const SdfPrimSpecHandle parent, const std::string& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPrimName(parent, name);
+}
+
+TfTokenVector usdex::core::ConcurrentNameCache::getPrimNames(const SdfPath& parent, const std::vector<std::string>& names)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPrimNames(parent, names);
+}
+
+TfTokenVector usdex::core::ConcurrentNameCache::getPrimNames(const UsdPrim& parent, const std::vector<std::string>& names)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPrimNames(parent, names);
+}
+
+TfTokenVector usdex::core::ConcurrentNameCache::getPrimNames(const SdfPrimSpecHandle parent, const std::vector<std::string>& names)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPrimNames(parent, names);
+}
+
+TfToken usdex::core::ConcurrentNameCache::getPropertyName(const SdfPath& parent, const std::string& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPropertyName(parent, name);
+}
+
+TfToken usdex::core::ConcurrentNameCache::getPropertyName(const UsdPrim& parent, const std::string& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPropertyName(parent, name);
+}
+
+TfToken usdex::core::ConcurrentNameCache::getPropertyName(const SdfPrimSpecHandle parent, const std::string& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPropertyName(parent, name);
+}
+
+TfTokenVector usdex::core::ConcurrentNameCache::getPropertyNames(const SdfPath& parent, const std::vector<std::string>& names)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPropertyNames(parent, names);
+}
+
+TfTokenVector usdex::core::ConcurrentNameCache::getPropertyNames(const UsdPrim& parent, const std::vector<std::string>& names)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPropertyNames(parent, names);
+}
+
+TfTokenVector usdex::core::ConcurrentNameCache::getPropertyNames(const SdfPrimSpecHandle parent, const std::vector<std::string>& names)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).getPropertyNames(parent, names);
+}
+
+bool usdex::core::ConcurrentNameCache::reservePrimName(const SdfPath& parent, const TfToken& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).reservePrimName(parent, name);
+}
+
+bool usdex::core::ConcurrentNameCache::reservePrimName(const UsdPrim& parent, const TfToken& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).reservePrimName(parent, name);
+}
+
+bool usdex::core::ConcurrentNameCache::reservePrimName(const SdfPrimSpecHandle parent, const TfToken& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).reservePrimName(parent, name);
+}
+
+bool usdex::core::ConcurrentNameCache::reservePropertyName(const SdfPath& parent, const TfToken& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).reservePropertyName(parent, name);
+}
+
+bool usdex::core::ConcurrentNameCache::reservePropertyName(const UsdPrim& parent, const TfToken& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).reservePropertyName(parent, name);
+}
+
+bool usdex::core::ConcurrentNameCache::reservePropertyName(const SdfPrimSpecHandle parent, const TfToken& name)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).reservePropertyName(parent, name);
+}
+
+void usdex::core::ConcurrentNameCache::updatePrimNames(const UsdPrim& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).updatePrimNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::updatePrimNames(const SdfPrimSpecHandle parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).updatePrimNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::updatePropertyNames(const UsdPrim& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).updatePropertyNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::updatePropertyNames(const SdfPrimSpecHandle parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).updatePropertyNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::update(const UsdPrim& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).update(parent);
+}
+
+void usdex::core::ConcurrentNameCache::update(const SdfPrimSpecHandle parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).update(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clearPrimNames(const SdfPath& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clearPrimNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clearPrimNames(const UsdPrim& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clearPrimNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clearPrimNames(const SdfPrimSpecHandle parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clearPrimNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clearPropertyNames(const SdfPath& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clearPropertyNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clearPropertyNames(const UsdPrim& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clearPropertyNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clearPropertyNames(const SdfPrimSpecHandle parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clearPropertyNames(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clear(const SdfPath& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clear(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clear(const UsdPrim& parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clear(parent);
+}
+
+void usdex::core::ConcurrentNameCache::clear(const SdfPrimSpecHandle parent)
+{
+    std::unique_lock<std::mutex> lock;
+    return m_impl->getCache(parent, lock).clear(parent);
+}
+
 class usdex::core::ValidChildNameCache::CacheImpl
 {
 public:
@@ -708,30 +1234,19 @@ void usdex::core::ValidChildNameCache::clear(const UsdPrim& prim)
 
 TfToken usdex::core::getValidPropertyName(const std::string& name)
 {
-    // Split the name based on the ":" delimiter
-    std::vector<std::string> tokens = TfStringSplit(name, ":");
-
-    // Add an empty token if the original name produced no tokens.
-    // This is most likely to occur if the incoming name was empty.
-    if (tokens.empty())
-    {
-        tokens.push_back("");
-    }
+    USDEX_INSTRUMENT_SCOPE("getValidPropertyName");
 
-    // Make each token a valid identifier using bootstring encoding
-    std::vector<std::string> validTokens;
-    validTokens.reserve(tokens.size());
-    for (const std::string& token : tokens)
+    if (ValidNameMemo* memo = getValidPropertyNameMemo())
     {
-        validTokens.push_back(usdex::core::detail::makeValidIdentifier(token));
+        return memo->get(name, computeValidPropertyName);
     }
-
-    // Join the namespaces again using the ":" delimiter
-    return TfToken(TfStringJoin(validTokens, ":"));
+    return computeValidPropertyName(name);
 }
 
 TfTokenVector usdex::core::getValidPropertyNames(const std::vector<std::string>& names, const TfTokenVector& reservedNames)
 {
+    USDEX_INSTRUMENT_SCOPE("getValidPropertyNames");
+
     ValidNameCache cache;
     reserveNames(cache, reservedNames);
     return getValidNames(names, usdex::core::getValidPropertyName, cache);
@@ -806,3 +1321,59 @@ std::string usdex::core::computeEffectiveDisplayName(const UsdPrim& prim)
     // Otherwise return the prim name
     return prim.GetName().GetString();
 }
+
+std::vector<std::string> usdex::core::computeEffectiveDisplayNames(const std::vector<UsdPrim>& prims, bool decodeNames)
+{
+    USDEX_INSTRUMENT_SCOPE("computeEffectiveDisplayNames");
+
+    std::vector<std::string> result(prims.size());
+
+    auto computeRange = [&](size_t begin, size_t end)
+    {
+        // Each range caches its own decoded names, so that the ranges can be processed without synchronization
+        std::unordered_map<TfToken, std::string, TfToken::HashFunctor> decodedNames;
+        for (size_t i = begin; i < end; ++i)
+        {
+            const UsdPrim& prim = prims[i];
+            if (!prim)
+            {
+                continue;
+            }
+
+            result[i] = usdex::core::getDisplayName(prim);
+            if (!result[i].empty())
+            {
+                continue;
+            }
+
+            const TfToken& name = prim.GetName();
+            if (!decodeNames || !TfStringStartsWith(name.GetString(), "tn__"))
+            {
+                result[i] = name.GetString();
+                continue;
+            }
+
+            if (decodedNames.size() >= s_decodedNameCacheSize)
+            {
+                decodedNames.clear();
+            }
+            auto insertIt = decodedNames.try_emplace(name);
+            if (insertIt.second)
+            {
+                usdex::core::detail::decodeIdentifier(std::string_view(name.GetString()), insertIt.first->second);
+            }
+            result[i] = insertIt.first->second;
+        }
+    };
+
+    if (prims.size() < s_parallelNamesThreshold || !WorkHasConcurrency())
+    {
+        computeRange(0, prims.size());
+    }
+    else
+    {
+        WorkParallelForN(prims.size(), computeRange, s_namesGrainSize);
+    }
+
+    return result;
+}
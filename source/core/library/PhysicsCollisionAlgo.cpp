@@ -0,0 +1,637 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "usdex/core/PhysicsCollisionAlgo.h"
+
+#include "usdex/core/GprimAlgo.h"
+#include "usdex/core/MeshAlgo.h"
+#include "usdex/core/NameAlgo.h"
+#include "usdex/core/StageAlgo.h"
+#include "usdex/core/XformAlgo.h"
+
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdPhysics/collisionAPI.h>
+#include <pxr/usd/usdPhysics/meshCollisionAPI.h>
+#include <pxr/usd/usdPhysics/tokens.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace pxr;
+
+namespace
+{
+
+// A triangle of a convex hull, wound counter-clockwise when viewed from outside the hull
+struct HullFace
+{
+    uint32_t vertices[3];
+
+    // The face across each edge, where edge `i` runs from `vertices[i]` to `vertices[(i + 1) % 3]`
+    uint32_t neighbors[3];
+
+    // The plane of the face, with the normal facing out of the hull
+    GfVec3d normal;
+    double offset;
+
+    // The points which are outside of this face (and were not assigned to another face), and the furthest of them
+    std::vector<uint32_t> outside;
+    uint32_t furthest;
+    double furthestDistance;
+
+    bool visible;
+    bool deleted;
+};
+
+// An edge between the faces which are visible from a point and those which are not
+struct HorizonEdge
+{
+    uint32_t start;
+    uint32_t end;
+    uint32_t face; // the face beyond the edge, which is not visible
+};
+
+// The collision shape which approximates a mesh
+struct CollisionShape
+{
+    // The placement of an implicit shape, relative to the mesh
+    GfMatrix4d transform = GfMatrix4d(1.0);
+    double radius = 0.0;
+
+    // The triangles of a convex hull
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    VtVec3fArray points;
+
+    bool valid = false;
+};
+
+double getDistance(const HullFace& face, const GfVec3d& point)
+{
+    return GfDot(face.normal, point) - face.offset;
+}
+
+// The index of the edge of the face which runs from `start` to `end`
+uint32_t findEdge(const HullFace& face, uint32_t start, uint32_t end)
+{
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        if (face.vertices[i] == start && face.vertices[(i + 1) % 3] == end)
+        {
+            return i;
+        }
+    }
+    return std::numeric_limits<uint32_t>::max();
+}
+
+uint32_t addHullFace(const std::vector<GfVec3d>& points, uint32_t a, uint32_t b, uint32_t c, std::vector<HullFace>* faces)
+{
+    HullFace face;
+    face.vertices[0] = a;
+    face.vertices[1] = b;
+    face.vertices[2] = c;
+    face.neighbors[0] = face.neighbors[1] = face.neighbors[2] = std::numeric_limits<uint32_t>::max();
+    face.normal = GfCross(points[b] - points[a], points[c] - points[a]);
+    face.normal.Normalize();
+    face.offset = GfDot(face.normal, points[a]);
+    face.furthest = 0;
+    face.furthestDistance = 0.0;
+    face.visible = false;
+    face.deleted = false;
+    faces->push_back(std::move(face));
+    return static_cast<uint32_t>(faces->size() - 1);
+}
+
+// Assign a point to the first of the faces which it is outside of. Returns false if the point is inside all of the faces.
+bool assignOutsidePoint(const std::vector<GfVec3d>& points, uint32_t point, double tolerance, uint32_t first, std::vector<HullFace>* faces)
+{
+    for (uint32_t f = first; f < faces->size(); ++f)
+    {
+        HullFace& face = (*faces)[f];
+        if (face.deleted)
+        {
+            continue;
+        }
+        const double distance = ::getDistance(face, points[point]);
+        if (distance > tolerance)
+        {
+            face.outside.push_back(point);
+            if (distance > face.furthestDistance)
+            {
+                face.furthest = point;
+                face.furthestDistance = distance;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// Collect the faces which are visible from the eye point, starting from a visible face, and the horizon edges which bound them.
+// The recursion depth is bounded by the number of faces, which is small as the number of hull vertices is limited.
+void findHorizon(
+    const GfVec3d& eye,
+    double tolerance,
+    uint32_t faceIndex,
+    uint32_t enteredEdge,
+    std::vector<HullFace>* faces,
+    std::vector<uint32_t>* visible,
+    std::vector<HorizonEdge>* horizon
+)
+{
+    (*faces)[faceIndex].visible = true;
+    visible->push_back(faceIndex);
+    for (uint32_t k = 0; k < 3; ++k)
+    {
+        const uint32_t edge = (enteredEdge > 2) ? k : (enteredEdge + k) % 3;
+        if (edge == enteredEdge)
+        {
+            continue;
+        }
+        const HullFace& face = (*faces)[faceIndex];
+        const uint32_t start = face.vertices[edge];
+        const uint32_t end = face.vertices[(edge + 1) % 3];
+        const uint32_t neighborIndex = face.neighbors[edge];
+        const HullFace& neighbor = (*faces)[neighborIndex];
+        if (neighbor.visible)
+        {
+            continue;
+        }
+        if (::getDistance(neighbor, eye) > tolerance)
+        {
+            ::findHorizon(eye, tolerance, neighborIndex, ::findEdge(neighbor, end, start), faces, visible, horizon);
+        }
+        else
+        {
+            horizon->push_back({ start, end, neighborIndex });
+        }
+    }
+}
+
+// Compute the convex hull of the points using the quickhull algorithm, adding the furthest remaining point until all points are enclosed
+// or the hull has the maximum number of vertices. Returns false if the points are degenerate (i.e. coincident, collinear, or coplanar).
+bool computeConvexHull(const VtVec3fArray& input, size_t maxVertices, CollisionShape* shape)
+{
+    if (input.size() < 4)
+    {
+        return false;
+    }
+
+    std::vector<GfVec3d> points(input.size());
+    GfVec3d magnitude(0.0);
+    uint32_t minimum[3] = { 0, 0, 0 };
+    uint32_t maximum[3] = { 0, 0, 0 };
+    for (uint32_t i = 0; i < input.size(); ++i)
+    {
+        points[i] = GfVec3d(input[i]);
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            magnitude[axis] = std::max(magnitude[axis], std::abs(points[i][axis]));
+            if (points[i][axis] < points[minimum[axis]][axis])
+            {
+                minimum[axis] = i;
+            }
+            if (points[i][axis] > points[maximum[axis]][axis])
+            {
+                maximum[axis] = i;
+            }
+        }
+    }
+
+    // Distances within the tolerance are indistinguishable from zero, given the precision of the points
+    const double tolerance = 3.0 * std::numeric_limits<double>::epsilon() * (magnitude[0] + magnitude[1] + magnitude[2]);
+
+    // The initial tetrahedron spans the widest axis, then extends as far as possible from the line, and then from the plane
+    size_t widest = 0;
+    for (size_t axis = 1; axis < 3; ++axis)
+    {
+        if (points[maximum[axis]][axis] - points[minimum[axis]][axis] > points[maximum[widest]][widest] - points[minimum[widest]][widest])
+        {
+            widest = axis;
+        }
+    }
+    const uint32_t a = minimum[widest];
+    const uint32_t b = maximum[widest];
+    if (points[b][widest] - points[a][widest] <= tolerance)
+    {
+        return false;
+    }
+
+    const GfVec3d direction = (points[b] - points[a]).GetNormalized();
+    uint32_t c = a;
+    double furthest = 0.0;
+    for (uint32_t i = 0; i < points.size(); ++i)
+    {
+        const GfVec3d offset = points[i] - points[a];
+        const double distance = (offset - direction * GfDot(offset, direction)).GetLength();
+        if (distance > furthest)
+        {
+            c = i;
+            furthest = distance;
+        }
+    }
+    if (furthest <= tolerance)
+    {
+        return false;
+    }
+
+    const GfVec3d normal = GfCross(points[b] - points[a], points[c] - points[a]).GetNormalized();
+    uint32_t d = a;
+    furthest = 0.0;
+    for (uint32_t i = 0; i < points.size(); ++i)
+    {
+        const double distance = std::abs(GfDot(normal, points[i] - points[a]));
+        if (distance > furthest)
+        {
+            d = i;
+            furthest = distance;
+        }
+    }
+    if (furthest <= tolerance)
+    {
+        return false;
+    }
+
+    // Wind each face of the tetrahedron so that it faces away from its centroid, then connect the faces across their shared edges
+    std::vector<HullFace> faces;
+    const GfVec3d centroid = (points[a] + points[b] + points[c] + points[d]) * 0.25;
+    const uint32_t tetrahedron[4][3] = { { a, b, c }, { a, b, d }, { a, c, d }, { b, c, d } };
+    for (const uint32_t(&triangle)[3] : tetrahedron)
+    {
+        const uint32_t f = ::addHullFace(points, triangle[0], triangle[1], triangle[2], &faces);
+        if (::getDistance(faces[f], centroid) > 0.0)
+        {
+            faces.pop_back();
+            ::addHullFace(points, triangle[0], triangle[2], triangle[1], &faces);
+        }
+    }
+    for (HullFace& face : faces)
+    {
+        for (uint32_t edge = 0; edge < 3; ++edge)
+        {
+            for (uint32_t other = 0; other < faces.size(); ++other)
+            {
+                if (::findEdge(faces[other], face.vertices[(edge + 1) % 3], face.vertices[edge]) < 3)
+                {
+                    face.neighbors[edge] = other;
+                }
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < points.size(); ++i)
+    {
+        if (i != a && i != b && i != c && i != d)
+        {
+            ::assignOutsidePoint(points, i, tolerance, 0, &faces);
+        }
+    }
+
+    // Add the furthest outside point of all faces to the hull, until no points remain outside or the hull is complete
+    size_t vertexCount = 4;
+    std::vector<uint32_t> visible;
+    std::vector<HorizonEdge> horizon;
+    std::unordered_map<uint32_t, uint32_t> startingAt;
+    std::unordered_map<uint32_t, uint32_t> endingAt;
+    while (vertexCount < maxVertices)
+    {
+        uint32_t eyeFace = std::numeric_limits<uint32_t>::max();
+        for (uint32_t f = 0; f < faces.size(); ++f)
+        {
+            if (!faces[f].deleted && !faces[f].outside.empty() &&
+                (eyeFace == std::numeric_limits<uint32_t>::max() || faces[f].furthestDistance > faces[eyeFace].furthestDistance))
+            {
+                eyeFace = f;
+            }
+        }
+        if (eyeFace == std::numeric_limits<uint32_t>::max())
+        {
+            break;
+        }
+
+        const uint32_t eye = faces[eyeFace].furthest;
+        visible.clear();
+        horizon.clear();
+        ::findHorizon(points[eye], tolerance, eyeFace, std::numeric_limits<uint32_t>::max(), &faces, &visible, &horizon);
+
+        // Rounding may produce a horizon which is not a single loop. The point is then too close to the hull to be significant, so it is
+        // discarded rather than added.
+        startingAt.clear();
+        endingAt.clear();
+        bool loop = true;
+        for (const HorizonEdge& edge : horizon)
+        {
+            loop &= startingAt.emplace(edge.start, 0).second && endingAt.emplace(edge.end, 0).second;
+        }
+        for (const HorizonEdge& edge : horizon)
+        {
+            loop &= startingAt.count(edge.end) != 0;
+        }
+        if (!loop)
+        {
+            for (uint32_t f : visible)
+            {
+                faces[f].visible = false;
+            }
+            HullFace& face = faces[eyeFace];
+            face.outside.erase(std::find(face.outside.begin(), face.outside.end(), eye));
+            face.furthestDistance = 0.0;
+            for (uint32_t point : face.outside)
+            {
+                const double distance = ::getDistance(face, points[point]);
+                if (distance > face.furthestDistance)
+                {
+                    face.furthest = point;
+                    face.furthestDistance = distance;
+                }
+            }
+            continue;
+        }
+
+        // Replace the visible faces with a fan of faces from the horizon to the eye point
+        const uint32_t firstNewFace = static_cast<uint32_t>(faces.size());
+        for (const HorizonEdge& edge : horizon)
+        {
+            const uint32_t f = ::addHullFace(points, edge.start, edge.end, eye, &faces);
+            faces[f].neighbors[0] = edge.face;
+            faces[edge.face].neighbors[::findEdge(faces[edge.face], edge.end, edge.start)] = f;
+            startingAt[edge.start] = f;
+            endingAt[edge.end] = f;
+        }
+        for (uint32_t f = firstNewFace; f < faces.size(); ++f)
+        {
+            faces[f].neighbors[1] = startingAt[faces[f].vertices[1]];
+            faces[f].neighbors[2] = endingAt[faces[f].vertices[0]];
+        }
+
+        // The outside points of the visible faces are either outside of the new faces or inside the hull
+        for (uint32_t f : visible)
+        {
+            faces[f].deleted = true;
+            std::vector<uint32_t> outside = std::move(faces[f].outside);
+            for (uint32_t point : outside)
+            {
+                if (point != eye)
+                {
+                    ::assignOutsidePoint(points, point, tolerance, firstNewFace, &faces);
+                }
+            }
+        }
+        ++vertexCount;
+    }
+
+    // Collect the remaining faces, with their vertices in order of first use
+    std::unordered_map<uint32_t, int> hullVertices;
+    for (const HullFace& face : faces)
+    {
+        if (face.deleted)
+        {
+            continue;
+        }
+        shape->faceVertexCounts.push_back(3);
+        for (uint32_t vertex : face.vertices)
+        {
+            auto result = hullVertices.emplace(vertex, static_cast<int>(shape->points.size()));
+            if (result.second)
+            {
+                shape->points.push_back(input[vertex]);
+            }
+            shape->faceVertexIndices.push_back(result.first->second);
+        }
+    }
+    return true;
+}
+
+bool computeCollisionShape(const VtVec3fArray& points, usdex::core::CollisionApproximation approximation, size_t maxVertices, CollisionShape* shape)
+{
+    if (approximation == usdex::core::CollisionApproximation::eConvexHull)
+    {
+        return ::computeConvexHull(points, maxVertices, shape);
+    }
+
+    GfRange3d bounds;
+    for (const GfVec3f& point : points)
+    {
+        bounds.UnionWith(GfVec3d(point));
+    }
+    if (bounds.IsEmpty())
+    {
+        return false;
+    }
+    const GfVec3d center = bounds.GetMidpoint();
+
+    if (approximation == usdex::core::CollisionApproximation::eBoundingCube)
+    {
+        // The transform scales a unit cube to the bounds
+        const GfVec3d size = bounds.GetSize();
+        if (size[0] <= 0.0 || size[1] <= 0.0 || size[2] <= 0.0)
+        {
+            return false;
+        }
+        shape->transform = GfMatrix4d().SetScale(size) * GfMatrix4d().SetTranslate(center);
+        return true;
+    }
+
+    for (const GfVec3f& point : points)
+    {
+        shape->radius = std::max(shape->radius, (GfVec3d(point) - center).GetLength());
+    }
+    shape->transform = GfMatrix4d().SetTranslate(center);
+    return shape->radius > 0.0;
+}
+
+const char* getApproximationName(usdex::core::CollisionApproximation approximation)
+{
+    switch (approximation)
+    {
+        case usdex::core::CollisionApproximation::eBoundingCube:
+            return "bounding cube";
+        case usdex::core::CollisionApproximation::eBoundingSphere:
+            return "bounding sphere";
+        case usdex::core::CollisionApproximation::eConvexHull:
+        default:
+            return "convex hull";
+    }
+}
+
+} // namespace
+
+std::vector<UsdPrim> usdex::core::definePhysicsColliders(
+    UsdStagePtr stage,
+    const std::vector<UsdGeomMesh>& meshes,
+    CollisionApproximation approximation,
+    size_t maxHullVertices
+)
+{
+    USDEX_INSTRUMENT_SCOPE("definePhysicsColliders");
+
+    // Early out if the stage is invalid
+    if (!stage)
+    {
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidStage, "Unable to define physics colliders due to an invalid stage");
+        return {};
+    }
+
+    if (approximation == CollisionApproximation::eConvexHull && maxHullVertices < 4)
+    {
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidArgument, "Unable to define physics colliders with fewer than 4 convex hull vertices");
+        return {};
+    }
+
+    if (meshes.empty())
+    {
+        return {};
+    }
+
+    // Validate every mesh and the location of its collider before computing or authoring anything
+    bool valid = true;
+    std::unordered_set<SdfPath, SdfPath::Hash> meshPaths;
+    std::vector<SdfPath> paths(meshes.size());
+    std::vector<VtVec3fArray> points(meshes.size());
+    std::vector<GfMatrix4d> transforms(meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        const UsdGeomMesh& mesh = meshes[i];
+        const SdfPath& meshPath = mesh.GetPath();
+        if (!mesh)
+        {
+            USDEX_AUTHORING_ERROR(meshPath, eInvalidArgument, "Unable to define a physics collider for an invalid UsdGeomMesh");
+            valid = false;
+            continue;
+        }
+        if (!meshPaths.insert(meshPath).second)
+        {
+            USDEX_AUTHORING_ERROR(
+                meshPath,
+                eDuplicatePath,
+                "Unable to define a physics collider for \"%s\" due to a duplicate mesh",
+                meshPath.GetAsString().c_str()
+            );
+            valid = false;
+            continue;
+        }
+        if (!mesh.GetPointsAttr().Get(&points[i]) || points[i].empty())
+        {
+            USDEX_AUTHORING_ERROR(
+                meshPath,
+                eInvalidArgument,
+                "Unable to define a physics collider for \"%s\" as it has no points",
+                meshPath.GetAsString().c_str()
+            );
+            valid = false;
+            continue;
+        }
+
+        const UsdPrim meshPrim = mesh.GetPrim();
+        const TfToken name = usdex::core::getValidChildName(meshPrim.GetParent(), meshPrim.GetName().GetString() + "Collision");
+        paths[i] = meshPath.GetParentPath().AppendChild(name);
+        std::string reason;
+        if (name.IsEmpty() || !usdex::core::isEditablePrimLocation(stage, paths[i], &reason))
+        {
+            USDEX_AUTHORING_ERROR(
+                paths[i],
+                eInvalidLocation,
+                "Unable to define a physics collider for \"%s\" due to an invalid location: %s",
+                meshPath.GetAsString().c_str(),
+                reason.c_str()
+            );
+            valid = false;
+            continue;
+        }
+
+        bool resetsXformStack = false;
+        mesh.GetLocalTransformation(&transforms[i], &resetsXformStack, UsdTimeCode::Default());
+    }
+    if (!valid)
+    {
+        return {};
+    }
+
+    // Compute the approximations in parallel, as each depends only on the points of its own mesh
+    std::vector<CollisionShape> shapes(meshes.size());
+    WorkParallelForN(
+        meshes.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                shapes[i].valid = ::computeCollisionShape(points[i], approximation, maxHullVertices, &shapes[i]);
+            }
+        }
+    );
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        if (!shapes[i].valid)
+        {
+            const SdfPath& meshPath = meshes[i].GetPath();
+            USDEX_AUTHORING_ERROR(
+                meshPath,
+                eInvalidArgument,
+                "Unable to define a physics collider for \"%s\" as its points are degenerate for a %s",
+                meshPath.GetAsString().c_str(),
+                ::getApproximationName(approximation)
+            );
+            valid = false;
+        }
+    }
+    if (!valid)
+    {
+        return {};
+    }
+
+    std::vector<UsdPrim> result(meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        // Author the ancestors as overs, so that a content stage only holds the opinions of the colliders
+        const SdfPath parentPath = paths[i].GetParentPath();
+        if (!stage->GetPrimAtPath(parentPath))
+        {
+            stage->OverridePrim(parentPath);
+        }
+
+        const CollisionShape& shape = shapes[i];
+        UsdGeomGprim gprim;
+        if (approximation == CollisionApproximation::eConvexHull)
+        {
+            gprim = usdex::core::definePolyMesh(stage, paths[i], shape.faceVertexCounts, shape.faceVertexIndices, shape.points);
+        }
+        else if (approximation == CollisionApproximation::eBoundingCube)
+        {
+            gprim = usdex::core::defineCube(stage, paths[i], 1.0);
+        }
+        else
+        {
+            gprim = usdex::core::defineSphere(stage, paths[i], shape.radius);
+        }
+        if (!gprim)
+        {
+            // The define function has reported the failure
+            continue;
+        }
+
+        UsdPrim prim = gprim.GetPrim();
+        usdex::core::setLocalTransform(prim, shape.transform * transforms[i]);
+        gprim.CreatePurposeAttr().Set(UsdGeomTokens->guide);
+        UsdPhysicsCollisionAPI::Apply(prim);
+        if (approximation == CollisionApproximation::eConvexHull)
+        {
+            UsdPhysicsMeshCollisionAPI::Apply(prim).CreateApproximationAttr().Set(UsdPhysicsTokens->convexHull);
+        }
+        result[i] = prim;
+    }
+
+    return result;
+}
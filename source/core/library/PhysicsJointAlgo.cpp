@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -6,9 +6,16 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+#include "PrimSpecWriter.h"
+
 #include <pxr/base/gf/homogeneous.h>
 #include <pxr/base/gf/rotation.h>
 #include <pxr/base/gf/vec4f.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/schemaRegistry.h>
 #include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdPhysics/prismaticJoint.h>
 #include <pxr/usd/usdPhysics/revoluteJoint.h>
@@ -18,6 +25,7 @@
 #include <algorithm>
 #include <limits>
 #include <optional>
+#include <unordered_set>
 
 using namespace pxr;
 
@@ -172,82 +180,126 @@ std::pair<GfVec3d, GfQuatd> computeLocalTransform(
     return { localPos, localRot };
 }
 
+// The attributes which align a joint to each of its bodies.
+struct JointAlignment
+{
+    TfToken axis;
+    GfVec3f localPos0;
+    GfQuatf localRot0;
+    GfVec3f localPos1;
+    GfQuatf localRot1;
+};
+
+// Compute the alignment of a joint to each of its bodies, given the local to world transforms of the bodies.
+// The local position and rotation of a body are only meaningful if the body exists.
+JointAlignment computeJointAlignment(
+    const GfMatrix4d& body0Transform,
+    const GfMatrix4d& body1Transform,
+    const usdex::core::JointFrame& frame,
+    std::optional<GfVec3f> axis
+)
+{
+    JointAlignment result;
+    GfQuatd _orientation = frame.orientation;
+
+    if (axis.has_value())
+    {
+        // Get the axis alignment and orientation for the given axis.
+        // The third argument specifies the rotation value as the input value.
+        // The return value will be stored in the second argument as either 'X', 'Y', or 'Z'. The converted rotation value will be stored in the third
+        // argument.
+        getAxisAlignment(axis.value(), result.axis, _orientation);
+    }
+
+    // Compute the local position and rotation of body0.
+    auto [localPos0, localRot0] = computeLocalTransform(
+        body0Transform,
+        body1Transform,
+        usdex::core::JointFrame::Space::Body0,
+        frame.space,
+        frame.position,
+        _orientation
+    );
+    result.localPos0 = GfVec3f(localPos0);
+    result.localRot0 = GfQuatf(localRot0);
+
+    // Compute the local position and rotation of body1.
+    auto [localPos1, localRot1] = computeLocalTransform(
+        body1Transform,
+        body0Transform,
+        usdex::core::JointFrame::Space::Body1,
+        frame.space,
+        frame.position,
+        _orientation
+    );
+    result.localPos1 = GfVec3f(localPos1);
+    result.localRot1 = GfQuatf(localRot1);
+
+    return result;
+}
+
 // Specify basic parameters of Physics Joint.
 void setPhysicsJoint(
     UsdPhysicsJoint& joint,
     const UsdPrim& body0,
     const UsdPrim& body1,
     const usdex::core::JointFrame& frame,
+    UsdGeomXformCache& xformCache,
     std::optional<GfVec3f> axis = std::nullopt
 )
 {
-    GfQuatd _orientation = frame.orientation;
+    // Get the local to world coordinate transformation matrix for body0 and body1.
+    const GfMatrix4d body0Transform = body0 ? xformCache.GetLocalToWorldTransform(body0) : GfMatrix4d(1.0);
+    const GfMatrix4d body1Transform = body1 ? xformCache.GetLocalToWorldTransform(body1) : GfMatrix4d(1.0);
+
+    const JointAlignment alignment = computeJointAlignment(body0Transform, body1Transform, frame, axis);
 
     // Set the axis.
     if (axis.has_value())
     {
-        GfVec3f _axis = axis.value();
-
-        // Get the axis alignment and orientation for the given axis.
-        // The third argument specifies the rotation value as the input value.
-        // The return value will be stored in the second argument as either 'X', 'Y', or 'Z'. The converted rotation value will be stored in the third
-        // argument.
-        TfToken axisToken;
-        getAxisAlignment(_axis, axisToken, _orientation);
-
         UsdPhysicsRevoluteJoint revoluteJoint = UsdPhysicsRevoluteJoint(joint);
         if (revoluteJoint)
         {
-            revoluteJoint.GetAxisAttr().Set(axisToken);
+            revoluteJoint.GetAxisAttr().Set(alignment.axis);
         }
         UsdPhysicsPrismaticJoint prismaticJoint = UsdPhysicsPrismaticJoint(joint);
         if (prismaticJoint)
         {
-            prismaticJoint.GetAxisAttr().Set(axisToken);
+            prismaticJoint.GetAxisAttr().Set(alignment.axis);
         }
         UsdPhysicsSphericalJoint sphericalJoint = UsdPhysicsSphericalJoint(joint);
         if (sphericalJoint)
         {
-            sphericalJoint.GetAxisAttr().Set(axisToken);
+            sphericalJoint.GetAxisAttr().Set(alignment.axis);
         }
     }
 
-    // Get the local to world coordinate transformation matrix for body0 and body1.
-    auto xformCache = UsdGeomXformCache();
-    const GfMatrix4d body0Transform = body0 ? xformCache.GetLocalToWorldTransform(body0) : GfMatrix4d(1.0);
-    const GfMatrix4d body1Transform = body1 ? xformCache.GetLocalToWorldTransform(body1) : GfMatrix4d(1.0);
-
     if (body0)
     {
-        // Compute the local position and rotation of body0.
-        auto [localPos, localRot] = computeLocalTransform(
-            body0Transform,
-            body1Transform,
-            usdex::core::JointFrame::Space::Body0,
-            frame.space,
-            frame.position,
-            _orientation
-        );
-        joint.GetLocalPos0Attr().Set(GfVec3f(localPos));
-        joint.GetLocalRot0Attr().Set(GfQuatf(localRot));
+        joint.GetLocalPos0Attr().Set(alignment.localPos0);
+        joint.GetLocalRot0Attr().Set(alignment.localRot0);
     }
 
     if (body1)
     {
-        // Compute the local position and rotation of body1.
-        auto [localPos, localRot] = computeLocalTransform(
-            body1Transform,
-            body0Transform,
-            usdex::core::JointFrame::Space::Body1,
-            frame.space,
-            frame.position,
-            _orientation
-        );
-        joint.GetLocalPos1Attr().Set(GfVec3f(localPos));
-        joint.GetLocalRot1Attr().Set(GfQuatf(localRot));
+        joint.GetLocalPos1Attr().Set(alignment.localPos1);
+        joint.GetLocalRot1Attr().Set(alignment.localRot1);
     }
 }
 
+// Specify basic parameters of Physics Joint, computing the body transforms from scratch.
+void setPhysicsJoint(
+    UsdPhysicsJoint& joint,
+    const UsdPrim& body0,
+    const UsdPrim& body1,
+    const usdex::core::JointFrame& frame,
+    std::optional<GfVec3f> axis = std::nullopt
+)
+{
+    UsdGeomXformCache xformCache;
+    setPhysicsJoint(joint, body0, body1, frame, xformCache, axis);
+}
+
 // Validate the arguments when creating each physics joint.
 bool validatePhysicsJointArguments(
     UsdStagePtr stage,
@@ -294,6 +346,27 @@ bool validatePhysicsJointArguments(
     return true;
 }
 
+// The schema type name of each type of joint which can be defined via definePhysicsJoints.
+const TfToken& getJointTypeName(usdex::core::PhysicsJointData::Type type)
+{
+    static const TfToken s_fixed = UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsFixedJoint>();
+    static const TfToken s_revolute = UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsRevoluteJoint>();
+    static const TfToken s_prismatic = UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsPrismaticJoint>();
+    static const TfToken s_spherical = UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsSphericalJoint>();
+    switch (type)
+    {
+        case usdex::core::PhysicsJointData::Type::Revolute:
+            return s_revolute;
+        case usdex::core::PhysicsJointData::Type::Prismatic:
+            return s_prismatic;
+        case usdex::core::PhysicsJointData::Type::Spherical:
+            return s_spherical;
+        case usdex::core::PhysicsJointData::Type::Fixed:
+        default:
+            return s_fixed;
+    }
+}
+
 } // namespace
 
 UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
@@ -304,6 +377,8 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
     const usdex::core::JointFrame& frame
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePhysicsFixedJoint");
+
     // Check the arguments when creating each joint.
     std::string reason;
     if (!validatePhysicsJointArguments(stage, path, body0, body1, frame, &reason))
@@ -368,7 +443,12 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define PhysicsFixedJoint due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define PhysicsFixedJoint due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPhysicsFixedJoint();
     }
 
@@ -394,7 +474,7 @@ UsdPhysicsFixedJoint usdex::core::definePhysicsFixedJoint(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define PhysicsFixedJoint due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(prim.GetPath(), eInvalidLocation, "Unable to define PhysicsFixedJoint due to an invalid location: %s", reason.c_str());
         return UsdPhysicsFixedJoint();
     }
 
@@ -414,6 +494,8 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
     std::optional<float> upperLimit
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePhysicsRevoluteJoint");
+
     // Check the arguments when creating each joint.
     std::string reason;
     if (!validatePhysicsJointArguments(stage, path, body0, body1, frame, &reason))
@@ -490,7 +572,12 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define PhysicsRevoluteJoint due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define PhysicsRevoluteJoint due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPhysicsRevoluteJoint();
     }
 
@@ -519,7 +606,12 @@ UsdPhysicsRevoluteJoint usdex::core::definePhysicsRevoluteJoint(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define PhysicsRevoluteJoint due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            prim.GetPath(),
+            eInvalidLocation,
+            "Unable to define PhysicsRevoluteJoint due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPhysicsRevoluteJoint();
     }
 
@@ -539,6 +631,8 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
     std::optional<float> upperLimit
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePhysicsPrismaticJoint");
+
     // Check the arguments when creating each joint.
     std::string reason;
     if (!validatePhysicsJointArguments(stage, path, body0, body1, frame, &reason))
@@ -615,7 +709,12 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define PhysicsPrismaticJoint due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define PhysicsPrismaticJoint due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPhysicsPrismaticJoint();
     }
 
@@ -644,7 +743,12 @@ UsdPhysicsPrismaticJoint usdex::core::definePhysicsPrismaticJoint(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define PhysicsPrismaticJoint due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            prim.GetPath(),
+            eInvalidLocation,
+            "Unable to define PhysicsPrismaticJoint due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPhysicsPrismaticJoint();
     }
 
@@ -664,6 +768,8 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
     std::optional<float> coneAngle1Limit
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePhysicsSphericalJoint");
+
     // Check the arguments when creating each joint.
     std::string reason;
     if (!validatePhysicsJointArguments(stage, path, body0, body1, frame, &reason))
@@ -740,7 +846,12 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define PhysicsSphericalJoint due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define PhysicsSphericalJoint due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPhysicsSphericalJoint();
     }
 
@@ -769,7 +880,12 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(prim, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define PhysicsSphericalJoint due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            prim.GetPath(),
+            eInvalidLocation,
+            "Unable to define PhysicsSphericalJoint due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdPhysicsSphericalJoint();
     }
 
@@ -779,6 +895,12 @@ UsdPhysicsSphericalJoint usdex::core::definePhysicsSphericalJoint(
 }
 
 void usdex::core::alignPhysicsJoint(UsdPhysicsJoint joint, const usdex::core::JointFrame& frame, const GfVec3f& axis)
+{
+    UsdGeomXformCache xformCache;
+    alignPhysicsJoint(joint, frame, axis, xformCache);
+}
+
+void usdex::core::alignPhysicsJoint(UsdPhysicsJoint joint, const usdex::core::JointFrame& frame, const GfVec3f& axis, UsdGeomXformCache& xformCache)
 {
     // Get body0 and body1 assigned from the joint.
     SdfPathVector body0Targets, body1Targets;
@@ -807,7 +929,7 @@ void usdex::core::alignPhysicsJoint(UsdPhysicsJoint joint, const usdex::core::Jo
     }
 
     // Set the physics joint.
-    setPhysicsJoint(joint, body0, body1, frame, axis);
+    setPhysicsJoint(joint, body0, body1, frame, xformCache, axis);
 }
 
 void usdex::core::connectPhysicsJoint(
@@ -817,6 +939,19 @@ void usdex::core::connectPhysicsJoint(
     const usdex::core::JointFrame& frame,
     const GfVec3f& axis
 )
+{
+    UsdGeomXformCache xformCache;
+    connectPhysicsJoint(joint, body0, body1, frame, axis, xformCache);
+}
+
+void usdex::core::connectPhysicsJoint(
+    UsdPhysicsJoint joint,
+    const pxr::UsdPrim& body0,
+    const pxr::UsdPrim& body1,
+    const usdex::core::JointFrame& frame,
+    const GfVec3f& axis,
+    UsdGeomXformCache& xformCache
+)
 {
     if (!body0 && frame.space == usdex::core::JointFrame::Space::Body0)
     {
@@ -875,5 +1010,151 @@ void usdex::core::connectPhysicsJoint(
     }
 
     // Set the physics joint.
-    setPhysicsJoint(joint, body0, body1, frame, axis);
+    setPhysicsJoint(joint, body0, body1, frame, xformCache, axis);
+}
+
+std::vector<UsdPhysicsJoint> usdex::core::definePhysicsJoints(UsdStagePtr stage, const std::vector<PhysicsJointData>& joints)
+{
+    USDEX_INSTRUMENT_SCOPE("definePhysicsJoints");
+
+    // Early out if the stage is invalid
+    if (!stage)
+    {
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidStage, "Unable to define PhysicsJoints due to an invalid stage");
+        return {};
+    }
+
+    if (joints.empty())
+    {
+        return {};
+    }
+
+    // Validate every joint before authoring any scene description, and ensure each path is only defined once per batch
+    SdfPathVector jointPaths;
+    jointPaths.reserve(joints.size());
+    std::vector<std::string> errors(joints.size());
+    for (size_t i = 0; i < joints.size(); ++i)
+    {
+        const PhysicsJointData& joint = joints[i];
+        jointPaths.push_back(joint.path);
+        std::string reason;
+        if (!validatePhysicsJointArguments(stage, joint.path, joint.body0, joint.body1, joint.frame, &reason))
+        {
+            errors[i] = TfStringPrintf(
+                "Unable to define %s at \"%s\": %s",
+                ::getJointTypeName(joint.type).GetText(),
+                joint.path.GetAsString().c_str(),
+                reason.c_str()
+            );
+        }
+    }
+    std::unordered_set<SdfPath, SdfPath::Hash> paths;
+    if (!usdex::core::detail::validateBatchLocations(
+            TF_CALL_CONTEXT,
+            stage,
+            jointPaths,
+            [&joints](size_t i)
+            {
+                return ::getJointTypeName(joints[i].type).GetText();
+            },
+            &paths,
+            &errors
+        ))
+    {
+        return {};
+    }
+
+    // Compute the alignment of every joint before authoring, while the stage is fully composed.
+    // The cache is shared by all joints, so the transform of each body (and of its ancestors) is only computed once.
+    UsdGeomXformCache xformCache;
+    std::vector<JointAlignment> alignments;
+    alignments.reserve(joints.size());
+    for (const PhysicsJointData& joint : joints)
+    {
+        const GfMatrix4d body0Transform = joint.body0 ? xformCache.GetLocalToWorldTransform(joint.body0) : GfMatrix4d(1.0);
+        const GfMatrix4d body1Transform = joint.body1 ? xformCache.GetLocalToWorldTransform(joint.body1) : GfMatrix4d(1.0);
+        const bool hasAxis = joint.type != PhysicsJointData::Type::Fixed;
+        alignments.push_back(
+            ::computeJointAlignment(body0Transform, body1Transform, joint.frame, hasAxis ? std::optional<GfVec3f>(joint.axis) : std::nullopt)
+        );
+    }
+
+    // Author all of the joints directly in the edit target layer, so that change processing occurs once for the entire batch
+    {
+        SdfChangeBlock changeBlock;
+
+        usdex::core::detail::defineUndefinedAncestors(stage, paths);
+
+        for (size_t i = 0; i < joints.size(); ++i)
+        {
+            const PhysicsJointData& joint = joints[i];
+            const JointAlignment& alignment = alignments[i];
+            const TfToken& typeName = ::getJointTypeName(joint.type);
+
+            usdex::core::detail::PrimSpecWriter writer(stage, joint.path, typeName);
+            if (!writer.isValid())
+            {
+                TF_RUNTIME_ERROR("Unable to define %s at \"%s\"", typeName.GetText(), joint.path.GetAsString().c_str());
+                continue;
+            }
+
+            // Specifies the bodies to be connected to the joint.
+            if (joint.body0)
+            {
+                writer.setRelationshipTargets(UsdPhysicsTokens->physicsBody0, { joint.body0.GetPath() });
+                writer.setAttribute(UsdPhysicsTokens->physicsLocalPos0, VtValue(alignment.localPos0));
+                writer.setAttribute(UsdPhysicsTokens->physicsLocalRot0, VtValue(alignment.localRot0));
+            }
+            if (joint.body1)
+            {
+                writer.setRelationshipTargets(UsdPhysicsTokens->physicsBody1, { joint.body1.GetPath() });
+                writer.setAttribute(UsdPhysicsTokens->physicsLocalPos1, VtValue(alignment.localPos1));
+                writer.setAttribute(UsdPhysicsTokens->physicsLocalRot1, VtValue(alignment.localRot1));
+            }
+
+            if (joint.type == PhysicsJointData::Type::Fixed)
+            {
+                continue;
+            }
+            writer.setAttribute(UsdPhysicsTokens->physicsAxis, VtValue(alignment.axis));
+
+            if (joint.type == PhysicsJointData::Type::Spherical)
+            {
+                if (joint.coneAngle0Limit.has_value())
+                {
+                    writer.setAttribute(UsdPhysicsTokens->physicsConeAngle0Limit, VtValue(joint.coneAngle0Limit.value()));
+                }
+                if (joint.coneAngle1Limit.has_value())
+                {
+                    writer.setAttribute(UsdPhysicsTokens->physicsConeAngle1Limit, VtValue(joint.coneAngle1Limit.value()));
+                }
+            }
+            else
+            {
+                if (joint.lowerLimit.has_value())
+                {
+                    writer.setAttribute(UsdPhysicsTokens->physicsLowerLimit, VtValue(joint.lowerLimit.value()));
+                }
+                if (joint.upperLimit.has_value())
+                {
+                    writer.setAttribute(UsdPhysicsTokens->physicsUpperLimit, VtValue(joint.upperLimit.value()));
+                }
+            }
+        }
+    }
+
+    // The stage has recomposed once the change block has closed, so the schemas can now be constructed
+    std::vector<UsdPhysicsJoint> result;
+    result.reserve(joints.size());
+    for (const PhysicsJointData& joint : joints)
+    {
+        UsdPhysicsJoint physicsJoint(stage->GetPrimAtPath(joint.path));
+        if (!physicsJoint)
+        {
+            TF_RUNTIME_ERROR("Unable to define %s at \"%s\"", ::getJointTypeName(joint.type).GetText(), joint.path.GetAsString().c_str());
+        }
+        result.push_back(physicsJoint);
+    }
+
+    return result;
 }
@@ -6,8 +6,14 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+#include "MaterialBinding.h"
+
+#include <pxr/base/vt/dictionary.h>
 #include <pxr/usd/usdPhysics/materialAPI.h>
 #include <pxr/usd/usdPhysics/tokens.h>
+#include <pxr/usd/usd/schemaRegistry.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 
 #include <optional>
@@ -23,11 +29,13 @@ UsdShadeMaterial usdex::core::definePhysicsMaterial(
     const std::optional<float> density
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePhysicsMaterial");
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
         return UsdShadeMaterial();
     }
 
@@ -65,7 +73,12 @@ UsdShadeMaterial usdex::core::definePhysicsMaterial(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdShadeMaterial due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdShadeMaterial();
     }
 
@@ -93,6 +106,50 @@ UsdShadeMaterial usdex::core::definePhysicsMaterial(
     return usdex::core::definePhysicsMaterial(stage, path, dynamicFriction, staticFriction, restitution, density);
 }
 
+UsdShadeMaterial usdex::core::definePhysicsMaterial(
+    MaterialRegistry& registry,
+    const std::string& name,
+    const float dynamicFriction,
+    const std::optional<float> staticFriction,
+    const std::optional<float> restitution,
+    const std::optional<float> density
+)
+{
+    // Only the authored parameters are part of the key, as an unauthored parameter differs from one authored with its fallback value
+    VtDictionary key{
+        { "type", VtValue(UsdSchemaRegistry::GetSchemaTypeName<UsdPhysicsMaterialAPI>()) },
+        { "dynamicFriction", VtValue(dynamicFriction) },
+    };
+    if (staticFriction.has_value())
+    {
+        key["staticFriction"] = VtValue(staticFriction.value());
+    }
+    if (restitution.has_value())
+    {
+        key["restitution"] = VtValue(restitution.value());
+    }
+    if (density.has_value())
+    {
+        key["density"] = VtValue(density.value());
+    }
+
+    return registry.defineMaterial(
+        name,
+        key,
+        [=](UsdPrim parent, const std::string& childName)
+        {
+            UsdShadeMaterial material = usdex::core::definePhysicsMaterial(parent, childName, dynamicFriction, staticFriction, restitution, density);
+            const SdfPath path = parent.GetPath().AppendChild(TfToken(childName));
+            if (!material && parent.GetStage()->GetPrimAtPath(path))
+            {
+                // Remove the partially authored material, so that it is not mistaken for a registered material
+                parent.GetStage()->RemovePrim(path);
+            }
+            return material;
+        }
+    );
+}
+
 bool usdex::core::addPhysicsToMaterial(
     UsdShadeMaterial& material,
     const float dynamicFriction,
@@ -161,3 +218,16 @@ bool usdex::core::bindPhysicsMaterial(UsdPrim prim, const UsdShadeMaterial& mate
 
     return true;
 }
+
+bool usdex::core::bindPhysicsMaterials(const std::vector<UsdPrim>& prims, const std::vector<UsdShadeMaterial>& materials, bool collapseToAncestors)
+{
+    USDEX_INSTRUMENT_SCOPE("bindPhysicsMaterials");
+
+    std::string reason;
+    if (!usdex::core::detail::bindMaterials(prims, materials, TfToken("physics"), collapseToAncestors, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to bind physics materials: %s", reason.c_str());
+        return false;
+    }
+    return true;
+}
@@ -1,16 +1,44 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
 #include "usdex/core/PointsAlgo.h"
 
+#include "usdex/core/AssetStructure.h"
+#include "usdex/core/ExtentAlgo.h"
+#include "usdex/core/LayerAlgo.h"
 #include "usdex/core/StageAlgo.h"
+#include "usdex/core/XformAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Debug.h"
+#include "Instrumentation.h"
+#include "PrimSpecWriter.h"
+
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/range3f.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/layerOffset.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usdGeom/metrics.h>
+#include <pxr/usd/usdGeom/modelAPI.h>
 #include <pxr/usd/usdGeom/points.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformOp.h>
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
 #include <numeric>
+#include <unordered_map>
 
 using namespace usdex::core;
 using namespace pxr;
@@ -18,6 +46,13 @@ using namespace pxr;
 namespace
 {
 
+TF_DEFINE_PRIVATE_TOKENS(
+    _tokens,
+    (dequantize)
+    (displayColor)
+    (displayOpacity)
+);
+
 // Validate the interpolation given the topology information
 template <typename T>
 bool validatePrimvarInterpolation(const PrimvarData<T>& primvar, const TfTokenVector& interpolations, const VtArray<GfVec3f>& points)
@@ -77,6 +112,41 @@ bool validatePrimvar(const PrimvarData<T>& primvar, const TfTokenVector& interpo
     return true;
 }
 
+// The name of the translate op which restores quantized points to their original location
+const TfToken& getDequantizeOpName()
+{
+    static const TfToken s_opName = UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeTranslate, _tokens->dequantize);
+    return s_opName;
+}
+
+// The xformOpOrder of the prim at the path once the dequantizing translate op is appended or removed, or none if it is unchanged.
+// The translate op is applied to the points before any existing xform ops, so the existing local transform of the prim is retained.
+std::optional<VtTokenArray> getDequantizedXformOpOrder(UsdStagePtr stage, const SdfPath& path, bool translate)
+{
+    const TfToken& opName = ::getDequantizeOpName();
+    VtTokenArray xformOpOrder;
+    if (UsdPrim prim = stage->GetPrimAtPath(path))
+    {
+        prim.GetAttribute(UsdGeomTokens->xformOpOrder).Get(&xformOpOrder);
+    }
+
+    const bool hasOp = std::find(xformOpOrder.cbegin(), xformOpOrder.cend(), opName) != xformOpOrder.cend();
+    if (!translate && !hasOp)
+    {
+        return std::nullopt;
+    }
+
+    // Any translate op authored by a previous definition is replaced, so that re-defining a point cloud does not accumulate translations
+    VtTokenArray result;
+    result.reserve(xformOpOrder.size() + 1);
+    std::copy_if(xformOpOrder.cbegin(), xformOpOrder.cend(), std::back_inserter(result), [&opName](const TfToken& op) { return op != opName; });
+    if (translate)
+    {
+        result.push_back(opName);
+    }
+    return result;
+}
+
 UsdGeomPoints definePointCloudImpl(
     UsdStagePtr stage,
     const SdfPath& path,
@@ -85,7 +155,8 @@ UsdGeomPoints definePointCloudImpl(
     std::optional<const FloatPrimvarData> widths,
     std::optional<const Vec3fPrimvarData> normals,
     std::optional<const Vec3fPrimvarData> displayColor,
-    std::optional<const FloatPrimvarData> displayOpacity
+    std::optional<const FloatPrimvarData> displayOpacity,
+    const GfVec3d* translation = nullptr
 )
 {
     std::string reason;
@@ -109,7 +180,7 @@ UsdGeomPoints definePointCloudImpl(
         return UsdGeomPoints();
     }
 
-    static TfTokenVector s_validInterpolations = { UsdGeomTokens->constant, UsdGeomTokens->vertex };
+    static const TfTokenVector s_validInterpolations = { UsdGeomTokens->constant, UsdGeomTokens->vertex };
 
     if (widths.has_value())
     {
@@ -123,7 +194,7 @@ UsdGeomPoints definePointCloudImpl(
     // Early out if normals were specified but not valid
     if (normals.has_value())
     {
-        static TfTokenVector s_validNormalsInterpolations = { UsdGeomTokens->vertex };
+        static const TfTokenVector s_validNormalsInterpolations = { UsdGeomTokens->vertex };
         if (!::validatePrimvar(normals.value(), s_validNormalsInterpolations, points, &reason))
         {
             TF_RUNTIME_ERROR("Unable to define UsdGeomPoints at \"%s\" due to invalid normals: %s", path.GetAsString().c_str(), reason.c_str());
@@ -155,6 +226,48 @@ UsdGeomPoints definePointCloudImpl(
         }
     }
 
+    const std::optional<VtTokenArray> xformOpOrder = ::getDequantizedXformOpOrder(stage, path, translation != nullptr);
+
+    // Author the specs directly to the edit target layer
+    if (BulkAuthoringScope::isActive(stage))
+    {
+        return detail::defineWithSpecs<UsdGeomPoints>(
+            stage,
+            path,
+            [&](detail::PrimSpecWriter& writer)
+            {
+                writer.setAttribute(UsdGeomTokens->points, VtValue(points));
+                writer.setAttribute(UsdGeomTokens->ids, ids.has_value() ? VtValue(ids.value()) : VtValue(SdfValueBlock()));
+                if (widths.has_value())
+                {
+                    writer.setPrimvar(UsdGeomTokens->widths, SdfValueTypeNames->FloatArray, widths.value());
+                }
+                if (normals.has_value())
+                {
+                    writer.setPrimvar(UsdGeomTokens->normals, SdfValueTypeNames->Normal3fArray, normals.value());
+                }
+                if (displayColor.has_value())
+                {
+                    writer.setPrimvar(_tokens->displayColor, SdfValueTypeNames->Color3fArray, displayColor.value());
+                }
+                if (displayOpacity.has_value())
+                {
+                    writer.setPrimvar(_tokens->displayOpacity, SdfValueTypeNames->FloatArray, displayOpacity.value());
+                }
+                const VtVec3fArray extent = widths.has_value() ? computePointsExtent(points, widths.value()) : computePointsExtent(points);
+                writer.setAttribute(UsdGeomTokens->extent, VtValue(extent));
+                if (translation)
+                {
+                    writer.setAttribute(::getDequantizeOpName(), SdfValueTypeNames->Double3, SdfVariabilityVarying, VtValue(*translation));
+                }
+                if (xformOpOrder)
+                {
+                    writer.setAttribute(UsdGeomTokens->xformOpOrder, VtValue(*xformOpOrder));
+                }
+            }
+        );
+    }
+
     UsdGeomPoints pointCloud = UsdGeomPoints::Define(stage, path);
     if (!pointCloud)
     {
@@ -168,10 +281,14 @@ UsdGeomPoints definePointCloudImpl(
     prim.SetTypeName(prim.GetTypeName());
 
     // Author opinions on Points topology attributes
-    pointCloud.CreatePointsAttr().Set(points);
+    UsdAttribute pointsAttr = pointCloud.CreatePointsAttr();
+    pointsAttr.Set(points);
+    detail::verifySharedArray(pointsAttr, points);
     if (ids.has_value())
     {
-        pointCloud.CreateIdsAttr().Set(ids.value());
+        UsdAttribute idsAttr = pointCloud.CreateIdsAttr();
+        idsAttr.Set(ids.value());
+        detail::verifySharedArray(idsAttr, ids.value());
     }
     else
     {
@@ -189,6 +306,7 @@ UsdGeomPoints definePointCloudImpl(
         {
             TF_WARN("Failed to set widths primvar for UsdGeomPoints at \"%s\"", path.GetAsString().c_str());
         }
+        detail::verifySharedPrimvar(primvar, widths.value());
     }
 
     // Optionally author normals
@@ -202,6 +320,7 @@ UsdGeomPoints definePointCloudImpl(
         {
             TF_WARN("Failed to set normals primvar for UsdGeomPoints at \"%s\"", path.GetAsString().c_str());
         }
+        detail::verifySharedPrimvar(primvar, normals.value());
     }
 
     // Optionally author display color
@@ -212,6 +331,7 @@ UsdGeomPoints definePointCloudImpl(
         {
             TF_WARN("Failed to set display color primvar for UsdGeomPoints at \"%s\"", path.GetAsString().c_str());
         }
+        detail::verifySharedPrimvar(primvar, displayColor.value());
     }
 
     // Optionally author display opacity
@@ -222,20 +342,132 @@ UsdGeomPoints definePointCloudImpl(
         {
             TF_WARN("Failed to set display opacity primvar for UsdGeomPoints at \"%s\"", path.GetAsString().c_str());
         }
+        detail::verifySharedPrimvar(primvar, displayOpacity.value());
     }
 
-    // Compute an extent for the schema so there is a guarantee that the extent will be correct and authored in all cases.
-    VtArray<GfVec3f> extent;
-    if (!UsdGeomBoundable::ComputeExtentFromPlugins(pointCloud, UsdTimeCode::Default(), &extent))
+    // Compute an extent from the points and widths so there is a guarantee that the extent will be correct and authored in all cases.
+    const VtVec3fArray extent = widths.has_value() ? computePointsExtent(points, widths.value()) : computePointsExtent(points);
+    pointCloud.CreateExtentAttr().Set(extent);
+
+    // Optionally author the translation which restores quantized points to their original location
+    if (translation)
     {
-        // fallback to basic extents
-        UsdGeomPointBased::ComputeExtent(points, &extent);
+        prim.CreateAttribute(::getDequantizeOpName(), SdfValueTypeNames->Double3, false, SdfVariabilityVarying).Set(*translation);
+    }
+    if (xformOpOrder)
+    {
+        pointCloud.CreateXformOpOrderAttr().Set(*xformOpOrder);
     }
-    pointCloud.CreateExtentAttr().Set(extent);
 
     return pointCloud;
 }
 
+// Quantized points are processed in parallel in batches of this size
+static constexpr size_t s_quantizationGrainSize = 1 << 14;
+
+// Snap the points to a grid of cells across their finite bounds, and offset them by the center of the bounds
+VtVec3fArray quantizePoints(const VtVec3fArray& points, int bits, GfVec3d* center)
+{
+    GfRange3d range;
+    for (const GfVec3f& point : points)
+    {
+        if (std::isfinite(point[0]) && std::isfinite(point[1]) && std::isfinite(point[2]))
+        {
+            range.UnionWith(GfVec3d(point));
+        }
+    }
+    if (range.IsEmpty())
+    {
+        *center = GfVec3d(0.0);
+        return points;
+    }
+
+    *center = range.GetMidpoint();
+    const GfVec3d& min = range.GetMin();
+    const GfVec3d step = range.GetSize() / (std::ldexp(1.0, std::min(bits, 30)) - 1.0);
+    VtVec3fArray result(points.size());
+    WorkParallelForN(
+        points.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    const double value = points[i][c];
+                    const bool snap = step[c] > 0.0 && std::isfinite(value);
+                    const double snapped = snap ? min[c] + std::round((value - min[c]) / step[c]) * step[c] : value;
+                    result[i][c] = static_cast<float>(snapped - (*center)[c]);
+                }
+            }
+        },
+        s_quantizationGrainSize
+    );
+    return result;
+}
+
+// Merge the values of a primvar which are equal to a number of significant bits
+template <typename T>
+std::optional<PrimvarData<T>> quantizePrimvar(std::optional<PrimvarData<T>> primvar, int precision)
+{
+    if (precision > 0 && primvar.has_value() && primvar->elementSize() <= 1 && primvar->isValid())
+    {
+        primvar->indexWithPrecision(precision);
+    }
+    return primvar;
+}
+
+// The largest difference between the components of two values
+double computeValueError(float a, float b)
+{
+    return std::abs(static_cast<double>(a) - static_cast<double>(b));
+}
+
+double computeValueError(const GfVec3f& a, const GfVec3f& b)
+{
+    return std::max({ computeValueError(a[0], b[0]), computeValueError(a[1], b[1]), computeValueError(a[2], b[2]) });
+}
+
+// The largest difference between the values of each point of a source primvar and an authored primvar
+template <typename T>
+double computePrimvarError(const std::optional<const PrimvarData<T>>& source, const UsdGeomPrimvar& primvar, size_t pointCount, UsdTimeCode time)
+{
+    if (!source.has_value())
+    {
+        return 0.0;
+    }
+
+    const PrimvarData<T> authored = PrimvarData<T>::getPrimvarData(primvar, time);
+    if (!source->isValid() || !authored.isValid() || source->elementSize() > 1 || authored.elementSize() > 1)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    // Constant values are compared as a single value, and other interpolations are compared per point
+    auto valueAt = [](const PrimvarData<T>& data, size_t i) -> const T&
+    {
+        const size_t element = (data.interpolation() == UsdGeomTokens->constant) ? 0 : i;
+        return data.hasIndices() ? data.values()[data.indices()[element]] : data.values()[element];
+    };
+    auto matchesPoints = [pointCount](const PrimvarData<T>& data)
+    {
+        return data.interpolation() == UsdGeomTokens->constant || data.effectiveSize() == pointCount;
+    };
+    if (!matchesPoints(source.value()) || !matchesPoints(authored))
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    const bool constant = source->interpolation() == UsdGeomTokens->constant && authored.interpolation() == UsdGeomTokens->constant;
+    const size_t count = constant ? 1 : pointCount;
+
+    double error = 0.0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        error = std::max(error, ::computeValueError(valueAt(source.value(), i), valueAt(authored, i)));
+    }
+    return error;
+}
+
 } // namespace
 
 UsdGeomPoints usdex::core::definePointCloud(
@@ -249,11 +481,19 @@ UsdGeomPoints usdex::core::definePointCloud(
     std::optional<const FloatPrimvarData> displayOpacity
 )
 {
+    USDEX_INSTRUMENT_SCOPE("definePointCloud");
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_ARRAY(ids);
+    USDEX_INSTRUMENT_PRIMVAR(widths);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomPoints due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomPoints due to an invalid location: %s", reason.c_str());
         return UsdGeomPoints();
     }
 
@@ -275,7 +515,12 @@ UsdGeomPoints usdex::core::definePointCloud(
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomPoints due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomPoints due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomPoints();
     }
 
@@ -317,3 +562,888 @@ UsdGeomPoints usdex::core::definePointCloud(
     const SdfPath& path = prim.GetPath();
     return ::definePointCloudImpl(stage, path, points, std::nullopt, widths, normals, displayColor, displayOpacity);
 }
+
+UsdGeomPoints usdex::core::definePointCloud(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const VtVec3fArray& points,
+    const PointCloudQuantization& quantization,
+    std::optional<const VtInt64Array> ids,
+    std::optional<const FloatPrimvarData> widths,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    USDEX_INSTRUMENT_SCOPE("definePointCloud");
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_ARRAY(ids);
+    USDEX_INSTRUMENT_PRIMVAR(widths);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+    {
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomPoints due to an invalid location: %s", reason.c_str());
+        return UsdGeomPoints();
+    }
+
+    // The quantized points are authored relative to the center of their bounds, which is restored by the translation of the prim
+    GfVec3d translation(0.0);
+    const bool snapPoints = quantization.positionBits > 0;
+    return ::definePointCloudImpl(
+        stage,
+        path,
+        snapPoints ? ::quantizePoints(points, quantization.positionBits, &translation) : points,
+        ids,
+        ::quantizePrimvar<float>(widths, quantization.precision),
+        ::quantizePrimvar<GfVec3f>(normals, quantization.precision),
+        ::quantizePrimvar<GfVec3f>(displayColor, quantization.precision),
+        ::quantizePrimvar<float>(displayOpacity, quantization.precision),
+        snapPoints ? &translation : nullptr
+    );
+}
+
+PointCloudQuantizationReport usdex::core::computePointCloudQuantizationReport(
+    UsdGeomPoints pointCloud,
+    const VtVec3fArray& points,
+    std::optional<const FloatPrimvarData> widths,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity,
+    UsdTimeCode time
+)
+{
+    PointCloudQuantizationReport report;
+    if (!pointCloud)
+    {
+        TF_RUNTIME_ERROR("Unable to compute the quantization report of an invalid UsdGeomPoints");
+        report.maxPointError = std::numeric_limits<double>::infinity();
+        return report;
+    }
+
+    // The authored points are compared in the local space of the source points, so only the dequantizing translation is applied
+    VtVec3fArray authoredPoints;
+    VtTokenArray xformOpOrder;
+    GfVec3d translation(0.0);
+    pointCloud.GetPointsAttr().Get(&authoredPoints, time);
+    pointCloud.GetXformOpOrderAttr().Get(&xformOpOrder, time);
+    if (std::find(xformOpOrder.cbegin(), xformOpOrder.cend(), ::getDequantizeOpName()) != xformOpOrder.cend())
+    {
+        pointCloud.GetPrim().GetAttribute(::getDequantizeOpName()).Get(&translation, time);
+    }
+    if (authoredPoints.size() != points.size())
+    {
+        report.maxPointError = std::numeric_limits<double>::infinity();
+    }
+    else
+    {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            const GfVec3d error = GfVec3d(authoredPoints[i]) + translation - GfVec3d(points[i]);
+            report.maxPointError = std::max({ report.maxPointError, std::abs(error[0]), std::abs(error[1]), std::abs(error[2]) });
+        }
+    }
+
+    const UsdGeomPrimvarsAPI primvarsApi(pointCloud);
+    report.maxWidthError = ::computePrimvarError(widths, primvarsApi.GetPrimvar(UsdGeomTokens->widths), points.size(), time);
+    report.maxNormalError = ::computePrimvarError(normals, primvarsApi.GetPrimvar(UsdGeomTokens->normals), points.size(), time);
+    report.maxDisplayColorError = ::computePrimvarError(displayColor, pointCloud.GetDisplayColorPrimvar(), points.size(), time);
+    report.maxDisplayOpacityError = ::computePrimvarError(displayOpacity, pointCloud.GetDisplayOpacityPrimvar(), points.size(), time);
+    return report;
+}
+
+namespace
+{
+
+// The invariants of an optional value stream, established by the first frame written by a PointCloudWriter
+struct StreamSpec
+{
+    bool enabled = false;
+    TfToken interpolation;
+    int elementSize = -1;
+    bool indexed = false;
+    SdfPath valuesPath;
+    SdfPath indicesPath;
+};
+
+// Validate a primvar for a frame, including the invariants of its stream if the stream has been established
+template <typename T>
+bool validateFrameStream(
+    const SdfPath& path,
+    double time,
+    const char* name,
+    const std::optional<const PrimvarData<T>>& primvar,
+    const VtVec3fArray& points,
+    const TfTokenVector& interpolations,
+    const StreamSpec* stream
+)
+{
+    if (stream != nullptr && stream->enabled != primvar.has_value())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to write UsdGeomPoints frame at \"%s\" for time %f due to invalid %s: Values must be provided for all frames or none",
+            path.GetAsString().c_str(),
+            time,
+            name
+        );
+        return false;
+    }
+
+    if (!primvar.has_value())
+    {
+        return true;
+    }
+
+    std::string reason;
+    if (!::validatePrimvar(primvar.value(), interpolations, points, &reason))
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to write UsdGeomPoints frame at \"%s\" for time %f due to invalid %s: %s",
+            path.GetAsString().c_str(),
+            time,
+            name,
+            reason.c_str()
+        );
+        return false;
+    }
+
+    const bool changed = stream != nullptr && (stream->interpolation != primvar->interpolation() || stream->elementSize != primvar->elementSize() ||
+                                               stream->indexed != primvar->hasIndices());
+    if (changed)
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to write UsdGeomPoints frame at \"%s\" for time %f due to invalid %s: Interpolation, element size, and indexing must not change",
+            path.GetAsString().c_str(),
+            time,
+            name
+        );
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+class usdex::core::PointCloudWriter::PointCloudWriterImpl
+{
+
+public:
+
+    explicit PointCloudWriterImpl(UsdGeomPoints pointCloud) : m_pointCloud(pointCloud), m_frameCount(0), m_lastTime(0.0)
+    {
+    }
+
+    bool isValid() const
+    {
+        if (!m_pointCloud)
+        {
+            return false;
+        }
+
+        // Once the first frame is written, the writer is bound to its layer
+        if (m_frameCount > 0)
+        {
+            return static_cast<bool>(m_layer);
+        }
+
+        return static_cast<bool>(m_pointCloud.GetPrim().GetStage()->GetEditTarget().GetLayer());
+    }
+
+    bool writeFrame(
+        UsdTimeCode time,
+        const VtVec3fArray& points,
+        const std::optional<const VtInt64Array>& ids,
+        const std::optional<const FloatPrimvarData>& widths,
+        const std::optional<const Vec3fPrimvarData>& normals,
+        const std::optional<const Vec3fPrimvarData>& displayColor,
+        const std::optional<const FloatPrimvarData>& displayOpacity
+    )
+    {
+        if (!isValid())
+        {
+            TF_RUNTIME_ERROR("Unable to write UsdGeomPoints frame due to an invalid prim or edit target");
+            return false;
+        }
+
+        const SdfPath& path = m_pointCloud.GetPath();
+        if (time.IsDefault() || (m_frameCount > 0 && time.GetValue() <= m_lastTime))
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomPoints frame at \"%s\" for time %s: Frames must be written at increasing numeric time codes",
+                path.GetAsString().c_str(),
+                TfStringify(time).c_str()
+            );
+            return false;
+        }
+
+        if (points.empty())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomPoints frame at \"%s\" for time %f due to invalid points: Empty array",
+                path.GetAsString().c_str(),
+                time.GetValue()
+            );
+            return false;
+        }
+
+        const bool established = m_frameCount > 0;
+        if (established && m_ids.enabled != ids.has_value())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomPoints frame at \"%s\" for time %f due to invalid ids: Values must be provided for all frames or none",
+                path.GetAsString().c_str(),
+                time.GetValue()
+            );
+            return false;
+        }
+        if (ids.has_value() && points.size() != ids->size())
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to write UsdGeomPoints frame at \"%s\" for time %f due to invalid ids: Expected %zu values but found %zu",
+                path.GetAsString().c_str(),
+                time.GetValue(),
+                points.size(),
+                ids->size()
+            );
+            return false;
+        }
+
+        static const TfTokenVector s_validInterpolations = { UsdGeomTokens->constant, UsdGeomTokens->vertex };
+        static const TfTokenVector s_validNormalsInterpolations = { UsdGeomTokens->vertex };
+        const double t = time.GetValue();
+        const StreamSpec* widthsStream = established ? &m_widths : nullptr;
+        const StreamSpec* normalsStream = established ? &m_normals : nullptr;
+        const StreamSpec* displayColorStream = established ? &m_displayColor : nullptr;
+        const StreamSpec* displayOpacityStream = established ? &m_displayOpacity : nullptr;
+        if (!::validateFrameStream(path, t, "widths", widths, points, s_validInterpolations, widthsStream) ||
+            !::validateFrameStream(path, t, "normals", normals, points, s_validNormalsInterpolations, normalsStream) ||
+            !::validateFrameStream(path, t, "display color", displayColor, points, s_validInterpolations, displayColorStream) ||
+            !::validateFrameStream(path, t, "display opacity", displayOpacity, points, s_validInterpolations, displayOpacityStream))
+        {
+            return false;
+        }
+
+        const VtVec3fArray extent = widths.has_value() ? computePointsExtent(points, widths.value()) : computePointsExtent(points);
+        if (!established)
+        {
+            establish(time, points, ids, widths, normals, displayColor, displayOpacity, extent);
+        }
+        else
+        {
+            // Write directly to the layer, avoiding the per value overhead of UsdAttribute::Set
+            const double layerTime = m_stageToLayerOffset * t;
+            SdfChangeBlock changeBlock;
+            m_layer->SetTimeSample(m_pointsPath, layerTime, points);
+            m_layer->SetTimeSample(m_extentPath, layerTime, extent);
+            if (ids.has_value())
+            {
+                m_layer->SetTimeSample(m_ids.valuesPath, layerTime, ids.value());
+            }
+            setTimeSamples(m_widths, widths, layerTime);
+            setTimeSamples(m_normals, normals, layerTime);
+            setTimeSamples(m_displayColor, displayColor, layerTime);
+            setTimeSamples(m_displayOpacity, displayOpacity, layerTime);
+        }
+
+        m_lastTime = t;
+        ++m_frameCount;
+        return true;
+    }
+
+    size_t getFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+private:
+
+    // Author the first frame via the schema, so that all attribute specs & metadata exist, then record the spec paths of each stream
+    void establish(
+        UsdTimeCode time,
+        const VtVec3fArray& points,
+        const std::optional<const VtInt64Array>& ids,
+        const std::optional<const FloatPrimvarData>& widths,
+        const std::optional<const Vec3fPrimvarData>& normals,
+        const std::optional<const Vec3fPrimvarData>& displayColor,
+        const std::optional<const FloatPrimvarData>& displayOpacity,
+        const VtVec3fArray& extent
+    )
+    {
+        const UsdEditTarget& editTarget = m_pointCloud.GetPrim().GetStage()->GetEditTarget();
+        m_layer = editTarget.GetLayer();
+        m_stageToLayerOffset = editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+
+        UsdAttribute pointsAttr = m_pointCloud.CreatePointsAttr();
+        pointsAttr.Set(points, time);
+        m_pointsPath = editTarget.MapToSpecPath(pointsAttr.GetPath());
+
+        UsdAttribute extentAttr = m_pointCloud.CreateExtentAttr();
+        extentAttr.Set(extent, time);
+        m_extentPath = editTarget.MapToSpecPath(extentAttr.GetPath());
+
+        if (ids.has_value())
+        {
+            UsdAttribute idsAttr = m_pointCloud.CreateIdsAttr();
+            idsAttr.Set(ids.value(), time);
+            m_ids.enabled = true;
+            m_ids.valuesPath = editTarget.MapToSpecPath(idsAttr.GetPath());
+        }
+
+        UsdGeomPrimvarsAPI primvarsAPI(m_pointCloud.GetPrim());
+        if (widths.has_value())
+        {
+            UsdGeomPrimvar primvar = primvarsAPI.CreatePrimvar(UsdGeomTokens->widths, SdfValueTypeNames->FloatArray);
+            establishStream(m_widths, widths.value(), primvar, time, editTarget, "widths");
+        }
+        if (normals.has_value())
+        {
+            UsdGeomPrimvar primvar = primvarsAPI.CreatePrimvar(UsdGeomTokens->normals, SdfValueTypeNames->Normal3fArray);
+            establishStream(m_normals, normals.value(), primvar, time, editTarget, "normals");
+        }
+        if (displayColor.has_value())
+        {
+            UsdGeomPrimvar primvar = m_pointCloud.CreateDisplayColorPrimvar();
+            establishStream(m_displayColor, displayColor.value(), primvar, time, editTarget, "display color");
+        }
+        if (displayOpacity.has_value())
+        {
+            UsdGeomPrimvar primvar = m_pointCloud.CreateDisplayOpacityPrimvar();
+            establishStream(m_displayOpacity, displayOpacity.value(), primvar, time, editTarget, "display opacity");
+        }
+    }
+
+    template <typename T>
+    void establishStream(
+        StreamSpec& stream,
+        const PrimvarData<T>& data,
+        UsdGeomPrimvar& primvar,
+        UsdTimeCode time,
+        const UsdEditTarget& editTarget,
+        const char* name
+    )
+    {
+        if (!data.setPrimvar(primvar, time))
+        {
+            TF_WARN("Failed to set %s primvar for UsdGeomPoints at \"%s\"", name, m_pointCloud.GetPath().GetAsString().c_str());
+        }
+        stream.enabled = true;
+        stream.interpolation = data.interpolation();
+        stream.elementSize = data.elementSize();
+        stream.indexed = data.hasIndices();
+        stream.valuesPath = editTarget.MapToSpecPath(primvar.GetAttr().GetPath());
+        if (stream.indexed)
+        {
+            stream.indicesPath = editTarget.MapToSpecPath(primvar.GetIndicesAttr().GetPath());
+        }
+    }
+
+    template <typename T>
+    void setTimeSamples(const StreamSpec& stream, const std::optional<const PrimvarData<T>>& data, double layerTime)
+    {
+        if (!stream.enabled)
+        {
+            return;
+        }
+        m_layer->SetTimeSample(stream.valuesPath, layerTime, data->values());
+        if (stream.indexed)
+        {
+            m_layer->SetTimeSample(stream.indicesPath, layerTime, data->indices());
+        }
+    }
+
+    UsdGeomPoints m_pointCloud;
+    SdfLayerHandle m_layer;
+    SdfLayerOffset m_stageToLayerOffset;
+    SdfPath m_pointsPath;
+    SdfPath m_extentPath;
+    StreamSpec m_ids;
+    StreamSpec m_widths;
+    StreamSpec m_normals;
+    StreamSpec m_displayColor;
+    StreamSpec m_displayOpacity;
+    size_t m_frameCount;
+    double m_lastTime;
+};
+
+usdex::core::PointCloudWriter::PointCloudWriter(UsdGeomPoints pointCloud) : m_impl(new PointCloudWriterImpl(pointCloud))
+{
+    if (!pointCloud)
+    {
+        TF_RUNTIME_ERROR("Unable to write frames to an invalid UsdGeomPoints");
+    }
+}
+
+usdex::core::PointCloudWriter::~PointCloudWriter()
+{
+    delete m_impl;
+}
+
+bool usdex::core::PointCloudWriter::isValid() const
+{
+    return m_impl->isValid();
+}
+
+bool usdex::core::PointCloudWriter::writeFrame(
+    UsdTimeCode time,
+    const VtVec3fArray& points,
+    std::optional<const VtInt64Array> ids,
+    std::optional<const FloatPrimvarData> widths,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    USDEX_INSTRUMENT_SCOPE("PointCloudWriter::writeFrame");
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_ARRAY(ids);
+    USDEX_INSTRUMENT_PRIMVAR(widths);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
+    return m_impl->writeFrame(time, points, ids, widths, normals, displayColor, displayOpacity);
+}
+
+size_t usdex::core::PointCloudWriter::getFrameCount() const
+{
+    return m_impl->getFrameCount();
+}
+
+namespace
+{
+
+// The grid is limited to this many cells, so that the cells can be counted densely regardless of the bounds of the points
+static constexpr size_t s_maxTileCells = 1 << 20;
+
+// The cells of the points are computed in parallel in batches of this size
+static constexpr size_t s_tileGrainSize = 1 << 14;
+
+// A grid of cubic cells aligned with the bounds of the points
+struct TileGrid
+{
+    GfVec3f origin;
+    float size;
+    size_t dims[3];
+
+    size_t getCellCount() const
+    {
+        return dims[0] * dims[1] * dims[2];
+    }
+
+    size_t getCell(const GfVec3f& point) const
+    {
+        size_t cell = 0;
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            // Non-finite coordinates are clamped to the first cell rather than producing an out of range index
+            const float coordinate = (point[axis] - origin[axis]) / size;
+            const size_t index = (coordinate >= 0.0f) ? static_cast<size_t>(std::min(coordinate, static_cast<float>(dims[axis] - 1))) : 0;
+            cell = cell * dims[axis] + index;
+        }
+        return cell;
+    }
+};
+
+TileGrid computeTileGrid(const VtVec3fArray& points, const PointCloudTiling& tiling)
+{
+    GfRange3f range;
+    for (const GfVec3f& point : points)
+    {
+        range.UnionWith(point);
+    }
+
+    TileGrid grid;
+    grid.origin = range.GetMin();
+    GfVec3f size = range.GetSize();
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        // Non-finite points do not contribute to the size of the grid
+        if (!std::isfinite(size[axis]))
+        {
+            size[axis] = 0.0f;
+        }
+    }
+    const float maxSize = std::max({ size[0], size[1], size[2], std::numeric_limits<float>::min() });
+
+    grid.size = tiling.tileSize;
+    if (!(grid.size > 0.0f) && points.size() <= tiling.targetPointsPerTile)
+    {
+        grid.size = maxSize;
+    }
+    else if (!(grid.size > 0.0f))
+    {
+        // Choose the cell size from the volume (or area or length) spanned by the non-degenerate axes of the bounds
+        const double cells = std::max(1.0, std::ceil(double(points.size()) / double(std::max<size_t>(tiling.targetPointsPerTile, 1))));
+        double volume = 1.0;
+        int axes = 0;
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            if (size[axis] > maxSize * 1e-3f)
+            {
+                volume *= size[axis];
+                ++axes;
+            }
+        }
+        grid.size = static_cast<float>(std::pow(volume / cells, 1.0 / std::max(axes, 1)));
+    }
+
+    // Grow the cells until the grid fits within the cell limit
+    while (true)
+    {
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const float cells = std::ceil(size[axis] / grid.size);
+            grid.dims[axis] = (cells > 1.0f) ? static_cast<size_t>(std::min(cells, static_cast<float>(s_maxTileCells + 1))) : 1;
+        }
+        if (grid.getCellCount() <= s_maxTileCells)
+        {
+            break;
+        }
+        grid.size *= 2.0f;
+    }
+
+    return grid;
+}
+
+// Whether an optional value could be partitioned along with the points
+template <typename T>
+bool isValidTilePrimvar(const std::optional<const PrimvarData<T>>& primvar, size_t pointCount)
+{
+    if (!primvar.has_value())
+    {
+        return true;
+    }
+    if (!primvar->isValid())
+    {
+        return false;
+    }
+    return primvar->interpolation() == UsdGeomTokens->constant ||
+           (primvar->interpolation() == UsdGeomTokens->vertex && primvar->effectiveSize() == pointCount);
+}
+
+template <typename T>
+VtArray<T> gatherTileValues(const VtArray<T>& values, const size_t* order, size_t count, size_t stride)
+{
+    VtArray<T> result(count * stride);
+    T* data = result.data();
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::copy_n(values.cdata() + order[i] * stride, stride, data + i * stride);
+    }
+    return result;
+}
+
+// Gather the values of the points of a tile, compacting the values referenced by the indices of an indexed primvar
+template <typename T>
+std::optional<PrimvarData<T>> gatherTilePrimvar(const std::optional<const PrimvarData<T>>& primvar, const size_t* order, size_t count)
+{
+    if (!primvar.has_value() || primvar->interpolation() == UsdGeomTokens->constant)
+    {
+        return primvar;
+    }
+
+    const size_t stride = static_cast<size_t>(std::max(primvar->elementSize(), 1));
+    if (!primvar->hasIndices())
+    {
+        return PrimvarData<T>(primvar->interpolation(), ::gatherTileValues(primvar->values(), order, count, stride), primvar->elementSize());
+    }
+
+    const VtIntArray indices = ::gatherTileValues(primvar->indices(), order, count, stride);
+    const VtArray<T>& values = primvar->values();
+    VtArray<T> tileValues;
+    VtIntArray tileIndices(indices.size());
+    std::unordered_map<int, int> remap;
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        auto insertIt = remap.emplace(indices[i], static_cast<int>(tileValues.size()));
+        if (insertIt.second)
+        {
+            tileValues.push_back(values[indices[i]]);
+        }
+        tileIndices[i] = insertIt.first->second;
+    }
+    return PrimvarData<T>(primvar->interpolation(), std::move(tileValues), std::move(tileIndices), primvar->elementSize());
+}
+
+// The data of a single tile, gathered from the point cloud
+struct PointCloudTile
+{
+    VtVec3fArray points;
+    std::optional<VtInt64Array> ids;
+    std::optional<FloatPrimvarData> widths;
+    std::optional<Vec3fPrimvarData> normals;
+    std::optional<Vec3fPrimvarData> displayColor;
+    std::optional<FloatPrimvarData> displayOpacity;
+    std::optional<GfVec3d> translation;
+};
+
+} // namespace
+
+std::vector<UsdPrim> usdex::core::definePointCloudTiles(
+    UsdPrim parent,
+    const std::string& name,
+    const VtVec3fArray& points,
+    const PointCloudTiling& tiling,
+    std::optional<const VtInt64Array> ids,
+    std::optional<const FloatPrimvarData> widths,
+    std::optional<const Vec3fPrimvarData> normals,
+    std::optional<const Vec3fPrimvarData> displayColor,
+    std::optional<const FloatPrimvarData> displayOpacity
+)
+{
+    USDEX_INSTRUMENT_SCOPE("definePointCloudTiles");
+    USDEX_INSTRUMENT_ARRAY(points);
+    USDEX_INSTRUMENT_ARRAY(ids);
+    USDEX_INSTRUMENT_PRIMVAR(widths);
+    USDEX_INSTRUMENT_PRIMVAR(normals);
+    USDEX_INSTRUMENT_PRIMVAR(displayColor);
+    USDEX_INSTRUMENT_PRIMVAR(displayOpacity);
+
+    if (!parent)
+    {
+        USDEX_AUTHORING_ERROR(SdfPath(), eInvalidLocation, "Unable to define UsdGeomPoints tiles due to an invalid parent prim");
+        return {};
+    }
+
+    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
+    if (points.empty())
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdGeomPoints tiles at \"%s\" due to invalid points: Empty array", path.GetAsString().c_str());
+        return {};
+    }
+
+    // The optional values must be partitioned along with the points, so each point must have its own value (or share a constant value)
+    if ((ids.has_value() && ids->size() != points.size()) || !::isValidTilePrimvar(widths, points.size()) ||
+        !::isValidTilePrimvar(normals, points.size()) || !::isValidTilePrimvar(displayColor, points.size()) ||
+        !::isValidTilePrimvar(displayOpacity, points.size()))
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdGeomPoints tiles at \"%s\" due to invalid values: Each value must have constant interpolation or a value for each "
+            "of the %zu points",
+            path.GetAsString().c_str(),
+            points.size()
+        );
+        return {};
+    }
+
+    UsdStagePtr stage = parent.GetStage();
+    const SdfLayerHandle& layer = stage->GetEditTarget().GetLayer();
+    if (tiling.usePayloads && (!layer || layer->IsAnonymous()))
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdGeomPoints tiles at \"%s\" as payloads due to an anonymous edit target layer",
+            path.GetAsString().c_str()
+        );
+        return {};
+    }
+
+    // Compute the cell of each point in parallel
+    const TileGrid grid = ::computeTileGrid(points, tiling);
+    std::vector<uint32_t> cells(points.size());
+    WorkParallelForN(
+        points.size(),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                cells[i] = static_cast<uint32_t>(grid.getCell(points[i]));
+            }
+        },
+        s_tileGrainSize
+    );
+
+    // Count the points of each cell, then sort the points by tile, retaining their original order within each tile
+    std::vector<size_t> cellCounts(grid.getCellCount(), 0);
+    for (const uint32_t cell : cells)
+    {
+        ++cellCounts[cell];
+    }
+    std::vector<uint32_t> cellTiles(cellCounts.size(), 0);
+    std::vector<size_t> tileOffsets = { 0 };
+    for (size_t cell = 0; cell < cellCounts.size(); ++cell)
+    {
+        if (cellCounts[cell] > 0)
+        {
+            cellTiles[cell] = static_cast<uint32_t>(tileOffsets.size() - 1);
+            tileOffsets.push_back(tileOffsets.back() + cellCounts[cell]);
+        }
+    }
+    const size_t tileCount = tileOffsets.size() - 1;
+    std::vector<size_t> order(points.size());
+    {
+        std::vector<size_t> cursors(tileOffsets.begin(), tileOffsets.end() - 1);
+        for (size_t i = 0; i < cells.size(); ++i)
+        {
+            order[cursors[cellTiles[cells[i]]]++] = i;
+        }
+    }
+
+    // Gather the data of each tile in parallel
+    std::vector<PointCloudTile> tiles(tileCount);
+    WorkParallelForN(
+        tileCount,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t tile = begin; tile < end; ++tile)
+            {
+                const size_t* tileOrder = order.data() + tileOffsets[tile];
+                const size_t count = tileOffsets[tile + 1] - tileOffsets[tile];
+                PointCloudTile& data = tiles[tile];
+                data.points = ::gatherTileValues(points, tileOrder, count, 1);
+                if (ids.has_value())
+                {
+                    data.ids.emplace(::gatherTileValues(ids.value(), tileOrder, count, 1));
+                }
+                data.widths = ::gatherTilePrimvar(widths, tileOrder, count);
+                data.normals = ::gatherTilePrimvar(normals, tileOrder, count);
+                data.displayColor = ::gatherTilePrimvar(displayColor, tileOrder, count);
+                data.displayOpacity = ::gatherTilePrimvar(displayOpacity, tileOrder, count);
+
+                // Each tile is quantized relative to its own bounds
+                if (tiling.quantization.has_value())
+                {
+                    const PointCloudQuantization& quantization = tiling.quantization.value();
+                    if (quantization.positionBits > 0)
+                    {
+                        data.translation.emplace();
+                        data.points = ::quantizePoints(data.points, quantization.positionBits, &data.translation.value());
+                    }
+                    data.widths = ::quantizePrimvar(std::move(data.widths), quantization.precision);
+                    data.normals = ::quantizePrimvar(std::move(data.normals), quantization.precision);
+                    data.displayColor = ::quantizePrimvar(std::move(data.displayColor), quantization.precision);
+                    data.displayOpacity = ::quantizePrimvar(std::move(data.displayOpacity), quantization.precision);
+                }
+            }
+        }
+    );
+
+    UsdGeomXform xform = usdex::core::defineXform(parent, name);
+    if (!xform)
+    {
+        return {};
+    }
+
+    std::vector<std::string> tileNames(tileCount);
+    for (size_t tile = 0; tile < tileCount; ++tile)
+    {
+        tileNames[tile] = TfStringPrintf("Tile_%zu", tile);
+    }
+
+    std::vector<UsdPrim> result;
+    result.reserve(tileCount);
+    if (!tiling.usePayloads)
+    {
+        BulkAuthoringScope scope(stage);
+        for (size_t tile = 0; tile < tileCount; ++tile)
+        {
+            const PointCloudTile& data = tiles[tile];
+            const SdfPath tilePath = xform.GetPath().AppendChild(TfToken(tileNames[tile]));
+            UsdGeomPoints pointCloud = ::definePointCloudImpl(
+                stage,
+                tilePath,
+                data.points,
+                data.ids,
+                data.widths,
+                data.normals,
+                data.displayColor,
+                data.displayOpacity,
+                data.translation ? &data.translation.value() : nullptr
+            );
+            if (!pointCloud)
+            {
+                return {};
+            }
+        }
+    }
+    else
+    {
+        // Each tile is authored to its own layer, so the layers can be authored and saved concurrently
+        ArResolver& resolver = ArGetResolver();
+        const std::string layerPath = resolver.Resolve(layer->GetIdentifier());
+        const TfToken upAxis = UsdGeomGetStageUpAxis(stage);
+        const double linearUnits = UsdGeomGetStageMetersPerUnit(stage);
+        const std::string authoringMetadata = usdex::core::getLayerAuthoringMetadata(layer);
+        std::vector<UsdStageRefPtr> tileStages(tileCount);
+        std::vector<VtVec3fArray> extents(tileCount);
+        WorkParallelForN(
+            tileCount,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t tile = begin; tile < end; ++tile)
+                {
+                    const std::string relativeIdentifier = TfStringPrintf(
+                        "./%s/%s_%s.%s",
+                        usdex::core::getPayloadToken().GetText(),
+                        name.c_str(),
+                        tileNames[tile].c_str(),
+                        tiling.payloadFormat.c_str()
+                    );
+                    UsdStageRefPtr tileStage = usdex::core::createStage(
+                        resolver.CreateIdentifier(relativeIdentifier, layerPath),
+                        tileNames[tile],
+                        upAxis,
+                        linearUnits,
+                        authoringMetadata
+                    );
+                    if (!tileStage)
+                    {
+                        continue;
+                    }
+
+                    // The data of each tile is released once it has been authored, as the layer holds its own copy
+                    PointCloudTile data = std::move(tiles[tile]);
+                    UsdGeomPoints pointCloud = ::definePointCloudImpl(
+                        tileStage,
+                        tileStage->GetDefaultPrim().GetPath(),
+                        data.points,
+                        data.ids,
+                        data.widths,
+                        data.normals,
+                        data.displayColor,
+                        data.displayOpacity,
+                        data.translation ? &data.translation.value() : nullptr
+                    );
+                    if (pointCloud && pointCloud.GetExtentAttr().Get(&extents[tile]) && tileStage->GetRootLayer()->Save())
+                    {
+                        tileStages[tile] = tileStage;
+                    }
+                }
+            },
+            1
+        );
+
+        // The payloads are defined in a single batch, as the tile layers are already open
+        std::vector<ReferencePayloadData> payloads(tileCount);
+        for (size_t tile = 0; tile < tileCount; ++tile)
+        {
+            if (!tileStages[tile])
+            {
+                TF_RUNTIME_ERROR("Unable to define the UsdGeomPoints tile layer for \"%s\"", tileNames[tile].c_str());
+                return {};
+            }
+            payloads[tile].path = xform.GetPath().AppendChild(TfToken(tileNames[tile]));
+            payloads[tile].sourceIdentifier = tileStages[tile]->GetRootLayer()->GetIdentifier();
+        }
+        if (usdex::core::definePayloads(stage, payloads).empty())
+        {
+            return {};
+        }
+
+        // The extentsHint allows viewers to choose which tiles to load without loading any of them
+        for (size_t tile = 0; tile < tileCount; ++tile)
+        {
+            UsdGeomModelAPI(stage->GetPrimAtPath(payloads[tile].path)).SetExtentsHint(extents[tile]);
+        }
+    }
+
+    for (const std::string& tileName : tileNames)
+    {
+        result.push_back(xform.GetPrim().GetChild(TfToken(tileName)));
+    }
+    return result;
+}
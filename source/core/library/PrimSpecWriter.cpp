@@ -0,0 +1,396 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "PrimSpecWriter.h"
+
+#include "usdex/core/StageAlgo.h"
+
+#include "AuthoringErrors.h"
+#include "Debug.h"
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <optional>
+#include <set>
+
+using namespace pxr;
+
+namespace
+{
+
+// Batches smaller than this are validated on the calling thread, as the overhead of sharding outweighs the benefit
+static constexpr size_t s_parallelValidationThreshold = 1 << 10;
+
+static constexpr size_t s_validationGrainSize = 1 << 8;
+
+} // namespace
+
+usdex::core::detail::PrimSpecWriter::PrimSpecWriter(UsdStagePtr stage, const SdfPath& path, const TfToken& typeName)
+    : m_editTarget(stage->GetEditTarget()), m_primDefinition(UsdSchemaRegistry::GetInstance().FindConcretePrimDefinition(typeName))
+{
+    const SdfLayerHandle& layer = m_editTarget.GetLayer();
+    if (!layer || !m_primDefinition)
+    {
+        return;
+    }
+
+    // Ancestors without specs are authored as overs. Callers must define any undefined ancestors beforehand (see defineUndefinedAncestors)
+    m_primSpec = SdfCreatePrimInLayer(layer, m_editTarget.MapToSpecPath(path));
+    if (!m_primSpec)
+    {
+        return;
+    }
+
+    m_primSpec->SetSpecifier(SdfSpecifierDef);
+    m_primSpec->SetTypeName(typeName.GetString());
+}
+
+bool usdex::core::detail::PrimSpecWriter::isValid() const
+{
+    return bool(m_primSpec);
+}
+
+bool usdex::core::detail::PrimSpecWriter::setAttribute(const TfToken& name, const VtValue& value)
+{
+    const SdfAttributeSpecHandle definition = m_primDefinition->GetSchemaAttributeSpec(name);
+    if (!definition)
+    {
+        TF_CODING_ERROR("Attribute \"%s\" is not defined by the schema of <%s>", name.GetText(), m_primSpec->GetPath().GetAsString().c_str());
+        return false;
+    }
+    return setAttribute(name, definition->GetTypeName(), definition->GetVariability(), value);
+}
+
+bool usdex::core::detail::PrimSpecWriter::setAttribute(
+    const TfToken& name,
+    const SdfValueTypeName& typeName,
+    SdfVariability variability,
+    const VtValue& value
+)
+{
+    SdfAttributeSpecHandle spec = getOrCreateAttributeSpec(m_primSpec, name, typeName, variability);
+    if (!spec || !spec->SetDefaultValue(value))
+    {
+        return false;
+    }
+    verifySharedDefaultValue(spec, value);
+    return true;
+}
+
+bool usdex::core::detail::PrimSpecWriter::setAttribute(const TfToken& name, const VtValue& value, UsdTimeCode time)
+{
+    const SdfAttributeSpecHandle definition = m_primDefinition->GetSchemaAttributeSpec(name);
+    if (!definition)
+    {
+        TF_CODING_ERROR("Attribute \"%s\" is not defined by the schema of <%s>", name.GetText(), m_primSpec->GetPath().GetAsString().c_str());
+        return false;
+    }
+    return setAttribute(name, definition->GetTypeName(), definition->GetVariability(), value, time);
+}
+
+bool usdex::core::detail::PrimSpecWriter::setAttribute(
+    const TfToken& name,
+    const SdfValueTypeName& typeName,
+    SdfVariability variability,
+    const VtValue& value,
+    UsdTimeCode time
+)
+{
+    if (time.IsDefault())
+    {
+        return setAttribute(name, typeName, variability, value);
+    }
+
+    SdfAttributeSpecHandle spec = getOrCreateAttributeSpec(m_primSpec, name, typeName, variability);
+    if (!spec)
+    {
+        return false;
+    }
+
+    // Stage times are mapped into the time domain of the edit target layer, as UsdAttribute::Set would
+    const SdfLayerOffset stageToLayerOffset = m_editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+    m_primSpec->GetLayer()->SetTimeSample(spec->GetPath(), stageToLayerOffset * time.GetValue(), value);
+    return true;
+}
+
+bool usdex::core::detail::PrimSpecWriter::setRelationshipTargets(const TfToken& name, const SdfPathVector& targets)
+{
+    const SdfRelationshipSpecHandle definition = m_primDefinition->GetSchemaRelationshipSpec(name);
+    if (!definition)
+    {
+        TF_CODING_ERROR("Relationship \"%s\" is not defined by the schema of <%s>", name.GetText(), m_primSpec->GetPath().GetAsString().c_str());
+        return false;
+    }
+
+    // Existing specs are reused, as UsdPrim::CreateRelationship would
+    SdfRelationshipSpecHandle spec = m_primSpec->GetRelationshipAtPath(m_primSpec->GetPath().AppendProperty(name));
+    if (!spec)
+    {
+        spec = SdfRelationshipSpec::New(m_primSpec, name.GetString(), /* custom */ false, definition->GetVariability());
+    }
+    if (!spec)
+    {
+        return false;
+    }
+
+    SdfPathVector mappedTargets;
+    mappedTargets.reserve(targets.size());
+    for (const SdfPath& target : targets)
+    {
+        mappedTargets.push_back(m_editTarget.MapToSpecPath(target).StripAllVariantSelections());
+    }
+    spec->GetTargetPathList().ClearEditsAndMakeExplicit();
+    spec->GetTargetPathList().GetExplicitItems() = mappedTargets;
+    return true;
+}
+
+bool usdex::core::detail::PrimSpecWriter::setPrimvarValue(
+    const TfToken& name,
+    const SdfValueTypeName& typeName,
+    const TfToken& interpolation,
+    const VtValue& values,
+    const VtValue& indices,
+    int elementSize
+)
+{
+    static const std::string s_primvarsNamespace = "primvars";
+    static const std::string s_indicesSuffix = "indices";
+
+    const TfToken primvarName(SdfPath::JoinIdentifier(s_primvarsNamespace, name.GetString()));
+    SdfAttributeSpecHandle spec = getOrCreateAttributeSpec(m_primSpec, primvarName, typeName, SdfVariabilityVarying);
+    if (!spec)
+    {
+        return false;
+    }
+
+    spec->SetInfo(UsdGeomTokens->interpolation, VtValue(interpolation));
+    if (!spec->SetDefaultValue(values))
+    {
+        return false;
+    }
+    verifySharedDefaultValue(spec, values);
+
+    // Author an explicit opinion about the indices (or a block) to ensure weaker opinions are overriden
+    const TfToken indicesName(SdfPath::JoinIdentifier(primvarName.GetString(), s_indicesSuffix));
+    SdfAttributeSpecHandle indicesSpec = getOrCreateAttributeSpec(m_primSpec, indicesName, SdfValueTypeNames->IntArray, SdfVariabilityVarying);
+    if (!indicesSpec || !indicesSpec->SetDefaultValue(indices))
+    {
+        return false;
+    }
+    verifySharedDefaultValue(indicesSpec, indices);
+
+    if (elementSize > 0)
+    {
+        spec->SetInfo(UsdGeomTokens->elementSize, VtValue(elementSize));
+    }
+    else if (spec->HasInfo(UsdGeomTokens->elementSize))
+    {
+        // if the elementSize was previously authored, we need to reset it as there is no way to block element size
+        spec->SetInfo(UsdGeomTokens->elementSize, VtValue(1));
+    }
+
+    return true;
+}
+
+SdfAttributeSpecHandle usdex::core::detail::getOrCreateAttributeSpec(
+    const SdfPrimSpecHandle& primSpec,
+    const TfToken& name,
+    const SdfValueTypeName& typeName,
+    SdfVariability variability
+)
+{
+    if (SdfAttributeSpecHandle spec = primSpec->GetLayer()->GetAttributeAtPath(primSpec->GetPath().AppendProperty(name)))
+    {
+        return spec;
+    }
+    return SdfAttributeSpec::New(primSpec, name.GetString(), typeName, variability, /* custom */ false);
+}
+
+SdfAttributeSpecHandle usdex::core::detail::getOrCreateAttributeSpec(
+    const SdfLayerHandle& layer,
+    const SdfPath& path,
+    const SdfValueTypeName& typeName,
+    SdfVariability variability
+)
+{
+    if (SdfAttributeSpecHandle spec = layer->GetAttributeAtPath(path))
+    {
+        return spec;
+    }
+
+    SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(layer, path.GetPrimPath());
+    if (!primSpec)
+    {
+        return SdfAttributeSpecHandle();
+    }
+    return SdfAttributeSpec::New(primSpec, path.GetName(), typeName, variability, /* custom */ false);
+}
+
+void usdex::core::detail::defineUndefinedAncestors(
+    UsdStagePtr stage,
+    const std::unordered_set<SdfPath, SdfPath::Hash>& paths,
+    std::vector<AuthoredAncestor>* authored
+)
+{
+    std::set<SdfPath> undefinedAncestors;
+    for (const SdfPath& path : paths)
+    {
+        for (SdfPath ancestor = path.GetParentPath(); ancestor != SdfPath::AbsoluteRootPath(); ancestor = ancestor.GetParentPath())
+        {
+            if (paths.count(ancestor) || undefinedAncestors.count(ancestor))
+            {
+                break;
+            }
+
+            const UsdPrim prim = stage->GetPrimAtPath(ancestor);
+            if (prim && prim.IsDefined())
+            {
+                break;
+            }
+
+            undefinedAncestors.insert(ancestor);
+        }
+    }
+
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    for (const SdfPath& ancestor : undefinedAncestors)
+    {
+        const SdfPath specPath = editTarget.MapToSpecPath(ancestor);
+        std::optional<SdfSpecifier> previousSpecifier;
+        if (SdfPrimSpecHandle existing = layer->GetPrimAtPath(specPath))
+        {
+            previousSpecifier = existing->GetSpecifier();
+        }
+        if (SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(layer, specPath))
+        {
+            primSpec->SetSpecifier(SdfSpecifierDef);
+            if (authored)
+            {
+                authored->push_back({ specPath, previousSpecifier });
+            }
+        }
+    }
+}
+
+void usdex::core::detail::revertAuthoredAncestors(UsdStagePtr stage, const std::vector<AuthoredAncestor>& authored)
+{
+    // Descendants are reverted before their ancestors, so that created specs are removed from the deepest up
+    const SdfLayerHandle& layer = stage->GetEditTarget().GetLayer();
+    for (auto it = authored.rbegin(); it != authored.rend(); ++it)
+    {
+        SdfPrimSpecHandle primSpec = layer->GetPrimAtPath(it->specPath);
+        if (!primSpec)
+        {
+            continue;
+        }
+
+        if (it->previousSpecifier.has_value())
+        {
+            primSpec->SetSpecifier(it->previousSpecifier.value());
+        }
+        else if (SdfPrimSpecHandle parentSpec = primSpec->GetRealNameParent())
+        {
+            parentSpec->RemoveNameChild(primSpec);
+        }
+    }
+}
+
+bool usdex::core::detail::validateBatchLocations(
+    const TfCallContext& context,
+    UsdStagePtr stage,
+    const SdfPathVector& paths,
+    const char* schemaName,
+    std::unordered_set<SdfPath, SdfPath::Hash>* uniquePaths,
+    std::vector<std::string>* argumentErrors
+)
+{
+    return validateBatchLocations(
+        context,
+        stage,
+        paths,
+        [schemaName](size_t)
+        {
+            return schemaName;
+        },
+        uniquePaths,
+        argumentErrors
+    );
+}
+
+bool usdex::core::detail::validateBatchLocations(
+    const TfCallContext& context,
+    UsdStagePtr stage,
+    const SdfPathVector& paths,
+    const std::function<const char*(size_t)>& schemaName,
+    std::unordered_set<SdfPath, SdfPath::Hash>* uniquePaths,
+    std::vector<std::string>* argumentErrors
+)
+{
+    // Validation only reads from the stage, so it is safe to perform in parallel.
+    // The worker threads can not see the AuthoringErrorScope of the calling thread, so whether messages are required is queried up front.
+    const bool formatMessages = isAuthoringErrorMessageRequired();
+    std::vector<std::optional<AuthoringErrorCode>> codes(paths.size());
+    std::vector<std::string> errors(paths.size());
+    const auto validate = [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            std::string reason;
+            if (!usdex::core::isEditablePrimLocation(stage, paths[i], formatMessages ? &reason : nullptr))
+            {
+                codes[i] = AuthoringErrorCode::eInvalidLocation;
+                if (formatMessages)
+                {
+                    errors[i] = TfStringPrintf("Unable to define %s due to an invalid location: %s", schemaName(i), reason.c_str());
+                }
+            }
+            else if (argumentErrors && !(*argumentErrors)[i].empty())
+            {
+                codes[i] = AuthoringErrorCode::eInvalidArgument;
+                errors[i] = std::move((*argumentErrors)[i]);
+            }
+        }
+    };
+    if (paths.size() < s_parallelValidationThreshold || !WorkHasConcurrency())
+    {
+        validate(0, paths.size());
+    }
+    else
+    {
+        WorkParallelForN(paths.size(), validate, s_validationGrainSize);
+    }
+
+    // Each path may only be defined once per batch
+    uniquePaths->clear();
+    uniquePaths->reserve(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        if (!uniquePaths->insert(paths[i]).second && !codes[i].has_value())
+        {
+            codes[i] = AuthoringErrorCode::eDuplicatePath;
+            if (formatMessages)
+            {
+                errors[i] = TfStringPrintf("Unable to define %s at \"%s\" due to a duplicate path", schemaName(i), paths[i].GetAsString().c_str());
+            }
+        }
+    }
+
+    bool valid = true;
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        if (codes[i].has_value())
+        {
+            postAuthoringError(context, paths[i], codes[i].value(), std::move(errors[i]));
+            valid = false;
+        }
+    }
+    return valid;
+}
@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/PrimvarData.h"
+
+#include <pxr/base/tf/callContext.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/type.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/relationshipSpec.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/primDefinition.h>
+#include <pxr/usd/usd/schemaRegistry.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace usdex::core::detail
+{
+
+//! Authors a prim and its attributes as specs directly on the current edit target layer of a stage.
+//!
+//! This is the implementation of the `BulkAuthoringScope` mode of the define functions. The specs match those authored by the equivalent
+//! `UsdSchema::Define` and `UsdAttribute::Set` calls, but all of them are written within a single `SdfChangeBlock`, which is closed when the
+//! writer is destroyed. The prim can only be retrieved from the stage after that point.
+class PrimSpecWriter
+{
+
+public:
+
+    //! Create or reuse the prim spec at the edit target location of `path`, and author its specifier and type name.
+    //!
+    //! @param stage The stage on which to define the prim
+    //! @param path The absolute prim path at which to define the prim
+    //! @param typeName The concrete schema type name of the prim
+    PrimSpecWriter(pxr::UsdStagePtr stage, const pxr::SdfPath& path, const pxr::TfToken& typeName);
+
+    //! Whether the prim spec was created successfully.
+    bool isValid() const;
+
+    //! Author the default value of an attribute defined by the schema of the prim.
+    //!
+    //! @param name The name of the attribute
+    //! @param value The default value. This must hold the value type of the attribute.
+    //! @returns Whether the value was authored.
+    bool setAttribute(const pxr::TfToken& name, const pxr::VtValue& value);
+
+    //! Author the default value of an attribute that is not defined by the schema of the prim (e.g. a primvar or an xform op).
+    //!
+    //! @param name The name of the attribute
+    //! @param typeName The value type name of the attribute
+    //! @param variability The variability of the attribute
+    //! @param value The default value. This must hold the value type of the attribute.
+    //! @returns Whether the value was authored.
+    bool setAttribute(const pxr::TfToken& name, const pxr::SdfValueTypeName& typeName, pxr::SdfVariability variability, const pxr::VtValue& value);
+
+    //! Author the value of an attribute defined by the schema of the prim at a time, matching `UsdAttribute::Set`.
+    //!
+    //! @param name The name of the attribute
+    //! @param value The value. This must hold the value type of the attribute.
+    //! @param time The stage time at which to author the value, which is mapped through the edit target. The default time authors the default value.
+    //! @returns Whether the value was authored.
+    bool setAttribute(const pxr::TfToken& name, const pxr::VtValue& value, pxr::UsdTimeCode time);
+
+    //! Author the value of an attribute that is not defined by the schema of the prim at a time, matching `UsdAttribute::Set`.
+    //!
+    //! @param name The name of the attribute
+    //! @param typeName The value type name of the attribute
+    //! @param variability The variability of the attribute
+    //! @param value The value. This must hold the value type of the attribute.
+    //! @param time The stage time at which to author the value, which is mapped through the edit target. The default time authors the default value.
+    //! @returns Whether the value was authored.
+    bool setAttribute(
+        const pxr::TfToken& name,
+        const pxr::SdfValueTypeName& typeName,
+        pxr::SdfVariability variability,
+        const pxr::VtValue& value,
+        pxr::UsdTimeCode time
+    );
+
+    //! Author the explicit targets of a relationship defined by the schema of the prim, matching `UsdRelationship::SetTargets`.
+    //!
+    //! @param name The name of the relationship
+    //! @param targets The absolute paths of the targets, which are mapped to the edit target
+    //! @returns Whether the targets were authored.
+    bool setRelationshipTargets(const pxr::TfToken& name, const pxr::SdfPathVector& targets);
+
+    //! Author a primvar, matching `PrimvarData::setPrimvar` for a newly created `UsdGeomPrimvar`.
+    //!
+    //! @param name The primvar name, excluding the "primvars:" namespace
+    //! @param typeName The value type name of the primvar
+    //! @param primvar The primvar data to author
+    //! @returns Whether the primvar was authored.
+    template <typename T>
+    bool setPrimvar(const pxr::TfToken& name, const pxr::SdfValueTypeName& typeName, const PrimvarData<T>& primvar);
+
+private:
+
+    bool setPrimvarValue(
+        const pxr::TfToken& name,
+        const pxr::SdfValueTypeName& typeName,
+        const pxr::TfToken& interpolation,
+        const pxr::VtValue& values,
+        const pxr::VtValue& indices,
+        int elementSize
+    );
+
+    pxr::SdfChangeBlock m_changeBlock;
+    pxr::UsdEditTarget m_editTarget;
+    const pxr::UsdPrimDefinition* m_primDefinition;
+    pxr::SdfPrimSpecHandle m_primSpec;
+};
+
+//! Get the spec of an attribute which is not necessarily defined by the schema of its prim, creating it if it does not already exist.
+//!
+//! Existing specs are reused, as `UsdPrim::CreateAttribute` would, and new specs are not custom.
+//!
+//! @param primSpec The prim spec which owns the attribute
+//! @param name The name of the attribute
+//! @param typeName The value type name of the attribute, used only when the spec is created
+//! @param variability The variability of the attribute, used only when the spec is created
+//! @returns The attribute spec, or an invalid handle on error.
+pxr::SdfAttributeSpecHandle getOrCreateAttributeSpec(
+    const pxr::SdfPrimSpecHandle& primSpec,
+    const pxr::TfToken& name,
+    const pxr::SdfValueTypeName& typeName,
+    pxr::SdfVariability variability
+);
+
+//! Get the spec of an attribute at a path in a layer, creating it (and its prim spec) if it does not already exist.
+//!
+//! Ancestors without specs are authored as overs, as `UsdAttribute::Set` would when authoring an opinion about an existing composed prim.
+//!
+//! @param layer The layer in which to author the spec
+//! @param path The path of the attribute in the namespace of the layer
+//! @param typeName The value type name of the attribute, used only when the spec is created
+//! @param variability The variability of the attribute, used only when the spec is created
+//! @returns The attribute spec, or an invalid handle on error.
+pxr::SdfAttributeSpecHandle getOrCreateAttributeSpec(
+    const pxr::SdfLayerHandle& layer,
+    const pxr::SdfPath& path,
+    const pxr::SdfValueTypeName& typeName,
+    pxr::SdfVariability variability = pxr::SdfVariabilityVarying
+);
+
+//! An ancestor spec authored by `defineUndefinedAncestors`, recorded so that it can be reverted if the batch fails.
+struct AuthoredAncestor
+{
+    pxr::SdfPath specPath;
+    std::optional<pxr::SdfSpecifier> previousSpecifier; //!< The specifier of an existing spec, or empty if the spec was created
+};
+
+//! Author typeless `def` specs for the ancestors of a batch of prims which are not yet defined, matching the behavior of `UsdStage::DefinePrim`.
+//!
+//! This must be called before the prims of the batch are authored, so that the composed stage reflects the state prior to the batch.
+//!
+//! @param stage The stage on which the batch is being defined
+//! @param paths The absolute prim paths of the batch. Paths which are ancestors of others in the batch are not authored as typeless prims.
+//! @param authored Optionally populated with the authored ancestor specs, in namespace order, for use with `revertAuthoredAncestors`
+void defineUndefinedAncestors(
+    pxr::UsdStagePtr stage,
+    const std::unordered_set<pxr::SdfPath, pxr::SdfPath::Hash>& paths,
+    std::vector<AuthoredAncestor>* authored = nullptr
+);
+
+//! Revert the ancestor specs authored by `defineUndefinedAncestors`, removing created specs and restoring the specifier of existing ones.
+//!
+//! @param stage The stage on which the batch was being defined. The edit target must not have changed since the ancestors were authored.
+//! @param authored The authored ancestor specs
+void revertAuthoredAncestors(pxr::UsdStagePtr stage, const std::vector<AuthoredAncestor>& authored);
+
+//! Validate the locations of a batch of prims before any of them are authored.
+//!
+//! An authoring error is reported for each path which is not an editable prim location, or which is requested more than once. Errors found by
+//! the caller while validating the other arguments of the batch are reported alongside these, in the order of the batch.
+//!
+//! @param context The call context of the batch function, to which the errors are attributed
+//! @param stage The stage on which the batch is being defined
+//! @param paths The absolute prim paths of the batch
+//! @param schemaName The name of the schema being defined, used in the error messages
+//! @param uniquePaths Populated with the unique paths of the batch, for use with `defineUndefinedAncestors`
+//! @param argumentErrors Optionally, an error message per entry of the batch, which is non-empty if the caller found its arguments invalid.
+//!     These are reported as `eInvalidArgument` errors for entries with valid locations.
+//! @returns Whether all of the locations and arguments are valid.
+bool validateBatchLocations(
+    const pxr::TfCallContext& context,
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPathVector& paths,
+    const char* schemaName,
+    std::unordered_set<pxr::SdfPath, pxr::SdfPath::Hash>* uniquePaths,
+    std::vector<std::string>* argumentErrors = nullptr
+);
+
+//! Validate the locations of a batch of prims of differing schemas before any of them are authored.
+//!
+//! @param schemaName Returns the name of the schema being defined by the entry at an index, used in the error messages
+//! @see The overload accepting a single schema name for the other parameters.
+bool validateBatchLocations(
+    const pxr::TfCallContext& context,
+    pxr::UsdStagePtr stage,
+    const pxr::SdfPathVector& paths,
+    const std::function<const char*(size_t)>& schemaName,
+    std::unordered_set<pxr::SdfPath, pxr::SdfPath::Hash>* uniquePaths,
+    std::vector<std::string>* argumentErrors = nullptr
+);
+
+//! Define a prim of a concrete schema type by authoring its specs directly, then return the composed prim.
+//!
+//! Ancestors of the prim which are not yet defined are authored as typeless prims, so the specs match those of `UsdSchema::Define`.
+//!
+//! @param stage The stage on which to define the prim
+//! @param path The absolute prim path at which to define the prim
+//! @param author A callable receiving a `PrimSpecWriter&` which authors the attributes of the prim
+//! @returns The schema wrapping the defined prim, or an invalid schema on error.
+template <typename SchemaType, typename AuthorFn>
+SchemaType defineWithSpecs(pxr::UsdStagePtr stage, const pxr::SdfPath& path, const AuthorFn& author)
+{
+    {
+        // The ancestors are authored within the same change block as the prim, so that change processing occurs once
+        pxr::SdfChangeBlock changeBlock;
+
+        // Ancestors which are not yet defined must be authored as typeless prims, as UsdStage::DefinePrim would
+        defineUndefinedAncestors(stage, { path });
+
+        PrimSpecWriter writer(stage, path, pxr::UsdSchemaRegistry::GetSchemaTypeName<SchemaType>());
+        if (!writer.isValid())
+        {
+            TF_RUNTIME_ERROR("Unable to define %s at \"%s\"", pxr::TfType::Find<SchemaType>().GetTypeName().c_str(), path.GetAsString().c_str());
+            return SchemaType();
+        }
+        author(writer);
+    }
+
+    // The change block has closed, so the stage has recomposed the new prim
+    return SchemaType(stage->GetPrimAtPath(path));
+}
+
+template <typename T>
+bool PrimSpecWriter::setPrimvar(const pxr::TfToken& name, const pxr::SdfValueTypeName& typeName, const PrimvarData<T>& primvar)
+{
+    return setPrimvarValue(
+        name,
+        typeName,
+        primvar.interpolation(),
+        pxr::VtValue(primvar.values()),
+        primvar.hasIndices() ? pxr::VtValue(primvar.indices()) : pxr::VtValue(pxr::SdfValueBlock()),
+        primvar.elementSize()
+    );
+}
+
+} // namespace usdex::core::detail
@@ -1,9 +1,207 @@
-// SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
 #include "usdex/core/PrimvarData.h"
 
+#include "usdex/core/ScratchArena.h"
+
+#include "Instrumentation.h"
+#include "PrimSpecWriter.h"
+
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace pxr;
+
+namespace
+{
+
+// Arrays smaller than this are indexed on the calling thread, as the overhead of sharding outweighs the benefit.
+static constexpr size_t s_parallelIndexThreshold = 1 << 16;
+
+static constexpr size_t s_hashGrainSize = 4096;
+
+static constexpr int s_emptySlot = -1;
+
+static constexpr size_t s_rangeGrainSize = 1 << 14;
+
+struct IndexRange
+{
+    int min = std::numeric_limits<int>::max();
+    int max = std::numeric_limits<int>::lowest();
+};
+
+// Reduce a range of indices to their minimum and maximum. The comparisons are branchless, so that the compiler is able to vectorize the loop.
+IndexRange reduceIndices(const int* indices, size_t begin, size_t end)
+{
+    int minIndex = std::numeric_limits<int>::max();
+    int maxIndex = std::numeric_limits<int>::lowest();
+    for (size_t i = begin; i < end; ++i)
+    {
+        const int index = indices[i];
+        minIndex = index < minIndex ? index : minIndex;
+        maxIndex = index > maxIndex ? index : maxIndex;
+    }
+    return { minIndex, maxIndex };
+}
+
+// Compute a power of two table capacity that keeps the load factor below 2/3, so that linear probe sequences remain short.
+size_t computeTableCapacity(size_t count)
+{
+    size_t capacity = 16;
+    while (capacity < count + count / 2)
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+// Find the first occurrence of each element whose hash belongs to the given shard, using a preallocated open-addressing table.
+// Elements are visited in ascending order, so the first element inserted for each value is its first occurrence in the whole sequence.
+// The table is allocated from the scratch arena of the thread processing the shard.
+void computeShardFirstOccurrences(
+    const size_t* hashes,
+    size_t size,
+    const std::function<bool(size_t, size_t)>& equal,
+    size_t shard,
+    size_t numShards,
+    int* firstOccurrences
+)
+{
+    size_t count = size;
+    if (numShards > 1)
+    {
+        count = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (hashes[i] % numShards == shard)
+            {
+                ++count;
+            }
+        }
+    }
+
+    const size_t mask = computeTableCapacity(count) - 1;
+    usdex::core::detail::ScratchArray<int> table(mask + 1, s_emptySlot);
+    for (size_t i = 0; i < size; ++i)
+    {
+        const size_t hash = hashes[i];
+        if (numShards > 1 && hash % numShards != shard)
+        {
+            continue;
+        }
+
+        for (size_t slot = (hash / numShards) & mask;; slot = (slot + 1) & mask)
+        {
+            const int candidate = table[slot];
+            if (candidate == s_emptySlot)
+            {
+                table[slot] = static_cast<int>(i);
+                firstOccurrences[i] = static_cast<int>(i);
+                break;
+            }
+            if (hashes[candidate] == hash && equal(size_t(candidate), i))
+            {
+                firstOccurrences[i] = candidate;
+                break;
+            }
+        }
+    }
+}
+
+// The number of values which may be addressed by compact 8 and 16 bit indices
+static constexpr size_t s_maxUint8Values = size_t(std::numeric_limits<uint8_t>::max()) + 1;
+
+static constexpr size_t s_maxUint16Values = size_t(std::numeric_limits<uint16_t>::max()) + 1;
+
+// Narrow indices which are known to be in range of the compact type
+template <typename U>
+VtArray<U> narrowIndices(const VtIntArray& indices)
+{
+    VtArray<U> result(indices.size());
+    const int* src = indices.cdata();
+    U* dst = result.data();
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        dst[i] = static_cast<U>(src[i]);
+    }
+    return result;
+}
+
+template <typename U>
+VtIntArray widenIndices(const VtArray<U>& indices)
+{
+    VtIntArray result(indices.size());
+    const U* src = indices.cdata();
+    int* dst = result.data();
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        dst[i] = static_cast<int>(src[i]);
+    }
+    return result;
+}
+
+template <typename A, typename B>
+bool indicesEqual(const VtArray<A>& a, const VtArray<B>& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+
+    const A* aData = a.cdata();
+    const B* bData = b.cdata();
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if (static_cast<int>(aData[i]) != static_cast<int>(bData[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The location of a primvar on the current edit target layer of its stage
+struct PrimvarSpec
+{
+    SdfLayerHandle layer;
+    SdfPath path;
+    SdfPath indicesPath;
+    SdfValueTypeName typeName;
+    SdfVariability variability;
+    SdfLayerOffset stageToLayerOffset;
+    bool hasAuthoredElementSize;
+};
+
+// Write a value directly to the edit target layer, avoiding the per value overhead of UsdAttribute::Set
+void setSpecValue(const PrimvarSpec& spec, const SdfPath& path, const VtValue& value, const UsdTimeCode& time)
+{
+    if (time.IsDefault())
+    {
+        spec.layer->SetField(path, SdfFieldKeys->Default, value);
+    }
+    else
+    {
+        spec.layer->SetTimeSample(path, spec.stageToLayerOffset * time.GetValue(), value);
+    }
+}
+
+} // namespace
+
 namespace usdex::core
 {
 
@@ -16,4 +214,415 @@ template class PrimvarData<pxr::TfToken>;
 template class PrimvarData<pxr::GfVec2f>;
 template class PrimvarData<pxr::GfVec3f>;
 
+template class PrimvarView<float>;
+template class PrimvarView<int64_t>;
+template class PrimvarView<int>;
+template class PrimvarView<std::string>;
+template class PrimvarView<pxr::TfToken>;
+template class PrimvarView<pxr::GfVec2f>;
+template class PrimvarView<pxr::GfVec3f>;
+
 } // namespace usdex::core
+
+usdex::core::detail::CompactIndexArray::CompactIndexArray(const CompactIndexArray& other) : m_uint8(other.m_uint8), m_uint16(other.m_uint16)
+{
+}
+
+usdex::core::detail::CompactIndexArray::CompactIndexArray(CompactIndexArray&& other) noexcept
+    : m_uint8(std::move(other.m_uint8)), m_uint16(std::move(other.m_uint16)), m_widened(other.m_widened.exchange(nullptr))
+{
+}
+
+usdex::core::detail::CompactIndexArray& usdex::core::detail::CompactIndexArray::operator=(const CompactIndexArray& other)
+{
+    if (this != &other)
+    {
+        m_uint8 = other.m_uint8;
+        m_uint16 = other.m_uint16;
+        delete m_widened.exchange(nullptr);
+    }
+    return *this;
+}
+
+usdex::core::detail::CompactIndexArray& usdex::core::detail::CompactIndexArray::operator=(CompactIndexArray&& other) noexcept
+{
+    if (this != &other)
+    {
+        m_uint8 = std::move(other.m_uint8);
+        m_uint16 = std::move(other.m_uint16);
+        delete m_widened.exchange(other.m_widened.exchange(nullptr));
+    }
+    return *this;
+}
+
+usdex::core::detail::CompactIndexArray::~CompactIndexArray()
+{
+    delete m_widened.load();
+}
+
+bool usdex::core::detail::CompactIndexArray::assign(const VtIntArray& indices, size_t valueCount)
+{
+    if (valueCount > s_maxUint16Values || !detail::indicesInRange(indices.cdata(), indices.size(), valueCount))
+    {
+        return false;
+    }
+
+    clear();
+    if (valueCount <= s_maxUint8Values)
+    {
+        m_uint8 = ::narrowIndices<uint8_t>(indices);
+    }
+    else
+    {
+        m_uint16 = ::narrowIndices<uint16_t>(indices);
+    }
+    return true;
+}
+
+void usdex::core::detail::CompactIndexArray::clear()
+{
+    m_uint8 = VtArray<uint8_t>();
+    m_uint16 = VtArray<uint16_t>();
+    delete m_widened.exchange(nullptr);
+}
+
+bool usdex::core::detail::CompactIndexArray::empty() const
+{
+    return m_uint8.empty() && m_uint16.empty();
+}
+
+size_t usdex::core::detail::CompactIndexArray::size() const
+{
+    return m_uint8.empty() ? m_uint16.size() : m_uint8.size();
+}
+
+size_t usdex::core::detail::CompactIndexArray::bytesPerIndex() const
+{
+    return m_uint8.empty() ? (m_uint16.empty() ? 0 : sizeof(uint16_t)) : sizeof(uint8_t);
+}
+
+VtIntArray usdex::core::detail::CompactIndexArray::widen() const
+{
+    return m_uint8.empty() ? ::widenIndices(m_uint16) : ::widenIndices(m_uint8);
+}
+
+const VtIntArray& usdex::core::detail::CompactIndexArray::widened() const
+{
+    if (VtIntArray* cached = m_widened.load(std::memory_order_acquire))
+    {
+        return *cached;
+    }
+
+    // Concurrent callers may each widen the indices, but only the first result is kept
+    VtIntArray* widened = new VtIntArray(widen());
+    VtIntArray* expected = nullptr;
+    if (!m_widened.compare_exchange_strong(expected, widened, std::memory_order_acq_rel))
+    {
+        delete widened;
+        return *expected;
+    }
+    return *widened;
+}
+
+bool usdex::core::detail::CompactIndexArray::isIdentical(const CompactIndexArray& other) const
+{
+    return m_uint8.IsIdentical(other.m_uint8) && m_uint16.IsIdentical(other.m_uint16);
+}
+
+bool usdex::core::detail::CompactIndexArray::operator==(const CompactIndexArray& other) const
+{
+    if (bytesPerIndex() == other.bytesPerIndex())
+    {
+        return m_uint8 == other.m_uint8 && m_uint16 == other.m_uint16;
+    }
+
+    // The widths differ, so one of the arrays holds 8 bit indices and the other holds 16 bit indices
+    return m_uint8.empty() ? ::indicesEqual(m_uint16, other.m_uint8) : ::indicesEqual(m_uint8, other.m_uint16);
+}
+
+bool usdex::core::detail::CompactIndexArray::operator==(const VtIntArray& other) const
+{
+    return m_uint8.empty() ? ::indicesEqual(m_uint16, other) : ::indicesEqual(m_uint8, other);
+}
+
+void usdex::core::detail::computeFirstOccurrences(
+    size_t size,
+    const std::function<size_t(size_t)>& hash,
+    const std::function<bool(size_t, size_t)>& equal,
+    int* firstOccurrences
+)
+{
+    USDEX_INSTRUMENT_SCOPE("PrimvarData::index");
+
+    if (size == 0)
+    {
+        return;
+    }
+
+    detail::ScratchArray<size_t> hashes(size);
+    if (size < s_parallelIndexThreshold || !WorkHasConcurrency())
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            hashes[i] = hash(i);
+        }
+        computeShardFirstOccurrences(hashes.data(), size, equal, 0, 1, firstOccurrences);
+        return;
+    }
+
+    WorkParallelForN(
+        size,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                hashes[i] = hash(i);
+            }
+        },
+        s_hashGrainSize
+    );
+
+    // Each value belongs to exactly one shard (by hash), so the shards can be deduplicated independently without synchronization
+    const size_t numShards = WorkGetConcurrencyLimit();
+    WorkParallelForN(
+        numShards,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t shard = begin; shard < end; ++shard)
+            {
+                computeShardFirstOccurrences(hashes.data(), size, equal, shard, numShards, firstOccurrences);
+            }
+        },
+        1
+    );
+}
+
+bool usdex::core::detail::indicesInRange(const int* indices, size_t size, size_t valueCount)
+{
+    if (size == 0)
+    {
+        return true;
+    }
+
+    IndexRange range;
+    if (size < s_parallelIndexThreshold || !WorkHasConcurrency())
+    {
+        range = reduceIndices(indices, 0, size);
+    }
+    else
+    {
+        // Each chunk is reduced independently and the partial ranges are combined on the calling thread
+        const size_t numChunks = (size + s_rangeGrainSize - 1) / s_rangeGrainSize;
+        std::vector<IndexRange> chunks(numChunks);
+        WorkParallelForN(
+            numChunks,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t chunk = begin; chunk < end; ++chunk)
+                {
+                    chunks[chunk] = reduceIndices(indices, chunk * s_rangeGrainSize, std::min(size, (chunk + 1) * s_rangeGrainSize));
+                }
+            },
+            1
+        );
+        for (const IndexRange& chunk : chunks)
+        {
+            range.min = std::min(range.min, chunk.min);
+            range.max = std::max(range.max, chunk.max);
+        }
+    }
+
+    return range.min >= 0 && size_t(range.max) < valueCount;
+}
+
+void usdex::core::detail::forEachConcurrently(size_t count, const std::function<void(size_t)>& fn)
+{
+    if (count < 2 || !WorkHasConcurrency())
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            fn(i);
+        }
+        return;
+    }
+
+    // Each element is expected to be expensive (e.g. reading a primvar), so every element is a separate task
+    WorkParallelForN(
+        count,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                fn(i);
+            }
+        },
+        1
+    );
+}
+
+std::vector<UsdGeomPrimvar> usdex::core::detail::getAuthoredPrimvars(const UsdPrim& prim, const TfTokenVector& names, const TfType& valueType)
+{
+    std::vector<UsdGeomPrimvar> result;
+    if (!prim)
+    {
+        return result;
+    }
+
+    for (const UsdGeomPrimvar& primvar : UsdGeomPrimvarsAPI(prim).GetAuthoredPrimvars())
+    {
+        if (primvar.GetTypeName().GetType() != valueType)
+        {
+            continue;
+        }
+        if (!names.empty() && std::find(names.begin(), names.end(), primvar.GetPrimvarName()) == names.end())
+        {
+            continue;
+        }
+        result.push_back(primvar);
+    }
+    return result;
+}
+
+bool usdex::core::detail::setPrimvarValues(const std::vector<UsdGeomPrimvar>& primvars, const std::vector<PrimvarValues>& values, UsdTimeCode time)
+{
+    USDEX_INSTRUMENT_SCOPE("PrimvarData::setPrimvars");
+
+    static const std::string s_indicesSuffix = "indices";
+
+    if (primvars.size() != values.size())
+    {
+        TF_RUNTIME_ERROR("Unable to set primvars due to a mismatched number of values: %zu for %zu primvars", values.size(), primvars.size());
+        return false;
+    }
+
+    // Validate every primvar before authoring any of them, so that a failure leaves the layer unchanged
+    std::vector<PrimvarSpec> specs;
+    specs.reserve(primvars.size());
+    for (size_t i = 0; i < primvars.size(); ++i)
+    {
+        const UsdGeomPrimvar& primvar = primvars[i];
+        if (!primvar)
+        {
+            TF_RUNTIME_ERROR("Unable to set primvars due to an invalid UsdGeomPrimvar at index %zu", i);
+            return false;
+        }
+
+        const UsdAttribute& attr = primvar.GetAttr();
+        const PrimvarValues& value = values[i];
+        if (!UsdGeomPrimvar::IsValidInterpolation(value.interpolation))
+        {
+            TF_CODING_ERROR(
+                "Unable to set primvar \"%s\" due to invalid interpolation \"%s\"",
+                attr.GetPath().GetAsString().c_str(),
+                value.interpolation.GetText()
+            );
+            return false;
+        }
+
+        const SdfValueTypeName typeName = primvar.GetTypeName();
+        if (value.values.GetType() != typeName.GetType())
+        {
+            TF_CODING_ERROR(
+                "Unable to set primvar \"%s\" due to mismatched value type: expected '%s', got '%s'",
+                attr.GetPath().GetAsString().c_str(),
+                typeName.GetType().GetTypeName().c_str(),
+                value.values.GetTypeName().c_str()
+            );
+            return false;
+        }
+
+        if (!value.indices.IsEmpty())
+        {
+            if (!value.indices.IsHolding<VtIntArray>())
+            {
+                TF_CODING_ERROR(
+                    "Unable to set primvar \"%s\" due to mismatched indices type: expected 'VtArray<int>', got '%s'",
+                    attr.GetPath().GetAsString().c_str(),
+                    value.indices.GetTypeName().c_str()
+                );
+                return false;
+            }
+
+            const VtIntArray& indices = value.indices.UncheckedGet<VtIntArray>();
+            if (!usdex::core::detail::indicesInRange(indices.cdata(), indices.size(), value.values.GetArraySize()))
+            {
+                TF_RUNTIME_ERROR(
+                    "Unable to set primvar \"%s\" due to indices outside the range of its %zu values",
+                    attr.GetPath().GetAsString().c_str(),
+                    value.values.GetArraySize()
+                );
+                return false;
+            }
+        }
+
+        const UsdEditTarget& editTarget = attr.GetStage()->GetEditTarget();
+        const SdfPath path = editTarget.MapToSpecPath(attr.GetPath());
+        specs.push_back(
+            PrimvarSpec{
+                editTarget.GetLayer(),
+                path,
+                path.GetPrimPath().AppendProperty(TfToken(SdfPath::JoinIdentifier(path.GetName(), s_indicesSuffix))),
+                typeName,
+                attr.GetVariability(),
+                editTarget.GetMapFunction().GetTimeOffset().GetInverse(),
+                primvar.HasAuthoredElementSize(),
+            }
+        );
+    }
+
+    SdfChangeBlock changeBlock;
+
+    // Acquire every spec before setting any values, so that a failure to author the specs leaves the values unchanged.
+    // New specs match the variability of the existing primvars.
+    std::vector<std::pair<SdfAttributeSpecHandle, SdfAttributeSpecHandle>> attrSpecs;
+    attrSpecs.reserve(specs.size());
+    for (const PrimvarSpec& spec : specs)
+    {
+        SdfAttributeSpecHandle attrSpec = usdex::core::detail::getOrCreateAttributeSpec(spec.layer, spec.path, spec.typeName, spec.variability);
+        SdfAttributeSpecHandle indicesSpec =
+            usdex::core::detail::getOrCreateAttributeSpec(spec.layer, spec.indicesPath, SdfValueTypeNames->IntArray, spec.variability);
+        if (!attrSpec || !indicesSpec)
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to set primvar \"%s\" due to a failure to author its specs on layer \"%s\"",
+                spec.path.GetAsString().c_str(),
+                spec.layer->GetIdentifier().c_str()
+            );
+            return false;
+        }
+        attrSpecs.emplace_back(attrSpec, indicesSpec);
+    }
+
+    for (size_t i = 0; i < specs.size(); ++i)
+    {
+        const PrimvarSpec& spec = specs[i];
+        const PrimvarValues& value = values[i];
+        const SdfAttributeSpecHandle& attrSpec = attrSpecs[i].first;
+
+        attrSpec->SetInfo(UsdGeomTokens->interpolation, VtValue(value.interpolation));
+        ::setSpecValue(spec, spec.path, value.values, time);
+
+        // Author an explicit opinion about the indices (or a block) to ensure weaker opinions are overriden
+        if (value.indices.IsEmpty())
+        {
+            spec.layer->EraseField(spec.indicesPath, SdfFieldKeys->TimeSamples);
+            spec.layer->SetField(spec.indicesPath, SdfFieldKeys->Default, VtValue(SdfValueBlock()));
+        }
+        else
+        {
+            ::setSpecValue(spec, spec.indicesPath, value.indices, time);
+        }
+
+        if (value.elementSize > 0)
+        {
+            attrSpec->SetInfo(UsdGeomTokens->elementSize, VtValue(value.elementSize));
+        }
+        else if (spec.hasAuthoredElementSize)
+        {
+            // if the elementSize was previously authored, we need to reset it as there is no way to block element size
+            attrSpec->SetInfo(UsdGeomTokens->elementSize, VtValue(1));
+        }
+    }
+
+    return true;
+}
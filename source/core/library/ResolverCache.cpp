@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ResolverCache.h"
+
+#include <pxr/base/tf/hash.h>
+
+#include <unordered_map>
+
+using namespace pxr;
+
+namespace
+{
+
+// Relative asset paths are anchored to the layer on which they are authored, and resolved within the context of the stage
+struct ExtensionKey
+{
+    std::string layer;
+    std::string assetPath;
+    ArResolverContext context;
+
+    bool operator==(const ExtensionKey& other) const
+    {
+        return layer == other.layer && assetPath == other.assetPath && context == other.context;
+    }
+};
+
+struct ExtensionKeyHash
+{
+    size_t operator()(const ExtensionKey& key) const
+    {
+        return TfHash::Combine(key.layer, key.assetPath, key.context);
+    }
+};
+
+struct ResolverCache
+{
+    size_t scopes = 0;
+    std::unordered_map<ExtensionKey, std::string, ExtensionKeyHash> extensions;
+};
+
+ResolverCache& getResolverCache()
+{
+    static thread_local ResolverCache s_cache;
+    return s_cache;
+}
+
+} // namespace
+
+usdex::core::detail::ResolverCacheScope::ResolverCacheScope()
+{
+    ++::getResolverCache().scopes;
+}
+
+usdex::core::detail::ResolverCacheScope::~ResolverCacheScope()
+{
+    ResolverCache& cache = ::getResolverCache();
+    if (--cache.scopes == 0)
+    {
+        cache.extensions.clear();
+    }
+}
+
+bool usdex::core::detail::ResolverCacheScope::isActive()
+{
+    return ::getResolverCache().scopes > 0;
+}
+
+bool usdex::core::detail::findResolvedExtension(
+    const SdfLayerHandle& layer,
+    const ArResolverContext& context,
+    const std::string& assetPath,
+    std::string* extension
+)
+{
+    const ResolverCache& cache = ::getResolverCache();
+    if (cache.scopes == 0 || !layer)
+    {
+        return false;
+    }
+
+    auto it = cache.extensions.find(ExtensionKey{ layer->GetIdentifier(), assetPath, context });
+    if (it == cache.extensions.end())
+    {
+        return false;
+    }
+    *extension = it->second;
+    return true;
+}
+
+void usdex::core::detail::storeResolvedExtension(
+    const SdfLayerHandle& layer,
+    const ArResolverContext& context,
+    const std::string& assetPath,
+    const std::string& extension
+)
+{
+    ResolverCache& cache = ::getResolverCache();
+    if (cache.scopes == 0 || !layer)
+    {
+        return;
+    }
+    cache.extensions.emplace(ExtensionKey{ layer->GetIdentifier(), assetPath, context }, extension);
+}
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <pxr/usd/ar/resolverContext.h>
+#include <pxr/usd/ar/resolverScopedCache.h>
+#include <pxr/usd/sdf/layer.h>
+
+#include <string>
+
+namespace usdex::core::detail
+{
+
+//! Caches asset resolution on the calling thread, for the lifetime of this object.
+//!
+//! The scope holds an `ArResolverScopedCache`, so that identifiers which are resolved repeatedly (e.g. the layer of a stage which is referenced
+//! by many prims) are resolved once. It also enables the cache of resolved extensions, via `findResolvedExtension` and `storeResolvedExtension`.
+//!
+//! The bulk authoring scopes of this library hold a `ResolverCacheScope`, as the assets they author are not expected to move while the scope is
+//! active. Scopes must be nested (i.e. destroyed in the reverse order of their construction) on the thread which constructed them.
+class ResolverCacheScope
+{
+
+public:
+
+    ResolverCacheScope();
+    ~ResolverCacheScope();
+
+    ResolverCacheScope(const ResolverCacheScope&) = delete;
+    ResolverCacheScope& operator=(const ResolverCacheScope&) = delete;
+
+    //! Whether a `ResolverCacheScope` is active on the calling thread.
+    static bool isActive();
+
+private:
+
+    pxr::ArResolverScopedCache m_cache;
+};
+
+//! Find the cached extension of the resolved path of an asset path, as authored on a layer.
+//!
+//! @param layer The layer on which the asset path is authored, which anchors relative asset paths
+//! @param context The resolver context of the stage
+//! @param assetPath The authored asset path
+//! @param extension Set to the cached extension, which is empty if the asset path did not resolve
+//! @returns Whether the extension was cached. This is always false unless a `ResolverCacheScope` is active.
+bool findResolvedExtension(
+    const pxr::SdfLayerHandle& layer,
+    const pxr::ArResolverContext& context,
+    const std::string& assetPath,
+    std::string* extension
+);
+
+//! Cache the extension of the resolved path of an asset path, as authored on a layer, until the outermost `ResolverCacheScope` ends.
+//!
+//! This is a no-op unless a `ResolverCacheScope` is active.
+//!
+//! @param layer The layer on which the asset path is authored, which anchors relative asset paths
+//! @param context The resolver context of the stage
+//! @param assetPath The authored asset path
+//! @param extension The extension of the resolved path
+void storeResolvedExtension(
+    const pxr::SdfLayerHandle& layer,
+    const pxr::ArResolverContext& context,
+    const std::string& assetPath,
+    const std::string& extension
+);
+
+} // namespace usdex::core::detail
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "usdex/core/ScratchArena.h"
+
+#include <pxr/base/tf/diagnostic.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace pxr;
+
+namespace
+{
+
+// The smallest block requested from the heap, so that many small temporaries are served by a single allocation
+static constexpr size_t s_minBlockSize = 16 * 1024;
+
+// The block of a zero sized allocation, which does not consume memory from any block
+static constexpr size_t s_noBlock = std::numeric_limits<size_t>::max();
+
+struct Block
+{
+    std::unique_ptr<std::byte[]> data;
+    size_t size;
+    size_t used;
+};
+
+struct Allocation
+{
+    size_t block;
+    size_t previousUsed;
+    bool released;
+};
+
+// Allocations are a stack which is served from the last block. Releasing an allocation restores the usage of its block to that before it.
+struct Arena
+{
+    std::vector<Block> blocks;
+    std::vector<Allocation> allocations;
+    size_t scopes = 0;
+
+    size_t capacity() const
+    {
+        size_t result = 0;
+        for (const Block& block : blocks)
+        {
+            result += block.size;
+        }
+        return result;
+    }
+
+    // Called whenever the last allocation is released
+    void trim()
+    {
+        if (scopes == 0)
+        {
+            blocks.clear();
+            allocations.shrink_to_fit();
+        }
+        else if (blocks.size() > 1)
+        {
+            // Coalesce the blocks, so that the next computation of a similar size is served by one block
+            const size_t size = capacity();
+            blocks.clear();
+            blocks.push_back(Block{ std::unique_ptr<std::byte[]>(new std::byte[size]), size, 0 });
+        }
+    }
+};
+
+Arena& getArena()
+{
+    static thread_local Arena s_arena;
+    return s_arena;
+}
+
+} // namespace
+
+usdex::core::ScratchArenaScope::ScratchArenaScope()
+{
+    ++::getArena().scopes;
+}
+
+usdex::core::ScratchArenaScope::~ScratchArenaScope()
+{
+    Arena& arena = ::getArena();
+    if (--arena.scopes == 0 && arena.allocations.empty())
+    {
+        arena.trim();
+    }
+}
+
+bool usdex::core::ScratchArenaScope::isActive()
+{
+    return ::getArena().scopes > 0;
+}
+
+size_t usdex::core::ScratchArenaScope::getCapacity()
+{
+    return ::getArena().capacity();
+}
+
+void* usdex::core::detail::allocateScratch(size_t bytes, size_t alignment, size_t* handle)
+{
+    TF_VERIFY(alignment > 0 && (alignment & (alignment - 1)) == 0 && alignment <= alignof(std::max_align_t));
+
+    Arena& arena = ::getArena();
+    *handle = arena.allocations.size();
+
+    if (bytes == 0)
+    {
+        arena.allocations.push_back(Allocation{ s_noBlock, 0, false });
+        return nullptr;
+    }
+
+    size_t offset = 0;
+    if (!arena.blocks.empty())
+    {
+        const Block& last = arena.blocks.back();
+        offset = (last.used + alignment - 1) & ~(alignment - 1);
+    }
+    if (arena.blocks.empty() || offset + bytes > arena.blocks.back().size)
+    {
+        // Grow geometrically, so that a sequence of allocations of increasing size requires few blocks
+        const size_t size = std::max({ bytes, s_minBlockSize, arena.blocks.empty() ? size_t(0) : arena.blocks.back().size * 2 });
+        arena.blocks.push_back(Block{ std::unique_ptr<std::byte[]>(new std::byte[size]), size, 0 });
+        offset = 0;
+    }
+
+    Block& block = arena.blocks.back();
+    arena.allocations.push_back(Allocation{ arena.blocks.size() - 1, block.used, false });
+    block.used = offset + bytes;
+    return block.data.get() + offset;
+}
+
+void usdex::core::detail::releaseScratch(size_t handle)
+{
+    Arena& arena = ::getArena();
+    if (!TF_VERIFY(handle < arena.allocations.size()))
+    {
+        return;
+    }
+
+    arena.allocations[handle].released = true;
+    while (!arena.allocations.empty() && arena.allocations.back().released)
+    {
+        const Allocation& allocation = arena.allocations.back();
+        if (allocation.block != s_noBlock)
+        {
+            arena.blocks[allocation.block].used = allocation.previousUsed;
+        }
+        arena.allocations.pop_back();
+    }
+
+    if (arena.allocations.empty())
+    {
+        arena.trim();
+    }
+}
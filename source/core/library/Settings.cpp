@@ -12,6 +12,10 @@ namespace usdex::core
 
 TF_DEFINE_ENV_SETTING(USDEX_ENABLE_TRANSCODING, true, "Use the transcoding bootstring implementation when validating Prim and Property names.");
 
+TF_DEFINE_ENV_SETTING(USDEX_VALID_NAME_CACHE_SIZE, 0, "The number of valid Prim and Property names to memoize. Zero disables memoization.");
+
+TF_DEFINE_ENV_SETTING(USDEX_ENABLE_INSTRUMENTATION, false, "Record performance counters in the instrumented functions of OpenUSD Exchange.");
+
 } // namespace usdex::core
 
 namespace
@@ -27,6 +31,8 @@ struct LoadSettings
     LoadSettings()
     {
         TfGetEnvSetting(usdex::core::USDEX_ENABLE_TRANSCODING);
+        TfGetEnvSetting(usdex::core::USDEX_VALID_NAME_CACHE_SIZE);
+        TfGetEnvSetting(usdex::core::USDEX_ENABLE_INSTRUMENTATION);
     }
 };
 
@@ -6,12 +6,33 @@
 
 #include "usdex/core/LayerAlgo.h"
 
+#include "Instrumentation.h"
+#include "LayerSnapshot.h"
+#include "ResolverCache.h"
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/stopwatch.h>
+#include <pxr/base/tf/weakBase.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/fileFormat.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stageCacheContext.h>
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdPhysics/metrics.h>
 #include <pxr/usd/usdUtils/authoring.h>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 using namespace pxr;
 
 namespace
@@ -119,6 +140,141 @@ bool uncheckedConfigureStage(
     return true;
 }
 
+// Validate the arguments of createStage and createUnsavedStage, emitting a warning on failure
+bool validateStageCreation(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits
+)
+{
+    // Early out on an unsupported identifier
+    if (identifier.empty() || !UsdStage::IsSupportedFile(identifier))
+    {
+        TF_WARN("Unable to create UsdStage at \"%s\" due to an invalid identifier", identifier.c_str());
+        return false;
+    }
+
+    // Early out on an invalid default prim name
+    if (!SdfPath::IsValidIdentifier(defaultPrimName))
+    {
+        TF_WARN(
+            "Unable to create UsdStage at \"%s\" due to an invalid default prim name: \"%s\" is not a valid identifier",
+            identifier.c_str(),
+            defaultPrimName.c_str()
+        );
+        return false;
+    }
+
+    // Early out on invalid stage metrics
+    std::string reason;
+    if (!validateStageMetrics(upAxis, linearUnits, massUnits, &reason))
+    {
+        TF_WARN("Unable to create UsdStage at \"%s\" due to invalid stage metrics: %s", identifier.c_str(), reason.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// Annotate the dirty layers of a stage with authoring metadata and a comment, prior to saving them
+SdfLayerHandleVector annotateDirtyLayers(UsdStagePtr stage, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
+{
+    SdfLayerHandleVector dirtyLayers = UsdUtilsGetDirtyLayers(stage);
+    if (authoringMetadata.has_value())
+    {
+        for (auto& layer : dirtyLayers)
+        {
+            if (!layer->IsAnonymous() && !usdex::core::hasLayerAuthoringMetadata(layer))
+            {
+                usdex::core::setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
+            }
+        }
+    }
+
+    if (comment.has_value())
+    {
+        TF_STATUS("Saving \"%s\" with comment \"%s\"", UsdDescribe(stage).c_str(), comment.value().data());
+        for (auto& layer : dirtyLayers)
+        {
+            if (!layer->IsAnonymous())
+            {
+                layer->SetComment(comment.value().data());
+            }
+        }
+    }
+    else
+    {
+        TF_STATUS("Saving \"%s\"", UsdDescribe(stage).c_str());
+    }
+
+    return dirtyLayers;
+}
+
+// Like UsdStage::Save, skip anonymous layers and layers in the session layer stack
+SdfLayerHandleVector getSaveableLayers(UsdStagePtr stage, const SdfLayerHandleVector& dirtyLayers)
+{
+    const SdfLayerHandleVector stageLayers = stage->GetLayerStack(/* includeSessionLayers */ false);
+    const SdfLayerHandleVector allLayers = stage->GetLayerStack(/* includeSessionLayers */ true);
+    std::set<SdfLayerHandle> sessionLayers(allLayers.begin(), allLayers.end());
+    for (const SdfLayerHandle& layer : stageLayers)
+    {
+        sessionLayers.erase(layer);
+    }
+
+    SdfLayerHandleVector layers;
+    for (const SdfLayerHandle& layer : dirtyLayers)
+    {
+        if (!layer->IsAnonymous() && sessionLayers.find(layer) == sessionLayers.end())
+        {
+            layers.push_back(layer);
+        }
+    }
+    return layers;
+}
+
+// Whether the ancestors of a prim location allow authoring, and if not, the ancestor which prevents it
+struct AncestorVerdict
+{
+    enum Kind
+    {
+        eEditable,
+        eInstance,
+        eInstanceProxy,
+    };
+
+    Kind kind = eEditable;
+    SdfPath ancestor;
+};
+
+// Walk up the path hierarchy from the parent path until we reach "/"
+AncestorVerdict computeAncestorVerdict(const UsdStagePtr& stage, const SdfPath& parentPath)
+{
+    for (SdfPath currentPath = parentPath; currentPath != SdfPath::AbsoluteRootPath(); currentPath = currentPath.GetParentPath())
+    {
+        const UsdPrim currentPrim = stage->GetPrimAtPath(currentPath);
+        if (currentPrim)
+        {
+            if (currentPrim.IsInstance())
+            {
+                return AncestorVerdict{ AncestorVerdict::eInstance, currentPath };
+            }
+            else if (currentPrim.IsInstanceProxy())
+            {
+                return AncestorVerdict{ AncestorVerdict::eInstanceProxy, currentPath };
+            }
+            else
+            {
+                // If we found a prim that is neither an instance nor an instance proxy,
+                // then the hierarchy above it is safe
+                return AncestorVerdict();
+            }
+        }
+    }
+    return AncestorVerdict();
+}
+
 } // namespace
 
 UsdStageRefPtr usdex::core::createStage(
@@ -140,32 +296,32 @@ UsdStageRefPtr usdex::core::createStage(
     const double linearUnits,
     const double massUnits,
     const std::string& authoringMetadata,
-    const SdfLayer::FileFormatArguments& fileFormatArgs
+    const LayerWriteOptions& writeOptions
 )
 {
-    // Early out on an unsupported identifier
-    if (identifier.empty() || !UsdStage::IsSupportedFile(identifier))
+    SdfLayer::FileFormatArguments fileFormatArgs;
+    std::string reason;
+    if (!getLayerWriteFileFormatArgs(identifier, writeOptions, &fileFormatArgs, &reason))
     {
-        TF_WARN("Unable to create UsdStage at \"%s\" due to an invalid identifier", identifier.c_str());
+        TF_WARN("Unable to create UsdStage at \"%s\" due to invalid write options: %s", identifier.c_str(), reason.c_str());
         return nullptr;
     }
 
-    // Early out on an invalid default prim name
-    if (!SdfPath::IsValidIdentifier(defaultPrimName))
-    {
-        TF_WARN(
-            "Unable to create UsdStage at \"%s\" due to an invalid default prim name: \"%s\" is not a valid identifier",
-            identifier.c_str(),
-            defaultPrimName.c_str()
-        );
-        return nullptr;
-    }
+    return createStage(identifier, defaultPrimName, upAxis, linearUnits, massUnits, authoringMetadata, fileFormatArgs);
+}
 
-    // Early out on invalid stage metrics
-    std::string reason;
-    if (!validateStageMetrics(upAxis, linearUnits, massUnits, &reason))
+UsdStageRefPtr usdex::core::createStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    if (!validateStageCreation(identifier, defaultPrimName, upAxis, linearUnits, massUnits))
     {
-        TF_WARN("Unable to create UsdStage at \"%s\" due to invalid stage metrics: %s", identifier.c_str(), reason.c_str());
         return nullptr;
     }
 
@@ -200,6 +356,67 @@ UsdStageRefPtr usdex::core::createStage(
     return UsdStage::Open(identifier);
 }
 
+UsdStageRefPtr usdex::core::createUnsavedStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const SdfLayer::FileFormatArguments& fileFormatArgs
+)
+{
+    USDEX_INSTRUMENT_SCOPE("createUnsavedStage");
+
+    if (!validateStageCreation(identifier, defaultPrimName, upAxis, linearUnits, massUnits))
+    {
+        return nullptr;
+    }
+
+    // Configure a temporary stage in memory, so that no layer is registered with the identifier in cases where failures occur
+    UsdStageRefPtr configured = UsdStage::CreateInMemory(identifier);
+    if (!uncheckedConfigureStage(configured, defaultPrimName, upAxis, linearUnits, massUnits, authoringMetadata))
+    {
+        return nullptr;
+    }
+
+    // Like createStage, an existing layer with the same identifier has its content replaced. Otherwise a new layer is created in memory only,
+    // unlike SdfLayer::CreateNew which would also write an empty file.
+    SdfLayerRefPtr layer = SdfLayer::Find(identifier, fileFormatArgs);
+    if (!layer)
+    {
+        layer = SdfLayer::New(SdfFileFormat::FindByExtension(identifier, fileFormatArgs), identifier, fileFormatArgs);
+        if (!layer)
+        {
+            return nullptr;
+        }
+    }
+    layer->TransferContent(configured->GetRootLayer());
+
+    return UsdStage::Open(layer);
+}
+
+UsdStageRefPtr usdex::core::createUnsavedStage(
+    const std::string& identifier,
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    const LayerWriteOptions& writeOptions
+)
+{
+    SdfLayer::FileFormatArguments fileFormatArgs;
+    std::string reason;
+    if (!getLayerWriteFileFormatArgs(identifier, writeOptions, &fileFormatArgs, &reason))
+    {
+        TF_WARN("Unable to create UsdStage at \"%s\" due to invalid write options: %s", identifier.c_str(), reason.c_str());
+        return nullptr;
+    }
+
+    return createUnsavedStage(identifier, defaultPrimName, upAxis, linearUnits, massUnits, authoringMetadata, fileFormatArgs);
+}
+
 bool usdex::core::configureStage(
     UsdStagePtr stage,
     const std::string& defaultPrimName,
@@ -247,35 +464,240 @@ bool usdex::core::configureStage(
 
 void usdex::core::saveStage(UsdStagePtr stage, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
 {
-    SdfLayerHandleVector dirtyLayers = UsdUtilsGetDirtyLayers(stage);
-    if (authoringMetadata.has_value())
+    USDEX_INSTRUMENT_SCOPE("saveStage");
+
+    annotateDirtyLayers(stage, authoringMetadata, comment);
+    stage->Save();
+}
+
+std::vector<usdex::core::LayerSaveReport> usdex::core::saveStageWithReport(
+    UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata,
+    std::optional<std::string_view> comment
+)
+{
+    USDEX_INSTRUMENT_SCOPE("saveStageWithReport");
+
+    std::vector<LayerSaveReport> reports;
+    if (!stage)
     {
-        for (auto& layer : dirtyLayers)
+        TF_RUNTIME_ERROR("Unable to save due to an invalid stage");
+        return reports;
+    }
+
+    const SdfLayerHandleVector dirtyLayers = annotateDirtyLayers(stage, authoringMetadata, comment);
+
+    const SdfLayerHandleVector layers = getSaveableLayers(stage, dirtyLayers);
+
+    // Each layer is serialized independently, so the layers can be saved concurrently
+    reports.resize(layers.size());
+    WorkParallelForN(
+        layers.size(),
+        [&layers, &reports](size_t begin, size_t end)
         {
-            if (!layer->IsAnonymous() && !hasLayerAuthoringMetadata(layer))
+            for (size_t i = begin; i < end; ++i)
             {
-                setLayerAuthoringMetadata(layer, authoringMetadata.value().data());
+                const SdfLayerHandle& layer = layers[i];
+                LayerSaveReport& report = reports[i];
+                report.identifier = layer->GetIdentifier();
+
+                TfStopwatch stopwatch;
+                stopwatch.Start();
+                report.saved = layer->Save();
+                stopwatch.Stop();
+                report.seconds = stopwatch.GetSeconds();
+
+                const std::string& realPath = layer->GetRealPath();
+                const int64_t length = realPath.empty() ? -1 : ArchGetFileLength(realPath.c_str());
+                report.bytesWritten = (report.saved && length > 0) ? length : 0;
             }
+        },
+        /* grainSize */ 1
+    );
+
+    return reports;
+}
+
+std::future<bool> usdex::core::saveStageAsync(
+    UsdStagePtr stage,
+    std::optional<std::string_view> authoringMetadata,
+    std::optional<std::string_view> comment
+)
+{
+    USDEX_INSTRUMENT_SCOPE("saveStageAsync");
+
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to save due to an invalid stage");
+        std::promise<bool> failure;
+        failure.set_value(false);
+        return failure.get_future();
+    }
+
+    const SdfLayerHandleVector dirtyLayers = annotateDirtyLayers(stage, authoringMetadata, comment);
+    const SdfLayerHandleVector layers = getSaveableLayers(stage, dirtyLayers);
+
+    // The snapshots are taken on the calling thread, so the stage may be edited as soon as this function returns
+    auto snapshots = std::make_shared<std::vector<detail::LayerSnapshot>>();
+    snapshots->reserve(layers.size());
+    for (const SdfLayerHandle& layer : layers)
+    {
+        snapshots->emplace_back(layer);
+    }
+
+    return detail::runSaveTask(
+        [snapshots]()
+        {
+            // Each snapshot is serialized independently, so the layers can be written concurrently
+            std::vector<char> saved(snapshots->size(), false);
+            WorkParallelForN(
+                snapshots->size(),
+                [&snapshots, &saved](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        saved[i] = (*snapshots)[i].write();
+                    }
+                },
+                /* grainSize */ 1
+            );
+            return std::all_of(saved.begin(), saved.end(), [](char value) { return value; });
         }
+    );
+}
+
+std::vector<usdex::core::LayerMemoryReport> usdex::core::computeStageMemoryReport(UsdStagePtr stage)
+{
+    USDEX_INSTRUMENT_SCOPE("computeStageMemoryReport");
+
+    std::vector<LayerMemoryReport> reports;
+    if (!stage)
+    {
+        TF_RUNTIME_ERROR("Unable to compute the memory report of an invalid stage");
+        return reports;
     }
 
-    if (comment.has_value())
+    SdfLayerHandleVector layers = stage->GetUsedLayers(/* includeClipLayers */ true);
+    std::sort(
+        layers.begin(),
+        layers.end(),
+        [](const SdfLayerHandle& a, const SdfLayerHandle& b) { return a->GetIdentifier() < b->GetIdentifier(); }
+    );
+
+    // Each layer is measured independently, so the layers can be measured concurrently
+    reports.resize(layers.size());
+    WorkParallelForN(
+        layers.size(),
+        [&layers, &reports](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                reports[i] = computeLayerMemoryReport(layers[i]);
+            }
+        },
+        /* grainSize */ 1
+    );
+
+    return reports;
+}
+
+class usdex::core::EditablePrimLocationScope::EditablePrimLocationScopeImpl : public TfWeakBase
+{
+
+public:
+
+    EditablePrimLocationScopeImpl(UsdStagePtr stage) : m_stage(stage), m_parent(s_current)
     {
-        TF_STATUS("Saving \"%s\" with comment \"%s\"", UsdDescribe(stage).c_str(), comment.value().data());
-        for (auto& layer : dirtyLayers)
+        s_current = this;
+        m_noticeKey = TfNotice::Register(TfCreateWeakPtr(this), &EditablePrimLocationScopeImpl::onObjectsChanged, UsdStageWeakPtr(stage));
+    }
+
+    ~EditablePrimLocationScopeImpl()
+    {
+        TfNotice::Revoke(m_noticeKey);
+        s_current = m_parent;
+    }
+
+    // The innermost scope for the stage on the calling thread, if any
+    static EditablePrimLocationScopeImpl* find(const UsdStagePtr& stage)
+    {
+        for (EditablePrimLocationScopeImpl* scope = s_current; scope != nullptr; scope = scope->m_parent)
         {
-            if (!layer->IsAnonymous())
+            if (scope->m_stage == stage)
             {
-                layer->SetComment(comment.value().data());
+                return scope;
             }
         }
-        stage->Save();
+        return nullptr;
     }
-    else
+
+    bool getVerdict(const SdfPath& parentPath, ::AncestorVerdict* verdict) const
     {
-        TF_STATUS("Saving \"%s\"", UsdDescribe(stage).c_str());
-        stage->Save();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_verdicts.find(parentPath);
+        if (it == m_verdicts.end())
+        {
+            return false;
+        }
+        *verdict = it->second;
+        return true;
+    }
+
+    void setVerdict(const SdfPath& parentPath, const ::AncestorVerdict& verdict)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_verdicts[parentPath] = verdict;
+    }
+
+private:
+
+    // A resync may change the composition (and so the instancing) of the resynced prims and all of their descendants.
+    // Defining a new child only resyncs the child, so the verdict for its parent remains valid.
+    void onObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender)
+    {
+        const UsdNotice::ObjectsChanged::PathRange resyncedPaths = notice.GetResyncedPaths();
+        if (resyncedPaths.empty())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_verdicts.begin(); it != m_verdicts.end();)
+        {
+            const bool resynced = std::any_of(
+                resyncedPaths.begin(),
+                resyncedPaths.end(),
+                [&it](const SdfPath& resyncedPath) { return it->first.HasPrefix(resyncedPath); }
+            );
+            it = resynced ? m_verdicts.erase(it) : std::next(it);
+        }
     }
+
+    UsdStagePtr m_stage;
+    EditablePrimLocationScopeImpl* m_parent;
+    TfNotice::Key m_noticeKey;
+    mutable std::mutex m_mutex;
+    std::unordered_map<SdfPath, ::AncestorVerdict, SdfPath::Hash> m_verdicts;
+
+    // The innermost scope of the calling thread, which links to the enclosing scopes
+    static thread_local EditablePrimLocationScopeImpl* s_current;
+};
+
+thread_local usdex::core::EditablePrimLocationScope::EditablePrimLocationScopeImpl*
+    usdex::core::EditablePrimLocationScope::EditablePrimLocationScopeImpl::s_current = nullptr;
+
+usdex::core::EditablePrimLocationScope::EditablePrimLocationScope(UsdStagePtr stage) : m_impl(new EditablePrimLocationScopeImpl(stage))
+{
+}
+
+usdex::core::EditablePrimLocationScope::~EditablePrimLocationScope()
+{
+    delete m_impl;
+}
+
+bool usdex::core::EditablePrimLocationScope::isActive(UsdStagePtr stage)
+{
+    return stage && EditablePrimLocationScopeImpl::find(stage) != nullptr;
 }
 
 bool usdex::core::isEditablePrimLocation(const UsdStagePtr stage, const SdfPath& path, std::string* reason)
@@ -311,48 +733,35 @@ bool usdex::core::isEditablePrimLocation(const UsdStagePtr stage, const SdfPath&
         return false;
     }
 
-    // Check if the path is the descendant of an instance
-    // Walk up the path hierarchy until we reach "/"
-    SdfPath currentPath = path.GetParentPath();
-    while (currentPath != SdfPath::AbsoluteRootPath())
+    // Check if the path is the descendant of an instance, reusing the verdict for the parent path when it is memoized
+    using Impl = EditablePrimLocationScope::EditablePrimLocationScopeImpl;
+    const SdfPath parentPath = path.GetParentPath();
+    Impl* scope = Impl::find(stage);
+    ::AncestorVerdict verdict;
+    if (!scope || !scope->getVerdict(parentPath, &verdict))
     {
-        const UsdPrim currentPrim = stage->GetPrimAtPath(currentPath);
-        if (currentPrim)
+        verdict = ::computeAncestorVerdict(stage, parentPath);
+        if (scope)
         {
-            if (currentPrim.IsInstance())
-            {
-                if (reason != nullptr)
-                {
-                    *reason = TfStringPrintf(
-                        "\"%s\" is a descendant of instance \"%s\", authoring is not allowed.",
-                        path.GetAsString().c_str(),
-                        currentPath.GetAsString().c_str()
-                    );
-                }
-                return false;
-            }
-            else if (currentPrim.IsInstanceProxy())
-            {
-                if (reason != nullptr)
-                {
-                    *reason = TfStringPrintf(
-                        "\"%s\" is a descendant of instance proxy \"%s\", authoring is not allowed.",
-                        path.GetAsString().c_str(),
-                        currentPath.GetAsString().c_str()
-                    );
-                }
-                return false;
-            }
-            else
-            {
-                // If we found a prim that is neither an instance nor an instance proxy,
-                // then the hierarchy above it is safe and we can return true
-                return true;
-            }
+            scope->setVerdict(parentPath, verdict);
         }
-        currentPath = currentPath.GetParentPath();
     }
-    return true;
+
+    if (verdict.kind == ::AncestorVerdict::eEditable)
+    {
+        return true;
+    }
+
+    if (reason != nullptr)
+    {
+        *reason = TfStringPrintf(
+            "\"%s\" is a descendant of %s \"%s\", authoring is not allowed.",
+            path.GetAsString().c_str(),
+            verdict.kind == ::AncestorVerdict::eInstance ? "instance" : "instance proxy",
+            verdict.ancestor.GetAsString().c_str()
+        );
+    }
+    return false;
 }
 
 bool usdex::core::isEditablePrimLocation(const UsdPrim& prim, const std::string& name, std::string* reason)
@@ -429,3 +838,349 @@ bool usdex::core::isEditablePrimLocation(const UsdPrim& prim, std::string* reaso
     const SdfPath& path = prim.GetPath();
     return isEditablePrimLocation(stage, path, reason);
 }
+
+class usdex::core::BulkAuthoringScope::BulkAuthoringScopeImpl
+{
+
+public:
+
+    BulkAuthoringScopeImpl(UsdStagePtr stage) : m_stage(stage), m_parent(s_current), m_locations(stage)
+    {
+        s_current = this;
+    }
+
+    ~BulkAuthoringScopeImpl()
+    {
+        s_current = m_parent;
+    }
+
+    static bool isActive(const UsdStagePtr& stage)
+    {
+        for (const BulkAuthoringScopeImpl* scope = s_current; scope != nullptr; scope = scope->m_parent)
+        {
+            if (scope->m_stage == stage)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+
+    UsdStagePtr m_stage;
+    BulkAuthoringScopeImpl* m_parent;
+    EditablePrimLocationScope m_locations;
+    usdex::core::detail::ResolverCacheScope m_resolverCache;
+
+    // The innermost scope of the calling thread, which links to the enclosing scopes
+    static thread_local BulkAuthoringScopeImpl* s_current;
+};
+
+thread_local usdex::core::BulkAuthoringScope::BulkAuthoringScopeImpl* usdex::core::BulkAuthoringScope::BulkAuthoringScopeImpl::s_current = nullptr;
+
+usdex::core::BulkAuthoringScope::BulkAuthoringScope(UsdStagePtr stage) : m_impl(new BulkAuthoringScopeImpl(stage))
+{
+}
+
+usdex::core::BulkAuthoringScope::~BulkAuthoringScope()
+{
+    delete m_impl;
+}
+
+bool usdex::core::BulkAuthoringScope::isActive(UsdStagePtr stage)
+{
+    return stage && BulkAuthoringScopeImpl::isActive(stage);
+}
+
+class usdex::core::SkipUnchangedValuesScope::SkipUnchangedValuesScopeImpl
+{
+
+public:
+
+    SkipUnchangedValuesScopeImpl(UsdStagePtr stage) : m_stage(stage), m_parent(s_current)
+    {
+        s_current = this;
+    }
+
+    ~SkipUnchangedValuesScopeImpl()
+    {
+        s_current = m_parent;
+    }
+
+    static bool isActive(const UsdStagePtr& stage)
+    {
+        for (const SkipUnchangedValuesScopeImpl* scope = s_current; scope != nullptr; scope = scope->m_parent)
+        {
+            if (scope->m_stage == stage)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Whether any scope is active on the calling thread, which avoids comparing stages in the common case.
+    static bool isAnyActive()
+    {
+        return s_current != nullptr;
+    }
+
+private:
+
+    UsdStagePtr m_stage;
+    SkipUnchangedValuesScopeImpl* m_parent;
+
+    // The innermost scope of the calling thread, which links to the enclosing scopes
+    static thread_local SkipUnchangedValuesScopeImpl* s_current;
+};
+
+thread_local usdex::core::SkipUnchangedValuesScope::SkipUnchangedValuesScopeImpl*
+    usdex::core::SkipUnchangedValuesScope::SkipUnchangedValuesScopeImpl::s_current = nullptr;
+
+usdex::core::SkipUnchangedValuesScope::SkipUnchangedValuesScope(UsdStagePtr stage) : m_impl(new SkipUnchangedValuesScopeImpl(stage))
+{
+}
+
+usdex::core::SkipUnchangedValuesScope::~SkipUnchangedValuesScope()
+{
+    delete m_impl;
+}
+
+bool usdex::core::SkipUnchangedValuesScope::isActive(UsdStagePtr stage)
+{
+    return SkipUnchangedValuesScopeImpl::isAnyActive() && stage && SkipUnchangedValuesScopeImpl::isActive(stage);
+}
+
+class usdex::core::StagePool::StagePoolImpl
+{
+
+public:
+
+    StagePoolImpl(
+        const std::string& defaultPrimName,
+        const TfToken& upAxis,
+        const double linearUnits,
+        const double massUnits,
+        const std::string& authoringMetadata,
+        size_t capacity
+    )
+        : m_authoringMetadata(authoringMetadata), m_capacity(capacity)
+    {
+        if (!SdfPath::IsValidIdentifier(defaultPrimName))
+        {
+            TF_WARN("Unable to create StagePool due to an invalid default prim name: \"%s\" is not a valid identifier", defaultPrimName.c_str());
+            return;
+        }
+
+        std::string reason;
+        if (!::validateStageMetrics(upAxis, linearUnits, massUnits, &reason))
+        {
+            TF_WARN("Unable to create StagePool due to invalid stage metrics: %s", reason.c_str());
+            return;
+        }
+
+        // The configured root layer is the template for the root layer of every stage in the pool
+        UsdStageRefPtr configured = UsdStage::CreateInMemory(s_tag);
+        if (::uncheckedConfigureStage(configured, defaultPrimName, upAxis, linearUnits, massUnits, std::string_view(authoringMetadata)))
+        {
+            m_template = configured->GetRootLayer();
+        }
+    }
+
+    bool isValid() const
+    {
+        return static_cast<bool>(m_template);
+    }
+
+    UsdStageRefPtr acquire()
+    {
+        if (!m_template)
+        {
+            TF_RUNTIME_ERROR("Unable to acquire a UsdStage from an invalid StagePool");
+            return nullptr;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            while (!m_idle.empty())
+            {
+                const UsdStageCache::Id id = m_idle.back();
+                m_idle.pop_back();
+                if (UsdStageRefPtr stage = m_cache.Find(id))
+                {
+                    return stage;
+                }
+            }
+        }
+
+        // The stage is only inserted in the cache of the pool, rather than any caches bound by the caller
+        SdfLayerRefPtr layer = SdfLayer::CreateAnonymous(s_tag);
+        layer->TransferContent(m_template);
+        UsdStageRefPtr stage;
+        {
+            UsdStageCacheContext block(UsdBlockStageCaches);
+            stage = UsdStage::Open(layer, UsdStage::LoadAll);
+        }
+        if (stage)
+        {
+            m_cache.Insert(stage);
+        }
+        return stage;
+    }
+
+    bool release(const UsdStagePtr& stage)
+    {
+        UsdStageCache::Id id;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            id = stage ? m_cache.GetId(stage) : UsdStageCache::Id();
+            if (!id.IsValid())
+            {
+                TF_RUNTIME_ERROR("Unable to release a UsdStage which was not acquired from this StagePool");
+                return false;
+            }
+            // A stage which is being released by another thread is also rejected, so that it can not be made idle twice
+            if (m_releasing.count(id.ToLongInt()) || std::find(m_idle.begin(), m_idle.end(), id) != m_idle.end())
+            {
+                TF_RUNTIME_ERROR("Unable to release \"%s\" as it has already been released to this StagePool", UsdDescribe(stage).c_str());
+                return false;
+            }
+            m_releasing.insert(id.ToLongInt());
+        }
+
+        // Reset the stage to the configured state. The pool is not locked while resetting, as the resulting notices may be handled by clients.
+        // Each of these recomposes the stage, so they are only reset when they have been changed.
+        if (!stage->GetMutedLayers().empty())
+        {
+            stage->MuteAndUnmuteLayers({}, stage->GetMutedLayers());
+        }
+        if (stage->GetPopulationMask() != UsdStagePopulationMask::All())
+        {
+            stage->SetPopulationMask(UsdStagePopulationMask::All());
+        }
+        if (stage->GetLoadRules() != UsdStageLoadRules::LoadAll())
+        {
+            stage->SetLoadRules(UsdStageLoadRules::LoadAll());
+        }
+        stage->SetEditTarget(UsdEditTarget(stage->GetRootLayer()));
+        {
+            SdfChangeBlock changeBlock;
+            if (SdfLayerHandle sessionLayer = stage->GetSessionLayer())
+            {
+                sessionLayer->Clear();
+            }
+            stage->GetRootLayer()->TransferContent(m_template);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_releasing.erase(id.ToLongInt());
+        if (m_idle.size() >= m_capacity)
+        {
+            m_cache.Erase(id);
+        }
+        else
+        {
+            m_idle.push_back(id);
+        }
+        return true;
+    }
+
+    bool save(
+        const UsdStagePtr& stage,
+        const std::string& identifier,
+        std::optional<std::string_view> comment,
+        const LayerWriteOptions& writeOptions
+    ) const
+    {
+        if (!stage || !m_cache.Contains(stage))
+        {
+            TF_RUNTIME_ERROR("Unable to save \"%s\" from a UsdStage which was not acquired from this StagePool", identifier.c_str());
+            return false;
+        }
+        return exportLayer(stage->GetRootLayer(), identifier, m_authoringMetadata, comment, writeOptions);
+    }
+
+    size_t getIdleCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_idle.size();
+    }
+
+    const UsdStageCache& getCache() const
+    {
+        return m_cache;
+    }
+
+private:
+
+    static constexpr const char* s_tag = "usdexStagePool.usda";
+
+    std::string m_authoringMetadata;
+    size_t m_capacity;
+    SdfLayerRefPtr m_template;
+
+    // The cache is thread safe, while the mutex guards the idle stages and the stages which are being reset by a release
+    UsdStageCache m_cache;
+    mutable std::mutex m_mutex;
+    std::vector<UsdStageCache::Id> m_idle;
+    std::unordered_set<long int> m_releasing;
+};
+
+usdex::core::StagePool::StagePool(
+    const std::string& defaultPrimName,
+    const TfToken& upAxis,
+    const double linearUnits,
+    const double massUnits,
+    const std::string& authoringMetadata,
+    size_t capacity
+)
+    : m_impl(new StagePoolImpl(defaultPrimName, upAxis, linearUnits, massUnits, authoringMetadata, capacity))
+{
+}
+
+usdex::core::StagePool::~StagePool()
+{
+    delete m_impl;
+}
+
+bool usdex::core::StagePool::isValid() const
+{
+    return m_impl->isValid();
+}
+
+UsdStageRefPtr usdex::core::StagePool::acquire()
+{
+    USDEX_INSTRUMENT_SCOPE("StagePool::acquire");
+
+    return m_impl->acquire();
+}
+
+bool usdex::core::StagePool::release(UsdStagePtr stage)
+{
+    USDEX_INSTRUMENT_SCOPE("StagePool::release");
+
+    return m_impl->release(stage);
+}
+
+bool usdex::core::StagePool::save(
+    UsdStagePtr stage,
+    const std::string& identifier,
+    std::optional<std::string_view> comment,
+    const LayerWriteOptions& writeOptions
+) const
+{
+    USDEX_INSTRUMENT_SCOPE("StagePool::save");
+
+    return m_impl->save(stage, identifier, comment, writeOptions);
+}
+
+size_t usdex::core::StagePool::getIdleCount() const
+{
+    return m_impl->getIdleCount();
+}
+
+const UsdStageCache& usdex::core::StagePool::getCache() const
+{
+    return m_impl->getCache();
+}
@@ -13,17 +13,18 @@ namespace
 {
 
 // Alternate implementation of TfMakeValidIdentifier
-std::string makeValidIdentifierExtended(const std::string& in)
+void makeValidIdentifierExtended(std::string_view in, std::string& result)
 {
-    std::string result;
+    result.clear();
 
     if (in.empty())
     {
         result.push_back('_');
-        return result;
+        return;
     }
 
-    char const* p = in.c_str();
+    const char* p = in.data();
+    const char* end = p + in.size();
 
     // This is where this function deviates from TfMakeValidIdentifier
     // For a numeric first character we push back "_[0-9]" rather than just "_"
@@ -47,7 +48,7 @@ std::string makeValidIdentifierExtended(const std::string& in)
         }
     }
 
-    for (++p; *p; ++p)
+    for (++p; p != end; ++p)
     {
         if (!(('a' <= *p && *p <= 'z') || ('A' <= *p && *p <= 'Z') || ('0' <= *p && *p <= '9') || *p == '_'))
         {
@@ -58,31 +59,37 @@ std::string makeValidIdentifierExtended(const std::string& in)
             result.push_back(*p);
         }
     }
-
-    return result;
 }
 
 } // namespace
 
 std::string usdex::core::detail::makeValidIdentifier(const std::string& in)
+{
+    // Valid identifiers are returned unchanged regardless of transcoding
+    if (usdex::core::detail::isASCIIIdentifier(in))
+    {
+        return in;
+    }
+
+    std::string out;
+    usdex::core::detail::makeValidIdentifier(in, out);
+    return out;
+}
+
+void usdex::core::detail::makeValidIdentifier(std::string_view in, std::string& out)
 {
     static bool s_enableTranscoding = TfGetEnvSetting(USDEX_ENABLE_TRANSCODING);
     if (s_enableTranscoding)
     {
-        std::string out = usdex::core::detail::encodeIdentifier(in, usdex::core::detail::TranscodingFormat::ASCII);
-        if (out.empty())
+        if (!usdex::core::detail::encodeIdentifier(in, usdex::core::detail::TranscodingFormat::ASCII, out))
         {
             // It is possible that the encoding fails, in which case we should fall back to replacing invalid characters.
-            TF_INFO(USDEX_TRANSCODING_ERROR).Msg("Boot string encoding of \"%s\" failed. Resorting to character substitution.\n", in.c_str());
-            return makeValidIdentifierExtended(in);
-        }
-        else
-        {
-            return out;
+            TF_INFO(USDEX_TRANSCODING_ERROR).Msg("Boot string encoding of \"%s\" failed. Resorting to character substitution.\n", std::string(in).c_str());
+            makeValidIdentifierExtended(in, out);
         }
     }
     else
     {
-        return makeValidIdentifierExtended(in);
+        makeValidIdentifierExtended(in, out);
     }
 }
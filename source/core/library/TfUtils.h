@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 namespace usdex::core::detail
 {
@@ -18,4 +19,12 @@ namespace usdex::core::detail
 //! @returns A string that is considered valid for use as an identifier.
 std::string makeValidIdentifier(const std::string& in);
 
+//! Produce a valid identifier from `in` into a caller supplied buffer.
+//!
+//! The buffer is cleared but its capacity is retained, so a single buffer can be reused to validate many identifiers without heap allocations.
+//!
+//! @param in The input value
+//! @param out The buffer that receives the valid identifier
+void makeValidIdentifier(std::string_view in, std::string& out);
+
 } // namespace usdex::core::detail
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -7,6 +7,14 @@
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/unicodeUtils.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USDEX_TRANSCODING_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define USDEX_TRANSCODING_NEON
+#include <arm_neon.h>
+#endif
+
 #include <algorithm>
 #include <array>
 #include <functional>
@@ -14,6 +22,7 @@
 #include <limits>
 #include <optional>
 #include <random>
+#include <string_view>
 #include <tuple>
 #include <unordered_set>
 #include <vector>
@@ -92,8 +101,20 @@ struct BinaryIndexedTree
     std::vector<size_t> tree;
     size_t most_significant_bit;
 
-    BinaryIndexedTree(const size_t n) : tree(n + 1, 0), most_significant_bit(0)
+    BinaryIndexedTree() : most_significant_bit(0)
     {
+    }
+
+    BinaryIndexedTree(const size_t n)
+    {
+        reset(n);
+    }
+
+    //! Reset the tree to hold `n` zero values, retaining the capacity of the storage
+    void reset(const size_t n)
+    {
+        tree.assign(n + 1, 0);
+        most_significant_bit = 0;
         size_t v = n + 1;
         while (v >>= 1)
         {
@@ -183,46 +204,202 @@ bool IsASCIIContinue(const uint32_t value)
     return ((value >= '0' && value <= '9') || (value >= 'A' && value <= 'Z') || (value == '_') || (value >= 'a' && value <= 'z'));
 }
 
-bool IsStart(const TfUtf8CodePoint value, const usdex::core::detail::TranscodingFormat format)
+// XID classification
+
+//! A two level bitmap of the XID_Start and XID_Continue properties of the code points of the Basic Multilingual Plane.
+//!
+//! This spares the binary searches of `TfIsUtf8CodePointXidStart` and `TfIsUtf8CodePointXidContinue` for the code points which dominate
+//! non-latin names (e.g. CJK ideographs and kana). Each block of 256 code points maps to a leaf holding 256 bits of each property. Most blocks
+//! are uniform (e.g. all ideographs, or all unassigned), so identical leaves are shared and the whole table occupies a few kilobytes.
+//!
+//! The leaves are generated from the OpenUSD functions once per process, rather than from a copy of the Unicode data, so the classification
+//! always matches the Unicode version of the OpenUSD build.
+class XidTable
+{
+public:
+
+    XidTable()
+    {
+        for (code_t block = 0; block < s_blockCount; ++block)
+        {
+            Leaf leaf = {};
+            for (code_t offset = 0; offset < s_blockSize; ++offset)
+            {
+                const code_t codePoint = block * s_blockSize + offset;
+                const uint64_t bit = static_cast<uint64_t>(1) << (offset % 64);
+                if (TfIsUtf8CodePointXidStart(codePoint))
+                {
+                    leaf.start[offset / 64] |= bit;
+                }
+                if (TfIsUtf8CodePointXidContinue(codePoint))
+                {
+                    leaf.continues[offset / 64] |= bit;
+                }
+            }
+
+            const auto it = std::find(m_leaves.begin(), m_leaves.end(), leaf);
+            m_blocks[block] = static_cast<uint16_t>(it - m_leaves.begin());
+            if (it == m_leaves.end())
+            {
+                m_leaves.push_back(leaf);
+            }
+        }
+    }
+
+    //! Whether a code point of the Basic Multilingual Plane has the XID_Start property
+    bool isStart(const code_t codePoint) const
+    {
+        const Leaf& leaf = m_leaves[m_blocks[codePoint / s_blockSize]];
+        return (leaf.start[(codePoint % s_blockSize) / 64] >> (codePoint % 64)) & 1;
+    }
+
+    //! Whether a code point of the Basic Multilingual Plane has the XID_Continue property
+    bool isContinue(const code_t codePoint) const
+    {
+        const Leaf& leaf = m_leaves[m_blocks[codePoint / s_blockSize]];
+        return (leaf.continues[(codePoint % s_blockSize) / 64] >> (codePoint % 64)) & 1;
+    }
+
+    static constexpr code_t s_planeSize = 0x10000;
+
+private:
+
+    static constexpr code_t s_blockSize = 256;
+    static constexpr code_t s_blockCount = s_planeSize / s_blockSize;
+
+    struct Leaf
+    {
+        std::array<uint64_t, s_blockSize / 64> start;
+        std::array<uint64_t, s_blockSize / 64> continues;
+
+        bool operator==(const Leaf& other) const
+        {
+            return start == other.start && continues == other.continues;
+        }
+    };
+
+    std::array<uint16_t, s_blockCount> m_blocks;
+    std::vector<Leaf> m_leaves;
+};
+
+const XidTable& getXidTable()
+{
+    static const XidTable s_table;
+    return s_table;
+}
+
+bool IsXidStart(const code_t value)
+{
+    return (value < XidTable::s_planeSize) ? getXidTable().isStart(value) : TfIsUtf8CodePointXidStart(value);
+}
+
+bool IsXidContinue(const code_t value)
+{
+    return (value < XidTable::s_planeSize) ? getXidTable().isContinue(value) : TfIsUtf8CodePointXidContinue(value);
+}
+
+bool IsStart(const code_t value, const usdex::core::detail::TranscodingFormat format)
 {
     if (format == usdex::core::detail::TranscodingFormat::ASCII)
     {
-        return IsASCIIStart(value.AsUInt32());
+        return IsASCIIStart(value);
     }
     else if (format == usdex::core::detail::TranscodingFormat::UTF8_XID)
     {
-        return IsASCIIStart(value.AsUInt32()) || TfIsUtf8CodePointXidStart(value);
+        return IsASCIIStart(value) || IsXidStart(value);
     }
     return false;
 }
 
-bool IsContinue(const TfUtf8CodePoint value, const usdex::core::detail::TranscodingFormat format)
+bool IsContinue(const code_t value, const usdex::core::detail::TranscodingFormat format)
 {
     if (format == usdex::core::detail::TranscodingFormat::ASCII)
     {
-        return IsASCIIContinue(value.AsUInt32());
+        return IsASCIIContinue(value);
     }
     else if (format == usdex::core::detail::TranscodingFormat::UTF8_XID)
     {
-        return TfIsUtf8CodePointXidContinue(value);
+        return IsASCIIContinue(value) || IsXidContinue(value);
     }
     return false;
 }
 
+// Identifier validation
+
+//! Whether all bytes of a 16 byte block are ASCII alphanumerics or underscores.
+//! Vectorized where SSE2 or NEON instructions are available, as most identifiers are already valid and this check dominates their encoding.
+bool isASCIIContinueBlock(const char* data)
+{
+#if defined(USDEX_TRANSCODING_SSE2)
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    // Signed comparisons reject all non-ASCII bytes, as they are negative
+    const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+    const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('Z' + 1)));
+    const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('z' + 1)));
+    const __m128i underscore = _mm_cmpeq_epi8(block, _mm_set1_epi8('_'));
+    const __m128i valid = _mm_or_si128(_mm_or_si128(digit, upper), _mm_or_si128(lower, underscore));
+    return _mm_movemask_epi8(valid) == 0xFFFF;
+#elif defined(USDEX_TRANSCODING_NEON)
+    const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(data));
+    const uint8x16_t digit = vandq_u8(vcgeq_u8(block, vdupq_n_u8('0')), vcleq_u8(block, vdupq_n_u8('9')));
+    const uint8x16_t upper = vandq_u8(vcgeq_u8(block, vdupq_n_u8('A')), vcleq_u8(block, vdupq_n_u8('Z')));
+    const uint8x16_t lower = vandq_u8(vcgeq_u8(block, vdupq_n_u8('a')), vcleq_u8(block, vdupq_n_u8('z')));
+    const uint8x16_t underscore = vceqq_u8(block, vdupq_n_u8('_'));
+    const uint8x16_t valid = vorrq_u8(vorrq_u8(digit, upper), vorrq_u8(lower, underscore));
+    return vminvq_u8(valid) == 0xFF;
+#else
+    for (size_t i = 0; i < 16; ++i)
+    {
+        if (!IsASCIIContinue(static_cast<unsigned char>(data[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
 // Bootstring
 
 //! Encodes variable length integers `number` and appends it to string `out`.
-void encodeVariableLength(std::ostringstream& oss, uint64_t number)
+void encodeVariableLength(std::string& out, uint64_t number)
 {
     base62_t threshold = BOOTSTRING_THRESHOLD;
     while (number >= threshold)
     {
         const base62_t digit = threshold + static_cast<base62_t>((number - threshold) % (BASE62 - threshold));
-        oss << encodeBase62(digit);
+        out.push_back(encodeBase62(digit));
         number = (number - threshold) / (BASE62 - threshold);
     }
     // number < threshold
-    oss << encodeBase62(static_cast<base62_t>(number));
+    out.push_back(encodeBase62(static_cast<base62_t>(number)));
+}
+
+//! Appends the UTF-8 encoding of a code point to string `out`.
+void appendCodePoint(std::string& out, const code_t codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
 }
 
 //! Decodes variable length integers starting at index.
@@ -275,47 +452,59 @@ std::optional<uint64_t> decodeVariableLength(TfUtf8CodePointIterator& it)
     return number;
 }
 
-std::optional<std::string> encodeBootstring(const std::string& inputString, const usdex::core::detail::TranscodingFormat format)
+//! The working storage of `encodeBootstring`, which is retained per thread so that encoding does not allocate once warmed up.
+struct EncodeBuffers
+{
+    std::vector<code_t> codePoints;
+    std::vector<std::tuple<uint32_t, size_t>> extendedCodes;
+    BinaryIndexedTree tree;
+};
+
+//! Encodes `inputString` and appends the result to string `out`.
+//! Returns false if the input string is not valid UTF-8 or the encoding overflows.
+bool encodeBootstring(std::string_view inputString, const usdex::core::detail::TranscodingFormat format, std::string& out)
 {
-    std::ostringstream oss;
-    size_t numberCodePoints = 0;
+    thread_local EncodeBuffers buffers;
+
+    // Decode the input once, as the code points are visited by each of the following passes
+    std::vector<code_t>& codePoints = buffers.codePoints;
+    codePoints.clear();
     for (const TfUtf8CodePoint value : TfUtf8CodePointView{ inputString })
     {
         if (value == TfUtf8InvalidCodePoint)
         {
-            return std::nullopt;
+            return false;
         }
-        if (IsContinue(value, format))
-        {
-            oss << TfUtf8CodePoint(value);
-        }
-        ++numberCodePoints;
+        codePoints.push_back(value.AsUInt32());
     }
 
-    if (oss.tellp() > 0)
-    {
-        oss << BOOTSTRING_DELIMITER;
-    }
-
-    BinaryIndexedTree tree(numberCodePoints);
-    std::vector<std::tuple<uint32_t, size_t>> extendedCodes;
+    // Classify each code point once, copying the basic code points and recording the position of each extended code point
+    const size_t start = out.size();
+    BinaryIndexedTree& tree = buffers.tree;
+    tree.reset(codePoints.size());
+    std::vector<std::tuple<uint32_t, size_t>>& extendedCodes = buffers.extendedCodes;
+    extendedCodes.clear();
     size_t encodedPoints = 0;
+    for (size_t codePosition = 0; codePosition < codePoints.size(); ++codePosition)
     {
-        size_t codePosition = 0;
-        for (const TfUtf8CodePoint value : TfUtf8CodePointView{ inputString })
+        const code_t codePoint = codePoints[codePosition];
+        if (IsContinue(codePoint, format))
         {
-            if (IsContinue(value, format))
-            {
-                tree.increase(codePosition);
-                ++encodedPoints;
-            }
-            else
-            {
-                extendedCodes.emplace_back(value.AsUInt32(), codePosition);
-            }
-            ++codePosition;
+            appendCodePoint(out, codePoint);
+            tree.increase(codePosition);
+            ++encodedPoints;
         }
+        else
+        {
+            extendedCodes.emplace_back(codePoint, codePosition);
+        }
+    }
+
+    if (out.size() > start)
+    {
+        out.push_back(BOOTSTRING_DELIMITER);
     }
+
     std::sort(extendedCodes.begin(), extendedCodes.end());
 
     code_t prevCodePoint = 0;
@@ -328,20 +517,30 @@ std::optional<std::string> encodeBootstring(const std::string& inputString, cons
         if (codePoint - prevCodePoint > (std::numeric_limits<uint64_t>::max() - delta) / (encodedPoints + 1))
         {
             // Overflow
-            return std::nullopt;
+            return false;
         }
         delta += (codePoint - prevCodePoint) * (encodedPoints + 1);
-        encodeVariableLength(oss, delta);
+        encodeVariableLength(out, delta);
         prevCodePoint = codePoint;
 
         tree.increase(codePosition);
         ++encodedPoints;
     }
 
-    return oss.str();
+    return true;
 }
 
-std::optional<std::string> decodeBootstring(const std::string& inputString)
+//! The working storage of `decodeBootstring`, which is retained per thread so that decoding does not allocate once warmed up.
+struct DecodeBuffers
+{
+    std::vector<std::tuple<uint32_t, size_t>> values;
+    std::vector<uint32_t> codePoints;
+    BinaryIndexedTree tree;
+};
+
+//! Decodes `inputString` and appends the result to string `out`.
+//! Returns false if the input string is not a valid bootstring encoding, in which case `out` may have been partially appended to.
+bool decodeBootstring(std::string_view inputString, std::string& out)
 {
     size_t delimiterPosition = 0;
     {
@@ -350,7 +549,7 @@ std::optional<std::string> decodeBootstring(const std::string& inputString)
         {
             if (value == TfUtf8InvalidCodePoint)
             {
-                return std::nullopt;
+                return false;
             }
             if (value == TfUtf8CodePointFromAscii(BOOTSTRING_DELIMITER))
             {
@@ -360,7 +559,9 @@ std::optional<std::string> decodeBootstring(const std::string& inputString)
         }
     }
 
-    std::vector<std::tuple<uint32_t, size_t>> values;
+    thread_local DecodeBuffers buffers;
+    std::vector<std::tuple<uint32_t, size_t>>& values = buffers.values;
+    values.clear();
     {
         auto it = TfUtf8CodePointView{ inputString }.begin();
         if (delimiterPosition > 0)
@@ -387,7 +588,7 @@ std::optional<std::string> decodeBootstring(const std::string& inputString)
             if (!ret)
             {
                 // Could not decode variable-length integer.
-                return std::nullopt;
+                return false;
             }
             const uint64_t value = *ret;
             codePoint += (code_t)(value / (decodedPoints + 1));
@@ -398,9 +599,11 @@ std::optional<std::string> decodeBootstring(const std::string& inputString)
         }
     }
 
-    BinaryIndexedTree tree(values.size());
+    BinaryIndexedTree& tree = buffers.tree;
+    tree.reset(values.size());
     tree.increaseAll();
-    std::vector<uint32_t> codePoints(values.size());
+    std::vector<uint32_t>& codePoints = buffers.codePoints;
+    codePoints.assign(values.size(), 0);
     for (auto it = values.rbegin(); it != values.rend(); ++it)
     {
         const code_t value = std::get<0>(*it);
@@ -408,60 +611,116 @@ std::optional<std::string> decodeBootstring(const std::string& inputString)
         const std::optional<size_t> ret = tree.lower(position + 1);
         if (!ret)
         {
-            return std::nullopt;
+            return false;
         }
         const size_t index = *ret;
         codePoints[index] = value;
         tree.decrease(index);
     }
-    std::ostringstream oss;
     for (const auto codePoint : codePoints)
     {
-        oss << TfUtf8CodePoint(codePoint);
+        // TfUtf8CodePoint replaces values which are not valid code points (e.g. surrogates) with the replacement character
+        appendCodePoint(out, TfUtf8CodePoint(codePoint).AsUInt32());
     }
-    return oss.str();
+    return true;
 }
 } // namespace
 
-std::string usdex::core::detail::encodeIdentifier(const std::string& inputString, const usdex::core::detail::TranscodingFormat format)
+bool usdex::core::detail::isASCIIIdentifier(std::string_view inputString)
 {
-    std::optional<std::string> ret = encodeBootstring(inputString, format);
-    if (!ret)
+    const size_t size = inputString.size();
+    if (size == 0 || !IsASCIIStart(static_cast<unsigned char>(inputString[0])))
     {
-        // Invalid input string, returns empty.
-        return "";
+        return false;
     }
-    const std::string& output = *ret;
-    std::string result;
-    result.append(BOOTSTRING_PREFIX);
-    result.append(output);
-    if (output == inputString + BOOTSTRING_DELIMITER) // i.e. unchanged.
+
+    const char* data = inputString.data();
+    size_t i = 1;
+    for (; i + 16 <= size; i += 16)
     {
-        const auto it = TfUtf8CodePointView{ inputString }.begin();
-        if (IsStart(*it, format))
+        if (!isASCIIContinueBlock(data + i))
         {
-            return inputString;
+            return false;
         }
-        else
+    }
+    for (; i < size; ++i)
+    {
+        if (!IsASCIIContinue(static_cast<unsigned char>(data[i])))
         {
-            return result;
+            return false;
         }
     }
+    return true;
+}
+
+bool usdex::core::detail::encodeIdentifier(std::string_view inputString, const TranscodingFormat format, std::string& output)
+{
+    output.clear();
+
+    // Valid ASCII identifiers are valid in all formats and are returned unchanged
+    if (isASCIIIdentifier(inputString))
+    {
+        output.append(inputString);
+        return true;
+    }
+
+    output.append(BOOTSTRING_PREFIX);
+    if (!encodeBootstring(inputString, format, output))
+    {
+        // Invalid input string, returns empty.
+        output.clear();
+        return false;
+    }
+
+    // If the encoding is the input followed by the delimiter the identifier is unchanged, it only needs to begin with a valid start character
+    const std::string_view encoded = std::string_view(output).substr(BOOTSTRING_PREFIX.size());
+    if (encoded.size() == inputString.size() + 1 && encoded.back() == BOOTSTRING_DELIMITER && encoded.substr(0, inputString.size()) == inputString)
+    {
+        const auto it = TfUtf8CodePointView{ inputString }.begin();
+        if (IsStart((*it).AsUInt32(), format))
+        {
+            output.assign(inputString);
+        }
+    }
+    return true;
+}
+
+std::string usdex::core::detail::encodeIdentifier(const std::string& inputString, const usdex::core::detail::TranscodingFormat format)
+{
+    std::string result;
+    usdex::core::detail::encodeIdentifier(std::string_view(inputString), format, result);
     return result;
 }
 
-std::string usdex::core::detail::decodeIdentifier(const std::string& inputString)
+bool usdex::core::detail::decodeIdentifier(std::string_view inputString, std::string& output)
 {
-    if (inputString.substr(0, 4) == BOOTSTRING_PREFIX)
+    output.clear();
+    if (inputString.substr(0, BOOTSTRING_PREFIX.size()) == BOOTSTRING_PREFIX)
     {
-        const std::string substr = inputString.substr(4, inputString.size() - 1);
-        const std::optional<std::string> ret = decodeBootstring(substr);
-        if (!ret)
+        if (decodeBootstring(inputString.substr(BOOTSTRING_PREFIX.size()), output))
         {
-            // Invalid input string, returns same string.
-            return inputString;
+            return true;
         }
-        return *ret;
+        // Invalid input string, returns same string.
+        output.clear();
     }
-    return inputString;
+    output.append(inputString);
+    return false;
+}
+
+std::string usdex::core::detail::decodeIdentifier(const std::string& inputString)
+{
+    std::string result;
+    usdex::core::detail::decodeIdentifier(std::string_view(inputString), result);
+    return result;
+}
+
+bool usdex::core::detail::isXidStart(uint32_t codePoint)
+{
+    return IsXidStart(codePoint);
+}
+
+bool usdex::core::detail::isXidContinue(uint32_t codePoint)
+{
+    return IsXidContinue(codePoint);
 }
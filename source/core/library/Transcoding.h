@@ -1,10 +1,12 @@
-// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 
 namespace usdex::core::detail
@@ -28,6 +30,24 @@ enum class TranscodingFormat
 //! @param format The format to apply in transcoding
 std::string encodeIdentifier(const std::string& inputString, const TranscodingFormat format);
 
+//! Encodes an identifier using the Bootstring algorithm into a caller supplied buffer.
+//!
+//! The buffer is cleared but its capacity is retained, so a single buffer can be reused to encode many identifiers without heap allocations.
+//!
+//! @param inputString The input string
+//! @param format The format to apply in transcoding
+//! @param output The buffer that receives the encoded identifier
+//! @returns False if the input string could not be encoded, in which case the buffer is left empty
+bool encodeIdentifier(std::string_view inputString, const TranscodingFormat format, std::string& output);
+
+//! Determine if a string is a valid ASCII identifier.
+//!
+//! A valid ASCII identifier is non-empty, begins with a letter or underscore and continues with letters, digits or underscores.
+//! Such identifiers are returned unchanged by `encodeIdentifier` in all formats.
+//!
+//! @param inputString The input string
+bool isASCIIIdentifier(std::string_view inputString);
+
 //! Decodes an identifier using the Bootstring algorithm.
 //! For more information see [Decoding
 //! Procedure](https://github.com/PixarAnimationStudios/OpenUSD-proposals/tree/main/proposals/transcoding_invalid_identifiers#decoding-procedure)
@@ -35,4 +55,27 @@ std::string encodeIdentifier(const std::string& inputString, const TranscodingFo
 //! @param inputString The input string
 std::string decodeIdentifier(const std::string& inputString);
 
+//! Decodes an identifier using the Bootstring algorithm into a caller supplied buffer.
+//!
+//! The buffer is cleared but its capacity is retained, so a single buffer can be reused to decode many identifiers without heap allocations.
+//!
+//! @param inputString The input string
+//! @param output The buffer that receives the decoded identifier, or a copy of the input string if it is not a valid encoding
+//! @returns True if the input string was an encoded identifier which has been decoded
+bool decodeIdentifier(std::string_view inputString, std::string& output);
+
+//! Determine if a code point has the XID_Start property, as classified by the `UTF8_XID` format.
+//!
+//! Code points of the Basic Multilingual Plane are classified by a bitmap generated from `TfIsUtf8CodePointXidStart`.
+//!
+//! @param codePoint The Unicode code point
+bool isXidStart(uint32_t codePoint);
+
+//! Determine if a code point has the XID_Continue property, as classified by the `UTF8_XID` format.
+//!
+//! Code points of the Basic Multilingual Plane are classified by a bitmap generated from `TfIsUtf8CodePointXidContinue`.
+//!
+//! @param codePoint The Unicode code point
+bool isXidContinue(uint32_t codePoint);
+
 } // namespace usdex::core::detail
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "UnchangedValues.h"
+
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+using namespace pxr;
+
+namespace
+{
+
+// Read the opinion of the edit target layer directly, as stronger opinions of other layers would mask the authored value
+bool getLayerValue(const UsdEditTarget& editTarget, const SdfPath& specPath, UsdTimeCode time, VtValue* value)
+{
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    if (time.IsDefault())
+    {
+        return layer->HasField(specPath, SdfFieldKeys->Default, value);
+    }
+
+    const SdfLayerOffset stageToLayerOffset = editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+    return layer->QueryTimeSample(specPath, stageToLayerOffset * time.GetValue(), value);
+}
+
+// VtValue equality requires matching types, and VtArray equality returns immediately for arrays which share a buffer
+bool matchesLayerValue(const UsdEditTarget& editTarget, const SdfPath& specPath, const VtValue& value, UsdTimeCode time)
+{
+    VtValue authored;
+    return ::getLayerValue(editTarget, specPath, time, &authored) && authored == value;
+}
+
+} // namespace
+
+bool usdex::core::detail::hasAuthoredValue(const UsdAttribute& attribute, const VtValue& value, UsdTimeCode time)
+{
+    if (!attribute || value.IsEmpty())
+    {
+        return false;
+    }
+
+    const UsdEditTarget& editTarget = attribute.GetStage()->GetEditTarget();
+    return ::matchesLayerValue(editTarget, editTarget.MapToSpecPath(attribute.GetPath()), value, time);
+}
+
+bool usdex::core::detail::hasAuthoredPrimvar(
+    const UsdGeomPrimvar& primvar,
+    const TfToken& interpolation,
+    const VtValue& values,
+    const VtValue& indices,
+    int elementSize,
+    UsdTimeCode time
+)
+{
+    static const std::string s_indicesSuffix = "indices";
+
+    const UsdAttribute& attr = primvar.GetAttr();
+    if (!attr || values.IsEmpty())
+    {
+        return false;
+    }
+
+    const UsdEditTarget& editTarget = attr.GetStage()->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    const SdfPath specPath = editTarget.MapToSpecPath(attr.GetPath());
+
+    VtValue authored;
+    if (!layer->HasField(specPath, UsdGeomTokens->interpolation, &authored) || authored != VtValue(interpolation))
+    {
+        return false;
+    }
+
+    // setPrimvar resets a previously authored element size to one, as there is no way to block it
+    if (elementSize > 0 || primvar.HasAuthoredElementSize())
+    {
+        const VtValue expected(elementSize > 0 ? elementSize : 1);
+        if (!layer->HasField(specPath, UsdGeomTokens->elementSize, &authored) || authored != expected)
+        {
+            return false;
+        }
+    }
+
+    if (!::matchesLayerValue(editTarget, specPath, values, time))
+    {
+        return false;
+    }
+
+    const SdfPath indicesPath = specPath.GetPrimPath().AppendProperty(TfToken(SdfPath::JoinIdentifier(specPath.GetName(), s_indicesSuffix)));
+    if (!indices.IsEmpty())
+    {
+        return ::matchesLayerValue(editTarget, indicesPath, indices, time);
+    }
+
+    // Unindexed data blocks the indices, which also clears any time samples
+    return layer->HasField(indicesPath, SdfFieldKeys->Default, &authored) && authored.IsHolding<SdfValueBlock>() &&
+           !layer->HasField(indicesPath, SdfFieldKeys->TimeSamples);
+}
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/PrimvarData.h"
+#include "usdex/core/StageAlgo.h"
+
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/primvar.h>
+
+namespace usdex::core::detail
+{
+
+//! Whether the current edit target layer already holds a value for an attribute.
+//!
+//! The default value of the spec is compared for the default time, otherwise the time sample at the time mapped through the edit target is
+//! compared. Values of differing types never match, even if `UsdAttribute::Set` would convert them.
+//!
+//! @param attribute The attribute to be authored
+//! @param value The value to be authored
+//! @param time The stage time at which the value is to be authored
+//! @returns Whether the edit target layer holds an equal value.
+bool hasAuthoredValue(const pxr::UsdAttribute& attribute, const pxr::VtValue& value, pxr::UsdTimeCode time);
+
+//! Whether the current edit target layer already holds all of the opinions authored by `PrimvarData::setPrimvar`.
+//!
+//! @param primvar The primvar to be authored
+//! @param interpolation The interpolation to be authored
+//! @param values The values to be authored
+//! @param indices The indices to be authored, or an empty value if the indices are to be blocked
+//! @param elementSize The element size to be authored, which is ignored if it is less than one and no element size is authored
+//! @param time The stage time at which the values and indices are to be authored
+//! @returns Whether the edit target layer holds equal opinions.
+bool hasAuthoredPrimvar(
+    const pxr::UsdGeomPrimvar& primvar,
+    const pxr::TfToken& interpolation,
+    const pxr::VtValue& values,
+    const pxr::VtValue& indices,
+    int elementSize,
+    pxr::UsdTimeCode time
+);
+
+//! Author the value of an attribute via `UsdAttribute::Set`, unless a `SkipUnchangedValuesScope` is active and the value is already authored.
+//!
+//! @param attribute The attribute to author
+//! @param value The value to author
+//! @param time The stage time at which to author the value
+//! @returns Whether the value was authored, or was already authored.
+template <typename T>
+bool setAttributeValue(const pxr::UsdAttribute& attribute, const T& value, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default())
+{
+    if (SkipUnchangedValuesScope::isActive(attribute.GetStage()) && hasAuthoredValue(attribute, pxr::VtValue(value), time))
+    {
+        return true;
+    }
+    return attribute.Set(value, time);
+}
+
+//! Author a primvar via `PrimvarData::setPrimvar`, unless a `SkipUnchangedValuesScope` is active and the primvar is already authored.
+//!
+//! @param primvar The primvar to author
+//! @param data The primvar data to author
+//! @param time The stage time at which to author the values and indices
+//! @returns Whether the primvar was authored, or was already authored.
+template <typename T>
+bool setPrimvarData(pxr::UsdGeomPrimvar& primvar, const PrimvarData<T>& data, pxr::UsdTimeCode time = pxr::UsdTimeCode::Default())
+{
+    if (SkipUnchangedValuesScope::isActive(primvar.GetAttr().GetStage()) &&
+        hasAuthoredPrimvar(
+            primvar,
+            data.interpolation(),
+            pxr::VtValue(data.values()),
+            data.hasIndices() ? pxr::VtValue(data.indices()) : pxr::VtValue(),
+            data.elementSize(),
+            time
+        ))
+    {
+        return true;
+    }
+    return data.setPrimvar(primvar, time);
+}
+
+} // namespace usdex::core::detail
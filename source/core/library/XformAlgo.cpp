@@ -6,12 +6,28 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "AuthoringErrors.h"
+#include "Instrumentation.h"
+#include "UnchangedValues.h"
+
+#include <pxr/base/gf/matrix3d.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/layerOffset.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/editTarget.h>
 #include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 #include <pxr/usd/usdGeom/xformOp.h>
 #include <pxr/usd/usdGeom/xformable.h>
 
+#include <array>
+#include <cmath>
+
 using namespace pxr;
 
 namespace
@@ -28,15 +44,15 @@ bool setValueWithPrecision(UsdGeomXformOp& xformOp, const ValueType& value, cons
     {
         case UsdGeomXformOp::PrecisionHalf:
         {
-            return xformOp.Set(HalfType(FloatType(value)), time);
+            return usdex::core::detail::setAttributeValue(xformOp.GetAttr(), HalfType(FloatType(value)), time);
         }
         case UsdGeomXformOp::PrecisionFloat:
         {
-            return xformOp.Set(FloatType(value), time);
+            return usdex::core::detail::setAttributeValue(xformOp.GetAttr(), FloatType(value), time);
         }
         case UsdGeomXformOp::PrecisionDouble:
         {
-            return xformOp.Set(DoubleType(value), time);
+            return usdex::core::detail::setAttributeValue(xformOp.GetAttr(), DoubleType(value), time);
         }
     }
     return false;
@@ -182,6 +198,58 @@ GfMatrix4d computeMatrixFromComponents(
     return transform.GetMatrix();
 }
 
+// Rows of the upper 3x3 of a matrix which are orthogonal to within this tolerance, relative to their lengths, are considered unsheared
+static constexpr double s_orthogonalTolerance = 1e-10;
+
+// Arrays of matrices smaller than this are decomposed on the calling thread, as the overhead of scheduling tasks outweighs the benefit
+static constexpr size_t s_parallelMatrixThreshold = 1 << 12;
+
+static constexpr size_t s_matrixGrainSize = 1 << 10;
+
+// Factor a matrix without shear or perspective into its scale, rotation, and translation in closed form.
+// GfTransform factors every matrix via an iterative polar decomposition, which reduces to this result when the rows of the upper 3x3 are orthogonal
+// and its determinant is positive. Any other matrix is rejected, and must be factored by GfTransform.
+bool factorUnshearedMatrix(const GfMatrix4d& matrix, GfVec3d& scale, GfRotation& rotation, GfVec3d& translation)
+{
+    if (matrix[0][3] != 0.0 || matrix[1][3] != 0.0 || matrix[2][3] != 0.0 || matrix[3][3] != 1.0)
+    {
+        return false;
+    }
+
+    GfVec3d rows[3];
+    for (size_t i = 0; i < 3; ++i)
+    {
+        rows[i] = GfVec3d(matrix[i][0], matrix[i][1], matrix[i][2]);
+        scale[i] = rows[i].GetLength();
+        if (scale[i] == 0.0)
+        {
+            return false;
+        }
+    }
+
+    if (std::abs(GfDot(rows[0], rows[1])) > s_orthogonalTolerance * scale[0] * scale[1] ||
+        std::abs(GfDot(rows[0], rows[2])) > s_orthogonalTolerance * scale[0] * scale[2] ||
+        std::abs(GfDot(rows[1], rows[2])) > s_orthogonalTolerance * scale[1] * scale[2])
+    {
+        return false;
+    }
+
+    // A negative determinant is factored by GfTransform as a negative scale of every axis, so it is left to GfTransform
+    GfMatrix3d rotationMatrix;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        rotationMatrix.SetRow(i, rows[i] / scale[i]);
+    }
+    if (rotationMatrix.GetDeterminant() <= 0.0)
+    {
+        return false;
+    }
+
+    rotation = rotationMatrix.ExtractRotation();
+    translation = matrix.ExtractTranslation();
+    return true;
+}
+
 // Given a 4x4 matrix compute the values of common components
 void computeComponentsFromMatrix(
     const GfMatrix4d& matrix,
@@ -192,6 +260,18 @@ void computeComponentsFromMatrix(
     GfVec3f& scale
 )
 {
+    // The common case of scale, rotation, and translation is factored in closed form. GfTransform never produces a pivot position from a matrix.
+    GfVec3d factoredScale;
+    GfRotation factoredRotation;
+    if (factorUnshearedMatrix(matrix, factoredScale, factoredRotation, translation))
+    {
+        pivot.Set(0.0, 0.0, 0.0);
+        rotation = GfVec3f(computeXyzRotationsFromRotation(factoredRotation));
+        rotationOrder = usdex::core::RotationOrder::eXyz;
+        scale = GfVec3f(factoredScale);
+        return;
+    }
+
     // Get the components from the transform and cast to the expected precision
     const GfTransform transform = GfTransform(matrix);
     translation = transform.GetTranslation();
@@ -208,6 +288,16 @@ void computeComponentsFromMatrix(
 // Given a 4x4 matrix compute the values of common components with orientation instead of rotation
 void computeComponentsFromMatrix(const GfMatrix4d& matrix, GfVec3d& translation, GfVec3d& pivot, GfQuatf& orientation, GfVec3f& scale)
 {
+    GfVec3d factoredScale;
+    GfRotation factoredRotation;
+    if (factorUnshearedMatrix(matrix, factoredScale, factoredRotation, translation))
+    {
+        pivot.Set(0.0, 0.0, 0.0);
+        orientation = GfQuatf(factoredRotation.GetQuat());
+        scale = GfVec3f(factoredScale);
+        return;
+    }
+
     // Get the components from the transform
     const GfTransform transform = GfTransform(matrix);
     translation = transform.GetTranslation();
@@ -287,6 +377,80 @@ bool getMatrixXformOp(const std::vector<UsdGeomXformOp>& xformOps, UsdGeomXformO
     return false;
 }
 
+// Returns whether the authored xformOps exactly match an xformOpOrder and are all defined
+bool matchesXformOpOrder(const std::vector<UsdGeomXformOp>& xformOps, const std::vector<TfToken>& xformOpOrder)
+{
+    if (xformOps.size() != xformOpOrder.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < xformOps.size(); ++i)
+    {
+        if (xformOps[i].GetOpName() != xformOpOrder[i] || !xformOps[i].IsDefined())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Returns the xformOpOrder authored by UsdGeomXformCommonAPI::CreateXformOps for a translate, pivot, rotate and scale using a rotation order
+const std::vector<TfToken>& getCommonXformOpOrder(const usdex::core::RotationOrder rotationOrder)
+{
+    static const std::array<std::vector<TfToken>, 6> s_xformOpOrders = []()
+    {
+        static const TfToken pivotSuffix("pivot");
+        std::array<std::vector<TfToken>, 6> xformOpOrders;
+        for (size_t i = 0; i < xformOpOrders.size(); ++i)
+        {
+            const UsdGeomXformOp::Type rotateOpType = UsdGeomXformCommonAPI::ConvertRotationOrderToOpType(
+                convertRotationOrder(static_cast<usdex::core::RotationOrder>(i))
+            );
+            xformOpOrders[i] = {
+                UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeTranslate),
+                UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeTranslate, pivotSuffix),
+                UsdGeomXformOp::GetOpName(rotateOpType),
+                UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeScale),
+                UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeTranslate, pivotSuffix, /* inverse */ true),
+            };
+        }
+        return xformOpOrders;
+    }();
+
+    return s_xformOpOrders[static_cast<size_t>(rotationOrder)];
+}
+
+// Returns the xformOpOrder authored by setLocalTransform for a translate, orient and scale
+const std::vector<TfToken>& getOrientXformOpOrder()
+{
+    static const std::vector<TfToken> s_xformOpOrder = {
+        UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeTranslate),
+        UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeOrient),
+        UsdGeomXformOp::GetOpName(UsdGeomXformOp::TypeScale),
+    };
+    return s_xformOpOrder;
+}
+
+// Set the values of xformOps matching the common xformOpOrder, allowing setValueWithPrecision to handle any value type conversions
+// The inverse pivot xformOp has no value of its own, so nothing needs to be authored on it
+template <class RotationType, class ScaleType>
+void setCommonXformOpValues(
+    std::vector<UsdGeomXformOp>& xformOps,
+    const GfVec3d& translation,
+    const GfVec3d& pivot,
+    const RotationType& rotation,
+    const ScaleType& scale,
+    const UsdTimeCode& time
+)
+{
+    setValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, GfVec3d>(xformOps[0], translation, time);
+    setValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, GfVec3d>(xformOps[1], pivot, time);
+    setValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, RotationType>(xformOps[2], rotation, time);
+    setValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, ScaleType>(xformOps[3], scale, time);
+}
+
 // Ensure that there is an opinion about the xformOpOrder value in the current edit target layer
 void ensureXformOpOrderExplicitlyAuthored(UsdGeomXformable& xformable)
 {
@@ -344,6 +508,91 @@ void removeUnusedXformOps(UsdGeomXformable& xformable)
     }
 }
 
+// Cast a value to the precision of an xformOp
+template <class HalfType, class FloatType, class DoubleType, class ValueType>
+VtValue castValueWithPrecision(const UsdGeomXformOp::Precision precision, const ValueType& value)
+{
+    switch (precision)
+    {
+        case UsdGeomXformOp::PrecisionHalf:
+        {
+            return VtValue(HalfType(FloatType(value)));
+        }
+        case UsdGeomXformOp::PrecisionFloat:
+        {
+            return VtValue(FloatType(value));
+        }
+        case UsdGeomXformOp::PrecisionDouble:
+        {
+            return VtValue(DoubleType(value));
+        }
+    }
+    return VtValue();
+}
+
+// The location in the edit target layer at which to write the values of an xformOp
+struct XformOpSpec
+{
+    SdfLayerHandle layer;
+    SdfPath path;
+    SdfLayerOffset stageToLayerOffset;
+    UsdGeomXformOp::Precision precision;
+};
+
+XformOpSpec getXformOpSpec(const UsdGeomXformOp& xformOp)
+{
+    const UsdEditTarget& editTarget = xformOp.GetAttr().GetStage()->GetEditTarget();
+    return XformOpSpec{
+        editTarget.GetLayer(),
+        editTarget.MapToSpecPath(xformOp.GetAttr().GetPath()),
+        editTarget.GetMapFunction().GetTimeOffset().GetInverse(),
+        xformOp.GetPrecision(),
+    };
+}
+
+// Write a value directly to the edit target layer, avoiding the per value overhead of UsdAttribute::Set
+// The caller is expected to have authored the attribute spec already
+void setXformOpSpecValue(const XformOpSpec& spec, const VtValue& value, const UsdTimeCode& time)
+{
+    if (time.IsDefault())
+    {
+        spec.layer->SetField(spec.path, SdfFieldKeys->Default, value);
+    }
+    else
+    {
+        spec.layer->SetTimeSample(spec.path, spec.stageToLayerOffset * time.GetValue(), value);
+    }
+}
+
+// Validate the arguments to setLocalTransforms, reporting an error for the first mismatch
+bool validateLocalTransforms(const std::vector<UsdPrim>& prims, const std::vector<UsdTimeCode>& times, const size_t numValues, const char* valueName)
+{
+    if (numValues != prims.size() * times.size())
+    {
+        TF_RUNTIME_ERROR(
+            "Unable to set local transforms due to a mismatched number of %s: %zu for %zu prims at %zu times",
+            valueName,
+            numValues,
+            prims.size(),
+            times.size()
+        );
+        return false;
+    }
+    return true;
+}
+
+bool validateXformablePrims(const std::vector<UsdPrim>& prims)
+{
+    for (const UsdPrim& prim : prims)
+    {
+        if (!UsdGeomXformable(prim))
+        {
+            TF_RUNTIME_ERROR("Unable to set local transforms on \"%s\" as it is not xformable", prim.GetPath().GetAsString().c_str());
+            return false;
+        }
+    }
+    return true;
+}
 
 } // namespace
 
@@ -376,14 +625,22 @@ bool usdex::core::setLocalTransform(UsdPrim prim, const GfTransform& transform,
             if (getMatrixXformOp(xformOps, &transformXformOp) && transformXformOp.IsDefined())
             {
                 const GfMatrix4d matrix = transform.GetMatrix();
-                transformXformOp.Set(matrix, time);
+                detail::setAttributeValue(transformXformOp.GetAttr(), matrix, time);
                 ensureXformOpOrderExplicitlyAuthored(xformable);
 
                 return true;
             }
         }
 
-        // FUTURE: Attempt to reuse existing UsdGeomXformCommonAPI xformOps
+        // Set the values on existing UsdGeomXformCommonAPI xformOps if they are already authored in the expected order
+        if (needsXformCommonAPI && matchesXformOpOrder(xformOps, getCommonXformOpOrder(usdex::core::RotationOrder::eXyz)))
+        {
+            const GfVec3d rotation = computeXyzRotationsFromRotation(transform.GetRotation());
+            setCommonXformOpValues(xformOps, transform.GetTranslation(), transform.GetPivotPosition(), rotation, transform.GetScale(), time);
+            ensureXformOpOrderExplicitlyAuthored(xformable);
+
+            return true;
+        }
     }
 
     // Author using UsdGeomXformCommonAPI if appropriate
@@ -420,7 +677,7 @@ bool usdex::core::setLocalTransform(UsdPrim prim, const GfTransform& transform,
     // Modify the xformOpOrder and set xformOp values to achieve the transform
     const GfMatrix4d matrix = transform.GetMatrix();
     UsdGeomXformOp transformXformOp = xformable.MakeMatrixXform();
-    transformXformOp.Set(matrix, time);
+    detail::setAttributeValue(transformXformOp.GetAttr(), matrix, time);
     ensureXformOpOrderExplicitlyAuthored(xformable);
 
     return true;
@@ -444,7 +701,7 @@ bool usdex::core::setLocalTransform(UsdPrim prim, const GfMatrix4d& matrix, UsdT
         UsdGeomXformOp transformXformOp;
         if (getMatrixXformOp(xformOps, &transformXformOp) && transformXformOp.IsDefined())
         {
-            transformXformOp.Set(matrix, time);
+            detail::setAttributeValue(transformXformOp.GetAttr(), matrix, time);
             ensureXformOpOrderExplicitlyAuthored(xformable);
 
             return true;
@@ -456,7 +713,7 @@ bool usdex::core::setLocalTransform(UsdPrim prim, const GfMatrix4d& matrix, UsdT
     // Assuming there is no existing compatible xformOpOrder
     // Modify the xformOpOrder to use the most expressive xformOp stack and set xformOp values to achieve the transform
     UsdGeomXformOp transformXformOp = xformable.MakeMatrixXform();
-    transformXformOp.Set(matrix, time);
+    detail::setAttributeValue(transformXformOp.GetAttr(), matrix, time);
     ensureXformOpOrderExplicitlyAuthored(xformable);
 
     return true;
@@ -495,14 +752,22 @@ bool usdex::core::setLocalTransform(
             if (getMatrixXformOp(xformOps, &transformXformOp) && transformXformOp.IsDefined())
             {
                 const GfMatrix4d matrix = computeMatrixFromComponents(translation, pivot, rotation, rotationOrder, scale);
-                transformXformOp.Set(matrix, time);
+                detail::setAttributeValue(transformXformOp.GetAttr(), matrix, time);
                 ensureXformOpOrderExplicitlyAuthored(xformable);
 
                 return true;
             }
         }
 
-        // FUTURE: Attempt to reuse existing UsdGeomXformCommonAPI xformOps
+        // Set the values on existing UsdGeomXformCommonAPI xformOps if they are already authored in the expected order
+        // This avoids rediscovering the xformOp stack and removing unused xformOps, so repeated edits have a constant cost
+        if (matchesXformOpOrder(xformOps, getCommonXformOpOrder(rotationOrder)))
+        {
+            setCommonXformOpValues(xformOps, translation, pivot, rotation, scale, time);
+            ensureXformOpOrderExplicitlyAuthored(xformable);
+
+            return true;
+        }
     }
 
     // Modify the xformOpOrder and set xformOp values to achieve the transform
@@ -547,6 +812,18 @@ bool usdex::core::setLocalTransform(UsdPrim prim, const GfVec3d& translation, co
     bool resetsXformStack;
     std::vector<UsdGeomXformOp> xformOps = xformable.GetOrderedXformOps(&resetsXformStack);
 
+    // Set the values on existing xformOps if they are already authored in the expected order
+    // The xformOpOrder is rebuilt below without resetting the xform stack, so a stack which resets it is not reused
+    if (!resetsXformStack && matchesXformOpOrder(xformOps, getOrientXformOpOrder()))
+    {
+        setValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, GfVec3d>(xformOps[0], translation, time);
+        setValueWithPrecision<GfQuath, GfQuatf, GfQuatd, GfQuatf>(xformOps[1], orientation, time);
+        setValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, GfVec3f>(xformOps[2], scale, time);
+        ensureXformOpOrderExplicitlyAuthored(xformable);
+
+        return true;
+    }
+
     // Map to store existing ops by type and name
     std::map<std::pair<UsdGeomXformOp::Type, TfToken>, UsdGeomXformOp> existingOps;
     for (const UsdGeomXformOp& op : xformOps)
@@ -615,7 +892,171 @@ bool usdex::core::setLocalTransform(UsdPrim prim, const GfVec3d& translation, co
     return true;
 }
 
-GfTransform usdex::core::getLocalTransform(const UsdPrim& prim, UsdTimeCode time)
+bool usdex::core::setLocalTransforms(
+    const std::vector<UsdPrim>& prims,
+    const std::vector<GfMatrix4d>& matrices,
+    const std::vector<UsdTimeCode>& times
+)
+{
+    if (!validateLocalTransforms(prims, times, matrices.size(), "matrices") || !validateXformablePrims(prims))
+    {
+        return false;
+    }
+
+    const size_t numTimes = times.size();
+    if (numTimes == 0)
+    {
+        return true;
+    }
+
+    // Author the xformOps of each prim using the first sample, reusing any compatible xformOps exactly as setLocalTransform does
+    // The result is always a single transform xformOp, so the remaining samples can be written directly to its attribute spec
+    std::vector<XformOpSpec> specs;
+    specs.reserve(prims.size());
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        if (!usdex::core::setLocalTransform(prims[i], matrices[i * numTimes], times[0]))
+        {
+            return false;
+        }
+
+        bool resetsXformStack;
+        const std::vector<UsdGeomXformOp> xformOps = UsdGeomXformable(prims[i]).GetOrderedXformOps(&resetsXformStack);
+        if (xformOps.size() != 1 || xformOps[0].GetOpType() != UsdGeomXformOp::TypeTransform)
+        {
+            TF_CODING_ERROR("Unable to set local transforms on \"%s\" due to an unexpected xformOpOrder", prims[i].GetPath().GetAsString().c_str());
+            return false;
+        }
+        specs.push_back(getXformOpSpec(xformOps[0]));
+    }
+
+    SdfChangeBlock changeBlock;
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        for (size_t j = 1; j < numTimes; ++j)
+        {
+            setXformOpSpecValue(specs[i], VtValue(matrices[i * numTimes + j]), times[j]);
+        }
+    }
+
+    return true;
+}
+
+bool usdex::core::setLocalTransforms(UsdPrim prim, const std::vector<GfMatrix4d>& matrices, const std::vector<UsdTimeCode>& times)
+{
+    return usdex::core::setLocalTransforms(std::vector<UsdPrim>{ prim }, matrices, times);
+}
+
+bool usdex::core::setLocalTransforms(
+    const std::vector<UsdPrim>& prims,
+    const std::vector<GfVec3d>& translations,
+    const std::vector<GfQuatf>& orientations,
+    const std::vector<GfVec3f>& scales,
+    const std::vector<UsdTimeCode>& times
+)
+{
+    if (!validateLocalTransforms(prims, times, translations.size(), "translations") ||
+        !validateLocalTransforms(prims, times, orientations.size(), "orientations") ||
+        !validateLocalTransforms(prims, times, scales.size(), "scales") || !validateXformablePrims(prims))
+    {
+        return false;
+    }
+
+    const size_t numTimes = times.size();
+    if (numTimes == 0)
+    {
+        return true;
+    }
+
+    // Author the xformOps of each prim using the first sample, reusing any compatible xformOps exactly as setLocalTransform does
+    // The result is always a translate, orient, scale xformOpOrder, so the remaining samples can be written directly to their attribute specs
+    std::vector<std::array<XformOpSpec, 3>> specs;
+    specs.reserve(prims.size());
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        const size_t first = i * numTimes;
+        if (!usdex::core::setLocalTransform(prims[i], translations[first], orientations[first], scales[first], times[0]))
+        {
+            return false;
+        }
+
+        bool resetsXformStack;
+        const std::vector<UsdGeomXformOp> xformOps = UsdGeomXformable(prims[i]).GetOrderedXformOps(&resetsXformStack);
+        if (xformOps.size() != 3 || xformOps[0].GetOpType() != UsdGeomXformOp::TypeTranslate ||
+            xformOps[1].GetOpType() != UsdGeomXformOp::TypeOrient || xformOps[2].GetOpType() != UsdGeomXformOp::TypeScale)
+        {
+            TF_CODING_ERROR("Unable to set local transforms on \"%s\" due to an unexpected xformOpOrder", prims[i].GetPath().GetAsString().c_str());
+            return false;
+        }
+        specs.push_back({ getXformOpSpec(xformOps[0]), getXformOpSpec(xformOps[1]), getXformOpSpec(xformOps[2]) });
+    }
+
+    SdfChangeBlock changeBlock;
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        const std::array<XformOpSpec, 3>& spec = specs[i];
+        for (size_t j = 1; j < numTimes; ++j)
+        {
+            const size_t index = i * numTimes + j;
+            const UsdTimeCode& time = times[j];
+            setXformOpSpecValue(spec[0], castValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, GfVec3d>(spec[0].precision, translations[index]), time);
+            setXformOpSpecValue(spec[1], castValueWithPrecision<GfQuath, GfQuatf, GfQuatd, GfQuatf>(spec[1].precision, orientations[index]), time);
+            setXformOpSpecValue(spec[2], castValueWithPrecision<GfVec3h, GfVec3f, GfVec3d, GfVec3f>(spec[2].precision, scales[index]), time);
+        }
+    }
+
+    return true;
+}
+
+bool usdex::core::setLocalTransforms(
+    UsdPrim prim,
+    const std::vector<GfVec3d>& translations,
+    const std::vector<GfQuatf>& orientations,
+    const std::vector<GfVec3f>& scales,
+    const std::vector<UsdTimeCode>& times
+)
+{
+    return usdex::core::setLocalTransforms(std::vector<UsdPrim>{ prim }, translations, orientations, scales, times);
+}
+
+namespace
+{
+
+// Decompose each of many matrices, across multiple threads for large arrays
+template <typename DecomposeFn>
+void decomposeMatrices(size_t size, const DecomposeFn& decompose)
+{
+    auto decomposeRange = [&decompose](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            decompose(i);
+        }
+    };
+
+    if (size < s_parallelMatrixThreshold || !WorkHasConcurrency())
+    {
+        decomposeRange(0, size);
+    }
+    else
+    {
+        WorkParallelForN(size, decomposeRange, s_matrixGrainSize);
+    }
+}
+
+// Compute the local transformation matrix of an xformable, retrieving it from the cache if one is supplied
+bool computeLocalTransformation(const UsdGeomXformable& xformable, UsdTimeCode time, UsdGeomXformCache* xformCache, GfMatrix4d& matrix)
+{
+    bool resetsXformStack;
+    if (xformCache)
+    {
+        matrix = xformCache->GetLocalTransformation(xformable.GetPrim(), &resetsXformStack);
+        return true;
+    }
+    return xformable.GetLocalTransformation(&matrix, &resetsXformStack, time);
+}
+
+GfTransform getLocalTransform(const UsdPrim& prim, UsdTimeCode time, UsdGeomXformCache* xformCache)
 {
     // Initialize an identity transform as the fallback return
     GfTransform transform = GfTransform();
@@ -645,8 +1086,7 @@ GfTransform usdex::core::getLocalTransform(const UsdPrim& prim, UsdTimeCode time
 
     // Compute the local transform matrix and populate the result from that
     GfMatrix4d matrix;
-    bool resetsXformStack;
-    if (xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    if (::computeLocalTransformation(xformable, time, xformCache, matrix))
     {
         transform.SetMatrix(matrix);
     }
@@ -654,7 +1094,7 @@ GfTransform usdex::core::getLocalTransform(const UsdPrim& prim, UsdTimeCode time
     return transform;
 }
 
-GfMatrix4d usdex::core::getLocalTransformMatrix(const UsdPrim& prim, UsdTimeCode time)
+GfMatrix4d getLocalTransformMatrix(const UsdPrim& prim, UsdTimeCode time, UsdGeomXformCache* xformCache)
 {
     // Initialize an identity matrix as the fallback return
     GfMatrix4d matrix = GfMatrix4d(1.0);
@@ -667,8 +1107,7 @@ GfMatrix4d usdex::core::getLocalTransformMatrix(const UsdPrim& prim, UsdTimeCode
     }
 
     // Compute the local transform matrix and populate the result from that
-    bool resetsXformStack;
-    if (!xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    if (!::computeLocalTransformation(xformable, time, xformCache, matrix))
     {
         matrix.SetIdentity();
     }
@@ -676,14 +1115,15 @@ GfMatrix4d usdex::core::getLocalTransformMatrix(const UsdPrim& prim, UsdTimeCode
     return matrix;
 }
 
-void usdex::core::getLocalTransformComponents(
+void getLocalTransformComponents(
     const UsdPrim& prim,
     GfVec3d& translation,
     GfVec3d& pivot,
     GfVec3f& rotation,
     usdex::core::RotationOrder& rotationOrder,
     GfVec3f& scale,
-    UsdTimeCode time
+    UsdTimeCode time,
+    UsdGeomXformCache* xformCache
 )
 {
     // Initialize as identity
@@ -711,21 +1151,21 @@ void usdex::core::getLocalTransformComponents(
 
     // Compute the local transform matrix and populate the result from that
     GfMatrix4d matrix;
-    bool resetsXformStack;
-    if (xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+    if (::computeLocalTransformation(xformable, time, xformCache, matrix))
     {
         computeComponentsFromMatrix(matrix, translation, pivot, rotation, rotationOrder, scale);
         return;
     }
 }
 
-void usdex::core::getLocalTransformComponentsQuat(
+void getLocalTransformComponentsQuat(
     const UsdPrim& prim,
     GfVec3d& translation,
     GfVec3d& pivot,
     GfQuatf& orientation,
     GfVec3f& scale,
-    UsdTimeCode time
+    UsdTimeCode time,
+    UsdGeomXformCache* xformCache
 )
 {
     // Initialize with identity values
@@ -821,7 +1261,7 @@ void usdex::core::getLocalTransformComponentsQuat(
     if (!foundOrientationOp)
     {
         GfMatrix4d matrix;
-        if (xformable.GetLocalTransformation(&matrix, &resetsXformStack, time))
+        if (::computeLocalTransformation(xformable, time, xformCache, matrix))
         {
             GfTransform transform;
             transform.SetMatrix(matrix);
@@ -830,13 +1270,130 @@ void usdex::core::getLocalTransformComponentsQuat(
     }
 }
 
+} // namespace
+
+GfTransform usdex::core::getLocalTransform(const UsdPrim& prim, UsdTimeCode time)
+{
+    return ::getLocalTransform(prim, time, nullptr);
+}
+
+GfTransform usdex::core::getLocalTransform(const UsdPrim& prim, UsdGeomXformCache& xformCache)
+{
+    return ::getLocalTransform(prim, xformCache.GetTime(), &xformCache);
+}
+
+GfMatrix4d usdex::core::getLocalTransformMatrix(const UsdPrim& prim, UsdTimeCode time)
+{
+    return ::getLocalTransformMatrix(prim, time, nullptr);
+}
+
+GfMatrix4d usdex::core::getLocalTransformMatrix(const UsdPrim& prim, UsdGeomXformCache& xformCache)
+{
+    return ::getLocalTransformMatrix(prim, xformCache.GetTime(), &xformCache);
+}
+
+void usdex::core::getLocalTransformComponents(
+    const UsdPrim& prim,
+    GfVec3d& translation,
+    GfVec3d& pivot,
+    GfVec3f& rotation,
+    usdex::core::RotationOrder& rotationOrder,
+    GfVec3f& scale,
+    UsdTimeCode time
+)
+{
+    ::getLocalTransformComponents(prim, translation, pivot, rotation, rotationOrder, scale, time, nullptr);
+}
+
+void usdex::core::getLocalTransformComponents(
+    const UsdPrim& prim,
+    GfVec3d& translation,
+    GfVec3d& pivot,
+    GfVec3f& rotation,
+    usdex::core::RotationOrder& rotationOrder,
+    GfVec3f& scale,
+    UsdGeomXformCache& xformCache
+)
+{
+    ::getLocalTransformComponents(prim, translation, pivot, rotation, rotationOrder, scale, xformCache.GetTime(), &xformCache);
+}
+
+void usdex::core::getLocalTransformComponentsQuat(
+    const UsdPrim& prim,
+    GfVec3d& translation,
+    GfVec3d& pivot,
+    GfQuatf& orientation,
+    GfVec3f& scale,
+    UsdTimeCode time
+)
+{
+    ::getLocalTransformComponentsQuat(prim, translation, pivot, orientation, scale, time, nullptr);
+}
+
+void usdex::core::getLocalTransformComponentsQuat(
+    const UsdPrim& prim,
+    GfVec3d& translation,
+    GfVec3d& pivot,
+    GfQuatf& orientation,
+    GfVec3f& scale,
+    UsdGeomXformCache& xformCache
+)
+{
+    ::getLocalTransformComponentsQuat(prim, translation, pivot, orientation, scale, xformCache.GetTime(), &xformCache);
+}
+
+void usdex::core::computeTransformComponents(
+    const std::vector<GfMatrix4d>& matrices,
+    std::vector<GfVec3d>& translations,
+    std::vector<GfVec3d>& pivots,
+    std::vector<GfVec3f>& rotations,
+    std::vector<GfVec3f>& scales
+)
+{
+    USDEX_INSTRUMENT_SCOPE("computeTransformComponents");
+
+    const size_t size = matrices.size();
+    translations.resize(size);
+    pivots.resize(size);
+    rotations.resize(size);
+    scales.resize(size);
+    ::decomposeMatrices(
+        size,
+        [&](size_t i)
+        {
+            usdex::core::RotationOrder rotationOrder;
+            ::computeComponentsFromMatrix(matrices[i], translations[i], pivots[i], rotations[i], rotationOrder, scales[i]);
+        }
+    );
+}
+
+void usdex::core::computeTransformComponentsQuat(
+    const std::vector<GfMatrix4d>& matrices,
+    std::vector<GfVec3d>& translations,
+    std::vector<GfVec3d>& pivots,
+    std::vector<GfQuatf>& orientations,
+    std::vector<GfVec3f>& scales
+)
+{
+    USDEX_INSTRUMENT_SCOPE("computeTransformComponentsQuat");
+
+    const size_t size = matrices.size();
+    translations.resize(size);
+    pivots.resize(size);
+    orientations.resize(size);
+    scales.resize(size);
+    ::decomposeMatrices(size, [&](size_t i) { ::computeComponentsFromMatrix(matrices[i], translations[i], pivots[i], orientations[i], scales[i]); });
+}
+
 UsdGeomXform usdex::core::defineXform(UsdStagePtr stage, const SdfPath& path, std::optional<const pxr::GfTransform> transform)
 {
+    USDEX_INSTRUMENT_SCOPE("defineXform");
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomXform due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomXform due to an invalid location: %s", reason.c_str());
         return UsdGeomXform();
     }
 
@@ -868,7 +1425,12 @@ UsdGeomXform usdex::core::defineXform(UsdPrim parent, const std::string& name, s
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomXform due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomXform due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomXform();
     }
 
@@ -906,11 +1468,13 @@ UsdGeomXform usdex::core::defineXform(UsdPrim prim, std::optional<const pxr::GfT
 
 UsdGeomXform usdex::core::defineXform(UsdStagePtr stage, const SdfPath& path, const pxr::GfMatrix4d& matrix)
 {
+    USDEX_INSTRUMENT_SCOPE("defineXform");
+
     // Early out if the proposed prim location is invalid
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomXform due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(path, eInvalidLocation, "Unable to define UsdGeomXform due to an invalid location: %s", reason.c_str());
         return UsdGeomXform();
     }
 
@@ -939,7 +1503,12 @@ UsdGeomXform usdex::core::defineXform(UsdPrim parent, const std::string& name, c
     std::string reason;
     if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
     {
-        TF_RUNTIME_ERROR("Unable to define UsdGeomXform due to an invalid location: %s", reason.c_str());
+        USDEX_AUTHORING_ERROR(
+            usdex::core::detail::getChildPathForError(parent, name),
+            eInvalidLocation,
+            "Unable to define UsdGeomXform due to an invalid location: %s",
+            reason.c_str()
+        );
         return UsdGeomXform();
     }
 
@@ -1,17 +1,35 @@
 # SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 #
-__all__ = ["createAssetPayload", "addAssetContent", "addAssetLibrary"]
+from __future__ import annotations
 
-from typing import Optional
+__all__ = ["createAssetPayload", "addAssetContent", "addAssetLibrary", "createAssetContentStage"]
 
-from pxr import Ar, Sdf, Tf, Usd, UsdGeom
+from typing import TYPE_CHECKING, Optional
 
 from ._StageAlgoBindings import createStage
-from ._usdex_core import defineScope, getContentsToken, getLayerAuthoringMetadata, getLibraryToken, getPayloadToken, getValidPrimName
-
-
-def createAssetPayload(stage: Usd.Stage, format: str = "usda", fileFormatArgs: Optional[dict] = None) -> Optional[Usd.Stage]:
+from ._usdex_core import (
+    AssetCopyPolicy,
+    configureStage,
+    copyDefaultPrimSpec,
+    defineScope,
+    getContentsToken,
+    getLayerAuthoringMetadata,
+    getLibraryToken,
+    getPayloadToken,
+    getValidPrimName,
+)
+
+if TYPE_CHECKING:
+    from pxr import Usd
+
+
+def createAssetPayload(
+    stage: Usd.Stage,
+    format: str = "usda",
+    fileFormatArgs: Optional[dict] = None,
+    copyPolicy: AssetCopyPolicy = AssetCopyPolicy.eFull,
+) -> Optional[Usd.Stage]:
     """
     Create a relative layer within a ``getPayloadToken()`` subdirectory to hold the content of an asset.
 
@@ -27,10 +45,13 @@ def createAssetPayload(stage: Usd.Stage, format: str = "usda", fileFormatArgs: O
         stage: The stage's edit target identifier will dictate where the relative payload layer will be created.
         format: The file format extension (default: "usda").
         fileFormatArgs: Additional file format-specific arguments to be supplied during stage creation.
+        copyPolicy: How the asset stage's default prim is copied to the payload layer. See ``usdex.core.copyDefaultPrimSpec`` for details.
 
     Returns:
         The newly created relative payload layer opened as a new stage. Returns an invalid stage on error.
     """
+    from pxr import Ar, Tf, Usd, UsdGeom
+
     # This function should mimic the behavior of the C++ function `usdex::core::createAssetPayload`.
     # It has been re-implemented here rather than bound to python using pybind11 due to issues with the transfer of ownership of the UsdStage object
     # from C++ to Python
@@ -60,12 +81,7 @@ def createAssetPayload(stage: Usd.Stage, format: str = "usda", fileFormatArgs: O
         return None
 
     # Copy the asset stage's default prim to the asset payload stage
-    success = Sdf.CopySpec(
-        stage.GetRootLayer(),
-        stage.GetDefaultPrim().GetPath(),
-        payloadStage.GetRootLayer(),
-        payloadStage.GetDefaultPrim().GetPath(),
-    )
+    success = copyDefaultPrimSpec(stage, payloadStage, copyPolicy)
     if not success:
         Tf.Warn("Unable to copy the asset stage's default prim to the asset payload stage")
         return None
@@ -89,6 +105,8 @@ def addAssetLibrary(stage: Usd.Stage, name: str, format: str = "usdc", fileForma
     Returns:
         The newly created relative layer opened as a new stage. It will be named "<name>Library.<format>"
     """
+    from pxr import Ar, Sdf, Tf, Usd, UsdGeom
+
     # This function should mimic the behavior of the C++ function `usdex::core::addAssetLibrary`.
     # It has been re-implemented here rather than bound to python using pybind11 due to issues with the transfer of ownership of the UsdStage object
     # from C++ to Python
@@ -156,6 +174,8 @@ def addAssetContent(
     Returns:
         The newly created Content Layer opened as a new stage. Returns an invalid stage on error.
     """
+    from pxr import Ar, Sdf, Tf, Usd, UsdGeom
+
     # This function should mimic the behavior of the C++ function `usdex::core::addAssetContent`.
     # It has been re-implemented here rather than bound to python using pybind11 due to issues with the transfer of ownership of the UsdStage object
     # from C++ to Python
@@ -214,3 +234,69 @@ def addAssetContent(
             return None
 
     return contentStage
+
+
+def createAssetContentStage(stage: Usd.Stage, name: str, createScope: bool = True) -> Optional[Usd.Stage]:
+    """
+    Create an anonymous Content Layer, opened as a new stage, that can be authored independently of the rest of the asset.
+
+    The stage is configured with the metadata of the asset stage and a copy of its default prim, matching the Content Layers created by
+    ``usdex.core.addAssetContent``, but it is not added to any sublayer stack. As the stage does not share any layers with the asset, several Content
+    Layers (e.g. Geometry, Materials, and Physics) can be authored concurrently, one per thread, using the ``define`` functions. Once all of them
+    are complete they can be assembled into the asset in a single step via ``usdex.core.assembleAsset``.
+
+    Note:
+        As the layer is anonymous, relative references (e.g. to a Library Layer) cannot be authored until the content has been assembled.
+
+    Args:
+        stage: The asset stage, which provides the metadata and default prim of the Content Layer
+        name: The name of the Content Layer (e.g., "Geometry", "Materials", "Physics")
+        createScope: Whether to create a scope in the content stage (default: True).
+
+    Returns:
+        The newly created anonymous Content Layer opened as a new stage. Returns an invalid stage on error.
+    """
+    from pxr import Sdf, Tf, Usd, UsdGeom
+
+    # This function should mimic the behavior of the C++ function `usdex::core::createAssetContentStage`.
+    # It has been re-implemented here rather than bound to python using pybind11 due to issues with the transfer of ownership of the UsdStage object
+    # from C++ to Python
+
+    if not stage:
+        Tf.Warn("Unable to create asset content stage due to an invalid asset stage")
+        return None
+
+    defaultPrim = stage.GetDefaultPrim()
+    if not defaultPrim:
+        Tf.Warn("Unable to create asset content stage due to an invalid default prim")
+        return None
+
+    contentStage: Usd.Stage = Usd.Stage.CreateInMemory()
+    success = configureStage(
+        contentStage,
+        defaultPrim.GetName(),
+        UsdGeom.GetStageUpAxis(stage),
+        UsdGeom.GetStageMetersPerUnit(stage),
+        getLayerAuthoringMetadata(stage.GetRootLayer()),
+    )
+    if not success:
+        Tf.Warn("Unable to configure the asset content stage")
+        return None
+
+    success = Sdf.CopySpec(
+        stage.GetRootLayer(),
+        defaultPrim.GetPath(),
+        contentStage.GetRootLayer(),
+        contentStage.GetDefaultPrim().GetPath(),
+    )
+    if not success:
+        Tf.Warn("Unable to copy the asset stage's default prim to the asset content stage")
+        return None
+
+    if createScope:
+        scope = defineScope(contentStage.GetDefaultPrim(), name)
+        if not scope:
+            Tf.Warn("Unable to create a scope in the asset content stage")
+            return None
+
+    return contentStage
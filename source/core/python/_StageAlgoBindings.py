@@ -1,13 +1,16 @@
 # SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 #
-__all__ = ["createStage"]
+from __future__ import annotations
 
-from typing import Optional
+__all__ = ["createStage", "createUnsavedStage"]
 
-from pxr import Sdf, Tf, Usd
+from typing import TYPE_CHECKING, Optional
 
-from ._usdex_core import configureStage
+from ._usdex_core import LayerWriteOptions, configureStage, getLayerWriteFileFormatArgs
+
+if TYPE_CHECKING:
+    from pxr import Usd
 
 
 def createStage(
@@ -18,6 +21,7 @@ def createStage(
     authoringMetadata: str,
     fileFormatArgs: Optional[dict] = None,
     massUnits: Optional[float] = None,
+    writeOptions: Optional[LayerWriteOptions] = None,
 ) -> Optional[Usd.Stage]:
     """
     Create and configure a `Usd.Stage` so that the defining metadata is explicitly authored.
@@ -36,10 +40,14 @@ def createStage(
         authoringMetadata: The provenance information from the host application. See `setLayerAuthoringMetadata` for details.
         fileFormatArgs: Additional file format-specific arguments to be supplied during Stage creation.
         massUnits: The kilograms per unit for all mass measurements in the stage, defaults to `UsdPhysics.MassUnits.kilograms`.
+        writeOptions: The options which control how the root layer is encoded. See `LayerWriteOptions` for details.
+            These are combined with the `fileFormatArgs`.
 
     Returns:
         The newly created stage or None
     """
+    from pxr import Sdf, Tf, Usd
+
     # This function should mimic the behavior of the C++ function `usdex::core::createStage`.
     # It has been re-implemented here rather than bound to python using pybind11 due to issues with the transfer of ownership of the UsdStage object
     # from C++ to Python
@@ -49,6 +57,14 @@ def createStage(
         Tf.Warn(f'Unable to create UsdStage at "{identifier}" due to an invalid identifier')
         return None
 
+    # Early out for invalid write options
+    fileFormatArgs = fileFormatArgs or dict()
+    if writeOptions is not None:
+        valid, fileFormatArgs, reason = getLayerWriteFileFormatArgs(identifier, writeOptions, fileFormatArgs)
+        if not valid:
+            Tf.Warn(f'Unable to create UsdStage at "{identifier}" due to invalid write options: {reason}')
+            return None
+
     # Create the stage in memory to avoid adding the identifier to the registry in cases where the call fails due to invalid argument values
     # This differs for the C++ implementation only because we do not want to expose the validation logic via the API
     stage = Usd.Stage.CreateInMemory(identifier)
@@ -64,7 +80,6 @@ def createStage(
 
     # Export the stage to the desired identifier
     comment = ""
-    fileFormatArgs = fileFormatArgs or dict()
     if not stage.GetRootLayer().Export(identifier, comment, fileFormatArgs):
         return None
 
@@ -78,3 +93,79 @@ def createStage(
 
     # Return a stage wrapping the exported layer
     return Usd.Stage.Open(identifier)
+
+
+def createUnsavedStage(
+    identifier: str,
+    defaultPrimName: str,
+    upAxis: str,
+    linearUnits: float,
+    authoringMetadata: str,
+    fileFormatArgs: Optional[dict] = None,
+    massUnits: Optional[float] = None,
+    writeOptions: Optional[LayerWriteOptions] = None,
+) -> Optional[Usd.Stage]:
+    """
+    Create and configure a `Usd.Stage` so that the defining metadata is explicitly authored, without writing the root layer.
+
+    This is equivalent to `createStage`, except that the root layer is created in memory via `Sdf.Layer.New` and configured in place, rather
+    than being exported to the identifier and read back. The root layer is only written when the stage is saved (e.g. via `saveStage`). This
+    avoids a file write, read, and parse per stage, which is significant when creating many small stages on network storage.
+
+    The arguments are validated and the metadata is authored on a temporary in-memory stage first, so a failure leaves no layer registered
+    with the identifier. If a layer with the identifier is already open, its content is replaced, matching `createStage`.
+
+    Note:
+        Until the stage is saved, no file exists at the identifier, so other processes can not open it.
+
+    Args:
+        identifier: The identifier to be used for the root layer of this stage.
+        defaultPrimName: Name of the root prim root prim.
+        upAxis: The up axis for all the geometry contained in the stage.
+        linearUnits: The meters per unit for all linear measurements in the stage, eg. `UsdGeom.LinearUnits.meters`
+        authoringMetadata: The provenance information from the host application. See `setLayerAuthoringMetadata` for details.
+        fileFormatArgs: Additional file format-specific arguments to be supplied during Stage creation.
+        massUnits: The kilograms per unit for all mass measurements in the stage, defaults to `UsdPhysics.MassUnits.kilograms`.
+        writeOptions: The options which control how the root layer is encoded when the stage is saved. See `LayerWriteOptions` for details.
+            These are combined with the `fileFormatArgs`.
+
+    Returns:
+        The newly created stage or None
+    """
+    from pxr import Sdf, Tf, Usd
+
+    # This function should mimic the behavior of the C++ function `usdex::core::createUnsavedStage`.
+    # It has been re-implemented here rather than bound to python using pybind11 for the same reasons as `createStage`
+
+    # Early out for an unsupported identifier
+    if not identifier or not Usd.Stage.IsSupportedFile(identifier):
+        Tf.Warn(f'Unable to create UsdStage at "{identifier}" due to an invalid identifier')
+        return None
+
+    # Early out for invalid write options
+    fileFormatArgs = fileFormatArgs or dict()
+    if writeOptions is not None:
+        valid, fileFormatArgs, reason = getLayerWriteFileFormatArgs(identifier, writeOptions, fileFormatArgs)
+        if not valid:
+            Tf.Warn(f'Unable to create UsdStage at "{identifier}" due to invalid write options: {reason}')
+            return None
+
+    # Configure a temporary stage in memory, so that no layer is registered with the identifier in cases where failures occur
+    configured = Usd.Stage.CreateInMemory(identifier)
+    if massUnits is None:
+        if not configureStage(configured, defaultPrimName, upAxis, linearUnits, authoringMetadata):
+            return None
+    else:
+        if not configureStage(configured, defaultPrimName, upAxis, linearUnits, massUnits, authoringMetadata):
+            return None
+
+    # An existing layer with the same identifier has its content replaced, otherwise a new layer is created in memory only.
+    # The file format is found using the args, as the C++ function does, so that e.g. a .usd layer is encoded as requested.
+    layer = Sdf.Layer.Find(identifier, fileFormatArgs)
+    if not layer:
+        layer = Sdf.Layer.New(Sdf.FileFormat.FindByExtension(identifier, fileFormatArgs), identifier, fileFormatArgs)
+        if not layer:
+            return None
+    layer.TransferContent(configured.GetRootLayer())
+
+    return Usd.Stage.Open(layer)
@@ -5,6 +5,28 @@
 `usdex.core <https://docs.omniverse.nvidia.com/usd/code-docs/usd-exchange-sdk/latest/docs/python-usdex-core.html>`_ provides higher-level convenience
 functions top of lower-level `OpenUSD <https://openusd.org/release/index.html>`_ concepts, so developers can quickly adopt OpenUSD best practices
 when mapping their native data sources to OpenUSD-legible data models.
+
+Threading
+---------
+
+The long-running functions release the Python GIL while they execute in C++, so that other Python threads are not blocked. These include
+``saveStage``, ``saveStageWithReport``, ``saveLayer``, ``exportLayer``, the mesh, curves, and point cloud ``define`` functions, the GeomSubset
+``define`` functions, ``computeMeshNormals``, ``PrimvarData.index``, ``setLocalTransform(s)``, and the bulk ``getValidPrimNames``,
+``getValidChildNames``, and ``getValidPropertyNames`` functions.
+
+These functions are safe to call concurrently from multiple Python threads provided that each thread authors to a separate ``Usd.Stage``
+(with separate layers). Concurrent authoring to the same stage or layer, or concurrent use of the same ``PrimvarData`` or name cache
+object, is not safe and must be serialized by the caller.
+
+The async save functions (``saveLayerAsync``, ``exportLayerAsync``, and ``saveStageAsync``) copy the layer contents on the calling thread and
+write the copies on a background thread, so it is safe to continue authoring to the same stage while the save is in flight.
+
+Startup
+-------
+
+Importing ``usdex.core`` only imports the ``pxr.Tf`` and ``pxr.Gf`` python modules, which are required by the default arguments of the
+bindings. The remaining OpenUSD python modules (e.g. ``pxr.Usd`` and ``pxr.UsdGeom``) are imported on first use, when an object of one of their
+types is first returned to python, so that short lived processes (e.g. serverless converters) only pay for the modules they actually use.
 """
 
 __all__ = [
@@ -14,6 +36,8 @@ __all__ = [
     "deprecated",
     # settings
     "enableTranscodingSetting",
+    "validNameCacheSizeSetting",
+    "enableInstrumentationSetting",
     # diagnostics
     "DiagnosticsLevel",
     "DiagnosticsOutputStream",
@@ -25,18 +49,58 @@ __all__ = [
     "getDiagnosticLevel",
     "setDiagnosticsOutputStream",
     "getDiagnosticsOutputStream",
+    "setDiagnosticsBuffered",
+    "getDiagnosticsBuffered",
+    "flushDiagnostics",
+    "setDiagnosticsRepeatLimit",
+    "getDiagnosticsRepeatLimit",
+    "DiagnosticsFunctionCount",
+    "DiagnosticsCounts",
+    "getDiagnosticsCounts",
+    "resetDiagnosticsCounts",
+    "getDiagnosticsMetrics",
+    "AuthoringErrorCode",
+    "AuthoringError",
+    "AuthoringErrorScope",
+    # instrumentation
+    "InstrumentationCounter",
+    "isInstrumentationEnabled",
+    "setInstrumentationEnabled",
+    "getInstrumentationCounters",
+    "resetInstrumentationCounters",
     # layers
     "hasLayerAuthoringMetadata",
     "setLayerAuthoringMetadata",
     "getLayerAuthoringMetadata",
+    "LayerWriteOptions",
+    "getLayerWriteFileFormatArgs",
     "saveLayer",
     "exportLayer",
+    "SaveFuture",
+    "saveLayerAsync",
+    "exportLayerAsync",
+    "exportLayerToBuffer",
+    "exportLayerToCallback",
+    "LayerChangeTracker",
+    "applyLayerDelta",
     "getUsdLayerEncoding",
+    "AttributeDataSize",
+    "LayerMemoryReport",
+    "computeLayerMemoryReport",
     # stage
     "createStage",
+    "createUnsavedStage",
     "configureStage",
     "saveStage",
+    "LayerSaveReport",
+    "saveStageWithReport",
+    "saveStageAsync",
+    "computeStageMemoryReport",
     "isEditablePrimLocation",
+    "EditablePrimLocationScope",
+    "SkipUnchangedValuesScope",
+    "BulkAuthoringScope",
+    "StagePool",
     # asset structure
     "getAssetToken",
     "getContentsToken",
@@ -48,11 +112,19 @@ __all__ = [
     "getTexturesToken",
     "definePayload",
     "defineReference",
+    "ReferencePayloadData",
+    "defineReferences",
+    "definePayloads",
     "defineScope",
+    "AssetCopyPolicy",
+    "copyDefaultPrimSpec",
     "createAssetPayload",
     "addAssetContent",
     "addAssetLibrary",
+    "MeshLibrary",
     "addAssetInterface",
+    "createAssetContentStage",
+    "assembleAsset",
     "configureAssemblyHierarchy",
     "configureComponentHierarchy",
     # names
@@ -69,6 +141,7 @@ __all__ = [
     "clearDisplayName",
     "blockDisplayName",
     "computeEffectiveDisplayName",
+    "computeEffectiveDisplayNames",
     # xform
     "defineXform",
     "RotationOrder",
@@ -76,24 +149,56 @@ __all__ = [
     "getLocalTransformMatrix",
     "getLocalTransformComponents",
     "getLocalTransformComponentsQuat",
+    "computeTransformComponents",
+    "computeTransformComponentsQuat",
     "setLocalTransform",
+    "setLocalTransforms",
     # geometry
     "definePointCloud",
+    "PointCloudQuantization",
+    "PointCloudQuantizationReport",
+    "computePointCloudQuantizationReport",
+    "PointCloudTiling",
+    "definePointCloudTiles",
+    "PointCloudWriter",
     "definePolyMesh",
+    "PolyMeshIndexing",
+    "PolyMeshData",
+    "definePolyMeshes",
+    "MeshBatch",
+    "definePolyMeshBatch",
+    "MeshTopology",
+    "setPolyMeshPoints",
     "defineLinearBasisCurves",
     "defineCubicBasisCurves",
+    "BasisCurvesWriter",
     "definePlane",
     "defineSphere",
     "defineCube",
     "defineCone",
     "defineCylinder",
     "defineCapsule",
+    "GprimData",
+    "defineGprims",
+    "defineGprimInstancer",
     "computeMeshNormals",
     "defineNonOverlappingSubsets",
+    "defineOptimizedPolyMesh",
     "definePartitionedSubsets",
+    "definePartitionedSubsetsFromFaceIds",
+    "definePolyMeshChunks",
+    "definePolyMeshLods",
     "defineUnrestrictedSubsets",
+    # extents
+    "computePointsExtent",
+    "setExtentTimeSamples",
+    # bounds
+    "WorldBounds",
+    "computeWorldBounds",
+    "setExtentsHint",
     # camera
     "defineCamera",
+    "defineCameras",
     # primvars
     "FloatPrimvarData",
     "IntPrimvarData",
@@ -102,14 +207,18 @@ __all__ = [
     "Vec2fPrimvarData",
     "StringPrimvarData",
     "TokenPrimvarData",
+    # scratch memory
+    "ScratchArenaScope",
     # lights
     "isLight",
     "getLightAttr",
     "defineDomeLight",
     "defineRectLight",
+    "defineRectLights",
     # materials
     "createMaterial",
     "bindMaterial",
+    "bindMaterials",
     "bindMaterialSubsets",
     "computeEffectivePreviewSurfaceShader",
     "definePreviewMaterial",
@@ -125,10 +234,18 @@ __all__ = [
     "connectPrimvarShader",
     "addPreviewMaterialInterface",
     "removeMaterialInterface",
+    "addPreviewMaterialInterfaces",
+    "removeMaterialInterfaces",
+    "PreviewMaterialParams",
+    "MaterialRegistry",
+    "SharedTextureScope",
     "ColorSpace",
     "getColorSpaceToken",
     "sRgbToLinear",
     "linearToSrgb",
+    # physicsCollision
+    "CollisionApproximation",
+    "definePhysicsColliders",
     # physicsJoint
     "JointFrame",
     "definePhysicsFixedJoint",
@@ -137,10 +254,13 @@ __all__ = [
     "definePhysicsSphericalJoint",
     "alignPhysicsJoint",
     "connectPhysicsJoint",
+    "PhysicsJointData",
+    "definePhysicsJoints",
     # physicsMaterial
     "definePhysicsMaterial",
     "addPhysicsToMaterial",
     "bindPhysicsMaterial",
+    "bindPhysicsMaterials",
 ]
 
 import os
@@ -9,6 +9,7 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -19,8 +20,8 @@ namespace usdex::core::bindings
 
 void bindAssetStructure(module& m)
 {
-    // The bindings for createAssetPayload and addAssetContent are hand rolled in `python/bindings/_AssetStructureBindings.py` due to issues with
-    // cleanly passing ownership of a UsdStageRefPtr from C++ to Python using pybind11
+    // The bindings for createAssetPayload, addAssetContent, and createAssetContentStage are hand rolled in
+    // `python/bindings/_AssetStructureBindings.py` due to issues with cleanly passing ownership of a UsdStageRefPtr from C++ to Python using pybind11
 
     m.def(
         "defineScope",
@@ -129,11 +130,52 @@ void bindAssetStructure(module& m)
         )"
     );
 
+    ::enum_<AssetCopyPolicy>(m, "AssetCopyPolicy", "Controls how the default prim of an asset is transferred between the layers of an asset")
+        .value("eFull", AssetCopyPolicy::eFull, "Copy the entire spec tree of the default prim, including its properties and descendants")
+        .value(
+            "eInterface",
+            AssetCopyPolicy::eInterface,
+            "Copy only the default prim's own metadata and composition arcs (including variant sets), skipping its properties and descendants"
+        )
+        .value(
+            "eMove",
+            AssetCopyPolicy::eMove,
+            "Copy the entire spec tree of the default prim, then remove its properties and descendants from the source layer"
+        );
+
+    m.def(
+        "copyDefaultPrimSpec",
+        &copyDefaultPrimSpec,
+        arg("source"),
+        arg("target"),
+        arg("copyPolicy") = AssetCopyPolicy::eFull,
+        R"(
+            Copy the default prim spec from the root layer of one stage to the root layer of another.
+
+            The spec is authored at the default prim path of the target stage, which may differ in name from the source. Any existing opinions on
+            the target spec are replaced, other than the properties and descendants that are skipped by ``AssetCopyPolicy.eInterface``.
+
+            The ``AssetCopyPolicy.eInterface`` policy avoids duplicating large inline content when only the interface of the prim is required (e.g.
+            when it will be payloaded). The ``AssetCopyPolicy.eMove`` policy transfers the content rather than duplicating it, which is useful when
+            the source opinions will be discarded afterwards.
+
+            Args:
+                source: The stage whose default prim will be copied
+                target: The stage whose default prim will be authored. This must have a default prim name, but the prim does not need to exist.
+                copyPolicy: The policy that determines which specs are copied (default: ``AssetCopyPolicy.eFull``)
+
+            Returns:
+                True if the spec was copied successfully, false otherwise.
+
+        )"
+    );
+
     m.def(
         "addAssetInterface",
         &addAssetInterface,
         arg("stage"),
         arg("source"),
+        arg("copyPolicy") = AssetCopyPolicy::eFull,
         R"(
             Add an Asset Interface to a stage, which payloads a source stage's contents.
 
@@ -142,9 +184,13 @@ void bindAssetStructure(module& m)
             It (re)configures the stage with the source stage's metadata, payloads the defaultPrim from the source stage, and annotates the Asset
             Interface with USD model metadata including component kind, asset name, and extents hint.
 
+            The source stage's default prim is only payloaded, so ``AssetCopyPolicy.eInterface`` can be used to avoid duplicating any inline
+            content of the payload layer into the Asset Interface.
+
             Args:
                 stage: The stage's edit target will become the Asset Interface
                 source: The stage that the Asset Interface will target as a Payload
+                copyPolicy: How the source stage's default prim is copied to the Asset Interface. See ``copyDefaultPrimSpec`` for details.
 
             Returns:
                 True if the Asset Interface was added successfully, false otherwise.
@@ -152,6 +198,35 @@ void bindAssetStructure(module& m)
         )"
     );
 
+    m.def(
+        "assembleAsset",
+        &assembleAsset,
+        arg("stage"),
+        arg("contents"),
+        arg("format") = "usda",
+        arg("fileFormatArgs") = pxr::SdfLayer::FileFormatArguments(),
+        R"(
+            Assemble an atomic asset from Content Layers that were authored independently via ``createAssetContentStage``.
+
+            This creates the asset payload via ``createAssetPayload``, saves each Content Layer alongside it as "<name>.<format>", sublayers them in
+            the order given (strongest first), and adds the Asset Interface to the stage via ``addAssetInterface``. The Content Layers are written
+            concurrently.
+
+            The Payload and Content Layers are saved to disk. The asset stage itself is not saved.
+
+            Args:
+                stage: The asset stage, whose edit target will become the Asset Interface
+                contents: A list of (name, stage) tuples for each Content Layer
+                format: The file format extension of the Payload and Content Layers (default: "usda")
+                fileFormatArgs: Additional file format-specific arguments to be supplied during layer creation.
+
+            Returns:
+                True if the asset was assembled successfully, false otherwise.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
     m.def(
         "getAssetToken",
         &getAssetToken,
@@ -461,6 +536,149 @@ void bindAssetStructure(module& m)
                 The newly created payload prim. Returns an invalid prim on error.
         )"
     );
+
+    ::class_<ReferencePayloadData>(
+        m,
+        "ReferencePayloadData",
+        R"(
+            A single reference or payload to define via ``defineReferences`` or ``definePayloads``.
+
+            The members match the arguments of the ``sourceIdentifier`` overloads of ``defineReference`` and ``definePayload``.
+        )"
+    )
+        .def(init<>())
+        .def(
+            init(
+                [](const SdfPath& path, const std::string& sourceIdentifier, std::optional<SdfPath> primPath)
+                { return ReferencePayloadData{ path, sourceIdentifier, primPath }; }
+            ),
+            arg("path"),
+            arg("sourceIdentifier"),
+            arg("primPath") = nullptr
+        )
+        .def_readwrite("path", &ReferencePayloadData::path, "The absolute prim path at which to define the reference/payload")
+        .def_readwrite("sourceIdentifier", &ReferencePayloadData::sourceIdentifier, "The identifier of the external USD file to reference/payload")
+        .def_readwrite(
+            "primPath",
+            &ReferencePayloadData::primPath,
+            "Absolute prim path in the external USD file. If not provided, uses the default prim's path"
+        );
+
+    m.def(
+        "defineReferences",
+        &defineReferences,
+        arg("stage"),
+        arg("references"),
+        R"(
+            Define many references to external USD files at once.
+
+            The result is equivalent to calling the ``sourceIdentifier`` overload of ``defineReference`` for each element of ``references``, but is
+            significantly faster when many prims reference a smaller number of source files (e.g. placing the assets of a library).
+
+            Each distinct source identifier is resolved, opened, and anchored relative to the edit target once. All of the references are validated
+            before any scene description is authored. If any reference is invalid, or the same path is requested more than once, a runtime error is
+            posted for each failure and no references are defined.
+
+            Valid references are authored directly to the ``Sdf.Layer`` of the current edit target within a single ``Sdf.ChangeBlock``.
+
+            Parameters:
+                - **stage** - The stage on which to define the references
+                - **references** - The path, source identifier, and optional source prim path of each reference
+
+            Returns:
+                The newly created reference prims, in the same order as ``references``, or an empty list if the references could not be defined.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "definePayloads",
+        &definePayloads,
+        arg("stage"),
+        arg("payloads"),
+        R"(
+            Define many payloads to external USD files at once.
+
+            The result is equivalent to calling the ``sourceIdentifier`` overload of ``definePayload`` for each element of ``payloads``. See
+            ``defineReferences`` for details.
+
+            Parameters:
+                - **stage** - The stage on which to define the payloads
+                - **payloads** - The path, source identifier, and optional source prim path of each payload
+
+            Returns:
+                The newly created payload prims, in the same order as ``payloads``, or an empty list if the payloads could not be defined.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<MeshLibrary>(
+        m,
+        "MeshLibrary",
+        R"(
+            Deduplicates identical meshes into a geometry library stage, and instances them from the content stages of an asset.
+
+            Each mesh passed to ``defineMesh`` is compared against the meshes already in the library. The topology and primvars must match exactly,
+            while the points are compared on a grid of the given ``tolerance`` (or bitwise if the tolerance is ``0``). The first occurrence of each
+            unique mesh is authored into the library, and every occurrence is defined as an instanceable reference to the library entry.
+
+            Each library entry is a ``UsdGeom.Xform`` (named after the first instance) containing a ``UsdGeom.Mesh`` named ``Mesh``, authored as a
+            child of the library stage's default prim (e.g. as created by ``addAssetLibrary``).
+
+            A ``MeshLibrary`` is not thread safe.
+        )"
+    )
+        .def(
+            init<UsdStagePtr, float>(),
+            arg("library"),
+            arg("tolerance") = 0.0f,
+            R"(
+                Create a mesh library that authors unique meshes into the given library stage.
+
+                If the library stage has no default prim, or the tolerance is negative or not finite, a runtime error will be posted. Use
+                ``isValid()`` to check whether the library can be used.
+
+                Parameters:
+                    - **library** - The library stage in which to author the unique meshes
+                    - **tolerance** - The grid spacing used to compare points. Points are compared bitwise when this is ``0``
+            )"
+        )
+        .def("isValid", &MeshLibrary::isValid, "Whether the library can be used to define meshes.")
+        .def(
+            "defineMesh",
+            &MeshLibrary::defineMesh,
+            arg("stage"),
+            arg("path"),
+            arg("faceVertexCounts"),
+            arg("faceVertexIndices"),
+            arg("points"),
+            arg("normals") = nullptr,
+            arg("uvs") = nullptr,
+            arg("displayColor") = nullptr,
+            arg("displayOpacity") = nullptr,
+            R"(
+                Defines an instance of a mesh on the stage, authoring the mesh into the library if no identical mesh exists there yet.
+
+                The arguments match those of ``definePolyMesh``. The mesh data is validated the first time a unique mesh is encountered.
+
+                Parameters:
+                    - **stage** - The stage on which to define the instance
+                    - **path** - The absolute prim path at which to define the instance
+                    - **faceVertexCounts** - The number of vertices in each face of the mesh
+                    - **faceVertexIndices** - Indices of the positions from the ``points`` to use for each face vertex
+                    - **points** - Vertex positions for the mesh described points in local space
+                    - **normals** - Values to be authored for the normals primvar
+                    - **uvs** - Values to be authored for the uv primvar
+                    - **displayColor** - Value to be authored for the display color primvar
+                    - **displayOpacity** - Value to be authored for the display opacity primvar
+
+                Returns:
+                    The instanceable prim referencing the library entry. Returns an invalid prim on error.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def("getMeshCount", &MeshLibrary::getMeshCount, "The number of unique meshes authored into the library.")
+        .def("getInstanceCount", &MeshLibrary::getInstanceCount, "The number of instances defined via this library.");
 }
 
 } // namespace usdex::core::bindings
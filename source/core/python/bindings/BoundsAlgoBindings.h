@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/BoundsAlgo.h"
+
+#include "usdex/pybind/UsdBindings.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace usdex::core;
+using namespace pybind11;
+using namespace pxr;
+
+namespace usdex::core::bindings
+{
+
+void bindBoundsAlgo(module& m)
+{
+    ::class_<WorldBounds>(
+        m,
+        "WorldBounds",
+        "The world space transforms and bounds of the boundable prims below a prim, as computed by ``computeWorldBounds``"
+    )
+        .def(init<>())
+        .def_readwrite("prims", &WorldBounds::prims, "The boundable prims, in depth first traversal order")
+        .def_readwrite("purposes", &WorldBounds::purposes, "The computed purpose of each prim")
+        .def_readwrite("transforms", &WorldBounds::transforms, "The local to world transform of each prim")
+        .def_readwrite("bounds", &WorldBounds::bounds, "The world space axis aligned bounds of each prim")
+        .def_readwrite("range", &WorldBounds::range, "The union of the bounds of all prims");
+
+    m.def(
+        "computeWorldBounds",
+        &computeWorldBounds,
+        arg("prim"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        arg("purposes") = TfTokenVector{ UsdGeomTokens->default_ },
+        R"(
+            Compute the world space transforms and bounds of the boundable prims at and below a prim.
+
+            The traversal matches that of a ``UsdGeom.BBoxCache``:
+
+                - Instance proxies are included, so that the prototypes of native instances contribute once for each instance.
+                - Invisible prims, and prims which are not imageable (e.g. materials and shaders), are skipped along with their descendants.
+                - The descendants of a ``UsdGeom.PointInstancer`` are skipped, as they are accounted for by the extent of the instancer.
+                - Prims with a computed purpose which is not in ``purposes`` are skipped.
+
+            The authored extent of each prim is used when available, otherwise the extent is computed via
+            ``UsdGeom.Boundable.ComputeExtentFromPlugins``. The prims are discovered on the calling thread, then their local transforms and bounds
+            are computed in parallel.
+
+            Parameters:
+                - **prim** - The prim at which to begin the traversal
+                - **time** - The time at which to compute the transforms and bounds
+                - **purposes** - The purposes of the prims to include
+
+            Returns:
+                The transforms and bounds of the boundable prims. If ``prim`` is invalid, a runtime error is posted and the result is empty.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setExtentsHint",
+        &setExtentsHint,
+        arg("prim"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Author the ``extentsHint`` of a prim from the bounds of its boundable descendants.
+
+            The value matches that of ``UsdGeom.ModelAPI.ComputeExtentsHint``, i.e. the bounds of each purpose of the descendants, in the local space
+            of the prim and in the order of ``UsdGeom.Imageable.GetOrderedPurposeTokens``. The bounds are computed in parallel via the same traversal
+            as ``computeWorldBounds``.
+
+            Authoring the ``extentsHint`` on the default prim of an asset allows renderers to frame the asset without traversing its contents.
+
+            Parameters:
+                - **prim** - The prim on which to author the ``extentsHint`` (typically the default prim of an asset)
+                - **time** - The time at which to compute and author the ``extentsHint``
+
+            Returns:
+                Whether the ``extentsHint`` was authored successfully.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+}
+
+} // namespace usdex::core::bindings
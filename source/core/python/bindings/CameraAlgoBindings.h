@@ -9,6 +9,7 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -85,6 +86,44 @@ void bindCameraAlgo(module& m)
 
         )"
     );
+
+    m.def(
+        "defineCameras",
+        [](UsdStagePtr stage, const SdfPathVector& paths, const std::vector<GfCamera>& cameraData, std::optional<std::vector<UsdTimeCode>> times)
+        {
+            // The default times are built on each call, as a default argument holding a UsdTimeCode would import pxr.Usd when this module loads
+            return defineCameras(stage, paths, cameraData, times.has_value() ? times.value() : std::vector<UsdTimeCode>{ UsdTimeCode::Default() });
+        },
+        arg("stage"),
+        arg("paths"),
+        arg("cameraData"),
+        arg("times") = none(),
+        R"(
+            Defines many 3d cameras on the stage at once, optionally animated over many times.
+
+            This is equivalent to calling ``defineCamera`` for each path and then ``UsdGeom.Camera.SetFromCamera`` at each time, but is considerably
+            faster for large numbers of cameras or long animations. Every attribute authored by ``SetFromCamera`` is written as a dense time sample
+            at every time, directly to the current edit target layer within a single ``Sdf.ChangeBlock``. The inverse parent to world transform of
+            each camera is computed once per parent, and only once in total when the ancestors of the parent are not animated.
+
+            The camera data is ordered by path and then by time, such that the camera for ``paths[i]`` at ``times[j]`` is
+            ``cameraData[i * len(times) + j]``.
+
+            All of the locations are validated up front, before any scene description is authored. If any location is invalid, the same path is
+            requested more than once, or the sizes of the arguments are mismatched, a runtime error is posted and no cameras are defined.
+
+            Parameters:
+                - **stage** - The stage on which to define the cameras
+                - **paths** - The absolute prim path at which to define each camera
+                - **cameraData** - The camera data to set for each camera at each time, including the world space transform matrix
+                - **times** - The times at which to author the camera data. The default time authors the default values, matching ``defineCamera``.
+
+            Returns:
+                ``UsdGeom.Camera`` schemas wrapping the defined ``Usd.Prims``, in the same order as ``paths``, or an empty list on error.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 
 } // namespace usdex::core::bindings
@@ -81,7 +81,8 @@ void bindCurvesAlgo(module& m)
 
             Returns:
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -124,7 +125,8 @@ void bindCurvesAlgo(module& m)
 
             Returns:
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -165,7 +167,8 @@ void bindCurvesAlgo(module& m)
 
             Returns:
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -235,7 +238,8 @@ void bindCurvesAlgo(module& m)
 
             Returns:
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -282,7 +286,8 @@ void bindCurvesAlgo(module& m)
 
             Returns:
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -327,8 +332,53 @@ void bindCurvesAlgo(module& m)
 
             Returns:
                 ``UsdGeom.BasisCurves`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
+
+    ::class_<BasisCurvesWriter>(
+        m,
+        "BasisCurvesWriter",
+        R"(
+            Writes time sampled frames of curve data to an existing ``UsdGeom.BasisCurves`` prim.
+
+            This is intended for streaming simulated cables, hair, and grooms, where the topology of the curves is fixed and only the points & widths
+            change per frame. The type, basis, wrap, and curve vertex counts of the prim are read and validated once, when the writer is bound, and the
+            expected number of points and varying values are cached, so that each frame only validates the sizes of its arrays.
+
+            The attributes are authored via the ``UsdGeom.BasisCurves`` schema on the first frame, then all subsequent frames are written directly to
+            the same edit target layer. The extent is computed from the points & widths of each frame and authored at the same time code.
+
+            Widths must be provided for every frame or for none, and their interpolation, element size, and indexing must not change between frames.
+
+            Note:
+                All time samples are held in memory by the edit target layer until it is saved. To bound memory for very long streams, bind a
+                separate writer to each of several layers (e.g. one per range of frames, to be combined via value clips), and save & release each
+                layer when it is complete.
+        )"
+    )
+        .def(init<UsdGeomBasisCurves>(), arg("curves"), "Bind a writer to an existing ``UsdGeom.BasisCurves`` prim.")
+        .def("isValid", &BasisCurvesWriter::isValid, "Whether frames can be written.")
+        .def(
+            "writeFrame",
+            &BasisCurvesWriter::writeFrame,
+            arg("time"),
+            arg("points"),
+            arg("widths") = nullptr,
+            R"(
+                Write a frame of curve data at the given time.
+
+                Parameters:
+                    - **time** - The time code of the frame. It must be numeric and greater than the time of the previous frame.
+                    - **points** - Vertex/CV positions for the curves described in local space. There must be one point for each curve vertex.
+                    - **widths** - Values for the width specification for the curves.
+
+                Returns:
+                    Whether the frame was written.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def("getFrameCount", &BasisCurvesWriter::getFrameCount, "The number of frames that have been written successfully.");
 }
 
 } // namespace usdex::core::bindings
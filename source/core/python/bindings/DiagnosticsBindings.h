@@ -9,6 +9,9 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <memory>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -16,6 +19,54 @@ using namespace pybind11;
 namespace usdex::core::bindings
 {
 
+// A Python context manager which holds an AuthoringErrorScope between `__enter__` and `__exit__`.
+// The recorded errors are retained after `__exit__` so they can be inspected once the `with` block completes.
+class PyAuthoringErrorScope
+{
+
+public:
+
+    PyAuthoringErrorScope(bool captureMessages, bool postDiagnostics) : m_captureMessages(captureMessages), m_postDiagnostics(postDiagnostics)
+    {
+    }
+
+    void enter()
+    {
+        m_errors.clear();
+        m_scope = std::make_unique<AuthoringErrorScope>(m_captureMessages, m_postDiagnostics);
+    }
+
+    void exit()
+    {
+        if (m_scope)
+        {
+            m_errors = m_scope->getErrors();
+            m_scope.reset();
+        }
+    }
+
+    std::vector<AuthoringError> getErrors() const
+    {
+        return m_scope ? m_scope->getErrors() : m_errors;
+    }
+
+    void clear()
+    {
+        m_errors.clear();
+        if (m_scope)
+        {
+            m_scope->clear();
+        }
+    }
+
+private:
+
+    bool m_captureMessages;
+    bool m_postDiagnostics;
+    std::unique_ptr<AuthoringErrorScope> m_scope;
+    std::vector<AuthoringError> m_errors;
+};
+
 void bindDiagnostics(module& m)
 {
     pybind11::enum_<DiagnosticsLevel>(m, "DiagnosticsLevel", "Controls the diagnostics that will be emitted when the ``Delegate`` is active.")
@@ -156,6 +207,208 @@ void bindDiagnostics(module& m)
                 The current ``DiagnosticsOutputStream`` for the ``Delegate``.
         )"
     );
+
+    m.def(
+        "setDiagnosticsBuffered",
+        &setDiagnosticsBuffered,
+        arg("value"),
+        R"(
+            Enable or disable buffered output for the ``Delegate``.
+
+            By default each diagnostic is written to the ``DiagnosticsOutputStream`` synchronously by the thread which emitted it. When authoring from
+            many threads this serializes the threads on the output stream. In buffered mode the diagnostics are formatted by the emitting thread, then
+            pushed into a lock-free queue which is written by a background thread. The relative order of diagnostics from any one thread is preserved.
+
+            Buffered diagnostics are flushed by ``flushDiagnostics()``, ``deactivateDiagnosticsDelegate()``, when disabling buffered mode, and before
+            any fatal diagnostic is printed. If the queue is full, diagnostics are written directly by the emitting thread.
+
+            Args:
+                value: Whether diagnostics should be buffered.
+
+            Returns:
+                ``None``
+        )"
+    );
+
+    m.def(
+        "getDiagnosticsBuffered",
+        &getDiagnosticsBuffered,
+        R"(
+            Get whether buffered output is enabled for the ``Delegate``.
+
+            See ``setDiagnosticsBuffered()`` for more details.
+
+            Returns:
+                Whether diagnostics are buffered.
+        )"
+    );
+
+    m.def(
+        "flushDiagnostics",
+        &flushDiagnostics,
+        R"(
+            Block until all buffered diagnostics have been written to their output stream.
+
+            This has no effect unless buffered output is enabled. See ``setDiagnosticsBuffered()`` for more details.
+
+            Returns:
+                ``None``
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setDiagnosticsRepeatLimit",
+        &setDiagnosticsRepeatLimit,
+        arg("value"),
+        R"(
+            Set the maximum number of times that an identical diagnostic will be emitted by the ``Delegate``.
+
+            Diagnostics are identical if they have the same ``TfDiagnosticType``, source function, and commentary. Once the limit has been reached,
+            the next occurrence is emitted with a note that further repeats are suppressed, and later occurrences are not emitted at all. Setting the
+            limit resets the occurrence counts.
+
+            Fatal diagnostics are never suppressed. Only a fixed number of distinct diagnostics are counted, beyond which diagnostics are not
+            suppressed.
+
+            Args:
+                value: The maximum number of times an identical diagnostic is emitted. Zero disables the limit (the default).
+
+            Returns:
+                ``None``
+        )"
+    );
+
+    m.def(
+        "getDiagnosticsRepeatLimit",
+        &getDiagnosticsRepeatLimit,
+        R"(
+            Get the maximum number of times that an identical diagnostic will be emitted by the ``Delegate``.
+
+            See ``setDiagnosticsRepeatLimit()`` for more details.
+
+            Returns:
+                The maximum number of times an identical diagnostic is emitted. Zero means the limit is disabled.
+        )"
+    );
+
+    ::class_<DiagnosticsFunctionCount>(
+        m,
+        "DiagnosticsFunctionCount",
+        "The number of diagnostics of one type issued by a source function, as reported by ``getDiagnosticsCounts()``."
+    )
+        .def_readonly("function", &DiagnosticsFunctionCount::function, "The source function of the diagnostics, or an empty string if hidden")
+        .def_readonly("type", &DiagnosticsFunctionCount::type, "The type of the diagnostics")
+        .def_readonly("count", &DiagnosticsFunctionCount::count, "The number of diagnostics");
+
+    ::class_<DiagnosticsCounts>(m, "DiagnosticsCounts", "A snapshot of the number of diagnostics received by the ``Delegate``.")
+        .def_readonly("byType", &DiagnosticsCounts::byType, "The number of diagnostics of each type. Types which have not occurred are omitted.")
+        .def_readonly("byFunction", &DiagnosticsCounts::byFunction, "The number of diagnostics of each type by source function, sorted by function");
+
+    m.def(
+        "getDiagnosticsCounts",
+        &getDiagnosticsCounts,
+        R"(
+            Get the number of diagnostics received by the ``Delegate``, by ``Tf.DiagnosticType`` and by source function.
+
+            The ``Delegate`` counts every diagnostic it receives while active, including those which are filtered by the ``DiagnosticsLevel``, muted
+            by the ``DiagnosticsOutputStream``, or suppressed by the repeat limit. This allows warning and error rates to be monitored without
+            capturing the log.
+
+            The counters are atomic, so diagnostics may be issued from many threads without contention. A fixed number of distinct source functions
+            are counted individually, beyond which diagnostics are attributed to an empty function name.
+
+            Returns:
+                A snapshot of the current counts.
+        )"
+    );
+
+    m.def(
+        "resetDiagnosticsCounts",
+        &resetDiagnosticsCounts,
+        R"(
+            Reset the diagnostics counts of the ``Delegate`` to zero.
+
+            Returns:
+                ``None``
+        )"
+    );
+
+    m.def(
+        "getDiagnosticsMetrics",
+        &getDiagnosticsMetrics,
+        R"(
+            Get the diagnostics counts of the ``Delegate`` in the Prometheus / OpenMetrics text exposition format.
+
+            Two counter families are reported, ``usdex_diagnostics`` with a ``type`` label and ``usdex_diagnostics_by_function`` with ``type`` and
+            ``function`` labels. The ``type`` label is the snake case name of the ``Tf.DiagnosticType`` (e.g. ``warning`` or ``runtime_error``). The
+            text is terminated by ``# EOF``, so it can be served directly from a metrics endpoint or written to a textfile collector.
+
+            Returns:
+                The metrics text.
+        )"
+    );
+
+    pybind11::enum_<AuthoringErrorCode>(m, "AuthoringErrorCode", "The reason that a prim could not be authored by a ``define`` function.")
+        .value("eInvalidStage", AuthoringErrorCode::eInvalidStage, "The stage is not valid.")
+        .value("eInvalidLocation", AuthoringErrorCode::eInvalidLocation, "The location is not a valid or editable prim location.")
+        .value("eDuplicatePath", AuthoringErrorCode::eDuplicatePath, "The location was requested more than once within a single batch.")
+        .value("eInvalidArgument", AuthoringErrorCode::eInvalidArgument, "One of the arguments (e.g. the topology or primvar data) is not valid.");
+
+    ::class_<AuthoringError>(m, "AuthoringError", "A structured record of a prim which could not be authored.")
+        .def_readonly("function", &AuthoringError::function, "The name of the function which failed (e.g. ``usdex::core::defineXform``)")
+        .def_readonly("path", &AuthoringError::path, "The requested location of the prim, or an empty path if the location could not be formed")
+        .def_readonly("code", &AuthoringError::code, "The reason for the failure")
+        .def_readonly("message", &AuthoringError::message, "The diagnostic message, or an empty string if messages are not captured");
+
+    ::class_<PyAuthoringErrorScope>(
+        m,
+        "AuthoringErrorScope",
+        R"(
+            A context manager which collects structured ``AuthoringError`` records from the ``define`` functions.
+
+            By default a ``define`` function which fails posts a ``Tf.Error`` and returns an invalid object, so a client authoring many prims must
+            inspect the commentary of each error to discover which prims failed. While the context is active, failures are instead recorded with the
+            function name, prim path, and error code, without posting a diagnostic. Unless messages are captured, the diagnostic message is not
+            formatted at all.
+
+            The context applies to the calling thread only and may be nested, in which case errors are recorded by the innermost context. The
+            recorded errors remain available after the context exits.
+
+            Args:
+                captureMessages: Whether the diagnostic message of each error should be formatted and stored in ``AuthoringError.message``
+                postDiagnostics: Whether each error should also be posted as a ``Tf.Error``, as it would be without the context
+        )"
+    )
+        .def(init<bool, bool>(), arg("captureMessages") = false, arg("postDiagnostics") = false)
+        .def(
+            "__enter__",
+            [](PyAuthoringErrorScope& self) -> PyAuthoringErrorScope&
+            {
+                self.enter();
+                return self;
+            },
+            return_value_policy::reference
+        )
+        .def(
+            "__exit__",
+            [](PyAuthoringErrorScope& self, const object&, const object&, const object&)
+            {
+                self.exit();
+                return false;
+            }
+        )
+        .def(
+            "getErrors",
+            &PyAuthoringErrorScope::getErrors,
+            R"(
+                Get the errors recorded by this context, in the order they occurred.
+
+                Returns:
+                    A list of ``AuthoringError`` records.
+            )"
+        )
+        .def("clear", &PyAuthoringErrorScope::clear, "Discard the errors recorded by this context.");
 }
 
 } // namespace usdex::core::bindings
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/ExtentAlgo.h"
+
+#include "usdex/pybind/UsdBindings.h"
+
+#include <pybind11/pybind11.h>
+
+using namespace usdex::core;
+using namespace pybind11;
+using namespace pxr;
+
+namespace usdex::core::bindings
+{
+
+void bindExtentAlgo(module& m)
+{
+    m.def(
+        "computePointsExtent",
+        overload_cast<const VtVec3fArray&>(&computePointsExtent),
+        arg("points"),
+        R"(
+            Compute the extent of an array of points.
+
+            Large arrays are reduced in parallel. If the array is empty, the result describes an empty range (i.e. the min is greater than the max).
+
+            Parameters:
+                - **points** - The points to bound
+
+            Returns:
+                An array of two values, the min and max of the bounds.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "computePointsExtent",
+        overload_cast<const VtVec3fArray&, const FloatPrimvarData&>(&computePointsExtent),
+        arg("points"),
+        arg("widths"),
+        R"(
+            Compute the extent of an array of points, padded by half of their widths.
+
+            If the widths provide a value for each point (e.g. vertex interpolation) each point is padded by its own width. Otherwise all points are
+            padded by the largest width, which is exact for constant widths and conservative for per-segment or per-curve widths.
+
+            Parameters:
+                - **points** - The points to bound
+                - **widths** - The widths of the points (e.g. of a ``UsdGeom.Points`` or ``UsdGeom.Curves`` prim)
+
+            Returns:
+                An array of two values, the min and max of the bounds.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setExtentTimeSamples",
+        &setExtentTimeSamples,
+        arg("pointBased"),
+        R"(
+            Author the extent of a ``UsdGeom.PointBased`` prim for its default value and every authored time sample of its points.
+
+            For ``UsdGeom.Points`` and ``UsdGeom.Curves`` prims the widths primvar (or the native widths attribute) is also considered, and its time
+            samples are included. The points and widths are read and the extents are computed in parallel, then all extents are authored to the
+            current edit target in a single change block.
+
+            Any existing extent opinions on the current edit target are replaced.
+
+            Parameters:
+                - **pointBased** - The prim on which to author the extent
+
+            Returns:
+                Whether the extents were authored successfully.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+}
+
+} // namespace usdex::core::bindings
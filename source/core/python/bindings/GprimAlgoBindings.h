@@ -527,5 +527,126 @@ void bindGprimAlgo(module& m)
                 ``UsdGeom.Capsule`` schema wrapping the defined ``Usd.Prim``.
         )"
     );
+
+    ::class_<GprimData> gprimData(
+        m,
+        "GprimData",
+        R"(
+            The arguments required to define a single geometric primitive via ``defineGprims`` or ``defineGprimInstancer``.
+
+            The members match the arguments of the ``define`` function of each gprim, with the addition of the type of the gprim and the absolute
+            prim path at which to define it. Members which do not apply to the type of the gprim are ignored.
+        )"
+    );
+
+    pybind11::enum_<GprimData::Type>(gprimData, "Type", "The types of gprim which can be defined")
+        .value("Plane", GprimData::Type::Plane, "A ``UsdGeom.Plane``, see ``definePlane``")
+        .value("Sphere", GprimData::Type::Sphere, "A ``UsdGeom.Sphere``, see ``defineSphere``")
+        .value("Cube", GprimData::Type::Cube, "A ``UsdGeom.Cube``, see ``defineCube``")
+        .value("Cone", GprimData::Type::Cone, "A ``UsdGeom.Cone``, see ``defineCone``")
+        .value("Cylinder", GprimData::Type::Cylinder, "A ``UsdGeom.Cylinder``, see ``defineCylinder``")
+        .value("Capsule", GprimData::Type::Capsule, "A ``UsdGeom.Capsule``, see ``defineCapsule``");
+
+    gprimData.def(init<>())
+        .def(
+            init(
+                [](GprimData::Type type,
+                   std::optional<SdfPath> path,
+                   double radius,
+                   double height,
+                   double size,
+                   double width,
+                   double length,
+                   const TfToken& axis,
+                   std::optional<GfVec3f> displayColor,
+                   std::optional<float> displayOpacity)
+                {
+                    return GprimData{ type, path.value_or(SdfPath()), radius, height, size, width, length, axis, displayColor, displayOpacity };
+                }
+            ),
+            arg("type"),
+            // An empty path is not converted eagerly, so that `pxr.Sdf` is not required while the module is imported
+            arg("path") = nullptr,
+            arg("radius") = 1.0,
+            arg("height") = 2.0,
+            arg("size") = 2.0,
+            arg("width") = 2.0,
+            arg("length") = 2.0,
+            arg("axis") = UsdGeomTokens->z,
+            arg("displayColor") = nullptr,
+            arg("displayOpacity") = nullptr
+        )
+        .def_readwrite("type", &GprimData::type, "The type of the gprim")
+        .def_readwrite("path", &GprimData::path, "The absolute prim path at which to define the gprim")
+        .def_readwrite("radius", &GprimData::radius, "The radius of a sphere, cone, cylinder, or capsule")
+        .def_readwrite("height", &GprimData::height, "The height of a cone, cylinder, or capsule")
+        .def_readwrite("size", &GprimData::size, "The edge length of a cube")
+        .def_readwrite("width", &GprimData::width, "The width of a plane")
+        .def_readwrite("length", &GprimData::length, "The length of a plane")
+        .def_readwrite("axis", &GprimData::axis, "The axis of a plane, cone, cylinder, or capsule")
+        .def_readwrite("displayColor", &GprimData::displayColor, "Values to be authored for the display color")
+        .def_readwrite("displayOpacity", &GprimData::displayOpacity, "Values to be authored for the display opacity");
+
+    m.def(
+        "defineGprims",
+        &defineGprims,
+        arg("stage"),
+        arg("gprims"),
+        R"(
+            Defines many geometric primitives on the stage at once.
+
+            The result is equivalent to calling the ``define`` function matching the type of each element of ``gprims``, but is significantly faster
+            for large numbers of gprims (e.g. when visualizing physics collision shapes). Use ``setLocalTransforms`` to position the gprims once they
+            are defined.
+
+            All of the gprims are validated up front, before any scene description is authored. If any location is invalid, or the same path is
+            requested more than once, a runtime error is posted for each failure and no gprims are defined.
+
+            The extent of each gprim is computed in closed form from its arguments, and the gprims are authored directly to the ``Sdf.Layer`` of the
+            current edit target within a single ``Sdf.ChangeBlock``, so that change notification and stage recomposition occur once for the whole
+            batch.
+
+            Parameters:
+                - **stage** - The stage on which to define the gprims
+                - **gprims** - The type, path, and parameters of each gprim
+
+            Returns:
+                ``UsdGeom.Gprim`` schemas wrapping the defined ``Usd.Prims``, in the same order as ``gprims``, or an empty list if the gprims could not be defined.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "defineGprimInstancer",
+        &defineGprimInstancer,
+        arg("stage"),
+        arg("path"),
+        arg("gprims"),
+        arg("positions"),
+        arg("orientations") = std::vector<GfQuatf>(),
+        R"(
+            Defines a point instancer which instances geometric primitives, rather than defining each gprim as a separate prim.
+
+            Gprims with identical parameters (ignoring their paths) share a single prototype, so this is preferable to ``defineGprims`` when many of
+            the parameters repeat. The prototypes are defined in a ``Prototypes`` scope below the point instancer, and each element of ``gprims``
+            becomes an instance of its prototype at the matching element of ``positions`` and ``orientations``.
+
+            The extent of the point instancer is computed from the closed form extent of each prototype, and all specs are authored within a single
+            ``Sdf.ChangeBlock``.
+
+            Parameters:
+                - **stage** - The stage on which to define the point instancer
+                - **path** - The absolute prim path at which to define the point instancer
+                - **gprims** - The type and parameters of each instance. The paths are ignored.
+                - **positions** - The position of each instance
+                - **orientations** - The orientation of each instance. If empty, no orientations are authored.
+
+            Returns:
+                ``UsdGeom.PointInstancer`` schema wrapping the defined ``Usd.Prim``, or an invalid schema if the arguments are invalid.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 } // namespace usdex::core::bindings
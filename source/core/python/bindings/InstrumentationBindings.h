@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/Instrumentation.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace usdex::core;
+using namespace pybind11;
+
+namespace usdex::core::bindings
+{
+
+void bindInstrumentation(module& m)
+{
+    ::class_<InstrumentationCounter>(m, "InstrumentationCounter", "The aggregated measurements of a single instrumented function")
+        .def(init<>())
+        .def_readwrite("name", &InstrumentationCounter::name, "The name of the instrumented function")
+        .def_readwrite("calls", &InstrumentationCounter::calls, "The number of calls recorded")
+        .def_readwrite("totalSeconds", &InstrumentationCounter::totalSeconds, "The cumulative wall time of all recorded calls, in seconds")
+        .def_readwrite("maxSeconds", &InstrumentationCounter::maxSeconds, "The wall time of the slowest recorded call, in seconds")
+        .def_readwrite("bytes", &InstrumentationCounter::bytes, "The cumulative bytes of array data authored by all recorded calls");
+
+    m.def(
+        "isInstrumentationEnabled",
+        &isInstrumentationEnabled,
+        R"(
+            Test whether instrumentation is currently enabled.
+
+            Instrumentation is disabled by default. It can be enabled using ``setInstrumentationEnabled()`` or the ``USDEX_ENABLE_INSTRUMENTATION``
+            environment variable.
+
+            Returns:
+                Whether instrumented functions are recording measurements.
+        )"
+    );
+
+    m.def(
+        "setInstrumentationEnabled",
+        &setInstrumentationEnabled,
+        arg("value"),
+        R"(
+            Enable or disable instrumentation.
+
+            The hot paths of this library (e.g. the ``define`` functions, ``saveStage``, ``exportLayer``, name validation, and ``PrimvarData.index``)
+            are instrumented with scoped timers, which record the number of calls, the cumulative and maximum latency, and the bytes of array data
+            authored. While disabled the cost of each instrumented call is negligible.
+
+            Args:
+                value: Whether instrumented functions should record measurements.
+
+            Returns:
+                ``None``
+        )"
+    );
+
+    m.def(
+        "getInstrumentationCounters",
+        &getInstrumentationCounters,
+        R"(
+            Get the measurements of all instrumented functions that have recorded at least one call.
+
+            Note:
+                Nested calls are recorded by each instrumented function, so the latency of one function may include that of another.
+
+            Returns:
+                A list of ``InstrumentationCounter`` sorted by name.
+        )"
+    );
+
+    m.def(
+        "resetInstrumentationCounters",
+        &resetInstrumentationCounters,
+        R"(
+            Reset the measurements of all instrumented functions.
+
+            Returns:
+                ``None``
+        )"
+    );
+}
+
+} // namespace usdex::core::bindings
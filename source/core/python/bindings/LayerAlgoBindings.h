@@ -11,12 +11,40 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <chrono>
+#include <future>
+
 using namespace usdex::core;
 using namespace pybind11;
 
 namespace usdex::core::bindings
 {
 
+// A Python handle to the result of an async save, which can be polled, waited on, or awaited from a coroutine
+class PySaveFuture
+{
+
+public:
+
+    explicit PySaveFuture(std::future<bool>&& future) : m_future(future.share())
+    {
+    }
+
+    bool done() const
+    {
+        return m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    bool result() const
+    {
+        return m_future.get();
+    }
+
+private:
+
+    std::shared_future<bool> m_future;
+};
+
 void bindLayerAlgo(module& m)
 {
     m.def(
@@ -105,9 +133,60 @@ void bindLayerAlgo(module& m)
         )"
     );
 
+    ::class_<LayerWriteOptions>(
+        m,
+        "LayerWriteOptions",
+        R"(
+            Options which control how a USD layer is encoded when it is written.
+
+            A ``.usd`` file may be USDA encoded (human-readable text) or USDC encoded (the binary Crate encoding). USDC is significantly faster to
+            write and read, and produces smaller files, so it is the default for new ``.usd`` files. USDA is useful for debugging and for content
+            which is reviewed or merged as text, but it scales poorly with large arrays.
+
+            The USDC encoding always compresses integer, floating point, and index arrays and deduplicates repeated values (tokens, paths, and
+            identical arrays) within each file. The Crate version of newly written files is selected process-wide via the
+            ``USD_WRITE_NEW_USDC_FILES_AS_VERSION`` environment variable (which must be set before OpenUSD is first used), in order to produce
+            files that older OpenUSD runtimes can read. None of these can be controlled per layer, so they are not exposed as options here.
+        )"
+    )
+        .def(init<>())
+        .def(init([](const pxr::TfToken& encoding) { return LayerWriteOptions{ encoding }; }), arg("encoding"))
+        .def_readwrite(
+            "encoding",
+            &LayerWriteOptions::encoding,
+            "The encoding of ``.usd`` files, either \"usda\" or \"usdc\". If empty, new layers use the default encoding and existing layers retain "
+            "their current encoding."
+        );
+
+    m.def(
+        "getLayerWriteFileFormatArgs",
+        [](const std::string& identifier, const LayerWriteOptions& writeOptions, const pxr::SdfLayer::FileFormatArguments& fileFormatArgs)
+        {
+            pxr::SdfLayer::FileFormatArguments result = fileFormatArgs;
+            std::string reason;
+            bool valid = getLayerWriteFileFormatArgs(identifier, writeOptions, &result, &reason);
+            return pybind11::make_tuple(valid, result, reason);
+        },
+        arg("identifier"),
+        arg("writeOptions"),
+        arg("fileFormatArgs") = pxr::SdfLayer::FileFormatArguments(),
+        R"(
+            Validate write options for a layer identifier and convert them to file format arguments.
+
+            Args:
+                identifier: The identifier of the layer to be written.
+                writeOptions: The options to convert.
+                fileFormatArgs: The file format arguments to which the options are added. Existing arguments are overridden by the options.
+
+            Returns:
+                A tuple of whether the options are valid for the identifier, the combined file format arguments, and a message describing the
+                validation error (if any).
+        )"
+    );
+
     m.def(
         "saveLayer",
-        &saveLayer,
+        overload_cast<pxr::SdfLayerHandle, std::optional<std::string_view>, std::optional<std::string_view>>(&saveLayer),
         arg("layer"),
         arg("authoringMetadata") = nullptr,
         arg("comment") = nullptr,
@@ -126,12 +205,43 @@ void bindLayerAlgo(module& m)
 
              Returns:
                 A bool indicating if the save was successful.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "saveLayer",
+        overload_cast<pxr::SdfLayerHandle, const LayerWriteOptions&, std::optional<std::string_view>, std::optional<std::string_view>>(&saveLayer),
+        arg("layer"),
+        arg("writeOptions"),
+        arg("authoringMetadata") = nullptr,
+        arg("comment") = nullptr,
+        R"(
+            Save the given ``Sdf.Layer`` with an optional comment, using the given write options.
+
+            This is equivalent to the above function, except that a ``.usd`` layer can be re-encoded. If the requested encoding differs from the
+            current encoding of the layer, the layer is exported to its own location with the new encoding and then reloaded.
+
+            Args:
+                layer: The layer to be saved.
+                writeOptions: The options which control how the layer is encoded. A warning is emitted if the options are invalid for the layer.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                comment: The comment will be authored in the layer as the ``Sdf.Layer`` comment.
+
+            Returns:
+                A bool indicating if the save was successful.
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "exportLayer",
-        &exportLayer,
+        overload_cast<
+            pxr::SdfLayerHandle,
+            const std::string&,
+            const std::string&,
+            std::optional<std::string_view>,
+            const pxr::SdfLayer::FileFormatArguments&>(&exportLayer),
         arg("layer"),
         arg("identifier"),
         arg("authoringMetadata"),
@@ -155,6 +265,342 @@ void bindLayerAlgo(module& m)
 
             Returns:
                 A bool indicating if the export was successful.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "exportLayer",
+        overload_cast<pxr::SdfLayerHandle, const std::string&, const std::string&, std::optional<std::string_view>, const LayerWriteOptions&>(
+            &exportLayer
+        ),
+        arg("layer"),
+        arg("identifier"),
+        arg("authoringMetadata"),
+        arg("comment") = nullptr,
+        arg("writeOptions") = LayerWriteOptions(),
+        R"(
+            Export the given ``Sdf.Layer`` to an identifier with an optional comment, using the given write options.
+
+            Args:
+                layer: The layer to be exported.
+                identifier: The identifier to be used for the new layer.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored in the layer as the ``Sdf.Layer`` comment.
+                writeOptions: The options which control how the layer is encoded. A warning is emitted if the options are invalid for the
+                    identifier.
+
+            Returns:
+                A bool indicating if the export was successful.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<PySaveFuture>(
+        m,
+        "SaveFuture",
+        R"(
+            The pending result of ``saveLayerAsync``, ``exportLayerAsync``, or ``saveStageAsync``.
+
+            The result can be polled via ``done``, waited on via ``result``, or awaited from a coroutine. Awaiting waits on a thread of the default
+            executor of the running ``asyncio`` event loop, so the event loop is not blocked while the save is in flight.
+
+            Example:
+
+                .. code-block:: python
+
+                    async def save(layer):
+                        return await usdex.core.saveLayerAsync(layer, authoring_metadata)
+        )"
+    )
+        .def("done", &PySaveFuture::done, "Whether the save has completed")
+        .def("result", &PySaveFuture::result, "Wait for the save to complete and return whether it was successful", call_guard<gil_scoped_release>())
+        .def(
+            "__await__",
+            [](object self)
+            {
+                object loop = module_::import("asyncio").attr("get_running_loop")();
+                return loop.attr("run_in_executor")(none(), self.attr("result")).attr("__await__")();
+            }
+        );
+
+    m.def(
+        "saveLayerAsync",
+        [](pxr::SdfLayerHandle layer, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
+        { return PySaveFuture(saveLayerAsync(layer, authoringMetadata, comment)); },
+        arg("layer"),
+        arg("authoringMetadata") = nullptr,
+        arg("comment") = nullptr,
+        R"(
+            Save the given ``Sdf.Layer`` with an optional comment, serializing it on a background thread.
+
+            This is equivalent to ``saveLayer``, except that the contents of the layer are copied on the calling thread and the copy is written to
+            the identifier of the layer in the background. It is safe to continue editing the layer while the save is in flight, and those edits
+            will not be reflected in the saved file.
+
+            All async saves are written by a single background thread in the order they were requested, so successive saves of the same layer
+            produce the most recently requested contents.
+
+            Note:
+
+                Unlike ``saveLayer``, the layer remains dirty after the save has completed, as it may have been edited in the meantime.
+
+            Args:
+                layer: The layer to be saved.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                comment: The comment will be authored in the layer as the ``Sdf.Layer`` comment.
+
+            Returns:
+                A ``SaveFuture`` which becomes ready once the save has completed, indicating if the save was successful.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "exportLayerAsync",
+        [](pxr::SdfLayerHandle layer,
+           const std::string& identifier,
+           const std::string& authoringMetadata,
+           std::optional<std::string_view> comment,
+           const pxr::SdfLayer::FileFormatArguments& fileFormatArgs)
+        { return PySaveFuture(exportLayerAsync(layer, identifier, authoringMetadata, comment, fileFormatArgs)); },
+        arg("layer"),
+        arg("identifier"),
+        arg("authoringMetadata"),
+        arg("comment") = nullptr,
+        arg("fileFormatArgs") = pxr::SdfLayer::FileFormatArguments(),
+        R"(
+            Export the given ``Sdf.Layer`` to an identifier with an optional comment, serializing it on a background thread.
+
+            This is equivalent to ``exportLayer``, except that the contents of the layer are copied on the calling thread and the copy is written to
+            the identifier in the background. It is safe to continue editing the layer while the export is in flight, and those edits will not be
+            reflected in the exported file. The comment is only authored in the exported file.
+
+            Exports are written by the same background thread as ``saveLayerAsync``, in the order they were requested.
+
+            Args:
+                layer: The layer to be exported.
+                identifier: The identifier to be used for the new layer.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored in the layer as the ``Sdf.Layer`` comment.
+                fileFormatArgs: Additional file format-specific arguments to be supplied during layer export.
+
+            Returns:
+                A ``SaveFuture`` which becomes ready once the export has completed, indicating if the export was successful.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "exportLayerToBuffer",
+        [](SdfLayerHandle layer, const std::string& authoringMetadata, std::optional<std::string_view> comment, const LayerWriteOptions& writeOptions)
+        {
+            std::string buffer;
+            bool success;
+            {
+                gil_scoped_release release;
+                success = exportLayerToBuffer(layer, &buffer, authoringMetadata, comment, writeOptions);
+            }
+            return success ? object(bytes(buffer)) : object(none());
+        },
+        arg("layer"),
+        arg("authoringMetadata"),
+        arg("comment") = nullptr,
+        arg("writeOptions") = LayerWriteOptions(),
+        R"(
+            Export the given ``Sdf.Layer`` to an in-memory buffer with an optional comment, rather than to an identifier.
+
+            This is equivalent to ``exportLayerToCallback``, except that the serialized layer is returned as a single ``bytes`` object.
+
+            Args:
+                layer: The layer to be exported.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored in the exported data as the ``Sdf.Layer`` comment.
+                writeOptions: The options which control how the layer is encoded. A warning is emitted if the options are invalid.
+
+            Returns:
+                The serialized layer, or ``None`` if the export was unsuccessful.
+        )"
+    );
+
+    m.def(
+        "exportLayerToCallback",
+        [](SdfLayerHandle layer,
+           const function& callback,
+           const std::string& authoringMetadata,
+           std::optional<std::string_view> comment,
+           const LayerWriteOptions& writeOptions,
+           size_t chunkSize)
+        {
+            // An exception raised by the callback aborts the export, and is raised once the export has returned
+            auto write = [&callback](const char* data, size_t size)
+            {
+                gil_scoped_acquire acquire;
+                try
+                {
+                    object result = callback(bytes(data, size));
+                    return result.is_none() || result.cast<bool>();
+                }
+                catch (error_already_set& error)
+                {
+                    error.restore();
+                    return false;
+                }
+            };
+
+            bool success;
+            {
+                gil_scoped_release release;
+                success = exportLayerToCallback(layer, write, authoringMetadata, comment, writeOptions, chunkSize);
+            }
+            if (PyErr_Occurred())
+            {
+                throw error_already_set();
+            }
+            return success;
+        },
+        arg("layer"),
+        arg("callback"),
+        arg("authoringMetadata"),
+        arg("comment") = nullptr,
+        arg("writeOptions") = LayerWriteOptions(),
+        arg("chunkSize") = size_t(1 << 20),
+        R"(
+            Export the given ``Sdf.Layer`` to a chunked output callback with an optional comment, rather than to an identifier.
+
+            This applies the same authoring metadata and comment handling as ``exportLayer``, but the serialized layer is passed to the ``callback``
+            as ``bytes`` in chunks of at most ``chunkSize``, so that it can be streamed directly to a network or object storage service. The
+            callback may return ``False`` to abort the export. Any exception raised by the callback aborts the export and is re-raised.
+
+            As there is no identifier to imply a file format, the ``writeOptions`` choose between the "usda" and "usdc" encodings. If no encoding
+            is specified, layers which are already USDC encoded are exported as "usdc" and all other layers are exported as "usda".
+
+            Note:
+
+                USDA layers are serialized entirely in memory. The Crate writer of OpenUSD can only write to an ``Ar.WritableAsset``, so USDC layers
+                are serialized to a file in the temporary directory of the system, which is streamed to the callback and then removed.
+
+            Args:
+                layer: The layer to be exported.
+                callback: The callable which receives each chunk of the serialized layer.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored in the exported data as the ``Sdf.Layer`` comment.
+                writeOptions: The options which control how the layer is encoded. A warning is emitted if the options are invalid.
+                chunkSize: The maximum number of bytes passed to each call of the ``callback``.
+
+            Returns:
+                A bool indicating if the export was successful.
+        )"
+    );
+
+    ::class_<LayerChangeTracker>(
+        m,
+        "LayerChangeTracker",
+        R"(
+            Records the specs of an ``Sdf.Layer`` which have changed, so that only those specs need to be exported.
+
+            Continuously exporting a large layer via ``exportLayer`` costs a full write for every edit, however small. This class listens to
+            ``Sdf.Notice.LayersDidChange`` and records the paths of the specs which have been edited since construction (or since the last call to
+            ``clear`` or ``exportDelta``), so that a compact delta layer holding only those specs can be exported instead. The cost of each export
+            is then proportional to the size of the edits rather than the size of the layer.
+
+            A delta layer is not intended to be composed. Instead, the deltas should periodically be flattened back into the base layer, in the
+            order they were exported, via ``applyLayerDelta``.
+
+            Edited prims contribute their own fields only, while edited properties, new prims, and prims with reordered children or edited variant
+            sets contribute their entire spec. Removed specs are recorded in the metadata of the delta layer.
+
+            Example:
+
+                .. code-block:: python
+
+                    usdex.core.exportLayer(layer, base_identifier, authoring_metadata)
+                    tracker = usdex.core.LayerChangeTracker(layer)
+                    ...
+                    tracker.exportDelta(delta_identifier, authoring_metadata)
+                    ...
+                    base_layer = Sdf.Layer.FindOrOpen(base_identifier)
+                    usdex.core.applyLayerDelta(base_layer, Sdf.Layer.FindOrOpen(delta_identifier))
+                    usdex.core.saveLayer(base_layer)
+        )"
+    )
+        .def(init<pxr::SdfLayerHandle>(), arg("layer"), "Start recording the changes to a layer.")
+        .def("isValid", &LayerChangeTracker::isValid, "Whether the tracked layer is valid.")
+        .def("getLayer", &LayerChangeTracker::getLayer, "The tracked layer.")
+        .def("hasChanges", &LayerChangeTracker::hasChanges, "Whether any changes have been recorded.")
+        .def(
+            "getChangedPaths",
+            &LayerChangeTracker::getChangedPaths,
+            R"(
+                The paths of the specs which have changed, in path order.
+
+                Changes to relationship targets and attribute connections are recorded on their owning property, and changes to layer metadata
+                are recorded on the absolute root path.
+            )"
+        )
+        .def(
+            "writeDelta",
+            &LayerChangeTracker::writeDelta,
+            arg("delta"),
+            R"(
+                Write the recorded changes into a delta layer.
+
+                Any existing content of the delta layer is replaced. The recorded changes are not cleared.
+
+                Parameters:
+                    - **delta** - The layer in which to author the delta.
+
+                Returns:
+                    Whether the delta was written.
+            )"
+        )
+        .def(
+            "exportDelta",
+            &LayerChangeTracker::exportDelta,
+            arg("identifier"),
+            arg("authoringMetadata"),
+            arg("comment") = nullptr,
+            arg("fileFormatArgs") = pxr::SdfLayer::FileFormatArguments(),
+            R"(
+                Export the recorded changes as a delta layer to an identifier, then clear the recorded changes.
+
+                The delta layer is exported via ``exportLayer``, so the same authoring metadata, comment, and file format arguments apply.
+                The recorded changes are only cleared if the export was successful.
+
+                Parameters:
+                    - **identifier** - The identifier to be used for the delta layer.
+                    - **authoringMetadata** - The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    - **comment** - The comment will be authored in the delta layer as the ``Sdf.Layer`` comment.
+                    - **fileFormatArgs** - Additional file format-specific arguments to be supplied during layer export.
+
+                Returns:
+                    A bool indicating if the export was successful.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def("clear", &LayerChangeTracker::clear, "Discard all recorded changes.");
+
+    m.def(
+        "applyLayerDelta",
+        &applyLayerDelta,
+        arg("layer"),
+        arg("delta"),
+        R"(
+            Flatten a delta layer written by ``LayerChangeTracker`` into a layer.
+
+            The removed specs of the delta are removed from the layer, then each changed spec of the delta replaces the equivalent spec of the
+            layer. All edits are made within a single ``Sdf.ChangeBlock``. Deltas must be applied in the order they were written.
+
+            Args:
+                layer: The layer to modify, typically the base layer which was exported before the changes were tracked.
+                delta: The delta layer to apply.
+
+            Returns:
+                Whether the delta was applied. A runtime error is emitted if either layer is invalid or the delta was not written by a tracker.
         )"
     );
 
@@ -182,6 +628,97 @@ void bindLayerAlgo(module& m)
                 The USD file format encoding of the layer, or an empty token if the layer is not a valid USD layer.
         )"
     );
+
+    ::class_<AttributeDataSize>(
+        m,
+        "AttributeDataSize",
+        R"(
+            The estimated size of attribute data, as reported by ``computeLayerMemoryReport``.
+
+            The role of each attribute is determined by its name, and the bytes of its values are counted in exactly one of the role categories, so
+            the role categories sum to the ``serializedBytes``. The ``inMemoryBytes`` differ from the ``serializedBytes`` when several values share
+            the storage of a single array (e.g. when the same array is authored to several attributes or time samples), as the storage is only held
+            in memory once.
+        )"
+    )
+        .def(init<>())
+        .def_readwrite("pointsBytes", &AttributeDataSize::pointsBytes, "The bytes of ``points`` and ``positions`` values")
+        .def_readwrite(
+            "indicesBytes",
+            &AttributeDataSize::indicesBytes,
+            "The bytes of topology (e.g. ``faceVertexIndices``), GeomSubset, instancer, and primvar ``indices`` values"
+        )
+        .def_readwrite("primvarsBytes", &AttributeDataSize::primvarsBytes, "The bytes of primvar values, including ``normals`` and ``widths``")
+        .def_readwrite("otherBytes", &AttributeDataSize::otherBytes, "The bytes of all other attribute values")
+        .def_readwrite(
+            "timeSampleBytes",
+            &AttributeDataSize::timeSampleBytes,
+            "The bytes of the values above which are authored as time samples rather than default values"
+        )
+        .def_readwrite(
+            "serializedBytes",
+            &AttributeDataSize::serializedBytes,
+            "The estimated bytes written when serializing the values, before any compression by the file format"
+        )
+        .def_readwrite(
+            "inMemoryBytes",
+            &AttributeDataSize::inMemoryBytes,
+            "The estimated bytes held in memory by the values, counting shared array storage once"
+        )
+        .def_readwrite(
+            "detachedBytes",
+            &AttributeDataSize::detachedBytes,
+            "The bytes of ``inMemoryBytes`` held by arrays whose storage is used by a single value"
+        )
+        .def_readwrite(
+            "sharedBytes",
+            &AttributeDataSize::sharedBytes,
+            "The bytes of ``inMemoryBytes`` held by arrays whose storage is shared by several values"
+        );
+
+    ::class_<LayerMemoryReport>(
+        m,
+        "LayerMemoryReport",
+        "The estimated size of the attribute data authored in a single layer, as computed by ``computeLayerMemoryReport``"
+    )
+        .def(init<>())
+        .def_readwrite("identifier", &LayerMemoryReport::identifier, "The identifier of the layer")
+        .def_readwrite("total", &LayerMemoryReport::total, "The size of all attribute data in the layer")
+        .def_readwrite(
+            "prims",
+            &LayerMemoryReport::prims,
+            "The prims of the layer, in path order. Prims authored within variants are reported without the selection."
+        )
+        .def_readwrite("subtrees", &LayerMemoryReport::subtrees, "The size of the attribute data authored at and below each prim");
+
+    m.def(
+        "computeLayerMemoryReport",
+        &computeLayerMemoryReport,
+        arg("layer"),
+        R"(
+            Compute the estimated in-memory and serialized size of the attribute data authored in a layer, for each prim subtree.
+
+            This is intended to identify which parts of an asset are responsible for its memory use (e.g. to choose the primvars which would benefit
+            from indexing or quantization) and to enforce size budgets on converted assets.
+
+            The default values and time samples of all attribute specs are measured, including those authored within variants. The size of an array
+            is the size of its elements (plus the characters of any strings), and the size of any other value is the size of its type. Arrays which
+            share storage are identified by their data, which is counted in memory by the first prim (in path order) to reference it.
+
+            The specs are discovered on the calling thread, then their values are measured in parallel.
+
+            Note:
+                Measuring the values of a layer which was read from a file may load values which had not yet been accessed (e.g. by a USDC reader
+                which loads values on demand), so the memory held by the layer may grow while it is being measured.
+
+            Args:
+                layer: The layer to measure
+
+            Returns:
+                The ``LayerMemoryReport``. If the layer is invalid, a runtime error is posted and the report is empty.
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 
 } // namespace usdex::core::bindings
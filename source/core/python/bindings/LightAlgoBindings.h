@@ -232,6 +232,37 @@ void bindLightAlgo(module& m)
                 The light if created successfully.
         )"
     );
+
+    m.def(
+        "defineRectLights",
+        &defineRectLights,
+        arg("stage"),
+        arg("paths"),
+        arg("widths"),
+        arg("heights"),
+        arg("intensities") = std::vector<float>(),
+        R"(
+            Creates many untextured rectangular (rect) lights at once.
+
+            The result is equivalent to calling ``defineRectLight`` for each path, but is significantly faster for large numbers of lights (e.g. the
+            fixtures of a factory or warehouse). Use ``setLocalTransforms`` to position the lights once they are defined.
+
+            All of the locations are validated up front, before any scene description is authored. If any location is invalid, or the same path is
+            requested more than once, a runtime error is posted for each failure and no lights are defined. The lights are then authored directly
+            to the ``Sdf.Layer`` of the current edit target within a single ``Sdf.ChangeBlock``.
+
+            Parameters:
+                - **stage** - The stage in which the rectangular lights should be authored
+                - **paths** - The path which each rectangular light prim should be written to
+                - **widths** - The width of each rectangular light, in the local X axis.
+                - **heights** - The height of each rectangular light, in the local Y axis.
+                - **intensities** - The intensity value of each rectangular light. If empty, each light has an intensity of 1.
+
+            Returns:
+                The lights in the same order as ``paths``, or an empty list if the lights could not be defined.
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 
 } // namespace usdex::core::bindings
@@ -11,6 +11,8 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <memory>
+
 using namespace usdex::core;
 using namespace pybind11;
 using namespace pxr;
@@ -18,6 +20,37 @@ using namespace pxr;
 namespace usdex::core::bindings
 {
 
+// A Python context manager which holds a SharedTextureScope between `__enter__` and `__exit__`, rather than for the lifetime of the object
+class PySharedTextureScope
+{
+
+public:
+
+    explicit PySharedTextureScope(UsdPrim parent) : m_parent(parent)
+    {
+    }
+
+    void enter()
+    {
+        m_scope = std::make_unique<SharedTextureScope>(m_parent);
+    }
+
+    void exit()
+    {
+        m_scope.reset();
+    }
+
+    UsdShadeNodeGraph getNodeGraph() const
+    {
+        return m_scope ? m_scope->getNodeGraph() : UsdShadeNodeGraph();
+    }
+
+private:
+
+    UsdPrim m_parent;
+    std::unique_ptr<SharedTextureScope> m_scope;
+};
+
 void bindMaterialAlgo(module& m)
 {
     m.def(
@@ -61,6 +94,36 @@ void bindMaterialAlgo(module& m)
         )"
     );
 
+    m.def(
+        "bindMaterials",
+        &bindMaterials,
+        arg("prims"),
+        arg("materials"),
+        arg("collapseToAncestors") = false,
+        R"(
+            Authors direct bindings to the given materials on many prims at once.
+
+            Each unique material is validated once, and the ``UsdShade.MaterialBindingAPI`` and binding relationships are authored directly to
+            the current edit target layer within a single ``Sdf.ChangeBlock``. Nothing is authored if any of the prims or materials are invalid.
+
+            Optionally, bindings may be collapsed onto common ancestors: if every child of a parent prim would be bound to the same material, the
+            parent is bound instead of its children, and is then considered for collapsing onto its own parent. Bindings are not collapsed onto a
+            ``UsdGeom.Gprim``, nor onto the parent of a prim that already has a direct binding of its own.
+
+            Note:
+                The materials are bound with the default "all purpose" and "fallback strength", matching ``bindMaterial()``.
+
+            Args:
+                prims: The prims that the materials will affect. They must all belong to the same stage.
+                materials: The materials to bind to the prims, in the same order. A single material may be supplied to bind it to every prim.
+                collapseToAncestors: Whether to bind common ancestors rather than each prim, when every child of the ancestor shares a material
+
+            Returns:
+                Whether the materials were successfully bound to the prims.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
     m.def(
         "bindMaterialSubsets",
         &bindMaterialSubsets,
@@ -481,6 +544,210 @@ void bindMaterialAlgo(module& m)
         )"
     );
 
+    m.def(
+        "addPreviewMaterialInterfaces",
+        &addPreviewMaterialInterfaces,
+        arg("root"),
+        R"(
+            Adds a Material Interface to every preview material in a material library.
+
+            This is equivalent to calling ``addPreviewMaterialInterface()`` for each ``UsdShade.Material`` at or below the root prim, but the shader
+            networks of all materials are resolved before anything is authored, and the interface inputs, connections, and values are then authored
+            directly to the current edit target layer within a single ``Sdf.ChangeBlock``.
+
+            Materials which are not suitable for ``addPreviewMaterialInterface()`` (e.g. multi-context shader networks) emit the same diagnostics
+            and are skipped, while the remaining materials are still processed.
+
+            Args:
+                root: The prim at or below which all materials will be processed
+
+            Returns:
+                Whether the Material Interfaces of all materials were added successfully
+        )"
+    );
+
+    m.def(
+        "removeMaterialInterfaces",
+        &removeMaterialInterfaces,
+        arg("root"),
+        arg("bakeValues") = true,
+        R"(
+            Removes the Material Interface of every material in a material library.
+
+            This is equivalent to calling ``removeMaterialInterface()`` for each ``UsdShade.Material`` at or below the root prim, but the consumers
+            of all interface inputs are found in a single traversal before anything is authored, and the disconnections, baked values, and
+            removals are then authored directly to the current edit target layer within a single ``Sdf.ChangeBlock``.
+
+            Note:
+
+                As with ``removeMaterialInterface``, this *affects all render contexts*.
+
+            Args:
+                root: The prim at or below which all materials will be processed
+                bakeValues: Whether or not the current Material inputs values are set on the underlying Shader inputs
+
+            Returns:
+                Whether the Material inputs of all materials were removed successfully
+        )"
+    );
+
+    ::class_<PreviewMaterialParams>(
+        m,
+        "PreviewMaterialParams",
+        R"(
+            The parameters of a preview material, as authored by ``definePreviewMaterial()`` and the ``add*TextureToPreviewMaterial()`` functions.
+
+            This is used to define preview materials via a ``MaterialRegistry``, which must know all of the parameters of a material (including
+            its textures) before it is authored, in order to find an identical material which has already been defined.
+
+            Textures with an empty asset path, and an unset emissive color, are not authored.
+        )"
+    )
+        .def(init<>())
+        .def_readwrite("color", &PreviewMaterialParams::color, "The diffuse color of the Material")
+        .def_readwrite("opacity", &PreviewMaterialParams::opacity, "The Opacity Amount to set, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible")
+        .def_readwrite("roughness", &PreviewMaterialParams::roughness, "The Roughness Amount to set, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy")
+        .def_readwrite(
+            "metallic",
+            &PreviewMaterialParams::metallic,
+            "The Metallic Amount to set, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic"
+        )
+        .def_readwrite("emissiveColor", &PreviewMaterialParams::emissiveColor, "The emissive color, or ``None`` if the material is not emissive")
+        .def_readwrite("diffuseTexture", &PreviewMaterialParams::diffuseTexture, "The diffuse texture")
+        .def_readwrite("normalTexture", &PreviewMaterialParams::normalTexture, "The normals texture")
+        .def_readwrite("ormTexture", &PreviewMaterialParams::ormTexture, "The ORM (occlusion, roughness, metallic) texture")
+        .def_readwrite("roughnessTexture", &PreviewMaterialParams::roughnessTexture, "The single channel roughness texture")
+        .def_readwrite("metallicTexture", &PreviewMaterialParams::metallicTexture, "The single channel metallic texture")
+        .def_readwrite("opacityTexture", &PreviewMaterialParams::opacityTexture, "The single channel opacity texture")
+        .def_readwrite("emissiveTexture", &PreviewMaterialParams::emissiveTexture, "The emissive color texture");
+
+    ::class_<MaterialRegistry>(
+        m,
+        "MaterialRegistry",
+        R"(
+            Deduplicates identical materials as they are defined below a common parent prim.
+
+            Each material defined via a ``MaterialRegistry`` is described by all of its parameters (including the texture asset paths). A new
+            material is authored only if no material with equal parameters has been defined by the registry previously, otherwise the existing
+            material is returned.
+
+            The materials are defined as children of the parent prim, which is typically the ``getMaterialsToken()`` scope of an asset. Each
+            material is named after the first request with its parameters, made valid and unique via ``getValidChildName()``.
+
+            A ``MaterialRegistry`` is not thread safe.
+        )"
+    )
+        .def(
+            init<UsdPrim>(),
+            arg("parent"),
+            R"(
+                Create a material registry that defines materials below the given parent prim.
+
+                If the parent prim is invalid, a runtime error will be posted. Use ``isValid()`` to check whether the registry can be used.
+
+                Parameters:
+                    - **parent** - The prim below which the materials will be defined
+            )"
+        )
+        .def("isValid", &MaterialRegistry::isValid, "Whether the registry can be used to define materials.")
+        .def(
+            "definePreviewMaterial",
+            &MaterialRegistry::definePreviewMaterial,
+            arg("name"),
+            arg("params"),
+            R"(
+                Define a preview material, or return an identical preview material which was defined previously by this registry.
+
+                On a miss, the material is authored via ``definePreviewMaterial()``, followed by the ``add*TextureToPreviewMaterial()`` functions
+                for each of the non-empty textures in the ``params``. If any of these fail, the partially authored material is removed.
+
+                Parameters:
+                    - **name** - The name of the Material, if a new material must be defined
+                    - **params** - The parameters of the Material
+
+                Returns:
+                    The new or existing ``UsdShade.Material``. Returns an invalid material on error.
+            )"
+        )
+        .def("getMaterialCount", &MaterialRegistry::getMaterialCount, "The number of unique materials defined by the registry.")
+        .def("getReuseCount", &MaterialRegistry::getReuseCount, "The number of requests that returned an existing material.");
+
+    ::class_<PySharedTextureScope>(
+        m,
+        "SharedTextureScope",
+        R"(
+            A context manager that shares the texture reader shaders of preview materials on a stage.
+
+            By default each of the ``add*TextureToPreviewMaterial()`` functions defines a ``UsdUVTexture`` shader and a
+            ``UsdPrimvarReader_float2`` shader within the material itself.
+
+            While the context is active, these functions instead connect the material to a texture reader within a ``UsdShade.NodeGraph`` below
+            the parent prim. A single reader is defined for each unique combination of texture slot, texture asset path, color space and fallback
+            value, and all of the readers share a single primvar reader for the default UV set.
+
+            The context applies to the calling thread only and may be nested. Readers are only shared amongst the materials authored while the same
+            context is active.
+
+            Asset resolution on the calling thread is also cached while the context is active, so each texture is resolved once regardless of the
+            number of materials which use it. Textures should not be created, moved, or removed while the context is active.
+
+            Note:
+                Connections to the shared readers cross the boundary of the material. The textures of such materials are not promoted by
+                ``addPreviewMaterialInterface()``, as doing so would affect every material sharing the reader.
+
+            Example:
+
+                .. code-block:: python
+
+                    with usdex.core.SharedTextureScope(materials):
+                        for name, texture in textures.items():
+                            material = usdex.core.definePreviewMaterial(materials, name, color)
+                            usdex.core.addDiffuseTextureToPreviewMaterial(material, texture)
+        )"
+    )
+        .def(init<UsdPrim>(), arg("parent"))
+        .def(
+            "__enter__",
+            [](PySharedTextureScope& self) -> PySharedTextureScope&
+            {
+                self.enter();
+                return self;
+            },
+            return_value_policy::reference
+        )
+        .def(
+            "__exit__",
+            [](PySharedTextureScope& self, const object&, const object&, const object&)
+            {
+                self.exit();
+                return false;
+            }
+        )
+        .def(
+            "getNodeGraph",
+            &PySharedTextureScope::getNodeGraph,
+            R"(
+                Get the node graph containing the shared readers.
+
+                Returns:
+                    The ``UsdShade.NodeGraph``. Returns an invalid node graph if the context is not active, or if its parent prim is invalid.
+            )"
+        )
+        .def_static(
+            "isActive",
+            &SharedTextureScope::isActive,
+            arg("stage"),
+            R"(
+                Whether a valid ``SharedTextureScope`` is active for the given stage on the calling thread.
+
+                Parameters:
+                    - **stage** - The stage to consider
+
+                Returns:
+                    Whether texture readers will be shared.
+            )"
+        );
+
     ::enum_<ColorSpace>(m, "ColorSpace", "Texture color space (encoding) types")
         .value("eAuto", ColorSpace::eAuto, "Check for gamma or metadata in the texture itself")
         .value(
@@ -509,7 +776,7 @@ void bindMaterialAlgo(module& m)
 
     m.def(
         "sRgbToLinear",
-        &sRgbToLinear,
+        overload_cast<const GfVec3f&>(&sRgbToLinear),
         arg("color"),
         R"(
             Translate an sRGB color value to linear color space
@@ -535,7 +802,7 @@ void bindMaterialAlgo(module& m)
 
     m.def(
         "linearToSrgb",
-        &linearToSrgb,
+        overload_cast<const GfVec3f&>(&linearToSrgb),
         arg("color"),
         R"(
             Translate a linear color value to sRGB color space
@@ -558,6 +825,81 @@ void bindMaterialAlgo(module& m)
                 The translated color in sRGB color space
         )"
     );
+
+    m.def(
+        "sRgbToLinear",
+        overload_cast<const VtVec3fArray&>(&sRgbToLinear),
+        arg("colors"),
+        R"(
+            Translate an array of sRGB color values to linear color space
+
+            This is equivalent to calling ``sRgbToLinear(color)`` for each color, and the results are identical, but large arrays are converted
+            across multiple threads. Components which are exactly 8-bit sRGB values (i.e. ``k / 255`` for an integer ``k``), as is common for colors
+            originating from images or scans, are looked up rather than computed.
+
+            Args:
+                colors: sRGB representations of colors to be translated to linear color space
+
+            Returns:
+                The translated colors in linear color space
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "linearToSrgb",
+        overload_cast<const VtVec3fArray&>(&linearToSrgb),
+        arg("colors"),
+        R"(
+            Translate an array of linear color values to sRGB color space
+
+            This is equivalent to calling ``linearToSrgb(color)`` for each color, and the results are identical, but large arrays are converted
+            across multiple threads.
+
+            Args:
+                colors: linear representations of colors to be translated to sRGB color space
+
+            Returns:
+                The translated colors in sRGB color space
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "sRgbToLinear",
+        overload_cast<const Vec3fPrimvarData&>(&sRgbToLinear),
+        arg("colors"),
+        R"(
+            Translate the values of color primvar data (e.g. display color) from sRGB to linear color space
+
+            The values are translated as ``sRgbToLinear(colors: Vt.Vec3fArray)`` does. The interpolation, indices, and element size are preserved.
+
+            Args:
+                colors: sRGB primvar data to be translated to linear color space
+
+            Returns:
+                The primvar data with values in linear color space
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "linearToSrgb",
+        overload_cast<const Vec3fPrimvarData&>(&linearToSrgb),
+        arg("colors"),
+        R"(
+            Translate the values of color primvar data (e.g. display color) from linear to sRGB color space
+
+            The values are translated as ``linearToSrgb(colors: Vt.Vec3fArray)`` does. The interpolation, indices, and element size are preserved.
+
+            Args:
+                colors: linear primvar data to be translated to sRGB color space
+
+            Returns:
+                The primvar data with values in sRGB color space
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 
 } // namespace usdex::core::bindings
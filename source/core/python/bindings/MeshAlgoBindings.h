@@ -9,6 +9,7 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -67,7 +68,8 @@ void bindMeshAlgo(module& m)
             Returns:
                 ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -112,7 +114,8 @@ void bindMeshAlgo(module& m)
             Returns:
                 ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -154,24 +157,398 @@ void bindMeshAlgo(module& m)
             Returns:
                 ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``.
 
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<PolyMeshIndexing>(
+        m,
+        "PolyMeshIndexing",
+        R"(
+            Options to merge nearly equal normals and uvs as they are authored by ``definePolyMesh``.
+
+            Normals and uvs which are computed or converted from tessellated geometry (e.g. CAD surfaces) often differ by a few ULPs between
+            the corners that share a vertex, so exact indexing via ``PrimvarData.index()`` is unable to merge them. Quantized indexing snaps
+            the values before they are compared, which results in much smaller indexed primvars and faster loading.
+
+            If both the ``tolerance`` and the ``precision`` are zero, the values are indexed exactly.
+        )"
+    )
+        .def(init<>())
+        .def(
+            init(
+                [](float tolerance, int precision)
+                {
+                    return PolyMeshIndexing{ tolerance, precision };
+                }
+            ),
+            arg("tolerance") = 0.0f,
+            arg("precision") = 0
+        )
+        .def_readwrite(
+            "tolerance",
+            &PolyMeshIndexing::tolerance,
+            "The cell size used to snap each component of the normals and uvs before they are merged. See ``PrimvarData.index(tolerance)``."
+        )
+        .def_readwrite(
+            "precision",
+            &PolyMeshIndexing::precision,
+            "The number of significant bits retained from each component, if the ``tolerance`` is zero. See ``PrimvarData.indexWithPrecision(bits)``."
+        );
+
+    m.def(
+        "definePolyMesh",
+        overload_cast<
+            UsdStagePtr,
+            const SdfPath&,
+            const VtIntArray&,
+            const VtIntArray&,
+            const VtVec3fArray&,
+            const PolyMeshIndexing&,
+            std::optional<const Vec3fPrimvarData>,
+            std::optional<const Vec2fPrimvarData>,
+            std::optional<const Vec3fPrimvarData>,
+            std::optional<const FloatPrimvarData>>(&definePolyMesh),
+        arg("stage"),
+        arg("path"),
+        arg("faceVertexCounts"),
+        arg("faceVertexIndices"),
+        arg("points"),
+        arg("indexing"),
+        arg("normals") = nullptr,
+        arg("uvs") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        R"(
+            Defines a basic polygon mesh on the stage, merging nearly equal normals and uvs.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+
+            The ``normals`` and ``uvs`` are indexed according to the ``indexing`` options before they are validated and authored. Primvars with an
+            element size greater than one, or which are otherwise invalid, are authored as supplied.
+
+            Parameters:
+                - **stage** - The stage on which to define the mesh
+                - **path** - The absolute prim path at which to define the mesh
+                - **faceVertexCounts** - The number of vertices in each face of the mesh
+                - **faceVertexIndices** - Indices of the positions from the ``points`` to use for each face vertex
+                - **points** - Vertex positions for the mesh described points in local space
+                - **indexing** - The options used to index the normals and uvs
+                - **normals** - Values to be authored for the normals primvar
+                - **uvs** - Values to be authored for the uv primvar
+                - **displayColor** - Value to be authored for the display color primvar
+                - **displayOpacity** - Value to be authored for the display opacity primvar
+
+            Returns:
+                ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<PolyMeshData>(
+        m,
+        "PolyMeshData",
+        R"(
+            The topology and primvar data required to define a single mesh via ``definePolyMeshes``.
+
+            The members match the arguments of ``definePolyMesh``, with the addition of the absolute prim path at which to define the mesh.
+        )"
+    )
+        .def(init<>())
+        .def(
+            init(
+                [](const SdfPath& path,
+                   const VtIntArray& faceVertexCounts,
+                   const VtIntArray& faceVertexIndices,
+                   const VtVec3fArray& points,
+                   std::optional<Vec3fPrimvarData> normals,
+                   std::optional<Vec2fPrimvarData> uvs,
+                   std::optional<Vec3fPrimvarData> displayColor,
+                   std::optional<FloatPrimvarData> displayOpacity)
+                {
+                    return PolyMeshData{ path, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor, displayOpacity };
+                }
+            ),
+            arg("path"),
+            arg("faceVertexCounts"),
+            arg("faceVertexIndices"),
+            arg("points"),
+            arg("normals") = nullptr,
+            arg("uvs") = nullptr,
+            arg("displayColor") = nullptr,
+            arg("displayOpacity") = nullptr
+        )
+        .def_readwrite("path", &PolyMeshData::path, "The absolute prim path at which to define the mesh")
+        .def_readwrite("faceVertexCounts", &PolyMeshData::faceVertexCounts, "The number of vertices in each face of the mesh")
+        .def_readwrite("faceVertexIndices", &PolyMeshData::faceVertexIndices, "Indices of the positions from the ``points`` to use for each face vertex")
+        .def_readwrite("points", &PolyMeshData::points, "Vertex positions for the mesh described in local space")
+        .def_readwrite("normals", &PolyMeshData::normals, "Values to be authored for the normals primvar")
+        .def_readwrite("uvs", &PolyMeshData::uvs, "Values to be authored for the uv primvar")
+        .def_readwrite("displayColor", &PolyMeshData::displayColor, "Values to be authored for the display color primvar")
+        .def_readwrite("displayOpacity", &PolyMeshData::displayOpacity, "Values to be authored for the display opacity primvar");
+
+    m.def(
+        "definePolyMeshes",
+        &definePolyMeshes,
+        arg("stage"),
+        arg("meshes"),
+        R"(
+            Defines many basic polygon meshes on the stage at once.
+
+            The result is equivalent to calling ``definePolyMesh`` for each element of ``meshes``, but is significantly faster for large numbers of meshes.
+
+            All of the meshes are validated up front (in parallel) before any scene description is authored. If any mesh fails validation, or the same
+            path is requested more than once, a runtime error is posted for each failure and no meshes are defined.
+
+            Valid meshes are authored directly to the ``Sdf.Layer`` of the current edit target within a single ``Sdf.ChangeBlock``, so that change
+            notification and stage recomposition occur once for the whole batch, rather than once per attribute of every mesh.
+
+            Parameters:
+                - **stage** - The stage on which to define the meshes
+                - **meshes** - The path, topology, and optional primvars of each mesh
+
+            Returns:
+                ``UsdGeom.Mesh`` schemas wrapping the defined ``Usd.Prims``, in the same order as ``meshes``, or an empty list if the meshes could not be defined.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<MeshBatch>(
+        m,
+        "MeshBatch",
+        R"(
+            The concatenated topology and primvar data of many meshes, required to define them all under a common parent via ``definePolyMeshBatch``.
+
+            The data of every mesh is concatenated into shared arrays, and the range of each mesh within those arrays is described by offset arrays
+            (i.e. a compressed sparse row layout). The offset arrays hold one more value than the number of meshes. The data of mesh ``i`` begins at
+            offset ``i`` and ends before offset ``i + 1``, so the first offset is 0 and the last offset is the size of the concatenated array.
+
+            The ``faceVertexIndices`` of each mesh are local to that mesh, i.e. they index the points of that mesh rather than those of the entire
+            batch.
+
+            The optional primvars hold the values of every mesh, with the range of each mesh determined by the interpolation of the primvar:
+
+                - ``constant`` primvars hold a single element per mesh.
+                - ``uniform`` primvars are sliced by ``faceOffsets``.
+                - ``vertex`` and ``varying`` primvars are sliced by ``pointOffsets``.
+                - ``faceVarying`` primvars are sliced by the face vertex offsets, which are computed from the ``faceVertexCounts``.
+
+            If a primvar is indexed then the indices are sliced rather than the values, and the indices index the values of the entire batch. The
+            values referenced by each mesh are compacted when the mesh is defined.
         )"
+    )
+        .def(init<>())
+        .def(
+            init(
+                [](const std::vector<std::string>& names,
+                   const VtIntArray& pointOffsets,
+                   const VtIntArray& faceOffsets,
+                   const VtIntArray& faceVertexCounts,
+                   const VtIntArray& faceVertexIndices,
+                   const VtVec3fArray& points,
+                   std::optional<Vec3fPrimvarData> normals,
+                   std::optional<Vec2fPrimvarData> uvs,
+                   std::optional<Vec3fPrimvarData> displayColor)
+                {
+                    return MeshBatch{ names, pointOffsets, faceOffsets, faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor };
+                }
+            ),
+            arg("names"),
+            arg("pointOffsets"),
+            arg("faceOffsets"),
+            arg("faceVertexCounts"),
+            arg("faceVertexIndices"),
+            arg("points"),
+            arg("normals") = nullptr,
+            arg("uvs") = nullptr,
+            arg("displayColor") = nullptr
+        )
+        .def_readwrite("names", &MeshBatch::names, "The preferred name of each mesh, which is made valid and unique below the parent prim")
+        .def_readwrite("pointOffsets", &MeshBatch::pointOffsets, "The offset of the first point of each mesh, followed by the total number of points")
+        .def_readwrite("faceOffsets", &MeshBatch::faceOffsets, "The offset of the first face of each mesh, followed by the total number of faces")
+        .def_readwrite("faceVertexCounts", &MeshBatch::faceVertexCounts, "The number of vertices in each face of every mesh")
+        .def_readwrite(
+            "faceVertexIndices",
+            &MeshBatch::faceVertexIndices,
+            "Indices of the positions from the points of each mesh to use for each face vertex"
+        )
+        .def_readwrite("points", &MeshBatch::points, "Vertex positions for every mesh described in local space")
+        .def_readwrite("normals", &MeshBatch::normals, "Values to be authored for the normals primvar of every mesh")
+        .def_readwrite("uvs", &MeshBatch::uvs, "Values to be authored for the uv primvar of every mesh")
+        .def_readwrite("displayColor", &MeshBatch::displayColor, "Values to be authored for the display color primvar of every mesh");
+
+    m.def(
+        "definePolyMeshBatch",
+        &definePolyMeshBatch,
+        arg("parent"),
+        arg("batch"),
+        arg("nameCache") = nullptr,
+        R"(
+            Defines every mesh of a ``MeshBatch`` as a child of a parent prim.
+
+            The name of each mesh is made valid and unique via a ``NameCache``, then the batch is sliced into the data of each mesh (in parallel) and
+            the meshes are defined via ``definePolyMeshes``. As such the validation, error handling, and authoring of the meshes matches that of
+            ``definePolyMeshes``, and all of the meshes are authored within a single ``Sdf.ChangeBlock``.
+
+            This is intended for clients which author many small meshes, so that the arguments of each mesh do not need to be converted individually.
+
+            If the offset arrays do not match the number of names, or do not describe ranges within the concatenated arrays, a runtime error is posted
+            and no meshes are defined.
+
+            Parameters:
+                - **parent** - The prim below which to define the meshes
+                - **batch** - The names, topology, and optional primvars of the meshes
+                - **nameCache** - The cache used to resolve the names of the meshes. If None, a temporary cache is used.
+
+            Returns:
+                ``UsdGeom.Mesh`` schemas wrapping the defined ``Usd.Prims``, in the same order as ``batch.names``, or an empty list if the meshes
+                could not be defined.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<MeshTopology>(
+        m,
+        "MeshTopology",
+        R"(
+            A mesh topology that has been validated once, so that it can be reused to define and update meshes without repeating the validation.
+
+            The face vertex counts and indices are validated via ``UsdGeom.Mesh.ValidateTopology`` on construction, against the fewest points that the
+            indices could refer to. Data derived from the topology (the offset of each face, the number of faces & face vertices, and the largest face
+            vertex index) is computed at the same time and cached.
+
+            Functions accepting a ``MeshTopology`` only need to check that enough points are provided, and that the primvars match the element counts,
+            rather than validating the full topology on every call. This is intended for exporters that author the same topology many times, e.g. for
+            deforming meshes with a new set of points at each time code, or for many copies of the same mesh.
+        )"
+    )
+        .def(
+            init<const VtIntArray&, const VtIntArray&>(),
+            arg("faceVertexCounts"),
+            arg("faceVertexIndices"),
+            R"(
+                Validate the topology and compute its derived data.
+
+                If the topology is invalid a runtime error will be posted. Use ``isValid()`` to check whether the topology can be used.
+
+                Parameters:
+                    - **faceVertexCounts** - The number of vertices in each face of the mesh
+                    - **faceVertexIndices** - Indices of the positions from the ``points`` to use for each face vertex
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def("isValid", &MeshTopology::isValid, "Whether the topology was validated successfully.")
+        .def("getFaceVertexCounts", &MeshTopology::getFaceVertexCounts, "The number of vertices in each face of the mesh.")
+        .def("getFaceVertexIndices", &MeshTopology::getFaceVertexIndices, "The indices of the points to use for each face vertex.")
+        .def("getFaceOffsets", &MeshTopology::getFaceOffsets, "The offset of the first face vertex of each face.")
+        .def("getFaceCount", &MeshTopology::getFaceCount, "The number of faces, which is the number of values required for uniform primvars.")
+        .def(
+            "getFaceVertexCount",
+            &MeshTopology::getFaceVertexCount,
+            "The number of face vertices (i.e. corners), which is the number of values required for faceVarying primvars."
+        )
+        .def(
+            "getMaxIndex",
+            &MeshTopology::getMaxIndex,
+            "The largest face vertex index. The mesh requires at least one more point than this value, or -1 if there are no face vertices."
+        );
+
+    m.def(
+        "definePolyMesh",
+        overload_cast<
+            UsdStagePtr,
+            const SdfPath&,
+            const MeshTopology&,
+            const VtVec3fArray&,
+            std::optional<const Vec3fPrimvarData>,
+            std::optional<const Vec2fPrimvarData>,
+            std::optional<const Vec3fPrimvarData>,
+            std::optional<const FloatPrimvarData>>(&definePolyMesh),
+        arg("stage"),
+        arg("path"),
+        arg("topology"),
+        arg("points"),
+        arg("normals") = nullptr,
+        arg("uvs") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        R"(
+            Defines a basic polygon mesh on the stage using a previously validated topology.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+
+            The topology is not validated again. Only the number of points and the primvars are validated against it.
+
+            Parameters:
+                - **stage** - The stage on which to define the mesh
+                - **path** - The absolute prim path at which to define the mesh
+                - **topology** - The validated topology of the mesh
+                - **points** - Vertex positions for the mesh described points in local space
+                - **normals** - Values to be authored for the normals primvar
+                - **uvs** - Values to be authored for the uv primvar
+                - **displayColor** - Value to be authored for the display color primvar
+                - **displayOpacity** - Value to be authored for the display opacity primvar
+
+            Returns:
+                ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setPolyMeshPoints",
+        &setPolyMeshPoints,
+        arg("mesh"),
+        arg("topology"),
+        arg("points"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        arg("normals") = nullptr,
+        R"(
+            Author the points, extent, and optionally the normals of an existing mesh at a given time code.
+
+            This is intended for deforming meshes, where the topology is constant but the points (and normals) change over time. The points and
+            normals are validated against the topology, but the topology itself is not validated again. The extent is computed from the points and
+            authored at the same time code.
+
+            The topology is expected to match the topology that is authored on the mesh (e.g. via ``definePolyMesh``), but this is not checked.
+
+            Parameters:
+                - **mesh** - The mesh on which to author the points
+                - **topology** - The validated topology of the mesh
+                - **points** - Vertex positions for the mesh described in local space
+                - **time** - The time code at which to author the values
+                - **normals** - Values to be authored for the normals primvar
+
+            Returns:
+                Whether the points were authored successfully.
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "computeMeshNormals",
-        overload_cast<const VtIntArray&, const VtIntArray&, const VtVec3fArray&, const TfToken&, const GfVec3f&>(&computeMeshNormals),
+        overload_cast<const VtIntArray&, const VtIntArray&, const VtVec3fArray&, const TfToken&, const GfVec3f&, float>(&computeMeshNormals),
         arg("faceVertexCounts"),
         arg("faceVertexIndices"),
         arg("points"),
         arg("interpolation") = UsdGeomTokens->uniform,
         arg("fallback") = GfVec3f(0.0f, 0.0f, 1.0f),
+        arg("smoothingAngle") = 0.0f,
         R"(
             Computes mesh normals for a given mesh topology.
 
             This function computes normals for mesh geometry using vector-area approach for face normals
             and area-weighted averaging for vertex normals. The computation supports uniform, vertex, and
-            faceVarying interpolations to match USD's primvar interpolation types. FaceVarying normals are a simplified
-            approach that assigns the same face normal to all corners of each face.
+            faceVarying interpolations to match USD's primvar interpolation types.
+
+            FaceVarying normals are crease-aware. The corners sharing a vertex are smoothed together when the angle between their face normals is
+            within the ``smoothingAngle``, and are otherwise split along the crease. The default ``smoothingAngle`` of zero assigns the face normal
+            to all corners of each face (i.e. faceted shading). The result is indexed as it is computed, with one value per smoothing group, so it
+            does not need to be deduplicated with ``PrimvarData.index()``. The ``smoothingAngle`` has no effect on uniform or vertex normals.
 
             Normal computation assumes right-handed mesh orientation. The winding order of the data should be reversed in advance if that is not the case.
 
@@ -189,19 +566,22 @@ void bindMeshAlgo(module& m)
                 - **points** - Vertex positions for the mesh described in local space
                 - **interpolation** - The desired interpolation type for the computed normals
                 - **fallback** - The fallback normal to use for degenerate faces and vertices with no contributing faces
+                - **smoothingAngle** - The maximum angle, in degrees, between the faces of a vertex that share a faceVarying normal
 
             Returns:
                 Vec3fPrimvarData containing the computed normals, or an invalid one if computation fails.
 
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
         "computeMeshNormals",
-        overload_cast<UsdGeomMesh, const TfToken&, const GfVec3f&>(&computeMeshNormals),
+        overload_cast<UsdGeomMesh, const TfToken&, const GfVec3f&, float>(&computeMeshNormals),
         arg("mesh"),
         arg("interpolation") = UsdGeomTokens->uniform,
         arg("fallback") = GfVec3f(0.0f, 0.0f, 1.0f),
+        arg("smoothingAngle") = 0.0f,
         R"(
             Computes mesh normals and updates the mesh with the computed normals.
 
@@ -211,10 +591,39 @@ void bindMeshAlgo(module& m)
                 - **mesh** - Mesh prim to compute the normals for.
                 - **interpolation** - The desired interpolation type for the computed normals
                 - **fallback** - The fallback normal to use for degenerate faces and vertices with no contributing faces
+                - **smoothingAngle** - The maximum angle, in degrees, between the faces of a vertex that share a faceVarying normal
 
             Returns:
                 Vec3fPrimvarData containing the computed normals, or an invalid one if computation fails.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "computeMeshNormals",
+        overload_cast<const MeshTopology&, const VtVec3fArray&, const TfToken&, const GfVec3f&, float>(&computeMeshNormals),
+        arg("topology"),
+        arg("points"),
+        arg("interpolation") = UsdGeomTokens->uniform,
+        arg("fallback") = GfVec3f(0.0f, 0.0f, 1.0f),
+        arg("smoothingAngle") = 0.0f,
+        R"(
+            Computes mesh normals for a previously validated topology.
+
+            This is an overloaded member function, provided for convenience. The topology is not validated again, and the cached face offsets
+            are reused.
+
+            Parameters:
+                - **topology** - The validated topology of the mesh
+                - **points** - Vertex positions for the mesh described in local space
+                - **interpolation** - The desired interpolation type for the computed normals
+                - **fallback** - The fallback normal to use for degenerate faces and vertices with no contributing faces
+                - **smoothingAngle** - The maximum angle, in degrees, between the faces of a vertex that share a faceVarying normal
+
+            Returns:
+                Vec3fPrimvarData containing the computed normals, or an invalid one if computation fails.
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -244,7 +653,8 @@ void bindMeshAlgo(module& m)
 
             Returns:
                 The list of subsets created. Empty list on failure.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -275,7 +685,8 @@ void bindMeshAlgo(module& m)
 
             Returns:
                 The list of subsets created. Empty list on failure.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -305,7 +716,204 @@ void bindMeshAlgo(module& m)
 
             Returns:
                 The list of subsets created. Empty list on failure.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "definePartitionedSubsetsFromFaceIds",
+        &definePartitionedSubsetsFromFaceIds,
+        arg("mesh"),
+        arg("faceIds"),
+        arg("names"),
+        arg("materials") = std::vector<UsdShadeMaterial>(),
+        arg("familyName") = UsdShadeTokens->materialBind,
+        R"(
+            Fully partitions a mesh into face subsets from an array of per-face ids.
+
+            This is a convenience for source data that assigns an id (e.g. a material index) to each face, rather than providing explicit subsets.
+            The face indices of all subsets are gathered in a single counting sort pass over the ids.
+
+            A subset is defined for each id that is referenced by at least one face. Ids that are not referenced by any face are skipped, as subsets
+            must not be empty. The subsets are returned in ascending id order.
+
+            If materials are provided, the material of each id is bound to its subset using ``usdex.core.bindMaterialSubsets``.
+
+            Args:
+                mesh: The mesh prim to add the subsets to
+                faceIds: The id of each face (length must equal the number of faces). Each id must be a valid index into names.
+                names: The name of the subset for each id
+                materials: Optional materials to bind for each id (length must be zero or equal len(names))
+                familyName: The family name of the subsets (default: ``UsdShade.Tokens.MaterialBind``)
+
+            Returns:
+                The list of subsets created. Empty list on failure.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "definePolyMeshChunks",
+        &definePolyMeshChunks,
+        arg("parent"),
+        arg("name"),
+        arg("faceVertexCounts"),
+        arg("faceVertexIndices"),
+        arg("points"),
+        arg("maxFacesPerChunk"),
+        arg("normals") = nullptr,
+        arg("uvs") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        arg("subsetNames") = std::vector<TfToken>(),
+        arg("subsetIndices") = std::vector<VtIntArray>(),
+        arg("subsetFamilyName") = UsdShadeTokens->materialBind,
+        R"(
+            Defines a large polygon mesh as many smaller meshes, each with at most ``maxFacesPerChunk`` faces, as siblings below a new
+            ``UsdGeom.Xform``.
+
+            Very large meshes are slow to load and to upload to the GPU as a single prim, and may exceed per-mesh buffer limits of renderers.
+            Splitting them into spatially coherent chunks reduces the cost of each prim without changing the appearance of the mesh.
+
+            The faces are ordered along a Morton curve through their centroids, and each chunk holds a consecutive run of that order, so that nearby
+            faces are grouped into the same chunk. Within each chunk the faces retain their original relative order.
+
+            The points and primvars of the mesh are remapped to each chunk, such that each chunk only holds the points (and vertex values)
+            referenced by its own faces. Indexed primvars are compacted to the values referenced by each chunk.
+
+            If subsets are provided, they must fully partition the faces of the mesh, as expected by ``definePartitionedSubsets``. The subsets are
+            remapped to the faces of each chunk and defined on each chunk for which they are not empty. Use ``usdex.core.bindMaterialSubsets``
+            to bind materials to the subsets of each chunk.
+
+            The mesh is validated, and the chunks are computed in parallel, before any scene description is authored. The chunks are then defined
+            via ``definePolyMeshes``, so each chunk has its own extent, and are named "Chunk_0", "Chunk_1", etc.
+
+            Parameters:
+                - **parent** - Prim below which to define the Xform holding the chunks
+                - **name** - Name of the Xform holding the chunks
+                - **faceVertexCounts** - The number of vertices in each face of the mesh
+                - **faceVertexIndices** - Indices of the positions from the ``points`` to use for each face vertex
+                - **points** - Vertex positions for the mesh described in local space
+                - **maxFacesPerChunk** - The maximum number of faces in each chunk
+                - **normals** - Values to be authored for the normals primvar
+                - **uvs** - Values to be authored for the uv primvar
+                - **displayColor** - Values to be authored for the display color primvar
+                - **displayOpacity** - Values to be authored for the display opacity primvar
+                - **subsetNames** - The names of the face subsets (length must equal ``len(subsetIndices)``)
+                - **subsetIndices** - The face indices of each subset, relative to the faces of the entire mesh
+                - **subsetFamilyName** - The family name of the subsets
+
+            Returns:
+                ``UsdGeom.Mesh`` schemas wrapping the defined chunks, or an empty list if the mesh could not be defined.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "defineOptimizedPolyMesh",
+        &defineOptimizedPolyMesh,
+        arg("stage"),
+        arg("path"),
+        arg("faceVertexCounts"),
+        arg("faceVertexIndices"),
+        arg("points"),
+        arg("normals") = nullptr,
+        arg("uvs") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        arg("subsetNames") = std::vector<TfToken>(),
+        arg("subsetIndices") = std::vector<VtIntArray>(),
+        arg("subsetFamilyName") = UsdShadeTokens->materialBind,
+        arg("cacheSize") = 32,
+        R"(
+            Defines a polygon mesh on the stage, with its faces and points reordered for vertex cache efficiency and memory locality.
+
+            Scanned, procedurally generated, and converted meshes often list their faces and points in an arbitrary order, which lowers the vertex
+            cache hit rate of GPU renderers and the memory locality of downstream tools. The appearance of the mesh does not depend on this order.
+
+            The faces are first ordered along a Morton curve through their centroids, as in ``definePolyMeshChunks``. Each consecutive run of that
+            order is then reordered to maximize the reuse of recently referenced points in a vertex cache of ``cacheSize`` entries, via Forsyth's
+            linear-speed vertex cache optimization generalized to polygons. Finally the points are ordered by their first reference in the new face
+            order. Points which are not referenced by any face follow those which are, in their original order.
+
+            The primvars are remapped consistently with the faces and points, according to their interpolation. Indexed primvars retain their
+            indices, and their values are compacted to those referenced, in the order of first reference. If subsets are provided, they must fully
+            partition the faces of the mesh, as expected by ``definePartitionedSubsets``. The subsets are remapped to the reordered faces and
+            defined on the mesh.
+
+            The mesh is validated, and the runs of faces are reordered in parallel, before any scene description is authored. The order does not
+            depend on the number of threads.
+
+            Parameters:
+                - **stage** - The stage on which to define the mesh
+                - **path** - The absolute prim path at which to define the mesh
+                - **faceVertexCounts** - The number of vertices in each face of the mesh
+                - **faceVertexIndices** - Indices of the positions from the ``points`` to use for each face vertex
+                - **points** - Vertex positions for the mesh described in local space
+                - **normals** - Values to be authored for the normals primvar
+                - **uvs** - Values to be authored for the uv primvar
+                - **displayColor** - Values to be authored for the display color primvar
+                - **displayOpacity** - Values to be authored for the display opacity primvar
+                - **subsetNames** - The names of the face subsets (length must equal ``len(subsetIndices)``)
+                - **subsetIndices** - The face indices of each subset, relative to the faces as supplied
+                - **subsetFamilyName** - The family name of the subsets
+                - **cacheSize** - The number of entries in the simulated vertex cache
+
+            Returns:
+                ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``, or an invalid schema if the mesh or its subsets could not be defined.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "definePolyMeshLods",
+        &definePolyMeshLods,
+        arg("stage"),
+        arg("path"),
+        arg("faceVertexCounts"),
+        arg("faceVertexIndices"),
+        arg("points"),
+        arg("faceRatios"),
+        arg("normals") = nullptr,
+        arg("uvs") = nullptr,
+        arg("smoothingAngle") = 30.0f,
+        R"(
+            Defines a polygon mesh on the stage with several levels of detail, authored as the variants of a "lod" variant set.
+
+            Distant or small meshes do not need their full resolution, and switching to a coarser level of detail reduces the cost of loading and
+            rendering them. The "LOD0" variant holds the mesh as supplied, and each further variant "LOD1", "LOD2", etc. holds a decimated copy
+            of it, with at most ``faceRatios[i]`` of the triangles of the source mesh (after triangulating its faces). The "LOD0" variant is
+            selected.
+
+            The levels are decimated from the source mesh via quadric error metric edge collapses, and are always triangulated. Each level is
+            decimated in parallel, before any scene description is authored. Vertices on uv seams are never removed, so the uvs of each level are
+            carried from the source mesh without distortion, and are authored with the lowest interpolation that represents them.
+
+            The normals of each level are recomputed via ``computeMeshNormals``, with the interpolation of the source normals (or vertex if they
+            are varying). Constant normals are copied to each level. The ``smoothingAngle`` only affects faceVarying normals.
+
+            Level variants are typically authored within the geometry Content Layer of an asset, i.e. a stage returned by
+            ``addAssetContent(stage, getGeometryToken())``, so that the asset interface is able to select the level of detail.
+
+            Parameters:
+                - **stage** - The stage on which to define the mesh
+                - **path** - The absolute prim path at which to define the mesh
+                - **faceVertexCounts** - The number of vertices in each face of the mesh
+                - **faceVertexIndices** - Indices of the positions from the ``points`` to use for each face vertex
+                - **points** - Vertex positions for the mesh described in local space
+                - **faceRatios** - The fraction of the source triangles to retain in each decimated level, each of which must be between zero and one
+                - **normals** - Values to be authored for the normals primvar of the source mesh
+                - **uvs** - Values to be authored for the uv primvar of the source mesh
+                - **smoothingAngle** - The maximum angle, in degrees, between the faces of a vertex that share a faceVarying normal in the
+                  decimated levels
+
+            Returns:
+                ``UsdGeom.Mesh`` schema wrapping the defined ``Usd.Prim``, or an invalid schema if the mesh or any of its levels could not be defined.
+
+        )",
+        call_guard<gil_scoped_release>()
     );
 }
 
@@ -8,20 +8,25 @@ ARCH_PRAGMA_PUSH
 ARCH_PRAGMA_MAYBE_UNINITIALIZED
 
 #include "AssetStructureBindings.h"
+#include "BoundsAlgoBindings.h"
 #include "CameraAlgoBindings.h"
 #include "CoreBindings.h"
 #include "CurvesAlgoBindings.h"
 #include "DiagnosticsBindings.h"
+#include "ExtentAlgoBindings.h"
 #include "GprimAlgoBindings.h"
+#include "InstrumentationBindings.h"
 #include "LayerAlgoBindings.h"
 #include "LightAlgoBindings.h"
 #include "MaterialAlgoBindings.h"
 #include "MeshAlgoBindings.h"
 #include "NameAlgoBindings.h"
+#include "PhysicsCollisionAlgoBindings.h"
 #include "PhysicsJointAlgoBindings.h"
 #include "PhysicsMaterialAlgoBindings.h"
 #include "PointsAlgoBindings.h"
 #include "PrimvarDataBindings.h"
+#include "ScratchArenaBindings.h"
 #include "SettingsBindings.h"
 #include "StageAlgoBindings.h"
 #include "XformAlgoBindings.h"
@@ -39,18 +44,23 @@ PYBIND11_MODULE(_usdex_core, m)
     bindCore(m);
     bindSettings(m);
     bindDiagnostics(m);
+    bindInstrumentation(m);
     bindLayerAlgo(m);
     bindStageAlgo(m);
     bindAssetStructure(m);
     bindNameAlgo(m);
     bindXformAlgo(m);
     bindPrimvarData(m);
+    bindScratchArena(m);
+    bindExtentAlgo(m);
+    bindBoundsAlgo(m);
     bindPointsAlgo(m);
     bindMeshAlgo(m);
     bindCurvesAlgo(m);
     bindCameraAlgo(m);
     bindLightAlgo(m);
     bindMaterialAlgo(m);
+    bindPhysicsCollisionAlgo(m);
     bindPhysicsJointAlgo(m);
     bindPhysicsMaterialAlgo(m);
     bindGprimAlgo(m);
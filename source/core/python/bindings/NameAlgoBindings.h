@@ -49,7 +49,8 @@ void bindNameAlgo(module& m)
 
             Returns:
                 A vector of valid and unique names.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -83,7 +84,8 @@ void bindNameAlgo(module& m)
 
             Returns:
                 A vector of valid and unique names.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -115,7 +117,8 @@ void bindNameAlgo(module& m)
 
             Returns:
                 A vector of valid and unique names.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     ::class_<NameCache>(
@@ -374,6 +377,120 @@ void bindNameAlgo(module& m)
             )"
         )
 
+        .def(
+            "reservePrimName",
+            overload_cast<const SdfPath&, const TfToken&>(&NameCache::reservePrimName),
+            arg("parent"),
+            arg("name"),
+            R"(
+                Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+
+                The name is reserved exactly as given, it is not made valid or unique.
+
+                Parameters:
+                    - **parent** - The parent prim path
+                    - **name** - The name to reserve
+
+                Returns:
+                    True if the name was reserved, false if it was already reserved or the parent is invalid
+            )"
+        )
+
+        .def(
+            "reservePrimName",
+            overload_cast<const UsdPrim&, const TfToken&>(&NameCache::reservePrimName),
+            arg("parent"),
+            arg("name"),
+            R"(
+                Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+
+                The name is reserved exactly as given, it is not made valid or unique.
+
+                Parameters:
+                    - **parent** - The parent prim
+                    - **name** - The name to reserve
+
+                Returns:
+                    True if the name was reserved, false if it was already reserved or the parent is invalid
+            )"
+        )
+
+        .def(
+            "reservePrimName",
+            overload_cast<const SdfPrimSpecHandle, const TfToken&>(&NameCache::reservePrimName),
+            arg("parent"),
+            arg("name"),
+            R"(
+                Reserve a name for use as the name of a child of the given prim, so that it will not be returned by subsequent requests.
+
+                The name is reserved exactly as given, it is not made valid or unique.
+
+                Parameters:
+                    - **parent** - The parent prim spec
+                    - **name** - The name to reserve
+
+                Returns:
+                    True if the name was reserved, false if it was already reserved or the parent is invalid
+            )"
+        )
+
+        .def(
+            "reservePropertyName",
+            overload_cast<const SdfPath&, const TfToken&>(&NameCache::reservePropertyName),
+            arg("parent"),
+            arg("name"),
+            R"(
+                Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+
+                The name is reserved exactly as given, it is not made valid or unique.
+
+                Parameters:
+                    - **parent** - The parent prim path
+                    - **name** - The name to reserve
+
+                Returns:
+                    True if the name was reserved, false if it was already reserved or the parent is invalid
+            )"
+        )
+
+        .def(
+            "reservePropertyName",
+            overload_cast<const UsdPrim&, const TfToken&>(&NameCache::reservePropertyName),
+            arg("parent"),
+            arg("name"),
+            R"(
+                Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+
+                The name is reserved exactly as given, it is not made valid or unique.
+
+                Parameters:
+                    - **parent** - The parent prim
+                    - **name** - The name to reserve
+
+                Returns:
+                    True if the name was reserved, false if it was already reserved or the parent is invalid
+            )"
+        )
+
+        .def(
+            "reservePropertyName",
+            overload_cast<const SdfPrimSpecHandle, const TfToken&>(&NameCache::reservePropertyName),
+            arg("parent"),
+            arg("name"),
+            R"(
+                Reserve a name for use as the name of a property on the given prim, so that it will not be returned by subsequent requests.
+
+                The name is reserved exactly as given, it is not made valid or unique.
+
+                Parameters:
+                    - **parent** - The parent prim spec
+                    - **name** - The name to reserve
+
+                Returns:
+                    True if the name was reserved, false if it was already reserved or the parent is invalid
+            )"
+        )
+
         .def(
             "updatePrimNames",
             overload_cast<const UsdPrim&>(&NameCache::updatePrimNames),
@@ -637,7 +754,8 @@ void bindNameAlgo(module& m)
 
                 Returns:
                     A vector of valid and unique names.
-            )"
+            )",
+            call_guard<gil_scoped_release>()
         )
 
         .def(
@@ -777,6 +895,30 @@ void bindNameAlgo(module& m)
 
         )"
     );
+    m.def(
+        "computeEffectiveDisplayNames",
+        &computeEffectiveDisplayNames,
+        arg("prims"),
+        arg("decodeNames") = false,
+        R"(
+            Calculate the effective display names of many prims, e.g. to list the visible range of a large stage in a user interface.
+
+            The result for each prim matches that of ``computeEffectiveDisplayName``, unless ``decodeNames`` is true, in which case the fallback prim
+            names which were transcoded by ``getValidPrimName`` are decoded to the original name (e.g. ``tn__Bcker_ah0`` is listed as ``Bäcker``).
+
+            Decoding reuses scratch buffers rather than allocating per name, and the decoded names are cached for the duration of the call, as many
+            prims of a large stage typically share a name. Large batches of prims are processed in parallel.
+
+            Args:
+                prims: The prims to compute the display names for
+                decodeNames: Whether to decode transcoded prim names when there is no authored display name
+
+            Returns:
+                The effective display name of each prim, or an empty string for any invalid prim
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 
 } // namespace usdex::core::bindings
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/PhysicsCollisionAlgo.h"
+
+#include "usdex/pybind/UsdBindings.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace usdex::core;
+using namespace pybind11;
+using namespace pxr;
+
+namespace usdex::core::bindings
+{
+
+void bindPhysicsCollisionAlgo(module& m)
+{
+    ::enum_<CollisionApproximation>(m, "CollisionApproximation", "The shape used to approximate a mesh for collisions")
+        .value("eConvexHull", CollisionApproximation::eConvexHull, "A convex hull of the mesh points, with a limited number of vertices.")
+        .value(
+            "eBoundingCube",
+            CollisionApproximation::eBoundingCube,
+            "The bounding box of the mesh points in the local space of the mesh, as a ``UsdGeom.Cube``."
+        )
+        .value(
+            "eBoundingSphere",
+            CollisionApproximation::eBoundingSphere,
+            "A sphere enclosing the mesh points, centered on their bounding box, as a ``UsdGeom.Sphere``."
+        );
+
+    m.def(
+        "definePhysicsColliders",
+        &definePhysicsColliders,
+        arg("stage"),
+        arg("meshes"),
+        arg("approximation") = CollisionApproximation::eConvexHull,
+        arg("maxHullVertices") = 64,
+        R"(
+            Define a precomputed collision prim approximating each of many meshes.
+
+            The UsdPhysics schemas have no representation of cooked collision data, so rather than leaving each simulator to compute (or "cook")
+            the approximation of every mesh when the asset is loaded, the approximations are precomputed and defined as collision prims of their
+            own: implicit shapes (cubes & spheres) which require no cooking at all, or convex hull meshes with few enough vertices that they can be
+            used by a simulator as they are.
+
+            The approximation of each mesh is computed from its points at the default time, in the local space of the mesh. The approximations of
+            all meshes are computed in parallel before any scene description is authored.
+
+            Each collision prim is defined as a sibling of its mesh, named after the mesh with a "Collision" suffix (made unique among the existing
+            siblings), with the local transform of the mesh (combined with the placement of the implicit shape), a "guide" purpose so that it is
+            not rendered, and the ``UsdPhysics.CollisionAPI`` applied. Convex hulls are defined as triangle meshes with the
+            ``UsdPhysics.MeshCollisionAPI`` applied and a "convexHull" approximation. The meshes themselves are not modified.
+
+            The collision prims are defined on ``stage``, which may differ from the stage of the meshes (e.g. the Physics Content Layer of an
+            asset, as returned by ``addAssetContent(stage, getPhysicsToken())``, while the meshes are read from the composed asset). The stages must
+            share the same namespace. Missing ancestors of the collision prims are authored as ``over`` specs.
+
+            Every mesh is validated before any scene description is authored, and nothing is authored if any mesh is invalid, has degenerate
+            points (e.g. a flat mesh cannot be approximated by a convex hull or a bounding cube), or is supplied more than once.
+
+            Parameters:
+                - **stage** - The stage on which to define the collision prims
+                - **meshes** - The meshes to approximate
+                - **approximation** - The shape used to approximate each mesh
+                - **maxHullVertices** - The maximum number of vertices of each convex hull, which must be at least 4. When a mesh requires more
+                  vertices, its hull is built from the furthest points first, so that the limited hull is a close approximation of the full hull.
+
+            Returns:
+                The collision prims, in the same order as ``meshes``, or an empty list on error.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+}
+
+} // namespace usdex::core::bindings
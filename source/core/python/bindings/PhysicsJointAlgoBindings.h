@@ -480,7 +480,7 @@ void bindPhysicsJointAlgo(module& m)
 
     m.def(
         "alignPhysicsJoint",
-        &alignPhysicsJoint,
+        overload_cast<UsdPhysicsJoint, const JointFrame&, const GfVec3f&>(&alignPhysicsJoint),
         arg("joint"),
         arg("frame"),
         arg("axis"),
@@ -509,7 +509,7 @@ void bindPhysicsJointAlgo(module& m)
 
     m.def(
         "connectPhysicsJoint",
-        &connectPhysicsJoint,
+        overload_cast<UsdPhysicsJoint, const UsdPrim&, const UsdPrim&, const JointFrame&, const GfVec3f&>(&connectPhysicsJoint),
         arg("joint"),
         arg("body0"),
         arg("body1"),
@@ -543,5 +543,91 @@ void bindPhysicsJointAlgo(module& m)
                 ``None``
         )"
     );
+
+    pybind11::class_<PhysicsJointData> jointData(
+        m,
+        "PhysicsJointData",
+        R"(
+            The arguments required to define a single joint via ``definePhysicsJoints``.
+
+            The members match the arguments of the ``definePhysics*Joint`` functions, with the addition of the type of the joint and the absolute
+            prim path at which to define it. Members which do not apply to the type of the joint are ignored.
+        )"
+    );
+
+    pybind11::enum_<PhysicsJointData::Type>(jointData, "Type", "The types of joint which can be defined")
+        .value("Fixed", PhysicsJointData::Type::Fixed, "A ``UsdPhysics.FixedJoint``, see ``definePhysicsFixedJoint``")
+        .value("Revolute", PhysicsJointData::Type::Revolute, "A ``UsdPhysics.RevoluteJoint``, see ``definePhysicsRevoluteJoint``")
+        .value("Prismatic", PhysicsJointData::Type::Prismatic, "A ``UsdPhysics.PrismaticJoint``, see ``definePhysicsPrismaticJoint``")
+        .value("Spherical", PhysicsJointData::Type::Spherical, "A ``UsdPhysics.SphericalJoint``, see ``definePhysicsSphericalJoint``");
+
+    jointData.def(pybind11::init<>())
+        .def(
+            pybind11::init(
+                [](PhysicsJointData::Type type,
+                   const SdfPath& path,
+                   const UsdPrim& body0,
+                   const UsdPrim& body1,
+                   const JointFrame& frame,
+                   const GfVec3f& axis,
+                   std::optional<float> lowerLimit,
+                   std::optional<float> upperLimit,
+                   std::optional<float> coneAngle0Limit,
+                   std::optional<float> coneAngle1Limit)
+                {
+                    return PhysicsJointData{ type, path, body0, body1, frame, axis, lowerLimit, upperLimit, coneAngle0Limit, coneAngle1Limit };
+                }
+            ),
+            arg("type"),
+            arg("path"),
+            arg("body0"),
+            arg("body1"),
+            arg("frame"),
+            arg("axis") = GfVec3f(1.0f, 0.0f, 0.0f),
+            arg("lowerLimit") = nullptr,
+            arg("upperLimit") = nullptr,
+            arg("coneAngle0Limit") = nullptr,
+            arg("coneAngle1Limit") = nullptr
+        )
+        .def_readwrite("type", &PhysicsJointData::type, "The type of the joint")
+        .def_readwrite("path", &PhysicsJointData::path, "The absolute prim path at which to define the joint")
+        .def_readwrite("body0", &PhysicsJointData::body0, "The first body of the joint")
+        .def_readwrite("body1", &PhysicsJointData::body1, "The second body of the joint")
+        .def_readwrite("frame", &PhysicsJointData::frame, "The position and rotation of the joint")
+        .def_readwrite("axis", &PhysicsJointData::axis, "The axis of a revolute, prismatic, or spherical joint")
+        .def_readwrite("lowerLimit", &PhysicsJointData::lowerLimit, "The lower limit of a revolute (degrees) or prismatic (distance) joint")
+        .def_readwrite("upperLimit", &PhysicsJointData::upperLimit, "The upper limit of a revolute (degrees) or prismatic (distance) joint")
+        .def_readwrite("coneAngle0Limit", &PhysicsJointData::coneAngle0Limit, "The lower limit of the cone angle (degrees) of a spherical joint")
+        .def_readwrite("coneAngle1Limit", &PhysicsJointData::coneAngle1Limit, "The upper limit of the cone angle (degrees) of a spherical joint");
+
+    m.def(
+        "definePhysicsJoints",
+        &definePhysicsJoints,
+        arg("stage"),
+        arg("joints"),
+        R"(
+            Defines many physics joints on the stage at once.
+
+            The result is equivalent to calling the ``definePhysics*Joint`` function matching the type of each element of ``joints``, but is
+            significantly faster for large numbers of joints (e.g. when importing articulated robots).
+
+            All of the joints are validated up front, before any scene description is authored. If any joint fails validation, or the same path is
+            requested more than once, a runtime error is posted for each failure and no joints are defined.
+
+            The local to world transforms of the bodies are computed via a single ``UsdGeom.XformCache``, so that the transforms of bodies (and
+            their ancestors) which are shared by several joints are computed once. The joints are then authored directly to the ``Sdf.Layer`` of
+            the current edit target within a single ``Sdf.ChangeBlock``, so that change notification and stage recomposition occur once for the
+            whole batch.
+
+            Parameters:
+                - **stage** - The stage on which to define the joints
+                - **joints** - The type, path, bodies, and alignment of each joint
+
+            Returns:
+                ``UsdPhysics.Joint`` schemas wrapping the defined ``Usd.Prims``, in the same order as ``joints``, or an empty list if the joints
+                could not be defined.
+        )",
+        call_guard<gil_scoped_release>()
+    );
 }
 } // namespace usdex::core::bindings
@@ -107,6 +107,41 @@ void bindPhysicsMaterialAlgo(module& m)
         )"
     );
 
+    m.def(
+        "definePhysicsMaterial",
+        overload_cast<
+            MaterialRegistry&,
+            const std::string&,
+            const float,
+            const std::optional<float>,
+            const std::optional<float>,
+            const std::optional<float>>(&definePhysicsMaterial),
+        arg("registry"),
+        arg("name"),
+        arg("dynamicFriction"),
+        arg("staticFriction") = nullptr,
+        arg("restitution") = nullptr,
+        arg("density") = nullptr,
+        R"(
+            Creates a Physics Material via a ``usdex.core.MaterialRegistry``, or returns an identical Physics Material which was defined previously.
+
+            The registry deduplicates physics materials by their dynamic friction, static friction, restitution, and density, so that a single
+            material is defined for each unique combination. Parameters which are not supplied are not authored, so they are only considered equal
+            to other unsupplied parameters.
+
+            Parameters:
+                - **registry** - The registry used to find or define the material
+                - **name** - The name of the material, if a new material must be defined
+                - **dynamicFriction** - The dynamic friction of the material
+                - **staticFriction** - The static friction of the material
+                - **restitution** - The restitution of the material
+                - **density** - The density of the material
+
+            Returns:
+                The new or existing ``UsdShade.Material``. Returns an invalid material on error.
+        )"
+    );
+
     m.def(
         "addPhysicsToMaterial",
         &addPhysicsToMaterial,
@@ -164,6 +199,31 @@ void bindPhysicsMaterialAlgo(module& m)
                 ``True`` if the material was successfully bound to the target prim, ``False`` otherwise.
         )"
     );
+
+    m.def(
+        "bindPhysicsMaterials",
+        &bindPhysicsMaterials,
+        arg("prims"),
+        arg("materials"),
+        arg("collapseToAncestors") = false,
+        R"(
+            Binds physics materials to many rigid bodies or collision geometry prims at once.
+
+            This is equivalent to calling ``bindPhysicsMaterial()`` for each prim, but each unique material is validated once, and the
+            ``UsdShade.MaterialBindingAPI`` and "physics" purpose binding relationships are authored directly to the current edit target layer
+            within a single ``Sdf.ChangeBlock``. Nothing is authored if any of the prims or materials are invalid.
+
+            Optionally, bindings may be collapsed onto common ancestors, as described by ``bindMaterials()``.
+
+            Args:
+                prims: The prims that the materials will affect. They must all belong to the same stage.
+                materials: The materials to bind to the prims, in the same order. A single material may be supplied to bind it to every prim.
+                collapseToAncestors: Whether to bind common ancestors rather than each prim, when every child of the ancestor shares a material
+
+            Returns:
+                ``True`` if the materials were successfully bound to the prims, ``False`` otherwise.
+        )"
+    );
 }
 
 } // namespace usdex::core::bindings
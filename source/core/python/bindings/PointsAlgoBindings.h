@@ -9,6 +9,7 @@
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace usdex::core;
 using namespace pybind11;
@@ -76,7 +77,8 @@ void bindPointsAlgo(module& m)
 
             Returns:
                 ``UsdGeom.Points`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -115,7 +117,8 @@ void bindPointsAlgo(module& m)
 
             Returns:
                 ``UsdGeom.Points`` schema wrapping the defined ``Usd.Prim``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -148,8 +151,293 @@ void bindPointsAlgo(module& m)
 
             Returns:
                 ``UsdGeom.Points`` schema wrapping the defined ``Usd.Prim``
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<PointCloudQuantization>(
+        m,
+        "PointCloudQuantization",
+        R"(
+            Options to quantize the positions and primvars of a point cloud as they are authored by ``definePointCloud``.
+
+            Photogrammetry and Gaussian splat data is captured with far less precision than single precision floats provide. Quantizing the data to
+            the precision of the capture allows the primvars to be indexed with few distinct values, which results in much smaller primvars (as the
+            indices compress well in ``usdc`` files) and faster loading.
+
+            The schema types of the points, widths, normals, and display primvars are single precision, so the quantized data is still authored with
+            these types, rather than as half precision or integer types which renderers would not interpret as the schema attributes.
         )"
+    )
+        .def(init<>())
+        .def(
+            init(
+                [](int positionBits, int precision)
+                {
+                    return PointCloudQuantization{ positionBits, precision };
+                }
+            ),
+            arg("positionBits") = 16,
+            arg("precision") = 11
+        )
+        .def_readwrite(
+            "positionBits",
+            &PointCloudQuantization::positionBits,
+            R"(
+                The number of bits used to quantize each component of the positions, relative to the bounds of the points.
+
+                The positions are snapped to a grid of ``2^positionBits`` cells across the bounds, and are authored relative to the center of the
+                bounds. The center is authored as a double precision translate op of the prim, so that points with large coordinates
+                (e.g. georeferenced scans) retain their precision. If this is not positive, the positions are authored as supplied.
+            )"
+        )
+        .def_readwrite(
+            "precision",
+            &PointCloudQuantization::precision,
+            R"(
+                The number of significant bits retained from each component of the widths, normals, display color, and display opacity before they
+                are merged. The default matches the precision of half floats. See ``PrimvarData.indexWithPrecision(bits)``. If this is not positive,
+                the primvars are authored as supplied.
+            )"
+        );
+
+    m.def(
+        "definePointCloud",
+        overload_cast<
+            UsdStagePtr,
+            const SdfPath&,
+            const VtVec3fArray&,
+            const PointCloudQuantization&,
+            std::optional<const VtInt64Array>,
+            std::optional<const FloatPrimvarData>,
+            std::optional<const Vec3fPrimvarData>,
+            std::optional<const Vec3fPrimvarData>,
+            std::optional<const FloatPrimvarData>>(&definePointCloud),
+        arg("stage"),
+        arg("path"),
+        arg("points"),
+        arg("quantization"),
+        arg("ids") = nullptr,
+        arg("widths") = nullptr,
+        arg("normals") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        R"(
+            Defines a ``UsdGeom.Points`` prim on the stage, quantizing its positions and primvars.
+
+            This is an overloaded member function, provided for convenience. It differs from the above function only in what arguments it accepts.
+
+            The ``points`` and primvars are quantized according to the ``quantization`` options before they are validated and authored. Primvars
+            with an element size greater than one, or which are otherwise invalid, are authored as supplied. Use
+            ``computePointCloudQuantizationReport`` to measure the accuracy of the authored data.
+
+            Parameters:
+                - **stage** - The stage on which to define the points.
+                - **path** - The absolute prim path at which to define the points.
+                - **points** - Vertex positions for the points described in local space.
+                - **quantization** - The options used to quantize the points and primvars.
+                - **ids** - Values for the id specification for the points.
+                - **widths** - Values for the width specification for the points.
+                - **normals** - Values for the normals primvar for the points. Only Vertex normals are considered valid.
+                - **displayColor** - Values to be authored for the display color primvar.
+                - **displayOpacity** - Values to be authored for the display opacity primvar.
+
+            Returns:
+                ``UsdGeom.Points`` schema wrapping the defined ``Usd.Prim``
+        )",
+        call_guard<gil_scoped_release>()
     );
+
+    ::class_<PointCloudQuantizationReport>(
+        m,
+        "PointCloudQuantizationReport",
+        R"(
+            The round trip accuracy of the data authored for a point cloud, as computed by ``computePointCloudQuantizationReport``.
+
+            Each error is the largest absolute difference between a component of a source value and the corresponding authored value.
+        )"
+    )
+        .def(init<>())
+        .def_readwrite(
+            "maxPointError",
+            &PointCloudQuantizationReport::maxPointError,
+            "The largest error of a position, including the local transform of the prim"
+        )
+        .def_readwrite("maxWidthError", &PointCloudQuantizationReport::maxWidthError, "The largest error of a width")
+        .def_readwrite("maxNormalError", &PointCloudQuantizationReport::maxNormalError, "The largest error of a normal")
+        .def_readwrite("maxDisplayColorError", &PointCloudQuantizationReport::maxDisplayColorError, "The largest error of a display color")
+        .def_readwrite("maxDisplayOpacityError", &PointCloudQuantizationReport::maxDisplayOpacityError, "The largest error of a display opacity");
+
+    m.def(
+        "computePointCloudQuantizationReport",
+        &computePointCloudQuantizationReport,
+        arg("pointCloud"),
+        arg("points"),
+        arg("widths") = nullptr,
+        arg("normals") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Computes the round trip accuracy of a point cloud, by reading back its authored values and comparing them with the source data.
+
+            The authored points are transformed by the local transform of the prim, so that the dequantizing translation authored by a quantized
+            ``definePointCloud`` is accounted for. The values are compared per point, so the interpolation and indexing of the authored primvars
+            may differ from the source primvars. Errors are only computed for the supplied values, and are infinite if the authored values are
+            missing or do not hold the same number of elements as the source values.
+
+            Parameters:
+                - **pointCloud** - The points prim to read the authored values from.
+                - **points** - The source positions of the points.
+                - **widths** - The source widths of the points.
+                - **normals** - The source normals of the points.
+                - **displayColor** - The source display color of the points.
+                - **displayOpacity** - The source display opacity of the points.
+                - **time** - The time at which to read the authored values.
+
+            Returns:
+                The largest error of each of the supplied values.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<PointCloudTiling>(m, "PointCloudTiling", "Options controlling how ``definePointCloudTiles`` partitions a point cloud into tiles.")
+        .def(init<>())
+        .def_readwrite(
+            "tileSize",
+            &PointCloudTiling::tileSize,
+            R"(
+                The edge length of the cubic cells of the tiling grid, in the local units of the points.
+
+                If this is not positive, the size is chosen so that each tile would hold ``targetPointsPerTile`` points if the points were distributed
+                evenly throughout their bounds.
+            )"
+        )
+        .def_readwrite(
+            "targetPointsPerTile",
+            &PointCloudTiling::targetPointsPerTile,
+            "The approximate number of points in each tile, when the ``tileSize`` is chosen automatically."
+        )
+        .def_readwrite(
+            "usePayloads",
+            &PointCloudTiling::usePayloads,
+            "Whether to author each tile to its own layer, targeted by a payload, so that viewers can load only the visible tiles."
+        )
+        .def_readwrite(
+            "payloadFormat",
+            &PointCloudTiling::payloadFormat,
+            "The file format extension of the tile layers, when ``usePayloads`` is true."
+        )
+        .def_readwrite(
+            "quantization",
+            &PointCloudTiling::quantization,
+            R"(
+                The options used to quantize the points and primvars of each tile, relative to the bounds of that tile, or ``None`` to author them
+                as supplied.
+            )"
+        );
+
+    m.def(
+        "definePointCloudTiles",
+        &definePointCloudTiles,
+        arg("parent"),
+        arg("name"),
+        arg("points"),
+        arg("tiling") = PointCloudTiling(),
+        arg("ids") = nullptr,
+        arg("widths") = nullptr,
+        arg("normals") = nullptr,
+        arg("displayColor") = nullptr,
+        arg("displayOpacity") = nullptr,
+        R"(
+            Defines a point cloud as a grid of ``UsdGeom.Points`` tiles, so that very large point clouds (e.g. LiDAR scans) can be streamed.
+
+            The points are partitioned into the cubic cells of a grid aligned with their bounds. The cell of each point is computed in parallel, and
+            the points of each non-empty cell are gathered (in their original order) into a ``UsdGeom.Points`` prim with its own tight extent. The
+            optional values are partitioned along with the points, so they must have a value for every point, or constant interpolation. The grid is
+            limited to a fixed number of cells, so the ``tileSize`` may be increased for point clouds with very large bounds.
+
+            The tiles are defined as children of a ``UsdGeom.Xform`` prim named ``name`` below ``parent``, and are named ``Tile_0``, ``Tile_1``, etc.
+
+            If ``tiling.quantization`` is set, the data of each tile is quantized relative to the bounds of that tile, as by the quantized overload of
+            ``definePointCloud``, so each tile has its own dequantizing translation.
+
+            If ``tiling.usePayloads`` is true, each tile is defined as the default prim of its own layer, within a ``getPayloadToken()`` subdirectory
+            of the edit target layer (which must not be anonymous). The tile layers are authored and saved in parallel. Each tile prim on the stage
+            then targets its layer via a payload, and the bounds of the tile are authored as its ``extentsHint``, so that viewers can choose which
+            tiles to load without loading any of them.
+
+            Parameters:
+                - **parent** - The prim below which to define the tiles.
+                - **name** - The name of the ``UsdGeom.Xform`` prim which holds the tiles.
+                - **points** - Vertex positions for the points described in local space.
+                - **tiling** - The options controlling the size of the tiles and whether they are authored as payloads.
+                - **ids** - Values for the id specification for the points.
+                - **widths** - Values for the width specification for the points.
+                - **normals** - Values for the normals primvar for the points. Only Vertex normals are considered valid.
+                - **displayColor** - Values to be authored for the display color primvar.
+                - **displayOpacity** - Values to be authored for the display opacity primvar.
+
+            Returns:
+                The tile prims, in the order of their names, or an empty list if the point cloud could not be defined.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<PointCloudWriter>(
+        m,
+        "PointCloudWriter",
+        R"(
+            Writes time sampled frames of point cloud data to an existing ``UsdGeom.Points`` prim.
+
+            This is intended for streaming many frames of data (e.g. LiDAR sweeps or particle simulations) more efficiently than authoring each frame
+            via ``Usd.Attribute.Set``. The attributes are authored via the ``UsdGeom.Points`` schema on the first frame, then all subsequent frames are
+            written directly to the same edit target layer.
+
+            The invariants of the stream are established by the first frame and validated against each subsequent frame:
+
+            - The same set of optional values (ids, widths, normals, display color, and display opacity) must be provided for every frame.
+            - The interpolation, element size, and indexing of each primvar must not change between frames.
+
+            The number of points may change between frames. The data of each frame is validated in the same way as ``definePointCloud``, and the extent
+            is computed from the points & widths of each frame and authored at the same time code.
+
+            Note:
+                All time samples are held in memory by the edit target layer until it is saved. To bound memory for very long streams, bind a
+                separate writer to each of several layers (e.g. one per range of frames, to be combined via value clips), and save & release each
+                layer when it is complete.
+        )"
+    )
+        .def(init<UsdGeomPoints>(), arg("pointCloud"), "Bind a writer to an existing ``UsdGeom.Points`` prim.")
+        .def("isValid", &PointCloudWriter::isValid, "Whether frames can be written.")
+        .def(
+            "writeFrame",
+            &PointCloudWriter::writeFrame,
+            arg("time"),
+            arg("points"),
+            arg("ids") = nullptr,
+            arg("widths") = nullptr,
+            arg("normals") = nullptr,
+            arg("displayColor") = nullptr,
+            arg("displayOpacity") = nullptr,
+            R"(
+                Write a frame of point cloud data at the given time.
+
+                Parameters:
+                    - **time** - The time code of the frame. It must be numeric and greater than the time of the previous frame.
+                    - **points** - Positions of the points.
+                    - **ids** - Values for the id specification for the points.
+                    - **widths** - Values for the width specification for the points.
+                    - **normals** - Values for the normals primvar for the points. Only Vertex normals are considered valid.
+                    - **displayColor** - Values to be authored for the display color primvar.
+                    - **displayOpacity** - Values to be authored for the display opacity primvar.
+
+                Returns:
+                    Whether the frame was written.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def("getFrameCount", &PointCloudWriter::getFrameCount, "The number of frames that have been written successfully.");
 }
 
 } // namespace usdex::core::bindings
@@ -6,8 +6,12 @@
 
 #include "usdex/core/PrimvarData.h"
 
+#include "usdex/pybind/UsdBindings.h"
+
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 #include <sstream>
 
@@ -17,6 +21,29 @@ using namespace pybind11;
 namespace
 {
 
+// Create a read-only NumPy array which references the data of a VtArray without copying it.
+// The array holds a reference to the VtArray data (not to the PrimvarData), so that it remains valid even if the PrimvarData is re-indexed.
+template <typename T>
+pybind11::array makeReadOnlyView(const pxr::VtArray<T>& values)
+{
+    using traits = pybind11::detail::vtarray_buffer_traits<T>;
+    using Scalar = typename traits::scalar;
+
+    std::vector<ssize_t> shape = { static_cast<ssize_t>(values.size()) };
+    std::vector<ssize_t> strides = { static_cast<ssize_t>(sizeof(T)) };
+    if (traits::components > 1)
+    {
+        shape.push_back(traits::components);
+        strides.push_back(static_cast<ssize_t>(sizeof(Scalar)));
+    }
+
+    auto* owner = new pxr::VtArray<T>(values);
+    capsule base(owner, [](void* ptr) { delete static_cast<pxr::VtArray<T>*>(ptr); });
+    pybind11::array result(pybind11::dtype::of<Scalar>(), shape, strides, reinterpret_cast<const Scalar*>(owner->cdata()), base);
+    result.attr("setflags")(arg("write") = false);
+    return result;
+}
+
 template <typename T>
 void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::string& brief)
 {
@@ -90,7 +117,7 @@ void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::stri
 
     binder.def_static(
         "getPrimvarData",
-        &PrimvarData<T>::getPrimvarData,
+        overload_cast<const pxr::UsdGeomPrimvar&, pxr::UsdTimeCode>(&PrimvarData<T>::getPrimvarData),
         arg("primvar"),
         arg("time") = UsdTimeCode::Default().GetValue(),
         R"(
@@ -131,6 +158,75 @@ void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::stri
         )"
     );
 
+    binder.def_static(
+        "getPrimvarData",
+        overload_cast<const std::vector<pxr::UsdGeomPrimvar>&, pxr::UsdTimeCode>(&PrimvarData<T>::getPrimvarData),
+        arg("primvars"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Construct ``PrimvarData`` from many ``UsdGeom.Primvars`` that have already been authored.
+
+            This is equivalent to calling ``getPrimvarData(primvar)`` for each primvar, but the primvars are read concurrently.
+
+            Args:
+                primvars: The previously authored ``UsdGeom.Primvars``.
+                time: The time at which the attribute values are read.
+
+            Returns:
+                The read-only ``PrimvarData`` of each primvar, in the same order as ``primvars``.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    binder.def_static(
+        "getPrimvarData",
+        overload_cast<const pxr::UsdPrim&, const pxr::TfTokenVector&, pxr::UsdTimeCode>(&PrimvarData<T>::getPrimvarData),
+        arg("prim"),
+        arg("names") = pxr::TfTokenVector(),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Construct ``PrimvarData`` from all of the authored ``UsdGeom.Primvars`` of a prim which hold values of this type.
+
+            The primvars of the prim are gathered in a single pass over its authored properties, then read concurrently.
+            Primvars holding values of any other type are skipped.
+
+            Args:
+                prim: The prim from which to read the primvars.
+                names: Optional primvar names, excluding the "primvars:" namespace, used to filter the primvars which are read.
+                    If empty, all authored primvars which hold values of this type are read.
+                time: The time at which the attribute values are read.
+
+            Returns:
+                A dictionary of the read-only ``PrimvarData`` of each primvar, keyed by the primvar name excluding the "primvars:" namespace.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    binder.def_static(
+        "setPrimvars",
+        &PrimvarData<T>::setPrimvars,
+        arg("primvars"),
+        arg("data"),
+        arg("time") = UsdTimeCode::Default().GetValue(),
+        R"(
+            Set data on many existing ``UsdGeom.Primvars``.
+
+            This is equivalent to calling ``setPrimvar(primvar)`` for each primvar, but the values, indices, interpolation, and element size of all
+            primvars are written directly to the current edit target layer within a single ``Sdf.ChangeBlock``.
+
+            All arguments are validated before any primvar is authored, so a failure leaves every primvar unchanged.
+
+            Args:
+                primvars: The previously authored ``UsdGeom.Primvars``.
+                data: The ``PrimvarData`` to author onto each primvar. It must be the same length as ``primvars``.
+                time: The time at which the attribute values are written.
+
+            Returns:
+                Whether all of the ``UsdGeom.Primvars`` were authored from the data.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
     binder.def(
         "interpolation",
         &PrimvarData<T>::interpolation,
@@ -159,6 +255,23 @@ void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::stri
         )"
     );
 
+    if constexpr (pybind11::detail::vtarray_buffer_traits<T>::supported)
+    {
+        binder.def(
+            "valuesView",
+            [](const PrimvarData<T>& self) { return makeReadOnlyView(self.values()); },
+            R"(
+                Access to the values array as a read-only ``numpy.ndarray``, without copying the values.
+
+                Vector values (e.g. ``Gf.Vec3f``) are presented as a 2D array with one row per value. The view remains valid even if this
+                ``PrimvarData`` is subsequently re-indexed.
+
+                Returns:
+                    The primvar values.
+            )"
+        );
+    }
+
     binder.def(
         "hasIndices",
         &PrimvarData<T>::hasIndices,
@@ -178,6 +291,8 @@ void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::stri
 
             This method throws a runtime error if the ``PrimvarData`` is not indexed. For exception-free access, check ``hasIndices()`` before calling this.
 
+            If the indices are compact (see ``compactIndices()``) they are widened on the first call, and the widened array is cached.
+
             Note:
                 It may contain an empty or invalid indices array. Use ``PrimvarData.isValid()`` to validate that the indices are not out-of-range.
 
@@ -186,6 +301,34 @@ void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::stri
         )"
     );
 
+    binder.def(
+        "hasCompactIndices",
+        &PrimvarData<T>::hasCompactIndices,
+        R"(
+            Whether the indices are held in memory as 8 or 16 bit unsigned integers, following a successful call to ``compactIndices()``.
+
+            Returns:
+                True if the indices are compact.
+        )"
+    );
+
+    if constexpr (pybind11::detail::vtarray_buffer_traits<T>::supported)
+    {
+        binder.def(
+            "indicesView",
+            [](const PrimvarData<T>& self) { return makeReadOnlyView(self.indices()); },
+            R"(
+                Access to the indices array as a read-only ``numpy.ndarray``, without copying the indices.
+
+                This method throws a runtime error if the ``PrimvarData`` is not indexed. For exception-free access, check ``hasIndices()`` before
+                calling this.
+
+                Returns:
+                    The primvar indices.
+            )"
+        );
+    }
+
     binder.def(
         "elementSize",
         &PrimvarData<T>::elementSize,
@@ -256,9 +399,30 @@ void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::stri
         )"
     );
 
+    binder.def(
+        "hash",
+        &PrimvarData<T>::hash,
+        R"(
+            A hash of the content of this ``PrimvarData``, suitable for using it as a key in hashed containers.
+
+            The hash covers the interpolation, element size, values and indices. Equal ``PrimvarData`` objects always produce equal hashes.
+
+            The hash is computed lazily on the first call, and is remembered (and carried by copies of this ``PrimvarData``) until the data is
+            re-indexed.
+            Once both sides of a comparison have been hashed, the equality operator rejects differing hashes without comparing the arrays.
+
+            Returns:
+                The content hash.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    // This must be defined before the equality operator, which otherwise leaves the class unhashable
+    binder.def("__hash__", &PrimvarData<T>::hash, call_guard<gil_scoped_release>());
+
     binder.def(
         "index",
-        &PrimvarData<T>::index,
+        overload_cast<>(&PrimvarData<T>::index),
         R"(
             Update the values and indices of this ``PrimvarData`` object to avoid duplicate values.
 
@@ -268,9 +432,162 @@ void bindPrimvarDataImpl(module& m, const std::string& typeName, const std::stri
                 - If there are no duplicate values.
                 - If the existing indices are invalid
 
+            Values are compared exactly (not only by hash), so distinct values are never merged, and the first occurrence of each value determines its
+            position in the resulting values array. Large arrays are deduplicated across multiple threads via the OpenUSD ``Work`` library, and the
+            result is identical regardless of the ``Work`` concurrency limit in effect.
+
             Returns:
                 True if the values and/or indices were modified.
-        )"
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    binder.def(
+        "index",
+        overload_cast<float>(&PrimvarData<T>::index),
+        arg("tolerance"),
+        R"(
+            Update the values and indices of this ``PrimvarData`` object to merge values that are within a tolerance of one another.
+
+            Each component of each value is snapped to a grid with a cell size of ``tolerance``, and values which snap to the same cell are merged. The first
+            occurrence within each cell is kept verbatim (i.e. the values are not modified, only deduplicated). Note that values very close to a cell
+            boundary may still fall into neighboring cells, so this is a best effort reduction rather than a clustering algorithm.
+
+            This is only supported for floating point value types (e.g. ``float``, ``Gf.Vec2f``, ``Gf.Vec3f``). A zero tolerance is equivalent to ``index()``.
+
+            Updates will not be made in the same conditions as ``index()``, nor if the tolerance is negative or the value type is not floating point.
+
+            Args:
+                tolerance: The cell size used to quantize each component prior to deduplication.
+
+            Returns:
+                True if the values and/or indices were modified.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    binder.def(
+        "indexWithPrecision",
+        &PrimvarData<T>::indexWithPrecision,
+        arg("bits"),
+        R"(
+            Update the values and indices of this ``PrimvarData`` object to merge values that are equal to a number of significant bits.
+
+            Each component of each value is rounded to ``bits`` significant bits, and values which round to the same components are merged. The first
+            occurrence is kept verbatim (i.e. the values are not modified, only deduplicated). Unlike ``index(tolerance)``, the precision is relative to
+            the magnitude of each component, which suits data of varying scale.
+
+            This is only supported for floating point value types (e.g. ``float``, ``Gf.Vec2f``, ``Gf.Vec3f``). A precision of at least the number of
+            significant bits of the value type (e.g. 24 for ``float``) is equivalent to ``index()``.
+
+            Updates will not be made in the same conditions as ``index()``, nor if the precision is less than one bit or the value type is not floating
+            point.
+
+            Args:
+                bits: The number of significant bits retained from each component prior to deduplication.
+
+            Returns:
+                True if the values and/or indices were modified.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    binder.def(
+        "compactIndices",
+        &PrimvarData<T>::compactIndices,
+        R"(
+            Store the indices of this ``PrimvarData`` in memory as 8 or 16 bit unsigned integers, to reduce the memory held prior to authoring.
+
+            Indices are compacted to 8 bits when there are at most 256 values, and to 16 bits when there are at most 65,536 values, which is common for
+            colors, ids and other low cardinality data after ``index()``. The content of the ``PrimvarData`` is unchanged, only its storage, so
+            ``hash()`` and the equality operator are unaffected. The compact indices are widened to a ``Vt.IntArray`` only when required:
+
+                - ``setPrimvar()`` and ``setPrimvars()`` widen a temporary array while authoring.
+                - ``indices()`` widens the array once and caches it, so that both representations are held in memory from then on.
+
+            Updates will not be made if there are no indices, if the indices are already compact, if there are more than 65,536 values, or if the
+            existing indices are outside the range of the values. A subsequent ``index()`` restores ``Vt.IntArray`` indices.
+
+            Returns:
+                True if the indices were compacted.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    binder.def(
+        "demoteToConstant",
+        &PrimvarData<T>::demoteToConstant,
+        R"(
+            Update the interpolation of this ``PrimvarData`` object to ``constant`` if every element holds the same value(s).
+
+            Source data often provides a value per element which turns out to be uniform throughout (e.g. a single display color for every vertex).
+            Demoting the interpolation reproduces the data exactly, but authors a single element rather than an array of duplicates.
+
+            This is applicable to any geometry (e.g. before calling ``definePointCloud``), as it does not depend on the topology.
+
+            The elements are compared exactly in a single linear scan (so ``NaN`` values are never considered equal). Updates will not be made if the
+            interpolation is already ``constant``, if the data is invalid, or if any element differs.
+
+            Returns:
+                True if the interpolation was demoted.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    binder.def(
+        "demoteMeshInterpolation",
+        &PrimvarData<T>::demoteMeshInterpolation,
+        arg("faceVertexCounts"),
+        arg("faceVertexIndices"),
+        arg("pointCount"),
+        R"(
+            Update the interpolation of this ``PrimvarData`` object to the cheapest interpolation which reproduces the data of a mesh exactly.
+
+            The interpolations are considered from cheapest to most expensive, and the first which reproduces every element exactly is used:
+
+                - ``constant`` if every element holds the same value(s).
+                - For ``faceVarying`` data, ``uniform`` if all of the face vertices of each face hold the same value(s), and ``vertex`` if all of
+                  the face vertices which share a point hold the same value(s). Whichever of these has fewer elements is considered first.
+
+            Each candidate is checked in a single linear scan over the elements. Indexed data remains indexed (with the indices of the first element
+            of each demoted element), unless it is demoted to ``constant``. Points which are not referenced by any face take the value of the first
+            element, as their value does not contribute to the appearance of the mesh.
+
+            Updates will not be made if the data is invalid, or if the number of elements does not match the topology for its interpolation.
+
+            Args:
+                faceVertexCounts: The number of vertices in each face of the mesh
+                faceVertexIndices: Indices of the positions from the points to use for each face vertex
+                pointCount: The number of points of the mesh
+
+            Returns:
+                True if the interpolation was demoted.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    binder.def(
+        "demoteCurvesInterpolation",
+        &PrimvarData<T>::demoteCurvesInterpolation,
+        arg("curveVertexCounts"),
+        R"(
+            Update the interpolation of this ``PrimvarData`` object to the cheapest interpolation which reproduces the data of basis curves exactly.
+
+            The interpolations are considered from cheapest to most expensive, and the first which reproduces every element exactly is used:
+
+                - ``constant`` if every element holds the same value(s).
+                - For ``vertex`` data, ``uniform`` if all of the vertices of each curve hold the same value(s).
+
+            The number of ``varying`` elements of each curve depends on the basis and wrap of the curves, so ``varying`` data is only demoted to
+            ``constant``. Otherwise this behaves the same as ``demoteMeshInterpolation()``.
+
+            Args:
+                curveVertexCounts: The number of vertices in each curve
+
+            Returns:
+                True if the interpolation was demoted.
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     binder.def(
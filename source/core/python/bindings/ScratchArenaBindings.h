@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "usdex/core/ScratchArena.h"
+
+#include <pybind11/pybind11.h>
+
+#include <memory>
+
+using namespace usdex::core;
+using namespace pybind11;
+
+namespace usdex::core::bindings
+{
+
+// A Python context manager which holds a ScratchArenaScope between `__enter__` and `__exit__`, rather than for the lifetime of the object
+class PyScratchArenaScope
+{
+
+public:
+
+    void enter()
+    {
+        m_scope = std::make_unique<ScratchArenaScope>();
+    }
+
+    void exit()
+    {
+        m_scope.reset();
+    }
+
+private:
+
+    std::unique_ptr<ScratchArenaScope> m_scope;
+};
+
+void bindScratchArena(module& m)
+{
+    ::class_<PyScratchArenaScope>(
+        m,
+        "ScratchArenaScope",
+        R"(
+            A context manager that retains the scratch memory of the geometry algorithms between calls.
+
+            The geometry algorithms (e.g. ``computeMeshNormals``, ``PrimvarData.index``, and the validation of the ``define`` functions) allocate
+            their temporary buffers from an arena which is local to the calling thread. By default the arena frees its memory as soon as each
+            computation completes.
+
+            While the context is active, the memory of the arena is kept and reused by each subsequent computation on the same thread, so that only
+            the arrays which are returned (or authored) are allocated from the heap. The memory is freed when the outermost context exits.
+
+            The context applies to the calling thread only and may be nested.
+
+            Example:
+
+                .. code-block:: python
+
+                    with usdex.core.ScratchArenaScope():
+                        for path, (counts, indices, points) in meshes.items():
+                            normals = usdex.core.computeMeshNormals(counts, indices, points)
+                            usdex.core.definePolyMesh(stage, path, counts, indices, points, normals=normals)
+        )"
+    )
+        .def(init<>())
+        .def(
+            "__enter__",
+            [](PyScratchArenaScope& self) -> PyScratchArenaScope&
+            {
+                self.enter();
+                return self;
+            },
+            return_value_policy::reference
+        )
+        .def(
+            "__exit__",
+            [](PyScratchArenaScope& self, const object&, const object&, const object&)
+            {
+                self.exit();
+                return false;
+            }
+        )
+        .def_static(
+            "isActive",
+            &ScratchArenaScope::isActive,
+            R"(
+                Whether a ``ScratchArenaScope`` is active on the calling thread.
+
+                Returns:
+                    Whether the memory of the arena is retained between computations.
+            )"
+        )
+        .def_static(
+            "getCapacity",
+            &ScratchArenaScope::getCapacity,
+            R"(
+                The number of bytes currently held by the scratch arena of the calling thread.
+
+                Returns:
+                    The capacity of the arena, including memory which is retained but not in use.
+            )"
+        );
+}
+
+} // namespace usdex::core::bindings
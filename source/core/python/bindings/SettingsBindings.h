@@ -19,6 +19,8 @@ namespace usdex::core::bindings
 void bindSettings(module& m)
 {
     m.attr("enableTranscodingSetting") = USDEX_ENABLE_TRANSCODING._name;
+    m.attr("validNameCacheSizeSetting") = USDEX_VALID_NAME_CACHE_SIZE._name;
+    m.attr("enableInstrumentationSetting") = USDEX_ENABLE_INSTRUMENTATION._name;
 }
 
 } // namespace usdex::core::bindings
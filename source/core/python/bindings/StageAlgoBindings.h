@@ -6,16 +6,51 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include "LayerAlgoBindings.h"
+
 #include "usdex/pybind/UsdBindings.h"
 
 #include <pybind11/pybind11.h>
 
+#include <memory>
+
 using namespace usdex::core;
 using namespace pybind11;
 
 namespace usdex::core::bindings
 {
 
+// A Python context manager which holds a stage scope between `__enter__` and `__exit__`, rather than for the lifetime of the object
+template <typename ScopeType>
+class PyStageScope
+{
+
+public:
+
+    explicit PyStageScope(UsdStagePtr stage) : m_stage(stage)
+    {
+    }
+
+    void enter()
+    {
+        m_scope = std::make_unique<ScopeType>(m_stage);
+    }
+
+    void exit()
+    {
+        m_scope.reset();
+    }
+
+private:
+
+    UsdStagePtr m_stage;
+    std::unique_ptr<ScopeType> m_scope;
+};
+
+using PyBulkAuthoringScope = PyStageScope<BulkAuthoringScope>;
+using PyEditablePrimLocationScope = PyStageScope<EditablePrimLocationScope>;
+using PySkipUnchangedValuesScope = PyStageScope<SkipUnchangedValuesScope>;
+
 void bindStageAlgo(module& m)
 {
     // The bindings for createStage have been hand rolled in `python/bindings/_StageAlgoBindings.py` due to issues with cleanly passing ownership
@@ -110,7 +145,97 @@ void bindStageAlgo(module& m)
 
             Returns:
                 ``None``
-        )"
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    ::class_<LayerSaveReport>(m, "LayerSaveReport", "The outcome of saving a single layer via ``saveStageWithReport``")
+        .def(init<>())
+        .def_readwrite("identifier", &LayerSaveReport::identifier, "The identifier of the layer")
+        .def_readwrite("saved", &LayerSaveReport::saved, "Whether the layer was saved successfully")
+        .def_readwrite("bytesWritten", &LayerSaveReport::bytesWritten, "The size of the saved layer in bytes, or zero if it could not be determined")
+        .def_readwrite("seconds", &LayerSaveReport::seconds, "The wall time spent saving the layer, in seconds");
+
+    m.def(
+        "saveStageWithReport",
+        &saveStageWithReport,
+        arg("stage"),
+        arg("authoringMetadata") = nullptr,
+        arg("comment") = nullptr,
+        R"(
+            Save the given ``Usd.Stage`` with metadata applied to all dirty layers, saving independent layers concurrently.
+
+            This is equivalent to ``saveStage``, except that dirty layers are serialized concurrently using the OpenUSD ``Work`` library, and a report
+            describing each saved layer is returned. This is beneficial for stages composed of many layers (e.g. those produced via
+            ``createAssetPayload``, ``addAssetLibrary``, and ``addAssetContent``), particularly when saving to network storage.
+
+            Like ``Usd.Stage.Save``, anonymous layers and session layers are not saved.
+
+            Args:
+                stage: The stage to be saved.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored in all dirty layers as the ``Sdf.Layer`` comment.
+
+            Returns:
+                A ``LayerSaveReport`` for each layer that was saved, in the order the layers are used by the stage.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "saveStageAsync",
+        [](UsdStagePtr stage, std::optional<std::string_view> authoringMetadata, std::optional<std::string_view> comment)
+        { return PySaveFuture(saveStageAsync(stage, authoringMetadata, comment)); },
+        arg("stage"),
+        arg("authoringMetadata") = nullptr,
+        arg("comment") = nullptr,
+        R"(
+            Save all dirty layers of the given ``Usd.Stage`` with metadata applied, serializing them on a background thread.
+
+            This is equivalent to ``saveStageWithReport``, except that the contents of each dirty layer are copied on the calling thread and the
+            copies are written in the background. It is safe to continue editing the stage while the save is in flight, and those edits will not
+            be reflected in the saved files.
+
+            All async saves are written by a single background thread in the order they were requested (see ``saveLayerAsync``), while the layers
+            of a single stage are still serialized concurrently.
+
+            Note:
+
+                Unlike ``saveStage``, the layers remain dirty after the save has completed, as they may have been edited in the meantime.
+
+            Args:
+                stage: The stage to be saved.
+                authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    If the "creator" key already exists on a given layer, it will not be overwritten & this data will be ignored.
+                comment: The comment will be authored in all dirty layers as the ``Sdf.Layer`` comment.
+
+            Returns:
+                A ``SaveFuture`` which becomes ready once the save has completed, indicating if all layers were saved successfully.
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "computeStageMemoryReport",
+        &computeStageMemoryReport,
+        arg("stage"),
+        R"(
+            Compute the estimated in-memory and serialized size of the attribute data authored in each layer used by a ``Usd.Stage``.
+
+            This is equivalent to calling ``computeLayerMemoryReport`` for each layer used by the stage, including session, sublayer, reference,
+            payload, and value clip layers, with the layers measured concurrently. See ``computeLayerMemoryReport`` for details.
+
+            Arrays which share storage are identified within each layer, so storage shared between layers is counted once per layer.
+
+            Args:
+                stage: The stage to measure.
+
+            Returns:
+                A ``LayerMemoryReport`` for each layer used by the stage, sorted by identifier. If the stage is invalid, a runtime error is posted
+                and the result is empty.
+        )",
+        call_guard<gil_scoped_release>()
     );
 
     m.def(
@@ -192,6 +317,284 @@ void bindStageAlgo(module& m)
 
         )"
     );
+
+    ::class_<PyBulkAuthoringScope>(
+        m,
+        "BulkAuthoringScope",
+        R"(
+            A context manager that enables the Sdf level authoring mode of the ``define`` functions for a stage.
+
+            By default the ``define`` functions author through ``Usd.Prim`` and ``Usd.Attribute``, so every prim and every attribute results in a
+            ``Usd.Notice.ObjectsChanged`` notice and a recomposition check on the stage.
+
+            While the context is active, the gprim, basis curves, point cloud, light, and camera ``define`` functions instead write ``Sdf.PrimSpec``
+            and ``Sdf.AttributeSpec`` data directly to the current edit target layer of the stage. All specs for a single prim are written within one
+            ``Sdf.ChangeBlock``, so the stage receives a single notice per ``define`` call and recomposes once, before the new prim is returned. The
+            authored layer data is identical whether or not the context is active.
+
+            Asset resolution on the calling thread is also cached while the context is active, so that the textures shared by many materials and
+            the layers referenced by many prims are each resolved once. Assets should not be created, moved, or removed while the context is active.
+
+            The context applies to the calling thread only and may be nested.
+
+            Example:
+
+                .. code-block:: python
+
+                    with usdex.core.BulkAuthoringScope(stage):
+                        for i, point in enumerate(points):
+                            usdex.core.defineSphere(stage, root.GetPath().AppendChild(f"Sphere_{i}"), radius=0.5)
+        )"
+    )
+        .def(init<UsdStagePtr>(), arg("stage"))
+        .def(
+            "__enter__",
+            [](PyBulkAuthoringScope& self) -> PyBulkAuthoringScope&
+            {
+                self.enter();
+                return self;
+            },
+            return_value_policy::reference
+        )
+        .def(
+            "__exit__",
+            [](PyBulkAuthoringScope& self, const object&, const object&, const object&)
+            {
+                self.exit();
+                return false;
+            }
+        )
+        .def_static(
+            "isActive",
+            &BulkAuthoringScope::isActive,
+            arg("stage"),
+            R"(
+                Whether a ``BulkAuthoringScope`` is active for the given stage on the calling thread.
+
+                Parameters:
+                    - **stage** - The stage to consider
+
+                Returns:
+                    Whether the Sdf level authoring mode is enabled.
+            )"
+        );
+
+    ::class_<PyEditablePrimLocationScope>(
+        m,
+        "EditablePrimLocationScope",
+        R"(
+            A context manager that memoizes the ancestor checks of ``isEditablePrimLocation`` for a stage.
+
+            Validating a location requires walking its ancestors to ensure none of them are instances or instance proxies. When many prims are
+            defined below the same parent, the same walk is repeated for every child. While the context is active, the verdict for each parent path
+            is computed once and reused, so only the checks of the proposed location itself are performed per child.
+
+            Cached verdicts are discarded whenever a ``Usd.Notice.ObjectsChanged`` notice from the stage resyncs the parent path or any of its
+            ancestors, so the results are identical whether or not the context is active.
+
+            The context applies to the calling thread only and may be nested. A ``BulkAuthoringScope`` also activates this context for its stage.
+        )"
+    )
+        .def(init<UsdStagePtr>(), arg("stage"))
+        .def(
+            "__enter__",
+            [](PyEditablePrimLocationScope& self) -> PyEditablePrimLocationScope&
+            {
+                self.enter();
+                return self;
+            },
+            return_value_policy::reference
+        )
+        .def(
+            "__exit__",
+            [](PyEditablePrimLocationScope& self, const object&, const object&, const object&)
+            {
+                self.exit();
+                return false;
+            }
+        )
+        .def_static(
+            "isActive",
+            &EditablePrimLocationScope::isActive,
+            arg("stage"),
+            R"(
+                Whether an ``EditablePrimLocationScope`` is active for the given stage on the calling thread.
+
+                Parameters:
+                    - **stage** - The stage to consider
+
+                Returns:
+                    Whether ancestor checks are memoized.
+            )"
+        );
+
+    ::class_<PySkipUnchangedValuesScope>(
+        m,
+        "SkipUnchangedValuesScope",
+        R"(
+            A context manager that skips authoring values which are already authored on the current edit target layer of a stage.
+
+            By default the authoring functions set every value they are given, even when the edit target layer already holds an identical opinion.
+            Re-running e.g. ``definePolyMesh`` on an unchanged mesh therefore re-authors every attribute, which may dirty the layer, send
+            ``Usd.Notice.ObjectsChanged`` notices, and force downstream consumers (e.g. Hydra) to resync the prim.
+
+            While the context is active, the following functions compare each value with the opinion already authored on the edit target layer, at
+            the same time, and skip the write when they match:
+
+                - ``definePolyMesh`` and the gprim ``define`` functions (e.g. ``defineCube``), including their primvars.
+                - ``setLocalTransform``, in all of its forms.
+                - ``definePreviewMaterial``.
+
+            Array values are compared via ``Vt.Array`` equality, which returns immediately when both arrays share the same buffer and otherwise
+            compares their contents. Values of differing types are never considered to match. The authored layer data is identical whether or not
+            the context is active.
+
+            The context applies to the calling thread only and may be nested.
+        )"
+    )
+        .def(init<UsdStagePtr>(), arg("stage"))
+        .def(
+            "__enter__",
+            [](PySkipUnchangedValuesScope& self) -> PySkipUnchangedValuesScope&
+            {
+                self.enter();
+                return self;
+            },
+            return_value_policy::reference
+        )
+        .def(
+            "__exit__",
+            [](PySkipUnchangedValuesScope& self, const object&, const object&, const object&)
+            {
+                self.exit();
+                return false;
+            }
+        )
+        .def_static(
+            "isActive",
+            &SkipUnchangedValuesScope::isActive,
+            arg("stage"),
+            R"(
+                Whether a ``SkipUnchangedValuesScope`` is active for the given stage on the calling thread.
+
+                Parameters:
+                    - **stage** - The stage to consider
+
+                Returns:
+                    Whether unchanged values are skipped.
+            )"
+        );
+
+    ::class_<StagePool>(
+        m,
+        "StagePool",
+        R"(
+            A pool of reusable in-memory stages, which are configured with the same stage metrics, default prim, and authoring metadata.
+
+            Each call to ``createStage`` creates a new root layer and session layer, registers them with the layer registry, authors the stage
+            metrics and default prim, and populates a new ``Usd.Stage``. For long running converter services which process thousands of small
+            assets, this setup is repeated for every asset even though it is identical each time.
+
+            A ``StagePool`` instead holds a set of in-memory stages, configured once with the same metadata which ``configureStage`` authors, in a
+            ``Usd.StageCache``. Each stage is reset to that configuration when it is released back to the pool, and the root layer of a stage is
+            written to its final identifier via ``save``, so no layer is registered with that identifier.
+
+            The pool is thread safe, but each acquired stage must only be authored by one thread at a time. The stages remain valid until they are
+            released to a full pool or the pool is destroyed.
+
+            Example:
+
+                .. code-block:: python
+
+                    pool = usdex.core.StagePool("World", UsdGeom.Tokens.z, UsdGeom.LinearUnits.meters, UsdPhysics.MassUnits.kilograms, metadata)
+                    for asset in assets:
+                        stage = pool.acquire()
+                        convert(asset, stage)
+                        pool.save(stage, asset.identifier)
+                        pool.release(stage)
+        )"
+    )
+        .def(
+            init<const std::string&, const TfToken&, double, double, const std::string&, size_t>(),
+            arg("defaultPrimName"),
+            arg("upAxis"),
+            arg("linearUnits"),
+            arg("massUnits"),
+            arg("authoringMetadata"),
+            arg("capacity") = size_t(8),
+            R"(
+                Create a pool of stages configured with the given metadata.
+
+                The arguments are validated as in ``configureStage``. If they are invalid, a warning is emitted and the pool is invalid.
+
+                Args:
+                    defaultPrimName: Name of the default root prim.
+                    upAxis: The up axis for all the geometry contained in the stages.
+                    linearUnits: The meters per unit for all linear measurements in the stages, eg. ``UsdGeom.LinearUnits.meters``
+                    massUnits: The kilograms per unit for all mass measurements in the stages, eg. ``UsdPhysics.MassUnits.kilograms``
+                    authoringMetadata: The provenance information from the host application. See ``setLayerAuthoringMetadata`` for details.
+                    capacity: The maximum number of idle stages retained by the pool. Stages released while the pool is full are discarded.
+            )"
+        )
+        .def("isValid", &StagePool::isValid, "Whether the pool was configured with valid arguments")
+        .def(
+            "acquire",
+            [](StagePool& self) { return UsdStagePtr(self.acquire()); },
+            R"(
+                Acquire a configured stage from the pool, creating a new stage if no idle stage is available.
+
+                The root layer of the stage is anonymous and holds only the configured metadata and default prim, and the session layer is empty.
+
+                Returns:
+                    The stage, or ``None`` if the pool is invalid.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "release",
+            &StagePool::release,
+            arg("stage"),
+            R"(
+                Release a stage back to the pool, so that it can be acquired again.
+
+                The content of the root layer is replaced with the configured metadata and default prim, the session layer is cleared, and the
+                edit target, load rules, population mask, and muted layers of the stage are reset. The stage must not be used after it has been
+                released.
+
+                Args:
+                    stage: The stage to release, which must have been acquired from this pool.
+
+                Returns:
+                    Whether the stage was released. A runtime error is posted if the stage was not acquired from this pool or was already released.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "save",
+            &StagePool::save,
+            arg("stage"),
+            arg("identifier"),
+            arg("comment") = nullptr,
+            arg("writeOptions") = LayerWriteOptions(),
+            R"(
+                Export the root layer of an acquired stage to its final identifier, with authoring metadata and an optional comment.
+
+                This is equivalent to calling ``exportLayer`` on the root layer of the stage with the authoring metadata of the pool. Opinions
+                authored on the session layer, or on any other layers used by the stage, are not exported.
+
+                Args:
+                    stage: The stage to save, which must have been acquired from this pool.
+                    identifier: The identifier to which the root layer is exported.
+                    comment: The comment will be authored in the exported layer as the ``Sdf.Layer`` comment.
+                    writeOptions: The options which control how the layer is encoded. A warning is emitted if the options are invalid for the
+                        identifier.
+
+                Returns:
+                    A bool indicating if the export was successful.
+            )",
+            call_guard<gil_scoped_release>()
+        )
+        .def("getIdleCount", &StagePool::getIdleCount, "The number of idle stages retained by the pool");
 }
 
 } // namespace usdex::core::bindings
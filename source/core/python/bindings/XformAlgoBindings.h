@@ -126,6 +126,126 @@ void bindXformAlgo(module& m)
         call_guard<gil_scoped_acquire>()
     );
 
+    m.def(
+        "setLocalTransforms",
+        overload_cast<UsdPrim, const std::vector<GfMatrix4d>&, const std::vector<UsdTimeCode>&>(&setLocalTransforms),
+        arg("prim"),
+        arg("matrices"),
+        arg("times"),
+        R"(
+            Set the local transform of a prim from 4x4 matrices at many times.
+
+            This is equivalent to calling ``setLocalTransform`` at each time, but the xformOps are resolved and authored only once.
+
+            Parameters:
+                - **prim** - The prim to set local transforms on.
+                - **matrices** - The matrix value to set at each time.
+                - **times** - Times at which to write the values.
+
+            Returns:
+                A bool indicating if the local transforms were set.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransforms",
+        overload_cast<const std::vector<UsdPrim>&, const std::vector<GfMatrix4d>&, const std::vector<UsdTimeCode>&>(&setLocalTransforms),
+        arg("prims"),
+        arg("matrices"),
+        arg("times"),
+        R"(
+            Set the local transforms of many prims from 4x4 matrices at many times.
+
+            This is equivalent to calling ``setLocalTransform`` for each prim at each time, but is considerably faster for animation.
+            The xformOps of each prim are resolved and authored once, using the first time, then the values for all remaining times are written
+            directly to the current edit target layer within a single ``Sdf.ChangeBlock``.
+
+            The matrices are ordered by prim and then by time, such that the matrix for ``prims[i]`` at ``times[j]`` is
+            ``matrices[i * len(times) + j]``.
+
+            Parameters:
+                - **prims** - The prims to set local transforms on.
+                - **matrices** - The matrix values to set.
+                - **times** - Times at which to write the values.
+
+            Returns:
+                A bool indicating if the local transforms were set.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransforms",
+        overload_cast<
+            UsdPrim,
+            const std::vector<GfVec3d>&,
+            const std::vector<GfQuatf>&,
+            const std::vector<GfVec3f>&,
+            const std::vector<UsdTimeCode>&>(&setLocalTransforms),
+        arg("prim"),
+        arg("translations"),
+        arg("orientations"),
+        arg("scales"),
+        arg("times"),
+        R"(
+            Set the local transform of a prim from common transform components using quaternions for orientation at many times.
+
+            This is equivalent to calling ``setLocalTransform`` at each time, but the xformOps are resolved and authored only once.
+
+            Parameters:
+                - **prim** - The prim to set local transforms on.
+                - **translations** - The translation value to set at each time.
+                - **orientations** - The orientation value to set at each time as a quaternion.
+                - **scales** - The scale value to set at each time.
+                - **times** - Times at which to write the values.
+
+            Returns:
+                A bool indicating if the local transforms were set.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
+    m.def(
+        "setLocalTransforms",
+        overload_cast<
+            const std::vector<UsdPrim>&,
+            const std::vector<GfVec3d>&,
+            const std::vector<GfQuatf>&,
+            const std::vector<GfVec3f>&,
+            const std::vector<UsdTimeCode>&>(&setLocalTransforms),
+        arg("prims"),
+        arg("translations"),
+        arg("orientations"),
+        arg("scales"),
+        arg("times"),
+        R"(
+            Set the local transforms of many prims from common transform components using quaternions for orientation at many times.
+
+            This is equivalent to calling ``setLocalTransform`` for each prim at each time, but is considerably faster for animation.
+            The xformOps of each prim are resolved and authored once, using the first time, then the values for all remaining times are written
+            directly to the current edit target layer within a single ``Sdf.ChangeBlock``.
+
+            The components are ordered by prim and then by time, such that the values for ``prims[i]`` at ``times[j]`` are at index
+            ``i * len(times) + j``.
+
+            Parameters:
+                - **prims** - The prims to set local transforms on.
+                - **translations** - The translation values to set.
+                - **orientations** - The orientation values to set as quaternions.
+                - **scales** - The scale values to set.
+                - **times** - Times at which to write the values.
+
+            Returns:
+                A bool indicating if the local transforms were set.
+
+        )",
+        call_guard<gil_scoped_release>()
+    );
+
     m.def(
         "getLocalTransform",
         overload_cast<const UsdPrim&, UsdTimeCode>(&getLocalTransform),
@@ -516,6 +636,69 @@ void bindXformAlgo(module& m)
 
         )"
     );
+
+    m.def(
+        "computeTransformComponents",
+        [](const std::vector<GfMatrix4d>& matrices)
+        {
+            std::vector<GfVec3d> translations;
+            std::vector<GfVec3d> pivots;
+            std::vector<GfVec3f> rotations;
+            std::vector<GfVec3f> scales;
+            {
+                gil_scoped_release release;
+                computeTransformComponents(matrices, translations, pivots, rotations, scales);
+            }
+            return make_tuple(translations, pivots, rotations, scales);
+        },
+        arg("matrices"),
+        R"(
+            Decompose many 4x4 matrices into common transform components.
+
+            This is equivalent to the decomposition performed by ``getLocalTransformComponents`` when the xformOps of a prim can not be mapped to
+            common transform components, but is considerably faster for large arrays. Matrices composed of only a scale, a rotation, and a
+            translation are factored in closed form, while any other matrix is factored via ``Gf.Transform``.
+
+            The rotations are always decomposed using the ``RotationOrder.eXyz`` rotation order, and the pivots are always zero.
+
+            Parameters:
+                - **matrices** - The matrices to decompose.
+
+            Returns:
+                A tuple of lists of translations, pivots, rotations, and scales.
+
+        )"
+    );
+
+    m.def(
+        "computeTransformComponentsQuat",
+        [](const std::vector<GfMatrix4d>& matrices)
+        {
+            std::vector<GfVec3d> translations;
+            std::vector<GfVec3d> pivots;
+            std::vector<GfQuatf> orientations;
+            std::vector<GfVec3f> scales;
+            {
+                gil_scoped_release release;
+                computeTransformComponentsQuat(matrices, translations, pivots, orientations, scales);
+            }
+            return make_tuple(translations, pivots, orientations, scales);
+        },
+        arg("matrices"),
+        R"(
+            Decompose many 4x4 matrices into common transform components with quaternion orientation.
+
+            This is equivalent to the decomposition performed by ``getLocalTransformComponentsQuat``, but is considerably faster for large arrays.
+            See ``computeTransformComponents`` for details.
+
+            Parameters:
+                - **matrices** - The matrices to decompose.
+
+            Returns:
+                A tuple of lists of translations, pivots, orientations (quaternions), and scales.
+
+        )"
+    );
 }
 
 } // namespace usdex::core::bindings
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file Benchmark.h
+//! @brief A minimal benchmark registry, modeled on Google Benchmark, for measuring the hot paths of OpenUSD Exchange.
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace usdex::benchmark
+{
+
+//! The state of a single benchmark run, passed to each benchmark function.
+//!
+//! Benchmark functions must loop while `keepRunning()` returns true, timing only the work within the loop.
+//! Setup that should not be measured can be excluded using `pauseTiming()` and `resumeTiming()`.
+class State
+{
+public:
+
+    State(int64_t range, double minSeconds, int64_t maxIterations);
+
+    //! The problem size of this run (e.g. the number of elements)
+    int64_t range() const
+    {
+        return m_range;
+    }
+
+    //! Returns true while more iterations are required, starting the timer on the first call
+    bool keepRunning();
+
+    //! Stop the timer, e.g. to exclude per-iteration setup from the measurement
+    void pauseTiming();
+
+    //! Resume the timer after a call to `pauseTiming()`
+    void resumeTiming();
+
+    //! Set the number of items processed per iteration, used to report throughput
+    void setItemsPerIteration(int64_t items)
+    {
+        m_itemsPerIteration = items;
+    }
+
+    //! Set the number of bytes processed per iteration, used to report throughput
+    void setBytesPerIteration(int64_t bytes)
+    {
+        m_bytesPerIteration = bytes;
+    }
+
+    //! Mark this run as skipped, e.g. when the configuration is unsupported
+    void skipWithMessage(const std::string& message)
+    {
+        m_skipMessage = message;
+        m_maxIterations = 0;
+    }
+
+    int64_t iterations() const
+    {
+        return m_iterations;
+    }
+
+    double seconds() const
+    {
+        return m_seconds;
+    }
+
+    int64_t itemsPerIteration() const
+    {
+        return m_itemsPerIteration;
+    }
+
+    int64_t bytesPerIteration() const
+    {
+        return m_bytesPerIteration;
+    }
+
+    const std::string& skipMessage() const
+    {
+        return m_skipMessage;
+    }
+
+private:
+
+    using Clock = std::chrono::steady_clock;
+
+    int64_t m_range;
+    double m_minSeconds;
+    int64_t m_maxIterations;
+    int64_t m_iterations;
+    double m_seconds;
+    bool m_running;
+    bool m_started;
+    Clock::time_point m_start;
+    int64_t m_itemsPerIteration;
+    int64_t m_bytesPerIteration;
+    std::string m_skipMessage;
+};
+
+using BenchmarkFunction = std::function<void(State&)>;
+
+//! A registered benchmark and the problem sizes at which to run it.
+struct Benchmark
+{
+    std::string name;
+    BenchmarkFunction function;
+    std::vector<int64_t> ranges;
+};
+
+//! Get all registered benchmarks, in registration order.
+std::vector<Benchmark>& getBenchmarks();
+
+//! Register a benchmark to run at each of the given problem sizes.
+//!
+//! @returns `true`, so that registration can initialize a static variable
+bool registerBenchmark(const std::string& name, BenchmarkFunction function, std::vector<int64_t> ranges);
+
+//! The problem sizes 1e3, 1e4, 1e5, 1e6, and 1e7
+const std::vector<int64_t>& elementRanges();
+
+//! Prevent the compiler from optimizing away an otherwise unused value
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+    static volatile const void* s_sink;
+    s_sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+} // namespace usdex::benchmark
+
+#define USDEX_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define USDEX_BENCHMARK_CONCAT(a, b) USDEX_BENCHMARK_CONCAT_IMPL(a, b)
+
+//! Register a benchmark function under the given name, to be run at each of the given problem sizes
+#define USDEX_BENCHMARK(name, function, ranges)                                                                                                      \
+    static const bool USDEX_BENCHMARK_CONCAT(s_usdexBenchmark, __LINE__) = usdex::benchmark::registerBenchmark(name, function, ranges)
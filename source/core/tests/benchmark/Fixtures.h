@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file Fixtures.h
+//! @brief Deterministic input data shared by the benchmarks.
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/xform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace usdex::benchmark
+{
+
+//! The topology and points of a grid of quads.
+struct GridMesh
+{
+    pxr::VtIntArray faceVertexCounts;
+    pxr::VtIntArray faceVertexIndices;
+    pxr::VtVec3fArray points;
+};
+
+//! Create a roughly square grid of quads with approximately `numFaces` faces, with some height variation so that normals are not uniform.
+inline GridMesh makeGridMesh(int64_t numFaces)
+{
+    const int64_t width = std::max<int64_t>(1, static_cast<int64_t>(std::sqrt(static_cast<double>(numFaces))));
+    const int64_t height = std::max<int64_t>(1, numFaces / width);
+
+    GridMesh mesh;
+    mesh.points.resize(static_cast<size_t>((width + 1) * (height + 1)));
+    pxr::GfVec3f* points = mesh.points.data();
+    for (int64_t y = 0; y <= height; ++y)
+    {
+        for (int64_t x = 0; x <= width; ++x)
+        {
+            const float z = std::sin(static_cast<float>(x) * 0.1f) * std::cos(static_cast<float>(y) * 0.1f);
+            points[y * (width + 1) + x] = pxr::GfVec3f(static_cast<float>(x), static_cast<float>(y), z);
+        }
+    }
+
+    mesh.faceVertexCounts.assign(static_cast<size_t>(width * height), 4);
+    mesh.faceVertexIndices.resize(static_cast<size_t>(width * height * 4));
+    int* indices = mesh.faceVertexIndices.data();
+    for (int64_t y = 0; y < height; ++y)
+    {
+        for (int64_t x = 0; x < width; ++x)
+        {
+            const int v = static_cast<int>(y * (width + 1) + x);
+            *indices++ = v;
+            *indices++ = v + 1;
+            *indices++ = v + static_cast<int>(width) + 2;
+            *indices++ = v + static_cast<int>(width) + 1;
+        }
+    }
+    return mesh;
+}
+
+//! Create `numPoints` points on a deterministic spiral.
+inline pxr::VtVec3fArray makePoints(int64_t numPoints)
+{
+    pxr::VtVec3fArray result(static_cast<size_t>(numPoints));
+    pxr::GfVec3f* points = result.data();
+    for (int64_t i = 0; i < numPoints; ++i)
+    {
+        const float t = static_cast<float>(i) * 0.01f;
+        points[i] = pxr::GfVec3f(std::cos(t) * t, std::sin(t) * t, t);
+    }
+    return result;
+}
+
+//! Create an in-memory stage with a default prim, to author benchmark data below.
+inline pxr::UsdStageRefPtr makeStage()
+{
+    pxr::UsdStageRefPtr stage = pxr::UsdStage::CreateInMemory();
+    stage->SetDefaultPrim(pxr::UsdGeomXform::Define(stage, pxr::SdfPath("/World")).GetPrim());
+    return stage;
+}
+
+} // namespace usdex::benchmark
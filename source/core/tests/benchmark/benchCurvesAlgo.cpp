@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <usdex/core/CurvesAlgo.h>
+
+#include <pxr/usd/usdGeom/tokens.h>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+// The number of points in each curve
+static constexpr int s_curveLength = 10;
+
+template <bool Cubic>
+void defineBasisCurves(State& state)
+{
+    const VtVec3fArray points = makePoints(state.range());
+    const VtIntArray curveVertexCounts(points.size() / s_curveLength, s_curveLength);
+    const VtVec3fArray curvePoints(points.begin(), points.begin() + curveVertexCounts.size() * s_curveLength);
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        UsdStageRefPtr stage = makeStage();
+        state.resumeTiming();
+
+        if constexpr (Cubic)
+        {
+            doNotOptimize(
+                usdex::core::defineCubicBasisCurves(stage, SdfPath("/World/Curves"), curveVertexCounts, curvePoints, UsdGeomTokens->bspline)
+            );
+        }
+        else
+        {
+            doNotOptimize(usdex::core::defineLinearBasisCurves(stage, SdfPath("/World/Curves"), curveVertexCounts, curvePoints));
+        }
+
+        state.pauseTiming();
+        stage.Reset();
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(static_cast<int64_t>(curvePoints.size()));
+}
+
+} // namespace
+
+USDEX_BENCHMARK("defineLinearBasisCurves", defineBasisCurves<false>, elementRanges());
+USDEX_BENCHMARK("defineCubicBasisCurves", defineBasisCurves<true>, elementRanges());
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <usdex/core/MeshAlgo.h>
+
+#include <pxr/usd/usdGeom/tokens.h>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+void definePolyMesh(State& state)
+{
+    const GridMesh mesh = makeGridMesh(state.range());
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        UsdStageRefPtr stage = makeStage();
+        state.resumeTiming();
+
+        doNotOptimize(usdex::core::definePolyMesh(stage, SdfPath("/World/Mesh"), mesh.faceVertexCounts, mesh.faceVertexIndices, mesh.points));
+
+        // exclude the stage destruction from the measurement
+        state.pauseTiming();
+        stage.Reset();
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(static_cast<int64_t>(mesh.faceVertexCounts.size()));
+}
+
+template <const TfToken& (*Interpolation)()>
+void computeMeshNormals(State& state)
+{
+    const GridMesh mesh = makeGridMesh(state.range());
+    while (state.keepRunning())
+    {
+        doNotOptimize(usdex::core::computeMeshNormals(mesh.faceVertexCounts, mesh.faceVertexIndices, mesh.points, Interpolation()));
+    }
+    state.setItemsPerIteration(static_cast<int64_t>(mesh.faceVertexCounts.size()));
+}
+
+const TfToken& constant()
+{
+    return UsdGeomTokens->constant;
+}
+
+const TfToken& uniform()
+{
+    return UsdGeomTokens->uniform;
+}
+
+const TfToken& vertex()
+{
+    return UsdGeomTokens->vertex;
+}
+
+const TfToken& faceVarying()
+{
+    return UsdGeomTokens->faceVarying;
+}
+
+} // namespace
+
+USDEX_BENCHMARK("definePolyMesh", definePolyMesh, elementRanges());
+USDEX_BENCHMARK("computeMeshNormals/constant", computeMeshNormals<constant>, elementRanges());
+USDEX_BENCHMARK("computeMeshNormals/uniform", computeMeshNormals<uniform>, elementRanges());
+USDEX_BENCHMARK("computeMeshNormals/vertex", computeMeshNormals<vertex>, elementRanges());
+USDEX_BENCHMARK("computeMeshNormals/faceVarying", computeMeshNormals<faceVarying>, elementRanges());
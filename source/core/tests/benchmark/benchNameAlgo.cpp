@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <usdex/core/NameAlgo.h>
+
+#include <pxr/base/tf/stringUtils.h>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+// Producing names for many siblings with a handful of preferred names, as is typical of imported hierarchies
+std::vector<std::string> makeCollidingNames(int64_t count)
+{
+    static const std::vector<std::string> s_names = { "Mesh", "Cube", "1 part", "Böden", "Material" };
+    std::vector<std::string> result;
+    result.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i)
+    {
+        result.push_back(s_names[i % s_names.size()]);
+    }
+    return result;
+}
+
+// Producing names that are all unique, most of which require transcoding
+std::vector<std::string> makeUniqueNames(int64_t count)
+{
+    std::vector<std::string> result;
+    result.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i)
+    {
+        result.push_back(TfStringPrintf("%lld part", static_cast<long long>(i)));
+    }
+    return result;
+}
+
+// Producing names from Japanese and Chinese part names, as is typical of CAD assemblies, all of which require transcoding
+std::vector<std::string> makeCjkNames(int64_t count)
+{
+    static const std::vector<std::string> s_names = { "カーテンウォール", "部品", "螺丝钉", "ボルト締結" };
+    std::vector<std::string> result;
+    result.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i)
+    {
+        result.push_back(TfStringPrintf("%s %lld", s_names[i % s_names.size()].c_str(), static_cast<long long>(i)));
+    }
+    return result;
+}
+
+void getValidPrimNames(State& state)
+{
+    const std::vector<std::string> names = makeUniqueNames(state.range());
+    while (state.keepRunning())
+    {
+        doNotOptimize(usdex::core::getValidPrimNames(names));
+    }
+    state.setItemsPerIteration(state.range());
+}
+
+void getValidPrimNamesCjk(State& state)
+{
+    const std::vector<std::string> names = makeCjkNames(state.range());
+    while (state.keepRunning())
+    {
+        doNotOptimize(usdex::core::getValidPrimNames(names));
+    }
+    state.setItemsPerIteration(state.range());
+}
+
+void getValidChildNames(State& state)
+{
+    const std::vector<std::string> names = makeCollidingNames(state.range());
+    UsdStageRefPtr stage = makeStage();
+    const UsdPrim parent = stage->GetDefaultPrim();
+    while (state.keepRunning())
+    {
+        doNotOptimize(usdex::core::getValidChildNames(parent, names));
+    }
+    state.setItemsPerIteration(state.range());
+}
+
+// Producing names for many siblings which all prefer the same name as an existing sibling, as is typical of a flat bill of materials.
+// Comparing the ranges shows how it scales, as an algorithm which probes the suffixes sequentially for each name would be quadratic.
+void getValidChildNamesSameName(State& state)
+{
+    std::vector<std::string> names(static_cast<size_t>(state.range()), "Part");
+    // interleave a requested name which collides with the generated suffixes
+    names[names.size() / 2] = "Part_1";
+    UsdStageRefPtr stage = makeStage();
+    const UsdPrim parent = stage->GetDefaultPrim();
+    stage->DefinePrim(parent.GetPath().AppendChild(TfToken("Part")));
+    while (state.keepRunning())
+    {
+        doNotOptimize(usdex::core::getValidChildNames(parent, names));
+    }
+    state.setItemsPerIteration(state.range());
+}
+
+void nameCacheGetPrimNames(State& state)
+{
+    const std::vector<std::string> names = makeCollidingNames(state.range());
+    const SdfPath parent("/World");
+    while (state.keepRunning())
+    {
+        usdex::core::NameCache cache;
+        doNotOptimize(cache.getPrimNames(parent, names));
+    }
+    state.setItemsPerIteration(state.range());
+}
+
+} // namespace
+
+// Name generation is rarely used at larger scales, as the resulting hierarchy would be flattened to a single parent
+USDEX_BENCHMARK("getValidPrimNames", getValidPrimNames, std::vector<int64_t>({ 1000, 10000, 100000 }));
+USDEX_BENCHMARK("getValidPrimNames/cjk", getValidPrimNamesCjk, std::vector<int64_t>({ 1000, 10000, 100000 }));
+USDEX_BENCHMARK("getValidChildNames/collisions", getValidChildNames, std::vector<int64_t>({ 1000, 10000, 100000 }));
+USDEX_BENCHMARK("getValidChildNames/sameName", getValidChildNamesSameName, std::vector<int64_t>({ 1000, 10000, 100000 }));
+USDEX_BENCHMARK("NameCache::getPrimNames/collisions", nameCacheGetPrimNames, std::vector<int64_t>({ 1000, 10000, 100000 }));
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <usdex/core/PointsAlgo.h>
+
+#include <numeric>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+template <bool WithIds>
+void definePointCloud(State& state)
+{
+    const VtVec3fArray points = makePoints(state.range());
+    std::optional<const VtInt64Array> ids;
+    if constexpr (WithIds)
+    {
+        VtInt64Array values(points.size());
+        std::iota(values.begin(), values.end(), 0);
+        ids.emplace(values);
+    }
+
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        UsdStageRefPtr stage = makeStage();
+        state.resumeTiming();
+
+        doNotOptimize(usdex::core::definePointCloud(stage, SdfPath("/World/Points"), points, ids));
+
+        state.pauseTiming();
+        stage.Reset();
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(static_cast<int64_t>(points.size()));
+}
+
+} // namespace
+
+USDEX_BENCHMARK("definePointCloud", definePointCloud<false>, elementRanges());
+USDEX_BENCHMARK("definePointCloud/ids", definePointCloud<true>, elementRanges());
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <usdex/core/PrimvarData.h>
+
+#include <pxr/usd/usdGeom/tokens.h>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+// The number of unique values, so that the input is highly redundant, as is typical of faceVarying uvs & normals
+static constexpr int64_t s_numUnique = 1024;
+
+// Construct a primvar from shared values and indices, as converters do for each uv & normal set
+void construct(State& state)
+{
+    const VtVec3fArray values = makePoints(s_numUnique);
+    VtIntArray indices(static_cast<size_t>(state.range()));
+    for (int64_t i = 0; i < state.range(); ++i)
+    {
+        indices[i] = static_cast<int>((i * 7919) % s_numUnique);
+    }
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(usdex::core::Vec3fPrimvarData(UsdGeomTokens->faceVarying, values, indices));
+    }
+    state.setItemsPerIteration(state.range());
+}
+
+void index(State& state)
+{
+    const VtVec3fArray unique = makePoints(s_numUnique);
+    VtVec3fArray values(static_cast<size_t>(state.range()));
+    for (int64_t i = 0; i < state.range(); ++i)
+    {
+        values[i] = unique[(i * 7919) % s_numUnique];
+    }
+
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        usdex::core::Vec3fPrimvarData primvar(UsdGeomTokens->faceVarying, values);
+        state.resumeTiming();
+
+        doNotOptimize(primvar.index());
+    }
+    state.setItemsPerIteration(state.range());
+    state.setBytesPerIteration(state.range() * static_cast<int64_t>(sizeof(GfVec3f)));
+}
+
+void indexWithTolerance(State& state)
+{
+    const VtVec3fArray values = makePoints(state.range());
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        usdex::core::Vec3fPrimvarData primvar(UsdGeomTokens->faceVarying, values);
+        state.resumeTiming();
+
+        doNotOptimize(primvar.index(0.5f));
+    }
+    state.setItemsPerIteration(state.range());
+    state.setBytesPerIteration(state.range() * static_cast<int64_t>(sizeof(GfVec3f)));
+}
+
+} // namespace
+
+USDEX_BENCHMARK("PrimvarData::construct", construct, elementRanges());
+USDEX_BENCHMARK("PrimvarData::index", index, elementRanges());
+USDEX_BENCHMARK("PrimvarData::index/tolerance", indexWithTolerance, elementRanges());
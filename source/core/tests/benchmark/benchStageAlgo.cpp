@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <usdex/core/MeshAlgo.h>
+#include <usdex/core/StageAlgo.h>
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/fileUtils.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+template <const char* Extension>
+void saveStage(State& state)
+{
+    const std::string dir = ArchMakeTmpSubdir(ArchGetTmpDir(), "usdex_benchmark");
+    const std::string identifier = TfStringCatPaths(dir, TfStringPrintf("saveStage.%s", Extension));
+    const GridMesh mesh = makeGridMesh(state.range());
+
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        UsdStageRefPtr stage = usdex::core::createStage(identifier, "World", UsdGeomTokens->y, 0.01, "usdex benchmark");
+        if (!stage)
+        {
+            state.skipWithMessage("Unable to create the stage");
+            break;
+        }
+        usdex::core::definePolyMesh(stage, SdfPath("/World/Mesh"), mesh.faceVertexCounts, mesh.faceVertexIndices, mesh.points);
+        state.resumeTiming();
+
+        usdex::core::saveStage(stage);
+
+        state.pauseTiming();
+        stage.Reset();
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(static_cast<int64_t>(mesh.faceVertexCounts.size()));
+
+    TfRmTree(dir);
+}
+
+constexpr char s_usda[] = "usda";
+constexpr char s_usdc[] = "usdc";
+
+} // namespace
+
+USDEX_BENCHMARK("saveStage/usda", saveStage<s_usda>, std::vector<int64_t>({ 1000, 10000, 100000, 1000000 }));
+USDEX_BENCHMARK("saveStage/usdc", saveStage<s_usdc>, elementRanges());
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <usdex/core/XformAlgo.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/rotation.h>
+#include <pxr/base/tf/stringUtils.h>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+// Author a static transform on each of many prims
+void setLocalTransform(State& state)
+{
+    const GfMatrix4d matrix = GfMatrix4d().SetTranslate(GfVec3d(1.0, 2.0, 3.0)) * GfMatrix4d().SetRotate(GfRotation(GfVec3d(0, 0, 1), 45.0));
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        UsdStageRefPtr stage = makeStage();
+        std::vector<UsdPrim> prims;
+        prims.reserve(static_cast<size_t>(state.range()));
+        for (int64_t i = 0; i < state.range(); ++i)
+        {
+            prims.push_back(usdex::core::defineXform(stage, SdfPath(TfStringPrintf("/World/Xform_%lld", static_cast<long long>(i)))).GetPrim());
+        }
+        state.resumeTiming();
+
+        for (const UsdPrim& prim : prims)
+        {
+            doNotOptimize(usdex::core::setLocalTransform(prim, matrix));
+        }
+
+        state.pauseTiming();
+        prims.clear();
+        stage.Reset();
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(state.range());
+}
+
+// Author an animated transform on a single prim, at many times
+void setLocalTransforms(State& state)
+{
+    std::vector<GfMatrix4d> matrices;
+    std::vector<UsdTimeCode> times;
+    for (int64_t i = 0; i < state.range(); ++i)
+    {
+        matrices.push_back(GfMatrix4d().SetTranslate(GfVec3d(static_cast<double>(i), 0.0, 0.0)));
+        times.push_back(UsdTimeCode(static_cast<double>(i)));
+    }
+
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        UsdStageRefPtr stage = makeStage();
+        UsdPrim prim = usdex::core::defineXform(stage, SdfPath("/World/Xform")).GetPrim();
+        state.resumeTiming();
+
+        doNotOptimize(usdex::core::setLocalTransforms(prim, matrices, times));
+
+        state.pauseTiming();
+        stage.Reset();
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(state.range());
+}
+
+} // namespace
+
+// Each transform is authored on a distinct prim, so the largest sizes are dominated by prim creation
+USDEX_BENCHMARK("setLocalTransform", setLocalTransform, std::vector<int64_t>({ 1000, 10000, 100000 }));
+USDEX_BENCHMARK("setLocalTransforms/timeSamples", setLocalTransforms, std::vector<int64_t>({ 1000, 10000, 100000, 1000000 }));
@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Benchmark.h"
+
+#include <usdex/core/Core.h>
+#include <usdex/core/Diagnostics.h>
+
+#include <pxr/base/arch/systemInfo.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/threadLimits.h>
+
+#include <cxxopts.hpp>
+
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <regex>
+
+using namespace usdex::benchmark;
+using namespace pxr;
+
+namespace
+{
+
+struct Result
+{
+    std::string name;
+    int64_t iterations;
+    double seconds;
+    int64_t itemsPerIteration;
+    int64_t bytesPerIteration;
+    std::string skipMessage;
+};
+
+std::string escapeJson(const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+    for (char c : value)
+    {
+        switch (c)
+        {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            default:
+                result += c;
+        }
+    }
+    return result;
+}
+
+// Write results using the Google Benchmark JSON schema, so that existing tooling can compare versions
+void writeJson(std::ostream& out, const std::vector<Result>& results)
+{
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    out << "{\n";
+    out << "  \"context\": {\n";
+    out << "    \"date\": \"" << date << "\",\n";
+    out << "    \"executable\": \"" << escapeJson(ArchGetExecutablePath()) << "\",\n";
+    out << "    \"num_cpus\": " << WorkGetPhysicalConcurrencyLimit() << ",\n";
+    out << "    \"num_threads\": " << WorkGetConcurrencyLimit() << ",\n";
+    out << "    \"library_version\": \"" << escapeJson(usdex::core::version()) << "\",\n";
+    out << "    \"library_build_version\": \"" << escapeJson(usdex::core::buildVersion()) << "\"\n";
+    out << "  },\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& result = results[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\n";
+        out << "      \"name\": \"" << escapeJson(result.name) << "\",\n";
+        out << "      \"run_type\": \"iteration\",\n";
+        if (!result.skipMessage.empty())
+        {
+            out << "      \"error_occurred\": true,\n";
+            out << "      \"error_message\": \"" << escapeJson(result.skipMessage) << "\"\n";
+            out << "    }";
+            continue;
+        }
+        const double realTime = result.iterations ? result.seconds * 1e9 / static_cast<double>(result.iterations) : 0.0;
+        out << "      \"iterations\": " << result.iterations << ",\n";
+        out << "      \"real_time\": " << TfStringPrintf("%.3f", realTime) << ",\n";
+        out << "      \"time_unit\": \"ns\"";
+        if (result.itemsPerIteration > 0 && result.seconds > 0.0)
+        {
+            const double items = static_cast<double>(result.itemsPerIteration * result.iterations) / result.seconds;
+            out << ",\n      \"items_per_second\": " << TfStringPrintf("%.3f", items);
+        }
+        if (result.bytesPerIteration > 0 && result.seconds > 0.0)
+        {
+            const double bytes = static_cast<double>(result.bytesPerIteration * result.iterations) / result.seconds;
+            out << ",\n      \"bytes_per_second\": " << TfStringPrintf("%.3f", bytes);
+        }
+        out << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace
+
+usdex::benchmark::State::State(int64_t range, double minSeconds, int64_t maxIterations)
+    : m_range(range),
+      m_minSeconds(minSeconds),
+      m_maxIterations(maxIterations),
+      m_iterations(0),
+      m_seconds(0.0),
+      m_running(false),
+      m_started(false),
+      m_itemsPerIteration(0),
+      m_bytesPerIteration(0)
+{
+}
+
+bool usdex::benchmark::State::keepRunning()
+{
+    if (!m_started)
+    {
+        m_started = true;
+        resumeTiming();
+    }
+    else
+    {
+        ++m_iterations;
+    }
+
+    // Always run at least one iteration, then continue until the minimum time has elapsed
+    if (m_iterations < m_maxIterations)
+    {
+        const double elapsed = m_seconds + (m_running ? std::chrono::duration<double>(Clock::now() - m_start).count() : 0.0);
+        if (m_iterations == 0 || elapsed < m_minSeconds)
+        {
+            return true;
+        }
+    }
+
+    pauseTiming();
+    return false;
+}
+
+void usdex::benchmark::State::pauseTiming()
+{
+    if (m_running)
+    {
+        m_seconds += std::chrono::duration<double>(Clock::now() - m_start).count();
+        m_running = false;
+    }
+}
+
+void usdex::benchmark::State::resumeTiming()
+{
+    if (!m_running)
+    {
+        m_start = Clock::now();
+        m_running = true;
+    }
+}
+
+std::vector<Benchmark>& usdex::benchmark::getBenchmarks()
+{
+    static std::vector<Benchmark> s_benchmarks;
+    return s_benchmarks;
+}
+
+bool usdex::benchmark::registerBenchmark(const std::string& name, BenchmarkFunction function, std::vector<int64_t> ranges)
+{
+    getBenchmarks().push_back(Benchmark{ name, std::move(function), std::move(ranges) });
+    return true;
+}
+
+const std::vector<int64_t>& usdex::benchmark::elementRanges()
+{
+    static const std::vector<int64_t> s_ranges = { 1000, 10000, 100000, 1000000, 10000000 };
+    return s_ranges;
+}
+
+int main(int argc, char** argv)
+{
+    cxxopts::Options options("benchmark_usdex_core", "Performance benchmarks for the OpenUSD Exchange core library");
+    // clang-format off
+    options.add_options()
+        ("f,filter", "Only run benchmarks whose name matches this regular expression", cxxopts::value<std::string>()->default_value(".*"))
+        ("j,json", "Write results to this file using the Google Benchmark JSON schema", cxxopts::value<std::string>()->default_value(""))
+        ("t,min-time", "The minimum time to run each benchmark, in seconds", cxxopts::value<double>()->default_value("0.5"))
+        ("r,max-range", "Skip problem sizes larger than this", cxxopts::value<int64_t>()->default_value("10000000"))
+        ("l,list", "List the benchmarks without running them")
+        ("h,help", "Print usage");
+    // clang-format on
+
+    int64_t maxRange = 0;
+    double minSeconds = 0.0;
+    std::string jsonPath;
+    std::regex filter;
+    bool list = false;
+    try
+    {
+        cxxopts::ParseResult parsed = options.parse(argc, argv);
+        if (parsed.count("help"))
+        {
+            std::cout << options.help() << std::endl;
+            return 0;
+        }
+        filter = std::regex(parsed["filter"].as<std::string>());
+        jsonPath = parsed["json"].as<std::string>();
+        minSeconds = parsed["min-time"].as<double>();
+        maxRange = parsed["max-range"].as<int64_t>();
+        list = parsed.count("list") > 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    // activate the delegate to affect OpenUSD diagnostic logs
+    usdex::core::activateDiagnosticsDelegate();
+    usdex::core::setDiagnosticsLevel(usdex::core::DiagnosticsLevel::eError);
+
+    std::vector<Result> results;
+    for (const Benchmark& benchmark : getBenchmarks())
+    {
+        for (int64_t range : benchmark.ranges)
+        {
+            const std::string name = TfStringPrintf("%s/%lld", benchmark.name.c_str(), static_cast<long long>(range));
+            if (range > maxRange || !std::regex_search(name, filter))
+            {
+                continue;
+            }
+            if (list)
+            {
+                std::cout << name << std::endl;
+                continue;
+            }
+
+            State state(range, minSeconds, std::numeric_limits<int64_t>::max());
+            benchmark.function(state);
+            results.push_back(
+                Result{ name, state.iterations(), state.seconds(), state.itemsPerIteration(), state.bytesPerIteration(), state.skipMessage() }
+            );
+
+            const Result& result = results.back();
+            if (!result.skipMessage.empty())
+            {
+                std::cout << TfStringPrintf("%-64s skipped: %s", name.c_str(), result.skipMessage.c_str()) << std::endl;
+            }
+            else
+            {
+                const double perIteration = result.iterations ? result.seconds * 1e3 / static_cast<double>(result.iterations) : 0.0;
+                const long long iterations = static_cast<long long>(result.iterations);
+                std::cout << TfStringPrintf("%-64s %12.3f ms %10lld iterations", name.c_str(), perIteration, iterations) << std::endl;
+            }
+        }
+    }
+
+    if (!jsonPath.empty())
+    {
+        std::ofstream out(jsonPath);
+        if (!out)
+        {
+            std::cerr << "Unable to write benchmark results to \"" << jsonPath << "\"" << std::endl;
+            return 1;
+        }
+        writeJson(out, results);
+    }
+
+    return 0;
+}
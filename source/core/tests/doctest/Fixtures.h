@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+//! @file Fixtures.h
+//! @brief Deterministic input data shared by the doctests.
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+
+#include <cmath>
+
+namespace usdex::test
+{
+
+//! Append a grid of `gridSize` by `gridSize` quads, with a wave of `amplitude` and `frequency` so that the normals have many distinct values.
+inline void appendWavyGrid(
+    int gridSize,
+    float frequency,
+    float amplitude,
+    pxr::VtIntArray* faceVertexCounts,
+    pxr::VtIntArray* faceVertexIndices,
+    pxr::VtVec3fArray* points
+)
+{
+    for (int y = 0; y <= gridSize; ++y)
+    {
+        for (int x = 0; x <= gridSize; ++x)
+        {
+            const float fx = static_cast<float>(x);
+            const float fy = static_cast<float>(y);
+            points->push_back(pxr::GfVec3f(fx, fy, std::sin(fx * frequency) * std::cos(fy * frequency) * amplitude));
+        }
+    }
+    for (int y = 0; y < gridSize; ++y)
+    {
+        for (int x = 0; x < gridSize; ++x)
+        {
+            const int corner = y * (gridSize + 1) + x;
+            faceVertexCounts->push_back(4);
+            faceVertexIndices->push_back(corner);
+            faceVertexIndices->push_back(corner + 1);
+            faceVertexIndices->push_back(corner + gridSize + 2);
+            faceVertexIndices->push_back(corner + gridSize + 1);
+        }
+    }
+}
+
+} // namespace usdex::test
@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/test/ScopedDiagnosticChecker.h>
+
+#include "Fixtures.h"
+
+#include <usdex/core/Diagnostics.h>
+#include <usdex/core/MaterialAlgo.h>
+#include <usdex/core/MeshAlgo.h>
+#include <usdex/core/NameAlgo.h>
+#include <usdex/core/PhysicsJointAlgo.h>
+#include <usdex/core/PointsAlgo.h>
+#include <usdex/core/StageAlgo.h>
+#include <usdex/core/XformAlgo.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace usdex::core;
+using namespace usdex::test;
+using namespace pxr;
+
+namespace
+{
+
+// Small enough that each stage is authored quickly, but large enough that the authoring of the stages overlaps in time
+static constexpr int s_gridSize = 32;
+static constexpr size_t s_partCount = 64;
+static constexpr size_t s_iterations = 4;
+
+// Author meshes, materials, joints, and names on an independent stage, then serialize its root layer. Returns an empty string on failure.
+//
+// This runs on many threads at once, so it reports failures via its result rather than via doctest assertions or diagnostics.
+std::string authorStage()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    if (!configureStage(stage, "World", UsdGeomTokens->z, 0.01, "usdex cpp tests: concurrency"))
+    {
+        return std::string();
+    }
+    UsdPrim world = defineXform(stage, SdfPath("/World")).GetPrim();
+    UsdPrim materials = defineScope(world, "Materials").GetPrim();
+
+    // Materials with 8 bit textures (which are authored as raw or sRGB depending on the file extension) and primvar readers of each role
+    UsdShadeMaterial material = definePreviewMaterial(materials, "Textured", GfVec3f(0.5f, 0.5f, 0.5f));
+    if (!addDiffuseTextureToPreviewMaterial(material, SdfAssetPath("./textures/color.png")) ||
+        !addNormalTextureToPreviewMaterial(material, SdfAssetPath("./textures/normal.jpg")) ||
+        !addOrmTextureToPreviewMaterial(material, SdfAssetPath("./textures/orm.tga")))
+    {
+        return std::string();
+    }
+    UsdShadeMaterial painted = definePreviewMaterial(materials, "Painted", GfVec3f(1.0f, 0.0f, 0.0f));
+    if (!addPrimvarShaderToPreviewMaterial(painted, "diffuseColor", "paintColor", VtValue(GfVec3f(1.0f, 0.0f, 0.0f))) ||
+        !addPrimvarShaderToPreviewMaterial(painted, "opacity", "paintOpacity", VtValue(1.0f)))
+    {
+        return std::string();
+    }
+
+    // A mesh with computed normals, bound to the textured material
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    VtVec3fArray points;
+    appendWavyGrid(s_gridSize, 0.3f, 1.0f, &faceVertexCounts, &faceVertexIndices, &points);
+    Vec3fPrimvarData normals = computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeomTokens->vertex);
+    UsdGeomMesh grid = definePolyMesh(world, "Grid", faceVertexCounts, faceVertexIndices, points, normals);
+    if (!grid || !bindMaterial(grid.GetPrim(), material))
+    {
+        return std::string();
+    }
+
+    // Names which collide once made valid, so that each stage relies on the naming rules and its own cache
+    NameCache nameCache;
+    UsdPrim previous;
+    for (size_t i = 0; i < s_partCount; ++i)
+    {
+        const std::string name = TfStringPrintf("part %zu%s", i % 10, (i % 2 == 0) ? "?" : "!");
+        const TfToken validName = nameCache.getPrimName(world, name);
+        if (validName.IsEmpty() || getValidPrimName(name).IsEmpty())
+        {
+            return std::string();
+        }
+
+        // Rigid bodies connected by fixed joints, each body being a small mesh bound to the painted material
+        UsdPrim body = defineXform(world, validName.GetString(), GfTransform().SetTranslation(GfVec3d(double(i), 0.0, 0.0))).GetPrim();
+        UsdGeomMesh mesh = definePolyMesh(
+            body,
+            "Mesh",
+            VtIntArray{ 4 },
+            VtIntArray{ 0, 1, 2, 3 },
+            VtVec3fArray{ GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(1, 1, 0), GfVec3f(0, 1, 0) }
+        );
+        if (!mesh || !bindMaterial(mesh.GetPrim(), painted))
+        {
+            return std::string();
+        }
+        if (previous)
+        {
+            const JointFrame frame = { JointFrame::Space::Body1, GfVec3d(0.0), GfQuatd::GetIdentity() };
+            if (!definePhysicsFixedJoint(body, "Joint", previous, body, frame))
+            {
+                return std::string();
+            }
+        }
+        previous = body;
+    }
+
+    // A point cloud, which validates its widths and normals against the supported interpolations
+    FloatPrimvarData widths(UsdGeomTokens->vertex, VtFloatArray(points.size(), 0.1f));
+    if (!definePointCloud(world, "Points", points, std::nullopt, widths, normals))
+    {
+        return std::string();
+    }
+
+    std::string result;
+    stage->GetRootLayer()->ExportToString(&result);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Authoring on independent stages concurrently produces the same layers as authoring serially")
+{
+    ScopedDiagnosticChecker check;
+
+    const std::string expected = ::authorStage();
+    REQUIRE(!expected.empty());
+
+    // Use more threads than the host has cores when necessary, so that the authoring of the stages is always interleaved
+    const size_t threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 8);
+
+    // Change the diagnostics settings while the stages are authored, as an application might from its UI thread
+    const bool wasActive = isDiagnosticsDelegateActive();
+    const DiagnosticsLevel previousLevel = getDiagnosticsLevel();
+    const DiagnosticsOutputStream previousStream = getDiagnosticsOutputStream();
+    std::atomic<bool> authoring(true);
+    std::thread settings(
+        [&authoring, wasActive]()
+        {
+            for (size_t i = 0; authoring.load(); ++i)
+            {
+                setDiagnosticsLevel((i % 2 == 0) ? DiagnosticsLevel::eError : DiagnosticsLevel::eWarning);
+                setDiagnosticsOutputStream((i % 2 == 0) ? DiagnosticsOutputStream::eNone : DiagnosticsOutputStream::eStderr);
+                if (wasActive)
+                {
+                    activateDiagnosticsDelegate();
+                }
+                std::this_thread::yield();
+            }
+        }
+    );
+
+    std::vector<std::vector<std::string>> results(threadCount);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back(
+            [&results, t]()
+            {
+                for (size_t i = 0; i < s_iterations; ++i)
+                {
+                    results[t].push_back(::authorStage());
+                }
+            }
+        );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    authoring.store(false);
+    settings.join();
+
+    setDiagnosticsLevel(previousLevel);
+    setDiagnosticsOutputStream(previousStream);
+
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        CAPTURE(t);
+        REQUIRE(results[t].size() == s_iterations);
+        for (const std::string& result : results[t])
+        {
+            CHECK(result == expected);
+        }
+    }
+}
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/test/FilesystemUtils.h>
+#include <usdex/test/ScopedDiagnosticChecker.h>
+
+#include "Fixtures.h"
+
+#include <usdex/core/AssetStructure.h>
+#include <usdex/core/MeshAlgo.h>
+#include <usdex/core/NameAlgo.h>
+#include <usdex/core/PointsAlgo.h>
+#include <usdex/core/StageAlgo.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+
+using namespace usdex::core;
+using namespace usdex::test;
+using namespace pxr;
+
+namespace
+{
+
+// Large enough that every engine takes its parallel path (the smallest parallel threshold of the engines exercised here is 1 << 16 values)
+static constexpr int s_gridSize = 300;
+static constexpr size_t s_meshCount = 1024;
+
+// Restore the concurrency limit in effect before the test, regardless of how the test exits
+class ScopedConcurrencyLimit
+{
+
+public:
+
+    explicit ScopedConcurrencyLimit(unsigned limit) : m_previous(WorkGetConcurrencyLimit())
+    {
+        WorkSetConcurrencyLimit(limit);
+    }
+
+    ~ScopedConcurrencyLimit()
+    {
+        WorkSetConcurrencyLimit(m_previous);
+    }
+
+private:
+
+    unsigned m_previous;
+};
+
+// Author a stage which exercises the parallel engines (normals, indexing, naming, extents, and batched defines) then serialize its root layer
+std::string authorLayer(unsigned concurrencyLimit, const std::string& identifier)
+{
+    ScopedConcurrencyLimit limit(concurrencyLimit);
+
+    UsdStageRefPtr stage = UsdStage::CreateNew(identifier);
+    REQUIRE(configureStage(stage, "World", UsdGeomTokens->z, 0.01, "usdex cpp tests: determinism"));
+    UsdPrim world = defineScope(stage, SdfPath("/World")).GetPrim();
+
+    // Crease aware normals and indexed uvs & display colors of a large mesh
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    VtVec3fArray points;
+    appendWavyGrid(s_gridSize, 0.1f, 4.0f, &faceVertexCounts, &faceVertexIndices, &points);
+    Vec3fPrimvarData normals = computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeomTokens->faceVarying, GfVec3f(0, 0, 1), 30.0f);
+    VtVec2fArray uvValues(faceVertexIndices.size());
+    for (size_t i = 0; i < faceVertexIndices.size(); ++i)
+    {
+        const GfVec3f& point = points[faceVertexIndices[i]];
+        uvValues[i] = GfVec2f(point[0] / s_gridSize, point[1] / s_gridSize);
+    }
+    Vec2fPrimvarData uvs(UsdGeomTokens->faceVarying, uvValues);
+    CHECK(uvs.index());
+    VtVec3fArray colorValues(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        colorValues[i] = GfVec3f(float(i % 7) / 7.0f, float(i % 5) / 5.0f, float(i % 3) / 3.0f);
+    }
+    Vec3fPrimvarData displayColor(UsdGeomTokens->vertex, colorValues);
+    CHECK(displayColor.index());
+    CHECK(definePolyMesh(stage, SdfPath("/World/Grid"), faceVertexCounts, faceVertexIndices, points, normals, uvs, displayColor));
+
+    // Names which collide once made valid, so that the uniqueness suffixes depend on the order of the names rather than the order of evaluation
+    std::vector<std::string> names;
+    for (size_t i = 0; i < s_meshCount; ++i)
+    {
+        names.push_back(TfStringPrintf("part %zu%s", i % 100, (i % 3 == 0) ? "?" : "!"));
+    }
+    const TfTokenVector validNames = getValidPrimNames(names);
+    REQUIRE(validNames.size() == s_meshCount);
+
+    // Many small meshes validated concurrently and defined as a batch
+    std::vector<PolyMeshData> meshes(s_meshCount);
+    for (size_t i = 0; i < s_meshCount; ++i)
+    {
+        meshes[i].path = world.GetPath().AppendChild(validNames[i]);
+        meshes[i].faceVertexCounts = VtIntArray{ 4 };
+        meshes[i].faceVertexIndices = VtIntArray{ 0, 1, 2, 3 };
+        meshes[i].points = VtVec3fArray{ GfVec3f(0, 0, float(i)), GfVec3f(1, 0, float(i)), GfVec3f(1, 1, float(i)), GfVec3f(0, 1, float(i)) };
+    }
+    CHECK(definePolyMeshes(stage, meshes).size() == s_meshCount);
+
+    // A large point cloud, with a parallel extent computation and indexed widths
+    VtFloatArray widthValues(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        widthValues[i] = 0.1f * float(i % 4 + 1);
+    }
+    FloatPrimvarData widths(UsdGeomTokens->vertex, widthValues);
+    CHECK(widths.index());
+    CHECK(definePointCloud(stage, SdfPath("/World/Points"), points, std::nullopt, widths));
+
+    stage->GetRootLayer()->Save();
+
+    std::ifstream file(identifier, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+TEST_CASE("Parallel authoring produces identical layers regardless of thread count")
+{
+    ScopedDiagnosticChecker check;
+    ScopedTmpDir tmpDir;
+
+    // Use more threads than the host has cores when necessary, so that work is always split between threads
+    const unsigned parallelLimit = std::max(WorkGetPhysicalConcurrencyLimit(), 8u);
+
+    for (const char* extension : { "usda", "usdc" })
+    {
+        CAPTURE(extension);
+        const std::string serial = ::authorLayer(1, TfStringPrintf("%s/serial.%s", tmpDir.getPath(), extension));
+        const std::string parallel = ::authorLayer(parallelLimit, TfStringPrintf("%s/parallel.%s", tmpDir.getPath(), extension));
+        REQUIRE(!serial.empty());
+        CHECK(serial == parallel);
+    }
+}
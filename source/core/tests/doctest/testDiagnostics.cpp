@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/core/Diagnostics.h>
+
+#include <pxr/base/tf/diagnostic.h>
+
+#include <doctest/doctest.h>
+
+using namespace usdex::core;
+using namespace pxr;
+
+namespace
+{
+
+// A diagnostic code which is not a TfDiagnosticType, as libraries may post with TF_WARN(code, ...)
+enum class CustomCode
+{
+    eCustom = 1000,
+};
+
+} // namespace
+
+TEST_CASE("Diagnostics with custom codes are counted by their category")
+{
+    // The counts include filtered diagnostics, so the warning does not need to be printed
+    const DiagnosticsLevel level = getDiagnosticsLevel();
+    setDiagnosticsLevel(DiagnosticsLevel::eError);
+    resetDiagnosticsCounts();
+
+    TF_WARN(CustomCode::eCustom, "A warning with a custom code");
+
+    const DiagnosticsCounts counts = getDiagnosticsCounts();
+    setDiagnosticsLevel(level);
+    REQUIRE(counts.byType.count(TF_DIAGNOSTIC_WARNING_TYPE) == 1);
+    CHECK(counts.byType.at(TF_DIAGNOSTIC_WARNING_TYPE) == 1);
+    CHECK(counts.byType.size() == 1);
+}
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/core/NameAlgo.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+
+using namespace pxr;
+
+namespace
+{
+
+static constexpr size_t s_numThreads = 8;
+
+} // namespace
+
+TEST_CASE("ConcurrentNameCache unique names for a shared parent")
+{
+    usdex::core::ConcurrentNameCache cache;
+    const SdfPath parent("/World");
+    const std::vector<std::string> names(500, "Part");
+
+    // Every thread requests the same names for the same parent
+    std::vector<TfTokenVector> results(s_numThreads);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < s_numThreads; ++i)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                for (size_t j = 0; j < names.size(); j += 50)
+                {
+                    const TfTokenVector batch = cache.getPrimNames(parent, std::vector<std::string>(names.begin() + j, names.begin() + j + 50));
+                    results[i].insert(results[i].end(), batch.begin(), batch.end());
+                }
+            }
+        );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // No name may be handed out twice
+    std::set<TfToken> unique;
+    for (const TfTokenVector& result : results)
+    {
+        CHECK(result.size() == names.size());
+        unique.insert(result.begin(), result.end());
+    }
+    CHECK(unique.size() == s_numThreads * names.size());
+    CHECK(unique.count(TfToken("Part")) == 1);
+
+    // Properties are cached independently of prims
+    CHECK(cache.getPropertyName(parent, "Part") == TfToken("Part"));
+}
+
+TEST_CASE("ConcurrentNameCache reservation is atomic")
+{
+    usdex::core::ConcurrentNameCache cache;
+    const SdfPath parent("/World");
+
+    // Exactly one thread may reserve each name
+    std::atomic<size_t> reserved = 0;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < s_numThreads; ++i)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (size_t j = 0; j < 100; ++j)
+                {
+                    if (cache.reservePrimName(parent, TfToken(TfStringPrintf("Reserved_%zu", j))))
+                    {
+                        ++reserved;
+                    }
+                }
+            }
+        );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(reserved == 100);
+
+    // Reserved names are not returned by subsequent requests
+    CHECK(cache.getPrimName(parent, "Reserved_0") == TfToken("Reserved_0_1"));
+
+    // Clearing the parent releases the reservations
+    cache.clearPrimNames(parent);
+    CHECK(cache.reservePrimName(parent, TfToken("Reserved_0")));
+}
+
+TEST_CASE("ConcurrentNameCache independent parents")
+{
+    usdex::core::ConcurrentNameCache cache;
+
+    // Each thread populates its own parent, so every thread receives the preferred names
+    std::vector<TfTokenVector> results(s_numThreads);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < s_numThreads; ++i)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                const SdfPath parent(TfStringPrintf("/World/Parent_%zu", i));
+                results[i] = cache.getPrimNames(parent, { "A", "B", "A" });
+            }
+        );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const TfTokenVector& result : results)
+    {
+        CHECK(result == TfTokenVector{ TfToken("A"), TfToken("B"), TfToken("A_1") });
+    }
+}
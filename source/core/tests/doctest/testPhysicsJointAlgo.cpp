@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/test/ScopedDiagnosticChecker.h>
+
+#include <usdex/core/PhysicsJointAlgo.h>
+#include <usdex/core/XformAlgo.h>
+
+#include <pxr/usd/usdGeom/xformCache.h>
+#include <pxr/usd/usdPhysics/tokens.h>
+
+#include <doctest/doctest.h>
+
+using namespace usdex::test;
+using namespace pxr;
+
+TEST_CASE("connectPhysicsJoint and alignPhysicsJoint with an xform cache")
+{
+    ScopedDiagnosticChecker check;
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim parent = usdex::core::defineXform(stage, SdfPath("/Parent"), GfTransform().SetTranslation(GfVec3d(1.0, 2.0, 3.0))).GetPrim();
+    UsdPrim body0 = usdex::core::defineXform(parent, "Body0", GfTransform().SetTranslation(GfVec3d(0.0, 1.0, 0.0))).GetPrim();
+    UsdPrim body1 = usdex::core::defineXform(parent, "Body1", GfTransform().SetTranslation(GfVec3d(0.0, -1.0, 0.0))).GetPrim();
+    const usdex::core::JointFrame frame = { usdex::core::JointFrame::Space::World, GfVec3d(1.0, 2.0, 3.0), GfQuatd::GetIdentity() };
+    const GfVec3f axis(0.0f, 0.0f, 1.0f);
+
+    UsdPhysicsRevoluteJoint expected = usdex::core::definePhysicsRevoluteJoint(parent, "Expected", UsdPrim(), body1, frame);
+    UsdPhysicsRevoluteJoint cached = usdex::core::definePhysicsRevoluteJoint(parent, "Cached", UsdPrim(), body1, frame);
+    REQUIRE(expected);
+    REQUIRE(cached);
+
+    // The cache is shared by both calls, so the transforms of the bodies and their parent are computed once
+    UsdGeomXformCache xformCache;
+    usdex::core::connectPhysicsJoint(expected, body0, body1, frame, axis);
+    usdex::core::connectPhysicsJoint(cached, body0, body1, frame, axis, xformCache);
+    usdex::core::alignPhysicsJoint(cached, frame, axis, xformCache);
+
+    SdfPathVector cachedTargets, expectedTargets;
+    cached.GetBody0Rel().GetTargets(&cachedTargets);
+    expected.GetBody0Rel().GetTargets(&expectedTargets);
+    CHECK(cachedTargets == expectedTargets);
+    CHECK(cached.GetAxisAttr().Get<TfToken>() == expected.GetAxisAttr().Get<TfToken>());
+    for (const TfToken& name : { UsdPhysicsTokens->physicsLocalPos0, UsdPhysicsTokens->physicsLocalPos1 })
+    {
+        CHECK(cached.GetPrim().GetAttribute(name).Get<GfVec3f>() == expected.GetPrim().GetAttribute(name).Get<GfVec3f>());
+    }
+    for (const TfToken& name : { UsdPhysicsTokens->physicsLocalRot0, UsdPhysicsTokens->physicsLocalRot1 })
+    {
+        CHECK(cached.GetPrim().GetAttribute(name).Get<GfQuatf>() == expected.GetPrim().GetAttribute(name).Get<GfQuatf>());
+    }
+}
@@ -13,6 +13,7 @@
 #include <doctest/doctest.h>
 
 #include <optional>
+#include <vector>
 
 using namespace usdex::core;
 using namespace usdex::test;
@@ -270,6 +271,109 @@ TEST_CASE("PrimvarData Inequality")
     CHECK(original != diffElemSize);
 }
 
+TEST_CASE("PrimvarData Hash")
+{
+    ScopedDiagnosticChecker check;
+
+    VtFloatArray values = { -1.0, 0.0, 1.5 };
+    VtIntArray indices = { 0, 1, 2 };
+    FloatPrimvarData a(UsdGeomTokens->vertex, values, indices);
+
+    // equal data hashes equally, including zeros of differing sign
+    FloatPrimvarData b(UsdGeomTokens->vertex, VtFloatArray{ -1.0, -0.0, 1.5 }, VtIntArray{ 0, 1, 2 });
+    CHECK(a.hash() == b.hash());
+    CHECK(a == b);
+
+    // the hash is carried by copies
+    FloatPrimvarData c = a;
+    CHECK(c.hash() == a.hash());
+
+    // differing hashes are unequal
+    FloatPrimvarData diffValues(UsdGeomTokens->vertex, VtFloatArray{ -1.0, 0.5, 1.5 }, indices);
+    CHECK(diffValues.hash() != a.hash());
+    CHECK(a != diffValues);
+    FloatPrimvarData noIndices(UsdGeomTokens->vertex, values);
+    CHECK(noIndices.hash() != a.hash());
+    CHECK(a != noIndices);
+
+    // re-indexing invalidates the hash
+    FloatPrimvarData d(UsdGeomTokens->vertex, VtFloatArray{ 1.0, 1.0, 2.0 });
+    const size_t original = d.hash();
+    CHECK(d.index());
+    CHECK(d.hash() != original);
+    CHECK(d == FloatPrimvarData(UsdGeomTokens->vertex, VtFloatArray{ 1.0, 2.0 }, VtIntArray{ 0, 0, 1 }));
+    CHECK(d.hash() == FloatPrimvarData(UsdGeomTokens->vertex, VtFloatArray{ 1.0, 2.0 }, VtIntArray{ 0, 0, 1 }).hash());
+
+    // moving clears the hash of the moved from object
+    FloatPrimvarData e = std::move(c);
+    CHECK(e.hash() == a.hash());
+    CHECK(c.values().empty());
+    CHECK(c.hash() != a.hash());
+}
+
+TEST_CASE("PrimvarData Compact Indices")
+{
+    ScopedDiagnosticChecker check;
+
+    VtFloatArray values = { -1.0, 0.5, 1.5 };
+    VtIntArray indices = { 0, 1, 2, 2, 1, 0 };
+    const FloatPrimvarData original(UsdGeomTokens->faceVarying, values, indices);
+    FloatPrimvarData compact = original;
+    const size_t hash = compact.hash();
+    CHECK(compact.isValid());
+    CHECK(compact.compactIndices());
+    CHECK(compact.hasIndices());
+    CHECK(compact.hasCompactIndices());
+    CHECK(compact.effectiveSize() == 6);
+    CHECK(compact.isValid());
+
+    // the content is unchanged
+    CHECK(compact == original);
+    CHECK(original == compact);
+    CHECK(compact.hash() == hash);
+    CHECK(FloatPrimvarData(compact).hash() == hash);
+    CHECK(compact.indices() == indices);
+    CHECK(!compact.compactIndices());
+
+    // compact indices compare across representations
+    FloatPrimvarData differentIndices(UsdGeomTokens->faceVarying, values, VtIntArray{ 0, 1, 2, 2, 1, 1 });
+    CHECK(compact != differentIndices);
+    CHECK(differentIndices.compactIndices());
+    CHECK(compact != differentIndices);
+
+    // 16 bit indices compare equal to 8 bit indices addressing the same values
+    VtFloatArray manyValues(300, 1.0f);
+    manyValues[299] = 2.0f;
+    FloatPrimvarData wide(UsdGeomTokens->vertex, manyValues, VtIntArray{ 0, 299 });
+    FloatPrimvarData narrow(UsdGeomTokens->vertex, manyValues, VtIntArray{ 0, 299 });
+    CHECK(wide.compactIndices());
+    CHECK(narrow == wide);
+
+    // nothing to compact, and out of range indices can not be compacted
+    FloatPrimvarData nonIndexed(UsdGeomTokens->vertex, values);
+    CHECK(!nonIndexed.compactIndices());
+    FloatPrimvarData outOfRange(UsdGeomTokens->vertex, values, VtIntArray{ 0, 3 });
+    CHECK(!outOfRange.compactIndices());
+    CHECK(!outOfRange.hasCompactIndices());
+
+    // indexing restores VtIntArray indices
+    FloatPrimvarData duplicates(UsdGeomTokens->vertex, VtFloatArray{ 1.0, 1.0, 2.0, 2.0 }, VtIntArray{ 0, 1, 2, 3 });
+    CHECK(duplicates.compactIndices());
+    CHECK(duplicates.index());
+    CHECK(!duplicates.hasCompactIndices());
+    VtIntArray expectedIndices = { 0, 0, 1, 1 };
+    CHECK(duplicates.indices() == expectedIndices);
+
+    // compact indices are widened when authoring
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdGeomPrimvarsAPI primvarsApi(UsdGeomScope::Define(stage, SdfPath("/Scope")).GetPrim());
+    UsdGeomPrimvar primvar = primvarsApi.CreatePrimvar(TfToken("test"), SdfValueTypeNames->FloatArray);
+    FloatPrimvarData authored(UsdGeomTokens->faceVarying, values, indices);
+    CHECK(authored.compactIndices());
+    CHECK(authored.setPrimvar(primvar));
+    CHECK(FloatPrimvarData::getPrimvarData(primvar) == original);
+}
+
 TEST_CASE("PrimvarData Copy Constructor")
 {
     ScopedDiagnosticChecker check;
@@ -336,6 +440,38 @@ TEST_CASE("PrimvarData Moves")
     CHECK(!c.has_value());
 }
 
+TEST_CASE("PrimvarData Move Constructors")
+{
+    ScopedDiagnosticChecker check;
+
+    VtFloatArray values = { -1.0, 0.5, 1.5 };
+    VtIntArray indices = { 0, 1, 2 };
+    const float* valuesData = values.cdata();
+    const int* indicesData = indices.cdata();
+
+    // The arrays are moved into the PrimvarData, so it holds the only reference to their buffers
+    FloatPrimvarData flat(UsdGeomTokens->vertex, VtFloatArray(values));
+    CHECK(flat.values().IsIdentical(values));
+
+    FloatPrimvarData indexed(UsdGeomTokens->vertex, std::move(values), std::move(indices));
+    CHECK(values.empty());
+    CHECK(indices.empty());
+    CHECK(indexed.values().cdata() == valuesData);
+    CHECK(indexed.indices().cdata() == indicesData);
+    CHECK(indexed.isValid());
+
+    // A validated PrimvarData that is moved from is no longer valid, as its arrays are empty
+    FloatPrimvarData moved = std::move(indexed);
+    CHECK(moved.isValid());
+    CHECK(moved.values().cdata() == valuesData);
+    CHECK(!indexed.isValid());
+
+    // Copies share the arrays, so they remain valid
+    FloatPrimvarData copied = moved;
+    CHECK(copied.isValid());
+    CHECK(copied.isIdentical(moved));
+}
+
 TEST_CASE("PrimvarData getPrimvarData")
 {
     ScopedDiagnosticChecker check;
@@ -556,3 +692,139 @@ TEST_CASE("PrimvarData Time Samples")
         CHECK(sample.elementSize() == -1);
     }
 }
+
+TEST_CASE("PrimvarView Strided Values")
+{
+    ScopedDiagnosticChecker check;
+
+    // Interleaved vertex data owned by the caller
+    struct Vertex
+    {
+        GfVec3f position;
+        GfVec2f uv;
+    };
+    std::vector<Vertex> vertices = {
+        { GfVec3f(0.0f), GfVec2f(0.0f, 0.0f) },
+        { GfVec3f(1.0f), GfVec2f(1.0f, 0.0f) },
+        { GfVec3f(2.0f), GfVec2f(0.0f, 0.0f) },
+        { GfVec3f(3.0f), GfVec2f(1.0f, 0.0f) },
+    };
+
+    Vec2fPrimvarView uvs(UsdGeomTokens->vertex, &vertices[0].uv, vertices.size(), sizeof(Vertex));
+    CHECK(uvs.isValid());
+    CHECK(uvs.size() == vertices.size());
+    CHECK(uvs.stride() == sizeof(Vertex));
+    CHECK(!uvs.hasIndices());
+    CHECK(uvs.indices() == nullptr);
+    CHECK(uvs.effectiveSize() == 4);
+    CHECK(uvs.value(3) == GfVec2f(1.0f, 0.0f));
+
+    // Copies match the viewed values
+    VtVec2fArray expected = { GfVec2f(0.0f, 0.0f), GfVec2f(1.0f, 0.0f), GfVec2f(0.0f, 0.0f), GfVec2f(1.0f, 0.0f) };
+    CHECK(uvs.copyValues() == expected);
+    Vec2fPrimvarData data = uvs.toPrimvarData();
+    CHECK(data == Vec2fPrimvarData(UsdGeomTokens->vertex, expected));
+
+    // Contiguous values are copied the same way
+    std::vector<float> widths = { 0.5f, 1.0f, 1.5f };
+    std::vector<int> indices = { 2, 1, 0, 1 };
+    FloatPrimvarView contiguous(UsdGeomTokens->vertex, widths.data(), widths.size(), sizeof(float), indices.data(), indices.size());
+    CHECK(contiguous.isValid());
+    CHECK(contiguous.hasIndices());
+    CHECK(contiguous.effectiveSize() == 4);
+    CHECK(contiguous.toPrimvarData() == FloatPrimvarData(UsdGeomTokens->vertex, VtFloatArray{ 0.5f, 1.0f, 1.5f }, VtIntArray{ 2, 1, 0, 1 }));
+
+    // Invalid views
+    CHECK(!Vec2fPrimvarView(UsdGeomTokens->vertex, nullptr, 4).isValid());
+    CHECK(!Vec2fPrimvarView(UsdGeomTokens->vertex, &vertices[0].uv, 0, sizeof(Vertex)).isValid());
+    CHECK(!Vec2fPrimvarView(TfToken("cubic"), &vertices[0].uv, vertices.size(), sizeof(Vertex)).isValid());
+    CHECK(!Vec2fPrimvarView(UsdGeomTokens->vertex, &vertices[0].uv, vertices.size(), sizeof(float)).isValid());
+    CHECK(!Vec2fPrimvarView(UsdGeomTokens->vertex, &vertices[0].uv, vertices.size(), sizeof(Vertex) + 1).isValid());
+    std::vector<int> badIndices = { 0, 3 };
+    CHECK(!FloatPrimvarView(UsdGeomTokens->vertex, widths.data(), widths.size(), sizeof(float), badIndices.data(), badIndices.size()).isValid());
+}
+
+TEST_CASE("PrimvarView Index")
+{
+    ScopedDiagnosticChecker check;
+
+    std::vector<float> duplicates = { 1.0f, 2.0f, 1.0f, 3.0f, 2.0f, 1.0f };
+    FloatPrimvarView view(UsdGeomTokens->faceVarying, duplicates.data(), duplicates.size());
+    FloatPrimvarData indexed = view.index();
+    CHECK(indexed.isValid());
+    CHECK(indexed.hasIndices());
+    CHECK(indexed.values() == VtFloatArray{ 1.0f, 2.0f, 3.0f });
+    CHECK(indexed.indices() == VtIntArray{ 0, 1, 0, 2, 1, 0 });
+
+    // The result matches indexing a copy of the data
+    FloatPrimvarData copy = view.toPrimvarData();
+    CHECK(copy.index());
+    CHECK(indexed == copy);
+
+    // Existing indices are composed with the new indices
+    std::vector<int> indices = { 5, 4, 3, 2, 1, 0 };
+    FloatPrimvarView indexedView(UsdGeomTokens->faceVarying, duplicates.data(), duplicates.size(), sizeof(float), indices.data(), indices.size());
+    copy = indexedView.toPrimvarData();
+    CHECK(copy.index());
+    CHECK(indexedView.index() == copy);
+
+    // Unique values remain unindexed
+    std::vector<float> unique = { 1.0f, 2.0f, 3.0f };
+    FloatPrimvarData unchanged = FloatPrimvarView(UsdGeomTokens->vertex, unique.data(), unique.size()).index();
+    CHECK(!unchanged.hasIndices());
+    CHECK(unchanged.values() == VtFloatArray{ 1.0f, 2.0f, 3.0f });
+
+    // Data with an element size cannot be indexed
+    FloatPrimvarView elements(UsdGeomTokens->vertex, duplicates.data(), duplicates.size(), sizeof(float), 2);
+    {
+        ScopedDiagnosticChecker checkErrors({ { TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to index PrimvarView due to element size.*" } });
+        FloatPrimvarData result = elements.index();
+        CHECK(!result.hasIndices());
+        CHECK(result.elementSize() == 2);
+    }
+
+    // Data with out of range indices cannot be indexed
+    std::vector<int> badIndices = { 0, 7 };
+    FloatPrimvarView badView(UsdGeomTokens->vertex, duplicates.data(), duplicates.size(), sizeof(float), badIndices.data(), badIndices.size());
+    {
+        ScopedDiagnosticChecker checkErrors(
+            { { TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to index PrimvarView due to existing indices outside the range of existing values" } }
+        );
+        CHECK(badView.index().indices() == VtIntArray{ 0, 7 });
+    }
+}
+
+TEST_CASE("PrimvarView Set Primvar")
+{
+    ScopedDiagnosticChecker check;
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdGeomScope scope = UsdGeomScope::Define(stage, SdfPath("/Prim"));
+    UsdGeomPrimvarsAPI primvarsApi(scope.GetPrim());
+    UsdGeomPrimvar primvar = primvarsApi.CreatePrimvar(TfToken("view"), SdfValueTypeNames->Float3Array, UsdGeomTokens->vertex);
+    CHECK(primvar);
+
+    std::vector<float> interleaved = { 0.0f, 1.0f, 2.0f, -1.0f, 3.0f, 4.0f, 5.0f, -1.0f };
+    std::vector<int> indices = { 1, 0, 1 };
+    Vec3fPrimvarView view(
+        UsdGeomTokens->vertex,
+        reinterpret_cast<const GfVec3f*>(interleaved.data()),
+        2,
+        4 * sizeof(float),
+        indices.data(),
+        indices.size()
+    );
+    CHECK(view.isValid());
+    CHECK(view.setPrimvar(primvar, 1.0));
+
+    CHECK(primvar.GetInterpolation() == UsdGeomTokens->vertex);
+    VtVec3fArray authoredValues;
+    primvar.Get(&authoredValues, 1.0);
+    CHECK(authoredValues == VtVec3fArray{ GfVec3f(0.0f, 1.0f, 2.0f), GfVec3f(3.0f, 4.0f, 5.0f) });
+    VtIntArray authoredIndices;
+    primvar.GetIndices(&authoredIndices, 1.0);
+    CHECK(authoredIndices == VtIntArray{ 1, 0, 1 });
+
+    // The authored data round trips
+    CHECK(Vec3fPrimvarData::getPrimvarData(primvar, 1.0) == view.toPrimvarData());
+}
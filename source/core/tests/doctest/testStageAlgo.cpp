@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -11,6 +11,7 @@
 #include <usdex/core/StageAlgo.h>
 #include <usdex/core/Version.h>
 
+#include <pxr/base/tf/errorMark.h>
 #include <pxr/base/vt/dictionary.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdGeom/metrics.h>
@@ -19,6 +20,10 @@
 
 #include <doctest/doctest.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace usdex::test;
 using namespace pxr;
 
@@ -306,3 +311,115 @@ TEST_CASE("createStage fileFormatArgs")
     CHECK(usdex::core::hasLayerAuthoringMetadata(stage->GetRootLayer()));
     stage = nullptr;
 }
+
+TEST_CASE("createUnsavedStage writeOptions")
+{
+    usdex::test::ScopedTmpDir tmpDir;
+    const std::string defaultPrimName = "Root";
+    const TfToken& upAxis = UsdGeomTokens->y;
+    const double linearUnits = UsdGeomLinearUnits::meters;
+    const double massUnits = UsdPhysicsMassUnits::kilograms;
+    const std::string authoringMetadata = ::getAuthoringMetadata();
+
+    // The write options select the encoding of a .usd root layer, which is preserved when the saved layer is read back
+    for (const char* encoding : { "usda", "usdc" })
+    {
+        CAPTURE(encoding);
+        const std::string identifier = TfStringPrintf("%s/unsaved_%s.usd", tmpDir.getPath(), encoding);
+        UsdStageRefPtr stage = usdex::core::createUnsavedStage(
+            identifier,
+            defaultPrimName,
+            upAxis,
+            linearUnits,
+            massUnits,
+            authoringMetadata,
+            usdex::core::LayerWriteOptions{ TfToken(encoding) }
+        );
+        REQUIRE(stage != nullptr);
+        CHECK(usdex::core::getUsdLayerEncoding(stage->GetRootLayer()) == encoding);
+        REQUIRE(stage->GetRootLayer()->Save());
+        stage = nullptr;
+
+        SdfLayerRefPtr saved = SdfLayer::OpenAsAnonymous(identifier);
+        REQUIRE(saved != nullptr);
+        CHECK(usdex::core::getUsdLayerEncoding(saved) == encoding);
+        CHECK(usdex::core::hasLayerAuthoringMetadata(saved));
+    }
+
+    // Conflicting write options will result in an unsuccessful stage creation
+    {
+        ScopedDiagnosticChecker check({ { TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid write options.*" } });
+        const std::string identifier = TfStringPrintf("%s/conflicting.usda", tmpDir.getPath());
+        UsdStageRefPtr stage = usdex::core::createUnsavedStage(
+            identifier,
+            defaultPrimName,
+            upAxis,
+            linearUnits,
+            massUnits,
+            authoringMetadata,
+            usdex::core::LayerWriteOptions{ TfToken("usdc") }
+        );
+        CHECK(stage == nullptr);
+        CHECK(SdfLayer::Find(identifier) == nullptr);
+    }
+}
+
+TEST_CASE("StagePool release from concurrent threads")
+{
+    ScopedDiagnosticChecker check;
+
+    usdex::core::StagePool pool("Root", UsdGeomTokens->y, UsdGeomLinearUnits::meters, UsdPhysicsMassUnits::kilograms, ::getAuthoringMetadata());
+    REQUIRE(pool.isValid());
+
+    // Release the same stage from two threads at once, many times over, so that the releases overlap
+    for (size_t i = 0; i < 100; ++i)
+    {
+        CAPTURE(i);
+        UsdStageRefPtr stage = pool.acquire();
+        REQUIRE(stage != nullptr);
+        stage->DefinePrim(SdfPath("/Root/Child"));
+
+        std::atomic<bool> start(false);
+        bool released[2] = { false, false };
+        bool errored[2] = { false, false };
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < 2; ++t)
+        {
+            threads.emplace_back(
+                [&, t]()
+                {
+                    while (!start.load())
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    // The rejected release posts an error on its own thread, which is dismissed after it is recorded
+                    TfErrorMark mark;
+                    released[t] = pool.release(stage);
+                    errored[t] = !mark.IsClean();
+                    mark.Clear();
+                }
+            );
+        }
+        start.store(true);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Only one release succeeds, so the stage is idle once
+        CHECK(released[0] != released[1]);
+        CHECK(errored[0] == released[1]);
+        CHECK(errored[1] == released[0]);
+        CHECK(pool.getIdleCount() == 1);
+    }
+
+    // Stages acquired subsequently are distinct
+    UsdStageRefPtr first = pool.acquire();
+    UsdStageRefPtr second = pool.acquire();
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+    CHECK(first != second);
+    CHECK(!first->GetPrimAtPath(SdfPath("/Root/Child")));
+    CHECK(pool.getIdleCount() == 0);
+}
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "Transcoding.h"
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/unicodeUtils.h>
+
+#include <doctest/doctest.h>
+
+#include <string>
+#include <vector>
+
+using namespace usdex::core::detail;
+using namespace pxr;
+
+TEST_CASE("XID classification matches OpenUSD for the Basic Multilingual Plane")
+{
+    // Only the first mismatch of each property is reported, rather than asserting each of the 65536 code points
+    size_t startMismatches = 0;
+    size_t continueMismatches = 0;
+    uint32_t firstStartMismatch = 0;
+    uint32_t firstContinueMismatch = 0;
+    for (uint32_t codePoint = 0; codePoint < 0x10000; ++codePoint)
+    {
+        if (isXidStart(codePoint) != TfIsUtf8CodePointXidStart(codePoint) && startMismatches++ == 0)
+        {
+            firstStartMismatch = codePoint;
+        }
+        if (isXidContinue(codePoint) != TfIsUtf8CodePointXidContinue(codePoint) && continueMismatches++ == 0)
+        {
+            firstContinueMismatch = codePoint;
+        }
+    }
+    const std::string mismatches =
+        TfStringPrintf("The first mismatches are U+%04X (XID_Start) and U+%04X (XID_Continue)", firstStartMismatch, firstContinueMismatch);
+    INFO(mismatches);
+    CHECK(startMismatches == 0);
+    CHECK(continueMismatches == 0);
+
+    // Code points beyond the Basic Multilingual Plane defer to OpenUSD
+    for (uint32_t codePoint : { 0x10000u, 0x20000u, 0x2A6DFu, 0x10FFFFu })
+    {
+        CHECK(isXidStart(codePoint) == TfIsUtf8CodePointXidStart(codePoint));
+        CHECK(isXidContinue(codePoint) == TfIsUtf8CodePointXidContinue(codePoint));
+    }
+}
+
+TEST_CASE("CJK names round trip in the UTF8_XID format")
+{
+    const std::string nihongo = "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e";
+    const std::string namae = "\xe5\x90\x8d\xe5\x89\x8d";
+    const std::string tesuto = "\xe3\x83\x86\xe3\x82\xb9\xe3\x83\x88";
+
+    // Names composed of XID characters are already valid, so they are returned unchanged
+    for (const std::string& name : { nihongo, namae + "_" + tesuto, tesuto + "2" })
+    {
+        CHECK(encodeIdentifier(name, TranscodingFormat::UTF8_XID) == name);
+    }
+
+    // Other names are encoded, retaining their XID characters, and decode to the original name
+    const std::vector<std::string> names = { nihongo + " " + namae, "2" + tesuto, namae + "-" + nihongo + "!", "model " + tesuto };
+    for (const std::string& name : names)
+    {
+        const std::string encoded = encodeIdentifier(name, TranscodingFormat::UTF8_XID);
+        REQUIRE(!encoded.empty());
+        CHECK(encoded != name);
+        CHECK(decodeIdentifier(encoded) == name);
+
+        // The ASCII format encodes the same names without any of their CJK characters
+        const std::string ascii = encodeIdentifier(name, TranscodingFormat::ASCII);
+        CHECK(ascii.size() > 0);
+        CHECK(isASCIIIdentifier(ascii));
+        CHECK(decodeIdentifier(ascii) == name);
+    }
+    CHECK(encodeIdentifier(nihongo + " " + namae, TranscodingFormat::UTF8_XID).find(nihongo) != std::string::npos);
+}
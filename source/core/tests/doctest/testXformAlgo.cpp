@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <usdex/test/ScopedDiagnosticChecker.h>
+
+#include <usdex/core/XformAlgo.h>
+
+#include <pxr/base/gf/rotation.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+
+#include <doctest/doctest.h>
+
+using namespace usdex::test;
+using namespace pxr;
+
+TEST_CASE("getLocalTransform with an xform cache")
+{
+    ScopedDiagnosticChecker check;
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdGeomXform xform = usdex::core::defineXform(stage, SdfPath("/Xform"));
+    REQUIRE(xform);
+    const UsdPrim prim = xform.GetPrim();
+
+    // A matrix op cannot be mapped to the common transform components, so the local transformation is computed
+    const GfMatrix4d first = GfMatrix4d().SetTransform(GfRotation(GfVec3d::YAxis(), 45.0), GfVec3d(1.0, 2.0, 3.0));
+    const GfMatrix4d second = GfMatrix4d().SetTransform(GfRotation(GfVec3d::ZAxis(), 90.0), GfVec3d(4.0, 5.0, 6.0));
+    UsdGeomXformOp op = xform.AddTransformOp();
+    op.Set(first, UsdTimeCode(1.0));
+    op.Set(second, UsdTimeCode(2.0));
+
+    // The cache overloads match the time overloads at the time of the cache
+    UsdGeomXformCache xformCache(UsdTimeCode(1.0));
+    for (const double time : { 1.0, 2.0 })
+    {
+        xformCache.SetTime(UsdTimeCode(time));
+        CHECK(usdex::core::getLocalTransformMatrix(prim, xformCache) == usdex::core::getLocalTransformMatrix(prim, UsdTimeCode(time)));
+        CHECK(usdex::core::getLocalTransform(prim, xformCache) == usdex::core::getLocalTransform(prim, UsdTimeCode(time)));
+
+        GfVec3d translation, pivot, expectedTranslation, expectedPivot;
+        GfVec3f rotation, scale, expectedRotation, expectedScale;
+        usdex::core::RotationOrder rotationOrder, expectedRotationOrder;
+        usdex::core::getLocalTransformComponents(prim, translation, pivot, rotation, rotationOrder, scale, xformCache);
+        usdex::core::getLocalTransformComponents(
+            prim,
+            expectedTranslation,
+            expectedPivot,
+            expectedRotation,
+            expectedRotationOrder,
+            expectedScale,
+            UsdTimeCode(time)
+        );
+        CHECK(translation == expectedTranslation);
+        CHECK(pivot == expectedPivot);
+        CHECK(rotation == expectedRotation);
+        CHECK(rotationOrder == expectedRotationOrder);
+        CHECK(scale == expectedScale);
+
+        GfQuatf orientation, expectedOrientation;
+        usdex::core::getLocalTransformComponentsQuat(prim, translation, pivot, orientation, scale, xformCache);
+        usdex::core::getLocalTransformComponentsQuat(prim, expectedTranslation, expectedPivot, expectedOrientation, expectedScale, UsdTimeCode(time));
+        CHECK(orientation == expectedOrientation);
+        CHECK(translation == expectedTranslation);
+    }
+    CHECK(usdex::core::getLocalTransformMatrix(prim, xformCache) == second);
+
+    // Prims which are not xformable have an identity transform
+    UsdPrim scope = stage->DefinePrim(SdfPath("/Scope"), TfToken("Scope"));
+    CHECK(usdex::core::getLocalTransformMatrix(scope, xformCache) == GfMatrix4d(1.0));
+}
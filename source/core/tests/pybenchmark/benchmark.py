@@ -0,0 +1,421 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+"""
+Performance benchmarks for the python bindings of OpenUSD Exchange SDK.
+
+Each benchmark mirrors the benchmark of the same name in the ``benchmark_usdex_core`` executable, using the same input data and problem sizes,
+so that the results of both can be compared to measure the overhead of the bindings. Results are written using the Google Benchmark JSON schema,
+as for the C++ benchmarks. The cold start of ``import usdex.core`` is also measured, in fresh interpreters, as it has no C++ counterpart.
+
+Optionally, the results can be compared to:
+    - The C++ results (``--baseline``), reporting the binding overhead of each call and failing if it exceeds ``--max-overhead``.
+    - Previous python results (``--reference``), failing if any benchmark is slower by more than ``--max-regression``.
+"""
+
+import argparse
+import datetime
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+import time
+from typing import Callable, Dict, List, Optional
+
+import usdex.core
+from pxr import Gf, Sdf, Usd, UsdGeom, Vt
+
+try:
+    import usdex.rtx
+except ImportError:
+    usdex.rtx = None
+
+# The problem sizes 1e3, 1e4, 1e5, 1e6, and 1e7, as for the C++ benchmarks
+ELEMENT_RANGES = [1000, 10000, 100000, 1000000, 10000000]
+
+
+class State:
+    """
+    The state of a single benchmark run, passed to each benchmark function.
+
+    Benchmark functions must loop while ``keepRunning()`` returns ``True``, timing only the work within the loop. Setup that should not be
+    measured can be excluded using ``pauseTiming()`` and ``resumeTiming()``.
+    """
+
+    def __init__(self, size: int, minSeconds: float, maxIterations: int = sys.maxsize):
+        self.range = size
+        self.iterations = 0
+        self.seconds = 0.0
+        self.itemsPerIteration = 0
+        self.bytesPerIteration = 0
+        # The number of bound calls per iteration, used to report the binding overhead of each call
+        self.callsPerIteration = 1
+        self.skipMessage = ""
+        self.__minSeconds = minSeconds
+        self.__maxIterations = maxIterations
+        self.__started = False
+        self.__start = None
+
+    def keepRunning(self) -> bool:
+        """Returns ``True`` while more iterations are required, starting the timer on the first call"""
+        if not self.__started:
+            self.__started = True
+            self.resumeTiming()
+        else:
+            self.iterations += 1
+
+        # Always run at least one iteration, then continue until the minimum time has elapsed
+        if self.iterations < self.__maxIterations:
+            elapsed = self.seconds + (time.perf_counter() - self.__start if self.__start is not None else 0.0)
+            if self.iterations == 0 or elapsed < self.__minSeconds:
+                return True
+
+        self.pauseTiming()
+        return False
+
+    def pauseTiming(self):
+        """Stop the timer, e.g. to exclude per-iteration setup from the measurement"""
+        if self.__start is not None:
+            self.seconds += time.perf_counter() - self.__start
+            self.__start = None
+
+    def resumeTiming(self):
+        """Resume the timer after a call to ``pauseTiming()``"""
+        if self.__start is None:
+            self.__start = time.perf_counter()
+
+    def setIterationTime(self, seconds: float):
+        """Add a time measured by the benchmark itself (e.g. in another process) for the current iteration, while the timer is paused"""
+        self.seconds += seconds
+
+    def skipWithMessage(self, message: str):
+        """Mark this run as skipped, e.g. when the configuration is unsupported"""
+        self.skipMessage = message
+        self.__maxIterations = 0
+
+
+BENCHMARKS = []
+
+
+def benchmark(name: str, ranges: Optional[List[int]] = None):
+    """Register a benchmark function under the given name, to be run at each of the given problem sizes, or once if there are none"""
+
+    def register(function: Callable[[State], None]):
+        BENCHMARKS.append((name, function, ranges))
+        return function
+
+    return register
+
+
+# Fixtures, matching those of the C++ benchmarks
+
+
+def makeGridMesh(numFaces: int):
+    """Create a roughly square grid of quads with approximately ``numFaces`` faces, with some height variation so that normals are not uniform"""
+    width = max(1, int(math.sqrt(numFaces)))
+    height = max(1, numFaces // width)
+    points = Vt.Vec3fArray(
+        [Gf.Vec3f(x, y, math.sin(x * 0.1) * math.cos(y * 0.1)) for y in range(height + 1) for x in range(width + 1)],
+    )
+    faceVertexCounts = Vt.IntArray(width * height, 4)
+    indices = []
+    for y in range(height):
+        for x in range(width):
+            v = y * (width + 1) + x
+            indices.extend((v, v + 1, v + width + 2, v + width + 1))
+    return faceVertexCounts, Vt.IntArray(indices), points
+
+
+def makePoints(numPoints: int) -> Vt.Vec3fArray:
+    """Create ``numPoints`` points on a deterministic spiral"""
+    return Vt.Vec3fArray([Gf.Vec3f(math.cos(i * 0.01) * i * 0.01, math.sin(i * 0.01) * i * 0.01, i * 0.01) for i in range(numPoints)])
+
+
+def makeStage() -> Usd.Stage:
+    """Create an in-memory stage with a default prim, to author benchmark data below"""
+    stage = Usd.Stage.CreateInMemory()
+    stage.SetDefaultPrim(UsdGeom.Xform.Define(stage, "/World").GetPrim())
+    return stage
+
+
+# Benchmarks
+
+
+@benchmark("definePolyMesh", ELEMENT_RANGES)
+def definePolyMesh(state: State):
+    faceVertexCounts, faceVertexIndices, points = makeGridMesh(state.range)
+    path = Sdf.Path("/World/Mesh")
+    while state.keepRunning():
+        state.pauseTiming()
+        stage = makeStage()
+        state.resumeTiming()
+
+        usdex.core.definePolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points)
+
+        # exclude the stage destruction from the measurement
+        state.pauseTiming()
+        del stage
+        state.resumeTiming()
+    state.itemsPerIteration = len(faceVertexCounts)
+
+
+# The number of unique values, so that the input is highly redundant, as is typical of faceVarying uvs & normals
+NUM_UNIQUE = 1024
+
+
+@benchmark("PrimvarData::construct", ELEMENT_RANGES)
+def primvarDataConstruct(state: State):
+    values = makePoints(NUM_UNIQUE)
+    indices = Vt.IntArray([(i * 7919) % NUM_UNIQUE for i in range(state.range)])
+    while state.keepRunning():
+        usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, values, indices)
+    state.itemsPerIteration = state.range
+
+
+@benchmark("PrimvarData::index", ELEMENT_RANGES)
+def primvarDataIndex(state: State):
+    unique = makePoints(NUM_UNIQUE)
+    values = Vt.Vec3fArray([unique[(i * 7919) % NUM_UNIQUE] for i in range(state.range)])
+    while state.keepRunning():
+        state.pauseTiming()
+        primvar = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        state.resumeTiming()
+
+        primvar.index()
+    state.itemsPerIteration = state.range
+    state.bytesPerIteration = state.range * 12
+
+
+@benchmark("getValidChildNames/collisions", [1000, 10000, 100000])
+def getValidChildNames(state: State):
+    preferred = ["Mesh", "Cube", "1 part", "Böden", "Material"]
+    names = [preferred[i % len(preferred)] for i in range(state.range)]
+    stage = makeStage()
+    parent = stage.GetDefaultPrim()
+    while state.keepRunning():
+        usdex.core.getValidChildNames(parent, names)
+    state.itemsPerIteration = state.range
+
+
+@benchmark("setLocalTransform", [1000, 10000, 100000])
+def setLocalTransform(state: State):
+    matrix = Gf.Matrix4d().SetTranslate(Gf.Vec3d(1.0, 2.0, 3.0)) * Gf.Matrix4d().SetRotate(Gf.Rotation(Gf.Vec3d(0, 0, 1), 45.0))
+    while state.keepRunning():
+        state.pauseTiming()
+        stage = makeStage()
+        prims = [usdex.core.defineXform(stage, Sdf.Path(f"/World/Xform_{i}")).GetPrim() for i in range(state.range)]
+        state.resumeTiming()
+
+        for prim in prims:
+            usdex.core.setLocalTransform(prim, matrix)
+
+        state.pauseTiming()
+        del prims
+        del stage
+        state.resumeTiming()
+    state.itemsPerIteration = state.range
+    state.callsPerIteration = state.range
+
+
+# There is no C++ counterpart, as the benchmark executable only links the core library
+@benchmark("definePbrMaterial", [100, 1000, 10000])
+def definePbrMaterial(state: State):
+    if usdex.rtx is None:
+        state.skipWithMessage("usdex.rtx is not available")
+    while state.keepRunning():
+        state.pauseTiming()
+        stage = makeStage()
+        paths = [Sdf.Path(f"/World/Material_{i}") for i in range(state.range)]
+        state.resumeTiming()
+
+        for i, path in enumerate(paths):
+            usdex.rtx.definePbrMaterial(stage, path, Gf.Vec3f(i % 2, 0.5, 0.5))
+
+        state.pauseTiming()
+        del stage
+        state.resumeTiming()
+    state.itemsPerIteration = state.range
+    state.callsPerIteration = state.range
+
+
+# The cold start of `import usdex.core` relative to the OpenUSD modules it requires up front, and to those it imports on first use
+STARTUP_COMMAND = """
+import json, time
+start = time.perf_counter()
+import pxr.Gf
+pxrTime = time.perf_counter() - start
+start = time.perf_counter()
+import usdex.core
+usdexTime = time.perf_counter() - start
+start = time.perf_counter()
+import pxr.Usd, pxr.UsdGeom
+usdTime = time.perf_counter() - start
+print(json.dumps([pxrTime, usdexTime, usdTime]))
+"""
+
+
+def importTime(state: State, index: int):
+    # Each iteration runs in a fresh interpreter, so that no modules have been imported, and only the time of the imports is measured
+    while state.keepRunning():
+        state.pauseTiming()
+        result = subprocess.run([sys.executable, "-c", STARTUP_COMMAND], env=os.environ.copy(), capture_output=True, encoding="utf-8")
+        if result.returncode != 0:
+            state.skipWithMessage(result.stderr.strip().splitlines()[-1] if result.stderr.strip() else "the interpreter failed")
+            return
+        state.setIterationTime(json.loads(result.stdout.splitlines()[-1])[index])
+        state.resumeTiming()
+
+
+@benchmark("import/pxr.Gf")
+def importGf(state: State):
+    importTime(state, 0)
+
+
+@benchmark("import/usdex.core")
+def importUsdexCore(state: State):
+    importTime(state, 1)
+
+
+@benchmark("import/deferred")
+def importDeferred(state: State):
+    importTime(state, 2)
+
+
+# Reporting
+
+
+def realTime(result: Dict) -> float:
+    """The time of each iteration in nanoseconds"""
+    return result["real_time"] * {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}[result.get("time_unit", "ns")]
+
+
+def writeJson(path: str, results: List[Dict]):
+    """Write results using the Google Benchmark JSON schema, so that existing tooling can compare versions"""
+    data = {
+        "context": {
+            "date": datetime.datetime.now().strftime("%Y-%m-%dT%H:%M:%S"),
+            "executable": sys.executable,
+            "num_cpus": os.cpu_count(),
+            "python_version": sys.version.split()[0],
+            "library_version": usdex.core.version(),
+            "library_build_version": usdex.core.buildVersion(),
+        },
+        "benchmarks": results,
+    }
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump(data, f, indent=2)
+
+
+def readJson(path: str) -> Dict[str, Dict]:
+    with open(path, "r", encoding="utf-8") as f:
+        data = json.load(f)
+    return {x["name"]: x for x in data["benchmarks"] if not x.get("error_occurred", False)}
+
+
+def compare(results: List[Dict], baseline: Optional[Dict[str, Dict]], reference: Optional[Dict[str, Dict]], args) -> List[str]:
+    """Report the binding overhead and the change since the reference of each result, returning the failures"""
+    failures = []
+    print(f"\n{'Benchmark':<40} {'Python':>14} {'C++':>14} {'Overhead/call':>14} {'Reference':>14} {'Change':>8}")
+    for result in results:
+        if result.get("error_occurred", False):
+            print(f"{result['name']:<40} skipped: {result['error_message']}")
+            continue
+
+        python = realTime(result)
+        row = f"{result['name']:<40} {python / 1e3:>12.1f}us"
+
+        cpp = baseline.get(result["name"]) if baseline else None
+        if cpp:
+            overhead = (python - realTime(cpp)) / result["calls_per_iteration"] / 1e3
+            row += f" {realTime(cpp) / 1e3:>12.1f}us {overhead:>12.2f}us"
+            if args.max_overhead is not None and overhead > args.max_overhead:
+                failures.append(f"{result['name']}: the binding overhead of {overhead:.2f}us per call exceeds {args.max_overhead:.2f}us")
+        else:
+            row += f" {'-':>14} {'-':>14}"
+
+        previous = reference.get(result["name"]) if reference else None
+        if previous:
+            change = python / realTime(previous) - 1.0
+            row += f" {realTime(previous) / 1e3:>12.1f}us {change * 100.0:>+7.1f}%"
+            if change > args.max_regression:
+                failures.append(f"{result['name']}: {change * 100.0:.1f}% slower than the reference exceeds {args.max_regression * 100.0:.1f}%")
+        print(row)
+    return failures
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Performance benchmarks for the python bindings of OpenUSD Exchange SDK")
+    parser.add_argument("-f", "--filter", default=".*", help="Only run benchmarks whose name matches this regular expression")
+    parser.add_argument("-j", "--json", default="", help="Write results to this file using the Google Benchmark JSON schema")
+    parser.add_argument("-t", "--min-time", type=float, default=0.5, help="The minimum time to run each benchmark, in seconds")
+    # The input data is generated in python, which is prohibitively slow for the largest C++ problem sizes
+    parser.add_argument("-r", "--max-range", type=int, default=1000000, help="Skip problem sizes larger than this")
+    parser.add_argument("-l", "--list", action="store_true", help="List the benchmarks without running them")
+    parser.add_argument("--baseline", default="", help="The JSON results of benchmark_usdex_core, to report the binding overhead of each call")
+    parser.add_argument("--max-overhead", type=float, default=None, help="Fail if the binding overhead of any call exceeds this, in microseconds")
+    parser.add_argument("--reference", default="", help="The JSON results of a previous run of these benchmarks, to detect regressions")
+    parser.add_argument(
+        "--max-regression",
+        type=float,
+        default=0.1,
+        help="Fail if any benchmark is slower than the reference by more than this fraction",
+    )
+    args = parser.parse_args()
+
+    baseline = readJson(args.baseline) if args.baseline else None
+    reference = readJson(args.reference) if args.reference else None
+    pattern = re.compile(args.filter)
+
+    # activate the delegate to affect OpenUSD diagnostic logs
+    usdex.core.activateDiagnosticsDelegate()
+    usdex.core.setDiagnosticsLevel(usdex.core.DiagnosticsLevel.eError)
+
+    results = []
+    for name, function, ranges in BENCHMARKS:
+        for size in ranges or [None]:
+            fullName = name if size is None else f"{name}/{size}"
+            if (size is not None and size > args.max_range) or not pattern.search(fullName):
+                continue
+            if args.list:
+                print(fullName)
+                continue
+
+            state = State(size or 0, args.min_time)
+            function(state)
+            if state.skipMessage:
+                results.append({"name": fullName, "run_type": "iteration", "error_occurred": True, "error_message": state.skipMessage})
+                print(f"{fullName}: skipped ({state.skipMessage})")
+                continue
+
+            result = {
+                "name": fullName,
+                "run_type": "iteration",
+                "iterations": state.iterations,
+                "real_time": state.seconds * 1e9 / state.iterations if state.iterations else 0.0,
+                "time_unit": "ns",
+                "calls_per_iteration": state.callsPerIteration,
+            }
+            if state.itemsPerIteration > 0 and state.seconds > 0.0:
+                result["items_per_second"] = state.itemsPerIteration * state.iterations / state.seconds
+            if state.bytesPerIteration > 0 and state.seconds > 0.0:
+                result["bytes_per_second"] = state.bytesPerIteration * state.iterations / state.seconds
+            results.append(result)
+            print(f"{fullName}: {result['real_time'] / 1e3:.1f}us per iteration ({state.iterations} iterations)")
+
+    if args.list:
+        return 0
+
+    if args.json:
+        writeJson(args.json, results)
+
+    failures = compare(results, baseline, reference, args)
+    for failure in failures:
+        print(f"FAILED {failure}", file=sys.stderr)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -5,6 +5,7 @@
 import os
 import pathlib
 import tempfile
+import threading
 import unittest
 from abc import abstractmethod
 
@@ -392,6 +393,121 @@ class AddAssetLibraryTestCase(usdex.test.TestCase):
         self.assertIsValidUsd(payloadStage)
 
 
+class MeshLibraryTestCase(usdex.test.TestCase):
+
+    COUNTS = Vt.IntArray([4])
+    INDICES = Vt.IntArray([0, 1, 2, 3])
+    POINTS = Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 0, 0), Gf.Vec3f(1, 1, 0), Gf.Vec3f(0, 1, 0)])
+
+    def setUp(self):
+        super().setUp()
+        self.contentStage = usdex.core.createStage(
+            self.tmpFile(f"{usdex.core.getPayloadToken()}/{usdex.core.getContentsToken()}", "usda"),
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        self.libraryStage = usdex.core.addAssetLibrary(self.contentStage, usdex.core.getGeometryToken(), "usda")
+        self.root = self.contentStage.GetDefaultPrim()
+
+    def testDeduplicate(self):
+        library = usdex.core.MeshLibrary(self.libraryStage)
+        self.assertTrue(library.isValid())
+
+        # identical meshes share a single library entry
+        for name in ("A", "B", "C"):
+            prim = library.defineMesh(self.contentStage, self.root.GetPath().AppendChild(name), self.COUNTS, self.INDICES, self.POINTS)
+            self.assertTrue(prim)
+            self.assertTrue(prim.IsInstanceable())
+            self.assertTrue(prim.HasAuthoredReferences())
+        self.assertEqual(library.getMeshCount(), 1)
+        self.assertEqual(library.getInstanceCount(), 3)
+
+        # the entry is named after the first instance and contains the mesh
+        entry = self.libraryStage.GetDefaultPrim().GetChild("A")
+        self.assertTrue(entry.IsA(UsdGeom.Xform))
+        mesh = UsdGeom.Mesh(entry.GetChild("Mesh"))
+        self.assertTrue(mesh)
+        self.assertEqual(mesh.GetPointsAttr().Get(), self.POINTS)
+        self.assertEqual(len(self.libraryStage.GetDefaultPrim().GetChildren()), 1)
+
+        # the instances compose the library mesh
+        instance = self.root.GetChild("B")
+        self.assertTrue(instance.IsInstance())
+        self.assertEqual(UsdGeom.Mesh(instance.GetPrototype().GetChild("Mesh")).GetPointsAttr().Get(), self.POINTS)
+        self.assertIsValidUsd(self.contentStage)
+
+    def testDistinctMeshes(self):
+        library = usdex.core.MeshLibrary(self.libraryStage)
+        path = self.root.GetPath()
+        library.defineMesh(self.contentStage, path.AppendChild("A"), self.COUNTS, self.INDICES, self.POINTS)
+
+        # different points
+        moved = Vt.Vec3fArray([point + Gf.Vec3f(0, 0, 1e-4) for point in self.POINTS])
+        library.defineMesh(self.contentStage, path.AppendChild("B"), self.COUNTS, self.INDICES, moved)
+
+        # different topology
+        library.defineMesh(self.contentStage, path.AppendChild("C"), Vt.IntArray([3]), Vt.IntArray([0, 1, 2]), self.POINTS)
+
+        # different primvars
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]))
+        library.defineMesh(self.contentStage, path.AppendChild("D"), self.COUNTS, self.INDICES, self.POINTS, displayColor=displayColor)
+
+        # matching primvars are deduplicated
+        library.defineMesh(self.contentStage, path.AppendChild("E"), self.COUNTS, self.INDICES, self.POINTS, displayColor=displayColor)
+
+        self.assertEqual(library.getMeshCount(), 4)
+        self.assertEqual(library.getInstanceCount(), 5)
+        self.assertEqual([x.GetName() for x in self.libraryStage.GetDefaultPrim().GetChildren()], ["A", "B", "C", "D"])
+
+    def testTolerance(self):
+        library = usdex.core.MeshLibrary(self.libraryStage, tolerance=0.01)
+        path = self.root.GetPath()
+        library.defineMesh(self.contentStage, path.AppendChild("A"), self.COUNTS, self.INDICES, self.POINTS)
+
+        # points within the tolerance are snapped to the same grid cell
+        nearby = Vt.Vec3fArray([point + Gf.Vec3f(0.001, 0, 0) for point in self.POINTS])
+        library.defineMesh(self.contentStage, path.AppendChild("B"), self.COUNTS, self.INDICES, nearby)
+        self.assertEqual(library.getMeshCount(), 1)
+
+        # points beyond the tolerance are distinct
+        distant = Vt.Vec3fArray([point + Gf.Vec3f(0.1, 0, 0) for point in self.POINTS])
+        library.defineMesh(self.contentStage, path.AppendChild("C"), self.COUNTS, self.INDICES, distant)
+        self.assertEqual(library.getMeshCount(), 2)
+        self.assertEqual(library.getInstanceCount(), 3)
+
+    def testInvalidLibrary(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid library stage or tolerance")]):
+            library = usdex.core.MeshLibrary(Usd.Stage.CreateInMemory())
+        self.assertFalse(library.isValid())
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid MeshLibrary")]):
+            prim = library.defineMesh(self.contentStage, self.root.GetPath().AppendChild("A"), self.COUNTS, self.INDICES, self.POINTS)
+        self.assertFalse(prim)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid library stage or tolerance")]):
+            library = usdex.core.MeshLibrary(self.libraryStage, tolerance=-1.0)
+        self.assertFalse(library.isValid())
+
+    def testInvalidMesh(self):
+        library = usdex.core.MeshLibrary(self.libraryStage)
+
+        # invalid mesh data is not authored to the library
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            prim = library.defineMesh(self.contentStage, self.root.GetPath().AppendChild("A"), self.COUNTS, Vt.IntArray([0, 1, 2]), self.POINTS)
+        self.assertFalse(prim)
+        self.assertEqual(library.getMeshCount(), 0)
+        self.assertEqual(len(self.libraryStage.GetDefaultPrim().GetChildren()), 0)
+
+        # invalid instance locations are rejected before authoring to the library
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            prim = library.defineMesh(self.contentStage, Sdf.Path("relative"), self.COUNTS, self.INDICES, self.POINTS)
+        self.assertFalse(prim)
+        self.assertEqual(library.getMeshCount(), 0)
+        self.assertEqual(library.getInstanceCount(), 0)
+
+
 class AddAssetInterfaceTestCase(usdex.test.TestCase, AssetStructureTestBase):
 
     def setUp(self):
@@ -698,6 +814,194 @@ class AddAssetInterfaceTestCase(usdex.test.TestCase, AssetStructureTestBase):
         self.assertIsValidUsd(payloadStage)
 
 
+class CopyDefaultPrimSpecTestCase(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.source = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(self.source, "Asset", self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        xform = usdex.core.defineXform(self.source, "/Asset", Gf.Transform(Gf.Vec3d(1, 2, 3)))
+        usdex.core.setDisplayName(xform.GetPrim(), "My Asset")
+        xform.GetPrim().GetReferences().AddInternalReference("/Prototype")
+        variantSet = xform.GetPrim().GetVariantSets().AddVariantSet("size")
+        variantSet.AddVariant("small")
+        variantSet.SetVariantSelection("small")
+        usdex.core.defineCube(self.source, "/Asset/Cube", 1.0)
+        UsdGeom.Xform.Define(self.source, "/Prototype")
+
+        self.target = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(self.target, "Target", self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+
+    def assertInterfaceCopied(self, spec):
+        self.assertEqual(spec.specifier, Sdf.SpecifierDef)
+        self.assertEqual(spec.typeName, "Xform")
+        self.assertEqual(spec.GetInfo("displayName"), "My Asset")
+        self.assertEqual(spec.referenceList.prependedItems, [Sdf.Reference(primPath="/Prototype")])
+        self.assertEqual(spec.variantSelections["size"], "small")
+        self.assertIn("small", spec.variantSets["size"].variants)
+
+    def testFull(self):
+        self.assertTrue(usdex.core.copyDefaultPrimSpec(self.source, self.target))
+
+        spec = self.target.GetRootLayer().GetPrimAtPath("/Target")
+        self.assertInterfaceCopied(spec)
+        self.assertIn("Cube", spec.nameChildren)
+        self.assertIn("xformOpOrder", spec.properties)
+
+        # The source is unchanged
+        self.assertTrue(self.source.GetRootLayer().GetPrimAtPath("/Asset/Cube"))
+
+    def testInterface(self):
+        self.assertTrue(usdex.core.copyDefaultPrimSpec(self.source, self.target, usdex.core.AssetCopyPolicy.eInterface))
+
+        # Only the metadata and composition arcs are copied
+        spec = self.target.GetRootLayer().GetPrimAtPath("/Target")
+        self.assertInterfaceCopied(spec)
+        self.assertFalse(spec.nameChildren)
+        self.assertFalse(spec.properties)
+        self.assertFalse(self.target.GetRootLayer().GetPrimAtPath("/Target/Cube"))
+
+        # The source is unchanged
+        self.assertTrue(self.source.GetRootLayer().GetPrimAtPath("/Asset/Cube"))
+
+    def testMove(self):
+        self.assertTrue(usdex.core.copyDefaultPrimSpec(self.source, self.target, usdex.core.AssetCopyPolicy.eMove))
+
+        spec = self.target.GetRootLayer().GetPrimAtPath("/Target")
+        self.assertInterfaceCopied(spec)
+        self.assertIn("Cube", spec.nameChildren)
+        self.assertIn("xformOpOrder", spec.properties)
+
+        # The properties and descendants are removed from the source, but its interface remains
+        sourceSpec = self.source.GetRootLayer().GetPrimAtPath("/Asset")
+        self.assertInterfaceCopied(sourceSpec)
+        self.assertFalse(sourceSpec.nameChildren)
+        self.assertFalse(sourceSpec.properties)
+        self.assertTrue(self.source.GetRootLayer().GetPrimAtPath("/Prototype"))
+
+        # Moving a spec onto itself is a no-op
+        self.assertTrue(usdex.core.copyDefaultPrimSpec(self.target, self.target, usdex.core.AssetCopyPolicy.eMove))
+        self.assertTrue(self.target.GetRootLayer().GetPrimAtPath("/Target/Cube"))
+
+    def testAssetInterface(self):
+        assetStage = usdex.core.createStage(
+            self.tmpFile("testAsset", "usda"),
+            "testAsset",
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        usdex.core.defineXform(assetStage, assetStage.GetDefaultPrim().GetPath())
+        payloadStage = usdex.core.createAssetPayload(assetStage, copyPolicy=usdex.core.AssetCopyPolicy.eMove)
+        usdex.core.defineCube(payloadStage, "/testAsset/Cube", 1.0)
+        payloadStage.Save()
+
+        # The inline content of the payload layer is not duplicated into the Asset Interface
+        self.assertTrue(usdex.core.addAssetInterface(assetStage, payloadStage, usdex.core.AssetCopyPolicy.eInterface))
+        self.assertFalse(assetStage.GetRootLayer().GetPrimAtPath("/testAsset/Cube"))
+        self.assertTrue(assetStage.GetDefaultPrim().GetChild("Cube").IsA(UsdGeom.Cube))
+        self.assertTrue(assetStage.GetDefaultPrim().HasAuthoredPayloads())
+        self.assertIsValidUsd(assetStage)
+
+    def testInvalid(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid source stage")]):
+            self.assertFalse(usdex.core.copyDefaultPrimSpec(None, self.target))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid target stage")]):
+            self.assertFalse(usdex.core.copyDefaultPrimSpec(self.source, None))
+
+        # The source default prim must exist in the root layer
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid source default prim")]):
+            self.assertFalse(usdex.core.copyDefaultPrimSpec(self.target, self.source))
+
+        # The target must have a default prim name
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid target default prim")]):
+            self.assertFalse(usdex.core.copyDefaultPrimSpec(self.source, Usd.Stage.CreateInMemory()))
+
+
+class AssembleAssetTestCase(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.validationEngine.enable_rule(omni.asset_validator.AnchoredAssetPathsChecker)
+        self.validationEngine.enable_rule(omni.asset_validator.SupportedFileTypesChecker)
+        self.assetStage = usdex.core.createStage(
+            self.tmpFile("testAsset", "usda"),
+            "testAsset",
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        usdex.core.defineXform(self.assetStage, self.assetStage.GetDefaultPrim().GetPath())
+
+    def testCreateAssetContentStage(self):
+        contentStage = usdex.core.createAssetContentStage(self.assetStage, usdex.core.getGeometryToken())
+        self.assertIsInstance(contentStage, Usd.Stage)
+        self.assertTrue(contentStage.GetRootLayer().anonymous)
+
+        # the content stage matches the asset stage
+        self.assertEqual(UsdGeom.GetStageUpAxis(contentStage), self.defaultUpAxis)
+        self.assertEqual(UsdGeom.GetStageMetersPerUnit(contentStage), self.defaultLinearUnits)
+        self.assertEqual(usdex.core.getLayerAuthoringMetadata(contentStage.GetRootLayer()), self.defaultAuthoringMetadata)
+        defaultPrim = contentStage.GetDefaultPrim()
+        self.assertEqual(defaultPrim.GetName(), "testAsset")
+        self.assertTrue(defaultPrim.IsA(UsdGeom.Xform))
+        self.assertTrue(defaultPrim.GetChild(usdex.core.getGeometryToken()).IsA(UsdGeom.Scope))
+
+        # the scope is optional
+        contentStage = usdex.core.createAssetContentStage(self.assetStage, usdex.core.getGeometryToken(), createScope=False)
+        self.assertFalse(contentStage.GetDefaultPrim().GetChildren())
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid asset stage")]):
+            self.assertIsNone(usdex.core.createAssetContentStage(None, usdex.core.getGeometryToken()))
+
+    def testAssembleAsset(self):
+        names = [usdex.core.getGeometryToken(), usdex.core.getPhysicsToken()]
+        contents = [(name, usdex.core.createAssetContentStage(self.assetStage, name)) for name in names]
+
+        # each content stage is authored on its own thread
+        def author(name, contentStage):
+            scope = contentStage.GetDefaultPrim().GetChild(name)
+            for i in range(10):
+                usdex.core.defineCube(scope, f"Cube_{i}", 1.0)
+
+        threads = [threading.Thread(target=author, args=content) for content in contents]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        self.assertTrue(usdex.core.assembleAsset(self.assetStage, contents))
+
+        # the content layers are saved alongside the payload and sublayered in order
+        payloadDir = pathlib.Path(self.assetStage.GetRootLayer().realPath).parent / usdex.core.getPayloadToken()
+        payloadLayer = Sdf.Layer.FindOrOpen(str(payloadDir / f"{usdex.core.getContentsToken()}.usda"))
+        self.assertTrue(payloadLayer)
+        self.assertEqual(list(payloadLayer.subLayerPaths), [f"./{name}.usda" for name in names])
+        for name in names:
+            self.assertTrue((payloadDir / f"{name}.usda").exists())
+
+        # the asset interface payloads the assembled content
+        defaultPrim = self.assetStage.GetDefaultPrim()
+        self.assertTrue(defaultPrim.HasAuthoredPayloads())
+        self.assertEqual(Usd.ModelAPI(defaultPrim).GetKind(), Kind.Tokens.component)
+        self.assertTrue(defaultPrim.GetChild(usdex.core.getGeometryToken()).GetChild("Cube_9").IsA(UsdGeom.Cube))
+        self.assertTrue(UsdGeom.ModelAPI(defaultPrim).GetExtentsHintAttr().HasAuthoredValue())
+        self.assertIsValidUsd(self.assetStage)
+
+    def testInvalidContents(self):
+        geometry = usdex.core.createAssetContentStage(self.assetStage, usdex.core.getGeometryToken())
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*duplicate content name")]):
+            self.assertFalse(usdex.core.assembleAsset(self.assetStage, [("Geometry", geometry), ("Geometry", geometry)]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid content stage")]):
+            self.assertFalse(usdex.core.assembleAsset(self.assetStage, [("Geometry", None)]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*anonymous asset stage")]):
+            self.assertFalse(usdex.core.assembleAsset(Usd.Stage.CreateInMemory(), [("Geometry", geometry)]))
+
+
 class DefineReferencePayloadBase(AssetStructureTestBase):
     """Base class for defineReference and definePayload tests.
 
@@ -1653,6 +1957,129 @@ class DefinePayloadTestCase(DefineReferencePayloadBase, usdex.test.DefineFunctio
         return primSpec.payloadList.prependedItems
 
 
+class DefineReferencesPayloadsTestCase(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.stage = usdex.core.createStage(
+            self.tmpFile("test", "usda"),
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        usdex.core.defineXform(self.stage, self.stage.GetDefaultPrim().GetPath())
+        self.world = self.stage.GetDefaultPrim().GetPath()
+
+        # Library sources are placed alongside the stage
+        self.sourceIdentifiers = []
+        for name in ("LibraryA", "LibraryB"):
+            identifier = self.tmpFile(name, "usda")
+            sourceStage = usdex.core.createStage(identifier, name, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+            usdex.core.defineXform(sourceStage, f"/{name}")
+            usdex.core.defineCube(sourceStage, f"/{name}/Cube", 1.0)
+            sourceStage.Save()
+            self.sourceIdentifiers.append(identifier)
+
+    def testDefineReferences(self):
+        references = []
+        for i in range(50):
+            identifier = self.sourceIdentifiers[i % 2]
+            references.append(usdex.core.ReferencePayloadData(self.world.AppendChild(f"Ref_{i}"), identifier))
+        cubePath = self.world.AppendPath("Group/Cube")
+        references.append(usdex.core.ReferencePayloadData(cubePath, self.sourceIdentifiers[0], Sdf.Path("/LibraryA/Cube")))
+
+        prims = usdex.core.defineReferences(self.stage, references)
+        self.assertEqual(len(prims), len(references))
+        layer = self.stage.GetRootLayer()
+        for i, prim in enumerate(prims[:-1]):
+            self.assertTrue(prim)
+            self.assertEqual(prim.GetPath(), references[i].path)
+            self.assertEqual(prim.GetTypeName(), "Xform")
+            self.assertTrue(prim.GetChild("Cube").IsA(UsdGeom.Cube))
+
+            # The arcs match those authored by defineReference, using the default prim and a relative identifier
+            fileName = os.path.basename(self.sourceIdentifiers[i % 2])
+            primSpec = layer.GetPrimAtPath(prim.GetPath())
+            self.assertEqual(primSpec.referenceList.prependedItems, [Sdf.Reference(f"./{fileName}")])
+
+        # A specific prim may be referenced, and undefined ancestors are defined as typeless prims
+        cube = prims[-1]
+        self.assertTrue(cube.IsA(UsdGeom.Cube))
+        fileName = os.path.basename(self.sourceIdentifiers[0])
+        expected = [Sdf.Reference(f"./{fileName}", "/LibraryA/Cube")]
+        self.assertEqual(layer.GetPrimAtPath(cubePath).referenceList.prependedItems, expected)
+        self.assertTrue(cube.GetParent().IsDefined())
+        self.assertEqual(cube.GetParent().GetTypeName(), "")
+
+        # The results match the individual function
+        single = usdex.core.defineReference(self.stage, self.world.AppendChild("Single"), self.sourceIdentifiers[0])
+        self.assertEqual(
+            layer.GetPrimAtPath(single.GetPath()).referenceList.prependedItems,
+            layer.GetPrimAtPath(prims[0].GetPath()).referenceList.prependedItems,
+        )
+        self.assertIsValidUsd(self.stage)
+
+    def testDefinePayloads(self):
+        payloads = [usdex.core.ReferencePayloadData(self.world.AppendChild(f"Payload_{i}"), self.sourceIdentifiers[1]) for i in range(10)]
+
+        prims = usdex.core.definePayloads(self.stage, payloads)
+        self.assertEqual(len(prims), len(payloads))
+        fileName = os.path.basename(self.sourceIdentifiers[1])
+        for prim in prims:
+            self.assertTrue(prim.HasAuthoredPayloads())
+            self.assertEqual(prim.GetTypeName(), "Xform")
+            primSpec = self.stage.GetRootLayer().GetPrimAtPath(prim.GetPath())
+            self.assertEqual(primSpec.payloadList.prependedItems, [Sdf.Payload(f"./{fileName}")])
+        self.assertIsValidUsd(self.stage)
+
+    def testInternal(self):
+        # A source identifier which resolves to the edit target authors internal arcs
+        source = usdex.core.defineXform(self.stage, self.world.AppendChild("Source"))
+        identifier = self.stage.GetRootLayer().identifier
+        references = [usdex.core.ReferencePayloadData(self.world.AppendChild(f"Ref_{i}"), identifier, source.GetPath()) for i in range(3)]
+
+        prims = usdex.core.defineReferences(self.stage, references)
+        self.assertEqual(len(prims), 3)
+        for prim in prims:
+            primSpec = self.stage.GetRootLayer().GetPrimAtPath(prim.GetPath())
+            self.assertEqual(primSpec.referenceList.prependedItems, [Sdf.Reference(primPath=source.GetPath())])
+
+        # Self references are rejected
+        references = [usdex.core.ReferencePayloadData(source.GetPath(), identifier, source.GetPath())]
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*pointing to itself")]):
+            self.assertEqual(usdex.core.defineReferences(self.stage, references), [])
+
+    def testInvalid(self):
+        self.assertEqual(usdex.core.defineReferences(self.stage, []), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid stage")]):
+            self.assertEqual(usdex.core.defineReferences(None, [usdex.core.ReferencePayloadData(self.world, self.sourceIdentifiers[0])]), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*anonymous referencing stage")]):
+            stage = Usd.Stage.CreateInMemory()
+            self.assertEqual(usdex.core.definePayloads(stage, [usdex.core.ReferencePayloadData("/Ref", self.sourceIdentifiers[0])]), [])
+
+        # Each invalid entry is reported and nothing is authored
+        missingIdentifier = os.path.join(os.path.dirname(self.sourceIdentifiers[0]), "missing.usda")
+        references = [
+            usdex.core.ReferencePayloadData(self.world.AppendChild("Valid"), self.sourceIdentifiers[0]),
+            usdex.core.ReferencePayloadData(self.world.AppendChild("Missing"), missingIdentifier),
+            usdex.core.ReferencePayloadData(self.world.AppendChild("BadPrim"), self.sourceIdentifiers[0], Sdf.Path("/Missing")),
+            usdex.core.ReferencePayloadData(self.world.AppendChild("Valid"), self.sourceIdentifiers[1]),
+            usdex.core.ReferencePayloadData(Sdf.Path("relative"), self.sourceIdentifiers[1]),
+        ]
+        expected = [
+            (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid sourceIdentifier"),
+            (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Unable to get the \"/Missing\" prim"),
+            (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*duplicate path"),
+            (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location"),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(self, expected):
+            self.assertEqual(usdex.core.defineReferences(self.stage, references), [])
+        self.assertFalse(self.stage.GetPrimAtPath(self.world.AppendChild("Valid")))
+
+
 class ConfigureComponentHierarchyTestCase(usdex.test.TestCase):
 
     def createTestStage(self):
@@ -2074,3 +2501,40 @@ class ConfigureAssemblyHierarchyTestCase(usdex.test.TestCase):
         with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Unable to set the kind of")]):
             result = usdex.core.configureAssemblyHierarchy(stage.GetPseudoRoot())
             self.assertFalse(result)
+
+    def testDeepHierarchy(self):
+        stage = self.createTestStage()
+        rootPrim = stage.GetDefaultPrim()
+
+        # A deep chain of prims without kinds, which all contain a component
+        chain = []
+        parent = rootPrim
+        for i in range(100):
+            parent = usdex.core.defineScope(parent, f"Level_{i}").GetPrim()
+            chain.append(parent)
+        component = usdex.core.defineScope(parent, "Component").GetPrim()
+        Usd.ModelAPI(component).SetKind(Kind.Tokens.component)
+
+        # Models outside of the default traversal are considered, but their kinds are unchanged
+        branch = usdex.core.defineScope(rootPrim, "Branch").GetPrim()
+        inactive = usdex.core.defineScope(branch, "Inactive").GetPrim()
+        Usd.ModelAPI(inactive).SetKind(Kind.Tokens.model)
+        Usd.ModelAPI(usdex.core.defineScope(inactive, "Component").GetPrim()).SetKind(Kind.Tokens.component)
+        inactive.SetActive(False)
+
+        # All kinds are authored together
+        notices = []
+        listener = Tf.Notice.Register(Usd.Notice.ObjectsChanged, lambda notice, sender: notices.append(notice), stage)
+        result = usdex.core.configureAssemblyHierarchy(rootPrim)
+        listener.Revoke()
+        self.assertTrue(result)
+        self.assertEqual(len(notices), 1)
+
+        self.assertEqual(Usd.ModelAPI(rootPrim).GetKind(), Kind.Tokens.assembly)
+        for prim in chain:
+            self.assertEqual(Usd.ModelAPI(prim).GetKind(), Kind.Tokens.group)
+        self.assertEqual(Usd.ModelAPI(component).GetKind(), Kind.Tokens.component)
+        self.assertEqual(Usd.ModelAPI(branch).GetKind(), Kind.Tokens.group)
+        self.assertEqual(Usd.ModelAPI(stage.GetPrimAtPath(inactive.GetPath())).GetKind(), Kind.Tokens.model)
+
+        self.assertIsValidUsd(stage)
@@ -0,0 +1,119 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import usdex.core
+import usdex.test
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom
+
+
+class BoundsAlgoTestCase(usdex.test.TestCase):
+
+    def createBoundsStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        root = usdex.core.defineXform(stage, f"/{self.defaultPrimName}")
+        usdex.core.setLocalTransform(root.GetPrim(), Gf.Vec3d(10.0, 0.0, 0.0), Gf.Quatf.GetIdentity())
+
+        usdex.core.defineCube(stage, root.GetPath().AppendChild("Cube"), 2.0)
+
+        # A sphere below a rotated and scaled xform
+        xform = usdex.core.defineXform(stage, root.GetPath().AppendChild("Xform"))
+        rotation = Gf.Quatf(Gf.Rotation(Gf.Vec3d(0.0, 0.0, 1.0), 45.0).GetQuat())
+        usdex.core.setLocalTransform(xform.GetPrim(), Gf.Vec3d(0.0, 5.0, 0.0), rotation, Gf.Vec3f(2.0, 1.0, 1.0))
+        usdex.core.defineSphere(stage, xform.GetPath().AppendChild("Sphere"), 1.0)
+
+        # A guide, an invisible prim, and a material are not included by default
+        guide = usdex.core.defineCube(stage, root.GetPath().AppendChild("Guide"), 100.0)
+        guide.CreatePurposeAttr(UsdGeom.Tokens.guide)
+        hidden = usdex.core.defineXform(stage, root.GetPath().AppendChild("Hidden"))
+        hidden.MakeInvisible()
+        usdex.core.defineCube(stage, hidden.GetPath().AppendChild("Cube"), 100.0)
+        usdex.core.createMaterial(root.GetPrim(), "Material")
+
+        return stage
+
+    def assertRangesAlmostEqual(self, first, second):
+        self.assertTrue(Gf.IsClose(first.GetMin(), second.GetMin(), 1e-5), f"{first} != {second}")
+        self.assertTrue(Gf.IsClose(first.GetMax(), second.GetMax(), 1e-5), f"{first} != {second}")
+
+    def testMatchesBBoxCache(self):
+        stage = self.createBoundsStage()
+        root = stage.GetDefaultPrim()
+
+        result = usdex.core.computeWorldBounds(root)
+        self.assertEqual([prim.GetName() for prim in result.prims], ["Cube", "Sphere"])
+        self.assertEqual(result.purposes, [UsdGeom.Tokens.default_] * 2)
+        self.assertEqual(len(result.transforms), 2)
+        self.assertEqual(len(result.bounds), 2)
+
+        cache = UsdGeom.BBoxCache(Usd.TimeCode.Default(), [UsdGeom.Tokens.default_])
+        xformCache = UsdGeom.XformCache()
+        for i, prim in enumerate(result.prims):
+            self.assertTrue(Gf.IsClose(result.transforms[i], xformCache.GetLocalToWorldTransform(prim), 1e-6))
+            self.assertRangesAlmostEqual(result.bounds[i], cache.ComputeWorldBound(prim).ComputeAlignedRange())
+        self.assertRangesAlmostEqual(result.range, cache.ComputeWorldBound(root).ComputeAlignedRange())
+
+        # Including the guide purpose includes the guide prim
+        result = usdex.core.computeWorldBounds(root, Usd.TimeCode.Default(), [UsdGeom.Tokens.default_, UsdGeom.Tokens.guide])
+        self.assertEqual([prim.GetName() for prim in result.prims], ["Cube", "Sphere", "Guide"])
+        self.assertEqual(result.purposes[2], UsdGeom.Tokens.guide)
+        self.assertRangesAlmostEqual(result.range, Gf.Range3d(Gf.Vec3d(-40.0, -50.0, -50.0), Gf.Vec3d(60.0, 50.0, 50.0)))
+
+    def testInstanceProxies(self):
+        stage = self.createBoundsStage()
+        root = stage.GetDefaultPrim()
+
+        # Each instance of a prototype contributes to the bounds
+        prototype = usdex.core.defineXform(stage, "/Prototype")
+        usdex.core.defineCube(stage, "/Prototype/Cube", 1.0)
+        stage.GetPrimAtPath("/Prototype").SetSpecifier(Sdf.SpecifierClass)
+        for name, offset in (("A", 20.0), ("B", -20.0)):
+            instance = usdex.core.defineXform(stage, root.GetPath().AppendChild(name))
+            usdex.core.setLocalTransform(instance.GetPrim(), Gf.Vec3d(0.0, 0.0, offset), Gf.Quatf.GetIdentity())
+            instance.GetPrim().GetReferences().AddInternalReference(prototype.GetPath())
+            instance.GetPrim().SetInstanceable(True)
+
+        result = usdex.core.computeWorldBounds(root)
+        self.assertEqual(len(result.prims), 4)
+        self.assertTrue(result.prims[2].IsInstanceProxy())
+        self.assertRangesAlmostEqual(result.bounds[2], Gf.Range3d(Gf.Vec3d(9.5, -0.5, 19.5), Gf.Vec3d(10.5, 0.5, 20.5)))
+        self.assertRangesAlmostEqual(result.bounds[3], Gf.Range3d(Gf.Vec3d(9.5, -0.5, -20.5), Gf.Vec3d(10.5, 0.5, -19.5)))
+
+    def testSetExtentsHint(self):
+        stage = self.createBoundsStage()
+        root = stage.GetDefaultPrim()
+
+        self.assertTrue(usdex.core.setExtentsHint(root))
+        extentsHint = UsdGeom.ModelAPI(root).GetExtentsHint()
+
+        # The value matches that computed by OpenUSD, in the local space of the prim
+        cache = UsdGeom.BBoxCache(Usd.TimeCode.Default(), UsdGeom.Imageable.GetOrderedPurposeTokens())
+        expected = UsdGeom.ModelAPI(root).ComputeExtentsHint(cache)
+        self.assertEqual(len(extentsHint), len(expected))
+        for i in range(len(expected)):
+            if expected[i] == Gf.Range3f().GetMin() or expected[i] == Gf.Range3f().GetMax():
+                self.assertEqual(extentsHint[i], expected[i])
+            else:
+                self.assertTrue(Gf.IsClose(extentsHint[i], expected[i], 1e-5), f"{extentsHint[i]} != {expected[i]}")
+        self.assertIsValidUsd(stage)
+
+    def testEmptyBounds(self):
+        stage = Usd.Stage.CreateInMemory()
+        scope = usdex.core.defineScope(stage, "/Scope")
+
+        result = usdex.core.computeWorldBounds(scope.GetPrim())
+        self.assertEqual(result.prims, [])
+        self.assertTrue(result.range.IsEmpty())
+
+        # A single empty range is authored when there are no bounds
+        self.assertTrue(usdex.core.setExtentsHint(scope.GetPrim()))
+        self.assertEqual(len(UsdGeom.ModelAPI(scope.GetPrim()).GetExtentsHint()), 2)
+
+    def testInvalidPrim(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to compute world bounds for an invalid prim")]):
+            result = usdex.core.computeWorldBounds(Usd.Prim())
+        self.assertEqual(result.prims, [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to set the extentsHint of an invalid prim")]):
+            self.assertFalse(usdex.core.setExtentsHint(Usd.Prim()))
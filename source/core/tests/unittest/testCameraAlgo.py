@@ -197,3 +197,95 @@ class DefineCameraTestCase(usdex.test.DefineFunctionTestCase):
                 propertySpec and propertySpec.HasDefaultValue() and attr.HasAuthoredValue(),
                 f'Property "{propertyName}" not explicitly authored on non-centimeter stage',
             )
+
+
+class DefineCamerasTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        return stage
+
+    def createCameraData(self, frame: int) -> Gf.Camera:
+        cameraData = Gf.Camera(transform=Gf.Matrix4d().SetTranslate(Gf.Vec3d(frame, 2.0 * frame, 10.0)))
+        cameraData.focalLength = 20.0 + frame
+        cameraData.clippingPlanes = [Gf.Vec4f(0, 0, 1, frame)]
+        return cameraData
+
+    def testMatchesDefineCamera(self):
+        expected = self.createTestStage()
+        stage = self.createTestStage()
+        paths = [Sdf.Path("/World/CameraA"), Sdf.Path("/World/Nested/CameraB")]
+        cameraData = [self.createCameraData(1), self.createCameraData(2)]
+
+        usdex.core.defineXform(expected, "/World/Nested")
+        for path, data in zip(paths, cameraData):
+            usdex.core.defineCamera(expected, path, data)
+
+        usdex.core.defineXform(stage, "/World/Nested")
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            cameras = usdex.core.defineCameras(stage, paths, cameraData)
+        self.assertEqual([camera.GetPath() for camera in cameras], paths)
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected.GetRootLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+    def testAnimatedCameras(self):
+        stage = self.createTestStage()
+
+        # The parent of one camera is animated, so the world space camera data must be localized at each time
+        parent = usdex.core.defineXform(stage, "/World/Animated")
+        times = [Usd.TimeCode(frame) for frame in range(1, 5)]
+        for time in times:
+            usdex.core.setLocalTransform(parent.GetPrim(), Gf.Vec3d(0.0, 0.0, time.GetValue()), Gf.Quatf.GetIdentity(), time=time)
+
+        paths = [Sdf.Path("/World/Static"), Sdf.Path("/World/Animated/Camera")]
+        cameraData = [self.createCameraData(int(time.GetValue())) for path in paths for time in times]
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            cameras = usdex.core.defineCameras(stage, paths, cameraData, times)
+        self.assertEqual(len(cameras), len(paths))
+
+        # Every attribute is densely sampled, and the computed world space camera matches the input at each time
+        for i, camera in enumerate(cameras):
+            self.assertEqual(camera.GetFocalLengthAttr().GetTimeSamples(), [time.GetValue() for time in times])
+            for j, time in enumerate(times):
+                data = cameraData[i * len(times) + j]
+                actual = camera.GetCamera(time)
+                self.assertTrue(Gf.IsClose(actual.transform, data.transform, 1e-6))
+                self.assertEqual(actual.focalLength, data.focalLength)
+                self.assertEqual(actual.clippingPlanes, data.clippingPlanes)
+        self.assertIsValidUsd(stage)
+
+    def testInvalidCameras(self):
+        stage = self.createTestStage()
+
+        # An empty batch defines nothing
+        self.assertEqual(usdex.core.defineCameras(stage, [], []), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched sizes")]):
+            self.assertEqual(usdex.core.defineCameras(stage, [Sdf.Path("/World/Camera")], [Gf.Camera()] * 2), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertEqual(usdex.core.defineCameras(stage, [Sdf.Path("/World/Camera"), Sdf.Path("Camera")], [Gf.Camera()] * 2), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*duplicate path")]):
+            self.assertEqual(usdex.core.defineCameras(stage, [Sdf.Path("/World/Camera")] * 2, [Gf.Camera()] * 2), [])
+        self.assertFalse(stage.GetPrimAtPath("/World/Camera"))
+
+    def testStrongerXformOpinions(self):
+        # A camera with stronger xformOp opinions fails the batch before any of the existing prims are edited
+        stronger = Sdf.Layer.CreateAnonymous()
+        weaker = Sdf.Layer.CreateAnonymous()
+        stage = Usd.Stage.CreateInMemory()
+        stage.GetRootLayer().subLayerPaths = [stronger.identifier, weaker.identifier]
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        editable = Sdf.Path("/World/Editable")
+        blocked = Sdf.Path("/World/Blocked")
+        stage.SetEditTarget(Usd.EditTarget(stronger))
+        UsdGeom.Xform.Define(stage, blocked).AddTranslateOp().Set(Gf.Vec3d(1, 2, 3))
+        stage.SetEditTarget(Usd.EditTarget(weaker))
+        UsdGeom.Xform.Define(stage, editable).AddTranslateOp().Set(Gf.Vec3d(4, 5, 6))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*opinions in the composed layer stack are stronger")]):
+            self.assertEqual(usdex.core.defineCameras(stage, [editable, blocked], [Gf.Camera()] * 2), [])
+        self.assertEqual(weaker.GetAttributeAtPath(editable.AppendProperty("xformOpOrder")).default, Vt.TokenArray(["xformOp:translate"]))
+        self.assertFalse(weaker.GetPrimAtPath(blocked))
@@ -82,8 +82,8 @@ class DefineBasisCurvesTestCaseMixin(DefinePointBasedTestCaseMixin):
             self.assertFalse(result.GetBasisAttr().IsAuthored())
         self.assertTrue(result.GetWrapAttr().IsAuthored())
 
-        # Assert that a correct extent has been authored
-        extent = UsdGeom.Boundable.ComputeExtentFromPlugins(result, Usd.TimeCode.Default())
+        # Assert that a correct extent has been authored, including the widths
+        extent = self.computeExpectedExtent(result)
         extentAttr = result.GetExtentAttr()
         self.assertTrue(extentAttr.IsAuthored())
         self.assertEqual(extentAttr.Get(), extent)
@@ -299,6 +299,31 @@ class DefineBasisCurvesTestCaseMixin(DefinePointBasedTestCaseMixin):
         self.assertFalse(result)
         self.assertFalse(stage.GetPrimAtPath(path))
 
+    def testMultipleInvalidPrimvars(self):
+        # The primvars are validated concurrently, but only the first invalid primvar (in argument order) is reported
+        stage = self.createTestStage()
+        path = Sdf.Path("/World/MultipleInvalidPrimvars")
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([0.5]))
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]), Vt.IntArray([1]))
+        displayOpacity = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([0.5, 1.0]))
+        for _ in range(10):
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid display color")]):
+                result = self.defineFunc(
+                    stage,
+                    path,
+                    *self.requiredArgs,
+                    widths=widths,
+                    displayColor=displayColor,
+                    displayOpacity=displayOpacity,
+                )
+            self.assertFalse(result)
+            self.assertFalse(stage.GetPrimAtPath(path))
+
+        # The same valid data can be used to define several prims
+        for name in ("ValidWidthsA", "ValidWidthsB"):
+            result = self.defineFunc(stage, Sdf.Path("/World").AppendChild(name), *self.requiredArgs, widths=widths)
+            self.assertDefineFunctionSuccess(result)
+
 
 class LinearBasisCurvesTestCase(DefineBasisCurvesTestCaseMixin, usdex.test.DefineFunctionTestCase):
 
@@ -1694,3 +1719,113 @@ class CurvesAlgoPrimOverloadTest(usdex.test.TestCase):
             curves = usdex.core.defineCubicBasisCurves(xformPrim, CURVE_VERTEX_COUNTS, POINTS, UsdGeom.Tokens.bezier)
         self.assertTrue(curves)
         self.assertEqual(curves.GetPrim().GetTypeName(), "BasisCurves")
+
+
+class BasisCurvesWriterTestCase(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.stage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(self.stage, "/World")
+        self.curves = usdex.core.defineCubicBasisCurves(
+            self.stage,
+            Sdf.Path("/World/Curves"),
+            BATCHED_CURVE_VERTEX_COUNTS,
+            BATCHED_POINTS,
+            UsdGeom.Tokens.bspline,
+            UsdGeom.Tokens.nonperiodic,
+        )
+
+    def testWriteFrames(self):
+        writer = usdex.core.BasisCurvesWriter(self.curves)
+        self.assertTrue(writer.isValid())
+        self.assertEqual(writer.getFrameCount(), 0)
+
+        # Nonperiodic bspline curves have one varying value per segment, plus one for each curve
+        varyingSize = sum(count - 3 + 1 for count in BATCHED_CURVE_VERTEX_COUNTS)
+        frames = [Vt.Vec3fArray([point + Gf.Vec3f(i, 0, 0) for point in BATCHED_POINTS]) for i in range(3)]
+        for i, points in enumerate(frames):
+            widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.varying, Vt.FloatArray([0.5] * varyingSize))
+            with usdex.test.ScopedDiagnosticChecker(self, []):
+                self.assertTrue(writer.writeFrame(Usd.TimeCode(i), points, widths=widths))
+        self.assertEqual(writer.getFrameCount(), len(frames))
+
+        widthsPrimvar = UsdGeom.PrimvarsAPI(self.curves).GetPrimvar(UsdGeom.Tokens.widths)
+        self.assertEqual(widthsPrimvar.GetInterpolation(), UsdGeom.Tokens.varying)
+        self.assertEqual(self.curves.GetPointsAttr().GetTimeSamples(), [0.0, 1.0, 2.0])
+        for i, points in enumerate(frames):
+            self.assertEqual(self.curves.GetPointsAttr().Get(i), points)
+            self.assertEqual(widthsPrimvar.Get(i), Vt.FloatArray([0.5] * varyingSize))
+            # The extent follows the points of each frame and is padded by half of the widths
+            extent = self.curves.GetExtentAttr().Get(i)
+            self.assertEqual(extent, Vt.Vec3fArray([Gf.Vec3f(i - 1.25, -0.25, -0.25), Gf.Vec3f(i + 1.25, 9.25, 2.25)]))
+
+        # The topology and default values authored by defineCubicBasisCurves are retained
+        self.assertEqual(self.curves.GetCurveVertexCountsAttr().GetTimeSamples(), [])
+        self.assertEqual(self.curves.GetPointsAttr().Get(Usd.TimeCode.Default()), BATCHED_POINTS)
+        self.assertIsValidUsd(self.stage)
+
+    def testLayerOffset(self):
+        # Frames are written to the edit target, accounting for its time offset
+        sublayer = Sdf.Layer.CreateAnonymous()
+        self.stage.GetRootLayer().subLayerPaths.append(sublayer.identifier)
+        self.stage.GetRootLayer().subLayerOffsets[0] = Sdf.LayerOffset(offset=10)
+        self.stage.SetEditTarget(self.stage.GetEditTargetForLocalLayer(sublayer))
+
+        writer = usdex.core.BasisCurvesWriter(self.curves)
+        for i in range(3):
+            self.assertTrue(writer.writeFrame(Usd.TimeCode(10 + i), BATCHED_POINTS))
+        self.assertEqual(sublayer.ListTimeSamplesForPath(self.curves.GetPointsAttr().GetPath()), [0.0, 1.0, 2.0])
+        self.assertEqual(self.curves.GetPointsAttr().GetTimeSamples(), [10.0, 11.0, 12.0])
+
+    def testInvalidFrames(self):
+        writer = usdex.core.BasisCurvesWriter(self.curves)
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*increasing numeric time codes")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode.Default(), BATCHED_POINTS))
+
+        # The number of points is fixed by the topology
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points: Expected 21 values but found 7")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), POINTS))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid widths.*not valid")]):
+            uniformWidths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.uniform, Vt.FloatArray([1.0]))
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), BATCHED_POINTS, widths=uniformWidths))
+
+        self.assertTrue(writer.writeFrame(Usd.TimeCode(0), BATCHED_POINTS, widths=widths))
+
+        # Frames must be written in order
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*increasing numeric time codes")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), BATCHED_POINTS, widths=widths))
+
+        # The set of values is fixed by the first frame
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid widths.*all frames or none")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(1), BATCHED_POINTS))
+
+        # The interpolation is fixed by the first frame
+        vertexWidths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0] * len(BATCHED_POINTS)))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid widths.*must not change")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(1), BATCHED_POINTS, widths=vertexWidths))
+
+        # Failed frames do not affect the written frames
+        self.assertEqual(writer.getFrameCount(), 1)
+        self.assertEqual(self.curves.GetPointsAttr().GetTimeSamples(), [0.0])
+        self.assertTrue(writer.writeFrame(Usd.TimeCode(1), BATCHED_POINTS, widths=widths))
+        self.assertEqual(writer.getFrameCount(), 2)
+
+    def testInvalidTopology(self):
+        # The topology is validated once, when the writer is bound
+        self.curves.GetCurveVertexCountsAttr().Set(Vt.IntArray([7, 2, 10]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology: A minimum of 4 vertices")]):
+            writer = usdex.core.BasisCurvesWriter(self.curves)
+        self.assertFalse(writer.isValid())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid prim, topology, or edit target")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), BATCHED_POINTS))
+
+    def testInvalidPrim(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdGeomBasisCurves")]):
+            writer = usdex.core.BasisCurvesWriter(UsdGeom.BasisCurves())
+        self.assertFalse(writer.isValid())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid prim, topology, or edit target")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), BATCHED_POINTS))
@@ -1,4 +1,4 @@
-# SPDX-FileCopyrightText: Copyright (c) 2024-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-FileCopyrightText: Copyright (c) 2024-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 #
 
@@ -11,7 +11,7 @@ from typing import List
 
 import usdex.core
 import usdex.test
-from pxr import Tf
+from pxr import Sdf, Tf, Usd
 
 
 class DiagnosticsTest(usdex.test.TestCase):
@@ -21,12 +21,16 @@ class DiagnosticsTest(usdex.test.TestCase):
         # assert expected defaults
         self.assertEqual(usdex.core.getDiagnosticsLevel(), usdex.core.DiagnosticsLevel.eWarning)
         self.assertEqual(usdex.core.getDiagnosticsOutputStream(), usdex.core.DiagnosticsOutputStream.eStderr)
+        self.assertFalse(usdex.core.getDiagnosticsBuffered())
+        self.assertEqual(usdex.core.getDiagnosticsRepeatLimit(), 0)
 
     def tearDown(self):
         super().tearDown()
         # restore defaults for tests that manipulate them
         usdex.core.setDiagnosticsLevel(usdex.core.DiagnosticsLevel.eWarning)
         usdex.core.setDiagnosticsOutputStream(usdex.core.DiagnosticsOutputStream.eStderr)
+        usdex.core.setDiagnosticsBuffered(False)
+        usdex.core.setDiagnosticsRepeatLimit(0)
 
     def assertOutputStreams(self, command, expectedStdout: List[str], expectedStderr: List[str], expectSuccess: bool = True):
 
@@ -291,6 +295,128 @@ Stderr:
             ],
         )
 
+    def testBuffered(self):
+        command = inspect.cleandoc(
+            """
+            import usdex.core
+            from pxr import Tf
+
+            usdex.core.activateDiagnosticsDelegate()
+            usdex.core.setDiagnosticsBuffered(True)
+            assert usdex.core.getDiagnosticsBuffered()
+
+            def emitDiagnostics():
+                for i in range(3):
+                    Tf.Warn(f"This is warning {i}")
+
+            emitDiagnostics()
+            usdex.core.flushDiagnostics()
+            print("flushed", flush=True)
+
+            emitDiagnostics()
+            usdex.core.deactivateDiagnosticsDelegate()
+            """
+        )
+
+        # the buffered diagnostics are written in order, and are complete once flushed
+        self.assertOutputStreams(
+            command=command,
+            expectedStdout=["flushed"],
+            expectedStderr=[f"[Warning] [__main__.emitDiagnostics] This is warning {i}" for i in (0, 1, 2, 0, 1, 2)],
+        )
+
+        # buffered stdout diagnostics are flushed in order with other output
+        self.assertOutputStreams(
+            command=command.replace(
+                "usdex.core.setDiagnosticsBuffered(True)",
+                "usdex.core.setDiagnosticsBuffered(True)\nusdex.core.setDiagnosticsOutputStream(usdex.core.DiagnosticsOutputStream.eStdout)",
+            ),
+            expectedStdout=[f"[Warning] [__main__.emitDiagnostics] This is warning {i}" for i in (0, 1, 2)]
+            + ["flushed"]
+            + [f"[Warning] [__main__.emitDiagnostics] This is warning {i}" for i in (0, 1, 2)],
+            expectedStderr=[],
+        )
+
+    def testRepeatLimit(self):
+        command = inspect.cleandoc(
+            """
+            import usdex.core
+            from pxr import Tf
+
+            usdex.core.activateDiagnosticsDelegate()
+            usdex.core.setDiagnosticsRepeatLimit(2)
+            assert usdex.core.getDiagnosticsRepeatLimit() == 2
+
+            def emitDiagnostics():
+                for i in range(5):
+                    Tf.Warn("This is a repeated warning")
+                Tf.Warn("This is a different warning")
+
+            emitDiagnostics()
+            """
+        )
+
+        self.assertOutputStreams(
+            command=command,
+            expectedStdout=[],
+            expectedStderr=[
+                "[Warning] [__main__.emitDiagnostics] This is a repeated warning",
+                "[Warning] [__main__.emitDiagnostics] This is a repeated warning",
+                "[Warning] [__main__.emitDiagnostics] This is a repeated warning (further repeats of this diagnostic are suppressed)",
+                "[Warning] [__main__.emitDiagnostics] This is a different warning",
+            ],
+        )
+
+    def testCounts(self):
+        command = inspect.cleandoc(
+            """
+            import usdex.core
+            from pxr import Tf, Usd
+
+            usdex.core.activateDiagnosticsDelegate()
+            usdex.core.setDiagnosticsLevel(usdex.core.DiagnosticsLevel.eWarning)
+            usdex.core.setDiagnosticsOutputStream(usdex.core.DiagnosticsOutputStream.eNone)
+
+            def emitDiagnostics():
+                Tf.Status("This is a status")
+                Tf.Warn("This is a warning")
+                Tf.Warn("This is a warning")
+                usdex.core.defineXform(Usd.Stage.CreateInMemory(), "/")  # emits Tf Runtime Error
+
+            emitDiagnostics()
+
+            # filtered and muted diagnostics are counted
+            counts = usdex.core.getDiagnosticsCounts()
+            assert counts.byType[Tf.TF_DIAGNOSTIC_STATUS_TYPE] == 1
+            assert counts.byType[Tf.TF_DIAGNOSTIC_WARNING_TYPE] == 2
+            assert counts.byType[Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE] == 1
+            assert Tf.TF_DIAGNOSTIC_CODING_ERROR_TYPE not in counts.byType
+            assert [(x.function, x.count) for x in counts.byFunction][-1] == ("usdex::core::defineXform", 1)
+            print(usdex.core.getDiagnosticsMetrics(), end="")
+
+            usdex.core.resetDiagnosticsCounts()
+            assert usdex.core.getDiagnosticsCounts().byType == {}
+            """
+        )
+
+        self.assertOutputStreams(
+            command=command,
+            expectedStdout=[
+                "# TYPE usdex_diagnostics counter",
+                "# HELP usdex_diagnostics The number of diagnostics issued, by type.",
+                'usdex_diagnostics_total{type="runtime_error"} 1',
+                'usdex_diagnostics_total{type="warning"} 2',
+                'usdex_diagnostics_total{type="status"} 1',
+                "# TYPE usdex_diagnostics_by_function counter",
+                "# HELP usdex_diagnostics_by_function The number of diagnostics issued, by type and source function.",
+                'usdex_diagnostics_by_function_total{type="warning",function="__main__.emitDiagnostics"} 2',
+                'usdex_diagnostics_by_function_total{type="status",function="__main__.emitDiagnostics"} 1',
+                'usdex_diagnostics_by_function_total{type="runtime_error",function="usdex::core::defineXform"} 1',
+                "# EOF",
+            ],
+            expectedStderr=[],
+        )
+
     def testFatal(self):
         command = inspect.cleandoc(
             """
@@ -364,3 +490,79 @@ Stderr:
         ):
             Tf.Status("Status is emitted and asserted")
             Tf.Warn("Warning is emitted and asserted")
+
+
+class AuthoringErrorScopeTest(usdex.test.TestCase):
+
+    def testRecordsErrors(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.defineXform(stage, "/World")
+
+        # errors are recorded without posting diagnostics or formatting messages
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            with usdex.core.AuthoringErrorScope() as scope:
+                self.assertFalse(usdex.core.defineXform(stage, Sdf.Path("relative")))
+                self.assertFalse(usdex.core.defineXform(stage.GetPrimAtPath("/World"), "1 invalid"))
+                self.assertTrue(usdex.core.defineXform(stage, "/World/Valid"))
+
+        errors = scope.getErrors()
+        self.assertEqual(len(errors), 2)
+        self.assertEqual(errors[0].function, "usdex::core::defineXform")
+        self.assertEqual(errors[0].path, Sdf.Path("relative"))
+        self.assertEqual(errors[0].code, usdex.core.AuthoringErrorCode.eInvalidLocation)
+        self.assertEqual(errors[0].message, "")
+        # the path of an invalid child name can not be formed
+        self.assertEqual(errors[1].path, Sdf.Path())
+
+        scope.clear()
+        self.assertEqual(scope.getErrors(), [])
+
+    def testCaptureMessages(self):
+        stage = Usd.Stage.CreateInMemory()
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            with usdex.core.AuthoringErrorScope(captureMessages=True) as scope:
+                self.assertFalse(usdex.core.defineXform(stage, Sdf.Path("relative")))
+        self.assertEqual(len(scope.getErrors()), 1)
+        self.assertRegex(scope.getErrors()[0].message, "Unable to define UsdGeomXform due to an invalid location")
+
+        # diagnostics may also be posted as they would be without the scope
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            with usdex.core.AuthoringErrorScope(postDiagnostics=True) as scope:
+                self.assertFalse(usdex.core.defineXform(stage, Sdf.Path("relative")))
+        self.assertEqual(len(scope.getErrors()), 1)
+        self.assertEqual(scope.getErrors()[0].message, "")
+
+    def testNestedScopes(self):
+        stage = Usd.Stage.CreateInMemory()
+        with usdex.core.AuthoringErrorScope() as outer:
+            with usdex.core.AuthoringErrorScope() as inner:
+                usdex.core.defineXform(stage, Sdf.Path("relative"))
+            usdex.core.defineScope(stage, Sdf.Path("relative"))
+        self.assertEqual([x.function for x in inner.getErrors()], ["usdex::core::defineXform"])
+        self.assertEqual([x.function for x in outer.getErrors()], ["usdex::core::defineScope"])
+
+    def testBatchErrors(self):
+        stage = Usd.Stage.CreateInMemory()
+        Type = usdex.core.GprimData.Type
+        gprims = [
+            usdex.core.GprimData(Type.Sphere, Sdf.Path("/A"), radius=1.0),
+            usdex.core.GprimData(Type.Sphere, Sdf.Path("relative"), radius=1.0),
+            usdex.core.GprimData(Type.Cube, Sdf.Path("/A"), size=1.0),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            with usdex.core.AuthoringErrorScope() as scope:
+                self.assertEqual(usdex.core.defineGprims(stage, gprims), [])
+                self.assertEqual(usdex.core.defineGprims(None, gprims), [])
+
+        errors = scope.getErrors()
+        self.assertEqual([x.path for x in errors], [Sdf.Path("relative"), Sdf.Path("/A"), Sdf.Path()])
+        self.assertEqual(
+            [x.code for x in errors],
+            [
+                usdex.core.AuthoringErrorCode.eInvalidLocation,
+                usdex.core.AuthoringErrorCode.eDuplicatePath,
+                usdex.core.AuthoringErrorCode.eInvalidStage,
+            ],
+        )
+        self.assertEqual({x.function for x in errors}, {"usdex::core::defineGprims"})
+        self.assertFalse(stage.GetPrimAtPath("/A"))
@@ -0,0 +1,144 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import usdex.core
+import usdex.test
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, Vt
+
+POINTS = Vt.Vec3fArray(
+    [
+        Gf.Vec3f(0.0, 0.0, 0.0),
+        Gf.Vec3f(0.0, 0.0, 1.0),
+        Gf.Vec3f(1.0, 0.0, 1.0),
+        Gf.Vec3f(1.0, 2.0, 0.0),
+    ]
+)
+
+
+class ComputePointsExtentTestCase(usdex.test.TestCase):
+
+    def testPoints(self):
+        extent = usdex.core.computePointsExtent(POINTS)
+        self.assertEqual(extent, Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 2, 1)]))
+
+        # The result matches the extent computed by OpenUSD
+        self.assertEqual(extent, UsdGeom.PointBased.ComputeExtent(POINTS))
+
+    def testEmptyPoints(self):
+        # An empty array results in an empty range
+        extent = usdex.core.computePointsExtent(Vt.Vec3fArray())
+        self.assertEqual(len(extent), 2)
+        self.assertEqual(extent[0], Gf.Range3f().GetMin())
+        self.assertEqual(extent[1], Gf.Range3f().GetMax())
+
+        # Widths do not affect an empty range
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([2.0]))
+        self.assertEqual(usdex.core.computePointsExtent(Vt.Vec3fArray(), widths), extent)
+
+    def testLargeArray(self):
+        # Arrays large enough to be reduced in parallel produce the same result
+        count = 1 << 18
+        points = Vt.Vec3fArray([Gf.Vec3f(i % 1000, -(i % 777), i * 0.001) for i in range(count)])
+        extent = usdex.core.computePointsExtent(points)
+        self.assertEqual(extent, UsdGeom.PointBased.ComputeExtent(points))
+
+    def testConstantWidths(self):
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([0.5]))
+        extent = usdex.core.computePointsExtent(POINTS, widths)
+        self.assertEqual(extent, Vt.Vec3fArray([Gf.Vec3f(-0.25, -0.25, -0.25), Gf.Vec3f(1.25, 2.25, 1.25)]))
+
+    def testVertexWidths(self):
+        # Each point is padded by its own width
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([2.0, 0.0, 0.0, 1.0]))
+        extent = usdex.core.computePointsExtent(POINTS, widths)
+        self.assertEqual(extent, Vt.Vec3fArray([Gf.Vec3f(-1, -1, -1), Gf.Vec3f(1.5, 2.5, 1)]))
+
+        # Indexed widths are equivalent to their flattened values
+        indexed = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([0.0, 1.0, 2.0]), Vt.IntArray([2, 0, 0, 1]))
+        self.assertEqual(usdex.core.computePointsExtent(POINTS, indexed), extent)
+
+    def testUniformWidths(self):
+        # Widths that are not per point are padded by the largest width
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.uniform, Vt.FloatArray([0.5, 2.0]))
+        extent = usdex.core.computePointsExtent(POINTS, widths)
+        self.assertEqual(extent, Vt.Vec3fArray([Gf.Vec3f(-1, -1, -1), Gf.Vec3f(2, 3, 2)]))
+
+
+class SetExtentTimeSamplesTestCase(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.stage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(self.stage, "/World")
+
+    def testAnimatedMesh(self):
+        mesh = usdex.core.definePolyMesh(
+            self.stage,
+            Sdf.Path("/World/Mesh"),
+            faceVertexCounts=Vt.IntArray([4]),
+            faceVertexIndices=Vt.IntArray([0, 1, 2, 3]),
+            points=POINTS,
+        )
+        pointsAttr = mesh.GetPointsAttr()
+        for time in range(5):
+            pointsAttr.Set(Vt.Vec3fArray([point * (time + 1) for point in POINTS]), time)
+
+        self.assertTrue(usdex.core.setExtentTimeSamples(mesh))
+
+        extentAttr = mesh.GetExtentAttr()
+        self.assertEqual(extentAttr.GetTimeSamples(), [0.0, 1.0, 2.0, 3.0, 4.0])
+        self.assertEqual(extentAttr.Get(Usd.TimeCode.Default()), UsdGeom.PointBased.ComputeExtent(POINTS))
+        for time in range(5):
+            self.assertEqual(extentAttr.Get(time), UsdGeom.Boundable.ComputeExtentFromPlugins(mesh, time))
+        self.assertIsValidUsd(self.stage)
+
+    def testAnimatedWidths(self):
+        # Widths may be animated independently of the points
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0]))
+        pointCloud = usdex.core.definePointCloud(self.stage, Sdf.Path("/World/Points"), POINTS, widths=widths)
+        pointCloud.GetPointsAttr().Set(POINTS, 0)
+        widthsPrimvar = UsdGeom.PrimvarsAPI(pointCloud).GetPrimvar(UsdGeom.Tokens.widths)
+        widthsPrimvar.Set(Vt.FloatArray([1.0]), 0)
+        widthsPrimvar.Set(Vt.FloatArray([2.0]), 1)
+
+        self.assertTrue(usdex.core.setExtentTimeSamples(pointCloud))
+
+        extentAttr = pointCloud.GetExtentAttr()
+        self.assertEqual(extentAttr.GetTimeSamples(), [0.0, 1.0])
+        self.assertEqual(extentAttr.Get(Usd.TimeCode.Default()), Vt.Vec3fArray([Gf.Vec3f(-0.5, -0.5, -0.5), Gf.Vec3f(1.5, 2.5, 1.5)]))
+        self.assertEqual(extentAttr.Get(0), extentAttr.Get(Usd.TimeCode.Default()))
+        self.assertEqual(extentAttr.Get(1), Vt.Vec3fArray([Gf.Vec3f(-1, -1, -1), Gf.Vec3f(2, 3, 2)]))
+
+    def testEditTargetOffset(self):
+        # Extents are authored to the edit target, accounting for its time offset
+        mesh = UsdGeom.Mesh.Define(self.stage, "/World/Mesh")
+        mesh.GetPointsAttr().Set(POINTS, 10)
+
+        sublayer = Sdf.Layer.CreateAnonymous()
+        self.stage.GetRootLayer().subLayerPaths.append(sublayer.identifier)
+        self.stage.GetRootLayer().subLayerOffsets[0] = Sdf.LayerOffset(offset=10)
+        self.stage.SetEditTarget(self.stage.GetEditTargetForLocalLayer(sublayer))
+
+        self.assertTrue(usdex.core.setExtentTimeSamples(mesh))
+        self.assertEqual(sublayer.ListTimeSamplesForPath(mesh.GetExtentAttr().GetPath()), [0.0])
+        self.assertEqual(mesh.GetExtentAttr().GetTimeSamples(), [10.0])
+
+    def testReplacesExistingOpinions(self):
+        mesh = UsdGeom.Mesh.Define(self.stage, "/World/Mesh")
+        mesh.GetPointsAttr().Set(POINTS, 1)
+        mesh.CreateExtentAttr().Set(Vt.Vec3fArray([Gf.Vec3f(0), Gf.Vec3f(0)]), 5)
+        mesh.GetExtentAttr().Set(Vt.Vec3fArray([Gf.Vec3f(0), Gf.Vec3f(0)]))
+
+        self.assertTrue(usdex.core.setExtentTimeSamples(mesh))
+        self.assertEqual(mesh.GetExtentAttr().GetTimeSamples(), [1.0])
+        self.assertIsNone(mesh.GetExtentAttr().Get(Usd.TimeCode.Default()))
+
+    def testInvalid(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdGeomPointBased")]):
+            self.assertFalse(usdex.core.setExtentTimeSamples(UsdGeom.Mesh()))
+
+        # Points must be authored
+        mesh = UsdGeom.Mesh.Define(self.stage, "/World/Mesh")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points")]):
+            self.assertFalse(usdex.core.setExtentTimeSamples(mesh))
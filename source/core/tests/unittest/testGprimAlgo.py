@@ -7,7 +7,7 @@ from typing import List, Tuple
 import omni.asset_validator
 import usdex.core
 import usdex.test
-from pxr import Gf, Usd, UsdGeom
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, Vt
 
 
 class DefinePlaneTestCase(usdex.test.DefineFunctionTestCase):
@@ -548,3 +548,151 @@ class GprimAlgoTest(usdex.test.TestCase):
         self.assertFalse(capsuleY.GetDisplayOpacityAttr().Get())
 
         self.assertIsValidUsd(stage)
+
+
+class DefineGprimsTestCase(usdex.test.TestCase):
+
+    def createTestStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        return stage
+
+    def createTestGprims(self, root: Sdf.Path) -> List[usdex.core.GprimData]:
+        Type = usdex.core.GprimData.Type
+        return [
+            usdex.core.GprimData(Type.Plane, root.AppendChild("Plane"), width=4.0, length=3.0, axis=UsdGeom.Tokens.y),
+            usdex.core.GprimData(Type.Sphere, root.AppendChild("Sphere"), radius=2.0, displayColor=Gf.Vec3f(1, 0, 0)),
+            usdex.core.GprimData(Type.Cube, root.AppendChild("Cube"), size=3.0, displayOpacity=0.5),
+            usdex.core.GprimData(Type.Cone, root.AppendChild("Cone"), radius=1.5, height=4.0, axis=UsdGeom.Tokens.x),
+            usdex.core.GprimData(Type.Cylinder, root.AppendChild("Cylinder"), radius=0.5, height=3.0),
+            usdex.core.GprimData(Type.Capsule, root.AppendChild("Capsule"), radius=0.5, height=1.0, axis=UsdGeom.Tokens.y),
+        ]
+
+    def defineExpected(self, stage: Usd.Stage, gprim: usdex.core.GprimData):
+        Type = usdex.core.GprimData.Type
+        color, opacity = gprim.displayColor, gprim.displayOpacity
+        if gprim.type == Type.Plane:
+            return usdex.core.definePlane(stage, gprim.path, gprim.width, gprim.length, gprim.axis, color, opacity)
+        if gprim.type == Type.Sphere:
+            return usdex.core.defineSphere(stage, gprim.path, gprim.radius, color, opacity)
+        if gprim.type == Type.Cube:
+            return usdex.core.defineCube(stage, gprim.path, gprim.size, color, opacity)
+        if gprim.type == Type.Cone:
+            return usdex.core.defineCone(stage, gprim.path, gprim.radius, gprim.height, gprim.axis, color, opacity)
+        if gprim.type == Type.Cylinder:
+            return usdex.core.defineCylinder(stage, gprim.path, gprim.radius, gprim.height, gprim.axis, color, opacity)
+        return usdex.core.defineCapsule(stage, gprim.path, gprim.radius, gprim.height, gprim.axis, color, opacity)
+
+    def assertSpecsEqual(self, actualSpec: Sdf.PrimSpec, expectedSpec: Sdf.PrimSpec):
+        self.assertEqual(actualSpec.specifier, expectedSpec.specifier)
+        self.assertEqual(actualSpec.typeName, expectedSpec.typeName)
+        self.assertEqual(sorted(actualSpec.attributes.keys()), sorted(expectedSpec.attributes.keys()))
+        for name, expectedAttr in expectedSpec.attributes.items():
+            actualAttr = actualSpec.attributes[name]
+            self.assertEqual(actualAttr.typeName, expectedAttr.typeName, msg=name)
+            self.assertEqual(actualAttr.variability, expectedAttr.variability, msg=name)
+            self.assertEqual(actualAttr.default, expectedAttr.default, msg=name)
+
+    def testDefineGprims(self):
+        stage = self.createTestStage()
+
+        # The batch may define gprims below ancestors that do not yet exist
+        gprims = self.createTestGprims(Sdf.Path("/World/Batch"))
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            results = usdex.core.defineGprims(stage, gprims)
+        self.assertEqual(len(results), len(gprims))
+        for result, data in zip(results, gprims):
+            self.assertTrue(result)
+            self.assertEqual(result.GetPath(), data.path)
+            self.assertEqual(result.GetExtentAttr().Get(), UsdGeom.Boundable.ComputeExtentFromPlugins(result, Usd.TimeCode.Default()))
+
+        ancestor = stage.GetPrimAtPath("/World/Batch")
+        self.assertTrue(ancestor.IsDefined())
+        self.assertEqual(ancestor.GetTypeName(), "")
+
+        # The authored scene description matches the define function of each type
+        UsdGeom.Scope.Define(stage, "/World/Single")
+        layer = stage.GetEditTarget().GetLayer()
+        for result, data in zip(results, self.createTestGprims(Sdf.Path("/World/Single"))):
+            expected = self.defineExpected(stage, data)
+            self.assertSpecsEqual(layer.GetPrimAtPath(result.GetPath()), layer.GetPrimAtPath(expected.GetPath()))
+
+        self.assertIsValidUsd(stage)
+
+    def testDefineGprimsInvalid(self):
+        stage = self.createTestStage()
+        Type = usdex.core.GprimData.Type
+
+        # An empty batch defines nothing
+        self.assertEqual(usdex.core.defineGprims(stage, []), [])
+
+        # Any invalid location prevents the entire batch from being defined
+        gprims = [
+            usdex.core.GprimData(Type.Sphere, Sdf.Path("/World/Valid")),
+            usdex.core.GprimData(Type.Cube, Sdf.Path("World/InvalidLocation")),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertEqual(usdex.core.defineGprims(stage, gprims), [])
+        self.assertFalse(stage.GetPrimAtPath("/World/Valid"))
+
+        # Each path may only be requested once
+        gprims = [
+            usdex.core.GprimData(Type.Sphere, Sdf.Path("/World/Duplicate")),
+            usdex.core.GprimData(Type.Cube, Sdf.Path("/World/Duplicate")),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*duplicate path")]):
+            self.assertEqual(usdex.core.defineGprims(stage, gprims), [])
+        self.assertFalse(stage.GetPrimAtPath("/World/Duplicate"))
+
+    def testDefineGprimInstancer(self):
+        stage = self.createTestStage()
+        Type = usdex.core.GprimData.Type
+
+        # Identical parameters share a prototype, regardless of their paths
+        gprims = [
+            usdex.core.GprimData(Type.Sphere, radius=0.5),
+            usdex.core.GprimData(Type.Cube, size=1.0),
+            usdex.core.GprimData(Type.Sphere, Sdf.Path("/Ignored"), radius=0.5),
+            usdex.core.GprimData(Type.Sphere, radius=0.5, displayColor=Gf.Vec3f(0, 1, 0)),
+        ]
+        positions = Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(10, 0, 0), Gf.Vec3f(0, 10, 0), Gf.Vec3f(0, 0, -10)])
+        rotation = Gf.Quatf(Gf.Rotation(Gf.Vec3d(0, 0, 1), 45.0).GetQuat())
+        orientations = [Gf.Quatf.GetIdentity(), rotation, Gf.Quatf.GetIdentity(), Gf.Quatf.GetIdentity()]
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            instancer = usdex.core.defineGprimInstancer(stage, Sdf.Path("/World/Instancer"), gprims, positions, orientations)
+        self.assertTrue(instancer)
+
+        prototypes = instancer.GetPrototypesRel().GetTargets()
+        prototypesPath = Sdf.Path("/World/Instancer/Prototypes")
+        self.assertEqual(prototypes, [prototypesPath.AppendChild(name) for name in ("Sphere_0", "Cube_1", "Sphere_2")])
+        self.assertEqual(stage.GetPrimAtPath("/World/Instancer/Prototypes").GetTypeName(), "Scope")
+        self.assertEqual(list(instancer.GetProtoIndicesAttr().Get()), [0, 1, 0, 2])
+        self.assertEqual(instancer.GetPositionsAttr().Get(), positions)
+        self.assertEqual(len(instancer.GetOrientationsAttr().Get()), len(gprims))
+        self.assertEqual(UsdGeom.Sphere(stage.GetPrimAtPath(prototypes[2])).GetDisplayColorAttr().Get(), [Gf.Vec3f(0, 1, 0)])
+
+        # The extent matches that computed by OpenUSD
+        expected = instancer.ComputeExtentAtTime(Usd.TimeCode.Default(), Usd.TimeCode.Default())
+        extent = instancer.GetExtentAttr().Get()
+        self.assertTrue(Gf.IsClose(extent[0], expected[0], 1e-3), f"{extent} != {expected}")
+        self.assertTrue(Gf.IsClose(extent[1], expected[1], 1e-3), f"{extent} != {expected}")
+
+        self.assertIsValidUsd(stage)
+
+    def testDefineGprimInstancerInvalid(self):
+        stage = self.createTestStage()
+        gprims = [usdex.core.GprimData(usdex.core.GprimData.Type.Sphere)]
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.core.defineGprimInstancer(stage, Sdf.Path("World/Instancer"), gprims, Vt.Vec3fArray([Gf.Vec3f(0)])))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*without any gprims")]):
+            self.assertFalse(usdex.core.defineGprimInstancer(stage, Sdf.Path("/World/Instancer"), [], Vt.Vec3fArray()))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched sizes")]):
+            self.assertFalse(usdex.core.defineGprimInstancer(stage, Sdf.Path("/World/Instancer"), gprims, Vt.Vec3fArray([Gf.Vec3f(0), Gf.Vec3f(1)])))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched sizes")]):
+            orientations = [Gf.Quatf.GetIdentity()] * 2
+            self.assertFalse(usdex.core.defineGprimInstancer(stage, Sdf.Path("/World/Instancer"), gprims, Vt.Vec3fArray([Gf.Vec3f(0)]), orientations))
+        self.assertFalse(stage.GetPrimAtPath("/World/Instancer"))
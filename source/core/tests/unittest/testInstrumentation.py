@@ -0,0 +1,67 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import usdex.core
+import usdex.test
+from pxr import Gf, Sdf, Usd, UsdGeom, Vt
+
+
+class InstrumentationTestCase(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.wasEnabled = usdex.core.isInstrumentationEnabled()
+        usdex.core.resetInstrumentationCounters()
+
+    def tearDown(self):
+        usdex.core.setInstrumentationEnabled(self.wasEnabled)
+        usdex.core.resetInstrumentationCounters()
+        super().tearDown()
+
+    def authorMesh(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(stage, "/World")
+        mesh = usdex.core.definePolyMesh(
+            stage,
+            Sdf.Path(f"/World/{usdex.core.getValidPrimName('1 mesh')}"),
+            faceVertexCounts=Vt.IntArray([4]),
+            faceVertexIndices=Vt.IntArray([0, 1, 2, 3]),
+            points=Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(0, 0, 1), Gf.Vec3f(1, 0, 1), Gf.Vec3f(1, 0, 0)]),
+        )
+        self.assertTrue(mesh)
+
+    def testDisabled(self):
+        usdex.core.setInstrumentationEnabled(False)
+        self.assertFalse(usdex.core.isInstrumentationEnabled())
+        self.authorMesh()
+        self.assertEqual(usdex.core.getInstrumentationCounters(), [])
+
+    def testEnabled(self):
+        usdex.core.setInstrumentationEnabled(True)
+        self.assertTrue(usdex.core.isInstrumentationEnabled())
+        self.authorMesh()
+        self.authorMesh()
+
+        counters = {x.name: x for x in usdex.core.getInstrumentationCounters()}
+        self.assertEqual(list(counters.keys()), sorted(counters.keys()))
+        self.assertIn("definePolyMesh", counters)
+        self.assertIn("getValidPrimName", counters)
+
+        counter = counters["definePolyMesh"]
+        self.assertEqual(counter.calls, 2)
+        self.assertGreater(counter.totalSeconds, 0)
+        self.assertGreaterEqual(counter.totalSeconds, counter.maxSeconds)
+        # 4 counts, 4 indices, and 4 points per mesh
+        self.assertEqual(counter.bytes, 2 * (4 * 4 + 4 * 4 + 4 * 12))
+
+        # name functions author no arrays
+        self.assertEqual(counters["getValidPrimName"].calls, 2)
+        self.assertEqual(counters["getValidPrimName"].bytes, 0)
+
+    def testReset(self):
+        usdex.core.setInstrumentationEnabled(True)
+        self.authorMesh()
+        self.assertNotEqual(usdex.core.getInstrumentationCounters(), [])
+        usdex.core.resetInstrumentationCounters()
+        self.assertEqual(usdex.core.getInstrumentationCounters(), [])
@@ -2,9 +2,11 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import asyncio
+
 import usdex.core
 import usdex.test
-from pxr import Sdf, Tf
+from pxr import Gf, Sdf, Tf, Usd, Vt
 
 
 class LayerAlgoTest(usdex.test.TestCase):
@@ -295,3 +297,483 @@ class LayerAlgoTest(usdex.test.TestCase):
         exportedLayer = Sdf.Layer.FindOrOpen(identifier)
         self.assertEqual(usdex.core.getUsdLayerEncoding(exportedLayer), "usdc")
         self.assertTrue(usdex.core.hasLayerAuthoringMetadata(exportedLayer))
+
+    def testLayerWriteOptions(self):
+        options = usdex.core.LayerWriteOptions()
+        self.assertEqual(options.encoding, "")
+        self.assertEqual(usdex.core.getLayerWriteFileFormatArgs("test.usd", options), (True, {}, ""))
+
+        # The encoding is supplied as the "format" argument for .usd files, overriding any existing value
+        options = usdex.core.LayerWriteOptions(encoding="usda")
+        result = usdex.core.getLayerWriteFileFormatArgs("test.usd", options, {"format": "usdc", "foo": "bar"})
+        self.assertEqual(result, (True, {"format": "usda", "foo": "bar"}, ""))
+
+        # A matching extension does not require an argument
+        self.assertEqual(usdex.core.getLayerWriteFileFormatArgs("test.usda", options), (True, {}, ""))
+
+        # A conflicting extension or unknown encoding is invalid
+        valid, _, reason = usdex.core.getLayerWriteFileFormatArgs("test.usdc", options)
+        self.assertFalse(valid)
+        self.assertRegex(reason, 'The "usda" encoding can not be written to "test.usdc"')
+        valid, _, reason = usdex.core.getLayerWriteFileFormatArgs("test.usd", usdex.core.LayerWriteOptions("usdz"))
+        self.assertFalse(valid)
+        self.assertRegex(reason, '"usdz" is not a valid USD encoding')
+
+    def testSaveLayerWithWriteOptions(self):
+        identifier = self.tmpFile("test", "usd")
+        layer = Sdf.Layer.CreateNew(identifier)
+        Sdf.CreatePrimInLayer(layer, "/Root")
+        self.assertEqual(usdex.core.getUsdLayerEncoding(layer), "usdc")
+
+        # A .usd layer can be re-encoded when it is saved
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.* as usda")]):
+            self.assertTrue(usdex.core.saveLayer(layer, usdex.core.LayerWriteOptions("usda"), LayerAlgoTest.defaultAuthoringMetadata))
+        self.assertFalse(layer.dirty)
+        self.assertEqual(usdex.core.getUsdLayerEncoding(layer), "usda")
+        self.assertIsNotNone(layer.GetPrimAtPath("/Root"))
+        self.assertTrue(usdex.core.hasLayerAuthoringMetadata(layer))
+        with open(identifier, "rb") as f:
+            self.assertTrue(f.read().startswith(b"#usda"))
+
+        # The current encoding is used as normal
+        Sdf.CreatePrimInLayer(layer, "/Other")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving")]):
+            self.assertTrue(usdex.core.saveLayer(layer, usdex.core.LayerWriteOptions("usda")))
+        self.assertEqual(usdex.core.getUsdLayerEncoding(layer), "usda")
+
+        # A conflicting encoding is invalid
+        usdaLayer = self.tmpLayer()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid write options")]):
+            self.assertFalse(usdex.core.saveLayer(usdaLayer, usdex.core.LayerWriteOptions("usdc")))
+
+    def testExportLayerWithWriteOptions(self):
+        layer = Sdf.Layer.CreateAnonymous()
+        for encoding in ("usda", "usdc"):
+            identifier = self.tmpFile("test", "usd")
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+                success = usdex.core.exportLayer(
+                    layer,
+                    identifier,
+                    LayerAlgoTest.defaultAuthoringMetadata,
+                    writeOptions=usdex.core.LayerWriteOptions(encoding),
+                )
+            self.assertTrue(success)
+            self.assertEqual(usdex.core.getUsdLayerEncoding(Sdf.Layer.FindOrOpen(identifier)), encoding)
+
+        identifier = self.tmpFile("test", "usda")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid write options")]):
+            success = usdex.core.exportLayer(layer, identifier, LayerAlgoTest.defaultAuthoringMetadata, None, usdex.core.LayerWriteOptions("usdc"))
+        self.assertFalse(success)
+
+    def testSaveLayerAsync(self):
+        layer: Sdf.Layer = self.tmpLayer()
+        layer.defaultPrim = "Saved"
+        Sdf.CreatePrimInLayer(layer, "/Saved")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, f'Saving.* with comment "{self._testMethodName}"')]):
+            future = usdex.core.saveLayerAsync(layer, LayerAlgoTest.defaultAuthoringMetadata, comment=self._testMethodName)
+        self.assertIsInstance(future, usdex.core.SaveFuture)
+
+        # The layer can be edited while the save is in flight, without affecting the saved file
+        Sdf.CreatePrimInLayer(layer, "/Unsaved")
+        self.assertTrue(future.result())
+        self.assertTrue(future.done())
+        self.assertEqual(layer.comment, self._testMethodName)
+        self.assertTrue(layer.dirty)
+
+        savedLayer = Sdf.Layer.OpenAsAnonymous(layer.realPath)
+        self.assertEqual(savedLayer.comment, self._testMethodName)
+        self.assertEqual(savedLayer.customLayerData, self.__expectedAuthoringMetadata())
+        self.assertEqual(savedLayer.defaultPrim, "Saved")
+        self.assertIsNotNone(savedLayer.GetPrimAtPath("/Saved"))
+        self.assertIsNone(savedLayer.GetPrimAtPath("/Unsaved"))
+
+        # Successive saves are written in the order they were requested
+        futures = []
+        for i in range(10):
+            layer.defaultPrim = f"Prim{i}"
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving")]):
+                futures.append(usdex.core.saveLayerAsync(layer))
+        self.assertTrue(all(x.result() for x in futures))
+        self.assertEqual(Sdf.Layer.OpenAsAnonymous(layer.realPath).defaultPrim, "Prim9")
+
+    def testSaveLayerAsyncPreservesEncoding(self):
+        # The encoding of a .usd layer is preserved
+        for encoding in ("usda", "usdc"):
+            identifier = self.tmpFile("test", "usd")
+            layer = Sdf.Layer.CreateNew(identifier, args={"format": encoding})
+            Sdf.CreatePrimInLayer(layer, "/Root")
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving")]):
+                self.assertTrue(usdex.core.saveLayerAsync(layer).result())
+            self.assertEqual(usdex.core.getUsdLayerEncoding(Sdf.Layer.OpenAsAnonymous(identifier)), encoding)
+
+    def testExportLayerAsync(self):
+        layer = Sdf.Layer.CreateAnonymous()
+        layer.comment = "Existing Comment"
+        Sdf.CreatePrimInLayer(layer, "/Exported")
+
+        # An invalid identifier results in a future which is already complete
+        identifier = self.tmpFile("test", "foo")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid identifier")]):
+            future = usdex.core.exportLayerAsync(layer, identifier, LayerAlgoTest.defaultAuthoringMetadata)
+        self.assertTrue(future.done())
+        self.assertFalse(future.result())
+
+        # The comment is only authored in the exported layer
+        identifier = self.tmpFile("test", "usda")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, 'Exporting.*with comment "Export Comment"')]):
+            future = usdex.core.exportLayerAsync(layer, identifier, LayerAlgoTest.defaultAuthoringMetadata, comment="Export Comment")
+        Sdf.CreatePrimInLayer(layer, "/Unexported")
+        self.assertTrue(future.result())
+        self.assertEqual(layer.comment, "Existing Comment")
+
+        exportedLayer = Sdf.Layer.FindOrOpen(identifier)
+        self.assertEqual(exportedLayer.comment, "Export Comment")
+        self.assertTrue(usdex.core.hasLayerAuthoringMetadata(exportedLayer))
+        self.assertIsNotNone(exportedLayer.GetPrimAtPath("/Exported"))
+        self.assertIsNone(exportedLayer.GetPrimAtPath("/Unexported"))
+
+        # File format arguments are respected by the output file format
+        identifier = self.tmpFile("test", "usd")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+            future = usdex.core.exportLayerAsync(layer, identifier, LayerAlgoTest.defaultAuthoringMetadata, fileFormatArgs={"format": "usda"})
+        self.assertTrue(future.result())
+        self.assertEqual(usdex.core.getUsdLayerEncoding(Sdf.Layer.FindOrOpen(identifier)), "usda")
+
+    def testAwaitSave(self):
+        layers = [self.tmpLayer() for _ in range(3)]
+
+        async def save():
+            futures = [usdex.core.saveLayerAsync(layer, LayerAlgoTest.defaultAuthoringMetadata) for layer in layers]
+            return await asyncio.gather(*futures)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving")] * len(layers)):
+            results = asyncio.run(save())
+        self.assertEqual(results, [True] * len(layers))
+        for layer in layers:
+            self.assertTrue(usdex.core.hasLayerAuthoringMetadata(Sdf.Layer.OpenAsAnonymous(layer.realPath)))
+
+
+    def testExportLayerToBuffer(self):
+        layer = Sdf.Layer.CreateAnonymous()
+        layer.comment = "Existing Comment"
+        Sdf.CreatePrimInLayer(layer, "/Exported")
+
+        # Anonymous layers are exported as usda by default, with the comment only authored in the exported data
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, 'Exporting.* as usda with comment "Export Comment"')]):
+            data = usdex.core.exportLayerToBuffer(layer, LayerAlgoTest.defaultAuthoringMetadata, comment="Export Comment")
+        self.assertIsInstance(data, bytes)
+        self.assertTrue(data.startswith(b"#usda"))
+        self.assertEqual(layer.comment, "Existing Comment")
+        self.assertTrue(usdex.core.hasLayerAuthoringMetadata(layer))
+
+        exportedLayer = Sdf.Layer.CreateAnonymous(".usda")
+        self.assertTrue(exportedLayer.ImportFromString(data.decode("utf-8")))
+        self.assertEqual(exportedLayer.comment, "Export Comment")
+        self.assertEqual(exportedLayer.customLayerData, self.__expectedAuthoringMetadata())
+        self.assertIsNotNone(exportedLayer.GetPrimAtPath("/Exported"))
+
+        # The usdc encoding produces the same bytes as exporting to a file
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting.* as usdc")]):
+            data = usdex.core.exportLayerToBuffer(layer, LayerAlgoTest.defaultAuthoringMetadata, writeOptions=usdex.core.LayerWriteOptions("usdc"))
+        self.assertTrue(data.startswith(b"PXR-USDC"))
+        identifier = self.tmpFile("test", "usdc")
+        with open(identifier, "wb") as f:
+            f.write(data)
+        exportedLayer = Sdf.Layer.OpenAsAnonymous(identifier)
+        self.assertEqual(exportedLayer.comment, "Existing Comment")
+        self.assertIsNotNone(exportedLayer.GetPrimAtPath("/Exported"))
+
+        # An invalid encoding is rejected
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid write options")]):
+            data = usdex.core.exportLayerToBuffer(layer, LayerAlgoTest.defaultAuthoringMetadata, writeOptions=usdex.core.LayerWriteOptions("usdz"))
+        self.assertIsNone(data)
+
+    def testExportLayerToCallback(self):
+        layer = Sdf.Layer.CreateAnonymous()
+        for i in range(20):
+            Sdf.CreatePrimInLayer(layer, f"/Prim{i}")
+
+        for encoding in ("usda", "usdc"):
+            options = usdex.core.LayerWriteOptions(encoding)
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+                expected = usdex.core.exportLayerToBuffer(layer, LayerAlgoTest.defaultAuthoringMetadata, writeOptions=options)
+
+            # The chunks are passed in order and are no larger than the chunk size
+            chunks = []
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+                success = usdex.core.exportLayerToCallback(layer, chunks.append, LayerAlgoTest.defaultAuthoringMetadata, None, options, chunkSize=64)
+            self.assertTrue(success)
+            self.assertGreater(len(chunks), 1)
+            self.assertTrue(all(len(x) <= 64 for x in chunks))
+            self.assertEqual(b"".join(chunks), expected)
+
+            # Returning False aborts the export
+            chunks = []
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+                success = usdex.core.exportLayerToCallback(
+                    layer,
+                    lambda x: chunks.append(x) or len(chunks) < 2,
+                    LayerAlgoTest.defaultAuthoringMetadata,
+                    comment="Aborted",
+                    writeOptions=options,
+                    chunkSize=64,
+                )
+            self.assertFalse(success)
+            self.assertEqual(len(chunks), 2)
+            self.assertEqual(layer.comment, "")
+
+        # An exception raised by the callback is raised once the export has returned
+        def fail(data):
+            raise ValueError("upload failed")
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+            with self.assertRaisesRegex(ValueError, "upload failed"):
+                usdex.core.exportLayerToCallback(layer, fail, LayerAlgoTest.defaultAuthoringMetadata, comment="Failed")
+        self.assertEqual(layer.comment, "")
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid SdfLayer")]):
+            self.assertFalse(usdex.core.exportLayerToCallback(None, chunks.append, LayerAlgoTest.defaultAuthoringMetadata))
+
+class LayerChangeTrackerTestCase(usdex.test.TestCase):
+
+    def __createBaseLayer(self):
+        layer = Sdf.Layer.CreateAnonymous()
+        layer.defaultPrim = "World"
+        world = Sdf.CreatePrimInLayer(layer, "/World")
+        world.specifier = Sdf.SpecifierDef
+        world.typeName = "Xform"
+        for name in ("A", "B", "C"):
+            prim = Sdf.CreatePrimInLayer(layer, f"/World/{name}")
+            prim.specifier = Sdf.SpecifierDef
+            prim.typeName = "Cube"
+            attr = Sdf.AttributeSpec(prim, "size", Sdf.ValueTypeNames.Double)
+            attr.default = 1.0
+        return layer
+
+    def __exportBase(self, layer):
+        identifier = self.tmpFile("base", "usda")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+            self.assertTrue(usdex.core.exportLayer(layer, identifier, self.defaultAuthoringMetadata))
+        return Sdf.Layer.FindOrOpen(identifier)
+
+    def testChangedPaths(self):
+        layer = self.__createBaseLayer()
+        tracker = usdex.core.LayerChangeTracker(layer)
+        self.assertTrue(tracker.isValid())
+        self.assertEqual(tracker.getLayer(), layer)
+        self.assertFalse(tracker.hasChanges())
+        self.assertEqual(tracker.getChangedPaths(), [])
+
+        layer.GetAttributeAtPath("/World/B.size").default = 2.0
+        layer.GetPrimAtPath("/World/A").kind = "component"
+        rel = Sdf.RelationshipSpec(layer.GetPrimAtPath("/World/C"), "targets")
+        rel.targetPathList.Append("/World/A")
+        layer.comment = "Edited"
+
+        self.assertTrue(tracker.hasChanges())
+        self.assertEqual(
+            tracker.getChangedPaths(),
+            [Sdf.Path("/"), Sdf.Path("/World/A"), Sdf.Path("/World/B.size"), Sdf.Path("/World/C.targets")],
+        )
+
+        tracker.clear()
+        self.assertFalse(tracker.hasChanges())
+
+        # Changes to other layers are not recorded
+        self.__createBaseLayer()
+        self.assertFalse(tracker.hasChanges())
+
+    def testWriteDelta(self):
+        layer = self.__createBaseLayer()
+        tracker = usdex.core.LayerChangeTracker(layer)
+
+        layer.GetAttributeAtPath("/World/B.size").default = 2.0
+        layer.GetPrimAtPath("/World/A").kind = "component"
+        added = Sdf.CreatePrimInLayer(layer, "/World/D/E")
+        added.specifier = Sdf.SpecifierDef
+        layer.GetPrimAtPath("/World").RemoveNameChild(layer.GetPrimAtPath("/World/C"))
+
+        delta = Sdf.Layer.CreateAnonymous()
+        self.assertTrue(tracker.writeDelta(delta))
+        self.assertTrue(tracker.hasChanges())
+
+        # The delta only holds the changed specs, and scaffolding overs for their ancestors
+        self.assertEqual(delta.GetAttributeAtPath("/World/B.size").default, 2.0)
+        self.assertEqual(delta.GetPrimAtPath("/World/B").specifier, Sdf.SpecifierOver)
+        self.assertEqual(delta.GetPrimAtPath("/World/A").kind, "component")
+        self.assertEqual(delta.GetPrimAtPath("/World/A").typeName, "Cube")
+        self.assertIsNone(delta.GetAttributeAtPath("/World/A.size"))
+        self.assertIsNotNone(delta.GetPrimAtPath("/World/D/E"))
+        self.assertIsNone(delta.GetPrimAtPath("/World/C"))
+        changes = delta.customLayerData["usdex:delta"]
+        self.assertEqual(list(changes["removed"]), ["/World/C"])
+
+        # An invalid delta layer produces an error
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid delta SdfLayer")]):
+            self.assertFalse(tracker.writeDelta(layer))
+
+    def testApplyDelta(self):
+        layer = self.__createBaseLayer()
+        baseLayer = self.__exportBase(layer)
+        tracker = usdex.core.LayerChangeTracker(layer)
+
+        # Export several deltas, each holding a subset of the edits
+        deltas = []
+        edits = [
+            lambda: setattr(layer.GetAttributeAtPath("/World/B.size"), "default", 2.0),
+            lambda: setattr(layer.GetPrimAtPath("/World/A"), "kind", "component"),
+            lambda: Sdf.CreatePrimInLayer(layer, "/World/D/E"),
+            lambda: layer.GetPrimAtPath("/World").RemoveNameChild(layer.GetPrimAtPath("/World/C")),
+            lambda: setattr(layer, "defaultPrim", "Other"),
+        ]
+        for edit in edits:
+            edit()
+            identifier = self.tmpFile("delta", "usda")
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+                self.assertTrue(tracker.exportDelta(identifier, self.defaultAuthoringMetadata))
+            self.assertFalse(tracker.hasChanges())
+            deltas.append(Sdf.Layer.FindOrOpen(identifier))
+
+        for delta in deltas:
+            self.assertTrue(usdex.core.applyLayerDelta(baseLayer, delta))
+
+        # The flattened base layer matches the edited layer
+        self.assertNotIn("usdex:delta", baseLayer.customLayerData)
+        self.assertEqual(baseLayer.defaultPrim, "Other")
+        self.assertEqual(baseLayer.GetAttributeAtPath("/World/B.size").default, 2.0)
+        self.assertEqual(baseLayer.GetAttributeAtPath("/World/A.size").default, 1.0)
+        self.assertEqual(baseLayer.GetPrimAtPath("/World/A").kind, "component")
+        self.assertIsNotNone(baseLayer.GetPrimAtPath("/World/D/E"))
+        self.assertIsNone(baseLayer.GetPrimAtPath("/World/C"))
+        self.assertEqual(list(baseLayer.GetPrimAtPath("/World").nameChildren.keys()), ["A", "B", "D"])
+
+    def testReplacedContent(self):
+        layer = self.__createBaseLayer()
+        baseLayer = self.__exportBase(layer)
+        tracker = usdex.core.LayerChangeTracker(layer)
+
+        # Replacing the content of the layer requires the entire layer to be written
+        layer.TransferContent(Sdf.Layer.CreateAnonymous())
+        Sdf.CreatePrimInLayer(layer, "/Replaced")
+        self.assertEqual(tracker.getChangedPaths(), [Sdf.Path("/")])
+
+        delta = Sdf.Layer.CreateAnonymous()
+        self.assertTrue(tracker.writeDelta(delta))
+        self.assertTrue(usdex.core.applyLayerDelta(baseLayer, delta))
+        self.assertIsNone(baseLayer.GetPrimAtPath("/World"))
+        self.assertIsNotNone(baseLayer.GetPrimAtPath("/Replaced"))
+
+    def testInvalid(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid SdfLayer")]):
+            tracker = usdex.core.LayerChangeTracker(None)
+        self.assertFalse(tracker.isValid())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid tracked SdfLayer")]):
+            self.assertFalse(tracker.writeDelta(Sdf.Layer.CreateAnonymous()))
+
+        # A layer which was not written by a tracker can not be applied
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*missing delta metadata")]):
+            self.assertFalse(usdex.core.applyLayerDelta(Sdf.Layer.CreateAnonymous(), Sdf.Layer.CreateAnonymous()))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid delta SdfLayer")]):
+            self.assertFalse(usdex.core.applyLayerDelta(Sdf.Layer.CreateAnonymous(), None))
+
+
+class LayerMemoryReportTestCase(usdex.test.TestCase):
+
+    def createLayer(self):
+        layer = Sdf.Layer.CreateAnonymous()
+        points = Vt.Vec3fArray([Gf.Vec3f(i, 0, 0) for i in range(8)])
+        indices = Vt.IntArray([0, 1, 2, 3])
+        for name in ("A", "B"):
+            prim = Sdf.CreatePrimInLayer(layer, f"/World/{name}")
+            prim.specifier = Sdf.SpecifierDef
+            # The same array authored to both prims shares its storage
+            Sdf.AttributeSpec(prim, "points", Sdf.ValueTypeNames.Point3fArray).default = points
+            Sdf.AttributeSpec(prim, "faceVertexIndices", Sdf.ValueTypeNames.IntArray).default = indices
+        prim = layer.GetPrimAtPath("/World/B")
+        Sdf.AttributeSpec(prim, "primvars:st", Sdf.ValueTypeNames.TexCoord2fArray).default = Vt.Vec2fArray(4)
+        Sdf.AttributeSpec(prim, "primvars:st:indices", Sdf.ValueTypeNames.IntArray).default = Vt.IntArray(8)
+        attr = Sdf.AttributeSpec(prim, "visibility", Sdf.ValueTypeNames.Token)
+        layer.SetTimeSample(attr.path, 0.0, "inherited")
+        layer.SetTimeSample(attr.path, 1.0, "invisible")
+        return layer
+
+    def assertRolesSum(self, size):
+        self.assertEqual(size.pointsBytes + size.indicesBytes + size.primvarsBytes + size.otherBytes, size.serializedBytes)
+        self.assertEqual(size.detachedBytes + size.sharedBytes, size.inMemoryBytes)
+
+    def testLayerReport(self):
+        layer = self.createLayer()
+        report = usdex.core.computeLayerMemoryReport(layer)
+        self.assertEqual(report.identifier, layer.identifier)
+        self.assertEqual(report.prims, [Sdf.Path("/World"), Sdf.Path("/World/A"), Sdf.Path("/World/B")])
+        self.assertEqual(len(report.subtrees), len(report.prims))
+
+        total = report.total
+        self.assertRolesSum(total)
+        self.assertEqual(total.pointsBytes, 2 * 8 * 12)
+        self.assertEqual(total.indicesBytes, 2 * 4 * 4 + 8 * 4)
+        self.assertEqual(total.primvarsBytes, 4 * 8)
+        self.assertGreater(total.otherBytes, 0)
+        self.assertEqual(total.timeSampleBytes, total.otherBytes)
+
+        # The shared points and indices are only held in memory once, and are counted by the first prim to reference them
+        self.assertEqual(total.inMemoryBytes, total.serializedBytes - (8 * 12 + 4 * 4))
+        self.assertEqual(total.sharedBytes, 8 * 12 + 4 * 4)
+        a, b = report.subtrees[1], report.subtrees[2]
+        self.assertEqual(a.inMemoryBytes, a.serializedBytes)
+        self.assertEqual(a.sharedBytes, a.inMemoryBytes)
+        self.assertEqual(b.sharedBytes, 0)
+        self.assertEqual(b.inMemoryBytes, b.serializedBytes - (8 * 12 + 4 * 4))
+
+        # The root prim subtree includes both children
+        world = report.subtrees[0]
+        self.assertRolesSum(world)
+        self.assertEqual(world.serializedBytes, a.serializedBytes + b.serializedBytes)
+        self.assertEqual(world.serializedBytes, total.serializedBytes)
+
+    def testDistinctArraysInUsdc(self):
+        # A usdc layer constructs a new value for each query, so distinct arrays of the same size must not be mistaken for shared storage
+        identifier = self.tmpFile("distinct", "usdc")
+        layer = Sdf.Layer.CreateNew(identifier)
+        count = 32
+        for i in range(count):
+            prim = Sdf.CreatePrimInLayer(layer, f"/World/Mesh_{i}")
+            prim.specifier = Sdf.SpecifierDef
+            attr = Sdf.AttributeSpec(prim, "points", Sdf.ValueTypeNames.Point3fArray)
+            attr.default = Vt.Vec3fArray([Gf.Vec3f(i, j, 0) for j in range(64)])
+            for time in range(4):
+                layer.SetTimeSample(attr.path, float(time), Vt.Vec3fArray([Gf.Vec3f(i, j, time + 1) for j in range(64)]))
+        self.assertTrue(layer.Save())
+        del layer
+
+        layer = Sdf.Layer.FindOrOpen(identifier)
+        report = usdex.core.computeLayerMemoryReport(layer)
+        self.assertEqual(report.total.pointsBytes, count * 5 * 64 * 12)
+        self.assertEqual(report.total.sharedBytes, 0)
+        self.assertEqual(report.total.inMemoryBytes, report.total.serializedBytes)
+
+    def testVariants(self):
+        layer = Sdf.Layer.CreateAnonymous()
+        prim = Sdf.CreatePrimInLayer(layer, "/World{shape=cube}Mesh")
+        Sdf.AttributeSpec(prim, "points", Sdf.ValueTypeNames.Point3fArray).default = Vt.Vec3fArray(4)
+        report = usdex.core.computeLayerMemoryReport(layer)
+        self.assertEqual(report.prims, [Sdf.Path("/World"), Sdf.Path("/World/Mesh")])
+        self.assertEqual(report.subtrees[0].pointsBytes, 4 * 12)
+        self.assertEqual(report.total.pointsBytes, 4 * 12)
+
+    def testStageReport(self):
+        stage = Usd.Stage.CreateInMemory()
+        stage.GetRootLayer().subLayerPaths.append(self.createLayer().identifier)
+        reports = usdex.core.computeStageMemoryReport(stage)
+        self.assertEqual(len(reports), len(stage.GetUsedLayers()))
+        self.assertEqual([x.identifier for x in reports], sorted(x.identifier for x in reports))
+        self.assertEqual(sum(x.total.pointsBytes for x in reports), 2 * 8 * 12)
+
+    def testInvalid(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid layer")]):
+            report = usdex.core.computeLayerMemoryReport(None)
+        self.assertEqual(report.identifier, "")
+        self.assertEqual(report.prims, [])
+        self.assertEqual(report.total.serializedBytes, 0)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid stage")]):
+            self.assertEqual(usdex.core.computeStageMemoryReport(None), [])
@@ -55,6 +55,10 @@ class LightAlgoTest(usdex.test.TestCase):
         self.assertTrue(intensityAttr.IsAuthored())
         self.assertAlmostEqual(intensityAttr.Get(), intensity, 5)
 
+        # check the closed form extent matches the UsdLux boundable plugin
+        if isinstance(light, UsdGeom.Boundable):
+            self.assertEqual(light.GetExtentAttr().Get(), UsdGeom.Boundable.ComputeExtentFromPlugins(light, Usd.TimeCode.Default()))
+
         # check texture path if supplied
         if texturePath is not None:
             texPathAttr = usdex.core.getLightAttr(light.GetTextureFileAttr())
@@ -147,6 +151,39 @@ class LightAlgoTest(usdex.test.TestCase):
         self.assertEqual(usdex.core.getLightAttr(distantLight.GetAngleAttr()).Get(), distantLight.GetAngleAttr().Get())
 
 
+    def testDefineRectLights(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        expected = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(expected, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+
+        paths = [Sdf.Path(f"/World/Lights/Rect{i}") for i in range(3)]
+        widths = [1.0, 2.0, 3.0]
+        heights = [4.0, 5.0, 6.0]
+        intensities = [10.0, 20.0, 30.0]
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            lights = usdex.core.defineRectLights(stage, paths, widths, heights, intensities)
+        self.assertEqual(len(lights), len(paths))
+        for light, width, height, intensity in zip(lights, widths, heights, intensities):
+            self._checkRectLightAttrs(light, width, height, intensity)
+
+        # The authored scene description matches defineRectLight
+        usdex.core.defineScope(expected, "/World/Lights")
+        usdex.core.defineScope(stage, "/World/Lights")
+        for path, width, height, intensity in zip(paths, widths, heights, intensities):
+            usdex.core.defineRectLight(expected, path, width, height, intensity)
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected.GetRootLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+        # The intensities are optional, but all other arguments must match the paths
+        lights = usdex.core.defineRectLights(stage, [Sdf.Path("/World/Default")], [1.0], [1.0])
+        self.assertEqual(lights[0].GetIntensityAttr().Get(), 1.0)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched sizes")]):
+            self.assertEqual(usdex.core.defineRectLights(stage, [Sdf.Path("/World/Mismatched")], [1.0, 2.0], [1.0]), [])
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*duplicate path")]):
+            self.assertEqual(usdex.core.defineRectLights(stage, [Sdf.Path("/World/Duplicate")] * 2, [1.0] * 2, [1.0] * 2), [])
+
+
 class DefineDomeLightTestCase(usdex.test.DefineFunctionTestCase):
 
     # Configure the DefineFunctionTestCase
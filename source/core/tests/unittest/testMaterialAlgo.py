@@ -106,6 +106,107 @@ class MaterialAlgoTest(usdex.test.TestCase):
         self.assertFalse(instancedCube.HasAPI(UsdShade.MaterialBindingAPI))
         self.assertIsValidUsd(stage)
 
+    def testBindMaterials(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materials = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName())).GetPrim()
+        geometry = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild("Geometry")).GetPrim()
+        red = usdex.core.createMaterial(materials, "Red")
+        blue = usdex.core.createMaterial(materials, "Blue")
+        cubes = [UsdGeom.Cube.Define(stage, geometry.GetPath().AppendChild(f"Cube{i}")).GetPrim() for i in range(4)]
+
+        # The result matches binding each prim individually
+        self.assertTrue(usdex.core.bindMaterials(cubes, [red, blue, red, blue]))
+        for cube, material in zip(cubes, [red, blue, red, blue]):
+            self.assertTrue(cube.HasAPI(UsdShade.MaterialBindingAPI))
+            self.assertEqual(UsdShade.MaterialBindingAPI(cube).GetDirectBindingRel().GetTargets(), [material.GetPath()])
+            self.assertEqual(UsdShade.MaterialBindingAPI(cube).ComputeBoundMaterial()[0].GetPath(), material.GetPath())
+        self.assertIsValidUsd(stage)
+
+        # A single material is bound to every prim, replacing the existing bindings
+        self.assertTrue(usdex.core.bindMaterials(cubes, [blue]))
+        for cube in cubes:
+            self.assertEqual(UsdShade.MaterialBindingAPI(cube).GetDirectBindingRel().GetTargets(), [blue.GetPath()])
+        self.assertEqual(cubes[0].GetAppliedSchemas(), ["MaterialBindingAPI"])
+
+        # Bindings are authored to the edit target, even if the prims are defined in another layer
+        sublayer = Sdf.Layer.CreateAnonymous()
+        stage.GetRootLayer().subLayerPaths.append(sublayer.identifier)
+        with Usd.EditContext(stage, sublayer):
+            self.assertTrue(usdex.core.bindMaterials(cubes[:1], [red]))
+        spec = sublayer.GetPrimAtPath(cubes[0].GetPath())
+        self.assertEqual(spec.specifier, Sdf.SpecifierOver)
+        self.assertEqual(list(spec.relationships["material:binding"].targetPathList.explicitItems), [red.GetPath()])
+
+        # Nothing is authored if any prim or material is invalid
+        invalidMaterial = UsdShade.Material(materials.GetChild("InvalidPath"))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*material.*is not valid")]):
+            self.assertFalse(usdex.core.bindMaterials(cubes[:2], [red, invalidMaterial]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.core.bindMaterials([cubes[0], Usd.Prim()], [red]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*number of materials")]):
+            self.assertFalse(usdex.core.bindMaterials(cubes, [red, blue]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*empty")]):
+            self.assertFalse(usdex.core.bindMaterials([], [red]))
+        self.assertEqual(UsdShade.MaterialBindingAPI(cubes[1]).GetDirectBindingRel().GetTargets(), [blue.GetPath()])
+
+    def testBindMaterialsCollapse(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materials = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName())).GetPrim()
+        geometry = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild("Geometry")).GetPrim()
+        red = usdex.core.createMaterial(materials, "Red")
+        blue = usdex.core.createMaterial(materials, "Blue")
+
+        # Two assemblies of cubes, one of which contains a mesh with subsets
+        prims = []
+        for name in ("A", "B"):
+            xform = UsdGeom.Xform.Define(stage, geometry.GetPath().AppendChild(name))
+            for i in range(3):
+                prims.append(UsdGeom.Cube.Define(stage, xform.GetPath().AppendChild(f"Cube{i}")).GetPrim())
+        mesh = UsdGeom.Mesh.Define(stage, geometry.GetPath().AppendChild("B").AppendChild("Mesh"))
+        subsets = [UsdGeom.Subset.Define(stage, mesh.GetPath().AppendChild(f"Subset{i}")).GetPrim() for i in range(2)]
+
+        # Every child of A shares a material, so A is bound instead. The children of the mesh share a material, but the mesh is a gprim
+        boundMaterials = [red, red, red, blue, blue, blue, red, red]
+        self.assertTrue(usdex.core.bindMaterials(prims + subsets, boundMaterials, collapseToAncestors=True))
+        xformA = geometry.GetChild("A")
+        self.assertEqual(UsdShade.MaterialBindingAPI(xformA).GetDirectBindingRel().GetTargets(), [red.GetPath()])
+        for prim in prims[:3]:
+            self.assertFalse(prim.HasAPI(UsdShade.MaterialBindingAPI))
+        self.assertFalse(mesh.GetPrim().HasAPI(UsdShade.MaterialBindingAPI))
+        self.assertFalse(geometry.HasAPI(UsdShade.MaterialBindingAPI))
+        for prim in prims[3:] + subsets:
+            self.assertTrue(prim.HasAPI(UsdShade.MaterialBindingAPI))
+
+        # The resolved materials match binding each prim individually
+        for prim, material in zip(prims + subsets, boundMaterials):
+            self.assertEqual(UsdShade.MaterialBindingAPI(prim).ComputeBoundMaterial()[0].GetPath(), material.GetPath())
+
+        # A collapsed parent is in turn collapsed onto its own parent
+        nested = UsdGeom.Xform.Define(stage, geometry.GetPath().AppendChild("Nested")).GetPrim()
+        leaves = []
+        for name in ("X", "Y"):
+            group = UsdGeom.Xform.Define(stage, nested.GetPath().AppendChild(name))
+            leaves.extend(UsdGeom.Cube.Define(stage, group.GetPath().AppendChild(f"Cube{i}")).GetPrim() for i in range(2))
+        self.assertTrue(usdex.core.bindMaterials(leaves, [blue], collapseToAncestors=True))
+        self.assertEqual(UsdShade.MaterialBindingAPI(nested).GetDirectBindingRel().GetTargets(), [blue.GetPath()])
+        self.assertFalse(nested.GetChild("X").HasAPI(UsdShade.MaterialBindingAPI))
+        self.assertFalse(nested.GetChild("Y").HasAPI(UsdShade.MaterialBindingAPI))
+        for leaf in leaves:
+            self.assertFalse(leaf.HasAPI(UsdShade.MaterialBindingAPI))
+            self.assertEqual(UsdShade.MaterialBindingAPI(leaf).ComputeBoundMaterial()[0].GetPath(), blue.GetPath())
+
+        # A child with a binding of its own prevents the collapse, as it would otherwise override the parent
+        xformC = UsdGeom.Xform.Define(stage, geometry.GetPath().AppendChild("C")).GetPrim()
+        cubes = [UsdGeom.Cube.Define(stage, xformC.GetPath().AppendChild(f"Cube{i}")).GetPrim() for i in range(2)]
+        self.assertTrue(usdex.core.bindMaterial(cubes[0], blue))
+        self.assertTrue(usdex.core.bindMaterials(cubes, [red], collapseToAncestors=True))
+        self.assertFalse(xformC.HasAPI(UsdShade.MaterialBindingAPI))
+        for cube in cubes:
+            self.assertEqual(UsdShade.MaterialBindingAPI(cube).ComputeBoundMaterial()[0].GetPath(), red.GetPath())
+        self.assertIsValidUsd(stage)
+
     def testBindMaterialSubsets(self):
         stage = Usd.Stage.CreateInMemory()
         usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
@@ -327,6 +428,37 @@ class MaterialAlgoTest(usdex.test.TestCase):
         self.assertTrue(Gf.IsClose(roundTripPurpleSrgb, purpleSrgb, 1e-6))
         self.assertTrue(Gf.IsClose(roundTripBlackSrgb, blackSrgb, 1e-6))
 
+    def testColorSpaceArrayConversions(self):
+        # The array conversions are identical to converting each color, including 8-bit values which are looked up rather than computed
+        colors = [Gf.Vec3f(i / 255.0, (255 - i) / 255.0, (i % 7) * 0.1234) for i in range(256)]
+        colors += [Gf.Vec3f(-0.5, 0.04045, 1.5), Gf.Vec3f(0.0031308, 0.5000001, float("inf"))]
+        # Arrays large enough to be converted in parallel produce the same results
+        colors *= 128
+        srgb = Vt.Vec3fArray(colors)
+
+        linear = usdex.core.sRgbToLinear(srgb)
+        self.assertEqual(len(linear), len(srgb))
+        self.assertEqual(linear, Vt.Vec3fArray([usdex.core.sRgbToLinear(color) for color in colors]))
+
+        converted = usdex.core.linearToSrgb(linear)
+        self.assertEqual(converted, Vt.Vec3fArray([usdex.core.linearToSrgb(color) for color in linear]))
+
+        self.assertEqual(usdex.core.sRgbToLinear(Vt.Vec3fArray()), Vt.Vec3fArray())
+
+        # The values of primvar data are converted, preserving the remaining members
+        data = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray(colors[:4]), Vt.IntArray([3, 2, 1, 0, 0]))
+        linearData = usdex.core.sRgbToLinear(data)
+        self.assertEqual(linearData.interpolation(), UsdGeom.Tokens.vertex)
+        self.assertEqual(linearData.values(), usdex.core.sRgbToLinear(data.values()))
+        self.assertEqual(linearData.indices(), data.indices())
+        self.assertEqual(linearData.elementSize(), data.elementSize())
+
+        srgbData = usdex.core.linearToSrgb(usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(0.5)]), elementSize=1))
+        self.assertEqual(srgbData.interpolation(), UsdGeom.Tokens.constant)
+        self.assertEqual(srgbData.values(), Vt.Vec3fArray([usdex.core.linearToSrgb(Gf.Vec3f(0.5))]))
+        self.assertFalse(srgbData.hasIndices())
+        self.assertEqual(srgbData.elementSize(), 1)
+
     def testAddPreviewMaterialInterface(self):
         stage = Usd.Stage.CreateInMemory()
         usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
@@ -678,6 +810,94 @@ class MaterialAlgoTest(usdex.test.TestCase):
         self.assertIsValidUsd(stage)
 
 
+    def createMaterialLibrary(self, name):
+        """Create a layered stage, with a library of preview materials defined in the weaker layer"""
+        weakerSubLayer = self.tmpLayer(name=f"{name}Weaker")
+        strongerSubLayer = self.tmpLayer(name=f"{name}Stronger")
+        rootLayer = Sdf.Layer.CreateAnonymous(tag=name)
+        rootLayer.subLayerPaths.append(strongerSubLayer.identifier)
+        rootLayer.subLayerPaths.append(weakerSubLayer.identifier)
+        stage = Usd.Stage.Open(rootLayer)
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materials = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild(UsdUtils.GetMaterialsScopeName())).GetPrim()
+
+        stage.SetEditTarget(Usd.EditTarget(weakerSubLayer))
+        for i in range(3):
+            material = usdex.core.definePreviewMaterial(materials, f"Material_{i}", Gf.Vec3f(0.25 * i, 0.5, 0.25))
+            usdex.core.addNormalTextureToPreviewMaterial(material, Sdf.AssetPath(self.tmpFile(name=f"N{i}", ext="png")))
+            usdex.core.addOrmTextureToPreviewMaterial(material, Sdf.AssetPath(self.tmpFile(name=f"ORM{i}", ext="png")))
+        return stage, weakerSubLayer, strongerSubLayer
+
+    def assertEquivalentStages(self, stage, expected):
+        """Assert that the composed attributes, values, and connections of every prim are equal"""
+        prims = [x.GetPath() for x in stage.Traverse()]
+        self.assertEqual(prims, [x.GetPath() for x in expected.Traverse()])
+        for path in prims:
+            attrs = stage.GetPrimAtPath(path).GetAttributes()
+            expectedAttrs = expected.GetPrimAtPath(path).GetAttributes()
+            self.assertEqual([x.GetName() for x in attrs], [x.GetName() for x in expectedAttrs])
+            for attr, expectedAttr in zip(attrs, expectedAttrs):
+                self.assertEqual(attr.HasAuthoredValue(), expectedAttr.HasAuthoredValue(), attr.GetPath())
+                self.assertEqual(attr.Get(), expectedAttr.Get(), attr.GetPath())
+                self.assertEqual(attr.GetConnections(), expectedAttr.GetConnections(), attr.GetPath())
+
+    def testMaterialInterfacesLibrary(self):
+        stage, weakerSubLayer, _ = self.createMaterialLibrary("Library")
+        expected, expectedWeakerSubLayer, _ = self.createMaterialLibrary("Expected")
+        materials = stage.GetDefaultPrim().GetChild(UsdUtils.GetMaterialsScopeName())
+
+        # the library variant matches the single material functions
+        self.assertTrue(usdex.core.addPreviewMaterialInterfaces(materials))
+        for prim in expected.GetDefaultPrim().GetChild(UsdUtils.GetMaterialsScopeName()).GetChildren():
+            self.assertTrue(usdex.core.addPreviewMaterialInterface(UsdShade.Material(prim)))
+        self.assertEqual(
+            sorted([x.GetBaseName() for x in UsdShade.Material(materials.GetChild("Material_2")).GetInterfaceInputs()]),
+            ["NormalTexture", "ORMTexture", "diffuseColor", "ior", "opacityThreshold"],
+        )
+        self.assertEqual(weakerSubLayer.ExportToString(), expectedWeakerSubLayer.ExportToString())
+        self.assertEquivalentStages(stage, expected)
+        self.assertIsValidUsd(stage)
+
+        self.assertTrue(usdex.core.removeMaterialInterfaces(materials))
+        for prim in expected.GetDefaultPrim().GetChild(UsdUtils.GetMaterialsScopeName()).GetChildren():
+            self.assertTrue(usdex.core.removeMaterialInterface(UsdShade.Material(prim)))
+        for prim in materials.GetChildren():
+            self.assertEqual(UsdShade.Material(prim).GetInterfaceInputs(), [])
+        self.assertEquivalentStages(stage, expected)
+        self.assertIsValidUsd(stage)
+
+    def testMaterialInterfacesLibraryFromStrongerLayer(self):
+        stage, weakerSubLayer, strongerSubLayer = self.createMaterialLibrary("Library")
+        expected, expectedWeakerSubLayer, expectedStrongerSubLayer = self.createMaterialLibrary("Expected")
+        materials = stage.GetDefaultPrim().GetChild(UsdUtils.GetMaterialsScopeName())
+        self.assertTrue(usdex.core.addPreviewMaterialInterfaces(materials))
+        for prim in expected.GetDefaultPrim().GetChild(UsdUtils.GetMaterialsScopeName()).GetChildren():
+            self.assertTrue(usdex.core.addPreviewMaterialInterface(UsdShade.Material(prim)))
+
+        # the interfaces are removed via the stronger layer, so the inputs are blocked and the connections are explicitly deleted
+        stage.SetEditTarget(Usd.EditTarget(strongerSubLayer))
+        expected.SetEditTarget(Usd.EditTarget(expectedStrongerSubLayer))
+        self.assertTrue(usdex.core.removeMaterialInterfaces(materials))
+        for prim in expected.GetDefaultPrim().GetChild(UsdUtils.GetMaterialsScopeName()).GetChildren():
+            self.assertTrue(usdex.core.removeMaterialInterface(UsdShade.Material(prim)))
+        self.assertEqual(weakerSubLayer.ExportToString(), expectedWeakerSubLayer.ExportToString())
+        self.assertEquivalentStages(stage, expected)
+        self.assertIsValidUsd(stage)
+
+    def testMaterialInterfacesLibraryFailures(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid root prim")]):
+            self.assertFalse(usdex.core.addPreviewMaterialInterfaces(Usd.Prim()))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid root prim")]):
+            self.assertFalse(usdex.core.removeMaterialInterfaces(Usd.Prim()))
+
+        # materials without a preview surface are skipped, while the others are still processed
+        stage, _, _ = self.createMaterialLibrary("Failures")
+        materials = stage.GetDefaultPrim().GetChild(UsdUtils.GetMaterialsScopeName())
+        usdex.core.createMaterial(materials, "Empty")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*does not have a valid surface shader")]):
+            self.assertFalse(usdex.core.addPreviewMaterialInterfaces(materials))
+        self.assertEqual(len(UsdShade.Material(materials.GetChild("Material_0")).GetInterfaceInputs()), 5)
+
 class DefinePreviewMaterialTest(usdex.test.DefineFunctionTestCase):
 
     # Configure the DefineFunctionTestCase
@@ -1739,6 +1959,188 @@ class DefinePreviewMaterialTest(usdex.test.DefineFunctionTestCase):
         self.assertFalse(material)
 
 
+class MaterialRegistryTest(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(self.stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        self.materials = usdex.core.defineScope(self.stage.GetDefaultPrim(), usdex.core.getMaterialsToken()).GetPrim()
+
+    def testDeduplicate(self):
+        registry = usdex.core.MaterialRegistry(self.materials)
+        self.assertTrue(registry.isValid())
+
+        params = usdex.core.PreviewMaterialParams()
+        params.color = Gf.Vec3f(0.25, 0.5, 0.75)
+        params.roughness = 0.2
+        params.diffuseTexture = Sdf.AssetPath(self.tmpFile(name="BaseColor", ext="png"))
+
+        # identical parameters share a single material, named after the first request
+        first = registry.definePreviewMaterial("A", params)
+        self.assertTrue(first)
+        self.assertEqual(first.GetPath(), self.materials.GetPath().AppendChild("A"))
+        for name in ("B", "C"):
+            self.assertEqual(registry.definePreviewMaterial(name, params).GetPath(), first.GetPath())
+        self.assertEqual(registry.getMaterialCount(), 1)
+        self.assertEqual(registry.getReuseCount(), 2)
+        self.assertEqual([x.GetName() for x in self.materials.GetChildren()], ["A"])
+
+        # the material matches one authored by definePreviewMaterial and addDiffuseTextureToPreviewMaterial
+        shader = usdex.core.computeEffectivePreviewSurfaceShader(first)
+        self.assertEqual(shader.GetInput("roughness").Get(), params.roughness)
+        self.assertTrue(shader.GetInput("diffuseColor").HasConnectedSource())
+        texture = UsdShade.Shader(first.GetPrim().GetChild("DiffuseTexture"))
+        self.assertEqual(texture.GetInput("file").Get(), params.diffuseTexture)
+        self.assertIsValidUsd(self.stage)
+
+    def testDistinctMaterials(self):
+        registry = usdex.core.MaterialRegistry(self.materials)
+        params = usdex.core.PreviewMaterialParams()
+        registry.definePreviewMaterial("Material", params)
+
+        # any difference in parameters or textures defines a new material, with a unique name
+        params.opacity = 0.5
+        second = registry.definePreviewMaterial("Material", params)
+        params.normalTexture = Sdf.AssetPath(self.tmpFile(name="Normal", ext="png"))
+        third = registry.definePreviewMaterial("Material", params)
+        params.emissiveColor = Gf.Vec3f(1, 0, 0)
+        fourth = registry.definePreviewMaterial("Material", params)
+        self.assertEqual(registry.getMaterialCount(), 4)
+        self.assertEqual(registry.getReuseCount(), 0)
+        self.assertEqual([x.GetName() for x in self.materials.GetChildren()], ["Material", "Material_1", "Material_2", "Material_3"])
+        self.assertEqual(usdex.core.computeEffectivePreviewSurfaceShader(second).GetInput("opacity").Get(), 0.5)
+        self.assertTrue(third.GetPrim().GetChild("NormalTexture"))
+        self.assertEqual(usdex.core.computeEffectivePreviewSurfaceShader(fourth).GetInput("emissiveColor").Get(), Gf.Vec3f(1, 0, 0))
+
+        # existing materials are still found
+        self.assertEqual(registry.definePreviewMaterial("Other", params).GetPath(), fourth.GetPath())
+        self.assertEqual(registry.getReuseCount(), 1)
+
+        # a removed material is defined again
+        self.stage.RemovePrim(fourth.GetPath())
+        material = registry.definePreviewMaterial("Other", params)
+        self.assertEqual(material.GetPath(), self.materials.GetPath().AppendChild("Other"))
+        self.assertEqual(registry.getMaterialCount(), 4)
+
+    def testInvalid(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid parent prim")]):
+            registry = usdex.core.MaterialRegistry(Usd.Prim())
+        self.assertFalse(registry.isValid())
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid MaterialRegistry")]):
+            material = registry.definePreviewMaterial("Material", usdex.core.PreviewMaterialParams())
+        self.assertFalse(material)
+
+        # invalid parameters are not registered
+        registry = usdex.core.MaterialRegistry(self.materials)
+        params = usdex.core.PreviewMaterialParams()
+        params.opacity = 2.0
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid shader parameter value")]):
+            material = registry.definePreviewMaterial("Material", params)
+        self.assertFalse(material)
+        self.assertEqual(registry.getMaterialCount(), 0)
+
+        # partially authored materials are removed
+        params.opacity = 1.0
+        params.emissiveColor = Gf.Vec3f(-1, 0, 0)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid shader parameter value")]):
+            material = registry.definePreviewMaterial("Material", params)
+        self.assertFalse(material)
+        self.assertEqual(registry.getMaterialCount(), 0)
+        self.assertEqual(self.materials.GetChildren(), [])
+
+
+
+class SharedTextureScopeTest(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(self.stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        self.materials = usdex.core.defineScope(self.stage.GetDefaultPrim(), usdex.core.getMaterialsToken()).GetPrim()
+
+    def testShareReaders(self):
+        texture = Sdf.AssetPath(self.tmpFile(name="Normal", ext="png"))
+        other = Sdf.AssetPath(self.tmpFile(name="Other", ext="png"))
+        self.assertFalse(usdex.core.SharedTextureScope.isActive(self.stage))
+        with usdex.core.SharedTextureScope(self.materials) as scope:
+            self.assertTrue(usdex.core.SharedTextureScope.isActive(self.stage))
+            nodeGraph = scope.getNodeGraph()
+            self.assertTrue(nodeGraph)
+            self.assertEqual(nodeGraph.GetPrim().GetParent(), self.materials)
+
+            materials = [usdex.core.definePreviewMaterial(self.materials, f"Material_{i}", Gf.Vec3f(0.5)) for i in range(3)]
+            for material in materials[:2]:
+                self.assertTrue(usdex.core.addNormalTextureToPreviewMaterial(material, texture))
+            self.assertTrue(usdex.core.addNormalTextureToPreviewMaterial(materials[2], other))
+        self.assertFalse(usdex.core.SharedTextureScope.isActive(self.stage))
+
+        # the first two materials share a reader, and all readers share a single primvar reader
+        readers = [UsdShade.Shader(x) for x in nodeGraph.GetPrim().GetChildren() if UsdShade.Shader(x).GetShaderId() == "UsdUVTexture"]
+        self.assertEqual([x.GetPrim().GetName() for x in readers], ["NormalTexture", "NormalTexture_1"])
+        self.assertEqual(len(nodeGraph.GetPrim().GetChildren()), 3)
+        primvarReaders = [reader.GetInput("st").GetConnectedSources()[0][0].source.GetPath() for reader in readers]
+        self.assertEqual(primvarReaders[0], primvarReaders[1])
+        for reader in readers:
+            self.assertEqual(reader.GetInput("scale").Get(), Gf.Vec4f(2, 2, 2, 1))
+
+        for material, reader in zip(materials, [readers[0], readers[0], readers[1]]):
+            self.assertEqual(material.GetPrim().GetChildren(), [usdex.core.computeEffectivePreviewSurfaceShader(material).GetPrim()])
+            normal = usdex.core.computeEffectivePreviewSurfaceShader(material).GetInput("normal")
+            self.assertEqual(normal.GetConnectedSources()[0][0].source.GetPath(), reader.GetPath())
+
+        # shared readers are not promoted to the material interface
+        self.assertTrue(usdex.core.addPreviewMaterialInterface(materials[0]))
+        self.assertFalse(materials[0].GetInput("NormalTexture"))
+        self.assertEqual(readers[0].GetInput("file").Get(), texture)
+        self.assertIsValidUsd(self.stage)
+
+    def testFallbacks(self):
+        texture = Sdf.AssetPath(self.tmpFile(name="BaseColor", ext="png"))
+        with usdex.core.SharedTextureScope(self.materials) as scope:
+            nodeGraph = scope.getNodeGraph()
+            red = usdex.core.definePreviewMaterial(self.materials, "Red", Gf.Vec3f(1, 0, 0))
+            green = usdex.core.definePreviewMaterial(self.materials, "Green", Gf.Vec3f(0, 1, 0))
+            self.assertTrue(usdex.core.addDiffuseTextureToPreviewMaterial(red, texture))
+            self.assertTrue(usdex.core.addDiffuseTextureToPreviewMaterial(green, texture))
+
+        # the fallback is the diffuse color of each material, so the readers cannot be shared
+        self.assertEqual(nodeGraph.GetPath(), self.materials.GetPath().AppendChild("SharedTextures"))
+        self.assertEqual(nodeGraph.GetPrim().GetChild("DiffuseTexture").GetAttribute("inputs:fallback").Get(), Gf.Vec4f(1, 0, 0, 1))
+        self.assertEqual(nodeGraph.GetPrim().GetChild("DiffuseTexture_1").GetAttribute("inputs:fallback").Get(), Gf.Vec4f(0, 1, 0, 1))
+
+    def testCachedResolution(self):
+        # The resolved texture format is cached while the scope is active, so the scale & bias of many materials match those of a single material
+        eightBit = Sdf.AssetPath(self.tmpFile(name="Normal", ext="png"))
+        highDynamicRange = Sdf.AssetPath(self.tmpFile(name="Normal", ext="exr"))
+        for scopeType, parent in ((usdex.core.SharedTextureScope, self.materials), (usdex.core.BulkAuthoringScope, self.stage)):
+            with scopeType(parent):
+                for i in range(10):
+                    for texture in (eightBit, highDynamicRange):
+                        name = f"{scopeType.__name__}_{pathlib.Path(texture.path).suffix[1:]}_{i}"
+                        material = usdex.core.definePreviewMaterial(self.materials, name, Gf.Vec3f(0.5))
+                        self.assertTrue(usdex.core.addNormalTextureToPreviewMaterial(material, texture))
+                        reader = usdex.core.computeEffectivePreviewSurfaceShader(material).GetInput("normal").GetConnectedSources()[0][0].source
+                        scale = UsdShade.Shader(reader.GetPrim()).GetInput("scale")
+                        if texture == eightBit:
+                            self.assertEqual(scale.Get(), Gf.Vec4f(2, 2, 2, 1))
+                        else:
+                            self.assertFalse(scale)
+        self.assertIsValidUsd(self.stage)
+
+    def testInvalid(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid parent prim")]):
+            with usdex.core.SharedTextureScope(Usd.Prim()) as scope:
+                self.assertFalse(scope.getNodeGraph())
+                self.assertFalse(usdex.core.SharedTextureScope.isActive(self.stage))
+
+                # textures are authored within the material as usual
+                material = usdex.core.definePreviewMaterial(self.materials, "Material", Gf.Vec3f(0.5))
+                texture = Sdf.AssetPath(self.tmpFile(name="BaseColor", ext="png"))
+                self.assertTrue(usdex.core.addDiffuseTextureToPreviewMaterial(material, texture))
+        self.assertTrue(material.GetPrim().GetChild("DiffuseTexture"))
+
 class ConnectPrimvarShaderTest(usdex.test.TestCase):
 
     # input sdfTypeName: (fallback/result SdfTypeName, primvarReaderRoleName, fallbackValue)
@@ -2,12 +2,22 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import math
+import random
+import unittest
+from concurrent.futures import ThreadPoolExecutor
+
 import omni.asset_validator
 import usdex.core
 import usdex.test
-from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdShade, UsdUtils, Vt
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdShade, UsdUtils, Vt, Work
 from utils.DefinePointBasedTestCaseMixin import DefinePointBasedTestCaseMixin
 
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
 # Description of a simple mesh with two connected faces
 FACE_VERTEX_COUNTS = Vt.IntArray([4, 4])
 FACE_VERTEX_INDICES = Vt.IntArray([0, 1, 2, 3, 2, 5, 4, 3])
@@ -332,6 +342,453 @@ class DefineMeshTestCase(DefinePointBasedTestCaseMixin, usdex.test.DefineFunctio
         self.assertTrue(mesh)
         self.assertEqual(mesh.GetPrim().GetTypeName(), "Mesh")
 
+    def testDefinePolyMeshes(self):
+        stage = self.createTestStage()
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.uniform, Vt.Vec3fArray([Gf.Vec3f(0, 1, 0)]), Vt.IntArray([0, 0]))
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec2fArray([Gf.Vec2f(i, i) for i in range(len(POINTS))]))
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]))
+        displayOpacity = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([0.5]))
+
+        # The batch may define meshes below ancestors that do not yet exist
+        meshes = [
+            usdex.core.PolyMeshData(Sdf.Path("/World/Batch/Plain"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+            usdex.core.PolyMeshData(
+                Sdf.Path("/World/Batch/Primvars"),
+                FACE_VERTEX_COUNTS,
+                FACE_VERTEX_INDICES,
+                POINTS,
+                normals=normals,
+                uvs=uvs,
+                displayColor=displayColor,
+                displayOpacity=displayOpacity,
+            ),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            results = usdex.core.definePolyMeshes(stage, meshes)
+        self.assertEqual(len(results), len(meshes))
+        for result, data in zip(results, meshes):
+            self.assertDefineFunctionSuccess(result)
+            self.assertEqual(result.GetPath(), data.path)
+
+        ancestor = stage.GetPrimAtPath("/World/Batch")
+        self.assertTrue(ancestor.IsDefined())
+        self.assertEqual(ancestor.GetTypeName(), "")
+
+        # The authored scene description matches definePolyMesh
+        UsdGeom.Scope.Define(stage, "/World/Single")
+        expected = usdex.core.definePolyMesh(
+            stage,
+            Sdf.Path("/World/Single/Primvars"),
+            FACE_VERTEX_COUNTS,
+            FACE_VERTEX_INDICES,
+            POINTS,
+            normals=normals,
+            uvs=uvs,
+            displayColor=displayColor,
+            displayOpacity=displayOpacity,
+        )
+        layer = stage.GetEditTarget().GetLayer()
+        expectedSpec = layer.GetPrimAtPath(expected.GetPath())
+        actualSpec = layer.GetPrimAtPath(results[1].GetPath())
+        self.assertEqual(actualSpec.specifier, expectedSpec.specifier)
+        self.assertEqual(actualSpec.typeName, expectedSpec.typeName)
+        self.assertEqual(sorted(actualSpec.attributes.keys()), sorted(expectedSpec.attributes.keys()))
+        for name, expectedAttr in expectedSpec.attributes.items():
+            actualAttr = actualSpec.attributes[name]
+            self.assertEqual(actualAttr.typeName, expectedAttr.typeName, msg=name)
+            self.assertEqual(actualAttr.variability, expectedAttr.variability, msg=name)
+            self.assertEqual(actualAttr.default, expectedAttr.default, msg=name)
+            self.assertEqual(actualAttr.GetInfo("interpolation"), expectedAttr.GetInfo("interpolation"), msg=name)
+        self.assertIsValidUsd(stage)
+
+    @unittest.skipIf(numpy is None, "NumPy is not available")
+    def testDefinePolyMeshFromNumpy(self):
+        stage = self.createTestStage()
+        mesh = usdex.core.definePolyMesh(
+            stage,
+            Sdf.Path("/World/NumpyMesh"),
+            numpy.array(FACE_VERTEX_COUNTS, dtype=numpy.int32),
+            numpy.array(FACE_VERTEX_INDICES, dtype=numpy.int32),
+            numpy.array([[p[0], p[1], p[2]] for p in POINTS], dtype=numpy.float32),
+            normals=usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.uniform, numpy.array([[0, 1, 0], [0, 1, 0]], dtype=numpy.float32)),
+        )
+        self.assertDefineFunctionSuccess(mesh)
+        self.assertEqual(mesh.GetFaceVertexCountsAttr().Get(), FACE_VERTEX_COUNTS)
+        self.assertEqual(mesh.GetFaceVertexIndicesAttr().Get(), FACE_VERTEX_INDICES)
+        self.assertEqual(mesh.GetPointsAttr().Get(), POINTS)
+        normals = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertEqual(normals.Get(), Vt.Vec3fArray([Gf.Vec3f(0, 1, 0), Gf.Vec3f(0, 1, 0)]))
+
+        self.assertIsValidUsd(stage)
+
+    def testDefinePolyMeshesInvalid(self):
+        stage = self.createTestStage()
+
+        # An empty batch defines nothing
+        self.assertEqual(usdex.core.definePolyMeshes(stage, []), [])
+
+        # Any invalid mesh prevents the entire batch from being defined
+        meshes = [
+            usdex.core.PolyMeshData(Sdf.Path("/World/Valid"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+            usdex.core.PolyMeshData(Sdf.Path("/World/InvalidTopology"), Vt.IntArray([2]), FACE_VERTEX_INDICES, POINTS),
+            usdex.core.PolyMeshData(Sdf.Path("World/InvalidLocation"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*InvalidTopology.*invalid topology"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location"),
+            ],
+        ):
+            self.assertEqual(usdex.core.definePolyMeshes(stage, meshes), [])
+        self.assertFalse(stage.GetPrimAtPath("/World/Valid"))
+        self.assertFalse(stage.GetPrimAtPath("/World/InvalidTopology"))
+
+        # Each path may only be requested once
+        meshes = [
+            usdex.core.PolyMeshData(Sdf.Path("/World/Duplicate"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+            usdex.core.PolyMeshData(Sdf.Path("/World/Duplicate"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS),
+        ]
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*duplicate path")]):
+            self.assertEqual(usdex.core.definePolyMeshes(stage, meshes), [])
+        self.assertFalse(stage.GetPrimAtPath("/World/Duplicate"))
+
+    def testDefinePolyMeshBatch(self):
+        stage = self.createTestStage()
+        parent = UsdGeom.Scope.Define(stage, "/World/Batch").GetPrim()
+
+        # Two copies of the test mesh, the second offset along the y axis, with colliding names which must be made unique
+        count = 2
+        points = Vt.Vec3fArray(list(POINTS) + [p + Gf.Vec3f(0, 1, 0) for p in POINTS])
+        uvs = Vt.Vec2fArray([Gf.Vec2f(i, i) for i in range(len(points))])
+        colors = Vt.Vec3fArray([Gf.Vec3f(1, 0, 0), Gf.Vec3f(0, 1, 0)])
+        batch = usdex.core.MeshBatch(
+            names=["Mesh", "Mesh"],
+            pointOffsets=Vt.IntArray([0, len(POINTS), len(points)]),
+            faceOffsets=Vt.IntArray([0, len(FACE_VERTEX_COUNTS), len(FACE_VERTEX_COUNTS) * count]),
+            faceVertexCounts=Vt.IntArray(list(FACE_VERTEX_COUNTS) * count),
+            faceVertexIndices=Vt.IntArray(list(FACE_VERTEX_INDICES) * count),
+            points=points,
+            normals=usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.uniform, Vt.Vec3fArray([Gf.Vec3f(0, 1, 0)]), Vt.IntArray([0] * 4)),
+            uvs=usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, uvs),
+            displayColor=usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, colors),
+        )
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            results = usdex.core.definePolyMeshBatch(parent, batch)
+        self.assertEqual([result.GetPath() for result in results], [Sdf.Path("/World/Batch/Mesh"), Sdf.Path("/World/Batch/Mesh_1")])
+
+        # Each mesh holds its own slice of the batch
+        for i, result in enumerate(results):
+            self.assertDefineFunctionSuccess(result)
+            self.assertEqual(result.GetFaceVertexCountsAttr().Get(), FACE_VERTEX_COUNTS)
+            self.assertEqual(result.GetFaceVertexIndicesAttr().Get(), FACE_VERTEX_INDICES)
+            self.assertEqual(result.GetPointsAttr().Get(), Vt.Vec3fArray(points[i * len(POINTS) : (i + 1) * len(POINTS)]))
+            primvars = UsdGeom.PrimvarsAPI(result)
+            normals = primvars.GetPrimvar(UsdGeom.Tokens.normals)
+            self.assertEqual(normals.Get(), Vt.Vec3fArray([Gf.Vec3f(0, 1, 0)]))
+            self.assertEqual(normals.GetIndices(), Vt.IntArray([0, 0]))
+            self.assertEqual(primvars.GetPrimvar("st").Get(), Vt.Vec2fArray(uvs[i * len(POINTS) : (i + 1) * len(POINTS)]))
+            self.assertEqual(primvars.GetPrimvar("displayColor").Get(), Vt.Vec3fArray([colors[i]]))
+
+        # A name cache may be shared between batches, so that names remain unique
+        cache = usdex.core.NameCache()
+        results = usdex.core.definePolyMeshBatch(parent, batch, cache)
+        self.assertEqual([result.GetPath().name for result in results], ["Mesh_2", "Mesh_3"])
+        self.assertIsValidUsd(stage)
+
+    def testDefinePolyMeshBatchInvalid(self):
+        stage = self.createTestStage()
+        parent = stage.GetDefaultPrim()
+
+        # An empty batch defines nothing
+        self.assertEqual(usdex.core.definePolyMeshBatch(parent, usdex.core.MeshBatch()), [])
+
+        # The offsets must hold one range per mesh
+        batch = usdex.core.MeshBatch(
+            names=["A", "B"],
+            pointOffsets=Vt.IntArray([0, len(POINTS)]),
+            faceOffsets=Vt.IntArray([0, len(FACE_VERTEX_COUNTS)]),
+            faceVertexCounts=FACE_VERTEX_COUNTS,
+            faceVertexIndices=FACE_VERTEX_INDICES,
+            points=POINTS,
+        )
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid offsets")]):
+            self.assertEqual(usdex.core.definePolyMeshBatch(parent, batch), [])
+
+        # The primvars must hold the elements of every mesh
+        batch.names = ["A"]
+        batch.displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)] * 2))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*primvars which do not hold the elements")]):
+            self.assertEqual(usdex.core.definePolyMeshBatch(parent, batch), [])
+
+        # An invalid parent defines nothing
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid parent prim")]):
+            self.assertEqual(usdex.core.definePolyMeshBatch(Usd.Prim(), batch), [])
+        self.assertFalse(stage.GetPrimAtPath(parent.GetPath().AppendChild("A")))
+
+    def createGridMesh(self, size):
+        points = Vt.Vec3fArray([Gf.Vec3f(x, y, 0) for y in range(size + 1) for x in range(size + 1)])
+        faceVertexIndices = []
+        for y in range(size):
+            for x in range(size):
+                first = y * (size + 1) + x
+                faceVertexIndices.extend([first, first + 1, first + size + 2, first + size + 1])
+        return Vt.IntArray([4] * size * size), Vt.IntArray(faceVertexIndices), points
+
+    def testDefinePolyMeshChunks(self):
+        stage = self.createTestStage()
+        parent = stage.GetDefaultPrim()
+
+        # An 8x8 grid split into chunks of 16 faces is split into its quadrants
+        faceVertexCounts, faceVertexIndices, points = self.createGridMesh(8)
+        faceCount = len(faceVertexCounts)
+        colors = Vt.Vec3fArray([Gf.Vec3f(i, 0, 0) for i in range(faceCount)])
+        uvs = Vt.Vec2fArray([Gf.Vec2f(0, 0), Gf.Vec2f(1, 0), Gf.Vec2f(1, 1), Gf.Vec2f(0, 1)])
+        subsetNames = ["even", "odd"]
+        subsetIndices = [Vt.IntArray([i for i in range(faceCount) if (i // 8) % 2 == j]) for j in range(2)]
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            chunks = usdex.core.definePolyMeshChunks(
+                parent,
+                "Grid",
+                faceVertexCounts,
+                faceVertexIndices,
+                points,
+                16,
+                uvs=usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.faceVarying, uvs, Vt.IntArray([0, 1, 2, 3] * faceCount)),
+                displayColor=usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.uniform, colors),
+                subsetNames=subsetNames,
+                subsetIndices=subsetIndices,
+            )
+        self.assertEqual([chunk.GetPath().name for chunk in chunks], ["Chunk_0", "Chunk_1", "Chunk_2", "Chunk_3"])
+        self.assertTrue(UsdGeom.Xform(stage.GetPrimAtPath(parent.GetPath().AppendChild("Grid"))))
+
+        # Each chunk holds the points referenced by its own faces, and the faces of all chunks match those of the mesh
+        faces = set()
+        for chunk in chunks:
+            self.assertDefineFunctionSuccess(chunk)
+            chunkCounts = chunk.GetFaceVertexCountsAttr().Get()
+            chunkIndices = chunk.GetFaceVertexIndicesAttr().Get()
+            chunkPoints = chunk.GetPointsAttr().Get()
+            self.assertEqual(len(chunkCounts), 16)
+            self.assertEqual(len(chunkPoints), 25)
+            extent = chunk.GetExtentAttr().Get()
+            self.assertEqual(extent[1] - extent[0], Gf.Vec3f(4, 4, 0))
+
+            primvars = UsdGeom.PrimvarsAPI(chunk)
+            chunkColors = primvars.GetPrimvar("displayColor").Get()
+            st = primvars.GetPrimvar("st")
+            self.assertEqual(st.Get(), uvs)
+            self.assertEqual(st.GetIndices(), Vt.IntArray([0, 1, 2, 3] * 16))
+            for face in range(16):
+                facePoints = tuple(chunkPoints[i] for i in chunkIndices[face * 4 : face * 4 + 4])
+                original = int(chunkColors[face][0])
+                self.assertEqual(facePoints, tuple(points[i] for i in faceVertexIndices[original * 4 : original * 4 + 4]))
+                faces.add(original)
+
+            # The subsets are remapped to the faces of the chunk
+            subsets = UsdGeom.Subset.GetAllGeomSubsets(chunk)
+            self.assertEqual(sorted(subset.GetPrim().GetName() for subset in subsets), subsetNames)
+            for subset in subsets:
+                self.assertEqual(len(subset.GetIndicesAttr().Get()), 8)
+                for face in subset.GetIndicesAttr().Get():
+                    self.assertIn(int(chunkColors[face][0]), subsetIndices[subsetNames.index(subset.GetPrim().GetName())])
+        self.assertEqual(faces, set(range(faceCount)))
+
+        # A mesh which fits in a single chunk is defined as a single chunk
+        chunks = usdex.core.definePolyMeshChunks(parent, "Single", faceVertexCounts, faceVertexIndices, points, faceCount)
+        self.assertEqual(len(chunks), 1)
+        self.assertEqual(chunks[0].GetFaceVertexIndicesAttr().Get(), faceVertexIndices)
+        self.assertIsValidUsd(stage)
+
+    def testDefinePolyMeshChunksInvalid(self):
+        stage = self.createTestStage()
+        parent = stage.GetDefaultPrim()
+        faceVertexCounts, faceVertexIndices, points = self.createGridMesh(2)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            self.assertEqual(usdex.core.definePolyMeshChunks(parent, "Grid", faceVertexCounts, Vt.IntArray([0] * 15), points, 1), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*zero faces per chunk")]):
+            self.assertEqual(usdex.core.definePolyMeshChunks(parent, "Grid", faceVertexCounts, faceVertexIndices, points, 0), [])
+
+        # The subsets must partition the faces of the mesh
+        for subsetIndices in ([Vt.IntArray([0, 1])], [Vt.IntArray([0, 1, 2, 3, 3])], [Vt.IntArray([0, 1, 2, 4])]):
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*do not partition the 4 faces")]):
+                chunks = usdex.core.definePolyMeshChunks(
+                    parent, "Grid", faceVertexCounts, faceVertexIndices, points, 1, subsetNames=["a"], subsetIndices=subsetIndices
+                )
+            self.assertEqual(chunks, [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertEqual(usdex.core.definePolyMeshChunks(Usd.Prim(), "Grid", faceVertexCounts, faceVertexIndices, points, 1), [])
+        self.assertFalse(stage.GetPrimAtPath(parent.GetPath().AppendChild("Grid")))
+
+    def countCacheMisses(self, faceVertexIndices, cacheSize=32):
+        # Simulate an LRU vertex cache over the face vertices
+        cache = []
+        misses = 0
+        for index in faceVertexIndices:
+            if index in cache:
+                cache.remove(index)
+            else:
+                misses += 1
+            cache.insert(0, index)
+            del cache[cacheSize:]
+        return misses
+
+    def testDefineOptimizedPolyMesh(self):
+        stage = self.createTestStage()
+        path = stage.GetDefaultPrim().GetPath().AppendChild("Grid")
+
+        # A 16x16 grid with its faces and points in a scrambled order
+        gridCounts, gridIndices, gridPoints = self.createGridMesh(16)
+        faceCount = len(gridCounts)
+        faceOrder = [(i * 37) % faceCount for i in range(faceCount)]
+        pointOrder = [(i * 53) % len(gridPoints) for i in range(len(gridPoints))]
+        pointRemap = {point: i for i, point in enumerate(pointOrder)}
+        faceVertexCounts = Vt.IntArray([gridCounts[face] for face in faceOrder])
+        faceVertexIndices = Vt.IntArray([pointRemap[gridIndices[face * 4 + i]] for face in faceOrder for i in range(4)])
+        points = Vt.Vec3fArray([gridPoints[point] for point in pointOrder])
+
+        # The primvars encode the original face, point, and face vertex of each element
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(point[0], point[1], 1) for point in points]))
+        colors = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.uniform, Vt.Vec3fArray([Gf.Vec3f(i, 0, 0) for i in range(faceCount)]))
+        uvValues = Vt.Vec2fArray([Gf.Vec2f(i, 0) for i in range(len(faceVertexIndices))])
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.faceVarying, uvValues, Vt.IntArray(range(len(faceVertexIndices))))
+        subsetNames = ["even", "odd"]
+        subsetIndices = [Vt.IntArray([i for i in range(faceCount) if i % 2 == j]) for j in range(2)]
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            mesh = usdex.core.defineOptimizedPolyMesh(
+                stage,
+                path,
+                faceVertexCounts,
+                faceVertexIndices,
+                points,
+                normals=normals,
+                uvs=uvs,
+                displayColor=colors,
+                subsetNames=subsetNames,
+                subsetIndices=subsetIndices,
+            )
+        self.assertDefineFunctionSuccess(mesh)
+        meshCounts = mesh.GetFaceVertexCountsAttr().Get()
+        meshIndices = mesh.GetFaceVertexIndicesAttr().Get()
+        meshPoints = mesh.GetPointsAttr().Get()
+        self.assertEqual(len(meshCounts), faceCount)
+        self.assertEqual(len(meshPoints), len(points))
+
+        # The new order reuses the points of the vertex cache far more often than the scrambled order
+        self.assertLess(self.countCacheMisses(meshIndices) * 2, self.countCacheMisses(faceVertexIndices))
+
+        # The points are ordered by their first reference
+        firstReferences = []
+        for index in meshIndices:
+            if index not in firstReferences:
+                firstReferences.append(index)
+        self.assertEqual(firstReferences, list(range(len(meshPoints))))
+
+        # Each face and its primvars match those of the original face
+        primvars = UsdGeom.PrimvarsAPI(mesh)
+        meshNormals = primvars.GetPrimvar("normals").Get()
+        meshColors = primvars.GetPrimvar("displayColor").Get()
+        st = primvars.GetPrimvar("st")
+        meshUvs = st.ComputeFlattened()
+        self.assertEqual(sorted(int(color[0]) for color in meshColors), list(range(faceCount)))
+        for face in range(faceCount):
+            original = int(meshColors[face][0])
+            facePoints = [meshPoints[i] for i in meshIndices[face * 4 : face * 4 + 4]]
+            self.assertEqual(facePoints, [points[i] for i in faceVertexIndices[original * 4 : original * 4 + 4]])
+            self.assertEqual([int(uv[0]) for uv in meshUvs[face * 4 : face * 4 + 4]], list(range(original * 4, original * 4 + 4)))
+        for point, normal in zip(meshPoints, meshNormals):
+            self.assertEqual(normal, Gf.Vec3f(point[0], point[1], 1))
+
+        # The indexed uvs are compacted in the order of first reference
+        self.assertEqual(st.GetIndices(), Vt.IntArray(range(len(faceVertexIndices))))
+
+        # The subsets are remapped to the reordered faces
+        subsets = UsdGeom.Subset.GetAllGeomSubsets(mesh)
+        self.assertEqual(sorted(subset.GetPrim().GetName() for subset in subsets), subsetNames)
+        for subset in subsets:
+            indices = subset.GetIndicesAttr().Get()
+            self.assertEqual(list(indices), sorted(indices))
+            expected = subsetIndices[subsetNames.index(subset.GetPrim().GetName())]
+            self.assertEqual(sorted(int(meshColors[face][0]) for face in indices), list(expected))
+        self.assertIsValidUsd(stage)
+
+    def testDefineOptimizedPolyMeshInvalid(self):
+        stage = self.createTestStage()
+        path = stage.GetDefaultPrim().GetPath().AppendChild("Grid")
+        faceVertexCounts, faceVertexIndices, points = self.createGridMesh(2)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            self.assertFalse(usdex.core.defineOptimizedPolyMesh(stage, path, faceVertexCounts, Vt.IntArray([0] * 15), points))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*vertex cache size of zero")]):
+            self.assertFalse(usdex.core.defineOptimizedPolyMesh(stage, path, faceVertexCounts, faceVertexIndices, points, cacheSize=0))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*do not partition the 4 faces")]):
+            mesh = usdex.core.defineOptimizedPolyMesh(
+                stage, path, faceVertexCounts, faceVertexIndices, points, subsetNames=["a"], subsetIndices=[Vt.IntArray([0, 1])]
+            )
+        self.assertFalse(mesh)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.core.defineOptimizedPolyMesh(stage, Sdf.Path("Relative"), faceVertexCounts, faceVertexIndices, points))
+        self.assertFalse(stage.GetPrimAtPath(path))
+
+    def testDefinePolyMeshLods(self):
+        stage = self.createTestStage()
+        path = stage.GetDefaultPrim().GetPath().AppendChild("Grid")
+
+        # An 8x8 grid of 128 triangles is decimated to at most 64 and 32 triangles
+        faceVertexCounts, faceVertexIndices, points = self.createGridMesh(8)
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0, 0, 1)] * len(points)))
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec2fArray([Gf.Vec2f(p[0] / 8, p[1] / 8) for p in points]))
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            mesh = usdex.core.definePolyMeshLods(stage, path, faceVertexCounts, faceVertexIndices, points, [0.5, 0.25], normals, uvs)
+        self.assertTrue(mesh)
+
+        variantSet = mesh.GetPrim().GetVariantSets().GetVariantSet("lod")
+        self.assertEqual(variantSet.GetVariantNames(), ["LOD0", "LOD1", "LOD2"])
+        self.assertEqual(variantSet.GetVariantSelection(), "LOD0")
+        self.assertEqual(mesh.GetFaceVertexCountsAttr().Get(), faceVertexCounts)
+        self.assertEqual(mesh.GetPointsAttr().Get(), points)
+
+        for variant, maxFaces in (("LOD1", 64), ("LOD2", 32)):
+            variantSet.SetVariantSelection(variant)
+            counts = mesh.GetFaceVertexCountsAttr().Get()
+            self.assertGreater(len(counts), 0)
+            self.assertLessEqual(len(counts), maxFaces)
+            self.assertEqual(set(counts), {3})
+
+            # The uvs remain linear, so they are demoted back to vertex interpolation
+            levelPoints = mesh.GetPointsAttr().Get()
+            primvarsApi = UsdGeom.PrimvarsAPI(mesh)
+            levelUvs = primvarsApi.GetPrimvar("st")
+            self.assertEqual(levelUvs.GetInterpolation(), UsdGeom.Tokens.vertex)
+            for point, uv in zip(levelPoints, levelUvs.ComputeFlattened()):
+                self.assertTrue(Gf.IsClose(uv, Gf.Vec2f(point[0] / 8, point[1] / 8), 1e-6))
+            levelNormals = primvarsApi.GetPrimvar(UsdGeom.Tokens.normals)
+            self.assertEqual(levelNormals.GetInterpolation(), UsdGeom.Tokens.vertex)
+            self.assertEqual(len(levelNormals.ComputeFlattened()), len(levelPoints))
+        self.assertIsValidUsd(stage)
+
+    def testDefinePolyMeshLodsInvalid(self):
+        stage = self.createTestStage()
+        path = stage.GetDefaultPrim().GetPath().AppendChild("Grid")
+        faceVertexCounts, faceVertexIndices, points = self.createGridMesh(2)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology")]):
+            self.assertFalse(usdex.core.definePolyMeshLods(stage, path, faceVertexCounts, Vt.IntArray([0] * 15), points, [0.5]))
+
+        for ratio in (0.0, 1.0, -0.5):
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*face ratios must be between zero and one")]):
+                self.assertFalse(usdex.core.definePolyMeshLods(stage, path, faceVertexCounts, faceVertexIndices, points, [0.5, ratio]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.core.definePolyMeshLods(stage, Sdf.Path("Grid"), faceVertexCounts, faceVertexIndices, points, [0.5]))
+        self.assertFalse(stage.GetPrimAtPath(path))
+
     def testComputeMeshNormals(self):
         self.validationEngine.enable_rule(omni.asset_validator.NormalsExistChecker)
         stage = self.createTestStage()
@@ -518,6 +975,82 @@ class DefineMeshTestCase(DefinePointBasedTestCaseMixin, usdex.test.DefineFunctio
         self.assertEqual(normals.interpolation(), UsdGeom.Tokens.vertex)
         self.assertEqual(normals.effectiveSize(), 4)
 
+    def testComputeMeshNormalsSmoothingAngle(self):
+        # A flat quad, a quad tilted by 10 degrees along their shared edge, and a wall folded by 80 degrees along the far edge
+        z = math.tan(math.radians(10.0))
+        faceVertexCounts = Vt.IntArray([4, 4, 4])
+        faceVertexIndices = Vt.IntArray([0, 1, 2, 3, 1, 4, 5, 2, 4, 6, 7, 5])
+        points = Vt.Vec3fArray(
+            [
+                Gf.Vec3f(-1.0, 0.0, 0.0),
+                Gf.Vec3f(0.0, 0.0, 0.0),
+                Gf.Vec3f(0.0, 1.0, 0.0),
+                Gf.Vec3f(-1.0, 1.0, 0.0),
+                Gf.Vec3f(1.0, 0.0, z),
+                Gf.Vec3f(1.0, 1.0, z),
+                Gf.Vec3f(1.0, 0.0, z + 1.0),
+                Gf.Vec3f(1.0, 1.0, z + 1.0),
+            ]
+        )
+
+        # Without smoothing each face has a single normal shared by all of its corners
+        faceted = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.faceVarying)
+        self.assertTrue(faceted.isValid())
+        self.assertEqual(faceted.interpolation(), UsdGeom.Tokens.faceVarying)
+        self.assertEqual(len(faceted.values()), 3)
+        self.assertEqual(faceted.indices(), Vt.IntArray([0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2]))
+        uniform = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.uniform)
+        self.assertEqual(faceted.values(), uniform.values())
+
+        # The gentle edge is smoothed while the crease remains sharp
+        smoothed = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.faceVarying, smoothingAngle=30.0)
+        self.assertTrue(smoothed.isValid())
+        self.assertEqual(smoothed.interpolation(), UsdGeom.Tokens.faceVarying)
+        self.assertEqual(smoothed.effectiveSize(), 12)
+        self.assertEqual(len(smoothed.values()), 10)
+        indices = smoothed.indices()
+        # the flat and tilted faces share normals at vertices 1 and 2
+        self.assertEqual(indices[1], indices[4])
+        self.assertEqual(indices[2], indices[7])
+        # the tilted face and the wall do not share normals at vertices 4 and 5
+        self.assertNotEqual(indices[5], indices[8])
+        self.assertNotEqual(indices[6], indices[11])
+        flat = smoothed.values()[indices[0]]
+        shared = smoothed.values()[indices[1]]
+        wall = smoothed.values()[indices[8]]
+        self.assertTrue(Gf.IsClose(flat, Gf.Vec3f(0.0, 0.0, 1.0), 1e-6))
+        self.assertTrue(Gf.IsClose(shared, (uniform.values()[0] + uniform.values()[1]).GetNormalized(), 1e-6))
+        self.assertTrue(Gf.IsClose(wall, Gf.Vec3f(-1.0, 0.0, 0.0), 1e-6))
+        for value in smoothed.values():
+            self.assertAlmostEqual(value.GetLength(), 1.0, places=5)
+
+        # A wide enough angle smooths every vertex, matching the vertex normals
+        vertexNormals = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.vertex)
+        smooth = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.faceVarying, smoothingAngle=90.0)
+        self.assertEqual(len(smooth.values()), len(points))
+        for corner, vertex in enumerate(faceVertexIndices):
+            expected = vertexNormals.values()[vertexNormals.indices()[vertex]] if vertexNormals.hasIndices() else vertexNormals.values()[vertex]
+            self.assertTrue(Gf.IsClose(smooth.values()[smooth.indices()[corner]], expected, 1e-6))
+
+        # The angle has no effect on other interpolations
+        self.assertEqual(
+            usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.uniform, smoothingAngle=30.0),
+            uniform,
+        )
+
+        # Opposing faces that are smoothed together cancel out and are assigned the fallback normal
+        faceVertexCounts = Vt.IntArray([3, 3])
+        faceVertexIndices = Vt.IntArray([0, 1, 2, 0, 2, 1])
+        points = Vt.Vec3fArray([Gf.Vec3f(0.0, 0.0, 0.0), Gf.Vec3f(1.0, 0.0, 0.0), Gf.Vec3f(0.0, 1.0, 0.0)])
+        with usdex.test.ScopedDiagnosticChecker(
+            self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*Some smoothing groups have opposing faces and have been assigned fallback normals.*")]
+        ):
+            normals = usdex.core.computeMeshNormals(
+                faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.faceVarying, Gf.Vec3f(1.0, 0.0, 0.0), 180.0
+            )
+        self.assertTrue(normals.isValid())
+        self.assertEqual(normals.values(), Vt.Vec3fArray([Gf.Vec3f(1.0, 0.0, 0.0)] * 3))
+
     def testComputeMeshNormalsSmallVertices(self):
         faceVertexCounts = Vt.IntArray([4])
         faceVertexIndices = Vt.IntArray([0, 1, 2, 3])
@@ -644,6 +1177,189 @@ class DefineMeshTestCase(DefinePointBasedTestCaseMixin, usdex.test.DefineFunctio
         self.assertTrue(len(primvar.Get()) > 0)
         self.assertEqual(len(primvar.GetIndices()), 8)
 
+    def testConcurrentPythonThreads(self):
+        # The GIL is released while authoring, so separate stages may be authored from several python threads at once
+        def author(index):
+            stage = Usd.Stage.CreateInMemory()
+            UsdGeom.Xform.Define(stage, "/World")
+            names = usdex.core.getValidChildNames(stage.GetPrimAtPath("/World"), ["1 mesh"] * 8)
+            for name in names:
+                mesh = usdex.core.definePolyMesh(stage, Sdf.Path(f"/World/{name}"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS)
+                usdex.core.computeMeshNormals(mesh, UsdGeom.Tokens.faceVarying)
+            return stage.GetRootLayer().ExportToString()
+
+        expected = author(0)
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            results = list(executor.map(author, range(8)))
+        for result in results:
+            self.assertEqual(result, expected)
+
+    def testVerifySharedArrays(self):
+        # The debug mode reads back each authored array and reports any copies as coding errors, so none are expected here
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0, 1, 0)]), Vt.IntArray([0] * len(POINTS)))
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.faceVarying, Vt.Vec2fArray([Gf.Vec2f(i, i) for i in range(len(FACE_VERTEX_INDICES))]))
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]))
+        displayOpacity = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([0.5]))
+
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(stage, "/World")
+        Tf.Debug.SetDebugSymbolsByName("USDEX_VERIFY_SHARED_ARRAYS", True)
+        try:
+            with usdex.test.ScopedDiagnosticChecker(self, []):
+                mesh = usdex.core.definePolyMesh(
+                    stage,
+                    Sdf.Path("/World/Mesh"),
+                    FACE_VERTEX_COUNTS,
+                    FACE_VERTEX_INDICES,
+                    POINTS,
+                    normals=normals,
+                    uvs=uvs,
+                    displayColor=displayColor,
+                    displayOpacity=displayOpacity,
+                )
+                self.assertTrue(mesh)
+
+                # Specs authored directly to the layer are verified in the same way
+                with usdex.core.BulkAuthoringScope(stage):
+                    points = usdex.core.definePointCloud(stage, Sdf.Path("/World/BulkPoints"), POINTS, normals=normals, displayColor=displayColor)
+                self.assertTrue(points)
+        finally:
+            Tf.Debug.SetDebugSymbolsByName("USDEX_VERIFY_SHARED_ARRAYS", False)
+
+        self.assertEqual(stage.GetPrimAtPath("/World/Mesh").GetAttribute("points").Get(), POINTS)
+        self.assertEqual(stage.GetPrimAtPath("/World/BulkPoints").GetAttribute("points").Get(), POINTS)
+
+    def testDefinePolyMeshIndexing(self):
+        stage = self.createTestStage()
+        UsdGeom.Scope.Define(stage, "/World/Indexing")
+
+        # Normals and uvs that differ by a few ULPs are merged by quantized indexing
+        up = Gf.Vec3f(0.0, 1.0, 0.0)
+        almostUp = Gf.Vec3f(0.0, 0.99999994, 0.0000001)
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, Vt.Vec3fArray([up, almostUp] * 4))
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.faceVarying, Vt.Vec2fArray([Gf.Vec2f(0.0, 0.0), Gf.Vec2f(0.0000001, 0.0)] * 4))
+
+        mesh = usdex.core.definePolyMesh(
+            stage,
+            Sdf.Path("/World/Indexing/Tolerance"),
+            FACE_VERTEX_COUNTS,
+            FACE_VERTEX_INDICES,
+            POINTS,
+            indexing=usdex.core.PolyMeshIndexing(tolerance=0.0001),
+            normals=normals,
+            uvs=uvs,
+        )
+        self.assertTrue(mesh)
+        normalsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertEqual(normalsPrimvar.Get(), Vt.Vec3fArray([up]))
+        self.assertEqual(normalsPrimvar.GetIndices(), Vt.IntArray([0] * 8))
+        uvsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdUtils.GetPrimaryUVSetName())
+        self.assertEqual(uvsPrimvar.Get(), Vt.Vec2fArray([Gf.Vec2f(0.0, 0.0)]))
+        self.assertEqual(uvsPrimvar.GetIndices(), Vt.IntArray([0] * 8))
+
+        # A relative precision merges the normals, but components near zero remain distinct
+        mesh = usdex.core.definePolyMesh(
+            stage,
+            Sdf.Path("/World/Indexing/Precision"),
+            FACE_VERTEX_COUNTS,
+            FACE_VERTEX_INDICES,
+            POINTS,
+            indexing=usdex.core.PolyMeshIndexing(precision=16),
+            normals=usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, Vt.Vec3fArray([up, Gf.Vec3f(0.0, 0.99999994, 0.0)] * 4)),
+            uvs=uvs,
+        )
+        self.assertTrue(mesh)
+        normalsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertEqual(normalsPrimvar.Get(), Vt.Vec3fArray([up]))
+        uvsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdUtils.GetPrimaryUVSetName())
+        self.assertEqual(uvsPrimvar.Get(), Vt.Vec2fArray([Gf.Vec2f(0.0, 0.0), Gf.Vec2f(0.0000001, 0.0)]))
+        self.assertEqual(uvsPrimvar.GetIndices(), Vt.IntArray([0, 1] * 4))
+
+        # Without a tolerance or precision the values are indexed exactly
+        mesh = usdex.core.definePolyMesh(
+            stage,
+            Sdf.Path("/World/Indexing/Exact"),
+            FACE_VERTEX_COUNTS,
+            FACE_VERTEX_INDICES,
+            POINTS,
+            indexing=usdex.core.PolyMeshIndexing(),
+            normals=normals,
+        )
+        self.assertTrue(mesh)
+        normalsPrimvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertEqual(normalsPrimvar.Get(), Vt.Vec3fArray([up, almostUp]))
+        self.assertEqual(normalsPrimvar.GetIndices(), Vt.IntArray([0, 1] * 4))
+
+        # Invalid primvars are reported by the usual validation
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid normals")]):
+            mesh = usdex.core.definePolyMesh(
+                stage,
+                Sdf.Path("/World/Indexing/Invalid"),
+                FACE_VERTEX_COUNTS,
+                FACE_VERTEX_INDICES,
+                POINTS,
+                indexing=usdex.core.PolyMeshIndexing(tolerance=0.0001),
+                normals=usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, Vt.Vec3fArray([up] * 3)),
+            )
+        self.assertFalse(mesh)
+
+        self.assertIsValidUsd(stage)
+
+    def testComputeMeshNormalsParallelMatchesSerial(self):
+        # Build a large, non-planar grid of triangles, quads and pentagons so that the computation is split across several tasks
+        rng = random.Random(0)
+        resolution = 96
+        points = []
+        for y in range(resolution + 1):
+            for x in range(resolution + 1):
+                points.append(Gf.Vec3f(x, y, rng.uniform(-0.5, 0.5)))
+
+        faceVertexCounts = []
+        faceVertexIndices = []
+        for y in range(resolution):
+            for x in range(resolution):
+                i0 = y * (resolution + 1) + x
+                i1 = i0 + 1
+                i2 = i1 + resolution + 1
+                i3 = i0 + resolution + 1
+                kind = (x + y) % 3
+                if kind == 0:
+                    faceVertexCounts.extend([3, 3])
+                    faceVertexIndices.extend([i0, i1, i2, i0, i2, i3])
+                elif kind == 1:
+                    faceVertexCounts.append(4)
+                    faceVertexIndices.extend([i0, i1, i2, i3])
+                else:
+                    # a pentagon with a repeated vertex is still a valid (if unusual) polygon
+                    faceVertexCounts.append(5)
+                    faceVertexIndices.extend([i0, i1, i2, i3, i0])
+
+        faceVertexCounts = Vt.IntArray(faceVertexCounts)
+        faceVertexIndices = Vt.IntArray(faceVertexIndices)
+        points = Vt.Vec3fArray(points)
+
+        initialLimit = Work.GetConcurrencyLimit()
+        try:
+            for interpolation in (UsdGeom.Tokens.uniform, UsdGeom.Tokens.vertex, UsdGeom.Tokens.faceVarying):
+                Work.SetConcurrencyLimit(1)
+                serial = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, interpolation)
+                Work.SetMaximumConcurrencyLimit()
+                parallel = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, interpolation)
+                self.assertTrue(serial.isValid())
+                self.assertTrue(parallel.isValid())
+                # the results must be bitwise identical regardless of the number of threads
+                self.assertEqual(serial, parallel, msg=f"Mismatched {interpolation} normals")
+
+            # crease-aware normals are also independent of the number of threads
+            Work.SetConcurrencyLimit(1)
+            serial = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.faceVarying, smoothingAngle=20.0)
+            Work.SetMaximumConcurrencyLimit()
+            parallel = usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.faceVarying, smoothingAngle=20.0)
+            self.assertTrue(serial.isValid())
+            self.assertEqual(serial, parallel, msg="Mismatched smoothed faceVarying normals")
+        finally:
+            Work.SetConcurrencyLimit(initialLimit)
+
     # Error message prefix for each subset-definition function (must match MeshAlgo.cpp).
     _SUBSET_ERROR_PREFIX = {
         usdex.core.definePartitionedSubsets: "partitioned subsets",
@@ -1580,3 +2296,232 @@ class DefineMeshTestCase(DefinePointBasedTestCaseMixin, usdex.test.DefineFunctio
         self.assertTrue(prop.IsValid())
 
         self.assertIsValidUsd(stage)
+
+    def testDefineSubsets_invalidIndices(self):
+        stage = self.createTestStage()
+        propName = f"subsetFamily:{UsdShade.Tokens.materialBind}:familyType"
+
+        for define_subset_func, prefix in self._SUBSET_ERROR_PREFIX.items():
+            mesh = self.define4faceMesh(stage, f"invalid_indices_{define_subset_func.__name__}")
+            quad_mesh = self.defineQuadMesh(stage, f"invalid_edges_{define_subset_func.__name__}")
+            cases = [
+                (mesh, UsdGeom.Tokens.face, [Vt.IntArray([0, 1]), Vt.IntArray([2, 4])], "greater than the element count 4"),
+                (mesh, UsdGeom.Tokens.face, [Vt.IntArray([0, 1]), Vt.IntArray([-1])], "less than 0"),
+                (quad_mesh, UsdGeom.Tokens.point, [Vt.IntArray([0, 1, 2, 3]), Vt.IntArray([5])], "greater than the element count 4"),
+                (quad_mesh, UsdGeom.Tokens.edge, [Vt.IntArray([0, 1, 1, 2]), Vt.IntArray([2, 3, 3])], "odd number of edge indices"),
+                (quad_mesh, UsdGeom.Tokens.edge, [Vt.IntArray([0, 1, 1, 2]), Vt.IntArray([2, 3, 0, 2])], r"edge \(0, 2\).*not an edge of the mesh"),
+            ]
+            for target, element_type, indices, message in cases:
+                with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, f".*Failed to define {prefix}.*{message}.*")]):
+                    subsets = define_subset_func(target, ["subset1", "subset2"], indices, elementType=element_type)
+                self.assertEqual(subsets, [])
+
+                # Subsets are validated before authoring, so nothing is authored on failure
+                self.assertEqual(target.GetPrim().GetChildren(), [])
+                self.assertFalse(target.GetPrim().GetProperty(propName).IsValid())
+
+        self.assertIsValidUsd(stage)
+
+    def testDefinePartitionedSubsets_manySubsets(self):
+        # A strip of quads with one subset per face
+        stage = self.createTestStage()
+        numFaces = 1000
+        points = Vt.Vec3fArray([Gf.Vec3f(i, j, 0) for i in range(numFaces + 1) for j in range(2)])
+        faceVertexIndices = Vt.IntArray([index for i in range(numFaces) for index in (i * 2, i * 2 + 2, i * 2 + 3, i * 2 + 1)])
+        mesh = usdex.core.definePolyMesh(
+            stage.GetDefaultPrim(),
+            "strip",
+            faceVertexCounts=Vt.IntArray([4] * numFaces),
+            faceVertexIndices=faceVertexIndices,
+            points=points,
+        )
+        names = [f"subset_{i}" for i in range(numFaces)]
+        indices = [Vt.IntArray([i]) for i in reversed(range(numFaces))]
+
+        subsets = usdex.core.definePartitionedSubsets(mesh, names, indices)
+        self.assertEqual(len(subsets), numFaces)
+        for subset, name, subsetIndices in zip(subsets, names, indices):
+            self.assertEqual(subset.GetPrim().GetName(), name)
+            self.assertEqual(subset.GetIndicesAttr().Get(), subsetIndices)
+            self.assertEqual(subset.GetFamilyNameAttr().Get(), UsdShade.Tokens.materialBind)
+
+        # The authored family is valid according to OpenUSD
+        self.assertEqual(UsdGeom.Subset.GetFamilyType(mesh, UsdShade.Tokens.materialBind), UsdGeom.Tokens.partition)
+        valid, reason = UsdGeom.Subset.ValidateFamily(mesh, UsdGeom.Tokens.face, UsdShade.Tokens.materialBind)
+        self.assertTrue(valid, msg=reason)
+
+        # A single face left unassigned is an invalid partition
+        other = usdex.core.definePolyMesh(
+            stage.GetDefaultPrim(),
+            "other",
+            faceVertexCounts=Vt.IntArray([4] * numFaces),
+            faceVertexIndices=faceVertexIndices,
+            points=points,
+        )
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, f".*does not match the element count {numFaces}.*")]):
+            subsets = usdex.core.definePartitionedSubsets(other, names[1:], indices[1:])
+        self.assertEqual(subsets, [])
+        self.assertEqual(other.GetPrim().GetChildren(), [])
+        self.assertIsValidUsd(stage)
+
+    def testDefinePartitionedSubsetsFromFaceIds(self):
+        stage = self.createTestStage()
+        mesh = self.define4faceMesh(stage, "face_ids_mesh")
+
+        # Ids that are not referenced by any face are skipped
+        names = ["red", "green", "blue"]
+        faceIds = Vt.IntArray([2, 0, 2, 0])
+        subsets = usdex.core.definePartitionedSubsetsFromFaceIds(mesh, faceIds, names)
+        self.assertEqual([subset.GetPrim().GetName() for subset in subsets], ["red", "blue"])
+        self.assertEqual(subsets[0].GetIndicesAttr().Get(), Vt.IntArray([1, 3]))
+        self.assertEqual(subsets[1].GetIndicesAttr().Get(), Vt.IntArray([0, 2]))
+        for subset in subsets:
+            self.assertEqual(subset.GetElementTypeAttr().Get(), UsdGeom.Tokens.face)
+            self.assertEqual(subset.GetFamilyNameAttr().Get(), UsdShade.Tokens.materialBind)
+        self.assertEqual(UsdGeom.Subset.GetFamilyType(mesh, UsdShade.Tokens.materialBind), UsdGeom.Tokens.partition)
+        self.assertIsValidUsd(stage)
+
+    def testDefinePartitionedSubsetsFromFaceIds_materials(self):
+        stage = self.createTestStage()
+        looks = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild("Looks")).GetPrim()
+        materials = [
+            usdex.core.definePreviewMaterial(looks, "red", Gf.Vec3f(1, 0, 0)),
+            usdex.core.definePreviewMaterial(looks, "green", Gf.Vec3f(0, 1, 0)),
+        ]
+        mesh = self.define4faceMesh(stage, "face_ids_mesh")
+        subsets = usdex.core.definePartitionedSubsetsFromFaceIds(mesh, Vt.IntArray([1, 1, 0, 1]), ["red", "green"], materials, familyName="foo")
+        self.assertEqual(len(subsets), 2)
+        for subset, material in zip(subsets, materials):
+            self.assertEqual(subset.GetFamilyNameAttr().Get(), "foo")
+            bound, _ = UsdShade.MaterialBindingAPI(subset.GetPrim()).ComputeBoundMaterial()
+            self.assertEqual(bound.GetPrim(), material.GetPrim())
+
+    def testDefinePartitionedSubsetsFromFaceIds_invalid(self):
+        stage = self.createTestStage()
+        mesh = self.define4faceMesh(stage, "face_ids_mesh")
+        names = ["a", "b"]
+
+        cases = [
+            (Vt.IntArray([0, 1, 0]), names, [], "Expected 4 values but found 3"),
+            (Vt.IntArray([0, 1, 2, 0]), names, [], r"invalid face id 2 at face 2"),
+            (Vt.IntArray([0, 1, -1, 0]), names, [], r"invalid face id -1 at face 2"),
+            (Vt.IntArray([0, 0, 0, 0]), [], [], "invalid names or indices"),
+            (Vt.IntArray([0, 1, 0, 1]), names, [UsdShade.Material()], "Length of materials must equal length of names"),
+            (Vt.IntArray([0, 1, 0, 1]), ["a", "a"], [], "duplicate subset name"),
+        ]
+        for faceIds, subsetNames, materials, message in cases:
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, f".*Failed to define partitioned subsets.*{message}.*")]):
+                subsets = usdex.core.definePartitionedSubsetsFromFaceIds(mesh, faceIds, subsetNames, materials)
+            self.assertEqual(subsets, [])
+            self.assertEqual(mesh.GetPrim().GetChildren(), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid prim")]):
+            self.assertEqual(usdex.core.definePartitionedSubsetsFromFaceIds(UsdGeom.Mesh(), Vt.IntArray([0]), names), [])
+
+    def testMeshTopology(self):
+        topology = usdex.core.MeshTopology(FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES)
+        self.assertTrue(topology.isValid())
+        self.assertEqual(topology.getFaceVertexCounts(), FACE_VERTEX_COUNTS)
+        self.assertEqual(topology.getFaceVertexIndices(), FACE_VERTEX_INDICES)
+        self.assertEqual(topology.getFaceOffsets(), [0, 4])
+        self.assertEqual(topology.getFaceCount(), 2)
+        self.assertEqual(topology.getFaceVertexCount(), 8)
+        self.assertEqual(topology.getMaxIndex(), 5)
+
+        # The topology is validated on construction
+        with usdex.test.ScopedDiagnosticChecker(
+            self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Unable to create MeshTopology due to invalid topology")]
+        ):
+            invalid = usdex.core.MeshTopology(Vt.IntArray([4, 4]), Vt.IntArray([0, 1, 2]))
+        self.assertFalse(invalid.isValid())
+
+        with usdex.test.ScopedDiagnosticChecker(
+            self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Unable to create MeshTopology due to invalid topology")]
+        ):
+            invalid = usdex.core.MeshTopology(Vt.IntArray([3]), Vt.IntArray([0, -1, 2]))
+        self.assertFalse(invalid.isValid())
+
+        # An invalid topology is rejected by the functions which accept it
+        stage = self.createTestStage()
+        path = stage.GetDefaultPrim().GetPath().AppendChild("InvalidTopology")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology: The MeshTopology is not valid")]):
+            self.assertFalse(usdex.core.definePolyMesh(stage, path, invalid, POINTS))
+        self.assertFalse(stage.GetPrimAtPath(path))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid topology: The MeshTopology is not valid")]):
+            self.assertFalse(usdex.core.computeMeshNormals(invalid, POINTS).isValid())
+
+    def testDefinePolyMeshWithTopology(self):
+        stage = self.createTestStage()
+        root = stage.GetDefaultPrim().GetPath()
+        topology = usdex.core.MeshTopology(FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES)
+        normals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0, -1, 0)] * len(POINTS)))
+
+        # The result matches a mesh defined from the topology arrays
+        expected = usdex.core.definePolyMesh(stage, root.AppendChild("Arrays"), FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, normals)
+        mesh = usdex.core.definePolyMesh(stage, root.AppendChild("Topology"), topology, POINTS, normals)
+        self.assertTrue(mesh)
+        for attr in expected.GetPrim().GetAuthoredAttributes():
+            self.assertEqual(mesh.GetPrim().GetAttribute(attr.GetName()).Get(), attr.Get(), msg=attr.GetName())
+        self.assertIsValidUsd(stage)
+
+        # The same topology may be reused for any number of meshes
+        for i in range(3):
+            self.assertTrue(usdex.core.definePolyMesh(stage, root.AppendChild(f"Copy_{i}"), topology, POINTS))
+
+        # The points must cover every face vertex index
+        path = root.AppendChild("TooFewPoints")
+        with usdex.test.ScopedDiagnosticChecker(
+            self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points: Expected at least 6 points but found 3")]
+        ):
+            self.assertFalse(usdex.core.definePolyMesh(stage, path, topology, Vt.Vec3fArray(list(POINTS)[:3])))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points: Empty array")]):
+            self.assertFalse(usdex.core.definePolyMesh(stage, path, topology, Vt.Vec3fArray()))
+
+        # Primvars are validated against the cached element counts
+        uvs = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.faceVarying, Vt.Vec2fArray([Gf.Vec2f(0, 0)] * 7))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid uvs")]):
+            self.assertFalse(usdex.core.definePolyMesh(stage, path, topology, POINTS, uvs=uvs))
+        self.assertFalse(stage.GetPrimAtPath(path))
+
+    def testSetPolyMeshPoints(self):
+        stage = self.createTestStage()
+        topology = usdex.core.MeshTopology(FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES)
+        mesh = usdex.core.definePolyMesh(stage, stage.GetDefaultPrim().GetPath().AppendChild("Deforming"), topology, POINTS)
+        self.assertTrue(mesh)
+
+        for time in range(3):
+            points = Vt.Vec3fArray([point + Gf.Vec3f(0, time, 0) for point in POINTS])
+            normals = usdex.core.computeMeshNormals(topology, points, UsdGeom.Tokens.vertex)
+            self.assertTrue(usdex.core.setPolyMeshPoints(mesh, topology, points, time, normals))
+
+        self.assertEqual(mesh.GetPointsAttr().GetTimeSamples(), [0.0, 1.0, 2.0])
+        self.assertEqual(mesh.GetExtentAttr().GetTimeSamples(), [0.0, 1.0, 2.0])
+        for time in range(3):
+            self.assertEqual(mesh.GetExtentAttr().Get(time), UsdGeom.Boundable.ComputeExtentFromPlugins(mesh, time))
+        primvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(UsdGeom.Tokens.normals)
+        self.assertEqual(primvar.GetTimeSamples(), [0.0, 1.0, 2.0])
+        self.assertEqual(primvar.GetInterpolation(), UsdGeom.Tokens.vertex)
+
+        # The default values authored by definePolyMesh are unaffected
+        self.assertEqual(mesh.GetPointsAttr().Get(Usd.TimeCode.Default()), POINTS)
+        self.assertIsValidUsd(stage)
+
+        # Invalid data is not authored
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points: Expected at least 6 points")]):
+            self.assertFalse(usdex.core.setPolyMeshPoints(mesh, topology, Vt.Vec3fArray(list(POINTS)[:5]), 3))
+        invalidNormals = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.uniform, Vt.Vec3fArray([Gf.Vec3f(0, 0, 1)]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid normals")]):
+            self.assertFalse(usdex.core.setPolyMeshPoints(mesh, topology, POINTS, 3, invalidNormals))
+        self.assertEqual(mesh.GetPointsAttr().GetTimeSamples(), [0.0, 1.0, 2.0])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdGeomMesh")]):
+            self.assertFalse(usdex.core.setPolyMeshPoints(UsdGeom.Mesh(), topology, POINTS, 3))
+
+    def testComputeMeshNormalsWithTopology(self):
+        topology = usdex.core.MeshTopology(FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES)
+        for interpolation in (UsdGeom.Tokens.uniform, UsdGeom.Tokens.vertex, UsdGeom.Tokens.faceVarying):
+            expected = usdex.core.computeMeshNormals(FACE_VERTEX_COUNTS, FACE_VERTEX_INDICES, POINTS, interpolation)
+            self.assertEqual(usdex.core.computeMeshNormals(topology, POINTS, interpolation), expected, msg=interpolation)
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points: Expected at least 6 points")]):
+            self.assertFalse(usdex.core.computeMeshNormals(topology, Vt.Vec3fArray(list(POINTS)[:2])).isValid())
@@ -2,9 +2,10 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+
 import usdex.core
 import usdex.test
-from pxr import Sdf, Tf, Usd, UsdGeom
+from pxr import Sdf, Tf, Usd, UsdGeom, Work
 
 
 class TranscodingTestCase(usdex.test.TestCase):
@@ -34,6 +35,23 @@ class TranscodingTestCase(usdex.test.TestCase):
             "tn__my_encoded_identifier_x134bc",
         )
 
+    def testEncodeLongAsciiIdentifier(self):
+        # Valid identifiers spanning several blocks are returned unchanged
+        for length in (15, 16, 17, 31, 32, 33, 100):
+            name = ("aZ_09" * 25)[:length]
+            name = "n" + name[1:]
+            self.assertEqual(usdex.core.getValidPrimName(name), name)
+            self.assertEqual(usdex.core.getValidPropertyName(f"{name}:{name}"), f"{name}:{name}")
+
+        # Invalid characters are detected at any position within a block
+        name = "a" * 40
+        for index in (1, 15, 16, 17, 32, 39):
+            for character in ("-", "/", "@", "[", "`", "{", "ß"):
+                invalid = name[:index] + character + name[index + 1 :]
+                self.assertNotEqual(usdex.core.getValidPrimName(invalid), invalid)
+                self.assertTrue(Tf.IsValidIdentifier(usdex.core.getValidPrimName(invalid)))
+                self.assertEqual(usdex.core.getValidPropertyName(f"{name}:{invalid}"), f"{name}:{usdex.core.getValidPrimName(invalid)}")
+
     def testEncodeAsciiInvalid(self):
         self.assertEqual(
             usdex.core.getValidPrimName("123-456/555"),
@@ -281,6 +299,46 @@ class ValidPrimNamesTestCase(usdex.test.TestCase):
 
         self.assertIsValidUsd(stage)
 
+    def testGetValidChildNamesManyCollisions(self):
+        # Many colliding siblings (e.g. a flat bill of materials) must produce unique names. The scaling is measured by the benchmarks.
+        stage = Usd.Stage.CreateInMemory()
+        prim = UsdGeom.Xform.Define(stage, "/Root").GetPrim()
+        UsdGeom.Xform.Define(stage, "/Root/Part")
+
+        for count in (1000, 10000, 100000):
+            names = ["Part"] * count
+            # interleave some requested names which collide with the generated suffixes
+            names[count // 2] = "Part_1"
+            result = usdex.core.getValidChildNames(prim, names)
+
+            self.assertEqual(len(result), count)
+            self.assertEqual(len(set(result)), count)
+            self.assertNotIn("Part", result)
+            self.assertEqual(result[count // 2], "Part_1")
+
+    def testGetValidNamesConcurrency(self):
+        # Large batches are transcoded in parallel, but the result must be identical to that of the serial algorithm
+        names = []
+        for i in range(5000):
+            names.extend([f"Part {i % 97}", "カーテンウォール", f"Part_{i % 13}", "", f"foo:bär {i % 7}"])
+
+        initialLimit = Work.GetConcurrencyLimit()
+        try:
+            Work.SetConcurrencyLimit(1)
+            serialPrimNames = usdex.core.getValidPrimNames(names, reservedNames=["Part_1"])
+            serialPropertyNames = usdex.core.getValidPropertyNames(names, reservedNames=["foo:tn__br0_ie"])
+            Work.SetMaximumConcurrencyLimit()
+            parallelPrimNames = usdex.core.getValidPrimNames(names, reservedNames=["Part_1"])
+            parallelPropertyNames = usdex.core.getValidPropertyNames(names, reservedNames=["foo:tn__br0_ie"])
+        finally:
+            Work.SetConcurrencyLimit(initialLimit)
+
+        self.assertEqual(serialPrimNames, parallelPrimNames)
+        self.assertEqual(serialPropertyNames, parallelPropertyNames)
+        self.assertEqual(len(set(parallelPrimNames)), len(names))
+        self.assertEqual(len(set(parallelPropertyNames)), len(names))
+        self.assertNotIn("Part_1", parallelPrimNames)
+
     def testGetValidPropertyName(self):
         # Test cases for getValidPropertyName() where the values are (<name>, <result>)
         data = [
@@ -603,6 +661,33 @@ class NameCacheTestCase(usdex.test.TestCase):
         parent: Sdf.Path = Sdf.Path("/path")
         self.assertEqual(self.nameCache.getPrimNames(parent, ["foo", "foo", "foo_1"]), ["foo", "foo_2", "foo_1"])
 
+    def testReservePrimName(self):
+        # A reserved name is never returned, and can only be reserved once
+        parent: Sdf.Path = Sdf.Path("/path")
+        self.assertTrue(self.nameCache.reservePrimName(parent, "foo"))
+        self.assertFalse(self.nameCache.reservePrimName(parent, "foo"))
+        self.assertEqual(self.nameCache.getPrimName(parent, "foo"), "foo_1")
+
+        # Names returned by requests are also reserved
+        self.assertFalse(self.nameCache.reservePrimName(parent, "foo_1"))
+
+        # Existing children of a prim are reserved when the cache entry is created
+        stage = Usd.Stage.CreateInMemory()
+        prim = stage.DefinePrim("/Root")
+        stage.DefinePrim("/Root/child")
+        self.assertFalse(self.nameCache.reservePrimName(prim, "child"))
+        self.assertTrue(self.nameCache.reservePrimName(prim, "other"))
+
+        # Properties are reserved independently of prims
+        self.assertTrue(self.nameCache.reservePropertyName(parent, "foo"))
+        self.assertEqual(self.nameCache.getPropertyName(parent, "foo"), "foo_1")
+
+        # Invalid parents cannot reserve names
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Unable to reserve prim name")]):
+            self.assertFalse(self.nameCache.reservePrimName(Sdf.Path("relative"), "foo"))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Unable to reserve property name")]):
+            self.assertFalse(self.nameCache.reservePropertyName(Sdf.Path.absoluteRootPath, "foo"))
+
     def testGetPrimNamesParentTypes(self):
         # An SdfPath can be passed as the parent and valid an unique names will be returned
         parent: Sdf.Path = Sdf.Path("/path")
@@ -1128,3 +1213,23 @@ class DisplayNameTestCase(usdex.test.TestCase):
         self.assertEqual(result, rocket_emoji)
 
         self.assertIsValidUsd(stage)
+
+    def testComputeEffectiveDisplayNames(self):
+        stage = Usd.Stage.CreateInMemory()
+        names = usdex.core.getValidChildNames(stage.GetPseudoRoot(), ["カーテンウォール", "Bäcker", "Root", "tn__invalid"])
+        prims = [stage.DefinePrim(Sdf.Path.absoluteRootPath.AppendChild(name)) for name in names]
+        self.assertTrue(usdex.core.setDisplayName(prims[2], "Root Display Name"))
+        prims.append(Usd.Prim())
+
+        # The results match computeEffectiveDisplayName, with an empty string for invalid prims
+        result = usdex.core.computeEffectiveDisplayNames(prims)
+        self.assertEqual(result, [usdex.core.computeEffectiveDisplayName(prim) for prim in prims[:-1]] + [""])
+
+        # Transcoded names can be decoded, while names which are not valid encodings are returned unchanged
+        result = usdex.core.computeEffectiveDisplayNames(prims, decodeNames=True)
+        self.assertEqual(result, ["カーテンウォール", "Bäcker", "Root Display Name", "tn__invalid", ""])
+
+        # Large batches are processed in parallel, with results matching those of smaller batches
+        many = prims[:-1] * 2000
+        result = usdex.core.computeEffectiveDisplayNames(many, decodeNames=True)
+        self.assertEqual(result, ["カーテンウォール", "Bäcker", "Root Display Name", "tn__invalid"] * 2000)
@@ -0,0 +1,204 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import math
+
+import usdex.core
+import usdex.test
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdPhysics, Vt
+
+
+class PhysicsCollisionAlgoTest(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(self.stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        self.body = usdex.core.defineXform(self.stage.GetDefaultPrim(), "Body").GetPrim()
+
+    # A mesh referencing each of the points once, so that the points determine the collision shape regardless of the topology
+    def defineMesh(self, parent: Usd.Prim, name: str, points: Vt.Vec3fArray) -> UsdGeom.Mesh:
+        faceCount = len(points) // 3
+        mesh = usdex.core.definePolyMesh(parent, name, Vt.IntArray([3] * faceCount), Vt.IntArray(range(faceCount * 3)), points)
+        self.assertTrue(mesh)
+        return mesh
+
+    # The points of a 3x3x3 lattice spanning the given bounds, most of which are on the faces or within the box
+    def createLattice(self, minimum: Gf.Vec3f, maximum: Gf.Vec3f) -> Vt.Vec3fArray:
+        values = [[minimum[axis], (minimum[axis] + maximum[axis]) * 0.5, maximum[axis]] for axis in range(3)]
+        return Vt.Vec3fArray([Gf.Vec3f(x, y, z) for x in values[0] for y in values[1] for z in values[2]])
+
+    # Points evenly distributed over a sphere, all of which are vertices of their convex hull
+    def createSpherePoints(self, count: int, radius: float) -> Vt.Vec3fArray:
+        points = []
+        for i in range(count):
+            z = 1.0 - (2.0 * i + 1.0) / count
+            ring = math.sqrt(1.0 - z * z)
+            angle = i * math.pi * (3.0 - math.sqrt(5.0))
+            points.append(Gf.Vec3f(math.cos(angle) * ring, math.sin(angle) * ring, z) * radius)
+        return Vt.Vec3fArray(points)
+
+    def assertIsCollider(self, prim: Usd.Prim, mesh: UsdGeom.Mesh):
+        self.assertTrue(prim)
+        self.assertEqual(prim.GetParent(), mesh.GetPrim().GetParent())
+        self.assertEqual(prim.GetName(), f"{mesh.GetPrim().GetName()}Collision")
+        self.assertTrue(prim.HasAPI(UsdPhysics.CollisionAPI))
+        self.assertEqual(UsdGeom.Imageable(prim).GetPurposeAttr().Get(), UsdGeom.Tokens.guide)
+        # The mesh itself is not a collider, so that simulators do not cook it
+        self.assertFalse(mesh.GetPrim().HasAPI(UsdPhysics.CollisionAPI))
+
+    # Every point is on or inside each face of the hull, and is a point of the mesh
+    def assertIsConvexHull(self, hull: UsdGeom.Mesh, points: Vt.Vec3fArray, enclosed: bool = True):
+        hullPoints = hull.GetPointsAttr().Get()
+        counts = hull.GetFaceVertexCountsAttr().Get()
+        indices = hull.GetFaceVertexIndicesAttr().Get()
+        self.assertEqual(set(counts), {3})
+        # A closed triangulated hull has 2V - 4 faces
+        self.assertEqual(len(counts), 2 * len(hullPoints) - 4)
+        self.assertTrue(set(hullPoints).issubset(set(points)))
+        if not enclosed:
+            return
+        for i in range(len(counts)):
+            a, b, c = (Gf.Vec3d(hullPoints[indices[i * 3 + j]]) for j in range(3))
+            normal = Gf.Cross(b - a, c - a)
+            self.assertGreater(normal.GetLength(), 0.0)
+            for point in points:
+                self.assertLessEqual(Gf.Dot(normal, Gf.Vec3d(point) - a), 1e-5 * normal.GetLength())
+
+    def testConvexHull(self):
+        points = self.createLattice(Gf.Vec3f(-1, -2, -3), Gf.Vec3f(1, 2, 3))
+        mesh = self.defineMesh(self.body, "Box", points)
+        usdex.core.setLocalTransform(mesh.GetPrim(), Gf.Transform().SetTranslation(Gf.Vec3d(1, 2, 3)))
+
+        colliders = usdex.core.definePhysicsColliders(self.stage, [mesh])
+        self.assertEqual(len(colliders), 1)
+        self.assertIsCollider(colliders[0], mesh)
+        self.assertTrue(colliders[0].HasAPI(UsdPhysics.MeshCollisionAPI))
+        self.assertEqual(UsdPhysics.MeshCollisionAPI(colliders[0]).GetApproximationAttr().Get(), UsdPhysics.Tokens.convexHull)
+
+        # Only the corners of the lattice are vertices of the hull
+        hull = UsdGeom.Mesh(colliders[0])
+        self.assertTrue(hull)
+        self.assertEqual(len(hull.GetPointsAttr().Get()), 8)
+        self.assertIsConvexHull(hull, points)
+
+        # The hull is placed with the mesh
+        self.assertEqual(usdex.core.getLocalTransformMatrix(colliders[0]), usdex.core.getLocalTransformMatrix(mesh.GetPrim()))
+        self.assertIsValidUsd(self.stage)
+
+    def testConvexHullVertexLimit(self):
+        points = self.createSpherePoints(300, 2.0)
+        meshes = [self.defineMesh(self.body, "Full", points), self.defineMesh(self.body, "Limited", points)]
+
+        full = usdex.core.definePhysicsColliders(self.stage, meshes[:1], usdex.core.CollisionApproximation.eConvexHull, 300)
+        self.assertEqual(len(full), 1)
+        self.assertEqual(len(UsdGeom.Mesh(full[0]).GetPointsAttr().Get()), 300)
+        self.assertIsConvexHull(UsdGeom.Mesh(full[0]), points)
+
+        limited = usdex.core.definePhysicsColliders(self.stage, meshes[1:], maxHullVertices=16)
+        self.assertEqual(len(limited), 1)
+        self.assertEqual(len(UsdGeom.Mesh(limited[0]).GetPointsAttr().Get()), 16)
+        self.assertIsConvexHull(UsdGeom.Mesh(limited[0]), points, enclosed=False)
+
+    def testBoundingCube(self):
+        points = self.createSpherePoints(30, 1.0)
+        points = Vt.Vec3fArray([Gf.Vec3f(x * 2.0 + 1.0, y, z * 0.5) for x, y, z in points])
+        mesh = self.defineMesh(self.body, "Mesh", points)
+        usdex.core.setLocalTransform(mesh.GetPrim(), Gf.Transform().SetRotation(Gf.Rotation(Gf.Vec3d(0, 0, 1), 90)))
+
+        colliders = usdex.core.definePhysicsColliders(self.stage, [mesh], usdex.core.CollisionApproximation.eBoundingCube)
+        self.assertEqual(len(colliders), 1)
+        self.assertIsCollider(colliders[0], mesh)
+        self.assertFalse(colliders[0].HasAPI(UsdPhysics.MeshCollisionAPI))
+        cube = UsdGeom.Cube(colliders[0])
+        self.assertTrue(cube)
+        self.assertEqual(cube.GetSizeAttr().Get(), 1.0)
+
+        # The unit cube is scaled to the bounds of the points in the local space of the mesh
+        bounds = Gf.Range3d()
+        for point in points:
+            bounds.UnionWith(Gf.Vec3d(point))
+        expected = Gf.Matrix4d().SetScale(bounds.GetSize()) * Gf.Matrix4d().SetTranslate(bounds.GetMidpoint())
+        expected *= usdex.core.getLocalTransformMatrix(mesh.GetPrim())
+        self.assertTrue(Gf.IsClose(usdex.core.getLocalTransformMatrix(colliders[0]), expected, 1e-6))
+        self.assertIsValidUsd(self.stage)
+
+    def testBoundingSphere(self):
+        points = self.createLattice(Gf.Vec3f(0, 0, 0), Gf.Vec3f(2, 2, 2))
+        meshes = [self.defineMesh(self.body, f"Mesh_{i}", points) for i in range(8)]
+
+        colliders = usdex.core.definePhysicsColliders(self.stage, meshes, usdex.core.CollisionApproximation.eBoundingSphere)
+        self.assertEqual(len(colliders), len(meshes))
+        for collider, mesh in zip(colliders, meshes):
+            self.assertIsCollider(collider, mesh)
+            sphere = UsdGeom.Sphere(collider)
+            self.assertTrue(sphere)
+            self.assertAlmostEqual(sphere.GetRadiusAttr().Get(), math.sqrt(3.0))
+            self.assertEqual(usdex.core.getLocalTransformMatrix(collider), Gf.Matrix4d().SetTranslate(Gf.Vec3d(1, 1, 1)))
+        self.assertIsValidUsd(self.stage)
+
+    def testUniqueNames(self):
+        points = self.createLattice(Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 1, 1))
+        mesh = self.defineMesh(self.body, "Mesh", points)
+        self.defineMesh(self.body, "MeshCollision", points)
+
+        colliders = usdex.core.definePhysicsColliders(self.stage, [mesh], usdex.core.CollisionApproximation.eBoundingCube)
+        self.assertEqual(len(colliders), 1)
+        self.assertEqual(colliders[0].GetName(), "MeshCollision_1")
+
+    def testPhysicsContentLayer(self):
+        assetStage = usdex.core.createStage(
+            self.tmpFile("test", "usda"), self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata
+        )
+        payloadStage = usdex.core.createAssetPayload(assetStage)
+        geometryStage = usdex.core.addAssetContent(payloadStage, usdex.core.getGeometryToken())
+        geometry = geometryStage.GetDefaultPrim().GetChild(usdex.core.getGeometryToken())
+        points = self.createSpherePoints(60, 1.0)
+        meshes = [self.defineMesh(usdex.core.defineXform(geometry, f"Body_{i}").GetPrim(), "Mesh", points) for i in range(4)]
+
+        # The meshes are read from the composed payload, while the colliders are authored to the physics content layer
+        physicsStage = usdex.core.addAssetContent(payloadStage, usdex.core.getPhysicsToken())
+        composedMeshes = [UsdGeom.Mesh(payloadStage.GetPrimAtPath(mesh.GetPath())) for mesh in meshes]
+        colliders = usdex.core.definePhysicsColliders(physicsStage, composedMeshes)
+        self.assertEqual(len(colliders), len(meshes))
+
+        physicsLayer = physicsStage.GetRootLayer()
+        geometryLayer = geometryStage.GetRootLayer()
+        for collider, mesh in zip(colliders, composedMeshes):
+            self.assertEqual(collider.GetStage(), physicsStage)
+            self.assertEqual(physicsLayer.GetPrimAtPath(collider.GetPath()).specifier, Sdf.SpecifierDef)
+            self.assertEqual(physicsLayer.GetPrimAtPath(collider.GetPath().GetParentPath()).specifier, Sdf.SpecifierOver)
+            self.assertIsNone(geometryLayer.GetPrimAtPath(collider.GetPath()))
+
+            # The colliders compose with the geometry in the payload
+            composed = payloadStage.GetPrimAtPath(collider.GetPath())
+            self.assertIsCollider(composed, mesh)
+
+    def testInvalidArguments(self):
+        points = self.createLattice(Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 1, 1))
+        mesh = self.defineMesh(self.body, "Mesh", points)
+        flat = self.defineMesh(self.body, "Flat", Vt.Vec3fArray([Gf.Vec3f(x, y, 0) for x in range(3) for y in range(3)]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid stage")]):
+            self.assertEqual(usdex.core.definePhysicsColliders(None, [mesh]), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*fewer than 4 convex hull vertices")]):
+            self.assertEqual(usdex.core.definePhysicsColliders(self.stage, [mesh], maxHullVertices=3), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdGeomMesh")]):
+            self.assertEqual(usdex.core.definePhysicsColliders(self.stage, [mesh, UsdGeom.Mesh()]), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*duplicate mesh")]):
+            self.assertEqual(usdex.core.definePhysicsColliders(self.stage, [mesh, mesh]), [])
+
+        # A flat mesh can be approximated by a sphere, but not by a convex hull or a bounding cube
+        for approximation in (usdex.core.CollisionApproximation.eConvexHull, usdex.core.CollisionApproximation.eBoundingCube):
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*points are degenerate")]):
+                self.assertEqual(usdex.core.definePhysicsColliders(self.stage, [mesh, flat], approximation), [])
+        colliders = usdex.core.definePhysicsColliders(self.stage, [flat], usdex.core.CollisionApproximation.eBoundingSphere)
+        self.assertEqual(len(colliders), 1)
+
+        # Nothing was authored by the failed batches
+        self.assertFalse(self.stage.GetPrimAtPath(mesh.GetPath().GetParentPath().AppendChild("MeshCollision")))
+        self.assertEqual(usdex.core.definePhysicsColliders(self.stage, []), [])
@@ -1874,3 +1874,90 @@ class PhysicsJointAlgoTest_SphericalJoint(PhysicsJointAlgoTest, usdex.test.Defin
         ):
             jointFrame.space = usdex.core.JointFrame.Space.World
             usdex.core.connectPhysicsJoint(joint, Usd.Prim(), Usd.Prim(), jointFrame, axis)
+
+
+class PhysicsJointAlgoTest_DefineJoints(PhysicsJointAlgoTest):
+
+    def createJointStage(self) -> Tuple[Usd.Stage, List[usdex.core.PhysicsJointData]]:
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        body0, body1, jointFrame = self.overrideCreateTestStage(stage)
+        body0Frame = usdex.core.JointFrame(usdex.core.JointFrame.Space.Body0, Gf.Vec3d(1, 2, 3), Gf.Quatd(0.5, 0.5, 0.5, 0.5))
+        joints = f"{stage.GetDefaultPrim().GetPath()}/Joints"
+        Type = usdex.core.PhysicsJointData.Type
+        return stage, [
+            usdex.core.PhysicsJointData(Type.Fixed, f"{joints}/Fixed", body0, body1, jointFrame),
+            usdex.core.PhysicsJointData(Type.Revolute, f"{joints}/Revolute", body0, body1, body0Frame, Gf.Vec3f(0, -1, 0), -45.0, 90.0),
+            usdex.core.PhysicsJointData(Type.Prismatic, f"{joints}/Prismatic", body0, Usd.Prim(), body0Frame, Gf.Vec3f(1, 1, 0), upperLimit=2.0),
+            usdex.core.PhysicsJointData(Type.Spherical, f"{joints}/Spherical", Usd.Prim(), body1, jointFrame, coneAngle0Limit=30, coneAngle1Limit=60),
+        ]
+
+    def testMatchesSingleJoints(self):
+        expected, joints = self.createJointStage()
+        fixed, revolute, prismatic, spherical = joints
+        self.assertTrue(usdex.core.definePhysicsFixedJoint(expected, fixed.path, fixed.body0, fixed.body1, fixed.frame))
+        self.assertTrue(
+            usdex.core.definePhysicsRevoluteJoint(
+                expected,
+                revolute.path,
+                revolute.body0,
+                revolute.body1,
+                revolute.frame,
+                revolute.axis,
+                revolute.lowerLimit,
+                revolute.upperLimit,
+            )
+        )
+        self.assertTrue(
+            usdex.core.definePhysicsPrismaticJoint(
+                expected,
+                prismatic.path,
+                prismatic.body0,
+                prismatic.body1,
+                prismatic.frame,
+                prismatic.axis,
+                prismatic.lowerLimit,
+                prismatic.upperLimit,
+            )
+        )
+        self.assertTrue(
+            usdex.core.definePhysicsSphericalJoint(
+                expected,
+                spherical.path,
+                spherical.body0,
+                spherical.body1,
+                spherical.frame,
+                spherical.axis,
+                spherical.coneAngle0Limit,
+                spherical.coneAngle1Limit,
+            )
+        )
+
+        stage, joints = self.createJointStage()
+        result = usdex.core.definePhysicsJoints(stage, joints)
+        self.assertEqual(len(result), len(joints))
+        self.assertTrue(result[1].GetPrim().IsA(UsdPhysics.RevoluteJoint))
+        self.assertEqual(UsdPhysics.RevoluteJoint(result[1]).GetAxisAttr().Get(), UsdPhysics.Tokens.y)
+        self.assertEqual(result[3].GetBody1Rel().GetTargets(), [joints[3].body1.GetPath()])
+        self.assertFalse(result[3].GetBody0Rel().HasAuthoredTargets())
+
+        # the specs are identical to those authored by the individual functions
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected.GetRootLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+    def testInvalidJoints(self):
+        stage, joints = self.createJointStage()
+        self.assertEqual(usdex.core.definePhysicsJoints(stage, []), [])
+
+        # every invalid joint is reported, and no joints are defined
+        joints[1].path = joints[0].path
+        joints[2].body0 = Usd.Prim()
+        with usdex.test.ScopedDiagnosticChecker(
+            self,
+            [
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*PhysicsRevoluteJoint.*duplicate path"),
+                (Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*PhysicsPrismaticJoint.*Body0 is specified in the JointFrame Space"),
+            ],
+        ):
+            self.assertEqual(usdex.core.definePhysicsJoints(stage, joints), [])
+        self.assertFalse(stage.GetPrimAtPath(joints[0].path.GetParentPath()))
@@ -6,7 +6,7 @@ from typing import List, Tuple
 
 import usdex.core
 import usdex.test
-from pxr import Gf, Usd, UsdGeom, UsdPhysics, UsdShade
+from pxr import Gf, Tf, Usd, UsdGeom, UsdPhysics, UsdShade
 
 
 class PhysicsMaterialAlgoTest(usdex.test.DefineFunctionTestCase):
@@ -286,3 +286,72 @@ class PhysicsMaterialAlgoTest(usdex.test.DefineFunctionTestCase):
         self.assertEqual(pathList[0], visual_physics_material.GetPrim().GetPath())
 
         self.assertIsValidUsd(stage)
+
+    def testPhysicsMaterialRegistry(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        physics = UsdGeom.Scope.Define(stage, stage.GetDefaultPrim().GetPath().AppendChild("Physics")).GetPrim()
+        registry = usdex.core.MaterialRegistry(physics)
+
+        # Identical parameters share a single material
+        rubber = usdex.core.definePhysicsMaterial(registry, "Rubber", 0.8, 0.9, 0.2, 1100.0)
+        self.assertTrue(rubber)
+        self.assertIsPhysicsMaterial(rubber, 0.8, 0.9, 0.2, 1100.0)
+        self.assertEqual(usdex.core.definePhysicsMaterial(registry, "Collider1", 0.8, 0.9, 0.2, 1100.0).GetPath(), rubber.GetPath())
+        self.assertFalse(physics.GetChild("Collider1"))
+
+        # Any differing parameter defines a new material, including a parameter which is not supplied
+        steel = usdex.core.definePhysicsMaterial(registry, "Steel", 0.4, 0.6, 0.2, 7800.0)
+        self.assertNotEqual(steel.GetPath(), rubber.GetPath())
+        partial = usdex.core.definePhysicsMaterial(registry, "Partial", 0.8, 0.9, 0.2)
+        self.assertNotEqual(partial.GetPath(), rubber.GetPath())
+        self.assertFalse(UsdPhysics.MaterialAPI(partial).GetDensityAttr().HasAuthoredValue())
+        self.assertEqual(usdex.core.definePhysicsMaterial(registry, "Partial1", 0.8, 0.9, 0.2).GetPath(), partial.GetPath())
+
+        # Physics materials are not confused with visual materials defined by the same registry
+        self.assertTrue(registry.definePreviewMaterial("Visual", usdex.core.PreviewMaterialParams()))
+        self.assertEqual(registry.getMaterialCount(), 4)
+        self.assertEqual(registry.getReuseCount(), 2)
+        self.assertIsValidUsd(stage)
+
+    def testPhysicsMaterialBindMany(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        defaultPrimPath = stage.GetDefaultPrim().GetPath()
+        rubber = usdex.core.definePhysicsMaterial(stage, f"{defaultPrimPath}/Rubber", 0.8)
+        steel = usdex.core.definePhysicsMaterial(stage, f"{defaultPrimPath}/Steel", 0.4)
+        visual = usdex.core.definePreviewMaterial(stage, f"{defaultPrimPath}/Visual", Gf.Vec3f(0, 1, 0))
+        xform = UsdGeom.Xform.Define(stage, f"{defaultPrimPath}/Colliders").GetPrim()
+        spheres = [self.createSphere(stage, f"{xform.GetPath()}/Sphere{i}", 0.5, Gf.Vec3f(1.0, 0.0, 0.0), Gf.Vec3d(i, 0, 0)) for i in range(4)]
+        self.assertTrue(usdex.core.bindMaterial(spheres[0], visual))
+
+        # The result matches binding each prim individually, and does not affect the visual bindings
+        self.assertTrue(usdex.core.bindPhysicsMaterials(spheres, [rubber, steel, rubber, steel]))
+        for sphere, material in zip(spheres, [rubber, steel, rubber, steel]):
+            bindingAPI = UsdShade.MaterialBindingAPI(sphere)
+            self.assertEqual(bindingAPI.GetDirectBindingRel("physics").GetTargets(), [material.GetPath()])
+            self.assertEqual(bindingAPI.ComputeBoundMaterial("physics")[0].GetPath(), material.GetPath())
+        self.assertEqual(UsdShade.MaterialBindingAPI(spheres[0]).GetDirectBindingRel().GetTargets(), [visual.GetPath()])
+        self.assertIsValidUsd(stage)
+
+        # The physics bindings of the children are collapsed onto their parent. A visual binding on a child does not prevent the collapse.
+        group = UsdGeom.Xform.Define(stage, f"{defaultPrimPath}/Group").GetPrim()
+        children = [self.createSphere(stage, f"{group.GetPath()}/Sphere{i}", 0.5, Gf.Vec3f(1.0, 0.0, 0.0), Gf.Vec3d(i, 0, 0)) for i in range(2)]
+        self.assertTrue(usdex.core.bindMaterial(children[0], visual))
+        self.assertTrue(usdex.core.bindPhysicsMaterials(children, [steel], collapseToAncestors=True))
+        self.assertEqual(UsdShade.MaterialBindingAPI(group).GetDirectBindingRel("physics").GetTargets(), [steel.GetPath()])
+        self.assertFalse(group.GetRelationship("material:binding"))
+        for child in children:
+            self.assertFalse(child.GetRelationship("material:binding:physics"))
+            self.assertEqual(UsdShade.MaterialBindingAPI(child).ComputeBoundMaterial("physics")[0].GetPath(), steel.GetPath())
+        self.assertIsValidUsd(stage)
+
+        # Nothing is authored if any prim or material is invalid
+        invalidMaterial = UsdShade.Material(stage.GetPrimAtPath(f"{defaultPrimPath}/Invalid"))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*material.*is not valid")]):
+            self.assertFalse(usdex.core.bindPhysicsMaterials(spheres[:2], [rubber, invalidMaterial]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.core.bindPhysicsMaterials([spheres[0], Usd.Prim()], [rubber]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*number of materials")]):
+            self.assertFalse(usdex.core.bindPhysicsMaterials(spheres, [rubber, steel]))
+        self.assertEqual(UsdShade.MaterialBindingAPI(spheres[1]).GetDirectBindingRel("physics").GetTargets(), [steel.GetPath()])
@@ -1,4 +1,4 @@
-# SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 #
 
@@ -46,8 +46,8 @@ class DefinePointCloudTestCase(DefinePointBasedTestCaseMixin, usdex.test.DefineF
         # Assert that all required topology attributes are authored
         self.assertTrue(result.GetPointsAttr().IsAuthored())
 
-        # Assert that a correct extent has been authored
-        extent = UsdGeom.Boundable.ComputeExtentFromPlugins(result, Usd.TimeCode.Default())
+        # Assert that a correct extent has been authored, including the widths
+        extent = self.computeExpectedExtent(result)
         extentAttr = result.GetExtentAttr()
         self.assertTrue(extentAttr.IsAuthored())
         self.assertEqual(extentAttr.Get(), extent)
@@ -518,3 +518,296 @@ class PointsAlgoPrimOverloadTest(usdex.test.TestCase):
             points = usdex.core.definePointCloud(xformPrim, POINTS)
         self.assertTrue(points)
         self.assertEqual(points.GetPrim().GetTypeName(), "Points")
+
+
+class PointCloudWriterTestCase(usdex.test.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.stage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(self.stage, "/World")
+        self.pointCloud = usdex.core.definePointCloud(self.stage, Sdf.Path("/World/Points"), POINTS)
+
+    def testWriteFrames(self):
+        writer = usdex.core.PointCloudWriter(self.pointCloud)
+        self.assertTrue(writer.isValid())
+        self.assertEqual(writer.getFrameCount(), 0)
+
+        # The number of points may change between frames
+        frames = [Vt.Vec3fArray([Gf.Vec3f(i, j, 0) for j in range(count)]) for i, count in enumerate((4, 6, 3))]
+        for i, points in enumerate(frames):
+            widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([0.5] * len(points)))
+            displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]), Vt.IntArray([0]))
+            ids = Vt.Int64Array(range(len(points)))
+            with usdex.test.ScopedDiagnosticChecker(self, []):
+                self.assertTrue(writer.writeFrame(Usd.TimeCode(i), points, ids=ids, widths=widths, displayColor=displayColor))
+        self.assertEqual(writer.getFrameCount(), len(frames))
+
+        primvarsAPI = UsdGeom.PrimvarsAPI(self.pointCloud)
+        widthsPrimvar = primvarsAPI.GetPrimvar(UsdGeom.Tokens.widths)
+        displayColorPrimvar = self.pointCloud.GetDisplayColorPrimvar()
+        self.assertEqual(widthsPrimvar.GetInterpolation(), UsdGeom.Tokens.vertex)
+        self.assertEqual(displayColorPrimvar.GetInterpolation(), UsdGeom.Tokens.constant)
+        self.assertEqual(self.pointCloud.GetPointsAttr().GetTimeSamples(), [0.0, 1.0, 2.0])
+        for i, points in enumerate(frames):
+            self.assertEqual(self.pointCloud.GetPointsAttr().Get(i), points)
+            self.assertEqual(self.pointCloud.GetIdsAttr().Get(i), Vt.Int64Array(range(len(points))))
+            self.assertEqual(widthsPrimvar.Get(i), Vt.FloatArray([0.5] * len(points)))
+            self.assertEqual(displayColorPrimvar.GetIndices(i), Vt.IntArray([0]))
+            # The extent is padded by half of the widths
+            extent = self.pointCloud.GetExtentAttr().Get(i)
+            self.assertEqual(extent, Vt.Vec3fArray([Gf.Vec3f(i - 0.25, -0.25, -0.25), Gf.Vec3f(i + 0.25, len(points) - 0.75, 0.25)]))
+
+        # The default values authored by definePointCloud are retained
+        self.assertEqual(self.pointCloud.GetPointsAttr().Get(Usd.TimeCode.Default()), POINTS)
+        self.assertIsValidUsd(self.stage)
+
+    def testLayerOffset(self):
+        # Frames are written to the edit target, accounting for its time offset
+        sublayer = Sdf.Layer.CreateAnonymous()
+        self.stage.GetRootLayer().subLayerPaths.append(sublayer.identifier)
+        self.stage.GetRootLayer().subLayerOffsets[0] = Sdf.LayerOffset(offset=10)
+        self.stage.SetEditTarget(self.stage.GetEditTargetForLocalLayer(sublayer))
+
+        writer = usdex.core.PointCloudWriter(self.pointCloud)
+        for i in range(3):
+            self.assertTrue(writer.writeFrame(Usd.TimeCode(10 + i), POINTS))
+        self.assertEqual(sublayer.ListTimeSamplesForPath(self.pointCloud.GetPointsAttr().GetPath()), [0.0, 1.0, 2.0])
+        self.assertEqual(self.pointCloud.GetPointsAttr().GetTimeSamples(), [10.0, 11.0, 12.0])
+
+    def testInvalidFrames(self):
+        writer = usdex.core.PointCloudWriter(self.pointCloud)
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*increasing numeric time codes")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode.Default(), POINTS))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), Vt.Vec3fArray()))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid ids")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), POINTS, ids=Vt.Int64Array([0])))
+
+        self.assertTrue(writer.writeFrame(Usd.TimeCode(0), POINTS, widths=widths))
+
+        # Frames must be written in order
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*increasing numeric time codes")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), POINTS, widths=widths))
+
+        # The set of values is fixed by the first frame
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid widths.*all frames or none")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(1), POINTS))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid ids.*all frames or none")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(1), POINTS, ids=IDS, widths=widths))
+
+        # The interpolation is fixed by the first frame
+        vertexWidths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0] * len(POINTS)))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid widths.*must not change")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(1), POINTS, widths=vertexWidths))
+
+        # Failed frames do not affect the written frames
+        self.assertEqual(writer.getFrameCount(), 1)
+        self.assertEqual(self.pointCloud.GetPointsAttr().GetTimeSamples(), [0.0])
+        self.assertTrue(writer.writeFrame(Usd.TimeCode(1), POINTS, widths=widths))
+        self.assertEqual(writer.getFrameCount(), 2)
+
+    def testInvalidPrim(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdGeomPoints")]):
+            writer = usdex.core.PointCloudWriter(UsdGeom.Points())
+        self.assertFalse(writer.isValid())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid prim or edit target")]):
+            self.assertFalse(writer.writeFrame(Usd.TimeCode(0), POINTS))
+
+
+class PointCloudQuantizationTestCase(usdex.test.TestCase):
+
+    def testQuantizedPointCloud(self):
+        stage = Usd.Stage.CreateInMemory()
+        UsdGeom.Xform.Define(stage, "/World")
+
+        # A scan far from the origin, with nearly equal colors which are merged by the quantization
+        points = Vt.Vec3fArray([Gf.Vec3f(1000.0 + i * 0.37, 2000.0 - i * 0.11, i * 0.05) for i in range(100)])
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([0.01 * (i + 1) for i in range(100)]))
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0.5 + 1e-6 * i, 0.25, 0.0) for i in range(100)]))
+        quantization = usdex.core.PointCloudQuantization()
+        self.assertEqual(quantization.positionBits, 16)
+        self.assertEqual(quantization.precision, 11)
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            pointCloud = usdex.core.definePointCloud(
+                stage, Sdf.Path("/World/Scan"), points, quantization, widths=widths, displayColor=displayColor
+            )
+        self.assertTrue(pointCloud)
+
+        # The points are authored relative to the center of their bounds, which is restored by a double precision translation
+        self.assertEqual(pointCloud.GetXformOpOrderAttr().Get(), Vt.TokenArray(["xformOp:translate:dequantize"]))
+        translateOp = pointCloud.GetOrderedXformOps()[0]
+        self.assertEqual(translateOp.GetPrecision(), UsdGeom.XformOp.PrecisionDouble)
+        self.assertTrue(Gf.IsClose(translateOp.Get(), (Gf.Vec3d(points[0]) + Gf.Vec3d(points[-1])) * 0.5, 1e-3))
+        self.assertEqual(len(pointCloud.GetDisplayColorPrimvar().Get()), 1)
+        self.assertTrue(pointCloud.GetDisplayColorPrimvar().IsIndexed())
+
+        # The round trip error is bounded by the quantization
+        report = usdex.core.computePointCloudQuantizationReport(pointCloud, points, widths=widths, displayColor=displayColor)
+        self.assertLess(report.maxPointError, (0.37 * 99) / (2**16 - 1))
+        self.assertLess(report.maxWidthError, 2**-10)
+        self.assertLess(report.maxDisplayColorError, 2**-10)
+        self.assertEqual(report.maxNormalError, 0.0)
+        self.assertEqual(report.maxDisplayOpacityError, 0.0)
+        self.assertIsValidUsd(stage)
+
+        # Quantization may be disabled for the points and the primvars
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            pointCloud = usdex.core.definePointCloud(
+                stage, Sdf.Path("/World/Exact"), points, usdex.core.PointCloudQuantization(0, 0), widths=widths, displayColor=displayColor
+            )
+        self.assertEqual(pointCloud.GetPointsAttr().Get(), points)
+        self.assertFalse(pointCloud.GetXformOpOrderAttr().HasAuthoredValue())
+        self.assertEqual(len(pointCloud.GetDisplayColorPrimvar().Get()), 100)
+        report = usdex.core.computePointCloudQuantizationReport(pointCloud, points, widths=widths, displayColor=displayColor)
+        self.assertEqual((report.maxPointError, report.maxWidthError, report.maxDisplayColorError), (0.0, 0.0, 0.0))
+
+    def testQuantizedExistingTransform(self):
+        stage = Usd.Stage.CreateInMemory()
+        points = Vt.Vec3fArray([Gf.Vec3f(100.0 + i, 0.0, 0.0) for i in range(10)])
+        prim = usdex.core.defineXform(stage, Sdf.Path("/Scan")).GetPrim()
+        usdex.core.setLocalTransform(prim, Gf.Transform(Gf.Matrix4d().SetTranslate(Gf.Vec3d(0, 5, 0))))
+        existing = UsdGeom.Xformable(prim).GetXformOpOrderAttr().Get()
+
+        # The dequantizing translation is composed with the existing local transform, and is replaced when the points are re-defined
+        for bulk in (False, True):
+            with usdex.test.ScopedDiagnosticChecker(self, []):
+                if bulk:
+                    with usdex.core.BulkAuthoringScope(stage):
+                        pointCloud = usdex.core.definePointCloud(stage, prim.GetPath(), points, usdex.core.PointCloudQuantization())
+                else:
+                    pointCloud = usdex.core.definePointCloud(stage, prim.GetPath(), points, usdex.core.PointCloudQuantization())
+            self.assertEqual(list(pointCloud.GetXformOpOrderAttr().Get()), list(existing) + ["xformOp:translate:dequantize"])
+            transform = pointCloud.GetLocalTransformation(Usd.TimeCode.Default())
+            for authored, point in zip(pointCloud.GetPointsAttr().Get(), points):
+                self.assertTrue(Gf.IsClose(transform.Transform(Gf.Vec3d(authored)), Gf.Vec3d(point) + Gf.Vec3d(0, 5, 0), 1e-3))
+            report = usdex.core.computePointCloudQuantizationReport(pointCloud, points)
+            self.assertLess(report.maxPointError, 1e-3)
+
+        # Authoring the points without quantization removes the dequantizing translation
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            pointCloud = usdex.core.definePointCloud(stage, prim.GetPath(), points, usdex.core.PointCloudQuantization(0, 0))
+        self.assertEqual(pointCloud.GetXformOpOrderAttr().Get(), existing)
+        self.assertIsValidUsd(stage)
+
+    def testQuantizedTiles(self):
+        stage = Usd.Stage.CreateInMemory()
+        world = UsdGeom.Xform.Define(stage, "/World").GetPrim()
+        points = Vt.Vec3fArray([Gf.Vec3f(x * 0.5, 0.0, z * 0.5) for z in range(4) for x in range(4)])
+
+        # Each tile is quantized relative to its own bounds
+        tiling = usdex.core.PointCloudTiling()
+        tiling.tileSize = 1.0
+        tiling.quantization = usdex.core.PointCloudQuantization()
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            tiles = usdex.core.definePointCloudTiles(world, "Scan", points, tiling)
+        self.assertEqual(len(tiles), 4)
+        for tile in tiles:
+            pointCloud = UsdGeom.Points(tile)
+            translation = pointCloud.GetOrderedXformOps()[0].Get()
+            for point in pointCloud.GetPointsAttr().Get():
+                self.assertIn(Gf.Vec3f(point + Gf.Vec3f(translation)), points)
+        self.assertIsValidUsd(stage)
+
+    def testInvalidReport(self):
+        stage = Usd.Stage.CreateInMemory()
+        pointCloud = usdex.core.definePointCloud(stage, Sdf.Path("/Points"), POINTS)
+
+        # Values which are missing or do not match the source values have an infinite error
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0]))
+        report = usdex.core.computePointCloudQuantizationReport(pointCloud, Vt.Vec3fArray(POINTS[:2]), widths=widths)
+        self.assertEqual(report.maxPointError, float("inf"))
+        self.assertEqual(report.maxWidthError, float("inf"))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdGeomPoints")]):
+            report = usdex.core.computePointCloudQuantizationReport(UsdGeom.Points(), POINTS)
+        self.assertEqual(report.maxPointError, float("inf"))
+
+
+class PointCloudTilesTestCase(usdex.test.TestCase):
+
+    def createTilePoints(self):
+        # A 4x4 grid of points in the XZ plane, which is split into 2x2 tiles of unit size
+        return Vt.Vec3fArray([Gf.Vec3f(x * 0.5, 0.0, z * 0.5) for z in range(4) for x in range(4)])
+
+    def testDefinePointCloudTiles(self):
+        stage = Usd.Stage.CreateInMemory()
+        world = UsdGeom.Xform.Define(stage, "/World").GetPrim()
+        points = self.createTilePoints()
+        ids = Vt.Int64Array(range(len(points)))
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([0.1 * i for i in range(len(points))]))
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]))
+
+        tiling = usdex.core.PointCloudTiling()
+        tiling.tileSize = 1.0
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            tiles = usdex.core.definePointCloudTiles(world, "Scan", points, tiling, ids=ids, widths=widths, displayColor=displayColor)
+        self.assertEqual([tile.GetPath() for tile in tiles], [Sdf.Path(f"/World/Scan/Tile_{i}") for i in range(4)])
+        self.assertTrue(stage.GetPrimAtPath("/World/Scan").IsA(UsdGeom.Xform))
+
+        # Every point is in exactly one tile, with its own values, and each tile has a tight extent
+        allIds = []
+        for tile in tiles:
+            pointCloud = UsdGeom.Points(tile)
+            self.assertTrue(pointCloud)
+            tilePoints = pointCloud.GetPointsAttr().Get()
+            tileIds = pointCloud.GetIdsAttr().Get()
+            self.assertEqual(len(tilePoints), 4)
+            for point, pointId in zip(tilePoints, tileIds):
+                self.assertEqual(point, points[pointId])
+            tileWidths = UsdGeom.PrimvarsAPI(tile).GetPrimvar(UsdGeom.Tokens.widths).Get()
+            self.assertEqual(list(tileWidths), [widths.values()[i] for i in tileIds])
+            self.assertEqual(pointCloud.GetDisplayColorPrimvar().Get(), Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]))
+            tileExtent = usdex.core.computePointsExtent(tilePoints, usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, tileWidths))
+            self.assertEqual(pointCloud.GetExtentAttr().Get(), tileExtent)
+            allIds.extend(tileIds)
+        self.assertEqual(sorted(allIds), list(range(len(points))))
+        self.assertIsValidUsd(stage)
+
+        # A single tile is defined when the target number of points exceeds the number of points
+        tiles = usdex.core.definePointCloudTiles(world, "Single", points)
+        self.assertEqual(len(tiles), 1)
+        self.assertEqual(UsdGeom.Points(tiles[0]).GetPointsAttr().Get(), points)
+
+    def testPayloads(self):
+        stage = Usd.Stage.Open(self.tmpLayer(name="Scan"))
+        world = UsdGeom.Xform.Define(stage, "/World").GetPrim()
+        stage.SetDefaultPrim(world)
+
+        tiling = usdex.core.PointCloudTiling()
+        tiling.tileSize = 1.0
+        tiling.usePayloads = True
+        tiling.payloadFormat = "usda"
+        with usdex.test.ScopedDiagnosticChecker(self, []):
+            tiles = usdex.core.definePointCloudTiles(world, "Scan", self.createTilePoints(), tiling)
+        self.assertEqual(len(tiles), 4)
+        for tile in tiles:
+            self.assertTrue(tile.HasPayload())
+            self.assertTrue(UsdGeom.Points(tile))
+            self.assertEqual(len(UsdGeom.ModelAPI(tile).GetExtentsHintAttr().Get()), 2)
+
+        # Unloading the tiles retains their bounds
+        stage.Unload("/World/Scan")
+        for tile in tiles:
+            self.assertFalse(tile.IsLoaded())
+            self.assertEqual(len(UsdGeom.ModelAPI(tile).GetExtentsHintAttr().Get()), 2)
+
+    def testInvalid(self):
+        stage = Usd.Stage.CreateInMemory()
+        world = UsdGeom.Xform.Define(stage, "/World").GetPrim()
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points")]):
+            self.assertEqual(usdex.core.definePointCloudTiles(world, "Empty", Vt.Vec3fArray()), [])
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid values")]):
+            self.assertEqual(usdex.core.definePointCloudTiles(world, "Ids", POINTS, ids=Vt.Int64Array([0])), [])
+
+        tiling = usdex.core.PointCloudTiling()
+        tiling.usePayloads = True
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*anonymous edit target layer")]):
+            self.assertEqual(usdex.core.definePointCloudTiles(world, "Payloads", POINTS, tiling), [])
+        self.assertFalse(stage.GetPrimAtPath("/World/Payloads"))
@@ -2,11 +2,17 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import unittest
 from typing import Tuple
 
 import usdex.core
 import usdex.test
-from pxr import Gf, Sdf, Tf, Usd, UsdGeom, Vt
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, Vt, Work
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
 
 POINTS = Vt.Vec3fArray(
     [
@@ -97,6 +103,34 @@ class PrimvarDataTestCase(usdex.test.TestCase):
         data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values, Vt.IntArray([0, -1, 2]))
         self.assertFalse(data.isValid())
 
+        # valid data remains valid when checked repeatedly
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values, indices)
+        self.assertTrue(data.isValid())
+        self.assertTrue(data.isValid())
+
+    def testIndicesLargeArrays(self):
+        # Large index arrays are checked across threads, and an out of range index is found regardless of its position
+        values = Vt.FloatArray([-1.0, -0.5, 1.5])
+        count = 200000
+        for position in (0, count // 2, count - 1):
+            for invalid in (-1, 3):
+                indices = Vt.IntArray([i % 3 for i in range(count)])
+                indices[position] = invalid
+                data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values, indices)
+                self.assertFalse(data.isValid())
+
+        limit = Work.GetConcurrencyLimit()
+        try:
+            Work.SetConcurrencyLimit(1)
+            serial = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values, Vt.IntArray([i % 3 for i in range(count)]))
+            self.assertTrue(serial.isValid())
+
+            Work.SetMaximumConcurrencyLimit()
+            parallel = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values, Vt.IntArray([i % 3 for i in range(count)]))
+            self.assertTrue(parallel.isValid())
+        finally:
+            Work.SetConcurrencyLimit(limit)
+
     def testElementSize(self):
         values = Vt.FloatArray([-1.0, -0.5, 1.5])
         indices = Vt.IntArray([0, 1, 2])
@@ -172,6 +206,58 @@ class PrimvarDataTestCase(usdex.test.TestCase):
         differentElementSize = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values, indices, elementSize=3)
         self.assertNotEqual(original, differentElementSize)
 
+    def testHash(self):
+        values = Vt.FloatArray([-1.0, 0.0, 1.5])
+        indices = Vt.IntArray([0, 1, 2])
+        a = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values, indices)
+        b = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([-1.0, -0.0, 1.5]), Vt.IntArray([0, 1, 2]))
+        self.assertEqual(a.hash(), b.hash())
+        self.assertEqual(hash(a), hash(b))
+        self.assertEqual(a, b)
+
+        different = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([-1.0, 0.5, 1.5]), indices)
+        self.assertNotEqual(a.hash(), different.hash())
+        self.assertNotEqual(a, different)
+
+        # PrimvarData can be used as a key in containers
+        unique = {a, b, different}
+        self.assertEqual(len(unique), 2)
+        self.assertIn(usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values, indices), unique)
+
+        # Re-indexing invalidates the hash
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0, 1.0, 2.0]))
+        original = data.hash()
+        self.assertTrue(data.index())
+        self.assertNotEqual(data.hash(), original)
+        self.assertEqual(data.hash(), usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0, 2.0]), Vt.IntArray([0, 0, 1])).hash())
+
+    def testCompactIndices(self):
+        values = Vt.FloatArray([-1.0, 0.5, 1.5])
+        indices = Vt.IntArray([0, 1, 2, 2, 1, 0])
+        original = usdex.core.FloatPrimvarData(UsdGeom.Tokens.faceVarying, values, indices)
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.faceVarying, values, indices)
+        self.assertFalse(data.hasCompactIndices())
+        self.assertTrue(data.compactIndices())
+        self.assertTrue(data.hasCompactIndices())
+        self.assertTrue(data.hasIndices())
+        self.assertTrue(data.isValid())
+        self.assertEqual(data.effectiveSize(), 6)
+        self.assertEqual(data, original)
+        self.assertEqual(data.hash(), original.hash())
+        self.assertEqual(data.indices(), indices)
+        self.assertFalse(data.compactIndices())
+
+        # Non-indexed data has nothing to compact
+        self.assertFalse(usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values).compactIndices())
+
+        # Compact indices are widened when authoring
+        stage = Usd.Stage.CreateInMemory()
+        scope = UsdGeom.Scope.Define(stage, Sdf.Path("/Prim"))
+        primvar = UsdGeom.PrimvarsAPI(scope.GetPrim()).CreatePrimvar("test", Sdf.ValueTypeNames.FloatArray)
+        self.assertTrue(data.setPrimvar(primvar))
+        self.assertEqual(primvar.GetIndices(), indices)
+        self.assertEqual(usdex.core.FloatPrimvarData.getPrimvarData(primvar), original)
+
     def testGetPrimvarData(self):
         stage = Usd.Stage.CreateInMemory()
         path = Sdf.Path("/Prim")
@@ -239,6 +325,130 @@ class PrimvarDataTestCase(usdex.test.TestCase):
         usdex.core.configureStage(stage, "Prim", self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
         self.assertIsValidUsd(stage)
 
+    def testGetPrimvarDataBatch(self):
+        stage = Usd.Stage.CreateInMemory()
+        scope = UsdGeom.Scope.Define(stage, "/Prim")
+        primvarsApi = UsdGeom.PrimvarsAPI(scope.GetPrim())
+        widths = primvarsApi.CreatePrimvar("widths", Sdf.ValueTypeNames.FloatArray, UsdGeom.Tokens.vertex)
+        widths.Set(Vt.FloatArray([0.5, 1.0]))
+        widths.SetIndices(Vt.IntArray([1, 0, 1]))
+        scales = primvarsApi.CreatePrimvar("scales", Sdf.ValueTypeNames.FloatArray, UsdGeom.Tokens.uniform)
+        scales.Set(Vt.FloatArray([2.0, 3.0, 4.0, 5.0]))
+        scales.SetElementSize(2)
+        primvarsApi.CreatePrimvar("ids", Sdf.ValueTypeNames.IntArray, UsdGeom.Tokens.vertex).Set(Vt.IntArray([1, 2, 3]))
+
+        # The batch is equivalent to reading each primvar separately
+        primvars = [widths, scales, UsdGeom.Primvar()]
+        data = usdex.core.FloatPrimvarData.getPrimvarData(primvars)
+        self.assertEqual(len(data), 3)
+        for primvar, result in zip(primvars, data):
+            self.assertEqual(result, usdex.core.FloatPrimvarData.getPrimvarData(primvar))
+        self.assertTrue(data[0].isValid())
+        self.assertTrue(data[0].hasIndices())
+        self.assertEqual(data[1].elementSize(), 2)
+        self.assertFalse(data[2].isValid())
+
+        # All primvars of the matching type are read from the prim, keyed by name
+        data = usdex.core.FloatPrimvarData.getPrimvarData(scope.GetPrim())
+        self.assertEqual(sorted(data.keys()), ["scales", "widths"])
+        self.assertEqual(data["widths"], usdex.core.FloatPrimvarData.getPrimvarData(widths))
+        self.assertEqual(data["scales"], usdex.core.FloatPrimvarData.getPrimvarData(scales))
+        self.assertEqual(list(usdex.core.IntPrimvarData.getPrimvarData(scope.GetPrim()).keys()), ["ids"])
+
+        # The names filter the primvars
+        data = usdex.core.FloatPrimvarData.getPrimvarData(scope.GetPrim(), ["widths", "ids", "missing"])
+        self.assertEqual(list(data.keys()), ["widths"])
+        self.assertEqual(usdex.core.FloatPrimvarData.getPrimvarData(Usd.Prim()), {})
+
+    def testSetPrimvarsBatch(self):
+        stage = Usd.Stage.CreateInMemory()
+        scope = UsdGeom.Scope.Define(stage, "/Prim")
+        primvarsApi = UsdGeom.PrimvarsAPI(scope.GetPrim())
+        primvars = [primvarsApi.CreatePrimvar(f"test{i}", Sdf.ValueTypeNames.FloatArray, UsdGeom.Tokens.vertex) for i in range(3)]
+        primvars[2].SetIndices(Vt.IntArray([0, 0]))
+        primvars[2].SetElementSize(3)
+        data = [
+            usdex.core.FloatPrimvarData(UsdGeom.Tokens.uniform, Vt.FloatArray([-1.0, -0.5, 1.5]), Vt.IntArray([0, 1, 2]), elementSize=3),
+            usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0, 2.0])),
+            usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([4.0])),
+        ]
+
+        # The authored primvars round trip, as they would if authored individually
+        for time in (Usd.TimeCode.Default(), 0, 2.5):
+            self.assertTrue(usdex.core.FloatPrimvarData.setPrimvars(primvars, data, time))
+            for primvar, item in zip(primvars[:2], data[:2]):
+                self.assertEqual(usdex.core.FloatPrimvarData.getPrimvarData(primvar, time), item)
+
+            # Previously authored indices are blocked and the element size is reset
+            self.assertEqual(primvars[2].GetInterpolation(), UsdGeom.Tokens.constant)
+            self.assertEqual(primvars[2].Get(time), Vt.FloatArray([4.0]))
+            self.assertFalse(primvars[2].IsIndexed())
+            self.assertEqual(primvars[2].GetElementSize(), 1)
+
+        usdex.core.configureStage(stage, "Prim", self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        self.assertIsValidUsd(stage)
+
+    def testSetPrimvarsBatchEditTarget(self):
+        # Primvars are authored to the edit target, accounting for its time offset
+        stage = Usd.Stage.CreateInMemory()
+        primvar = UsdGeom.PrimvarsAPI(UsdGeom.Scope.Define(stage, "/Prim").GetPrim()).CreatePrimvar("test", Sdf.ValueTypeNames.FloatArray)
+        sublayer = Sdf.Layer.CreateAnonymous()
+        stage.GetRootLayer().subLayerPaths.append(sublayer.identifier)
+        stage.GetRootLayer().subLayerOffsets[0] = Sdf.LayerOffset(offset=10)
+        stage.SetEditTarget(stage.GetEditTargetForLocalLayer(sublayer))
+
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0]), Vt.IntArray([0, 0]))
+        self.assertTrue(usdex.core.FloatPrimvarData.setPrimvars([primvar], [data], 10))
+        self.assertEqual(sublayer.ListTimeSamplesForPath(primvar.GetAttr().GetPath()), [0.0])
+        self.assertEqual(sublayer.GetAttributeAtPath(primvar.GetAttr().GetPath()).GetInfo(UsdGeom.Tokens.interpolation), UsdGeom.Tokens.vertex)
+        self.assertEqual(usdex.core.FloatPrimvarData.getPrimvarData(primvar, 10), data)
+
+    def testSetPrimvarsBatchInvalid(self):
+        stage = Usd.Stage.CreateInMemory()
+        primvarsApi = UsdGeom.PrimvarsAPI(UsdGeom.Scope.Define(stage, "/Prim").GetPrim())
+        primvar = primvarsApi.CreatePrimvar("test", Sdf.ValueTypeNames.FloatArray)
+        other = primvarsApi.CreatePrimvar("other", Sdf.ValueTypeNames.IntArray)
+        valid = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0]))
+        layer = stage.GetRootLayer().ExportToString()
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched number of values: 2 for 1 primvars")]):
+            self.assertFalse(usdex.core.FloatPrimvarData.setPrimvars([primvar], [valid, valid]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid UsdGeomPrimvar at index 1")]):
+            self.assertFalse(usdex.core.FloatPrimvarData.setPrimvars([primvar, UsdGeom.Primvar()], [valid, valid]))
+
+        invalid = usdex.core.FloatPrimvarData("cubic", Vt.FloatArray([1.0]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_CODING_ERROR_TYPE, '.*invalid interpolation "cubic"')]):
+            self.assertFalse(usdex.core.FloatPrimvarData.setPrimvars([primvar, primvar], [valid, invalid]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_CODING_ERROR_TYPE, ".*mismatched value type.*")]):
+            self.assertFalse(usdex.core.FloatPrimvarData.setPrimvars([primvar, other], [valid, valid]))
+
+        # The indices of every primvar are validated before any values are written
+        outOfRange = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0]), Vt.IntArray([0, 1]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*indices outside the range of its 1 values")]):
+            self.assertFalse(usdex.core.FloatPrimvarData.setPrimvars([primvar, primvar], [valid, outOfRange]))
+
+        # No primvar was authored
+        self.assertEqual(stage.GetRootLayer().ExportToString(), layer)
+
+    def testSetPrimvarsBatchVariability(self):
+        # Specs created on the edit target match the variability of the existing primvar
+        stage = Usd.Stage.CreateInMemory()
+        sublayer = Sdf.Layer.CreateAnonymous()
+        stage.GetRootLayer().subLayerPaths.append(sublayer.identifier)
+        stage.SetEditTarget(Usd.EditTarget(sublayer))
+        primvarsApi = UsdGeom.PrimvarsAPI(UsdGeom.Scope.Define(stage, "/Prim").GetPrim())
+        primvar = primvarsApi.CreatePrimvar("test", Sdf.ValueTypeNames.FloatArray)
+        self.assertTrue(primvar.GetAttr().SetVariability(Sdf.VariabilityUniform))
+        stage.SetEditTarget(Usd.EditTarget(stage.GetRootLayer()))
+
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0]), Vt.IntArray([0]))
+        self.assertTrue(usdex.core.FloatPrimvarData.setPrimvars([primvar], [data]))
+        attrSpec = stage.GetRootLayer().GetAttributeAtPath(primvar.GetAttr().GetPath())
+        self.assertEqual(attrSpec.variability, Sdf.VariabilityUniform)
+        self.assertEqual(usdex.core.FloatPrimvarData.getPrimvarData(primvar), data)
+
     def testStr(self):
         values = Vt.FloatArray([-1.0, -0.5, 1.5])
         indices = Vt.IntArray([0, 1, 2])
@@ -332,3 +542,260 @@ class PrimvarDataTestCase(usdex.test.TestCase):
         self.assertTrue(data.hasIndices())
         self.assertEqual(data.values(), Vt.FloatArray([0.0, 1.0]))
         self.assertEqual(data.indices(), Vt.IntArray([0, 0, 1, 1, 2, 2]))
+
+    def testIndexLargeArrays(self):
+        # Large arrays are sharded across threads, but the result must match single threaded indexing exactly
+        colors = [Gf.Vec3f(i % 7, (i * 3) % 11, (i * 5) % 13) for i in range(200000)]
+
+        limit = Work.GetConcurrencyLimit()
+        try:
+            Work.SetConcurrencyLimit(1)
+            serial = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray(colors))
+            self.assertTrue(serial.index())
+
+            Work.SetMaximumConcurrencyLimit()
+            parallel = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray(colors))
+            self.assertTrue(parallel.index())
+        finally:
+            Work.SetConcurrencyLimit(limit)
+
+        self.assertEqual(serial, parallel)
+        self.assertEqual(len(serial.values()), len(set((c[0], c[1], c[2]) for c in colors)))
+
+        # Values are kept in order of first occurrence
+        self.assertEqual(serial.values()[0], colors[0])
+        self.assertEqual(serial.values()[1], colors[1])
+        self.assertEqual(serial.indices()[7 * 11 * 13], serial.indices()[0])
+
+        # The flattened values are unchanged
+        self.assertEqual([serial.values()[i] for i in serial.indices()], colors)
+
+    def testIndexNaN(self):
+        # Bitwise identical NaN values are deduplicated even though they do not compare equal
+        nan = float("nan")
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([nan, 1.0, nan, 1.0]))
+        self.assertTrue(data.index())
+        self.assertEqual(len(data.values()), 2)
+        self.assertEqual(data.indices(), Vt.IntArray([0, 1, 0, 1]))
+
+    def testIndexTolerance(self):
+        # Values within the same quantization cell are merged, keeping the first occurrence verbatim
+        values = Vt.Vec2fArray([Gf.Vec2f(0.0, 0.0), Gf.Vec2f(0.0001, -0.0001), Gf.Vec2f(1.0, 1.0), Gf.Vec2f(0.9999, 1.0001)])
+        data = usdex.core.Vec2fPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertTrue(data.index(0.001))
+        self.assertEqual(data.values(), Vt.Vec2fArray([Gf.Vec2f(0.0, 0.0), Gf.Vec2f(1.0, 1.0)]))
+        self.assertEqual(data.indices(), Vt.IntArray([0, 0, 1, 1]))
+
+        # Values in different cells are not merged
+        values = Vt.FloatArray([0.0, 0.5, 1.0])
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values)
+        self.assertFalse(data.index(0.1))
+        self.assertFalse(data.hasIndices())
+
+        # A zero tolerance is exact indexing
+        values = Vt.Vec3fArray([Gf.Vec3f(0.0, 0.0, 0.0), Gf.Vec3f(0.0, 0.0, 0.0001), Gf.Vec3f(0.0, 0.0, 0.0)])
+        data = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, values)
+        self.assertTrue(data.index(0.0))
+        self.assertEqual(data.indices(), Vt.IntArray([0, 1, 0]))
+
+        # Negative tolerances are rejected
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([0.0, 0.0]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*negative tolerance")]):
+            self.assertFalse(data.index(-1.0))
+        self.assertFalse(data.hasIndices())
+
+        # Non floating point types cannot be indexed with a tolerance
+        data = usdex.core.IntPrimvarData(UsdGeom.Tokens.vertex, Vt.IntArray([0, 0]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*not floating point")]):
+            self.assertFalse(data.index(1.0))
+        self.assertFalse(data.hasIndices())
+
+    def testIndexWithPrecision(self):
+        # Values which round to the same significant bits are merged, keeping the first occurrence verbatim
+        values = Vt.FloatArray([1.0, 1.0000001, 0.5, 0.500001, 1000.0, 1000.001, 1000.1, -1.0, -1.0000001])
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values)
+        self.assertTrue(data.indexWithPrecision(16))
+        self.assertEqual(data.values(), Vt.FloatArray([1.0, 0.5, 1000.0, 1000.1, -1.0]))
+        self.assertEqual(data.indices(), Vt.IntArray([0, 0, 1, 1, 2, 2, 3, 4, 4]))
+
+        # Rounding up to the next power of two is identified with that power of two
+        data = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0), Gf.Vec3f(0.0, 0.99999994, 0.0)]))
+        self.assertTrue(data.indexWithPrecision(16))
+        self.assertEqual(data.values(), Vt.Vec3fArray([Gf.Vec3f(0.0, 1.0, 0.0)]))
+        self.assertEqual(data.indices(), Vt.IntArray([0, 0]))
+
+        # The full precision of the value type is exact indexing
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0, 1.0000001]))
+        self.assertFalse(data.indexWithPrecision(24))
+        self.assertFalse(data.hasIndices())
+
+        # Precisions of less than one bit are rejected
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*precision of less than one bit")]):
+            self.assertFalse(data.indexWithPrecision(0))
+        self.assertFalse(data.hasIndices())
+
+        # Non floating point types cannot be indexed with a precision
+        data = usdex.core.IntPrimvarData(UsdGeom.Tokens.vertex, Vt.IntArray([0, 0]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*not floating point")]):
+            self.assertFalse(data.indexWithPrecision(8))
+        self.assertFalse(data.hasIndices())
+
+    def testDemoteToConstant(self):
+        # Identical elements are demoted to a single constant element, and indexed data is flattened
+        red = Gf.Vec3f(1.0, 0.0, 0.0)
+        for interpolation in (UsdGeom.Tokens.vertex, UsdGeom.Tokens.uniform, UsdGeom.Tokens.faceVarying):
+            data = usdex.core.Vec3fPrimvarData(interpolation, Vt.Vec3fArray([red] * 4))
+            self.assertTrue(data.demoteToConstant())
+            self.assertEqual(data, usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([red])))
+        data = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([red, red]), Vt.IntArray([1, 0, 1]))
+        self.assertTrue(data.demoteToConstant())
+        self.assertFalse(data.hasIndices())
+        self.assertEqual(data.values(), Vt.Vec3fArray([red]))
+
+        # The element size is retained
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0, 2.0] * 3), elementSize=2)
+        self.assertTrue(data.demoteToConstant())
+        self.assertEqual(data.values(), Vt.FloatArray([1.0, 2.0]))
+        self.assertEqual(data.elementSize(), 2)
+
+        # Differing elements, NaN values, and constant data are unchanged
+        for data in (
+            usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0, 1.0, 2.0])),
+            usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([float("nan")] * 2)),
+            usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0])),
+        ):
+            interpolation = data.interpolation()
+            self.assertFalse(data.demoteToConstant())
+            self.assertEqual(data.interpolation(), interpolation)
+
+        # Invalid data is not demoted
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([1.0]), Vt.IntArray([0, 1]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*as the data is invalid")]):
+            self.assertFalse(data.demoteToConstant())
+
+    def testDemoteMeshInterpolation(self):
+        # Two quads sharing an edge
+        faceVertexCounts = Vt.IntArray([4, 4])
+        faceVertexIndices = Vt.IntArray([0, 1, 2, 3, 3, 2, 5, 4])
+        pointCount = len(POINTS)
+
+        # Face varying values which match for each point are demoted to vertex
+        vertexValues = Vt.FloatArray([0.0, 1.0, 2.0, 3.0, 4.0, 5.0])
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.faceVarying, Vt.FloatArray([vertexValues[i] for i in faceVertexIndices]))
+        self.assertTrue(data.demoteMeshInterpolation(faceVertexCounts, faceVertexIndices, pointCount))
+        self.assertEqual(data, usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, vertexValues))
+
+        # Face varying values which match for each face are demoted to uniform, retaining the indexing
+        values = Vt.FloatArray([-1.0, 1.0])
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.faceVarying, values, Vt.IntArray([0] * 4 + [1] * 4))
+        self.assertTrue(data.demoteMeshInterpolation(faceVertexCounts, faceVertexIndices, pointCount))
+        self.assertEqual(data, usdex.core.FloatPrimvarData(UsdGeom.Tokens.uniform, values, Vt.IntArray([0, 1])))
+
+        # Values which match everywhere are demoted to constant, from any interpolation
+        for interpolation, count in ((UsdGeom.Tokens.faceVarying, 8), (UsdGeom.Tokens.vertex, 6), (UsdGeom.Tokens.uniform, 2)):
+            data = usdex.core.FloatPrimvarData(interpolation, Vt.FloatArray([1.0] * count))
+            self.assertTrue(data.demoteMeshInterpolation(faceVertexCounts, faceVertexIndices, pointCount))
+            self.assertEqual(data, usdex.core.FloatPrimvarData(UsdGeom.Tokens.constant, Vt.FloatArray([1.0])))
+
+        # Values which differ within a face and at a shared point can not be demoted
+        values = Vt.FloatArray(range(8))
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        self.assertFalse(data.demoteMeshInterpolation(faceVertexCounts, faceVertexIndices, pointCount))
+        self.assertEqual(data, usdex.core.FloatPrimvarData(UsdGeom.Tokens.faceVarying, values))
+
+        # Vertex values can not be demoted to uniform, as each point may belong to many faces
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, vertexValues)
+        self.assertFalse(data.demoteMeshInterpolation(faceVertexCounts, faceVertexIndices, pointCount))
+
+        # The data must match the topology
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.faceVarying, Vt.FloatArray([1.0, 2.0]))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*with 2 elements, as 8 elements are expected")]):
+            self.assertFalse(data.demoteMeshInterpolation(faceVertexCounts, faceVertexIndices, pointCount))
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.faceVarying, values)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid mesh topology")]):
+            self.assertFalse(data.demoteMeshInterpolation(faceVertexCounts, faceVertexIndices, 4))
+        self.assertEqual(data.interpolation(), UsdGeom.Tokens.faceVarying)
+
+        # The demoted data defines an equivalent mesh
+        stage = Usd.Stage.CreateInMemory()
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.faceVarying, Vt.Vec3fArray([Gf.Vec3f(0.5)] * 8))
+        self.assertTrue(displayColor.demoteMeshInterpolation(faceVertexCounts, faceVertexIndices, pointCount))
+        mesh = usdex.core.definePolyMesh(stage, "/Mesh", faceVertexCounts, faceVertexIndices, POINTS, displayColor=displayColor)
+        self.assertEqual(UsdGeom.PrimvarsAPI(mesh).GetPrimvar("displayColor").GetInterpolation(), UsdGeom.Tokens.constant)
+
+    def testDemoteCurvesInterpolation(self):
+        curveVertexCounts = Vt.IntArray([2, 4])
+
+        # Vertex values which match for each curve are demoted to uniform
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([0.5] * 2 + [1.0] * 4))
+        self.assertTrue(data.demoteCurvesInterpolation(curveVertexCounts))
+        self.assertEqual(data, usdex.core.FloatPrimvarData(UsdGeom.Tokens.uniform, Vt.FloatArray([0.5, 1.0])))
+        self.assertFalse(data.demoteCurvesInterpolation(curveVertexCounts))
+
+        # Varying values are only demoted to constant, as their count depends on the basis of the curves
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.varying, Vt.FloatArray([0.5] * 2 + [1.0] * 4))
+        self.assertFalse(data.demoteCurvesInterpolation(curveVertexCounts))
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.varying, Vt.FloatArray([0.5] * 3))
+        self.assertTrue(data.demoteCurvesInterpolation(curveVertexCounts))
+        self.assertEqual(data.interpolation(), UsdGeom.Tokens.constant)
+
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([0.5] * 5))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*with 5 elements, as 6 elements are expected")]):
+            self.assertFalse(data.demoteCurvesInterpolation(curveVertexCounts))
+
+    @unittest.skipIf(numpy is None, "NumPy is not available")
+    def testNumpyValues(self):
+        # Contiguous buffers of the matching scalar type are accepted in place of Vt.Arrays
+        points = numpy.array([[p[0], p[1], p[2]] for p in POINTS], dtype=numpy.float32)
+        pointsData = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, points)
+        self.assertEqual(pointsData.values(), POINTS)
+
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, numpy.array([0.5, 1.5], dtype=numpy.float32))
+        self.assertEqual(data.values(), Vt.FloatArray([0.5, 1.5]))
+
+        data = usdex.core.Vec2fPrimvarData(
+            UsdGeom.Tokens.faceVarying,
+            numpy.array([[0, 0], [1, 1]], dtype=numpy.float32),
+            numpy.array([0, 1, 1, 0], dtype=numpy.int32),
+        )
+        self.assertEqual(data.values(), Vt.Vec2fArray([Gf.Vec2f(0, 0), Gf.Vec2f(1, 1)]))
+        self.assertEqual(data.indices(), Vt.IntArray([0, 1, 1, 0]))
+
+        data = usdex.core.Int64PrimvarData(UsdGeom.Tokens.vertex, numpy.arange(5, dtype=numpy.int64))
+        self.assertEqual(data.values(), Vt.Int64Array([0, 1, 2, 3, 4]))
+
+        # The buffer is copied, so later modifications do not affect the PrimvarData
+        points[0] = [9, 9, 9]
+        self.assertEqual(pointsData.values(), POINTS)
+
+        # Empty buffers are accepted
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, numpy.zeros(0, dtype=numpy.float32))
+        self.assertEqual(len(data.values()), 0)
+        self.assertFalse(data.isValid())
+
+    @unittest.skipIf(numpy is None, "NumPy is not available")
+    def testNumpyViews(self):
+        data = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, POINTS)
+        view = data.valuesView()
+        self.assertEqual(view.shape, (len(POINTS), 3))
+        self.assertEqual(view.dtype, numpy.float32)
+        self.assertEqual(Vt.Vec3fArray([Gf.Vec3f(*x) for x in view.tolist()]), POINTS)
+        self.assertFalse(view.flags.writeable)
+        with self.assertRaises(ValueError):
+            view[0, 0] = 1.0
+
+        # The view references the values without detaching them
+        self.assertTrue(data.isIdentical(usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, POINTS)))
+
+        # The view remains valid after re-indexing
+        values = Vt.FloatArray([1.0, 2.0, 1.0])
+        data = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, values)
+        view = data.valuesView()
+        self.assertTrue(data.index())
+        self.assertEqual(view.tolist(), [1.0, 2.0, 1.0])
+        self.assertEqual(data.valuesView().tolist(), [1.0, 2.0])
+        self.assertEqual(data.indicesView().tolist(), [0, 1, 0])
+        self.assertEqual(data.indicesView().dtype, numpy.int32)
+
+        # Non-numeric types do not provide views
+        self.assertFalse(hasattr(usdex.core.StringPrimvarData, "valuesView"))
@@ -0,0 +1,71 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import usdex.core
+import usdex.test
+from pxr import Gf, UsdGeom, Vt
+
+
+class ScratchArenaTestCase(usdex.test.TestCase):
+
+    def createGrid(self, size):
+        points = Vt.Vec3fArray([Gf.Vec3f(x, y, (x * y) % 3) for y in range(size + 1) for x in range(size + 1)])
+        faceVertexCounts = Vt.IntArray([4] * (size * size))
+        faceVertexIndices = []
+        for y in range(size):
+            for x in range(size):
+                corner = y * (size + 1) + x
+                faceVertexIndices.extend([corner, corner + 1, corner + size + 2, corner + size + 1])
+        return faceVertexCounts, Vt.IntArray(faceVertexIndices), points
+
+    def computeAll(self, faceVertexCounts, faceVertexIndices, points):
+        results = [
+            usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.uniform),
+            usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.vertex),
+            usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.faceVarying),
+            usdex.core.computeMeshNormals(faceVertexCounts, faceVertexIndices, points, UsdGeom.Tokens.faceVarying, smoothingAngle=45.0),
+        ]
+        colors = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.vertex, Vt.Vec3fArray([Gf.Vec3f(i % 4, 0, 0) for i in range(len(points))]))
+        self.assertTrue(colors.index())
+        results.append(colors)
+        return results
+
+    def testInactiveByDefault(self):
+        self.assertFalse(usdex.core.ScratchArenaScope.isActive())
+        self.computeAll(*self.createGrid(16))
+        # Without a scope the memory is freed as soon as each computation completes
+        self.assertEqual(usdex.core.ScratchArenaScope.getCapacity(), 0)
+
+    def testRetainedWithinScope(self):
+        faceVertexCounts, faceVertexIndices, points = self.createGrid(64)
+        expected = self.computeAll(faceVertexCounts, faceVertexIndices, points)
+
+        with usdex.core.ScratchArenaScope():
+            self.assertTrue(usdex.core.ScratchArenaScope.isActive())
+            first = self.computeAll(faceVertexCounts, faceVertexIndices, points)
+            capacity = usdex.core.ScratchArenaScope.getCapacity()
+            self.assertGreater(capacity, 0)
+
+            # The retained memory is reused rather than grown by computations of the same size
+            second = self.computeAll(faceVertexCounts, faceVertexIndices, points)
+            self.assertEqual(usdex.core.ScratchArenaScope.getCapacity(), capacity)
+
+        self.assertFalse(usdex.core.ScratchArenaScope.isActive())
+        self.assertEqual(usdex.core.ScratchArenaScope.getCapacity(), 0)
+
+        for results in (first, second):
+            for actual, primvar in zip(results, expected):
+                self.assertEqual(actual.interpolation(), primvar.interpolation())
+                self.assertEqual(actual.values(), primvar.values())
+                self.assertEqual(actual.indices(), primvar.indices())
+
+    def testNested(self):
+        with usdex.core.ScratchArenaScope():
+            with usdex.core.ScratchArenaScope():
+                self.computeAll(*self.createGrid(16))
+            # The outer scope still retains the memory
+            self.assertTrue(usdex.core.ScratchArenaScope.isActive())
+            self.assertGreater(usdex.core.ScratchArenaScope.getCapacity(), 0)
+        self.assertFalse(usdex.core.ScratchArenaScope.isActive())
+        self.assertEqual(usdex.core.ScratchArenaScope.getCapacity(), 0)
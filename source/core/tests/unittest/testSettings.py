@@ -104,3 +104,50 @@ class SettingsTest(usdex.test.TestCase):
             ),
             expectedOutputPattern=".*USDEX_ENABLE_TRANSCODING is overridden to 'false'.*",
         )
+
+    def testValidNameCacheSizeSetting(self):
+        self.assertEqual(usdex.core.validNameCacheSizeSetting, "USDEX_VALID_NAME_CACHE_SIZE")
+        self.assertIsInstance(Tf.GetEnvSetting(usdex.core.validNameCacheSizeSetting), int)
+        environValue = os.environ.get("USDEX_VALID_NAME_CACHE_SIZE", 0)
+        self.assertEqual(Tf.GetEnvSetting(usdex.core.validNameCacheSizeSetting), int(environValue))
+
+    def testEnableValidNameCacheSetting(self):
+        # memoized names are identical to computed names, including after eviction
+        self.assertEnvSetting(
+            setting=usdex.core.validNameCacheSizeSetting,
+            value=16,
+            command=inspect.cleandoc(
+                """
+                import usdex.core
+                from pxr import Tf
+                assert Tf.GetEnvSetting(usdex.core.validNameCacheSizeSetting) == 16
+                for i in range(3):
+                    assert usdex.core.getValidPrimName(r"sphere%$%#ad@$1") == "tn__spheread1_kAHAJ8jC"
+                    assert usdex.core.getValidPrimName("1 mesh") == "tn__1mesh_c5"
+                    assert usdex.core.getValidPrimName("") == "tn__"
+                    assert usdex.core.getValidPropertyName("1 mesh") == "tn__1mesh_c5"
+                    assert usdex.core.getValidPropertyName("a:1 mesh") == "a:tn__1mesh_c5"
+                    for j in range(100):
+                        assert usdex.core.getValidPrimName(f"{j} mesh") == usdex.core.getValidPrimName(f"{j} mesh")
+                assert usdex.core.getValidPrimNames(["1 mesh", "1 mesh"]) == ["tn__1mesh_c5", "tn__1mesh_c5_1"]
+                """
+            ),
+            expectedOutputPattern=".*USDEX_VALID_NAME_CACHE_SIZE is overridden to '16'.*",
+        )
+
+    def testEnableInstrumentationSetting(self):
+        self.assertEqual(usdex.core.enableInstrumentationSetting, "USDEX_ENABLE_INSTRUMENTATION")
+        self.assertIsInstance(Tf.GetEnvSetting(usdex.core.enableInstrumentationSetting), bool)
+        self.assertEnvSetting(
+            setting=usdex.core.enableInstrumentationSetting,
+            value=True,
+            command=inspect.cleandoc(
+                """
+                import usdex.core
+                assert usdex.core.isInstrumentationEnabled()
+                usdex.core.getValidPrimName("1 mesh")
+                assert [x.name for x in usdex.core.getInstrumentationCounters()] == ["getValidPrimName"]
+                """
+            ),
+            expectedOutputPattern=".*USDEX_ENABLE_INSTRUMENTATION is overridden to 'true'.*",
+        )
@@ -2,10 +2,12 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 
+import os
+
 import omni.asset_validator
 import usdex.core
 import usdex.test
-from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdPhysics
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdLux, UsdPhysics, Vt
 
 
 class CreateStageTestCase(usdex.test.TestCase):
@@ -290,6 +292,153 @@ class CreateStageTestCase(usdex.test.TestCase):
         self.assertTrue(usdex.core.hasLayerAuthoringMetadata(stage.GetRootLayer()))
         self.assertIsValidUsd(stage)
 
+    def testWriteOptions(self):
+        # The write options select the encoding of a .usd root layer
+        for encoding in ("usda", "usdc"):
+            identifier = self.tmpFile("test", "usd")
+            stage = usdex.core.createStage(
+                identifier,
+                self.defaultPrimName,
+                self.defaultUpAxis,
+                self.defaultLinearUnits,
+                self.defaultAuthoringMetadata,
+                writeOptions=usdex.core.LayerWriteOptions(encoding),
+            )
+            self.assertIsInstance(stage, Usd.Stage)
+            self.assertEqual(usdex.core.getUsdLayerEncoding(stage.GetRootLayer()), encoding)
+            self.assertIsValidUsd(stage)
+
+        # Conflicting write options will result in an unsuccessful stage creation
+        identifier = self.tmpFile("test", "usda")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid write options")]):
+            stage = usdex.core.createStage(
+                identifier,
+                self.defaultPrimName,
+                self.defaultUpAxis,
+                self.defaultLinearUnits,
+                self.defaultAuthoringMetadata,
+                writeOptions=usdex.core.LayerWriteOptions("usdc"),
+            )
+        self.assertIsNone(stage)
+
+
+class CreateUnsavedStageTestCase(usdex.test.TestCase):
+
+    def testCreateUnsavedStage(self):
+        identifier = os.path.join(self.tmpDir(), "unsaved.usda")
+        stage = usdex.core.createUnsavedStage(
+            identifier,
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+            massUnits=UsdPhysics.MassUnits.grams,
+        )
+        self.assertIsInstance(stage, Usd.Stage)
+        self.assertSdfLayerIdentifier(stage.GetRootLayer(), identifier)
+        self.assertEqual(stage.GetDefaultPrim().GetName(), self.defaultPrimName)
+        self.assertEqual(UsdGeom.GetStageUpAxis(stage), self.defaultUpAxis)
+        self.assertEqual(UsdGeom.GetStageMetersPerUnit(stage), self.defaultLinearUnits)
+        self.assertEqual(UsdPhysics.GetStageKilogramsPerUnit(stage), UsdPhysics.MassUnits.grams)
+        self.assertTrue(usdex.core.hasLayerAuthoringMetadata(stage.GetRootLayer()))
+        self.assertIsValidUsd(stage)
+
+        # Nothing is written until the stage is saved
+        self.assertFalse(os.path.exists(identifier))
+        self.assertTrue(stage.GetRootLayer().dirty)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            usdex.core.saveStage(stage)
+        self.assertTrue(os.path.exists(identifier))
+        savedLayer = Sdf.Layer.OpenAsAnonymous(identifier)
+        self.assertEqual(savedLayer.defaultPrim, self.defaultPrimName)
+        self.assertTrue(usdex.core.hasLayerAuthoringMetadata(savedLayer))
+
+    def testFileFormatArgs(self):
+        identifier = os.path.join(self.tmpDir(), "unsaved.usd")
+        stage = usdex.core.createUnsavedStage(
+            identifier,
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+            {"format": "usda"},
+        )
+        self.assertIsInstance(stage, Usd.Stage)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            usdex.core.saveStage(stage)
+        self.assertEqual(usdex.core.getUsdLayerEncoding(stage.GetRootLayer()), "usda")
+
+    def testWriteOptions(self):
+        # The write options select the encoding of a .usd root layer, which is preserved when the saved layer is read back
+        for encoding in ("usda", "usdc"):
+            identifier = os.path.join(self.tmpDir(), f"unsaved_{encoding}.usd")
+            stage = usdex.core.createUnsavedStage(
+                identifier,
+                self.defaultPrimName,
+                self.defaultUpAxis,
+                self.defaultLinearUnits,
+                self.defaultAuthoringMetadata,
+                writeOptions=usdex.core.LayerWriteOptions(encoding),
+            )
+            self.assertIsInstance(stage, Usd.Stage)
+            self.assertEqual(usdex.core.getUsdLayerEncoding(stage.GetRootLayer()), encoding)
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+                usdex.core.saveStage(stage)
+
+            savedLayer = Sdf.Layer.OpenAsAnonymous(identifier)
+            self.assertEqual(usdex.core.getUsdLayerEncoding(savedLayer), encoding)
+            self.assertEqual(savedLayer.defaultPrim, self.defaultPrimName)
+            self.assertTrue(usdex.core.hasLayerAuthoringMetadata(savedLayer))
+
+        # Conflicting write options will result in an unsuccessful stage creation, without registering a layer
+        identifier = os.path.join(self.tmpDir(), "conflicting.usda")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid write options")]):
+            stage = usdex.core.createUnsavedStage(
+                identifier,
+                self.defaultPrimName,
+                self.defaultUpAxis,
+                self.defaultLinearUnits,
+                self.defaultAuthoringMetadata,
+                writeOptions=usdex.core.LayerWriteOptions("usdc"),
+            )
+        self.assertIsNone(stage)
+        self.assertFalse(Sdf.Layer.Find(identifier))
+
+    def testExistingLayer(self):
+        # An existing layer with the same identifier has its content replaced
+        layer = self.tmpLayer()
+        Sdf.CreatePrimInLayer(layer, "/Existing")
+        stage = usdex.core.createUnsavedStage(
+            layer.identifier,
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+        self.assertEqual(stage.GetRootLayer(), layer)
+        self.assertIsNone(layer.GetPrimAtPath("/Existing"))
+        self.assertEqual(layer.defaultPrim, self.defaultPrimName)
+
+    def testInvalid(self):
+        # Invalid arguments result in an unsuccessful stage creation, without registering a layer
+        identifier = os.path.join(self.tmpDir(), "invalid.foo")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid identifier")]):
+            stage = usdex.core.createUnsavedStage(
+                identifier,
+                self.defaultPrimName,
+                self.defaultUpAxis,
+                self.defaultLinearUnits,
+                self.defaultAuthoringMetadata,
+            )
+        self.assertIsNone(stage)
+
+        identifier = os.path.join(self.tmpDir(), "invalid.usda")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid default prim name")]):
+            stage = usdex.core.createUnsavedStage(identifier, "", self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        self.assertIsNone(stage)
+        self.assertFalse(Sdf.Layer.Find(identifier))
+        self.assertFalse(os.path.exists(identifier))
+
 
 class ConfigureStageTestCase(usdex.test.TestCase):
     def testDefaultPrimName(self):
@@ -690,6 +839,100 @@ class SaveStageTestCase(usdex.test.TestCase):
         )
 
 
+    def testSaveStageWithReport(self):
+        comment = "test save stage comment"
+        stage = self.__composeStage()
+        rootLayer = stage.GetRootLayer()
+        baseLayer = stage.GetLayerStack()[-1]
+        overLayer = stage.GetLayerStack()[-2]
+        root = stage.GetDefaultPrim()
+
+        # Dirty every layer in the layer stack, and author to the session layer which should not be saved
+        for i, layer in enumerate((rootLayer, baseLayer, overLayer)):
+            stage.SetEditTarget(Usd.EditTarget(layer))
+            stage.DefinePrim(f"{root.GetPath()}/another{i}")
+        stage.SetEditTarget(Usd.EditTarget(stage.GetSessionLayer()))
+        stage.DefinePrim(f"{root.GetPath()}/session")
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            reports = usdex.core.saveStageWithReport(stage, authoringMetadata=self.defaultAuthoringMetadata, comment=comment)
+
+        self.assertEqual(len(reports), 3)
+        self.assertEqual({x.identifier for x in reports}, {rootLayer.identifier, baseLayer.identifier, overLayer.identifier})
+        for report in reports:
+            self.assertIsInstance(report, usdex.core.LayerSaveReport)
+            self.assertTrue(report.saved)
+            self.assertEqual(report.bytesWritten, os.path.getsize(Sdf.Layer.Find(report.identifier).realPath))
+            self.assertGreaterEqual(report.seconds, 0.0)
+
+        for layer in stage.GetLayerStack(includeSessionLayers=False):
+            self.assertFalse(layer.dirty)
+            self.assertTrue(usdex.core.hasLayerAuthoringMetadata(layer))
+            self.assertEqual(layer.comment, comment)
+        self.assertTrue(stage.GetSessionLayer().dirty)
+
+        # Clean layers are not saved
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            reports = usdex.core.saveStageWithReport(stage)
+        self.assertEqual(reports, [])
+
+        # An invalid stage produces an error
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to save due to an invalid stage")]):
+            reports = usdex.core.saveStageWithReport(None)
+        self.assertEqual(reports, [])
+
+    def testSaveStageAsync(self):
+        comment = "test save stage comment"
+        stage = self.__composeStage()
+        rootLayer = stage.GetRootLayer()
+        baseLayer = stage.GetLayerStack()[-1]
+        root = stage.GetDefaultPrim()
+
+        stage.SetEditTarget(Usd.EditTarget(baseLayer))
+        stage.DefinePrim(f"{root.GetPath()}/saved")
+        stage.SetEditTarget(Usd.EditTarget(stage.GetSessionLayer()))
+        stage.DefinePrim(f"{root.GetPath()}/session")
+        stage.SetEditTarget(Usd.EditTarget(rootLayer))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+            future = usdex.core.saveStageAsync(stage, authoringMetadata=self.defaultAuthoringMetadata, comment=comment)
+        self.assertIsInstance(future, usdex.core.SaveFuture)
+
+        # The stage can be edited while the save is in flight, without affecting the saved files
+        stage.DefinePrim(f"{root.GetPath()}/unsaved")
+        self.assertTrue(future.result())
+        self.assertTrue(future.done())
+
+        savedRoot = Sdf.Layer.OpenAsAnonymous(rootLayer.realPath)
+        savedBase = Sdf.Layer.OpenAsAnonymous(baseLayer.realPath)
+        self.assertIsNone(savedRoot.GetPrimAtPath(f"{root.GetPath()}/unsaved"))
+        self.assertIsNotNone(savedBase.GetPrimAtPath(f"{root.GetPath()}/saved"))
+        self.assertIsNone(savedBase.GetPrimAtPath(f"{root.GetPath()}/session"))
+        for savedLayer in (savedRoot, savedBase):
+            self.assertTrue(usdex.core.hasLayerAuthoringMetadata(savedLayer))
+            self.assertEqual(savedLayer.comment, comment)
+
+        # The layers remain dirty, as they may have been edited while the save was in flight
+        self.assertTrue(rootLayer.dirty)
+        self.assertTrue(baseLayer.dirty)
+
+        # Successive saves are written in the order they were requested
+        futures = []
+        for i in range(5):
+            stage.DefinePrim(f"{root.GetPath()}/ordered{i}")
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Saving.*")]):
+                futures.append(usdex.core.saveStageAsync(stage))
+        self.assertTrue(all(x.result() for x in futures))
+        savedRoot = Sdf.Layer.OpenAsAnonymous(rootLayer.realPath)
+        self.assertIsNotNone(savedRoot.GetPrimAtPath(f"{root.GetPath()}/ordered4"))
+
+        # An invalid stage produces an error
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, "Unable to save due to an invalid stage")]):
+            future = usdex.core.saveStageAsync(None)
+        self.assertTrue(future.done())
+        self.assertFalse(future.result())
+
+
 class LocationEditableTestCase(usdex.test.TestCase):
     def testIsEditableLocationFromStagePath(self):
         stage = Usd.Stage.CreateInMemory()
@@ -867,3 +1110,394 @@ class LocationEditableTestCase(usdex.test.TestCase):
         # show that the Instance prim has no children, the prototype holds the children
         self.assertEqual(len(carB.GetChildren()), 0)
         self.assertEqual(len(carB.GetPrim().GetPrototype().GetChildren()), 2)  # Sphere and NewSphere
+
+
+class BulkAuthoringScopeTestCase(usdex.test.TestCase):
+
+    def createStage(self, name):
+        return usdex.core.createStage(
+            self.tmpFile(name, "usda"),
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            self.defaultAuthoringMetadata,
+        )
+
+    def defineAll(self, stage):
+        """Define one prim with each of the functions supporting the bulk authoring mode"""
+        root = stage.GetDefaultPrim().GetPath()
+        points = Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 0, 0), Gf.Vec3f(1, 1, 0), Gf.Vec3f(0, 1, 1)])
+        widths = usdex.core.FloatPrimvarData(UsdGeom.Tokens.vertex, Vt.FloatArray([0.1, 0.2, 0.1]), Vt.IntArray([0, 1, 2, 0]))
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1, 0, 0)]))
+        camera = Gf.Camera()
+        camera.focalLength = 35.0
+        camera.clippingPlanes = [Gf.Vec4f(0, 0, 1, 1)]
+
+        prims = [
+            usdex.core.definePlane(stage, root.AppendChild("Plane"), 2.0, 3.0, UsdGeom.Tokens.x, Gf.Vec3f(1, 0, 0), 0.5),
+            usdex.core.defineSphere(stage, root.AppendChild("Sphere"), 0.5),
+            usdex.core.defineCube(stage, root.AppendChild("Cube"), 2.0, displayOpacity=0.5),
+            usdex.core.defineCone(stage, root.AppendChild("Cone"), 1.0, 2.0, UsdGeom.Tokens.z),
+            usdex.core.defineCylinder(stage, root.AppendChild("Cylinder"), 1.0, 2.0, UsdGeom.Tokens.x),
+            usdex.core.defineCapsule(stage, root.AppendChild("Capsule"), 1.0, 2.0, UsdGeom.Tokens.y, Gf.Vec3f(0, 1, 0)),
+            usdex.core.definePointCloud(stage, root.AppendChild("Points"), points, widths=widths, displayColor=displayColor),
+            usdex.core.definePointCloud(stage, root.AppendChild("PointsWithIds"), points, ids=Vt.Int64Array([3, 2, 1, 0])),
+            usdex.core.defineLinearBasisCurves(stage, root.AppendChild("Curves"), Vt.IntArray([4]), points, widths=widths),
+            usdex.core.defineCubicBasisCurves(stage, root.AppendChild("Cubic"), Vt.IntArray([4]), points, UsdGeom.Tokens.bezier),
+            usdex.core.defineDomeLight(stage, root.AppendChild("Dome"), 0.5, "./sky.hdr", UsdLux.Tokens.latlong),
+            usdex.core.defineRectLight(stage, root.AppendChild("Rect"), 2.0, 4.0, 10.0, "./rect.png"),
+            usdex.core.defineCamera(stage, root.AppendChild("Camera"), camera),
+        ]
+        for prim in prims:
+            self.assertTrue(prim)
+        return prims
+
+    def testIdenticalLayers(self):
+        expected = self.createStage("expected")
+        self.defineAll(expected)
+
+        stage = self.createStage("bulk")
+        self.assertFalse(usdex.core.BulkAuthoringScope.isActive(stage))
+        with usdex.core.BulkAuthoringScope(stage):
+            self.assertTrue(usdex.core.BulkAuthoringScope.isActive(stage))
+            self.assertFalse(usdex.core.BulkAuthoringScope.isActive(expected))
+            prims = self.defineAll(stage)
+        self.assertFalse(usdex.core.BulkAuthoringScope.isActive(stage))
+
+        # the returned prims are composed and of the expected type
+        self.assertTrue(prims[0].GetPrim().IsA(UsdGeom.Plane))
+        self.assertTrue(prims[-1].GetPrim().IsA(UsdGeom.Camera))
+        self.assertEqual(prims[1].GetRadiusAttr().Get(), 0.5)
+
+        # the authored data matches the Usd level authoring
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected.GetRootLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+        # missing ancestors are defined as typeless prims, as UsdStage.DefinePrim would
+        path = stage.GetDefaultPrim().GetPath().AppendPath("Missing/Sphere")
+        self.assertTrue(usdex.core.defineSphere(expected, path, 0.5))
+        with usdex.core.BulkAuthoringScope(stage):
+            self.assertTrue(usdex.core.defineSphere(stage, path, 0.5))
+        missing = stage.GetPrimAtPath(path.GetParentPath())
+        self.assertTrue(missing.IsDefined())
+        self.assertEqual(missing.GetSpecifier(), Sdf.SpecifierDef)
+        self.assertEqual(missing.GetTypeName(), "")
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected.GetRootLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+    def testCameraUnderMissingAncestors(self):
+        camera = Gf.Camera()
+        camera.transform = Gf.Matrix4d().SetTranslate(Gf.Vec3d(1, 2, 3))
+
+        layers = []
+        for bulk in (False, True):
+            stage = self.createStage(f"camera_{bulk}")
+            parent = usdex.core.defineXform(stage, stage.GetDefaultPrim().GetPath().AppendChild("Parent"))
+            usdex.core.setLocalTransform(parent.GetPrim(), Gf.Transform(Gf.Matrix4d().SetTranslate(Gf.Vec3d(10, 0, 0))))
+            path = parent.GetPath().AppendPath("Missing/Camera")
+            if bulk:
+                with usdex.core.BulkAuthoringScope(stage):
+                    result = usdex.core.defineCamera(stage, path, camera)
+            else:
+                result = usdex.core.defineCamera(stage, path, camera)
+
+            # the transform of the nearest existing ancestor is accounted for, as the missing ancestors are typeless
+            self.assertTrue(result)
+            self.assertEqual(result.ComputeLocalToWorldTransform(Usd.TimeCode.Default()), camera.transform)
+            layers.append(stage.GetRootLayer().ExportToString())
+        self.assertEqual(layers[0], layers[1])
+
+    def testNotices(self):
+        stage = self.createStage("notices")
+        notices = []
+        listener = Tf.Notice.Register(Usd.Notice.ObjectsChanged, lambda notice, sender: notices.append(notice), stage)
+
+        # each define call results in a single notice
+        with usdex.core.BulkAuthoringScope(stage):
+            prims = self.defineAll(stage)
+        self.assertEqual(len(notices), len(prims))
+
+        # the default mode results in a notice per authored opinion
+        notices.clear()
+        usdex.core.defineSphere(stage, stage.GetDefaultPrim().GetPath().AppendChild("Default"), 0.5)
+        self.assertGreater(len(notices), 1)
+        listener.Revoke()
+
+    def testNestedScopes(self):
+        stage = Usd.Stage.CreateInMemory()
+        other = Usd.Stage.CreateInMemory()
+        with usdex.core.BulkAuthoringScope(stage):
+            with usdex.core.BulkAuthoringScope(other):
+                self.assertTrue(usdex.core.BulkAuthoringScope.isActive(stage))
+                self.assertTrue(usdex.core.BulkAuthoringScope.isActive(other))
+            self.assertTrue(usdex.core.BulkAuthoringScope.isActive(stage))
+            self.assertFalse(usdex.core.BulkAuthoringScope.isActive(other))
+        self.assertFalse(usdex.core.BulkAuthoringScope.isActive(stage))
+
+    def testValidation(self):
+        stage = Usd.Stage.CreateInMemory()
+        with usdex.core.BulkAuthoringScope(stage):
+            # arguments and locations are still validated
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+                self.assertFalse(usdex.core.defineSphere(stage, Sdf.Path("relative"), 1.0))
+
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid points")]):
+                self.assertFalse(usdex.core.definePointCloud(stage, Sdf.Path("/Points"), Vt.Vec3fArray()))
+        self.assertFalse(stage.GetPrimAtPath("/Points"))
+
+
+class EditablePrimLocationScopeTestCase(usdex.test.TestCase):
+
+    def testIsActive(self):
+        stage = Usd.Stage.CreateInMemory()
+        other = Usd.Stage.CreateInMemory()
+        self.assertFalse(usdex.core.EditablePrimLocationScope.isActive(stage))
+        with usdex.core.EditablePrimLocationScope(stage):
+            self.assertTrue(usdex.core.EditablePrimLocationScope.isActive(stage))
+            self.assertFalse(usdex.core.EditablePrimLocationScope.isActive(other))
+        self.assertFalse(usdex.core.EditablePrimLocationScope.isActive(stage))
+
+        # the bulk authoring mode also memoizes the ancestor checks
+        with usdex.core.BulkAuthoringScope(stage):
+            self.assertTrue(usdex.core.EditablePrimLocationScope.isActive(stage))
+        self.assertFalse(usdex.core.EditablePrimLocationScope.isActive(stage))
+
+    def testMatchesUncached(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.defineXform(stage, "/Prototype")
+        usdex.core.defineXform(stage, "/Prototype/Child")
+        instance = usdex.core.defineXform(stage, "/Instance").GetPrim()
+        instance.GetReferences().AddInternalReference("/Prototype")
+        instance.SetInstanceable(True)
+        usdex.core.defineXform(stage, "/World")
+
+        paths = ["/World/A", "/World/B", "/Instance/Child/A", "/Instance/Child/B", "/Instance/A", "/Missing/A", "/World/A/B"]
+        expected = [usdex.core.isEditablePrimLocation(stage, Sdf.Path(path)) for path in paths]
+        with usdex.core.EditablePrimLocationScope(stage):
+            # query twice to exercise both the computed and the memoized verdicts
+            for _ in range(2):
+                self.assertEqual([usdex.core.isEditablePrimLocation(stage, Sdf.Path(path)) for path in paths], expected)
+
+        self.assertTrue(expected[0][0])
+        self.assertFalse(expected[2][0])
+        self.assertRegex(expected[2][1], ".*descendant of instance proxy.*authoring is not allowed")
+        self.assertFalse(expected[4][0])
+        self.assertRegex(expected[4][1], ".*descendant of instance.*authoring is not allowed")
+
+    def testInvalidation(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.defineXform(stage, "/Prototype")
+        parent = usdex.core.defineXform(stage, "/World/Parent").GetPrim()
+
+        with usdex.core.EditablePrimLocationScope(stage):
+            result, _ = usdex.core.isEditablePrimLocation(stage, Sdf.Path("/World/Parent/Child"))
+            self.assertTrue(result)
+
+            # making the parent an instance resyncs it, so the memoized verdict is discarded
+            parent.GetReferences().AddInternalReference("/Prototype")
+            parent.SetInstanceable(True)
+            result, reason = usdex.core.isEditablePrimLocation(stage, Sdf.Path("/World/Parent/Child"))
+            self.assertFalse(result)
+            self.assertRegex(reason, ".*descendant of instance.*authoring is not allowed")
+
+            # making an ancestor an instance also discards the verdicts of its descendants
+            result, _ = usdex.core.isEditablePrimLocation(stage, Sdf.Path("/Other/Parent/Child"))
+            self.assertTrue(result)
+            other = usdex.core.defineXform(stage, "/Other").GetPrim()
+            usdex.core.defineXform(stage, "/Other/Parent")
+            other.GetReferences().AddInternalReference("/Prototype")
+            other.SetInstanceable(True)
+            result, reason = usdex.core.isEditablePrimLocation(stage, Sdf.Path("/Other/Parent/Child"))
+            self.assertFalse(result)
+            self.assertRegex(reason, ".*descendant of instance.*authoring is not allowed")
+
+
+class SkipUnchangedValuesScopeTestCase(usdex.test.TestCase):
+
+    def defineMesh(self, stage, points):
+        faceVertexCounts = Vt.IntArray([4])
+        faceVertexIndices = Vt.IntArray([0, 1, 2, 3])
+        displayColor = usdex.core.Vec3fPrimvarData(UsdGeom.Tokens.constant, Vt.Vec3fArray([Gf.Vec3f(1.0, 0.0, 0.0)]))
+        return usdex.core.definePolyMesh(stage, "/World/Mesh", faceVertexCounts, faceVertexIndices, points, displayColor=displayColor)
+
+    def changedPaths(self, notices):
+        return {path for notice in notices for path in notice.GetChangedInfoOnlyPaths()}
+
+    def testIsActive(self):
+        stage = Usd.Stage.CreateInMemory()
+        other = Usd.Stage.CreateInMemory()
+        self.assertFalse(usdex.core.SkipUnchangedValuesScope.isActive(stage))
+        with usdex.core.SkipUnchangedValuesScope(stage):
+            self.assertTrue(usdex.core.SkipUnchangedValuesScope.isActive(stage))
+            self.assertFalse(usdex.core.SkipUnchangedValuesScope.isActive(other))
+            with usdex.core.SkipUnchangedValuesScope(other):
+                self.assertTrue(usdex.core.SkipUnchangedValuesScope.isActive(other))
+            self.assertFalse(usdex.core.SkipUnchangedValuesScope.isActive(other))
+        self.assertFalse(usdex.core.SkipUnchangedValuesScope.isActive(stage))
+
+    def testUnchangedValues(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.defineXform(stage, "/World")
+        points = Vt.Vec3fArray([Gf.Vec3f(0.0, 0.0, 0.0), Gf.Vec3f(1.0, 0.0, 0.0), Gf.Vec3f(1.0, 1.0, 0.0), Gf.Vec3f(0.0, 1.0, 0.0)])
+        mesh = self.defineMesh(stage, points)
+        usdex.core.setLocalTransform(mesh.GetPrim(), Gf.Vec3d(1.0, 2.0, 3.0), Gf.Quatf.GetIdentity())
+        material = usdex.core.definePreviewMaterial(stage, "/World/Material", Gf.Vec3f(0.5, 0.5, 0.5))
+        expected = stage.GetRootLayer().ExportToString()
+
+        notices = []
+        listener = Tf.Notice.Register(Usd.Notice.ObjectsChanged, lambda notice, sender: notices.append(notice), stage)
+        with usdex.core.SkipUnchangedValuesScope(stage):
+            # re-authoring equal (but not identical) values does not change any attribute
+            mesh = self.defineMesh(stage, Vt.Vec3fArray(points))
+            self.assertTrue(mesh)
+            self.assertTrue(usdex.core.setLocalTransform(mesh.GetPrim(), Gf.Vec3d(1.0, 2.0, 3.0), Gf.Quatf.GetIdentity()))
+            material = usdex.core.definePreviewMaterial(stage, "/World/Material", Gf.Vec3f(0.5, 0.5, 0.5))
+            self.assertTrue(material)
+            changed = self.changedPaths(notices)
+            self.assertNotIn(mesh.GetPointsAttr().GetPath(), changed)
+            self.assertNotIn(mesh.GetDisplayColorAttr().GetPath(), changed)
+            self.assertNotIn(mesh.GetPath().AppendProperty("xformOp:translate"), changed)
+            self.assertNotIn(Sdf.Path("/World/Material/PreviewSurface.inputs:diffuseColor"), changed)
+
+            # changed values are still authored
+            notices.clear()
+            movedPoints = Vt.Vec3fArray([point + Gf.Vec3f(0.0, 0.0, 1.0) for point in points])
+            mesh = self.defineMesh(stage, movedPoints)
+            usdex.core.setLocalTransform(mesh.GetPrim(), Gf.Vec3d(4.0, 5.0, 6.0), Gf.Quatf.GetIdentity())
+            changed = self.changedPaths(notices)
+            self.assertIn(mesh.GetPointsAttr().GetPath(), changed)
+            self.assertIn(mesh.GetPath().AppendProperty("xformOp:translate"), changed)
+        listener.Revoke()
+
+        self.assertEqual(mesh.GetPointsAttr().Get(), movedPoints)
+        self.assertEqual(mesh.GetPrim().GetAttribute("xformOp:translate").Get(), Gf.Vec3d(4.0, 5.0, 6.0))
+
+        # the authored data matches the default mode
+        self.defineMesh(stage, points)
+        usdex.core.setLocalTransform(mesh.GetPrim(), Gf.Vec3d(1.0, 2.0, 3.0), Gf.Quatf.GetIdentity())
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected)
+        self.assertIsValidUsd(stage)
+
+    def testTimeSamples(self):
+        stage = Usd.Stage.CreateInMemory()
+        xform = usdex.core.defineXform(stage, "/Xform")
+        usdex.core.setLocalTransform(xform.GetPrim(), Gf.Vec3d(1.0, 0.0, 0.0), Gf.Quatf.GetIdentity(), time=Usd.TimeCode(1.0))
+        with usdex.core.SkipUnchangedValuesScope(stage):
+            # an equal default value does not match a time sample
+            usdex.core.setLocalTransform(xform.GetPrim(), Gf.Vec3d(1.0, 0.0, 0.0), Gf.Quatf.GetIdentity())
+            usdex.core.setLocalTransform(xform.GetPrim(), Gf.Vec3d(1.0, 0.0, 0.0), Gf.Quatf.GetIdentity(), time=Usd.TimeCode(1.0))
+            usdex.core.setLocalTransform(xform.GetPrim(), Gf.Vec3d(2.0, 0.0, 0.0), Gf.Quatf.GetIdentity(), time=Usd.TimeCode(2.0))
+        translate = xform.GetPrim().GetAttribute("xformOp:translate")
+        self.assertEqual(translate.Get(Usd.TimeCode.Default()), Gf.Vec3d(1.0, 0.0, 0.0))
+        self.assertEqual(translate.GetTimeSamples(), [1.0, 2.0])
+
+
+class StagePoolTestCase(usdex.test.TestCase):
+
+    def createPool(self, capacity=8):
+        return usdex.core.StagePool(
+            self.defaultPrimName,
+            self.defaultUpAxis,
+            self.defaultLinearUnits,
+            UsdPhysics.MassUnits.grams,
+            self.defaultAuthoringMetadata,
+            capacity,
+        )
+
+    def assertConfigured(self, stage):
+        self.assertTrue(stage.GetRootLayer().anonymous)
+        self.assertEqual(stage.GetDefaultPrim().GetPath(), Sdf.Path(f"/{self.defaultPrimName}"))
+        self.assertEqual(UsdGeom.GetStageUpAxis(stage), self.defaultUpAxis)
+        self.assertEqual(UsdGeom.GetStageMetersPerUnit(stage), self.defaultLinearUnits)
+        self.assertEqual(UsdPhysics.GetStageKilogramsPerUnit(stage), UsdPhysics.MassUnits.grams)
+        self.assertEqual(stage.GetRootLayer().customLayerData, {"creator": self.defaultAuthoringMetadata})
+        self.assertEqual([x.GetPath() for x in stage.Traverse()], [Sdf.Path(f"/{self.defaultPrimName}")])
+        self.assertTrue(stage.GetSessionLayer().empty)
+
+    def testAcquireAndRelease(self):
+        pool = self.createPool()
+        self.assertTrue(pool.isValid())
+        self.assertEqual(pool.getIdleCount(), 0)
+
+        stage = pool.acquire()
+        self.assertConfigured(stage)
+        rootLayer = stage.GetRootLayer()
+
+        # Edits are discarded when the stage is released
+        UsdGeom.Xform.Define(stage, f"/{self.defaultPrimName}/Xform")
+        UsdGeom.SetStageUpAxis(stage, UsdGeom.Tokens.z)
+        stage.GetSessionLayer().subLayerPaths.append(Sdf.Layer.CreateAnonymous().identifier)
+        stage.SetEditTarget(stage.GetSessionLayer())
+        self.assertTrue(pool.release(stage))
+        self.assertEqual(pool.getIdleCount(), 1)
+
+        # The released stage is reused
+        reused = pool.acquire()
+        self.assertEqual(pool.getIdleCount(), 0)
+        self.assertEqual(reused.GetRootLayer(), rootLayer)
+        self.assertEqual(reused.GetEditTarget().GetLayer(), rootLayer)
+        self.assertConfigured(reused)
+
+        # A second stage is created while the first is in use
+        other = pool.acquire()
+        self.assertNotEqual(other.GetRootLayer(), rootLayer)
+        self.assertConfigured(other)
+        self.assertTrue(pool.release(reused))
+        self.assertTrue(pool.release(other))
+        self.assertEqual(pool.getIdleCount(), 2)
+
+    def testCapacity(self):
+        pool = self.createPool(capacity=1)
+        stages = [pool.acquire() for _ in range(3)]
+        for stage in stages:
+            self.assertTrue(pool.release(stage))
+        self.assertEqual(pool.getIdleCount(), 1)
+
+    def testSave(self):
+        pool = self.createPool()
+        stage = pool.acquire()
+        UsdGeom.Xform.Define(stage, f"/{self.defaultPrimName}/Xform")
+
+        # The root layer is exported without registering a layer with the identifier
+        identifier = self.tmpFile("pooled", "usda")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, 'Exporting.*with comment "pooled"')]):
+            self.assertTrue(pool.save(stage, identifier, comment="pooled"))
+        self.assertFalse(Sdf.Layer.Find(identifier))
+        self.assertTrue(pool.release(stage))
+
+        savedStage = Usd.Stage.Open(identifier)
+        self.assertEqual(savedStage.GetRootLayer().comment, "pooled")
+        self.assertEqual(savedStage.GetRootLayer().customLayerData, {"creator": self.defaultAuthoringMetadata})
+        self.assertEqual(UsdPhysics.GetStageKilogramsPerUnit(savedStage), UsdPhysics.MassUnits.grams)
+        self.assertTrue(savedStage.GetPrimAtPath(f"/{self.defaultPrimName}/Xform"))
+        self.assertIsValidUsd(savedStage)
+
+        # The encoding may be chosen for .usd identifiers
+        stage = pool.acquire()
+        identifier = self.tmpFile("pooled", "usd")
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_STATUS_TYPE, "Exporting")]):
+            self.assertTrue(pool.save(stage, identifier, writeOptions=usdex.core.LayerWriteOptions("usda")))
+        self.assertEqual(usdex.core.getUsdLayerEncoding(Sdf.Layer.FindOrOpen(identifier)), "usda")
+        self.assertTrue(pool.release(stage))
+
+    def testInvalid(self):
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid default prim name")]):
+            pool = usdex.core.StagePool("1", self.defaultUpAxis, self.defaultLinearUnits, UsdPhysics.MassUnits.grams, self.defaultAuthoringMetadata)
+        self.assertFalse(pool.isValid())
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid StagePool")]):
+            self.assertIsNone(pool.acquire())
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_WARNING_TYPE, ".*invalid stage metrics")]):
+            pool = usdex.core.StagePool(self.defaultPrimName, "x", self.defaultLinearUnits, UsdPhysics.MassUnits.grams, self.defaultAuthoringMetadata)
+        self.assertFalse(pool.isValid())
+
+        # Stages which were not acquired from the pool, or were already released, are rejected
+        pool = self.createPool()
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*not acquired from this StagePool")]):
+            self.assertFalse(pool.release(Usd.Stage.CreateInMemory()))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*not acquired from this StagePool")]):
+            self.assertFalse(pool.save(Usd.Stage.CreateInMemory(), self.tmpFile("pooled", "usda")))
+        stage = pool.acquire()
+        self.assertTrue(pool.release(stage))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*already been released")]):
+            self.assertFalse(pool.release(stage))
@@ -0,0 +1,79 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import json
+import os
+import statistics
+import subprocess
+import sys
+
+import usdex.test
+
+# The OpenUSD python modules which are imported on first use, rather than by `import usdex.core`
+LAZY_MODULES = ["pxr.Ar", "pxr.Sdf", "pxr.Usd", "pxr.UsdGeom", "pxr.UsdLux", "pxr.UsdPhysics", "pxr.UsdShade"]
+
+
+class StartupTest(usdex.test.TestCase):
+
+    def runPython(self, command):
+        # Each command runs in a fresh interpreter, so that no modules have been imported by the test suite
+        result = subprocess.run(
+            [sys.executable, "-c", command],
+            env=os.environ.copy(),
+            capture_output=True,
+            encoding="utf-8",
+            universal_newlines=True,
+        )
+        if result.returncode != 0:
+            self.fail(msg=result.stderr)
+        return json.loads(result.stdout.splitlines()[-1])
+
+    def testLazyImports(self):
+        command = f"""
+import json, sys
+import usdex.core
+print(json.dumps([x for x in {LAZY_MODULES!r} if x in sys.modules]))
+"""
+        self.assertEqual(self.runPython(command), [])
+
+    def testImportOnFirstUse(self):
+        # Functions which accept or return OpenUSD types import the modules defining those types, without the client importing them first
+        command = """
+import json
+import usdex.core
+from pxr import Gf, Vt
+counts = Vt.IntArray([3])
+indices = Vt.IntArray([0, 1, 2])
+points = Vt.Vec3fArray([Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 0, 0), Gf.Vec3f(0, 1, 0)])
+normals = usdex.core.computeMeshNormals(counts, indices, points)
+stage = usdex.core.createUnsavedStage("startup.usda", "World", "Z", 0.01, "startup")
+mesh = usdex.core.definePolyMesh(stage, "/World/Mesh", counts, indices, points)
+print(json.dumps([list(normals.values()[0]), type(stage).__module__, type(mesh).__module__, bool(mesh)]))
+"""
+        values, stageModule, meshModule, valid = self.runPython(command)
+        self.assertEqual(values, [0, 0, 1])
+        self.assertEqual(stageModule, "pxr.Usd")
+        self.assertEqual(meshModule, "pxr.UsdGeom")
+        self.assertTrue(valid)
+
+    def testStartupBenchmark(self):
+        # Measure the cold start of `import usdex.core` relative to the OpenUSD modules it requires up front. The timings vary with the host, so
+        # they are reported rather than asserted.
+        command = """
+import json, time
+start = time.perf_counter()
+import pxr.Gf
+pxrTime = time.perf_counter() - start
+start = time.perf_counter()
+import usdex.core
+usdexTime = time.perf_counter() - start
+start = time.perf_counter()
+import pxr.Usd, pxr.UsdGeom
+usdTime = time.perf_counter() - start
+print(json.dumps([pxrTime, usdexTime, usdTime]))
+"""
+        samples = [self.runPython(command) for _ in range(5)]
+        pxrTime, usdexTime, usdTime = (statistics.median(x) * 1000.0 for x in zip(*samples))
+        print(f"\nimport pxr.Gf: {pxrTime:.1f}ms, import usdex.core: {usdexTime:.1f}ms, deferred pxr.Usd & pxr.UsdGeom: {usdTime:.1f}ms")
+        self.assertGreater(usdexTime, 0.0)
@@ -2113,3 +2113,223 @@ class DefineXformFromPrimTestCase(BaseXformTestCase):
             result = usdex.core.defineXform(xformPrim)
         self.assertTrue(result)
         self.assertEqual(result.GetPrim().GetTypeName(), "Xform")
+
+
+class SetLocalTransformsTestCase(BaseSetLocalTransformTestCase):
+    PRIM_PATHS = ("/Root/Xform", "/Root/Animated_Matrix", "/Root/Matrix_Xform_Op_Order", "/Root/Animated_Xform_Common_API")
+    TIMES = [Usd.TimeCode.Default()] + [Usd.TimeCode(float(x)) for x in range(20)]
+
+    def _matrix(self, i, j):
+        transform = Gf.Transform()
+        transform.SetTranslation(Gf.Vec3d(i, j, 1.0))
+        transform.SetRotation(Gf.Rotation(Gf.Vec3d.YAxis(), j * 5.0))
+        transform.SetScale(Gf.Vec3d(1.0 + i))
+        return transform.GetMatrix()
+
+    def _components(self, i, j):
+        rotation = Gf.Rotation(Gf.Vec3d.ZAxis(), j * 5.0)
+        return (Gf.Vec3d(i, j, 1.0), Gf.Quatf(rotation.GetQuat()), Gf.Vec3f(1.0 + i))
+
+    def testMatrices(self):
+        # Setting many samples at once is equivalent to setting each sample individually
+        expectedStage = self._createTestStage()
+        for i, path in enumerate(self.PRIM_PATHS):
+            prim = expectedStage.GetPrimAtPath(path)
+            for j, time in enumerate(self.TIMES):
+                self.assertTrue(usdex.core.setLocalTransform(prim, self._matrix(i, j), time))
+
+        stage = self._createTestStage()
+        prims = [stage.GetPrimAtPath(x) for x in self.PRIM_PATHS]
+        matrices = [self._matrix(i, j) for i in range(len(prims)) for j in range(len(self.TIMES))]
+        self.assertTrue(usdex.core.setLocalTransforms(prims, matrices, self.TIMES))
+
+        for prim in prims:
+            self.assertSuccessfulSetLocalTransform(prim)
+            self.assertValuesAuthoredForXformOpsAtTimes(UsdGeom.Xformable(prim), self.TIMES)
+            self.assertNoExtraneousXformOps(prim)
+        self.assertEqual(stage.GetEditTarget().GetLayer().ExportToString(), expectedStage.GetEditTarget().GetLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+        # A single prim is also supported
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        self.assertTrue(usdex.core.setLocalTransforms(prim, [IDENTITY_MATRIX] * len(self.TIMES), self.TIMES))
+        for time in self.TIMES:
+            self.assertEqual(usdex.core.getLocalTransformMatrix(prim, time), IDENTITY_MATRIX)
+
+    def testComponents(self):
+        # Setting many samples at once is equivalent to setting each sample individually
+        expectedStage = self._createTestStage()
+        for i, path in enumerate(self.PRIM_PATHS):
+            prim = expectedStage.GetPrimAtPath(path)
+            for j, time in enumerate(self.TIMES):
+                self.assertTrue(usdex.core.setLocalTransform(prim, *self._components(i, j), time))
+
+        stage = self._createTestStage()
+        prims = [stage.GetPrimAtPath(x) for x in self.PRIM_PATHS]
+        components = [self._components(i, j) for i in range(len(prims)) for j in range(len(self.TIMES))]
+        translations, orientations, scales = (list(x) for x in zip(*components))
+        self.assertTrue(usdex.core.setLocalTransforms(prims, translations, orientations, scales, self.TIMES))
+
+        for prim in prims:
+            self.assertSuccessfulSetLocalTransform(prim)
+            self.assertValuesAuthoredForXformOpsAtTimes(UsdGeom.Xformable(prim), self.TIMES)
+            self.assertNoExtraneousXformOps(prim)
+        self.assertEqual(stage.GetEditTarget().GetLayer().ExportToString(), expectedStage.GetEditTarget().GetLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+        # A single prim is also supported
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        count = len(self.TIMES)
+        translations = [IDENTITY_TRANSLATE] * count
+        orientations = [IDENTITY_ORIENTATION] * count
+        scales = [IDENTITY_SCALE] * count
+        self.assertTrue(usdex.core.setLocalTransforms(prim, translations, orientations, scales, self.TIMES))
+        for time in self.TIMES:
+            self.assertEqual(usdex.core.getLocalTransformMatrix(prim, time), IDENTITY_MATRIX)
+
+    def testInvalidArguments(self):
+        stage = self._createTestStage()
+        prims = [stage.GetPrimAtPath("/Root/Xform"), stage.GetPrimAtPath("/Root/Animated_Matrix")]
+        layerContent = stage.GetEditTarget().GetLayer().ExportToString()
+
+        # The number of values must match the number of prims and times
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched number of matrices")]):
+            self.assertFalse(usdex.core.setLocalTransforms(prims, [IDENTITY_MATRIX] * 3, [Usd.TimeCode(0.0), Usd.TimeCode(1.0)]))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*mismatched number of orientations")]):
+            self.assertFalse(usdex.core.setLocalTransforms(prims, [IDENTITY_TRANSLATE] * 2, [IDENTITY_ORIENTATION], [IDENTITY_SCALE] * 2, [0.0]))
+
+        # Every prim must be xformable
+        prims.append(stage.GetPrimAtPath("/Root/Scope"))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*Scope.*not xformable")]):
+            self.assertFalse(usdex.core.setLocalTransforms(prims, [IDENTITY_MATRIX] * 3, [Usd.TimeCode(0.0)]))
+
+        # Nothing is authored on failure
+        self.assertEqual(stage.GetEditTarget().GetLayer().ExportToString(), layerContent)
+
+        # No times is a successful no-op
+        self.assertTrue(usdex.core.setLocalTransforms(prims[:2], [], []))
+        self.assertEqual(stage.GetEditTarget().GetLayer().ExportToString(), layerContent)
+
+
+class ComputeTransformComponentsTestCase(BaseXformTestCase):
+    def _createTestMatrices(self):
+        unsheared = Gf.Transform()
+        unsheared.SetScale(Gf.Vec3d(2.0, 3.0, 4.0))
+        unsheared.SetRotation(Gf.Rotation(Gf.Vec3d(1.0, 2.0, 3.0), 35.0))
+        unsheared.SetTranslation(Gf.Vec3d(10.0, 20.0, 30.0))
+
+        # A non-uniform scale within a pivot orientation produces a sheared matrix
+        sheared = Gf.Transform()
+        sheared.SetScale(Gf.Vec3d(1.0, 2.0, 3.0))
+        sheared.SetPivotOrientation(Gf.Rotation(Gf.Vec3d(0.0, 1.0, 0.0), 30.0))
+        sheared.SetRotation(Gf.Rotation(Gf.Vec3d(1.0, 0.0, 0.0), 45.0))
+
+        mirrored = Gf.Matrix4d().SetScale(Gf.Vec3d(-1.0, 1.0, 1.0))
+        mirrored.SetTranslateOnly(Gf.Vec3d(5.0, 0.0, 0.0))
+
+        return [IDENTITY_MATRIX, unsheared.GetMatrix(), sheared.GetMatrix(), mirrored]
+
+    def testMatchesPrimDecomposition(self):
+        # The decomposition of each matrix matches that of a prim holding the matrix
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        matrices = self._createTestMatrices()
+
+        translations, pivots, rotations, scales = usdex.core.computeTransformComponents(matrices)
+        for values in (translations, pivots, rotations, scales):
+            self.assertEqual(len(values), len(matrices))
+
+        quatTranslations, quatPivots, orientations, quatScales = usdex.core.computeTransformComponentsQuat(matrices)
+        for values in (quatTranslations, quatPivots, orientations, quatScales):
+            self.assertEqual(len(values), len(matrices))
+
+        for i, matrix in enumerate(matrices):
+            self.assertTrue(usdex.core.setLocalTransform(prim, matrix))
+
+            translation, pivot, rotation, rotationOrder, scale = usdex.core.getLocalTransformComponents(prim)
+            self.assertEqual(rotationOrder, usdex.core.RotationOrder.eXyz)
+            self.assertTrue(Gf.IsClose(translations[i], translation, 1e-6))
+            self.assertEqual(pivots[i], IDENTITY_TRANSLATE)
+            self.assertTrue(Gf.IsClose(rotations[i], rotation, 1e-4))
+            self.assertTrue(Gf.IsClose(scales[i], scale, 1e-5))
+
+            translation, pivot, orientation, scale = usdex.core.getLocalTransformComponentsQuat(prim)
+            self.assertTrue(Gf.IsClose(quatTranslations[i], translation, 1e-6))
+            self.assertEqual(quatPivots[i], IDENTITY_TRANSLATE)
+            self.assertAlmostEqual(abs(Gf.Dot(orientations[i], orientation)), 1.0, places=5)
+            self.assertTrue(Gf.IsClose(quatScales[i], scale, 1e-5))
+
+    def testRecomposesUnshearedMatrices(self):
+        # Composing the components of an unsheared matrix reproduces the matrix
+        stage = self._createTestStage()
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        matrices = [x for i, x in enumerate(self._createTestMatrices()) if i != 2]
+
+        translations, pivots, orientations, scales = usdex.core.computeTransformComponentsQuat(matrices)
+        for i, matrix in enumerate(matrices):
+            self.assertTrue(usdex.core.setLocalTransform(prim, translations[i], orientations[i], scales[i]))
+            self.assertTrue(Gf.IsClose(usdex.core.getLocalTransformMatrix(prim), matrix, 1e-5))
+
+    def testEmptyMatrices(self):
+        self.assertEqual(usdex.core.computeTransformComponents([]), ([], [], [], []))
+        self.assertEqual(usdex.core.computeTransformComponentsQuat([]), ([], [], [], []))
+
+
+class SetLocalTransformReuseTestCase(BaseXformTestCase):
+    def assertOnlyValuesChanged(self, stage, setter, expectedXformOpOrder):
+        prim = stage.GetPrimAtPath("/Root/Xform")
+        self.assertTrue(setter(prim, Usd.TimeCode.Default()))
+        self.assertEqual(UsdGeom.Xformable(prim).GetXformOpOrderAttr().Get(), expectedXformOpOrder)
+
+        # Re-authoring the same format only changes the values of the existing xformOps
+        notices = []
+        listener = Tf.Notice.Register(Usd.Notice.ObjectsChanged, lambda notice, sender: notices.append(notice), stage)
+        self.assertTrue(setter(prim, Usd.TimeCode(1.0)))
+        listener.Revoke()
+
+        self.assertGreater(len(notices), 0)
+        changedPaths = set()
+        for notice in notices:
+            self.assertEqual(list(notice.GetResyncedPaths()), [])
+            changedPaths.update(notice.GetChangedInfoOnlyPaths())
+        expectedPaths = set(prim.GetPath().AppendProperty(name) for name in expectedXformOpOrder if not name.startswith("!invert!"))
+        self.assertEqual(changedPaths, expectedPaths)
+        self.assertEqual(UsdGeom.Xformable(prim).GetXformOpOrderAttr().Get(), expectedXformOpOrder)
+        self.assertIsValidUsd(stage)
+
+    def testComponents(self):
+        stage = self._createTestStage()
+        self.assertOnlyValuesChanged(
+            stage,
+            lambda prim, time: usdex.core.setLocalTransform(prim, *NON_IDENTITY_COMPONENTS, time),
+            COMPONENT_XFORM_OP_ORDER,
+        )
+
+    def testComponentsWithOrientation(self):
+        stage = self._createTestStage()
+        self.assertOnlyValuesChanged(
+            stage,
+            lambda prim, time: usdex.core.setLocalTransform(prim, *NON_IDENTITY_COMPONENTS_WITH_ORIENTATION, time),
+            COMPONENT_WITH_ORIENTATION_XFORM_OP_ORDER,
+        )
+
+    def testTransformWithPivot(self):
+        stage = self._createTestStage()
+        transform = Gf.Transform()
+        transform.SetTranslation(NON_IDENTITY_TRANSLATE)
+        transform.SetPivotPosition(NON_IDENTITY_TRANSLATE)
+        transform.SetRotation(NON_IDENTITY_ROTATION)
+        self.assertOnlyValuesChanged(
+            stage,
+            lambda prim, time: usdex.core.setLocalTransform(prim, transform, time),
+            COMPONENT_XFORM_OP_ORDER,
+        )
+
+    def testMatrix(self):
+        stage = self._createTestStage()
+        self.assertOnlyValuesChanged(
+            stage,
+            lambda prim, time: usdex.core.setLocalTransform(prim, NON_IDENTITY_NO_PIVOT_MATRIX, time),
+            Vt.TokenArray(["xformOp:transform"]),
+        )
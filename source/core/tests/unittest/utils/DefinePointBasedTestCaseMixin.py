@@ -6,7 +6,7 @@ from abc import ABC, abstractmethod
 
 import omni.asset_validator
 import usdex.test
-from pxr import Gf, Sdf, Tf, UsdGeom, Vt
+from pxr import Gf, Sdf, Tf, Usd, UsdGeom, Vt
 
 
 class DefinePointBasedTestCaseMixin(ABC):
@@ -35,6 +35,26 @@ class DefinePointBasedTestCaseMixin(ABC):
         # The primvar should not be time sampled
         self.assertFalse(primvar.ValueMightBeTimeVarying())
 
+    def computeExpectedExtent(self, pointBased):
+        """Compute the extent expected of a define function, accounting for the widths primvar if one has been authored"""
+        widthsPrimvar = UsdGeom.PrimvarsAPI(pointBased).GetPrimvar(UsdGeom.Tokens.widths)
+        if not widthsPrimvar or not widthsPrimvar.HasAuthoredValue():
+            return UsdGeom.Boundable.ComputeExtentFromPlugins(pointBased, Usd.TimeCode.Default())
+
+        # Points are padded by their own width if there is one per point, otherwise by the largest width
+        points = pointBased.GetPointsAttr().Get()
+        widths = widthsPrimvar.ComputeFlattened()
+        if len(widths) == len(points):
+            radii = [width * 0.5 for width in widths]
+        else:
+            radii = [max(widths, default=0.0) * 0.5] * len(points)
+
+        bounds = Gf.Range3f()
+        for point, radius in zip(points, radii):
+            bounds.UnionWith(point - Gf.Vec3f(radius))
+            bounds.UnionWith(point + Gf.Vec3f(radius))
+        return Vt.Vec3fArray([bounds.GetMin(), bounds.GetMax()])
+
     def testNormals(self):
         # Normals are optional but if provided will be authored as primvar
         stage = self.createTestStage()
@@ -6,12 +6,21 @@
 
 #include "usdex/core/StageAlgo.h"
 
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/editTarget.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 #include <pxr/usd/usdShade/tokens.h>
 #include <pxr/usd/usdUtils/pipeline.h>
 
+#include <utility>
+#include <vector>
+
 using namespace pxr;
 
 namespace
@@ -55,6 +64,8 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((omniGlassColor, "glass_color"))
     ((omniGlassIor, "glass_ior"))
     ((usdPreviewSurface, "UsdPreviewSurface"))
+    ((previewSurfaceName, "PreviewSurface"))
+    ((mdlShaderName, "MDLShader"))
     ((usdPreviewSurfaceColor, "diffuseColor"))
     ((usdPreviewSurfaceFile, "file"))
     ((usdPreviewSurfaceIor, "ior"))
@@ -84,6 +95,9 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((materialRoughnessTexture, "RoughnessTexture"))
     ((materialMetallicTexture, "MetallicTexture"))
     ((materialEmissiveTexture, "EmissiveTexture"))
+    // Whole property names used when patching the specs of a prototype material
+    ((omniPbrOpacityEnabledInputs, "inputs:enable_opacity"))
+    ((materialIorInputs, "inputs:ior"))
 );
 
 void setFractionalOpacity(UsdStagePtr stage, bool isOn = true)
@@ -99,6 +113,159 @@ void setFractionalOpacity(UsdStagePtr stage, bool isOn = true)
     stage->GetRootLayer()->SetCustomLayerData(cld);
 }
 
+// The path of the prototype of each kind of material, within the layer returned by getMaterialPrototypes(), is named after its MDL module
+SdfPath getPrototypePath(const TfToken& module)
+{
+    return SdfPath::AbsoluteRootPath().AppendChild(module);
+}
+
+// A layer holding the specs of an OmniPBR and an OmniGlass material, authored once with default values via the regular define functions
+const SdfLayerRefPtr& getMaterialPrototypes()
+{
+    static const SdfLayerRefPtr s_prototypes = []()
+    {
+        UsdStageRefPtr stage = UsdStage::CreateInMemory();
+        usdex::rtx::definePbrMaterial(stage, ::getPrototypePath(_tokens->omniPbr), GfVec3f(0.2f), 1.0f, 0.5f, 0.0f);
+        usdex::rtx::defineGlassMaterial(stage, ::getPrototypePath(_tokens->omniGlass), GfVec3f(1.0f), 1.491f);
+        return stage->GetRootLayer();
+    }();
+    return s_prototypes;
+}
+
+// A value which differs from the prototype, authored relative to the material prim (or to one of its shaders)
+struct PrototypeValue
+{
+    TfToken shaderName;
+    TfToken propertyName;
+    SdfValueTypeName typeName;
+    VtValue value;
+};
+
+// Whether a new material should be authored by copying a prototype, rather than via the UsdShade API
+//
+// Prototypes are only used in the bulk authoring mode, and never replace an existing prim spec on the edit target layer, as copying a spec
+// would discard all of its existing opinions.
+bool shouldClonePrototype(UsdStagePtr stage, const SdfPath& path)
+{
+    if (!usdex::core::BulkAuthoringScope::isActive(stage) || !path.IsAbsoluteRootOrPrimPath())
+    {
+        return false;
+    }
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    return !editTarget.GetLayer()->GetPrimAtPath(editTarget.MapToSpecPath(path));
+}
+
+// Author typeless def specs for any ancestors of a prim spec path which do not yet exist on the layer, matching the ancestors which the
+// regular define functions would author
+//
+// The highest authored ancestor is returned via authoredRoot, which is empty if all ancestors already existed. Variant selections are created
+// as required by Sdf, as they cannot be authored as typeless defs.
+bool defineUndefinedAncestors(const SdfLayerHandle& layer, const SdfPath& specPath, SdfPath* authoredRoot)
+{
+    *authoredRoot = SdfPath();
+    SdfPrimSpecHandle parentSpec = layer->GetPseudoRoot();
+    for (const SdfPath& ancestor : specPath.GetParentPath().GetPrefixes())
+    {
+        SdfPrimSpecHandle spec = layer->GetPrimAtPath(ancestor);
+        if (!spec)
+        {
+            spec = ancestor.IsPrimVariantSelectionPath() ? SdfCreatePrimInLayer(layer, ancestor)
+                                                         : SdfPrimSpec::New(parentSpec, ancestor.GetName(), SdfSpecifierDef);
+            if (!spec)
+            {
+                return false;
+            }
+            if (authoredRoot->IsEmpty())
+            {
+                *authoredRoot = ancestor;
+            }
+        }
+        parentSpec = spec;
+    }
+    return true;
+}
+
+// Remove a prim spec, along with all of its descendants, from a layer
+void removePrimSpec(const SdfLayerHandle& layer, const SdfPath& specPath)
+{
+    // Variant specs are owned by their variant set rather than a parent prim, so they are left in place
+    SdfPrimSpecHandle spec = layer->GetPrimAtPath(specPath);
+    if (!spec || specPath.IsPrimVariantSelectionPath())
+    {
+        return;
+    }
+    const SdfPath parentPath = specPath.GetParentPath();
+    SdfPrimSpecHandle parentSpec = parentPath.IsAbsoluteRootPath() ? layer->GetPseudoRoot() : layer->GetPrimAtPath(parentPath);
+    if (parentSpec)
+    {
+        parentSpec->RemoveNameChild(spec);
+    }
+}
+
+// Copy the specs of a prototype material to the edit target layer, then author the values which differ from the prototype
+//
+// The specs are identical to those authored by the regular define functions. Connections within the prototype are remapped to the new material
+// by SdfCopySpec. On failure, any specs authored by this function are removed from the layer.
+UsdShadeMaterial clonePrototype(UsdStagePtr stage, const SdfPath& path, const SdfPath& prototypePath, const std::vector<PrototypeValue>& values)
+{
+    const UsdEditTarget& editTarget = stage->GetEditTarget();
+    const SdfLayerHandle& layer = editTarget.GetLayer();
+    const SdfPath specPath = editTarget.MapToSpecPath(path);
+    {
+        SdfChangeBlock changeBlock;
+        SdfPath authoredRoot;
+        const auto fail = [&]()
+        {
+            ::removePrimSpec(layer, authoredRoot.IsEmpty() ? specPath : authoredRoot);
+            return UsdShadeMaterial();
+        };
+
+        if (!::defineUndefinedAncestors(layer, specPath, &authoredRoot) || !SdfCopySpec(::getMaterialPrototypes(), prototypePath, layer, specPath))
+        {
+            TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial at \"%s\"", path.GetAsString().c_str());
+            return fail();
+        }
+
+        for (const PrototypeValue& entry : values)
+        {
+            const SdfPath primPath = entry.shaderName.IsEmpty() ? specPath : specPath.AppendChild(entry.shaderName);
+            SdfAttributeSpecHandle attr = layer->GetAttributeAtPath(primPath.AppendProperty(entry.propertyName));
+            if (!attr)
+            {
+                attr = SdfAttributeSpec::New(layer->GetPrimAtPath(primPath), entry.propertyName, entry.typeName, SdfVariabilityVarying, false);
+            }
+            if (!attr || !attr->SetDefaultValue(entry.value))
+            {
+                TF_RUNTIME_ERROR(
+                    "Unable to define UsdShadeMaterial at \"%s\" due to a failure authoring <%s>",
+                    path.GetAsString().c_str(),
+                    primPath.AppendProperty(entry.propertyName).GetAsString().c_str()
+                );
+                return fail();
+            }
+        }
+    }
+
+    // The change block has closed, so the stage has recomposed the new material
+    return UsdShadeMaterial(stage->GetPrimAtPath(path));
+}
+
+// Validate a shader parameter which must be within [0, 1], matching the validation of usdex::core::definePreviewMaterial
+bool isValidUnitParameter(const SdfPath& path, const char* name, float value)
+{
+    if (value < 0.0 || value > 1.0)
+    {
+        const std::string reason = TfStringPrintf("%s value %f is outside range [0.0 - 1.0].", name, value);
+        TF_RUNTIME_ERROR(
+            "Unable to define UsdShadeMaterial at \"%s\" due to an invalid shader parameter value: %s",
+            path.GetAsString().c_str(),
+            reason.c_str()
+        );
+        return false;
+    }
+    return true;
+}
+
 // Remove a property from a prim within the current edit target
 // This is used for removing input properties from shaders and materials
 bool removeProperty(UsdStageRefPtr stage, const SdfPath& primPath, const TfToken& propName)
@@ -144,13 +311,13 @@ bool removeProperty(UsdStageRefPtr stage, const SdfPath& primPath, const TfToken
 // All texture parameters require a sampling mode, or "colorSpace"
 UsdShadeInput createMaterialLinkedMdlFileInput(
     UsdShadeMaterial& materialPrim,
+    UsdShadeShader& shaderPrim,
     const TfToken& materialInputName,
     const TfToken& shaderInputName,
     const SdfAssetPath& filePath,
     const TfToken& colorSpace
 )
 {
-    UsdShadeShader shaderPrim = usdex::rtx::computeEffectiveMdlSurfaceShader(materialPrim);
     UsdShadeInput matTextureInput = materialPrim.CreateInput(materialInputName, SdfValueTypeNames->Asset);
     matTextureInput.Set(filePath);
     // MDL render context requires that the color space (sampling mode) be an attribute on the file attribute
@@ -161,7 +328,8 @@ UsdShadeInput createMaterialLinkedMdlFileInput(
     return matTextureInput;
 }
 
-bool verifyValidOmniPbrMaterial(UsdShadeMaterial& material)
+// Check that a material has MDL & USD Preview Surface shaders, returning each of them if they are valid
+bool verifyValidOmniPbrMaterial(UsdShadeMaterial& material, UsdShadeShader& mdlShaderOut, UsdShadeShader& psShaderOut)
 {
     if (!material)
     {
@@ -180,11 +348,18 @@ bool verifyValidOmniPbrMaterial(UsdShadeMaterial& material)
         TF_WARN("UsdShadeMaterial <%s> does not have a valid MDL Shader", material.GetPath().GetAsString().c_str());
         return false;
     }
+    mdlShaderOut = mdlShader;
+    psShaderOut = psShader;
     return true;
 }
 
-// Common function to check that a material has an OmniPBR-based MDL & USD Preview Surface shaders
-bool verifyValidOmniPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+// Common function to check that a material has an OmniPBR-based MDL & USD Preview Surface shaders, returning each of them if they are valid
+bool verifyValidOmniPbrMaterial(
+    UsdShadeMaterial& material,
+    const SdfAssetPath& texturePath,
+    UsdShadeShader& mdlShaderOut,
+    UsdShadeShader& psShaderOut
+)
 {
     if (!material)
     {
@@ -228,9 +403,63 @@ bool verifyValidOmniPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath&
         );
         return false;
     }
+    mdlShaderOut = mdlShader;
+    psShaderOut = psShader;
     return true;
 }
 
+// Create an input on the MDL shader of a material, replacing any existing input of a different type or disconnecting any existing source
+UsdShadeInput createShaderInput(
+    const UsdShadeMaterial& material,
+    UsdShadeShader& shaderPrim,
+    const TfToken& name,
+    const VtValue& value,
+    const SdfValueTypeName& typeName,
+    std::optional<const usdex::core::ColorSpace> colorSpace = std::nullopt
+)
+{
+    UsdShadeInput existingInput = shaderPrim.GetInput(name);
+    if (existingInput && existingInput.GetTypeName() != typeName)
+    {
+        if (!::removeProperty(shaderPrim.GetPrim().GetStage(), shaderPrim.GetPrim().GetPath(), existingInput.GetFullName()))
+        {
+            TF_RUNTIME_ERROR(
+                "Unable to create UsdShadeInput <%s> in material <%s> because input already exists as type <%s> in another layer",
+                name.GetText(),
+                material.GetPath().GetAsString().c_str(),
+                existingInput.GetTypeName().GetAsToken().GetText()
+            );
+            return UsdShadeInput();
+        }
+    }
+    else if (existingInput && existingInput.HasConnectedSource())
+    {
+        if (!existingInput.DisconnectSource())
+        {
+            TF_WARN(
+                "Failure disconnecting the existing source in UsdShadeInput <%s> in material <%s>",
+                name.GetText(),
+                material.GetPath().GetAsString().c_str()
+            );
+        }
+    }
+
+    UsdShadeInput surfaceInput = shaderPrim.CreateInput(name, typeName);
+    if (!surfaceInput)
+    {
+        TF_RUNTIME_ERROR("Unable to create UsdShadeInput <%s> in material <%s>", name.GetText(), material.GetPath().GetAsString().c_str());
+        return UsdShadeInput();
+    }
+
+    surfaceInput.Set(value);
+    const UsdAttribute& attr = surfaceInput.GetAttr();
+    if (colorSpace.has_value())
+    {
+        attr.SetColorSpace(usdex::core::getColorSpaceToken(colorSpace.value()));
+    }
+    return surfaceInput;
+}
+
 //! A utility struct to pass shader input names and values to a function
 struct TfTokenValuePair
 {
@@ -259,6 +488,8 @@ struct TfTokenValuePair
 //!   |-- input file (asset, connected to mat input)
 //! ---------------------------------------------------------------------------------------------------------------//!
 //! @param material The UsdShadeMaterial prim to add the texture
+//! @param mdlShader The MDL Shader of the material
+//! @param previewSurface The USD Preview Surface Shader of the material
 //! @param texturePath The SdfAssetPath to the texture file
 //! @param matValueToken The Material input name to remove, will be read to grab the fallback value
 //! @param matValueInputsToken The Material input name to remove (with "inputs:" prepended)
@@ -271,6 +502,8 @@ struct TfTokenValuePair
 //! @returns Whether or not the texture was added to the material
 bool addSingleChannelTextureToPbrMaterial(
     UsdShadeMaterial& material,
+    UsdShadeShader& mdlShader,
+    UsdShadeShader& previewSurface,
     const SdfAssetPath& texturePath,
     const TfToken& matValueToken,
     const TfToken& matValueInputsToken,
@@ -288,18 +521,19 @@ bool addSingleChannelTextureToPbrMaterial(
     if (input)
     {
         input.Get<float>(&channelValue);
-        usdex::rtx::createMdlShaderInput(material, omniPbrFallbackValueToken, VtValue(channelValue), SdfValueTypeNames->Float);
+        ::createShaderInput(material, mdlShader, omniPbrFallbackValueToken, VtValue(channelValue), SdfValueTypeNames->Float);
         ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), matValueInputsToken);
     }
 
     // These need to be set for MDL to use this type texture file
     for (const TfTokenValuePair& pair : omniPbrInputValues)
     {
-        usdex::rtx::createMdlShaderInput(material, pair.inputName, pair.value, pair.valueTypeName);
+        ::createShaderInput(material, mdlShader, pair.inputName, pair.value, pair.valueTypeName);
     }
 
     UsdShadeInput matTextureInput = ::createMaterialLinkedMdlFileInput(
         material,
+        mdlShader,
         matTextureInputToken,
         omniPbrTextureToken,
         texturePath,
@@ -308,342 +542,85 @@ bool addSingleChannelTextureToPbrMaterial(
 
     // Connect the texture shader to the material interface. Note this makes unchecked assumptions about the behavior of `definePreviewMaterial`
     // and `add*TextureToPreviewMaterial` in the core library. If those implementations change, this code needs to be adjusted to match.
-    UsdShadeShader previewSurface = usdex::core::computeEffectivePreviewSurfaceShader(material);
     UsdShadeConnectionSourceInfo info = previewSurface.GetInput(usdShaderInputToken).GetConnectedSources()[0];
     info.source.GetInput(_tokens->usdPreviewSurfaceFile).ConnectToSource(matTextureInput);
 
     return true;
 }
 
-} // namespace
-
-UsdShadeShader usdex::rtx::createMdlShader(
-    UsdShadeMaterial& material,
-    const std::string& name,
-    const SdfAssetPath& mdlPath,
-    const TfToken& module,
-    bool connectMaterialOutputs
-)
+// Validate the emissive color & intensity of a PBR material, prior to authoring either of them
+bool isValidEmissiveColor(const SdfPath& path, const GfVec3f& color, const float intensity)
 {
-    UsdPrim materialPrim = material.GetPrim();
-
-    // Early out if the proposed prim location is invalid
-    std::string reason;
-    if (!usdex::core::isEditablePrimLocation(materialPrim, name, &reason))
+    if (color[0] < 0.0 || color[1] < 0.0 || color[2] < 0.0)
     {
-        TF_WARN("Unable to create UsdShadeShader due to an invalid location: %s", reason.c_str());
-        return UsdShadeShader();
+        const std::string reason = TfStringPrintf(
+            "Color value (%g, %g, %g) is invalid: each component must be at least 0 (no upper bound).",
+            color[0],
+            color[1],
+            color[2]
+        );
+        TF_RUNTIME_ERROR(
+            "Unable to add emissive color to PBR material at \"%s\" due to an invalid shader parameter value: %s",
+            path.GetAsString().c_str(),
+            reason.c_str()
+        );
+        return false;
     }
-
-    SdfPath shaderPath = materialPrim.GetPath().AppendChild(TfToken(name));
-    UsdStagePtr stage = materialPrim.GetStage();
-
-    UsdShadeShader shader = UsdShadeShader::Define(stage, shaderPath);
-    shader.SetSourceAsset(mdlPath, _tokens->mdl);
-    shader.SetSourceAssetSubIdentifier(module, _tokens->mdl);
-    if (connectMaterialOutputs)
+    if (intensity < 0.0)
     {
-        UsdShadeOutput shaderOutput = shader.CreateOutput(_tokens->out, SdfValueTypeNames->Token);
-        material.CreateSurfaceOutput(_tokens->mdl).ConnectToSource(shaderOutput);
-        material.CreateVolumeOutput(_tokens->mdl).ConnectToSource(shaderOutput);
-        material.CreateDisplacementOutput(_tokens->mdl).ConnectToSource(shaderOutput);
+        const std::string reason = TfStringPrintf("Intensity value %g is invalid: must be at least 0.0 (no upper bound).", intensity);
+        TF_RUNTIME_ERROR(
+            "Unable to add emissive color to PBR material at \"%s\" due to an invalid shader parameter value: %s",
+            path.GetAsString().c_str(),
+            reason.c_str()
+        );
+        return false;
     }
-    return shader;
+    return true;
 }
 
-UsdShadeInput usdex::rtx::createMdlShaderInput(
-    UsdShadeMaterial& material,
-    const TfToken& name,
-    const VtValue& value,
-    const SdfValueTypeName& typeName,
-    std::optional<const usdex::core::ColorSpace> colorSpace
-)
+// The add*ToPbrMaterial functions below author onto the shaders of a material which has already been verified by the caller. This allows the
+// PbrMaterialBuilder to resolve & verify the shaders once, regardless of how many textures are added.
+
+bool addEmissiveColor(UsdShadeMaterial& material, UsdShadeShader& mdlShader, UsdShadeShader& previewShader, const GfVec3f& color, float intensity)
 {
-    if (!material)
+    if (!usdex::core::addEmissiveColorToPreviewMaterial(material, color))
     {
-        TF_WARN("Invalid UsdShadeMaterial, cannot create MDL shader input <%s>", name.GetText());
-        return UsdShadeInput();
+        // Do not report the reason as the function we called will have already logged the diagnostic for us.
+        return false;
     }
 
-    UsdShadeShader shaderPrim = usdex::rtx::computeEffectiveMdlSurfaceShader(material);
-    if (!shaderPrim)
-    {
-        TF_WARN("Cannot create MDL shader input, no MDL shader found in UsdShadeMaterial <%s>", material.GetPath().GetAsString().c_str());
-        return UsdShadeInput();
-    }
+    // Expose inputs on the material that will be connected to the corresponding inputs on the surface shaders
+    // This acts as a Material interface from which value changes will be reflected across multiple renderers
+    UsdShadeInput materialEmissiveColorInput = material.CreateInput(_tokens->materialEmissiveColor, SdfValueTypeNames->Color3f);
+    UsdShadeInput materialEmissiveEnableInput = material.CreateInput(_tokens->materialEmissiveEnable, SdfValueTypeNames->Bool);
+    UsdShadeInput materialEmissiveIntensityInput = material.CreateInput(_tokens->materialEmissiveIntensity, SdfValueTypeNames->Float);
 
-    UsdShadeInput existingInput = shaderPrim.GetInput(name);
-    if (existingInput && existingInput.GetTypeName() != typeName)
-    {
-        if (!::removeProperty(shaderPrim.GetPrim().GetStage(), shaderPrim.GetPrim().GetPath(), existingInput.GetFullName()))
-        {
-            TF_RUNTIME_ERROR(
-                "Unable to create UsdShadeInput <%s> in material <%s> because input already exists as type <%s> in another layer",
-                name.GetText(),
-                material.GetPath().GetAsString().c_str(),
-                existingInput.GetTypeName().GetAsToken().GetText()
-            );
-            return UsdShadeInput();
-        }
-    }
-    else if (existingInput && existingInput.HasConnectedSource())
-    {
-        if (!existingInput.DisconnectSource())
-        {
-            TF_WARN(
-                "Failure disconnecting the existing source in UsdShadeInput <%s> in material <%s>",
-                name.GetText(),
-                material.GetPath().GetAsString().c_str()
-            );
-        }
-    }
+    // Set the default metadata on the material interface
+    materialEmissiveColorInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(GfVec3f(1.0f, 0.1f, 0.1f)));
+    materialEmissiveEnableInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(false));
+    materialEmissiveIntensityInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(40.0f));
 
-    UsdShadeInput surfaceInput = shaderPrim.CreateInput(name, typeName);
-    if (!surfaceInput)
-    {
-        TF_RUNTIME_ERROR("Unable to create UsdShadeInput <%s> in material <%s>", name.GetText(), material.GetPath().GetAsString().c_str());
-        return UsdShadeInput();
-    }
+    // Set the supplied values on the material interface
+    materialEmissiveColorInput.Set(color);
+    materialEmissiveEnableInput.Set(true);
+    materialEmissiveIntensityInput.Set(intensity);
 
-    surfaceInput.Set(value);
-    const UsdAttribute& attr = surfaceInput.GetAttr();
-    if (colorSpace.has_value())
-    {
-        attr.SetColorSpace(usdex::core::getColorSpaceToken(colorSpace.value()));
-    }
-    return surfaceInput;
+    // Create MDL shader inputs to produce a physically based rendering result with the supplied values
+    // Inputs are either set or connected to the material interface
+    mdlShader.CreateInput(_tokens->omniPbrEmissiveColor, SdfValueTypeNames->Color3f).ConnectToSource(materialEmissiveColorInput);
+    mdlShader.CreateInput(_tokens->omniPbrEmissiveEnableEmission, SdfValueTypeNames->Bool).ConnectToSource(materialEmissiveEnableInput);
+    mdlShader.CreateInput(_tokens->omniPbrEmissiveIntensity, SdfValueTypeNames->Float).ConnectToSource(materialEmissiveIntensityInput);
+
+    // Create preview shader inputs to produce a physically based rendering result with the supplied values
+    previewShader.CreateInput(_tokens->usdPreviewSurfaceEmissiveColor, SdfValueTypeNames->Color3f).ConnectToSource(materialEmissiveColorInput);
+
+    return true;
 }
 
-UsdShadeShader usdex::rtx::computeEffectiveMdlSurfaceShader(const UsdShadeMaterial& material)
+bool addDiffuseTexture(UsdShadeMaterial& material, UsdShadeShader& mdlShader, UsdShadeShader& previewSurface, const SdfAssetPath& texturePath)
 {
-    if (!material)
-    {
-        return UsdShadeShader();
-    }
-
-    return material.ComputeSurfaceSource({ _tokens->mdl });
-}
-
-UsdShadeMaterial usdex::rtx::definePbrMaterial(
-    UsdStagePtr stage,
-    const SdfPath& path,
-    const GfVec3f& color,
-    const float opacity,
-    const float roughness,
-    const float metallic
-)
-{
-    // Define the Preview Material first, as it validates the same set of criteria
-    UsdShadeMaterial material = usdex::core::definePreviewMaterial(stage, path, color, opacity, roughness, metallic);
-    if (!material)
-    {
-        // Do not report the reason as the function we called will have already logged the diagnostic for us.
-        return UsdShadeMaterial();
-    }
-
-    // Define the surface shader to be used in the "mdl" rendering context
-    static constexpr const char* s_mdlShaderName = "MDLShader";
-    static const SdfAssetPath s_mdlAssetPath = SdfAssetPath(g_omniPbrAssetPath);
-    UsdShadeShader mdlShader = usdex::rtx::createMdlShader(material, s_mdlShaderName, s_mdlAssetPath, _tokens->omniPbr);
-    if (!mdlShader)
-    {
-        TF_RUNTIME_ERROR("Unable to define UsdShadeShader named \"%s\" as a child of \"%s\"", s_mdlShaderName, path.GetAsString().c_str());
-        return UsdShadeMaterial();
-    }
-
-    // Expose inputs on the material that will be connected to the corresponding inputs on the surface shaders
-    // This acts as a Material interface from which value changes will be reflected across multiple renderers
-    UsdShadeInput materialColorInput = material.CreateInput(_tokens->materialColor, SdfValueTypeNames->Color3f);
-    UsdShadeInput materialOpacityInput = material.CreateInput(_tokens->materialOpacity, SdfValueTypeNames->Float);
-    UsdShadeInput materialRoughnessInput = material.CreateInput(_tokens->materialRoughness, SdfValueTypeNames->Float);
-    UsdShadeInput materialMetallicInput = material.CreateInput(_tokens->materialMetallic, SdfValueTypeNames->Float);
-
-    // Set the min, max and default metadata on the material interface
-    // We would copy this metadata from the connected MDL shader inputs, however the Sdr registry for MDL shaders may not be available.
-    // Instead we author the same values that are enforced within this function.
-    materialColorInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(GfVec3f(0.2f, 0.2f, 0.2f)));
-
-    materialOpacityInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(1.0f));
-    materialOpacityInput.GetAttr().SetCustomDataByKey(_tokens->rangeMin, VtValue(0.0f));
-    materialOpacityInput.GetAttr().SetCustomDataByKey(_tokens->rangeMax, VtValue(1.0f));
-
-    materialRoughnessInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(0.5f));
-    materialRoughnessInput.GetAttr().SetCustomDataByKey(_tokens->rangeMin, VtValue(0.0f));
-    materialRoughnessInput.GetAttr().SetCustomDataByKey(_tokens->rangeMax, VtValue(1.0f));
-
-    materialMetallicInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(0.0f));
-    materialMetallicInput.GetAttr().SetCustomDataByKey(_tokens->rangeMin, VtValue(0.0f));
-    materialMetallicInput.GetAttr().SetCustomDataByKey(_tokens->rangeMax, VtValue(1.0f));
-
-    // Set the supplied values on the material interface
-    materialColorInput.Set(color);
-    materialOpacityInput.Set(opacity);
-    materialRoughnessInput.Set(roughness);
-    materialMetallicInput.Set(metallic);
-
-    // Create MDL shader inputs to produce a physically based rendering result with the supplied values
-    // Inputs are either set or connected to the material interface
-    mdlShader.CreateInput(_tokens->omniPbrAlbedoColor, SdfValueTypeNames->Color3f).ConnectToSource(materialColorInput);
-    mdlShader.CreateInput(_tokens->omniPbrOpacity, SdfValueTypeNames->Float).ConnectToSource(materialOpacityInput);
-    mdlShader.CreateInput(_tokens->omniPbrRoughness, SdfValueTypeNames->Float).ConnectToSource(materialRoughnessInput);
-    mdlShader.CreateInput(_tokens->omniPbrMetallic, SdfValueTypeNames->Float).ConnectToSource(materialMetallicInput);
-
-    // Enable opacity and set the required render settings if the material is not fully opaque
-    if (opacity < 1.0f)
-    {
-        mdlShader.CreateInput(_tokens->omniPbrOpacityEnabled, SdfValueTypeNames->Bool).Set(true);
-        setFractionalOpacity(stage);
-    }
-
-    // Create default shader inputs to produce a physically based rendering result with the supplied values. Note these will have already been
-    // created when we called `definePreviewMaterial`. Since `CreateInput` will Get if it already exists, it is safe to call here, and protects
-    // us incase the underlying implementation stops creating these directly.
-    UsdShadeShader previewShader = usdex::core::computeEffectivePreviewSurfaceShader(material);
-    previewShader.CreateInput(_tokens->usdPreviewSurfaceColor, SdfValueTypeNames->Color3f).ConnectToSource(materialColorInput);
-    previewShader.CreateInput(_tokens->usdPreviewSurfaceOpacity, SdfValueTypeNames->Float).ConnectToSource(materialOpacityInput);
-    previewShader.CreateInput(_tokens->usdPreviewSurfaceRoughness, SdfValueTypeNames->Float).ConnectToSource(materialRoughnessInput);
-    previewShader.CreateInput(_tokens->usdPreviewSurfaceMetallic, SdfValueTypeNames->Float).ConnectToSource(materialMetallicInput);
-
-    return material;
-}
-
-UsdShadeMaterial usdex::rtx::definePbrMaterial(
-    UsdPrim parent,
-    const std::string& name,
-    const GfVec3f& color,
-    const float opacity,
-    const float roughness,
-    const float metallic
-)
-{
-    // Early out if the proposed prim location is invalid
-    std::string reason;
-    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
-    {
-        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
-        return UsdShadeMaterial();
-    }
-
-    // Call overloaded function
-    UsdStageWeakPtr stage = parent.GetStage();
-    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
-    return usdex::rtx::definePbrMaterial(stage, path, color, opacity, roughness, metallic);
-}
-
-UsdShadeMaterial usdex::rtx::definePbrMaterial(UsdPrim prim, const GfVec3f& color, const float opacity, const float roughness, const float metallic)
-{
-    // Early out if the prim is not valid
-    if (!prim)
-    {
-        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial on invalid prim");
-        return UsdShadeMaterial();
-    }
-
-    TfToken originalType = prim.GetTypeName();
-    // Material is NOT Xformable, so check if converting from Xform to non-Xformable
-    if (originalType == pxr::UsdGeomTokens->Xform)
-    {
-        TF_RUNTIME_ERROR(
-            "Cannot redefine at \"%s\" from \"Xform\" to \"Material\" because Material is not Xformable",
-            prim.GetPath().GetAsString().c_str()
-        );
-        return UsdShadeMaterial();
-    }
-
-    // Warn if converting from non-Scope prims
-    if (originalType != pxr::UsdGeomTokens->Scope && !originalType.IsEmpty())
-    {
-        TF_WARN(
-            "Redefining prim at \"%s\" from type \"%s\" to \"Material\". Expected original type to be \"\" or \"Scope\".",
-            prim.GetPath().GetAsString().c_str(),
-            originalType.GetText()
-        );
-    }
-
-    // Call the stage/path version
-    UsdStageWeakPtr stage = prim.GetStage();
-    const SdfPath& path = prim.GetPath();
-    return usdex::rtx::definePbrMaterial(stage, path, color, opacity, roughness, metallic);
-}
-
-bool usdex::rtx::addEmissiveColorToPbrMaterial(UsdShadeMaterial& material, const GfVec3f& color, const float intensity)
-{
-    if (!verifyValidOmniPbrMaterial(material))
-    {
-        return false;
-    }
-
-    if (color[0] < 0.0 || color[1] < 0.0 || color[2] < 0.0)
-    {
-        const std::string reason = TfStringPrintf(
-            "Color value (%g, %g, %g) is invalid: each component must be at least 0 (no upper bound).",
-            color[0],
-            color[1],
-            color[2]
-        );
-        TF_RUNTIME_ERROR(
-            "Unable to add emissive color to PBR material at \"%s\" due to an invalid shader parameter value: %s",
-            material.GetPath().GetAsString().c_str(),
-            reason.c_str()
-        );
-        return false;
-    }
-    if (intensity < 0.0)
-    {
-        const std::string reason = TfStringPrintf("Intensity value %g is invalid: must be at least 0.0 (no upper bound).", intensity);
-        TF_RUNTIME_ERROR(
-            "Unable to add emissive color to PBR material at \"%s\" due to an invalid shader parameter value: %s",
-            material.GetPath().GetAsString().c_str(),
-            reason.c_str()
-        );
-        return false;
-    }
-
-    if (!usdex::core::addEmissiveColorToPreviewMaterial(material, color))
-    {
-        // Do not report the reason as the function we called will have already logged the diagnostic for us.
-        return false;
-    }
-
-    UsdShadeShader mdlShader = usdex::rtx::computeEffectiveMdlSurfaceShader(material);
-
-    // Expose inputs on the material that will be connected to the corresponding inputs on the surface shaders
-    // This acts as a Material interface from which value changes will be reflected across multiple renderers
-    UsdShadeInput materialEmissiveColorInput = material.CreateInput(_tokens->materialEmissiveColor, SdfValueTypeNames->Color3f);
-    UsdShadeInput materialEmissiveEnableInput = material.CreateInput(_tokens->materialEmissiveEnable, SdfValueTypeNames->Bool);
-    UsdShadeInput materialEmissiveIntensityInput = material.CreateInput(_tokens->materialEmissiveIntensity, SdfValueTypeNames->Float);
-
-    // Set the default metadata on the material interface
-    materialEmissiveColorInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(GfVec3f(1.0f, 0.1f, 0.1f)));
-    materialEmissiveEnableInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(false));
-    materialEmissiveIntensityInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(40.0f));
-
-    // Set the supplied values on the material interface
-    materialEmissiveColorInput.Set(color);
-    materialEmissiveEnableInput.Set(true);
-    materialEmissiveIntensityInput.Set(intensity);
-
-    // Create MDL shader inputs to produce a physically based rendering result with the supplied values
-    // Inputs are either set or connected to the material interface
-    mdlShader.CreateInput(_tokens->omniPbrEmissiveColor, SdfValueTypeNames->Color3f).ConnectToSource(materialEmissiveColorInput);
-    mdlShader.CreateInput(_tokens->omniPbrEmissiveEnableEmission, SdfValueTypeNames->Bool).ConnectToSource(materialEmissiveEnableInput);
-    mdlShader.CreateInput(_tokens->omniPbrEmissiveIntensity, SdfValueTypeNames->Float).ConnectToSource(materialEmissiveIntensityInput);
-
-    // Create preview shader inputs to produce a physically based rendering result with the supplied values
-    UsdShadeShader previewShader = usdex::core::computeEffectivePreviewSurfaceShader(material);
-    previewShader.CreateInput(_tokens->usdPreviewSurfaceEmissiveColor, SdfValueTypeNames->Color3f).ConnectToSource(materialEmissiveColorInput);
-
-    return true;
-}
-
-bool usdex::rtx::addDiffuseTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
-{
-    if (!verifyValidOmniPbrMaterial(material, texturePath))
-    {
-        return false;
-    }
-
-    if (!usdex::core::addDiffuseTextureToPreviewMaterial(material, texturePath))
+    if (!usdex::core::addDiffuseTextureToPreviewMaterial(material, texturePath))
     {
         // Do not report the reason as the function we called will have already logged the diagnostic for us.
         return false;
@@ -656,11 +633,12 @@ bool usdex::rtx::addDiffuseTextureToPbrMaterial(UsdShadeMaterial& material, cons
     if (matColorInput)
     {
         matColorInput.Get<GfVec3f>(&color);
-        createMdlShaderInput(material, _tokens->omniPbrAlbedoColor, VtValue(color), SdfValueTypeNames->Color3f);
+        ::createShaderInput(material, mdlShader, _tokens->omniPbrAlbedoColor, VtValue(color), SdfValueTypeNames->Color3f);
         ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), _tokens->materialColorInputs);
     }
     UsdShadeInput matTextureInput = ::createMaterialLinkedMdlFileInput(
         material,
+        mdlShader,
         _tokens->materialDiffuseTexture,
         _tokens->omniPbrDiffuseTexture,
         texturePath,
@@ -669,20 +647,14 @@ bool usdex::rtx::addDiffuseTextureToPbrMaterial(UsdShadeMaterial& material, cons
 
     // Connect the texture shader to the material interface. Note this makes unchecked assumptions about the behavior of `definePreviewMaterial`
     // and `addDiffuseTextureToPreviewMaterial` in the core library. If those implementations change, this code needs to be adjusted to match.
-    UsdShadeShader previewSurface = usdex::core::computeEffectivePreviewSurfaceShader(material);
     UsdShadeConnectionSourceInfo info = previewSurface.GetInput(_tokens->usdPreviewSurfaceColor).GetConnectedSources()[0];
     info.source.GetInput(_tokens->usdPreviewSurfaceFile).ConnectToSource(matTextureInput);
 
     return true;
 }
 
-bool usdex::rtx::addNormalTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addNormalTexture(UsdShadeMaterial& material, UsdShadeShader& mdlShader, UsdShadeShader& previewSurface, const SdfAssetPath& texturePath)
 {
-    if (!verifyValidOmniPbrMaterial(material, texturePath))
-    {
-        return false;
-    }
-
     if (!usdex::core::addNormalTextureToPreviewMaterial(material, texturePath))
     {
         // Do not report the reason as the function we called will have already logged the diagnostic for us.
@@ -691,6 +663,7 @@ bool usdex::rtx::addNormalTextureToPbrMaterial(UsdShadeMaterial& material, const
 
     UsdShadeInput matTextureInput = ::createMaterialLinkedMdlFileInput(
         material,
+        mdlShader,
         _tokens->materialNormalTexture,
         _tokens->omniPbrNormalTexture,
         texturePath,
@@ -699,20 +672,14 @@ bool usdex::rtx::addNormalTextureToPbrMaterial(UsdShadeMaterial& material, const
 
     // Connect the texture shader to the material interface. Note this makes unchecked assumptions about the behavior of `definePreviewMaterial`
     // and `addNormalTextureToPreviewMaterial` in the core library. If those implementations change, this code needs to be adjusted to match.
-    UsdShadeShader previewSurface = usdex::core::computeEffectivePreviewSurfaceShader(material);
     UsdShadeConnectionSourceInfo info = previewSurface.GetInput(_tokens->usdPreviewSurfaceNormal).GetConnectedSources()[0];
     info.source.GetInput(_tokens->usdPreviewSurfaceFile).ConnectToSource(matTextureInput);
 
     return true;
 }
 
-bool usdex::rtx::addOpacityTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addOpacityTexture(UsdShadeMaterial& material, UsdShadeShader& mdlShader, UsdShadeShader& previewSurface, const SdfAssetPath& texturePath)
 {
-    if (!verifyValidOmniPbrMaterial(material, texturePath))
-    {
-        return false;
-    }
-
     if (!usdex::core::addOpacityTextureToPreviewMaterial(material, texturePath))
     {
         // Do not report the reason as the function we called will have already logged the diagnostic for us.
@@ -725,8 +692,10 @@ bool usdex::rtx::addOpacityTextureToPbrMaterial(UsdShadeMaterial& material, cons
         { _tokens->omniPbrOpacityThreshold, VtValue(std::numeric_limits<float>::epsilon()), SdfValueTypeNames->Float }
     };
 
-    return addSingleChannelTextureToPbrMaterial(
+    return ::addSingleChannelTextureToPbrMaterial(
         material,
+        mdlShader,
+        previewSurface,
         texturePath,
         _tokens->materialOpacity,
         _tokens->materialOpacityInputs,
@@ -738,13 +707,8 @@ bool usdex::rtx::addOpacityTextureToPbrMaterial(UsdShadeMaterial& material, cons
     );
 }
 
-bool usdex::rtx::addRoughnessTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addRoughnessTexture(UsdShadeMaterial& material, UsdShadeShader& mdlShader, UsdShadeShader& previewSurface, const SdfAssetPath& texturePath)
 {
-    if (!verifyValidOmniPbrMaterial(material, texturePath))
-    {
-        return false;
-    }
-
     if (!usdex::core::addRoughnessTextureToPreviewMaterial(material, texturePath))
     {
         // Do not report the reason as the function we called will have already logged the diagnostic for us.
@@ -753,8 +717,10 @@ bool usdex::rtx::addRoughnessTextureToPbrMaterial(UsdShadeMaterial& material, co
 
     std::vector<TfTokenValuePair> tokenValuePairs = { { _tokens->omniPbrRoughnessTextureInfluence, VtValue(1.0f), SdfValueTypeNames->Float } };
 
-    return addSingleChannelTextureToPbrMaterial(
+    return ::addSingleChannelTextureToPbrMaterial(
         material,
+        mdlShader,
+        previewSurface,
         texturePath,
         _tokens->materialRoughness,
         _tokens->materialRoughnessInputs,
@@ -766,13 +732,8 @@ bool usdex::rtx::addRoughnessTextureToPbrMaterial(UsdShadeMaterial& material, co
     );
 }
 
-bool usdex::rtx::addMetallicTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addMetallicTexture(UsdShadeMaterial& material, UsdShadeShader& mdlShader, UsdShadeShader& previewSurface, const SdfAssetPath& texturePath)
 {
-    if (!verifyValidOmniPbrMaterial(material, texturePath))
-    {
-        return false;
-    }
-
     if (!usdex::core::addMetallicTextureToPreviewMaterial(material, texturePath))
     {
         // Do not report the reason as the function we called will have already logged the diagnostic for us.
@@ -781,8 +742,10 @@ bool usdex::rtx::addMetallicTextureToPbrMaterial(UsdShadeMaterial& material, con
 
     std::vector<TfTokenValuePair> tokenValuePairs = { { _tokens->omniPbrMetallicTextureInfluence, VtValue(1.0f), SdfValueTypeNames->Float } };
 
-    return addSingleChannelTextureToPbrMaterial(
+    return ::addSingleChannelTextureToPbrMaterial(
         material,
+        mdlShader,
+        previewSurface,
         texturePath,
         _tokens->materialMetallic,
         _tokens->materialMetallicInputs,
@@ -794,13 +757,8 @@ bool usdex::rtx::addMetallicTextureToPbrMaterial(UsdShadeMaterial& material, con
     );
 }
 
-bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+bool addOrmTexture(UsdShadeMaterial& material, UsdShadeShader& mdlShader, UsdShadeShader& previewSurface, const SdfAssetPath& texturePath)
 {
-    if (!verifyValidOmniPbrMaterial(material, texturePath))
-    {
-        return false;
-    }
-
     if (!usdex::core::addOrmTextureToPreviewMaterial(material, texturePath))
     {
         // Do not report the reason as the function we called will have already logged the diagnostic for us.
@@ -814,7 +772,7 @@ bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const Sd
     if (input)
     {
         input.Get<float>(&metallic);
-        createMdlShaderInput(material, _tokens->omniPbrMetallic, VtValue(metallic), SdfValueTypeNames->Float);
+        ::createShaderInput(material, mdlShader, _tokens->omniPbrMetallic, VtValue(metallic), SdfValueTypeNames->Float);
         ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), _tokens->materialMetallicInputs);
     }
 
@@ -823,16 +781,17 @@ bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const Sd
     if (input)
     {
         input.Get<float>(&roughness);
-        createMdlShaderInput(material, _tokens->omniPbrRoughness, VtValue(roughness), SdfValueTypeNames->Float);
+        ::createShaderInput(material, mdlShader, _tokens->omniPbrRoughness, VtValue(roughness), SdfValueTypeNames->Float);
         ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), _tokens->materialRoughnessInputs);
     }
 
     // These need to be set for MDL to use an ORM map
-    createMdlShaderInput(material, _tokens->omniPbrRoughnessTextureInfluence, VtValue(1.0f), SdfValueTypeNames->Float);
-    createMdlShaderInput(material, _tokens->omniPbrMetallicTextureInfluence, VtValue(1.0f), SdfValueTypeNames->Float);
-    createMdlShaderInput(material, _tokens->omniPbrOrmTextureEnabled, VtValue(true), SdfValueTypeNames->Bool);
+    ::createShaderInput(material, mdlShader, _tokens->omniPbrRoughnessTextureInfluence, VtValue(1.0f), SdfValueTypeNames->Float);
+    ::createShaderInput(material, mdlShader, _tokens->omniPbrMetallicTextureInfluence, VtValue(1.0f), SdfValueTypeNames->Float);
+    ::createShaderInput(material, mdlShader, _tokens->omniPbrOrmTextureEnabled, VtValue(true), SdfValueTypeNames->Bool);
     UsdShadeInput matTextureInput = ::createMaterialLinkedMdlFileInput(
         material,
+        mdlShader,
         _tokens->materialOrmTexture,
         _tokens->omniPbrOrmTexture,
         texturePath,
@@ -841,20 +800,20 @@ bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const Sd
 
     // Connect the texture shader to the material interface. Note this makes unchecked assumptions about the behavior of `definePreviewMaterial`
     // and `addOrmTextureToPreviewMaterial` in the core library. If those implementations change, this code needs to be adjusted to match.
-    UsdShadeShader previewSurface = usdex::core::computeEffectivePreviewSurfaceShader(material);
     UsdShadeConnectionSourceInfo info = previewSurface.GetInput(_tokens->usdPreviewSurfaceOcclusion).GetConnectedSources()[0];
     info.source.GetInput(_tokens->usdPreviewSurfaceFile).ConnectToSource(matTextureInput);
 
     return true;
 }
 
-bool usdex::rtx::addEmissiveTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath, const float intensity)
+bool addEmissiveTexture(
+    UsdShadeMaterial& material,
+    UsdShadeShader& mdlShader,
+    UsdShadeShader& previewSurface,
+    const SdfAssetPath& texturePath,
+    const float intensity
+)
 {
-    if (!verifyValidOmniPbrMaterial(material, texturePath))
-    {
-        return false;
-    }
-
     if (!usdex::core::addEmissiveTextureToPreviewMaterial(material, texturePath))
     {
         // Do not report the reason as the function we called will have already logged the diagnostic for us.
@@ -868,12 +827,13 @@ bool usdex::rtx::addEmissiveTextureToPbrMaterial(UsdShadeMaterial& material, con
     if (matEmissiveColorInput)
     {
         matEmissiveColorInput.Get<GfVec3f>(&color);
-        createMdlShaderInput(material, _tokens->omniPbrEmissiveColor, VtValue(color), SdfValueTypeNames->Color3f);
+        ::createShaderInput(material, mdlShader, _tokens->omniPbrEmissiveColor, VtValue(color), SdfValueTypeNames->Color3f);
         ::removeProperty(material.GetPrim().GetStage(), material.GetPrim().GetPath(), _tokens->materialEmissiveColorInputs);
     }
 
     UsdShadeInput matTextureInput = ::createMaterialLinkedMdlFileInput(
         material,
+        mdlShader,
         _tokens->materialEmissiveTexture,
         _tokens->omniPbrEmissiveTexture,
         texturePath,
@@ -882,14 +842,11 @@ bool usdex::rtx::addEmissiveTextureToPbrMaterial(UsdShadeMaterial& material, con
 
     // Connect the texture shader to the material interface. Note this makes unchecked assumptions about the behavior of `definePreviewMaterial`
     // and `addEmissiveTextureToPreviewMaterial` in the core library. If those implementations change, this code needs to be adjusted to match.
-    UsdShadeShader previewSurface = usdex::core::computeEffectivePreviewSurfaceShader(material);
     UsdShadeConnectionSourceInfo info = previewSurface.GetInput(_tokens->usdPreviewSurfaceEmissiveColor).GetConnectedSources()[0];
     info.source.GetInput(_tokens->usdPreviewSurfaceFile).ConnectToSource(matTextureInput);
 
     // Create or reuse the material interface input that drives OmniPBR's emission_intensity, then set the supplied intensity.
     // This overwrites any value previously authored by addEmissiveColorToPbrMaterial().
-    UsdShadeShader mdlShader = usdex::rtx::computeEffectiveMdlSurfaceShader(material);
-
     UsdShadeInput materialEmissiveEnableInput = material.CreateInput(_tokens->materialEmissiveEnable, SdfValueTypeNames->Bool);
     UsdShadeInput materialEmissiveIntensityInput = material.CreateInput(_tokens->materialEmissiveIntensity, SdfValueTypeNames->Float);
 
@@ -903,6 +860,567 @@ bool usdex::rtx::addEmissiveTextureToPbrMaterial(UsdShadeMaterial& material, con
     return true;
 }
 
+} // namespace
+
+UsdShadeShader usdex::rtx::createMdlShader(
+    UsdShadeMaterial& material,
+    const std::string& name,
+    const SdfAssetPath& mdlPath,
+    const TfToken& module,
+    bool connectMaterialOutputs
+)
+{
+    UsdPrim materialPrim = material.GetPrim();
+
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(materialPrim, name, &reason))
+    {
+        TF_WARN("Unable to create UsdShadeShader due to an invalid location: %s", reason.c_str());
+        return UsdShadeShader();
+    }
+
+    SdfPath shaderPath = materialPrim.GetPath().AppendChild(TfToken(name));
+    UsdStagePtr stage = materialPrim.GetStage();
+
+    UsdShadeShader shader = UsdShadeShader::Define(stage, shaderPath);
+    shader.SetSourceAsset(mdlPath, _tokens->mdl);
+    shader.SetSourceAssetSubIdentifier(module, _tokens->mdl);
+    if (connectMaterialOutputs)
+    {
+        UsdShadeOutput shaderOutput = shader.CreateOutput(_tokens->out, SdfValueTypeNames->Token);
+        material.CreateSurfaceOutput(_tokens->mdl).ConnectToSource(shaderOutput);
+        material.CreateVolumeOutput(_tokens->mdl).ConnectToSource(shaderOutput);
+        material.CreateDisplacementOutput(_tokens->mdl).ConnectToSource(shaderOutput);
+    }
+    return shader;
+}
+
+UsdShadeInput usdex::rtx::createMdlShaderInput(
+    UsdShadeMaterial& material,
+    const TfToken& name,
+    const VtValue& value,
+    const SdfValueTypeName& typeName,
+    std::optional<const usdex::core::ColorSpace> colorSpace
+)
+{
+    if (!material)
+    {
+        TF_WARN("Invalid UsdShadeMaterial, cannot create MDL shader input <%s>", name.GetText());
+        return UsdShadeInput();
+    }
+
+    UsdShadeShader shaderPrim = usdex::rtx::computeEffectiveMdlSurfaceShader(material);
+    if (!shaderPrim)
+    {
+        TF_WARN("Cannot create MDL shader input, no MDL shader found in UsdShadeMaterial <%s>", material.GetPath().GetAsString().c_str());
+        return UsdShadeInput();
+    }
+    return ::createShaderInput(material, shaderPrim, name, value, typeName, colorSpace);
+}
+
+UsdShadeShader usdex::rtx::computeEffectiveMdlSurfaceShader(const UsdShadeMaterial& material)
+{
+    if (!material)
+    {
+        return UsdShadeShader();
+    }
+
+    return material.ComputeSurfaceSource({ _tokens->mdl });
+}
+
+UsdShadeMaterial usdex::rtx::definePbrMaterial(
+    UsdStagePtr stage,
+    const SdfPath& path,
+    const GfVec3f& color,
+    const float opacity,
+    const float roughness,
+    const float metallic
+)
+{
+    // While a BulkAuthoringScope is active, the specs of the prototype are copied into place and only the supplied values are authored
+    if (::shouldClonePrototype(stage, path))
+    {
+        std::string reason;
+        if (!usdex::core::isEditablePrimLocation(stage, path, &reason))
+        {
+            TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+            return UsdShadeMaterial();
+        }
+        if (!::isValidUnitParameter(path, "Opacity", opacity) || !::isValidUnitParameter(path, "Roughness", roughness) ||
+            !::isValidUnitParameter(path, "Metallic", metallic))
+        {
+            return UsdShadeMaterial();
+        }
+
+        std::vector<PrototypeValue> values = {
+            { TfToken(), _tokens->materialColorInputs, SdfValueTypeNames->Color3f, VtValue(color) },
+            { TfToken(), _tokens->materialOpacityInputs, SdfValueTypeNames->Float, VtValue(opacity) },
+            { TfToken(), _tokens->materialRoughnessInputs, SdfValueTypeNames->Float, VtValue(roughness) },
+            { TfToken(), _tokens->materialMetallicInputs, SdfValueTypeNames->Float, VtValue(metallic) },
+            { _tokens->previewSurfaceName, _tokens->materialColorInputs, SdfValueTypeNames->Color3f, VtValue(color) },
+            { _tokens->previewSurfaceName, _tokens->materialOpacityInputs, SdfValueTypeNames->Float, VtValue(opacity) },
+            { _tokens->previewSurfaceName, _tokens->materialRoughnessInputs, SdfValueTypeNames->Float, VtValue(roughness) },
+            { _tokens->previewSurfaceName, _tokens->materialMetallicInputs, SdfValueTypeNames->Float, VtValue(metallic) },
+        };
+        if (opacity < 1.0f)
+        {
+            values.push_back({ _tokens->mdlShaderName, _tokens->omniPbrOpacityEnabledInputs, SdfValueTypeNames->Bool, VtValue(true) });
+        }
+
+        UsdShadeMaterial material = ::clonePrototype(stage, path, ::getPrototypePath(_tokens->omniPbr), values);
+        if (material && opacity < 1.0f)
+        {
+            setFractionalOpacity(stage);
+        }
+        return material;
+    }
+
+    // Define the Preview Material first, as it validates the same set of criteria
+    UsdShadeMaterial material = usdex::core::definePreviewMaterial(stage, path, color, opacity, roughness, metallic);
+    if (!material)
+    {
+        // Do not report the reason as the function we called will have already logged the diagnostic for us.
+        return UsdShadeMaterial();
+    }
+
+    // Define the surface shader to be used in the "mdl" rendering context
+    static constexpr const char* s_mdlShaderName = "MDLShader";
+    static const SdfAssetPath s_mdlAssetPath = SdfAssetPath(g_omniPbrAssetPath);
+    UsdShadeShader mdlShader = usdex::rtx::createMdlShader(material, s_mdlShaderName, s_mdlAssetPath, _tokens->omniPbr);
+    if (!mdlShader)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeShader named \"%s\" as a child of \"%s\"", s_mdlShaderName, path.GetAsString().c_str());
+        return UsdShadeMaterial();
+    }
+
+    // Expose inputs on the material that will be connected to the corresponding inputs on the surface shaders
+    // This acts as a Material interface from which value changes will be reflected across multiple renderers
+    UsdShadeInput materialColorInput = material.CreateInput(_tokens->materialColor, SdfValueTypeNames->Color3f);
+    UsdShadeInput materialOpacityInput = material.CreateInput(_tokens->materialOpacity, SdfValueTypeNames->Float);
+    UsdShadeInput materialRoughnessInput = material.CreateInput(_tokens->materialRoughness, SdfValueTypeNames->Float);
+    UsdShadeInput materialMetallicInput = material.CreateInput(_tokens->materialMetallic, SdfValueTypeNames->Float);
+
+    // Set the min, max and default metadata on the material interface
+    // We would copy this metadata from the connected MDL shader inputs, however the Sdr registry for MDL shaders may not be available.
+    // Instead we author the same values that are enforced within this function.
+    materialColorInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(GfVec3f(0.2f, 0.2f, 0.2f)));
+
+    materialOpacityInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(1.0f));
+    materialOpacityInput.GetAttr().SetCustomDataByKey(_tokens->rangeMin, VtValue(0.0f));
+    materialOpacityInput.GetAttr().SetCustomDataByKey(_tokens->rangeMax, VtValue(1.0f));
+
+    materialRoughnessInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(0.5f));
+    materialRoughnessInput.GetAttr().SetCustomDataByKey(_tokens->rangeMin, VtValue(0.0f));
+    materialRoughnessInput.GetAttr().SetCustomDataByKey(_tokens->rangeMax, VtValue(1.0f));
+
+    materialMetallicInput.GetAttr().SetCustomDataByKey(_tokens->defaultValue, VtValue(0.0f));
+    materialMetallicInput.GetAttr().SetCustomDataByKey(_tokens->rangeMin, VtValue(0.0f));
+    materialMetallicInput.GetAttr().SetCustomDataByKey(_tokens->rangeMax, VtValue(1.0f));
+
+    // Set the supplied values on the material interface
+    materialColorInput.Set(color);
+    materialOpacityInput.Set(opacity);
+    materialRoughnessInput.Set(roughness);
+    materialMetallicInput.Set(metallic);
+
+    // Create MDL shader inputs to produce a physically based rendering result with the supplied values
+    // Inputs are either set or connected to the material interface
+    mdlShader.CreateInput(_tokens->omniPbrAlbedoColor, SdfValueTypeNames->Color3f).ConnectToSource(materialColorInput);
+    mdlShader.CreateInput(_tokens->omniPbrOpacity, SdfValueTypeNames->Float).ConnectToSource(materialOpacityInput);
+    mdlShader.CreateInput(_tokens->omniPbrRoughness, SdfValueTypeNames->Float).ConnectToSource(materialRoughnessInput);
+    mdlShader.CreateInput(_tokens->omniPbrMetallic, SdfValueTypeNames->Float).ConnectToSource(materialMetallicInput);
+
+    // Enable opacity and set the required render settings if the material is not fully opaque
+    if (opacity < 1.0f)
+    {
+        mdlShader.CreateInput(_tokens->omniPbrOpacityEnabled, SdfValueTypeNames->Bool).Set(true);
+        setFractionalOpacity(stage);
+    }
+
+    // Create default shader inputs to produce a physically based rendering result with the supplied values. Note these will have already been
+    // created when we called `definePreviewMaterial`. Since `CreateInput` will Get if it already exists, it is safe to call here, and protects
+    // us incase the underlying implementation stops creating these directly.
+    UsdShadeShader previewShader = usdex::core::computeEffectivePreviewSurfaceShader(material);
+    previewShader.CreateInput(_tokens->usdPreviewSurfaceColor, SdfValueTypeNames->Color3f).ConnectToSource(materialColorInput);
+    previewShader.CreateInput(_tokens->usdPreviewSurfaceOpacity, SdfValueTypeNames->Float).ConnectToSource(materialOpacityInput);
+    previewShader.CreateInput(_tokens->usdPreviewSurfaceRoughness, SdfValueTypeNames->Float).ConnectToSource(materialRoughnessInput);
+    previewShader.CreateInput(_tokens->usdPreviewSurfaceMetallic, SdfValueTypeNames->Float).ConnectToSource(materialMetallicInput);
+
+    return material;
+}
+
+UsdShadeMaterial usdex::rtx::definePbrMaterial(
+    UsdPrim parent,
+    const std::string& name,
+    const GfVec3f& color,
+    const float opacity,
+    const float roughness,
+    const float metallic
+)
+{
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        return UsdShadeMaterial();
+    }
+
+    // Call overloaded function
+    UsdStageWeakPtr stage = parent.GetStage();
+    const SdfPath path = parent.GetPath().AppendChild(TfToken(name));
+    return usdex::rtx::definePbrMaterial(stage, path, color, opacity, roughness, metallic);
+}
+
+UsdShadeMaterial usdex::rtx::definePbrMaterial(UsdPrim prim, const GfVec3f& color, const float opacity, const float roughness, const float metallic)
+{
+    // Early out if the prim is not valid
+    if (!prim)
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial on invalid prim");
+        return UsdShadeMaterial();
+    }
+
+    TfToken originalType = prim.GetTypeName();
+    // Material is NOT Xformable, so check if converting from Xform to non-Xformable
+    if (originalType == pxr::UsdGeomTokens->Xform)
+    {
+        TF_RUNTIME_ERROR(
+            "Cannot redefine at \"%s\" from \"Xform\" to \"Material\" because Material is not Xformable",
+            prim.GetPath().GetAsString().c_str()
+        );
+        return UsdShadeMaterial();
+    }
+
+    // Warn if converting from non-Scope prims
+    if (originalType != pxr::UsdGeomTokens->Scope && !originalType.IsEmpty())
+    {
+        TF_WARN(
+            "Redefining prim at \"%s\" from type \"%s\" to \"Material\". Expected original type to be \"\" or \"Scope\".",
+            prim.GetPath().GetAsString().c_str(),
+            originalType.GetText()
+        );
+    }
+
+    // Call the stage/path version
+    UsdStageWeakPtr stage = prim.GetStage();
+    const SdfPath& path = prim.GetPath();
+    return usdex::rtx::definePbrMaterial(stage, path, color, opacity, roughness, metallic);
+}
+
+class usdex::rtx::PbrMaterialBuilder::PbrMaterialBuilderImpl
+{
+public:
+
+    explicit PbrMaterialBuilderImpl(const PbrMaterialParams& params) : params(params)
+    {
+    }
+
+    PbrMaterialParams params;
+};
+
+usdex::rtx::PbrMaterialBuilder::PbrMaterialBuilder() : m_impl(new PbrMaterialBuilderImpl(PbrMaterialParams()))
+{
+}
+
+usdex::rtx::PbrMaterialBuilder::PbrMaterialBuilder(const PbrMaterialParams& params) : m_impl(new PbrMaterialBuilderImpl(params))
+{
+}
+
+usdex::rtx::PbrMaterialBuilder::~PbrMaterialBuilder()
+{
+    delete m_impl;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setColor(const GfVec3f& color)
+{
+    m_impl->params.color = color;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setOpacity(float opacity)
+{
+    m_impl->params.opacity = opacity;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setRoughness(float roughness)
+{
+    m_impl->params.roughness = roughness;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setMetallic(float metallic)
+{
+    m_impl->params.metallic = metallic;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setEmissiveColor(const GfVec3f& color, float intensity)
+{
+    m_impl->params.emissiveColor = color;
+    m_impl->params.emissiveIntensity = intensity;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setDiffuseTexture(const SdfAssetPath& texturePath)
+{
+    m_impl->params.diffuseTexture = texturePath;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setNormalTexture(const SdfAssetPath& texturePath)
+{
+    m_impl->params.normalTexture = texturePath;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setOrmTexture(const SdfAssetPath& texturePath)
+{
+    m_impl->params.ormTexture = texturePath;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setRoughnessTexture(const SdfAssetPath& texturePath)
+{
+    m_impl->params.roughnessTexture = texturePath;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setMetallicTexture(const SdfAssetPath& texturePath)
+{
+    m_impl->params.metallicTexture = texturePath;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setOpacityTexture(const SdfAssetPath& texturePath)
+{
+    m_impl->params.opacityTexture = texturePath;
+    return *this;
+}
+
+usdex::rtx::PbrMaterialBuilder& usdex::rtx::PbrMaterialBuilder::setEmissiveTexture(const SdfAssetPath& texturePath, float intensity)
+{
+    m_impl->params.emissiveTexture = texturePath;
+    m_impl->params.emissiveIntensity = intensity;
+    return *this;
+}
+
+const usdex::rtx::PbrMaterialParams& usdex::rtx::PbrMaterialBuilder::getParams() const
+{
+    return m_impl->params;
+}
+
+UsdShadeMaterial usdex::rtx::PbrMaterialBuilder::define(UsdStagePtr stage, const SdfPath& path) const
+{
+    const PbrMaterialParams& params = m_impl->params;
+
+    // Validate the emissive color first, so that it can not fail after the rest of the material has been authored
+    if (params.emissiveColor.has_value() && !::isValidEmissiveColor(path, params.emissiveColor.value(), params.emissiveIntensity))
+    {
+        return UsdShadeMaterial();
+    }
+
+    UsdShadeMaterial material = usdex::rtx::definePbrMaterial(stage, path, params.color, params.opacity, params.roughness, params.metallic);
+    if (!material)
+    {
+        // Do not report the reason as the function we called will have already logged the diagnostic for us.
+        return UsdShadeMaterial();
+    }
+
+    using AddTextureFn = bool (*)(UsdShadeMaterial&, UsdShadeShader&, UsdShadeShader&, const SdfAssetPath&);
+    const std::pair<const SdfAssetPath&, AddTextureFn> textures[] = {
+        { params.diffuseTexture, &::addDiffuseTexture },
+        { params.normalTexture, &::addNormalTexture },
+        { params.ormTexture, &::addOrmTexture },
+        { params.roughnessTexture, &::addRoughnessTexture },
+        { params.metallicTexture, &::addMetallicTexture },
+        { params.opacityTexture, &::addOpacityTexture },
+    };
+    bool hasTextures = !params.emissiveTexture.GetAssetPath().empty();
+    for (const auto& texture : textures)
+    {
+        hasTextures |= !texture.first.GetAssetPath().empty();
+    }
+    if (!hasTextures && !params.emissiveColor.has_value())
+    {
+        return material;
+    }
+
+    // Resolve & verify the shaders once for all of the textures, rather than once per texture as the add*TextureToPbrMaterial functions do
+    UsdShadeShader mdlShader, previewSurface;
+    if (!::verifyValidOmniPbrMaterial(material, mdlShader, previewSurface))
+    {
+        return UsdShadeMaterial();
+    }
+
+    if (params.emissiveColor.has_value() &&
+        !::addEmissiveColor(material, mdlShader, previewSurface, params.emissiveColor.value(), params.emissiveIntensity))
+    {
+        return UsdShadeMaterial();
+    }
+
+    for (const auto& [texturePath, addTexture] : textures)
+    {
+        if (!texturePath.GetAssetPath().empty() && !addTexture(material, mdlShader, previewSurface, texturePath))
+        {
+            return UsdShadeMaterial();
+        }
+    }
+
+    if (!params.emissiveTexture.GetAssetPath().empty() &&
+        !::addEmissiveTexture(material, mdlShader, previewSurface, params.emissiveTexture, params.emissiveIntensity))
+    {
+        return UsdShadeMaterial();
+    }
+
+    return material;
+}
+
+UsdShadeMaterial usdex::rtx::PbrMaterialBuilder::define(UsdPrim parent, const std::string& name) const
+{
+    // Early out if the proposed prim location is invalid
+    std::string reason;
+    if (!usdex::core::isEditablePrimLocation(parent, name, &reason))
+    {
+        TF_RUNTIME_ERROR("Unable to define UsdShadeMaterial due to an invalid location: %s", reason.c_str());
+        return UsdShadeMaterial();
+    }
+
+    // Call overloaded function
+    return define(parent.GetStage(), parent.GetPath().AppendChild(TfToken(name)));
+}
+
+UsdShadeMaterial usdex::rtx::definePbrMaterial(usdex::core::MaterialRegistry& registry, const std::string& name, const PbrMaterialParams& params)
+{
+    VtDictionary key{
+        { "type", VtValue(_tokens->omniPbr) },
+        { "color", VtValue(params.color) },
+        { "opacity", VtValue(params.opacity) },
+        { "roughness", VtValue(params.roughness) },
+        { "metallic", VtValue(params.metallic) },
+        { "diffuseTexture", VtValue(params.diffuseTexture) },
+        { "normalTexture", VtValue(params.normalTexture) },
+        { "ormTexture", VtValue(params.ormTexture) },
+        { "roughnessTexture", VtValue(params.roughnessTexture) },
+        { "metallicTexture", VtValue(params.metallicTexture) },
+        { "opacityTexture", VtValue(params.opacityTexture) },
+        { "emissiveTexture", VtValue(params.emissiveTexture) },
+    };
+    if (params.emissiveColor.has_value())
+    {
+        key["emissiveColor"] = VtValue(params.emissiveColor.value());
+    }
+    // The intensity is only authored alongside an emissive color or texture
+    if (params.emissiveColor.has_value() || !params.emissiveTexture.GetAssetPath().empty())
+    {
+        key["emissiveIntensity"] = VtValue(params.emissiveIntensity);
+    }
+
+    return registry.defineMaterial(
+        name,
+        key,
+        [&params](UsdPrim parent, const std::string& childName)
+        {
+            UsdShadeMaterial material = usdex::rtx::PbrMaterialBuilder(params).define(parent, childName);
+            const SdfPath path = parent.GetPath().AppendChild(TfToken(childName));
+            if (!material && parent.GetStage()->GetPrimAtPath(path))
+            {
+                // Remove the partially authored material, so that a later request with valid textures is not confused with it
+                parent.GetStage()->RemovePrim(path);
+            }
+            return material;
+        }
+    );
+}
+
+bool usdex::rtx::addEmissiveColorToPbrMaterial(UsdShadeMaterial& material, const GfVec3f& color, const float intensity)
+{
+    UsdShadeShader mdlShader, previewShader;
+    if (!verifyValidOmniPbrMaterial(material, mdlShader, previewShader))
+    {
+        return false;
+    }
+
+    if (!::isValidEmissiveColor(material.GetPath(), color, intensity))
+    {
+        return false;
+    }
+
+    return ::addEmissiveColor(material, mdlShader, previewShader, color, intensity);
+}
+
+bool usdex::rtx::addDiffuseTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    UsdShadeShader mdlShader, previewSurface;
+    if (!verifyValidOmniPbrMaterial(material, texturePath, mdlShader, previewSurface))
+    {
+        return false;
+    }
+    return ::addDiffuseTexture(material, mdlShader, previewSurface, texturePath);
+}
+
+bool usdex::rtx::addNormalTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    UsdShadeShader mdlShader, previewSurface;
+    if (!verifyValidOmniPbrMaterial(material, texturePath, mdlShader, previewSurface))
+    {
+        return false;
+    }
+    return ::addNormalTexture(material, mdlShader, previewSurface, texturePath);
+}
+
+bool usdex::rtx::addOpacityTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    UsdShadeShader mdlShader, previewSurface;
+    if (!verifyValidOmniPbrMaterial(material, texturePath, mdlShader, previewSurface))
+    {
+        return false;
+    }
+    return ::addOpacityTexture(material, mdlShader, previewSurface, texturePath);
+}
+
+bool usdex::rtx::addRoughnessTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    UsdShadeShader mdlShader, previewSurface;
+    if (!verifyValidOmniPbrMaterial(material, texturePath, mdlShader, previewSurface))
+    {
+        return false;
+    }
+    return ::addRoughnessTexture(material, mdlShader, previewSurface, texturePath);
+}
+
+bool usdex::rtx::addMetallicTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    UsdShadeShader mdlShader, previewSurface;
+    if (!verifyValidOmniPbrMaterial(material, texturePath, mdlShader, previewSurface))
+    {
+        return false;
+    }
+    return ::addMetallicTexture(material, mdlShader, previewSurface, texturePath);
+}
+
+bool usdex::rtx::addOrmTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath)
+{
+    UsdShadeShader mdlShader, previewSurface;
+    if (!verifyValidOmniPbrMaterial(material, texturePath, mdlShader, previewSurface))
+    {
+        return false;
+    }
+    return ::addOrmTexture(material, mdlShader, previewSurface, texturePath);
+}
+
+bool usdex::rtx::addEmissiveTextureToPbrMaterial(UsdShadeMaterial& material, const SdfAssetPath& texturePath, const float intensity)
+{
+    UsdShadeShader mdlShader, previewSurface;
+    if (!verifyValidOmniPbrMaterial(material, texturePath, mdlShader, previewSurface))
+    {
+        return false;
+    }
+    return ::addEmissiveTexture(material, mdlShader, previewSurface, texturePath, intensity);
+}
+
 UsdShadeMaterial usdex::rtx::defineGlassMaterial(UsdStagePtr stage, const SdfPath& path, const GfVec3f& color, const float indexOfRefraction)
 {
     // Early out if the proposed prim location is invalid
@@ -937,6 +1455,20 @@ UsdShadeMaterial usdex::rtx::defineGlassMaterial(UsdStagePtr stage, const SdfPat
         return UsdShadeMaterial();
     }
 
+    // While a BulkAuthoringScope is active, the specs of the prototype are copied into place and only the supplied values are authored
+    if (::shouldClonePrototype(stage, path))
+    {
+        return ::clonePrototype(
+            stage,
+            path,
+            ::getPrototypePath(_tokens->omniGlass),
+            {
+                { TfToken(), _tokens->materialColorInputs, SdfValueTypeNames->Color3f, VtValue(color) },
+                { TfToken(), _tokens->materialIorInputs, SdfValueTypeNames->Float, VtValue(indexOfRefraction) },
+            }
+        );
+    }
+
     // Define the material
     // We do not use usdex::rtx::createMaterial here to avoid double validations
     UsdShadeMaterial material = UsdShadeMaterial::Define(stage, path);
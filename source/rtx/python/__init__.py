@@ -24,6 +24,8 @@ __all__ = [
     "addMetallicTextureToPbrMaterial",
     "addOpacityTextureToPbrMaterial",
     "addEmissiveTextureToPbrMaterial",
+    "PbrMaterialParams",
+    "PbrMaterialBuilder",
 ]
 
 import os
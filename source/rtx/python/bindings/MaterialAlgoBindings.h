@@ -133,6 +133,9 @@ void bindMaterialAlgo(module& m)
                 The use of MDL shaders inside this Material interface is considered an implementation detail of the RTX Renderer.
                 Once the RTX Renderer supports OpenPBR or MaterialX shaders we may change the implementation to author those shaders instead of MDL.
 
+                While a ``usdex.core.BulkAuthoringScope`` is active for the stage, the specs of a prototype Material are copied into place and
+                only the differing values are authored. The resulting specs are identical to those of the regular authoring path.
+
             Parameters:
                 - **stage** - The stage on which to define the Material
                 - **path** - The absolute prim path at which to define the Material
@@ -196,6 +199,178 @@ void bindMaterialAlgo(module& m)
                 The newly defined UsdShade.Material. Returns an Invalid prim on error
         )"
     );
+    ::class_<PbrMaterialParams>(
+        m,
+        "PbrMaterialParams",
+        R"(
+            The parameters of a PBR material, as authored by ``usdex.rtx.definePbrMaterial()`` and the ``add*TextureToPbrMaterial()`` functions.
+
+            This is used to define PBR materials via a ``usdex.core.MaterialRegistry``, which must know all of the parameters of a material
+            (including its textures) before it is authored, in order to find an identical material which has already been defined.
+
+            Textures with an empty asset path, and an unset emissive color, are not authored.
+        )"
+    )
+        .def(init<>())
+        .def_readwrite("color", &PbrMaterialParams::color, "The diffuse color of the Material")
+        .def_readwrite("opacity", &PbrMaterialParams::opacity, "The Opacity Amount to set, 0.0-1.0 range where 1.0 = opaque and 0.0 = invisible")
+        .def_readwrite("roughness", &PbrMaterialParams::roughness, "The Roughness Amount to set, 0.0-1.0 range where 1.0 = flat and 0.0 = glossy")
+        .def_readwrite("metallic", &PbrMaterialParams::metallic, "The Metallic Amount to set, 0.0-1.0 range where 1.0 = max metallic and 0.0 = no metallic")
+        .def_readwrite("emissiveColor", &PbrMaterialParams::emissiveColor, "The emissive color, or ``None`` if the material is not emissive")
+        .def_readwrite("emissiveIntensity", &PbrMaterialParams::emissiveIntensity, "The intensity of the emissive color or emissive texture")
+        .def_readwrite("diffuseTexture", &PbrMaterialParams::diffuseTexture, "The diffuse texture")
+        .def_readwrite("normalTexture", &PbrMaterialParams::normalTexture, "The normal texture")
+        .def_readwrite("ormTexture", &PbrMaterialParams::ormTexture, "The ORM (occlusion, roughness, metallic) texture")
+        .def_readwrite("roughnessTexture", &PbrMaterialParams::roughnessTexture, "The roughness texture")
+        .def_readwrite("metallicTexture", &PbrMaterialParams::metallicTexture, "The metallic texture")
+        .def_readwrite("opacityTexture", &PbrMaterialParams::opacityTexture, "The opacity texture")
+        .def_readwrite("emissiveTexture", &PbrMaterialParams::emissiveTexture, "The emissive texture");
+
+    ::class_<PbrMaterialBuilder>(
+        m,
+        "PbrMaterialBuilder",
+        R"(
+            Defines a fully textured PBR ``UsdShade.Material`` in a single call.
+
+            The material is defined via ``definePbrMaterial()``, and the emissive color and textures are then authored as by
+            ``addEmissiveColorToPbrMaterial()`` and the ``add*TextureToPbrMaterial()`` functions, but the shaders of the new material are resolved &
+            verified once, rather than once per texture. The emissive color is validated before the material is defined.
+
+            The parameters can be supplied as a ``PbrMaterialParams``, or collected via the chainable setters:
+
+            .. code-block:: python
+
+                builder = usdex.rtx.PbrMaterialBuilder()
+                builder.setColor(Gf.Vec3f(1.0)).setDiffuseTexture(diffusePath).setNormalTexture(normalPath).setOrmTexture(ormPath)
+                material = builder.define(materialsScope, "Metal")
+
+            The same builder can define any number of materials.
+        )"
+    )
+        .def(init<>())
+        .def(init<const PbrMaterialParams&>(), arg("params"))
+        .def(
+            "setColor",
+            &PbrMaterialBuilder::setColor,
+            arg("color"),
+            return_value_policy::reference_internal,
+            "Set the diffuse color of the Material"
+        )
+        .def("setOpacity", &PbrMaterialBuilder::setOpacity, arg("opacity"), return_value_policy::reference_internal, "Set the Opacity Amount")
+        .def("setRoughness", &PbrMaterialBuilder::setRoughness, arg("roughness"), return_value_policy::reference_internal, "Set the Roughness Amount")
+        .def("setMetallic", &PbrMaterialBuilder::setMetallic, arg("metallic"), return_value_policy::reference_internal, "Set the Metallic Amount")
+        .def(
+            "setEmissiveColor",
+            &PbrMaterialBuilder::setEmissiveColor,
+            arg("color"),
+            arg("intensity") = 1000.0f,
+            return_value_policy::reference_internal,
+            "Set the emissive color and its intensity. The intensity is shared with the emissive texture."
+        )
+        .def(
+            "setDiffuseTexture",
+            &PbrMaterialBuilder::setDiffuseTexture,
+            arg("texturePath"),
+            return_value_policy::reference_internal,
+            "Set the diffuse texture"
+        )
+        .def(
+            "setNormalTexture",
+            &PbrMaterialBuilder::setNormalTexture,
+            arg("texturePath"),
+            return_value_policy::reference_internal,
+            "Set the normal texture"
+        )
+        .def(
+            "setOrmTexture",
+            &PbrMaterialBuilder::setOrmTexture,
+            arg("texturePath"),
+            return_value_policy::reference_internal,
+            "Set the ORM (occlusion, roughness, metallic) texture"
+        )
+        .def(
+            "setRoughnessTexture",
+            &PbrMaterialBuilder::setRoughnessTexture,
+            arg("texturePath"),
+            return_value_policy::reference_internal,
+            "Set the roughness texture"
+        )
+        .def(
+            "setMetallicTexture",
+            &PbrMaterialBuilder::setMetallicTexture,
+            arg("texturePath"),
+            return_value_policy::reference_internal,
+            "Set the metallic texture"
+        )
+        .def(
+            "setOpacityTexture",
+            &PbrMaterialBuilder::setOpacityTexture,
+            arg("texturePath"),
+            return_value_policy::reference_internal,
+            "Set the opacity texture"
+        )
+        .def(
+            "setEmissiveTexture",
+            &PbrMaterialBuilder::setEmissiveTexture,
+            arg("texturePath"),
+            arg("intensity") = 1000.0f,
+            return_value_policy::reference_internal,
+            "Set the emissive texture and its intensity. The intensity is shared with the emissive color."
+        )
+        .def("getParams", &PbrMaterialBuilder::getParams, return_value_policy::copy, "A copy of the parameters collected so far")
+        .def(
+            "define",
+            overload_cast<UsdStagePtr, const SdfPath&>(&PbrMaterialBuilder::define, const_),
+            arg("stage"),
+            arg("path"),
+            R"(
+                Define a PBR Material with the collected parameters.
+
+                Parameters:
+                    - **stage** - The stage on which to define the Material
+                    - **path** - The absolute prim path at which to define the Material
+
+                Returns:
+                    The newly defined UsdShade.Material. Returns an Invalid prim on error
+            )"
+        )
+        .def(
+            "define",
+            overload_cast<UsdPrim, const std::string&>(&PbrMaterialBuilder::define, const_),
+            arg("parent"),
+            arg("name"),
+            R"(
+                Define a PBR Material with the collected parameters.
+
+                Parameters:
+                    - **parent** - Prim below which to define the Material
+                    - **name** - Name of the Material
+
+                Returns:
+                    The newly defined UsdShade.Material. Returns an Invalid prim on error
+            )"
+        );
+
+    m.def(
+        "definePbrMaterial",
+        overload_cast<usdex::core::MaterialRegistry&, const std::string&, const PbrMaterialParams&>(&definePbrMaterial),
+        arg("registry"),
+        arg("name"),
+        arg("params"),
+        R"(
+            Defines a PBR material via a ``usdex.core.MaterialRegistry``, or returns an identical PBR material which was defined previously.
+
+            On a miss, the material is authored via a ``PbrMaterialBuilder`` below the parent prim of the registry. If this fails, nothing is
+            registered.
+
+            Args:
+                registry: The registry used to find or define the Material
+                name: The name of the Material, if a new material must be defined
+                params: The parameters of the Material
+            Returns:
+                The new or existing UsdShade.Material. Returns an Invalid prim on error
+        )"
+    );
     m.def(
         "addEmissiveColorToPbrMaterial",
         &addEmissiveColorToPbrMaterial,
@@ -391,6 +566,9 @@ void bindMaterialAlgo(module& m)
                 The use of MDL shaders inside this Material interface is considered an implementation detail of the RTX Renderer.
                 Once the RTX Renderer supports OpenPBR or MaterialX shaders we may change the implementation to author those shaders instead of MDL.
 
+                While a ``usdex.core.BulkAuthoringScope`` is active for the stage, the specs of a prototype Material are copied into place and
+                only the differing values are authored. The resulting specs are identical to those of the regular authoring path.
+
             Parameters:
                 - **stage** - The stage on which to define the Material
                 - **path** - The absolute prim path at which to define the Material
@@ -1173,3 +1173,188 @@ class defineGlassMaterialTestCase(usdex.test.DefineFunctionTestCase):
         expected = MaterialAlgoTest.getExpectedResolveDiagMsgs(1, "OmniGlass.mdl")
         with usdex.test.ScopedDiagnosticChecker(self, expected):
             super().testParentNameSuccess()
+
+
+class PbrMaterialRegistryTestCase(usdex.test.TestCase):
+
+    def testDeduplicate(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materials = usdex.core.defineScope(stage.GetDefaultPrim(), usdex.core.getMaterialsToken()).GetPrim()
+        registry = usdex.core.MaterialRegistry(materials)
+
+        params = usdex.rtx.PbrMaterialParams()
+        params.color = Gf.Vec3f(0.25, 0.5, 0.75)
+        params.diffuseTexture = Sdf.AssetPath(self.tmpFile(name="BaseColor", ext="png"))
+        params.emissiveColor = Gf.Vec3f(1, 0, 0)
+        params.emissiveIntensity = 500.0
+
+        # identical parameters share a single material
+        first = usdex.rtx.definePbrMaterial(registry, "A", params)
+        self.assertTrue(first)
+        self.assertTrue(usdex.rtx.computeEffectiveMdlSurfaceShader(first))
+        self.assertEqual(first.GetInput("DiffuseTexture").Get(), params.diffuseTexture)
+        self.assertEqual(first.GetInput("emissiveIntensity").Get(), 500.0)
+        self.assertEqual(usdex.rtx.definePbrMaterial(registry, "B", params).GetPath(), first.GetPath())
+
+        # a different intensity defines a new material
+        params.emissiveIntensity = 100.0
+        second = usdex.rtx.definePbrMaterial(registry, "B", params)
+        self.assertNotEqual(second.GetPath(), first.GetPath())
+        self.assertEqual(registry.getMaterialCount(), 2)
+        self.assertEqual(registry.getReuseCount(), 1)
+
+        # pbr materials are never confused with preview materials of the same color
+        previewParams = usdex.core.PreviewMaterialParams()
+        previewParams.color = params.color
+        params = usdex.rtx.PbrMaterialParams()
+        params.color = previewParams.color
+        preview = registry.definePreviewMaterial("C", previewParams)
+        pbr = usdex.rtx.definePbrMaterial(registry, "C", params)
+        self.assertNotEqual(preview.GetPath(), pbr.GetPath())
+        self.assertFalse(preview.GetSurfaceOutput("mdl"))
+        self.assertTrue(pbr.GetSurfaceOutput("mdl"))
+        self.assertEqual(registry.getMaterialCount(), 4)
+
+    def testInvalidParams(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        materials = usdex.core.defineScope(stage.GetDefaultPrim(), usdex.core.getMaterialsToken()).GetPrim()
+        registry = usdex.core.MaterialRegistry(materials)
+
+        # nothing is registered when the material can not be defined
+        params = usdex.rtx.PbrMaterialParams()
+        params.emissiveColor = Gf.Vec3f(-1, 0, 0)
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid shader parameter value")]):
+            self.assertFalse(usdex.rtx.definePbrMaterial(registry, "Invalid", params))
+        self.assertEqual(registry.getMaterialCount(), 0)
+        self.assertFalse(materials.GetChildren())
+
+
+class BulkAuthoringMaterialTestCase(usdex.test.TestCase):
+
+    def defineAll(self, stage):
+        """Define each kind of material, including values which author additional specs or layer metadata"""
+        materials = usdex.core.defineScope(stage.GetDefaultPrim(), usdex.core.getMaterialsToken()).GetPrim()
+        result = [
+            usdex.rtx.definePbrMaterial(materials, "Pbr", Gf.Vec3f(0.25, 0.5, 0.75), roughness=0.2, metallic=1.0),
+            usdex.rtx.definePbrMaterial(materials, "Translucent", Gf.Vec3f(1, 0, 0), opacity=0.5),
+            usdex.rtx.defineGlassMaterial(materials, "Glass", Gf.Vec3f(0.5, 1, 1), 1.2),
+        ]
+        self.assertTrue(usdex.rtx.addDiffuseTextureToPbrMaterial(result[0], Sdf.AssetPath("./BaseColor.png")))
+        return result
+
+    def testClonePrototypes(self):
+        expected = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(expected, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        self.defineAll(expected)
+
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        with usdex.core.BulkAuthoringScope(stage):
+            materials = self.defineAll(stage)
+
+        # the copied specs are remapped to each material and match the UsdShade level authoring
+        for material in materials:
+            self.assertTrue(material)
+            mdlShader = usdex.rtx.computeEffectiveMdlSurfaceShader(material)
+            self.assertTrue(mdlShader)
+            self.assertTrue(mdlShader.GetPath().HasPrefix(material.GetPath()))
+        self.assertEqual(materials[2].GetInput("ior").Get(), 1.2)
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected.GetRootLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+    def testClonePrototypeAncestors(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        path = stage.GetDefaultPrim().GetPath().AppendPath("Looks/Nested/Material")
+        with usdex.core.BulkAuthoringScope(stage):
+            self.assertTrue(usdex.rtx.definePbrMaterial(stage, path, Gf.Vec3f(0.5)))
+
+        # missing ancestors are authored as typeless defs, rather than as overs which would not be traversed
+        for ancestor in (path.GetParentPath(), path.GetParentPath().GetParentPath()):
+            spec = stage.GetRootLayer().GetPrimAtPath(ancestor)
+            self.assertEqual(spec.specifier, Sdf.SpecifierDef)
+            self.assertEqual(spec.typeName, "")
+        self.assertTrue(stage.GetPrimAtPath(path).IsDefined())
+        self.assertIsValidUsd(stage)
+
+    def testValidation(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        path = stage.GetDefaultPrim().GetPath().AppendChild("Material")
+        with usdex.core.BulkAuthoringScope(stage):
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid shader parameter value")]):
+                self.assertFalse(usdex.rtx.definePbrMaterial(stage, path, Gf.Vec3f(0.5), roughness=2.0))
+            with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid shader parameter value")]):
+                self.assertFalse(usdex.rtx.defineGlassMaterial(stage, path, Gf.Vec3f(0.5), 5.0))
+            self.assertFalse(stage.GetPrimAtPath(path))
+
+            # an existing prim spec is redefined via the UsdShade API, retaining its other opinions
+            prim = usdex.core.defineScope(stage, path).GetPrim()
+            prim.SetDocumentation("retained")
+            material = usdex.rtx.definePbrMaterial(stage, path, Gf.Vec3f(0.5))
+            self.assertTrue(material)
+            self.assertEqual(material.GetPrim().GetDocumentation(), "retained")
+
+
+class PbrMaterialBuilderTestCase(usdex.test.TestCase):
+
+    def testMatchesChainedFunctions(self):
+        textures = {name: Sdf.AssetPath(f"./{name}.png") for name in ("Diffuse", "Normal", "ORM", "Opacity", "Emissive")}
+
+        expected = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(expected, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        material = usdex.rtx.definePbrMaterial(expected.GetDefaultPrim(), "Material", Gf.Vec3f(0.25, 0.5, 0.75), opacity=0.5)
+        self.assertTrue(usdex.rtx.addEmissiveColorToPbrMaterial(material, Gf.Vec3f(1, 0, 0), 200.0))
+        self.assertTrue(usdex.rtx.addDiffuseTextureToPbrMaterial(material, textures["Diffuse"]))
+        self.assertTrue(usdex.rtx.addNormalTextureToPbrMaterial(material, textures["Normal"]))
+        self.assertTrue(usdex.rtx.addOrmTextureToPbrMaterial(material, textures["ORM"]))
+        self.assertTrue(usdex.rtx.addOpacityTextureToPbrMaterial(material, textures["Opacity"]))
+        self.assertTrue(usdex.rtx.addEmissiveTextureToPbrMaterial(material, textures["Emissive"], 200.0))
+
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        builder = usdex.rtx.PbrMaterialBuilder()
+        builder.setColor(Gf.Vec3f(0.25, 0.5, 0.75)).setOpacity(0.5).setEmissiveColor(Gf.Vec3f(1, 0, 0), 200.0)
+        builder.setDiffuseTexture(textures["Diffuse"]).setNormalTexture(textures["Normal"]).setOrmTexture(textures["ORM"])
+        builder.setOpacityTexture(textures["Opacity"]).setEmissiveTexture(textures["Emissive"], 200.0)
+        self.assertEqual(builder.getParams().emissiveIntensity, 200.0)
+        material = builder.define(stage.GetDefaultPrim(), "Material")
+        self.assertTrue(material)
+        self.assertEqual(material.GetInput("ORMTexture").Get(), textures["ORM"])
+
+        # the material network and the fractional opacity render settings are identical
+        self.assertEqual(stage.GetRootLayer().ExportToString(), expected.GetRootLayer().ExportToString())
+        self.assertIsValidUsd(stage)
+
+    def testParams(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        params = usdex.rtx.PbrMaterialParams()
+        params.roughness = 0.1
+        params.metallicTexture = Sdf.AssetPath("./Metallic.png")
+
+        # the same builder defines any number of materials
+        builder = usdex.rtx.PbrMaterialBuilder(params)
+        path = stage.GetDefaultPrim().GetPath()
+        first = builder.define(stage, path.AppendChild("First"))
+        second = builder.define(stage, path.AppendChild("Second"))
+        for material in (first, second):
+            self.assertTrue(material)
+            self.assertEqual(material.GetInput("roughness").Get(), 0.1)
+            self.assertEqual(material.GetInput("MetallicTexture").Get(), params.metallicTexture)
+            self.assertFalse(material.GetInput("metallic"))
+
+    def testInvalidEmissiveColor(self):
+        stage = Usd.Stage.CreateInMemory()
+        usdex.core.configureStage(stage, self.defaultPrimName, self.defaultUpAxis, self.defaultLinearUnits, self.defaultAuthoringMetadata)
+        builder = usdex.rtx.PbrMaterialBuilder().setEmissiveColor(Gf.Vec3f(-1, 0, 0))
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid shader parameter value")]):
+            self.assertFalse(builder.define(stage.GetDefaultPrim(), "Material"))
+
+        # nothing is authored when the parameters are invalid
+        self.assertFalse(stage.GetDefaultPrim().GetChild("Material"))
+
+        with usdex.test.ScopedDiagnosticChecker(self, [(Tf.TF_DIAGNOSTIC_RUNTIME_ERROR_TYPE, ".*invalid location")]):
+            self.assertFalse(usdex.rtx.PbrMaterialBuilder().define(stage.GetDefaultPrim(), "1_Invalid"))
@@ -63,6 +63,14 @@ function m.setup_workspace(args)
         buildoptions { "-fvisibility=hidden", "-fdiagnostics-color", "-Wno-deprecated", "-Wconversion" }
     filter {}
 
+    -- detect data races in the concurrency tests (e.g. `test_usdex_core`), this is not intended for release builds
+    if _OPTIONS["tsan"] then
+        filter { "system:linux" }
+            buildoptions { "-fsanitize=thread", "-fno-omit-frame-pointer" }
+            linkoptions { "-fsanitize=thread" }
+        filter {}
+    end
+
     flags { "ShadowedVariables" }
 end
 
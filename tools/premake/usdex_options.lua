@@ -25,6 +25,11 @@ newoption {
     default = "3.10"
 }
 
+newoption {
+    trigger     = "tsan",
+    description = "(Optional) Instrument the build with ThreadSanitizer (Linux only)"
+}
+
 USD_FLAVOR = _OPTIONS["usd-flavor"]
 USD_VERSION = _OPTIONS["usd-ver"]
 PYTHON_VERSION = _OPTIONS["python-ver"]